@@ -1,8 +1,28 @@
-﻿namespace UnrealSharp.Binds;
+﻿using System.Runtime.InteropServices;
+
+namespace UnrealSharp.Binds;
+
+[StructLayout(LayoutKind.Sequential)]
+public struct ExportedFunctionEntry
+{
+    public ulong Hash;
+    public IntPtr FunctionPointer;
+    public int Size;
+}
+
+[StructLayout(LayoutKind.Sequential)]
+public unsafe struct BindsCallbacks
+{
+    public delegate* unmanaged[Cdecl]<char*, char*, int, IntPtr> GetBoundFunction;
+    public delegate* unmanaged[Cdecl]<ExportedFunctionEntry*, int, int> GetExportedFunctions;
+}
 
 public static class NativeBinds
 {
     private unsafe static delegate* unmanaged[Cdecl]<char*, char*, int, IntPtr> _getBoundFunction = null;
+    
+    // The whole native export table, fetched once so resolving a bind doesn't need to call into native code.
+    private static readonly Dictionary<ulong, ExportedFunctionEntry> ExportedFunctions = new();
 
     public unsafe static void InitializeNativeBinds(IntPtr bindsCallbacks)
     {
@@ -11,7 +31,22 @@ public static class NativeBinds
             throw new Exception("NativeBinds.InitializeNativeBinds called twice");
         }
 
-        _getBoundFunction = (delegate* unmanaged[Cdecl]<char*, char*, int, IntPtr>)bindsCallbacks;
+        BindsCallbacks* callbacks = (BindsCallbacks*) bindsCallbacks;
+        _getBoundFunction = callbacks->GetBoundFunction;
+
+        int numExportedFunctions = callbacks->GetExportedFunctions(null, 0);
+        ExportedFunctionEntry[] entries = new ExportedFunctionEntry[numExportedFunctions];
+        
+        fixed (ExportedFunctionEntry* entriesPtr = entries)
+        {
+            numExportedFunctions = callbacks->GetExportedFunctions(entriesPtr, entries.Length);
+        }
+
+        ExportedFunctions.EnsureCapacity(numExportedFunctions);
+        for (int i = 0; i < Math.Min(numExportedFunctions, entries.Length); i++)
+        {
+            ExportedFunctions[entries[i].Hash] = entries[i];
+        }
     }
 
     public unsafe static IntPtr TryGetBoundFunction(string outerName, string functionName, int functionSize)
@@ -21,6 +56,14 @@ public static class NativeBinds
             throw new Exception("NativeBinds not initialized");
         }
 
+        if (ExportedFunctions.TryGetValue(HashExportedFunctionName(outerName, functionName), out ExportedFunctionEntry entry) 
+            && entry.Size == functionSize)
+        {
+            return entry.FunctionPointer;
+        }
+
+        // Not in the table, because its name hash is shared with another export, or the size doesn't match.
+        // Let the native side do the full lookup by name and log why.
         IntPtr functionPtr = IntPtr.Zero;
         fixed (char* outerNamePtr = outerName)
         fixed (char* functionNamePtr = functionName)
@@ -35,4 +78,35 @@ public static class NativeBinds
 
         return functionPtr;
     }
+
+    // Must match FCSBindsManager::HashExportedFunctionName.
+    private static ulong HashExportedFunctionName(string outerName, string functionName)
+    {
+        ulong hash = 14695981039346656037;
+
+        void HashChar(uint c)
+        {
+            if (c >= 'A' && c <= 'Z')
+            {
+                c += 'a' - 'A';
+            }
+
+            hash ^= c;
+            hash *= 1099511628211;
+        }
+
+        foreach (char c in outerName)
+        {
+            HashChar(c);
+        }
+
+        HashChar('.');
+
+        foreach (char c in functionName)
+        {
+            HashChar(c);
+        }
+
+        return hash;
+    }
 }
\ No newline at end of file
@@ -0,0 +1,130 @@
+using System.Diagnostics.Tracing;
+using UnrealSharp.Core.Interop;
+
+namespace UnrealSharp.Core.Diagnostics;
+
+/// <summary>
+/// Runtime counters forwarded to the Unreal trace. Mirrors ECSRuntimeTraceCounter.
+/// </summary>
+public enum RuntimeTraceCounter
+{
+    GCCount,
+    GCPauseMs,
+    JittedMethods,
+    ThreadPoolWorkerThreads,
+    ThreadPoolQueueLength,
+}
+
+/// <summary>
+/// Listens to the GC, JIT and thread pool events of the runtime and forwards them to the Unreal trace,
+/// so they show up in Insights next to the frames they happened in instead of in a separate dotnet-trace session.
+/// Events are delivered on the listener's own thread shortly after they happen, so they are recorded as counters
+/// and bookmarks rather than as scopes on the thread that raised them.
+/// </summary>
+public sealed class RuntimeEventBridge : EventListener
+{
+    private const string RuntimeEventSourceName = "Microsoft-Windows-DotNETRuntime";
+
+    private const EventKeywords GCKeyword = (EventKeywords) 0x1;
+    private const EventKeywords JitKeyword = (EventKeywords) 0x10;
+    private const EventKeywords ThreadingKeyword = (EventKeywords) 0x10000;
+    
+    // Collections of generation 2 pause the game long enough to deserve a marker on the timeline.
+    private const int BookmarkedGeneration = 2;
+
+    private static RuntimeEventBridge? _instance;
+
+    private long _jittedMethods;
+    private int _gcGeneration;
+    private DateTime _suspendStartTime;
+
+    /// <summary>
+    /// Starts forwarding runtime events if the engine is tracing, or -UnrealSharpTraceRuntime was passed.
+    /// </summary>
+    public static void StartIfTracing()
+    {
+        if (_instance != null || !FCSTraceExporter.CallIsRuntimeTracingEnabled().ToManagedBool())
+        {
+            return;
+        }
+
+        _instance = new RuntimeEventBridge();
+    }
+
+    public static void Stop()
+    {
+        _instance?.Dispose();
+        _instance = null;
+    }
+
+    protected override void OnEventSourceCreated(EventSource eventSource)
+    {
+        if (eventSource.Name == RuntimeEventSourceName)
+        {
+            EnableEvents(eventSource, EventLevel.Informational, GCKeyword | JitKeyword | ThreadingKeyword);
+        }
+    }
+
+    protected override void OnEventWritten(EventWrittenEventArgs eventData)
+    {
+        switch (eventData.EventName)
+        {
+            case "GCStart_V2":
+                _gcGeneration = GetPayload<int>(eventData, "Depth");
+                SetCounter(RuntimeTraceCounter.GCCount, GetPayload<int>(eventData, "Count"));
+                break;
+            case "GCSuspendEEBegin_V1":
+                _suspendStartTime = eventData.TimeStamp;
+                break;
+            case "GCRestartEEEnd_V1":
+                double pauseMs = (eventData.TimeStamp - _suspendStartTime).TotalMilliseconds;
+                SetCounter(RuntimeTraceCounter.GCPauseMs, pauseMs);
+                
+                if (_gcGeneration >= BookmarkedGeneration)
+                {
+                    AddBookmark($"GC gen {_gcGeneration}: {pauseMs:F2} ms pause");
+                }
+                break;
+            case "MethodLoad_V1":
+            case "MethodLoad_V2":
+            case "MethodLoadVerbose_V1":
+            case "MethodLoadVerbose_V2":
+                SetCounter(RuntimeTraceCounter.JittedMethods, Interlocked.Increment(ref _jittedMethods));
+                break;
+            // The enqueue and dequeue events are verbose, the queue length is sampled whenever the pool changes size instead.
+            case "ThreadPoolWorkerThreadAdjustmentAdjustment":
+                SetCounter(RuntimeTraceCounter.ThreadPoolWorkerThreads, GetPayload<uint>(eventData, "NewWorkerThreadCount"));
+                SetCounter(RuntimeTraceCounter.ThreadPoolQueueLength, ThreadPool.PendingWorkItemCount);
+                break;
+            case "ThreadPoolWorkerThreadStart":
+            case "ThreadPoolWorkerThreadStop":
+                SetCounter(RuntimeTraceCounter.ThreadPoolWorkerThreads, GetPayload<uint>(eventData, "ActiveWorkerThreadCount"));
+                SetCounter(RuntimeTraceCounter.ThreadPoolQueueLength, ThreadPool.PendingWorkItemCount);
+                break;
+        }
+    }
+
+    private static T GetPayload<T>(EventWrittenEventArgs eventData, string name) where T : struct
+    {
+        int index = eventData.PayloadNames?.IndexOf(name) ?? -1;
+        if (index < 0 || eventData.Payload == null || eventData.Payload[index] is not T value)
+        {
+            return default;
+        }
+        
+        return value;
+    }
+
+    private static void SetCounter(RuntimeTraceCounter counter, double value)
+    {
+        FCSTraceExporter.CallSetRuntimeCounter((int) counter, value);
+    }
+
+    private static unsafe void AddBookmark(string text)
+    {
+        fixed (char* textPtr = text)
+        {
+            FCSTraceExporter.CallAddBookmark(textPtr);
+        }
+    }
+}
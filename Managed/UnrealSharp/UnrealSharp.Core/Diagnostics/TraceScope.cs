@@ -0,0 +1,53 @@
+using System.Collections.Concurrent;
+using UnrealSharp.Core.Interop;
+
+namespace UnrealSharp.Core.Diagnostics;
+
+/// <summary>
+/// A CPU scope in the Unreal trace, shown in Insights on the same timeline as native scopes.
+/// Does nothing when CPU tracing is off.
+/// <code>
+/// using (new TraceScope("UpdateInventory"))
+/// {
+///     ...
+/// }
+/// </code>
+/// </summary>
+public readonly ref struct TraceScope
+{
+    private static readonly ConcurrentDictionary<string, uint> ScopeIds = new();
+    
+    private readonly bool _isTracing;
+
+    public TraceScope(string name)
+    {
+        _isTracing = FCSTraceExporter.CallIsCpuTracing().ToManagedBool();
+        if (_isTracing)
+        {
+            FCSTraceExporter.CallBeginScope(GetScopeId(name));
+        }
+    }
+
+    public void Dispose()
+    {
+        if (_isTracing)
+        {
+            FCSTraceExporter.CallEndScope();
+        }
+    }
+    
+    private static unsafe uint GetScopeId(string name)
+    {
+        if (ScopeIds.TryGetValue(name, out uint scopeId))
+        {
+            return scopeId;
+        }
+        
+        fixed (char* namePtr = name)
+        {
+            scopeId = FCSTraceExporter.CallGetScopeId(namePtr);
+        }
+        
+        return ScopeIds.GetOrAdd(name, scopeId);
+    }
+}
@@ -47,6 +47,32 @@ public static class GCHandleUtilities
         return weakHandle;
     }
 
+    /// <summary>
+    /// Describes the strong handles other load contexts hold on objects of the given one, which keep it from unloading.
+    /// </summary>
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    public static List<string> DescribeStrongReferencesInto(AssemblyLoadContext loadContext)
+    {
+        List<string> references = new List<string>();
+        foreach (KeyValuePair<AssemblyLoadContext, ConcurrentDictionary<GCHandle, object>> pair in StrongRefsByAssembly)
+        {
+            if (pair.Key == loadContext)
+            {
+                continue;
+            }
+
+            foreach (object value in pair.Value.Values)
+            {
+                if (AssemblyLoadContext.GetLoadContext(value.GetType().Assembly) == loadContext)
+                {
+                    references.Add($"Strong handle allocated by {pair.Key.Name} on a {value.GetType().FullName}");
+                }
+            }
+        }
+
+        return references;
+    }
+
     [MethodImpl(MethodImplOptions.AggressiveInlining)]
     public static GCHandle AllocateWeakPointer(object value) => GCHandle.Alloc(value, GCHandleType.Weak);
         
@@ -0,0 +1,15 @@
+using UnrealSharp.Binds;
+
+namespace UnrealSharp.Core.Interop;
+
+[NativeCallbacks]
+public static unsafe partial class FCSTraceExporter
+{
+    public static delegate* unmanaged<NativeBool> IsRuntimeTracingEnabled;
+    public static delegate* unmanaged<NativeBool> IsCpuTracing;
+    public static delegate* unmanaged<char*, uint> GetScopeId;
+    public static delegate* unmanaged<uint, void> BeginScope;
+    public static delegate* unmanaged<void> EndScope;
+    public static delegate* unmanaged<int, double, void> SetRuntimeCounter;
+    public static delegate* unmanaged<char*, void> AddBookmark;
+}
@@ -6,4 +6,5 @@ namespace UnrealSharp.Interop;
 public unsafe partial class FStringExporter
 {
     public static delegate* unmanaged<IntPtr, char*, void> MarshalToNativeString;
+    public static delegate* unmanaged<IntPtr, char*, int, void> MarshalToNativeStringView;
 }
\ No newline at end of file
@@ -7,12 +7,24 @@ public unsafe struct ManagedCallbacks
 {   
     public delegate* unmanaged<IntPtr, IntPtr, char**, IntPtr> ScriptManagerBridge_CreateManagedObject;
     public delegate* unmanaged<IntPtr, IntPtr, IntPtr> ScriptManagerBridge_CreateNewManagedObjectWrapper;
-    public delegate* unmanaged<IntPtr, IntPtr, IntPtr, IntPtr, IntPtr, int> ScriptManagerBridge_InvokeManagedMethod;
+    public delegate* unmanaged<IntPtr, IntPtr, IntPtr, IntPtr, int> ScriptManagerBridge_InvokeManagedMethod;
     public delegate* unmanaged<IntPtr, void> ScriptManagerBridge_InvokeDelegate;
     public delegate* unmanaged<IntPtr, char*, IntPtr> ScriptManagerBridge_LookupManagedMethod;
     public delegate* unmanaged<IntPtr, char*, IntPtr> ScriptManagedBridge_LookupManagedType;
     public delegate* unmanaged<IntPtr, IntPtr, void> ScriptManagedBridge_Dispose;
     public delegate* unmanaged<IntPtr, void> ScriptManagedBridge_FreeHandle;
+    public delegate* unmanaged<IntPtr, IntPtr*, IntPtr, int, int, int> ScriptManagerBridge_InvokeManagedMethodBatch;
+    public delegate* unmanaged<IntPtr*, int, void> ScriptManagedBridge_DisposeHandles;
+    public delegate* unmanaged<IntPtr, IntPtr, void> ScriptManagedBridge_GetGeneratedTypeNames;
+    public delegate* unmanaged<IntPtr, char**, IntPtr*, int, int> ScriptManagerBridge_LookupManagedMethods;
+    public delegate* unmanaged<int, NativeBool, void> ScriptManagedBridge_CollectGarbage;
+    public delegate* unmanaged<long, NativeBool> ScriptManagedBridge_TryStartNoGCRegion;
+    public delegate* unmanaged<void> ScriptManagedBridge_EndNoGCRegion;
+    public delegate* unmanaged<ManagedGCMemoryInfo*, void> ScriptManagedBridge_GetGCMemoryInfo;
+    public delegate* unmanaged<IntPtr*, byte*, int, int> ScriptManagedBridge_FindDeadHandles;
+    public delegate* unmanaged<IntPtr, int> ScriptManagedBridge_PrepareChangedMethods;
+    public delegate* unmanaged<IntPtr*, IntPtr, IntPtr*, int, int> ScriptManagerBridge_CreateNewManagedObjects;
+    public delegate* unmanaged<IntPtr, void> ScriptManagerBridge_GetLastManagedException;
 
     public static void Initialize(IntPtr outManagedCallbacks)
     {
@@ -26,6 +38,18 @@ public unsafe struct ManagedCallbacks
             ScriptManagedBridge_LookupManagedType = &UnmanagedCallbacks.LookupManagedType,
             ScriptManagedBridge_Dispose = &UnmanagedCallbacks.Dispose,
             ScriptManagedBridge_FreeHandle = &UnmanagedCallbacks.FreeHandle,
+            ScriptManagerBridge_InvokeManagedMethodBatch = &UnmanagedCallbacks.InvokeManagedMethodBatch,
+            ScriptManagedBridge_DisposeHandles = &UnmanagedCallbacks.DisposeHandles,
+            ScriptManagedBridge_GetGeneratedTypeNames = &UnmanagedCallbacks.GetGeneratedTypeNames,
+            ScriptManagerBridge_LookupManagedMethods = &UnmanagedCallbacks.LookupManagedMethods,
+            ScriptManagedBridge_CollectGarbage = &UnmanagedCallbacks.CollectGarbage,
+            ScriptManagedBridge_TryStartNoGCRegion = &UnmanagedCallbacks.TryStartNoGCRegion,
+            ScriptManagedBridge_EndNoGCRegion = &UnmanagedCallbacks.EndNoGCRegion,
+            ScriptManagedBridge_GetGCMemoryInfo = &UnmanagedCallbacks.GetGCMemoryInfo,
+            ScriptManagedBridge_FindDeadHandles = &UnmanagedCallbacks.FindDeadHandles,
+            ScriptManagedBridge_PrepareChangedMethods = &UnmanagedCallbacks.PrepareChangedMethods,
+            ScriptManagerBridge_CreateNewManagedObjects = &UnmanagedCallbacks.CreateNewManagedObjects,
+            ScriptManagerBridge_GetLastManagedException = &UnmanagedCallbacks.GetLastManagedException,
         };
     }
 }
\ No newline at end of file
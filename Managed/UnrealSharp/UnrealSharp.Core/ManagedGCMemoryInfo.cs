@@ -0,0 +1,65 @@
+using System.Runtime.InteropServices;
+
+namespace UnrealSharp.Core;
+
+/// <summary>
+/// Snapshot of the .NET heap that native reads every frame. Mirrors FCSManagedGCMemoryInfo.
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+public struct ManagedGCMemoryInfo
+{
+    // Heap sizes are as of the last collection.
+    public long HeapSizeBytes;
+    public long FragmentedBytes;
+    public long CommittedBytes;
+    public long Gen0SizeBytes;
+    public long Gen1SizeBytes;
+    public long Gen2SizeBytes;
+    public long LargeObjectHeapSizeBytes;
+    public long PinnedObjectHeapSizeBytes;
+    
+    public long TotalAllocatedBytes;
+    public double LastPauseMilliseconds;
+    public double TotalPauseMilliseconds;
+    public double PauseTimePercentage;
+    
+    public int Gen0Collections;
+    public int Gen1Collections;
+    public int Gen2Collections;
+
+    private static ManagedGCMemoryInfo _cachedHeapInfo;
+    private static int _cachedCollectionCount = -1;
+    
+    public static ManagedGCMemoryInfo Sample()
+    {
+        // GC.GetGCMemoryInfo allocates, and the heap info only changes when a collection happens.
+        int collectionCount = GC.CollectionCount(0);
+        if (collectionCount != _cachedCollectionCount)
+        {
+            _cachedCollectionCount = collectionCount;
+            
+            GCMemoryInfo info = GC.GetGCMemoryInfo(GCKind.Any);
+            ReadOnlySpan<GCGenerationInfo> generations = info.GenerationInfo;
+            ReadOnlySpan<TimeSpan> pauses = info.PauseDurations;
+
+            _cachedHeapInfo.HeapSizeBytes = info.HeapSizeBytes;
+            _cachedHeapInfo.FragmentedBytes = info.FragmentedBytes;
+            _cachedHeapInfo.CommittedBytes = info.TotalCommittedBytes;
+            _cachedHeapInfo.Gen0SizeBytes = generations.Length > 0 ? generations[0].SizeAfterBytes : 0;
+            _cachedHeapInfo.Gen1SizeBytes = generations.Length > 1 ? generations[1].SizeAfterBytes : 0;
+            _cachedHeapInfo.Gen2SizeBytes = generations.Length > 2 ? generations[2].SizeAfterBytes : 0;
+            _cachedHeapInfo.LargeObjectHeapSizeBytes = generations.Length > 3 ? generations[3].SizeAfterBytes : 0;
+            _cachedHeapInfo.PinnedObjectHeapSizeBytes = generations.Length > 4 ? generations[4].SizeAfterBytes : 0;
+            _cachedHeapInfo.LastPauseMilliseconds = pauses.Length > 0 ? pauses[0].TotalMilliseconds : 0;
+            _cachedHeapInfo.PauseTimePercentage = info.PauseTimePercentage;
+        }
+
+        ManagedGCMemoryInfo sample = _cachedHeapInfo;
+        sample.TotalAllocatedBytes = GC.GetTotalAllocatedBytes(false);
+        sample.TotalPauseMilliseconds = GC.GetTotalPauseDuration().TotalMilliseconds;
+        sample.Gen0Collections = collectionCount;
+        sample.Gen1Collections = GC.CollectionCount(1);
+        sample.Gen2Collections = GC.CollectionCount(2);
+        return sample;
+    }
+}
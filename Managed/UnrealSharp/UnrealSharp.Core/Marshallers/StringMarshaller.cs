@@ -18,7 +18,7 @@ public static class StringMarshaller
             
             fixed (char* stringPtr = obj)
             {
-                FStringExporter.CallMarshalToNativeString(unrealString, stringPtr);
+                FStringExporter.CallMarshalToNativeStringView(unrealString, stringPtr, obj.Length);
             }
         }
     }
@@ -28,7 +28,33 @@ public static class StringMarshaller
         unsafe
         {
             UnmanagedArray unrealString = BlittableMarshaller<UnmanagedArray>.FromNative(nativeBuffer, arrayIndex);
-            return unrealString.Data == IntPtr.Zero ? string.Empty : new string((char*) unrealString.Data);
+            
+            // ArrayNum includes the null terminator.
+            if (unrealString.Data == IntPtr.Zero || unrealString.ArrayNum <= 1)
+            {
+                return string.Empty;
+            }
+            
+            return new string((char*) unrealString.Data, 0, unrealString.ArrayNum - 1);
+        }
+    }
+    
+    /// <summary>
+    /// Gives a view of the characters of a native FString without copying them.
+    /// Only valid until the native string is modified or destroyed.
+    /// </summary>
+    public static ReadOnlySpan<char> AsSpan(IntPtr nativeBuffer, int arrayIndex)
+    {
+        unsafe
+        {
+            UnmanagedArray unrealString = BlittableMarshaller<UnmanagedArray>.FromNative(nativeBuffer, arrayIndex);
+            
+            if (unrealString.Data == IntPtr.Zero || unrealString.ArrayNum <= 1)
+            {
+                return ReadOnlySpan<char>.Empty;
+            }
+            
+            return new ReadOnlySpan<char>((char*) unrealString.Data, unrealString.ArrayNum - 1);
         }
     }
     
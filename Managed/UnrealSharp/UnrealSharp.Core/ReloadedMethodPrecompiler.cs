@@ -0,0 +1,79 @@
+using System.Reflection;
+using System.Runtime.CompilerServices;
+
+namespace UnrealSharp.Core;
+
+/// <summary>
+/// Compiles the methods that changed in a hot reload on worker threads, before the reloaded assembly is used.
+/// Changes are found by hashing the IL of every method and comparing it to the previous version of the assembly.
+/// </summary>
+public static class ReloadedMethodPrecompiler
+{
+    private const BindingFlags DeclaredMethods = BindingFlags.DeclaredOnly | BindingFlags.Instance | BindingFlags.Static | BindingFlags.Public | BindingFlags.NonPublic;
+
+    // IL hashes of the last version of each assembly, by assembly name. Only the game thread reloads assemblies.
+    private static readonly Dictionary<string, Dictionary<string, int>> MethodBodyHashesByAssembly = new();
+
+    public static int PrepareChangedMethods(Assembly assembly)
+    {
+        string assemblyName = assembly.GetName().Name!;
+        MethodBodyHashesByAssembly.TryGetValue(assemblyName, out Dictionary<string, int>? previousHashes);
+
+        Dictionary<string, int> methodBodyHashes = new();
+        List<MethodBase> changedMethods = new();
+
+        foreach (Type type in assembly.GetTypes())
+        {
+            // Open generic code can only be compiled once it's instantiated
+            if (type.ContainsGenericParameters)
+            {
+                continue;
+            }
+
+            foreach (MethodBase method in type.GetMethods(DeclaredMethods).Concat<MethodBase>(type.GetConstructors(DeclaredMethods)))
+            {
+                if (method.IsAbstract || method.ContainsGenericParameters)
+                {
+                    continue;
+                }
+
+                byte[]? il = method.GetMethodBody()?.GetILAsByteArray();
+                if (il == null)
+                {
+                    continue;
+                }
+
+                HashCode hash = new HashCode();
+                hash.AddBytes(il);
+                int bodyHash = hash.ToHashCode();
+
+                string key = $"{type.FullName}::{method}";
+                methodBodyHashes[key] = bodyHash;
+
+                // Without a previous version everything counts as changed
+                if (previousHashes == null || !previousHashes.TryGetValue(key, out int previousHash) || previousHash != bodyHash)
+                {
+                    changedMethods.Add(method);
+                }
+            }
+        }
+
+        MethodBodyHashesByAssembly[assemblyName] = methodBodyHashes;
+
+        int preparedMethods = 0;
+        Parallel.ForEach(changedMethods, method =>
+        {
+            try
+            {
+                RuntimeHelpers.PrepareMethod(method.MethodHandle);
+                Interlocked.Increment(ref preparedMethods);
+            }
+            catch (Exception)
+            {
+                // Methods the JIT can't compile ahead of their first call are compiled then, as usual
+            }
+        });
+
+        return preparedMethods;
+    }
+}
@@ -1,4 +1,6 @@
 ﻿using System.Reflection;
+using System.Runtime;
+using System.Runtime.CompilerServices;
 using System.Runtime.InteropServices;
 using UnrealSharp.Core.Attributes;
 using UnrealSharp.Core.Marshallers;
@@ -35,6 +37,42 @@ public static class UnmanagedCallbacks
         return IntPtr.Zero;
     }
 
+    [UnmanagedCallersOnly]
+    public static unsafe int CreateNewManagedObjects(IntPtr* nativeObjects, IntPtr typeHandlePtr, IntPtr* outHandles, int count)
+    {
+        Type? type = GCHandleUtilities.GetObjectFromHandlePtr<Type>(typeHandlePtr);
+        
+        if (type == null)
+        {
+            LogUnrealSharpCore.LogError("Invalid type handle passed to CreateNewManagedObjects");
+            return 0;
+        }
+        
+        int createdObjects = 0;
+        
+        for (int i = 0; i < count; i++)
+        {
+            outHandles[i] = IntPtr.Zero;
+            
+            // Objects that fail are left with a null handle, and get their counterpart the first time they're used instead.
+            try
+            {
+                outHandles[i] = UnrealSharpObject.Create(type, nativeObjects[i]);
+                
+                if (outHandles[i] != IntPtr.Zero)
+                {
+                    createdObjects++;
+                }
+            }
+            catch (Exception ex)
+            {
+                LogUnrealSharpCore.LogError($"Failed to create new managed object: {ex.Message}");
+            }
+        }
+        
+        return createdObjects;
+    }
+
     [UnmanagedCallersOnly]
     public static IntPtr CreateNewManagedObjectWrapper(IntPtr managedObjectHandle, IntPtr typeHandlePtr)
     {
@@ -120,6 +158,59 @@ public static class UnmanagedCallbacks
         return IntPtr.Zero;
     }
     
+    [UnmanagedCallersOnly]
+    public static unsafe int LookupManagedMethods(IntPtr typeHandlePtr, char** functionNames, IntPtr* outMethodHandles, int count)
+    {
+        const string invokePrefix = "Invoke_";
+        int foundMethods = 0;
+        
+        try
+        {
+            Type? type = GCHandleUtilities.GetObjectFromHandlePtr<Type>(typeHandlePtr);
+            
+            if (type == null)
+            {
+                throw new Exception("Invalid type handle");
+            }
+            
+            // Same resolution as LookupManagedMethod: methods of the most derived type win.
+            Dictionary<string, MethodInfo> invokeMethods = new Dictionary<string, MethodInfo>();
+            BindingFlags flags = BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance | BindingFlags.Static | BindingFlags.DeclaredOnly;
+            
+            for (Type? currentType = type; currentType != null; currentType = currentType.BaseType)
+            {
+                foreach (MethodInfo method in currentType.GetMethods(flags))
+                {
+                    if (method.Name.StartsWith(invokePrefix, StringComparison.Ordinal))
+                    {
+                        invokeMethods.TryAdd(method.Name.Substring(invokePrefix.Length), method);
+                    }
+                }
+            }
+            
+            for (int i = 0; i < count; i++)
+            {
+                outMethodHandles[i] = IntPtr.Zero;
+                
+                if (!invokeMethods.TryGetValue(new string(functionNames[i]), out MethodInfo? method))
+                {
+                    continue;
+                }
+                
+                IntPtr functionPtr = method.MethodHandle.GetFunctionPointer();
+                GCHandle methodHandle = GCHandleUtilities.AllocateStrongPointer(functionPtr, type.Assembly);
+                outMethodHandles[i] = GCHandle.ToIntPtr(methodHandle);
+                foundMethods++;
+            }
+        }
+        catch (Exception e)
+        {
+            LogUnrealSharpCore.LogError($"Exception while trying to look up managed methods: {e.Message}");
+        }
+
+        return foundMethods;
+    }
+    
     [UnmanagedCallersOnly]
     public static unsafe IntPtr LookupManagedType(IntPtr assemblyHandle, char* fullTypeName)
     {
@@ -142,40 +233,98 @@ public static class UnmanagedCallbacks
         }
     }
     
+    // Types are looked up one by one while an assembly loads, from several threads. Scanning all types for each of them adds up.
+    private static readonly ConditionalWeakTable<Assembly, Dictionary<string, Type>> GeneratedTypesByAssembly = new();
+    
     private static IntPtr FindTypeInAssembly(Assembly assembly, string fullTypeName)
+    {
+        Dictionary<string, Type> generatedTypes = GeneratedTypesByAssembly.GetValue(assembly, GetGeneratedTypes);
+        if (!generatedTypes.TryGetValue(fullTypeName, out Type? type))
+        {
+            return IntPtr.Zero;
+        }
+
+        return GCHandle.ToIntPtr(GCHandleUtilities.AllocateStrongPointer(type, assembly));
+    }
+    
+    private static Dictionary<string, Type> GetGeneratedTypes(Assembly assembly)
     {
         Type[] types = assembly.GetTypes();
+        Dictionary<string, Type> generatedTypes = new Dictionary<string, Type>(types.Length);
+        
         foreach (Type type in types)
         {
-            foreach (CustomAttributeData attributeData in type.CustomAttributes)
+            string? fullName = GetGeneratedTypeFullName(type);
+            if (fullName != null)
             {
-                if (attributeData.AttributeType.FullName != typeof(GeneratedTypeAttribute).FullName)
-                {
-                    continue;
-                }
+                generatedTypes.TryAdd(fullName, type);
+            }
+        }
 
-                if (attributeData.ConstructorArguments.Count != 2)
-                {
-                    continue;
-                }
+        return generatedTypes;
+    }
+    
+    private static string? GetGeneratedTypeFullName(Type type)
+    {
+        foreach (CustomAttributeData attributeData in type.CustomAttributes)
+        {
+            if (attributeData.AttributeType.FullName != typeof(GeneratedTypeAttribute).FullName)
+            {
+                continue;
+            }
+
+            if (attributeData.ConstructorArguments.Count != 2)
+            {
+                continue;
+            }
+
+            return (string)attributeData.ConstructorArguments[1].Value!;
+        }
+        
+        return null;
+    }
+    
+    [UnmanagedCallersOnly]
+    public static void GetGeneratedTypeNames(IntPtr assemblyHandle, IntPtr outTypeNames)
+    {
+        try
+        {
+            Assembly? loadedAssembly = GCHandleUtilities.GetObjectFromHandlePtr<Assembly>(assemblyHandle);
 
-                string fullName = (string)attributeData.ConstructorArguments[1].Value!;
-                if (fullName == fullTypeName)
+            if (loadedAssembly == null)
+            {
+                throw new InvalidOperationException("The provided assembly handle does not point to a valid assembly.");
+            }
+            
+            List<string> typeNames = new List<string>();
+            foreach (Type type in loadedAssembly.GetTypes())
+            {
+                string? fullName = GetGeneratedTypeFullName(type);
+                if (!string.IsNullOrEmpty(fullName))
                 {
-                    return GCHandle.ToIntPtr(GCHandleUtilities.AllocateStrongPointer(type, assembly));
+                    typeNames.Add(fullName);
                 }
             }
+            
+            // Written into a single FString separated by semicolons, the native side splits it up.
+            StringMarshaller.ToNative(outTypeNames, 0, string.Join(';', typeNames));
+        }
+        catch (Exception ex)
+        {
+            LogUnrealSharpCore.LogError($"Exception during GetGeneratedTypeNames: {ex.Message}");
         }
-
-        return IntPtr.Zero;
     }
     
+    // The last exception a managed method invoked from native code threw on this thread.
+    // Only formatted when native code asks for it, repeated exceptions it doesn't report cost nothing but the throw.
+    [ThreadStatic]
+    private static Exception? _lastInvokeException;
+    
     [UnmanagedCallersOnly]
     public static unsafe int InvokeManagedMethod(IntPtr managedObjectHandle,
         IntPtr methodHandlePtr, 
         IntPtr argumentsBuffer, 
-        IntPtr returnValueBuffer, 
-        IntPtr exceptionTextBuffer)
+        IntPtr returnValueBuffer)
     {
         try
         {
@@ -193,12 +342,75 @@ public static class UnmanagedCallbacks
         }
         catch (Exception ex)
         {
-            StringMarshaller.ToNative(exceptionTextBuffer, 0, ex.ToString());
-            LogUnrealSharpCore.LogError($"Exception during InvokeManagedMethod: {ex.Message}");
+            _lastInvokeException = ex;
             return 1;
         }
     }
 
+    [UnmanagedCallersOnly]
+    public static unsafe int InvokeManagedMethodBatch(IntPtr methodHandlePtr,
+        IntPtr* managedObjectHandles,
+        IntPtr argumentsBlock,
+        int argumentsStride,
+        int count)
+    {
+        IntPtr? methodHandle = GCHandleUtilities.GetObjectFromHandlePtr<IntPtr>(methodHandlePtr);
+        
+        if (methodHandle == null)
+        {
+            _lastInvokeException = new Exception("Invalid method handle passed to InvokeManagedMethodBatch");
+            return count;
+        }
+        
+        delegate*<object, IntPtr, IntPtr, void> methodPtr = (delegate*<object, IntPtr, IntPtr, void>) methodHandle;
+        int failedInvocations = 0;
+        
+        for (int i = 0; i < count; i++)
+        {
+            // Objects without a managed counterpart are passed as null handles to keep the arguments in step.
+            if (managedObjectHandles[i] == IntPtr.Zero)
+            {
+                continue;
+            }
+            
+            try
+            {
+                object? managedObject = GCHandleUtilities.GetObjectFromHandlePtr<object>(managedObjectHandles[i]);
+                
+                if (managedObject == null)
+                {
+                    throw new Exception($"Invalid target handle at index {i}");
+                }
+                
+                methodPtr(managedObject, argumentsBlock + i * argumentsStride, IntPtr.Zero);
+            }
+            catch (Exception ex)
+            {
+                // Only the first exception is reported back, the rest are counted.
+                if (failedInvocations == 0)
+                {
+                    _lastInvokeException = ex;
+                }
+                
+                failedInvocations++;
+            }
+        }
+        
+        return failedInvocations;
+    }
+    
+    [UnmanagedCallersOnly]
+    public static void GetLastManagedException(IntPtr outMessage)
+    {
+        Exception? exception = _lastInvokeException;
+        _lastInvokeException = null;
+        
+        if (exception != null && outMessage != IntPtr.Zero)
+        {
+            StringMarshaller.ToNative(outMessage, 0, exception.ToString());
+        }
+    }
+
     [UnmanagedCallersOnly]
     public static void InvokeDelegate(IntPtr delegatePtr)
     {
@@ -211,7 +423,15 @@ public static class UnmanagedCallbacks
                 throw new Exception("Invalid delegate handle");
             }
 
-            foundDelegate.DynamicInvoke();
+            // Timers and continuations are plain actions, which don't need reflection to call.
+            if (foundDelegate is Action action)
+            {
+                action();
+            }
+            else
+            {
+                foundDelegate.DynamicInvoke();
+            }
         }
         catch (Exception ex)
         {
@@ -238,6 +458,57 @@ public static class UnmanagedCallbacks
         GCHandleUtilities.Free(foundHandle, foundAssembly);
     }
 
+    [UnmanagedCallersOnly]
+    public static unsafe void DisposeHandles(IntPtr* handles, int count)
+    {
+        // Handles come in pairs of (handle, assembly handle). Consecutive handles mostly share an assembly.
+        IntPtr lastAssemblyHandle = IntPtr.Zero;
+        Assembly? lastAssembly = null;
+        int failedDisposals = 0;
+        
+        for (int i = 0; i < count; i++)
+        {
+            try
+            {
+                GCHandle foundHandle = GCHandle.FromIntPtr(handles[i * 2]);
+                
+                if (!foundHandle.IsAllocated)
+                {
+                    continue;
+                }
+                
+                if (foundHandle.Target is IDisposable disposable)
+                {
+                    disposable.Dispose();
+                }
+                
+                IntPtr assemblyHandle = handles[i * 2 + 1];
+                if (assemblyHandle != lastAssemblyHandle)
+                {
+                    lastAssemblyHandle = assemblyHandle;
+                    lastAssembly = GCHandleUtilities.GetObjectFromHandlePtr<Assembly>(assemblyHandle);
+                }
+                
+                GCHandleUtilities.Free(foundHandle, lastAssembly);
+            }
+            catch (Exception ex)
+            {
+                // Only the first failure is logged, so a bad batch doesn't flood the log.
+                if (failedDisposals == 0)
+                {
+                    LogUnrealSharpCore.LogError($"Exception during DisposeHandles: {ex.Message}");
+                }
+                
+                failedDisposals++;
+            }
+        }
+        
+        if (failedDisposals > 1)
+        {
+            LogUnrealSharpCore.LogError($"{failedDisposals} of {count} handles failed to dispose in DisposeHandles");
+        }
+    }
+
     [UnmanagedCallersOnly]
     public static void FreeHandle(IntPtr handle)
     {
@@ -251,4 +522,89 @@ public static class UnmanagedCallbacks
             
         foundHandle.Free();
     }
+
+    [UnmanagedCallersOnly]
+    public static void CollectGarbage(int generation, NativeBool compact)
+    {
+        GCSettings.LargeObjectHeapCompactionMode = compact.ToManagedBool()
+            ? GCLargeObjectHeapCompactionMode.CompactOnce
+            : GCLargeObjectHeapCompactionMode.Default;
+        
+        GC.Collect(Math.Min(generation, GC.MaxGeneration), GCCollectionMode.Forced, true, compact.ToManagedBool());
+    }
+
+    [UnmanagedCallersOnly]
+    public static NativeBool TryStartNoGCRegion(long totalSize)
+    {
+        if (GCSettings.LatencyMode == GCLatencyMode.NoGCRegion)
+        {
+            return NativeBool.True;
+        }
+        
+        try
+        {
+            return GC.TryStartNoGCRegion(totalSize).ToNativeBool();
+        }
+        catch (ArgumentOutOfRangeException ex)
+        {
+            LogUnrealSharpCore.LogWarning($"Failed to start a no GC region of {totalSize} bytes: {ex.Message}");
+            return NativeBool.False;
+        }
+    }
+
+    [UnmanagedCallersOnly]
+    public static void EndNoGCRegion()
+    {
+        // The runtime leaves the region by itself once more than its budget has been allocated.
+        if (GCSettings.LatencyMode != GCLatencyMode.NoGCRegion)
+        {
+            return;
+        }
+        
+        GC.EndNoGCRegion();
+    }
+
+    [UnmanagedCallersOnly]
+    public static unsafe void GetGCMemoryInfo(ManagedGCMemoryInfo* outInfo)
+    {
+        *outInfo = ManagedGCMemoryInfo.Sample();
+    }
+
+    [UnmanagedCallersOnly]
+    public static unsafe int FindDeadHandles(IntPtr* handles, byte* outIsDead, int count)
+    {
+        int deadHandles = 0;
+        
+        for (int i = 0; i < count; i++)
+        {
+            GCHandle handle = GCHandle.FromIntPtr(handles[i]);
+            bool isDead = !handle.IsAllocated || handle.Target == null;
+            
+            outIsDead[i] = isDead ? (byte) 1 : (byte) 0;
+            deadHandles += isDead ? 1 : 0;
+        }
+
+        return deadHandles;
+    }
+
+    [UnmanagedCallersOnly]
+    public static int PrepareChangedMethods(IntPtr assemblyHandle)
+    {
+        try
+        {
+            Assembly? loadedAssembly = GCHandleUtilities.GetObjectFromHandlePtr<Assembly>(assemblyHandle);
+
+            if (loadedAssembly == null)
+            {
+                throw new InvalidOperationException("The provided assembly handle does not point to a valid assembly.");
+            }
+
+            return ReloadedMethodPrecompiler.PrepareChangedMethods(loadedAssembly);
+        }
+        catch (Exception ex)
+        {
+            LogUnrealSharpCore.LogError($"Exception during PrepareChangedMethods: {ex.Message}");
+            return 0;
+        }
+    }
 }
\ No newline at end of file
@@ -4,6 +4,7 @@ using System.Text;
 using Microsoft.Build.Evaluation;
 using Microsoft.Build.Execution;
 using Microsoft.Build.Framework;
+using Microsoft.Build.Graph;
 using UnrealSharp.Core;
 using UnrealSharp.Core.Marshallers;
 using UnrealSharp.Editor.Interop;
@@ -17,7 +18,7 @@ namespace UnrealSharp.Editor;
 [StructLayout(LayoutKind.Sequential)]
 public unsafe struct FManagedUnrealSharpEditorCallbacks
 {
-    public delegate* unmanaged<char*, char*, char*, LoggerVerbosity, IntPtr, NativeBool, NativeBool> BuildProjects;
+    public delegate* unmanaged<char*, char*, char*, LoggerVerbosity, IntPtr, NativeBool, char*, NativeBool> BuildProjects;
     public delegate* unmanaged<void> ForceManagedGC;
     public delegate* unmanaged<char*, IntPtr, NativeBool> OpenSolution;
     public delegate* unmanaged<char*, void> AddProjectToCollection;
@@ -80,7 +81,8 @@ public static class ManagedUnrealSharpEditorCallbacks
         char* buildConfiguration,
         LoggerVerbosity loggerVerbosity,
         IntPtr exceptionBuffer,
-        NativeBool buildSolution)
+        NativeBool buildSolution,
+        char* changedFiles)
     {
         try
         {
@@ -91,10 +93,11 @@ public static class ManagedUnrealSharpEditorCallbacks
                 ErrorCollectingLogger logger = new ErrorCollectingLogger(loggerVerbosity);
                 BuildParameters buildParameters = new(ProjectCollection)
                 {
-                    Loggers = new List<ILogger> { logger }
+                    Loggers = new List<ILogger> { logger },
+                    MaxNodeCount = Environment.ProcessorCount,
                 };
 
-                Dictionary<string, string?> globalProperties = new()
+                Dictionary<string, string> globalProperties = new()
                 {
                     ["Configuration"] = buildConfigurationString,
                 };
@@ -130,15 +133,16 @@ public static class ManagedUnrealSharpEditorCallbacks
                     }
                 }
 
-                BuildRequestData buildRequest = new BuildRequestData(
-                    new string(solutionPath),
-                    globalProperties,
-                    null,
-                    new[] { "Build" },
-                    null
-                );
+                // Build as a project graph, so independent projects build in parallel and only in dependency order.
+                // When the changed scripts are known, only their projects and the projects depending on them are entry points.
+                List<string>? affectedProjects = GetAffectedProjects(new string(changedFiles));
+                IEnumerable<ProjectGraphEntryPoint> entryPoints = affectedProjects != null
+                    ? affectedProjects.Select(projectPath => new ProjectGraphEntryPoint(projectPath, globalProperties))
+                    : new[] { new ProjectGraphEntryPoint(new string(solutionPath), globalProperties) };
 
-                BuildResult result = UnrealSharpBuildManager.Build(buildParameters, buildRequest);
+                GraphBuildRequestData buildRequest = new GraphBuildRequestData(entryPoints, new[] { "Build" });
+
+                GraphBuildResult result = UnrealSharpBuildManager.Build(buildParameters, buildRequest);
                 if (result.OverallResult == BuildResultCode.Failure)
                 {
                     throw new Exception(logger.ErrorLog.ToString());
@@ -156,6 +160,72 @@ public static class ManagedUnrealSharpEditorCallbacks
         return NativeBool.True;
     }
 
+    /// <summary>
+    /// Finds the projects that have to be built for the changed scripts, including the projects that reference them.
+    /// Returns null when the whole solution has to be built.
+    /// </summary>
+    static List<string>? GetAffectedProjects(string changedFiles)
+    {
+        if (string.IsNullOrEmpty(changedFiles))
+        {
+            return null;
+        }
+
+        List<Project> projects = ProjectCollection.LoadedProjects.ToList();
+        HashSet<string> affectedProjects = new(StringComparer.OrdinalIgnoreCase);
+
+        foreach (string changedFile in changedFiles.Split(';', StringSplitOptions.RemoveEmptyEntries))
+        {
+            string fullPath = Path.GetFullPath(changedFile);
+            Project? owningProject = projects
+                .Where(project => fullPath.StartsWith(project.DirectoryPath + Path.DirectorySeparatorChar, StringComparison.OrdinalIgnoreCase))
+                .MaxBy(project => project.DirectoryPath.Length);
+
+            if (owningProject == null)
+            {
+                // Not part of any known project, it may belong to a project that was just added.
+                return null;
+            }
+
+            affectedProjects.Add(owningProject.FullPath);
+        }
+
+        Dictionary<string, List<string>> dependentProjects = new(StringComparer.OrdinalIgnoreCase);
+        foreach (Project project in projects)
+        {
+            foreach (ProjectItem reference in project.GetItems("ProjectReference"))
+            {
+                string referencePath = Path.GetFullPath(Path.Combine(project.DirectoryPath, reference.EvaluatedInclude));
+                if (!dependentProjects.TryGetValue(referencePath, out List<string>? dependents))
+                {
+                    dependents = new List<string>();
+                    dependentProjects.Add(referencePath, dependents);
+                }
+
+                dependents.Add(project.FullPath);
+            }
+        }
+
+        Queue<string> projectsToVisit = new(affectedProjects);
+        while (projectsToVisit.TryDequeue(out string? projectPath))
+        {
+            if (!dependentProjects.TryGetValue(projectPath, out List<string>? dependents))
+            {
+                continue;
+            }
+
+            foreach (string dependent in dependents)
+            {
+                if (affectedProjects.Add(dependent))
+                {
+                    projectsToVisit.Enqueue(dependent);
+                }
+            }
+        }
+
+        return affectedProjects.ToList();
+    }
+
     static unsafe void Weave(char* outputPath, string buildConfiguration)
     {
         List<string> assemblyPaths = new();
@@ -5,5 +5,7 @@ namespace UnrealSharp.Log;
 [NativeCallbacks]
 public static unsafe partial class FMsgExporter
 {
-    public static delegate* unmanaged<char*, ELogVerbosity, char*, void> Log;
-}
\ No newline at end of file
+    public static delegate* unmanaged<char*, IntPtr> GetLogCategory;
+    public static delegate* unmanaged<IntPtr, ELogVerbosity, byte> IsLogActive;
+    public static delegate* unmanaged<IntPtr, ELogVerbosity, char*, int, void> Log;
+}
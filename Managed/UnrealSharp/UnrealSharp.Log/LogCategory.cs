@@ -0,0 +1,86 @@
+using System.Runtime.CompilerServices;
+
+namespace UnrealSharp.Log;
+
+/// <summary>
+/// A log category, resolved to its native category once and then checked before any message is formatted or marshalled.
+/// </summary>
+public sealed class LogCategory
+{
+    public string Name { get; }
+    
+    private IntPtr _nativeCategory;
+
+    public LogCategory(string name)
+    {
+        Name = name;
+    }
+
+    private unsafe IntPtr NativeCategory
+    {
+        get
+        {
+            if (_nativeCategory == IntPtr.Zero)
+            {
+                fixed (char* namePtr = Name)
+                {
+                    _nativeCategory = FMsgExporter.CallGetLogCategory(namePtr);
+                }
+            }
+            
+            return _nativeCategory;
+        }
+    }
+
+    /// <summary>
+    /// Whether messages of this verbosity are printed, taking the "Log" console command and the ini settings into account.
+    /// </summary>
+    public bool IsActive(ELogVerbosity verbosity)
+    {
+        return FMsgExporter.CallIsLogActive(NativeCategory, verbosity) != 0;
+    }
+    
+    public unsafe void Log(ELogVerbosity verbosity, ReadOnlySpan<char> message)
+    {
+        fixed (char* messagePtr = message)
+        {
+            FMsgExporter.CallLog(NativeCategory, verbosity, messagePtr, message.Length);
+        }
+    }
+    
+    /// <summary>
+    /// Only formats the message when the verbosity is active, so disabled verbose logging costs a single check.
+    /// </summary>
+    public void Log(ELogVerbosity verbosity, [InterpolatedStringHandlerArgument("", "verbosity")] ref LogInterpolatedStringHandler message)
+    {
+        if (message.IsEnabled)
+        {
+            Log(verbosity, message.ToStringAndClear());
+        }
+    }
+}
+
+[InterpolatedStringHandler]
+public ref struct LogInterpolatedStringHandler
+{
+    private DefaultInterpolatedStringHandler _builder;
+    
+    public bool IsEnabled { get; }
+
+    public LogInterpolatedStringHandler(int literalLength, int formattedCount, LogCategory category, ELogVerbosity verbosity, out bool shouldAppend)
+    {
+        IsEnabled = category.IsActive(verbosity);
+        shouldAppend = IsEnabled;
+        _builder = IsEnabled ? new DefaultInterpolatedStringHandler(literalLength, formattedCount) : default;
+    }
+
+    public void AppendLiteral(string value) => _builder.AppendLiteral(value);
+    public void AppendFormatted<T>(T value) => _builder.AppendFormatted(value);
+    public void AppendFormatted<T>(T value, string? format) => _builder.AppendFormatted(value, format);
+    public void AppendFormatted<T>(T value, int alignment) => _builder.AppendFormatted(value, alignment);
+    public void AppendFormatted<T>(T value, int alignment, string? format) => _builder.AppendFormatted(value, alignment, format);
+    public void AppendFormatted(ReadOnlySpan<char> value) => _builder.AppendFormatted(value);
+    public void AppendFormatted(string? value) => _builder.AppendFormatted(value);
+
+    internal string ToStringAndClear() => _builder.ToStringAndClear();
+}
@@ -1,17 +1,22 @@
+using System.Collections.Concurrent;
+
 namespace UnrealSharp.Log;
 
 public static class UnrealLogger
 {
+    private static readonly ConcurrentDictionary<string, LogCategory> Categories = new();
+
+    /// <summary>
+    /// The category with this name, resolved to its native category the first time it is used.
+    /// </summary>
+    public static LogCategory GetCategory(string logName)
+    {
+        return Categories.GetOrAdd(logName, static name => new LogCategory(name));
+    }
+    
     public static void Log(string logName, string message, ELogVerbosity logVerbosity = ELogVerbosity.Display)
     {
-        unsafe
-        {
-            fixed (char* logNamePtr = logName)
-            fixed (char* stringPtr = message)
-            {
-                FMsgExporter.CallLog(logNamePtr, logVerbosity, stringPtr);
-            }
-        }
+        GetCategory(logName).Log(logVerbosity, message);
     }
     
     public static void LogWarning(string logName, string message)
@@ -0,0 +1,6 @@
+namespace UnrealSharp.Plugins;
+
+/// <summary>
+/// An assembly image, and optionally its symbols, that native has already mapped or read into memory.
+/// </summary>
+public sealed record AssemblyImage(Stream Image, Stream? PdbImage);
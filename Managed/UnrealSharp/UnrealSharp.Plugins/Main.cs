@@ -2,6 +2,7 @@
 using Microsoft.Build.Locator;
 using UnrealSharp.Binds;
 using UnrealSharp.Core;
+using UnrealSharp.Core.Diagnostics;
 using UnrealSharp.Shared;
 
 namespace UnrealSharp.Plugins;
@@ -10,7 +11,8 @@ public static class Main
 {
     internal static DllImportResolver _dllImportResolver = null!;
 
-    [UnmanagedCallersOnly]
+    // The entry point is only exported when compiled with NativeAOT, hostfxr looks the method up by name.
+    [UnmanagedCallersOnly(EntryPoint = "UnrealSharp_InitializeUnrealSharp")]
     private static unsafe NativeBool InitializeUnrealSharp(char* workingDirectoryPath, nint assemblyPath, PluginsCallbacks* pluginCallbacks, IntPtr bindsCallbacks, IntPtr managedCallbacks)
     {
         try
@@ -27,6 +29,7 @@ public static class Main
             
             NativeBinds.InitializeNativeBinds(bindsCallbacks);
             ManagedCallbacks.Initialize(managedCallbacks);
+            RuntimeEventBridge.StartIfTracing();
 
             LogUnrealSharpPlugins.Log("UnrealSharp successfully setup!");
             return NativeBool.True;
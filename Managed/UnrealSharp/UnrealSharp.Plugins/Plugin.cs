@@ -7,16 +7,32 @@ namespace UnrealSharp.Plugins;
 
 public class Plugin
 {
-    public Plugin(AssemblyName assemblyName, bool isCollectible, string assemblyPath)
+    public Plugin(AssemblyName assemblyName, bool isCollectible, string assemblyPath, AssemblyImage? image = null, bool mapFromFile = false)
     {
         AssemblyName = assemblyName;
         AssemblyPath = assemblyPath;
+
+        if (IsCompiledIn)
+        {
+            // Nothing to load or unload, the assembly is part of the native image.
+            WeakRefLoadContext = new WeakReference(AssemblyLoadContext.Default);
+            return;
+        }
         
         string pluginLoadContextName = assemblyName.Name! + "_AssemblyLoadContext";
-        LoadContext = new PluginLoadContext(pluginLoadContextName, new AssemblyDependencyResolver(assemblyPath), isCollectible);
+        LoadContext = new PluginLoadContext(pluginLoadContextName, new AssemblyDependencyResolver(assemblyPath), isCollectible, mapFromFile);
         WeakRefLoadContext = new WeakReference(LoadContext);
+        _image = image;
     }
     
+    // Image native already has in memory, used instead of reading the assembly file. Only valid until the plugin is loaded.
+    private AssemblyImage? _image;
+    
+    /// <summary>
+    /// Whether the managed layer was compiled with NativeAOT. Assemblies are then part of the native image and can't be unloaded.
+    /// </summary>
+    public static bool IsCompiledIn => !RuntimeFeature.IsDynamicCodeSupported;
+    
     public AssemblyName AssemblyName { get; }
     public string AssemblyPath;
     
@@ -34,12 +50,22 @@ public class Plugin
 
     public bool Load()
     {
-        if (LoadContext == null || (WeakRefAssembly != null && WeakRefAssembly.IsAlive))
+        if ((LoadContext == null && !IsCompiledIn) || (WeakRefAssembly != null && WeakRefAssembly.IsAlive))
         {
             return false;
         }
         
-        Assembly assembly = LoadContext.LoadFromAssemblyName(AssemblyName);
+        Assembly assembly;
+        if (LoadContext == null)
+        {
+            assembly = Assembly.Load(AssemblyName);
+        }
+        else
+        {
+            assembly = _image != null ? LoadContext.LoadFromImage(AssemblyName, _image) : LoadContext.LoadFromAssemblyName(AssemblyName);
+        }
+        
+        _image = null;
         WeakRefAssembly = new WeakReference(assembly);
         
         Type[] types = assembly.GetTypes();
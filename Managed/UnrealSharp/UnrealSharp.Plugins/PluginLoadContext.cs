@@ -8,12 +8,16 @@ namespace UnrealSharp.Plugins;
 
 public class PluginLoadContext : AssemblyLoadContext
 {
-    public PluginLoadContext(string assemblyName, AssemblyDependencyResolver resolver, bool isCollectible) : base(assemblyName, isCollectible)
+    public PluginLoadContext(string assemblyName, AssemblyDependencyResolver resolver, bool isCollectible, bool mapFromFile = false) : base(assemblyName, isCollectible)
     {
         _resolver = resolver;
+        _mapFromFile = mapFromFile;
     }
 
     private readonly AssemblyDependencyResolver _resolver;
+    
+    // Let the runtime map the images from their files, which shares their pages with other processes but locks the files.
+    private readonly bool _mapFromFile;
     private static readonly Dictionary<string, WeakReference<Assembly>> LoadedAssemblies = new();
     
     static PluginLoadContext()
@@ -59,6 +63,13 @@ public class PluginLoadContext : AssemblyLoadContext
             return null;
         }
 
+        if (_mapFromFile)
+        {
+            Assembly mappedAssembly = LoadFromAssemblyPath(assemblyPath);
+            LoadedAssemblies[assemblyName.Name] = new WeakReference<Assembly>(mappedAssembly);
+            return mappedAssembly;
+        }
+
         using FileStream assemblyFile = File.Open(assemblyPath, FileMode.Open, FileAccess.Read, FileShare.Read);
         string pdbPath = Path.ChangeExtension(assemblyPath, ".pdb");
 
@@ -77,6 +88,13 @@ public class PluginLoadContext : AssemblyLoadContext
         return loadedAssembly;
     }
 
+    public Assembly LoadFromImage(AssemblyName assemblyName, AssemblyImage image)
+    {
+        Assembly loadedAssembly = image.PdbImage != null ? LoadFromStream(image.Image, image.PdbImage) : LoadFromStream(image.Image);
+        LoadedAssemblies[assemblyName.Name!] = new WeakReference<Assembly>(loadedAssembly);
+        return loadedAssembly;
+    }
+
     protected override nint LoadUnmanagedDll(string unmanagedDllName)
     {
         string? libraryPath = _resolver.ResolveUnmanagedDllToPath(unmanagedDllName);
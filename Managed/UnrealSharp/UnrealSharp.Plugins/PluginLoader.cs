@@ -8,7 +8,13 @@ public static class PluginLoader
 {
     public static readonly List<Plugin> LoadedPlugins = [];
 
-    public static Assembly? LoadPlugin(string assemblyPath, bool isCollectible)
+    // How long UnloadPlugin keeps collecting before it leaves the load context to PollPendingUnloads.
+    private const int BlockingUnloadTimeMs = 200;
+
+    private readonly record struct PendingUnload(string AssemblyName, WeakReference LoadContext);
+    private static readonly List<PendingUnload> PendingUnloads = [];
+
+    public static Assembly? LoadPlugin(string assemblyPath, bool isCollectible, AssemblyImage? image = null, bool mapFromFile = false)
     {
         try
         {
@@ -35,7 +41,7 @@ public static class PluginLoader
                 return assembly;
             }
             
-            Plugin plugin = new Plugin(assemblyName, isCollectible, assemblyPath);
+            Plugin plugin = new Plugin(assemblyName, isCollectible, assemblyPath, image, mapFromFile);
             if (plugin.Load() && plugin.WeakRefAssembly != null && plugin.WeakRefAssembly.Target is Assembly loadedAssembly)
             {
                 LoadedPlugins.Add(plugin);
@@ -82,35 +88,30 @@ public static class PluginLoader
             LogUnrealSharpPlugins.Log($"Plugin {assemblyName} is not loaded or already unloaded.");
             return true;
         }
+
+        if (Plugin.IsCompiledIn)
+        {
+            // Its modules are shut down, the code itself stays in the native image.
+            return true;
+        }
         
         try
         {
             LogUnrealSharpPlugins.Log($"Unloading plugin {assemblyName}...");
 
             int startTimeMs = Environment.TickCount;
-            bool takingTooLong = false;
-
-            while (assemblyLoadContext.IsAlive)
+            while (assemblyLoadContext.IsAlive && Environment.TickCount - startTimeMs < BlockingUnloadTimeMs)
             {
                 GC.Collect(GC.MaxGeneration, GCCollectionMode.Forced);
                 GC.WaitForPendingFinalizers();
+            }
 
-                if (!assemblyLoadContext.IsAlive)
-                {
-                    break;
-                }
-
-                int elapsedTimeMs = Environment.TickCount - startTimeMs;
-                
-                if (!takingTooLong && elapsedTimeMs >= 200)
-                {
-                    takingTooLong = true;
-                    LogUnrealSharpPlugins.LogError($"Unloading {assemblyName} is taking longer than expected...");
-                }
-                else if (elapsedTimeMs >= 1000)
-                {
-                    throw new InvalidOperationException($"Failed to unload {assemblyName}. Possible causes: Strong GC handles, running threads, etc.");
-                }
+            if (assemblyLoadContext.IsAlive)
+            {
+                // Don't hold up the editor any longer, PollPendingUnloads keeps collecting once per call.
+                ReportUnloadFailure(assemblyName, assemblyLoadContext);
+                PendingUnloads.Add(new PendingUnload(assemblyName, assemblyLoadContext));
+                return false;
             }
 
             LogUnrealSharpPlugins.Log($"{assemblyName} unloaded successfully!");
@@ -122,6 +123,51 @@ public static class PluginLoader
             return false;
         }
     }
+
+    /// <summary>
+    /// Runs one collection and checks the load contexts that failed to unload in time.
+    /// </summary>
+    /// <returns>The number of load contexts that are still alive.</returns>
+    public static int PollPendingUnloads()
+    {
+        if (PendingUnloads.Count == 0)
+        {
+            return 0;
+        }
+
+        GC.Collect(GC.MaxGeneration, GCCollectionMode.Forced);
+        GC.WaitForPendingFinalizers();
+
+        for (int i = PendingUnloads.Count - 1; i >= 0; i--)
+        {
+            PendingUnload pendingUnload = PendingUnloads[i];
+            if (pendingUnload.LoadContext.IsAlive)
+            {
+                continue;
+            }
+
+            LogUnrealSharpPlugins.Log($"{pendingUnload.AssemblyName} unloaded after all.");
+            PendingUnloads.RemoveAt(i);
+        }
+
+        return PendingUnloads.Count;
+    }
+
+    private static void ReportUnloadFailure(string assemblyName, WeakReference assemblyLoadContext)
+    {
+        List<string> roots = UnloadDiagnostics.FindRoots(assemblyLoadContext);
+        LogUnrealSharpPlugins.LogError($"{assemblyName} did not unload within {BlockingUnloadTimeMs} ms, it will be checked again in the background.");
+
+        foreach (string root in roots)
+        {
+            LogUnrealSharpPlugins.LogError($"  Kept alive by: {root}");
+        }
+
+        if (roots.Count == 0)
+        {
+            LogUnrealSharpPlugins.LogError("  No references from UnrealSharp or other plugins were found. Look for running threads, timers, tasks and subscriptions to .NET events.");
+        }
+    }
     
     public static Plugin? FindPluginByName(string assemblyName)
     {
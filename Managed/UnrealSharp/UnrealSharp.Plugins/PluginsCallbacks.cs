@@ -9,18 +9,43 @@ public unsafe struct PluginsCallbacks
 {
     public delegate* unmanaged<char*, NativeBool, nint> LoadPlugin;
     public delegate* unmanaged<char*, NativeBool> UnloadPlugin;
+    public delegate* unmanaged<char*, byte*, long, byte*, long, NativeBool, nint> LoadPluginFromMemory;
+    public delegate* unmanaged<int> PollPendingUnloads;
+    public delegate* unmanaged<char*, NativeBool, nint> LoadPluginFromFile;
     
     [UnmanagedCallersOnly]
     private static nint ManagedLoadPlugin(char* assemblyPath, NativeBool isCollectible)
     {
         Assembly? newPlugin = PluginLoader.LoadPlugin(new string(assemblyPath), isCollectible.ToManagedBool());
+        return ToHandle(newPlugin);
+    }
+
+    [UnmanagedCallersOnly]
+    private static nint ManagedLoadPluginFromMemory(char* assemblyPath, byte* image, long imageSize, byte* pdbImage, long pdbImageSize, NativeBool isCollectible)
+    {
+        // Only valid for the duration of this call, the load context copies what it needs.
+        using UnmanagedMemoryStream imageStream = new UnmanagedMemoryStream(image, imageSize);
+        using UnmanagedMemoryStream? pdbStream = pdbImage != null && pdbImageSize > 0 ? new UnmanagedMemoryStream(pdbImage, pdbImageSize) : null;
+        
+        Assembly? newPlugin = PluginLoader.LoadPlugin(new string(assemblyPath), isCollectible.ToManagedBool(), new AssemblyImage(imageStream, pdbStream));
+        return ToHandle(newPlugin);
+    }
 
-        if (newPlugin == null)
+    [UnmanagedCallersOnly]
+    private static nint ManagedLoadPluginFromFile(char* assemblyPath, NativeBool isCollectible)
+    {
+        Assembly? newPlugin = PluginLoader.LoadPlugin(new string(assemblyPath), isCollectible.ToManagedBool(), mapFromFile: true);
+        return ToHandle(newPlugin);
+    }
+
+    private static nint ToHandle(Assembly? plugin)
+    {
+        if (plugin == null)
         {
             return IntPtr.Zero;
-        };
+        }
 
-        return GCHandle.ToIntPtr(GCHandleUtilities.AllocateStrongPointer(newPlugin, newPlugin));
+        return GCHandle.ToIntPtr(GCHandleUtilities.AllocateStrongPointer(plugin, plugin));
     }
 
     [UnmanagedCallersOnly]
@@ -30,12 +55,21 @@ public unsafe struct PluginsCallbacks
         return PluginLoader.UnloadPlugin(assemblyPathStr).ToNativeBool();
     }
 
+    [UnmanagedCallersOnly]
+    private static int ManagedPollPendingUnloads()
+    {
+        return PluginLoader.PollPendingUnloads();
+    }
+
     public static PluginsCallbacks Create()
     {
         return new PluginsCallbacks
         {
             LoadPlugin = &ManagedLoadPlugin,
             UnloadPlugin = &ManagedUnloadPlugin,
+            LoadPluginFromMemory = &ManagedLoadPluginFromMemory,
+            PollPendingUnloads = &ManagedPollPendingUnloads,
+            LoadPluginFromFile = &ManagedLoadPluginFromFile,
         };
     }
 }
\ No newline at end of file
@@ -0,0 +1,169 @@
+using System.Collections;
+using System.Reflection;
+using System.Runtime.CompilerServices;
+using System.Runtime.Loader;
+using UnrealSharp.Core;
+
+namespace UnrealSharp.Plugins;
+
+/// <summary>
+/// Looks for what keeps a collectible load context alive after it was asked to unload.
+/// Only finds references held by UnrealSharp itself and other plugins, running threads and timers can't be listed from here.
+/// </summary>
+public static class UnloadDiagnostics
+{
+    // Elements of a collection looked at before moving on, the report is meant to point in a direction, not to be complete.
+    private const int MaxElementsPerCollection = 1024;
+    
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    public static List<string> FindRoots(WeakReference loadContextReference)
+    {
+        List<string> roots = new List<string>();
+        if (loadContextReference.Target is not AssemblyLoadContext loadContext)
+        {
+            return roots;
+        }
+
+        roots.AddRange(GCHandleUtilities.DescribeStrongReferencesInto(loadContext));
+
+        foreach (AssemblyLoadContext otherContext in AssemblyLoadContext.All)
+        {
+            if (otherContext == loadContext)
+            {
+                continue;
+            }
+
+            foreach (Assembly assembly in otherContext.Assemblies)
+            {
+                // Reading a static field runs the static constructor of its type, so stay out of the framework.
+                if (otherContext == AssemblyLoadContext.Default && assembly.GetName().Name?.StartsWith("UnrealSharp") != true)
+                {
+                    continue;
+                }
+
+                FindStaticFieldRoots(assembly, loadContext, roots);
+            }
+        }
+
+        return roots;
+    }
+
+    private static void FindStaticFieldRoots(Assembly assembly, AssemblyLoadContext loadContext, List<string> roots)
+    {
+        Type[] types;
+        try
+        {
+            types = assembly.GetTypes();
+        }
+        catch (ReflectionTypeLoadException e)
+        {
+            types = e.Types.Where(type => type != null).ToArray()!;
+        }
+
+        foreach (Type type in types)
+        {
+            if (type.ContainsGenericParameters)
+            {
+                continue;
+            }
+
+            foreach (FieldInfo field in type.GetFields(BindingFlags.Static | BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.DeclaredOnly))
+            {
+                if (field.IsLiteral || field.FieldType.IsPrimitive || field.FieldType == typeof(string))
+                {
+                    continue;
+                }
+
+                object? value;
+                try
+                {
+                    value = field.GetValue(null);
+                }
+                catch (Exception)
+                {
+                    continue;
+                }
+
+                if (value != null && ReferencesContext(value, loadContext))
+                {
+                    roots.Add($"Static field {type.FullName}.{field.Name} in {assembly.GetName().Name}");
+                }
+            }
+        }
+    }
+
+    private static bool ReferencesContext(object value, AssemblyLoadContext loadContext)
+    {
+        if (IsFromContext(value, loadContext))
+        {
+            return true;
+        }
+
+        try
+        {
+            int numElements = 0;
+            if (value is IDictionary dictionary)
+            {
+                // The non-generic enumerator of a dictionary hands out DictionaryEntry, so keys and values are both checked.
+                foreach (DictionaryEntry entry in dictionary)
+                {
+                    if (IsFromContext(entry.Key, loadContext) || (entry.Value != null && IsFromContext(entry.Value, loadContext)))
+                    {
+                        return true;
+                    }
+
+                    if (++numElements >= MaxElementsPerCollection)
+                    {
+                        break;
+                    }
+                }
+            }
+            else if (value is IEnumerable collection and not string)
+            {
+                foreach (object? element in collection)
+                {
+                    if (element != null && IsFromContext(element, loadContext))
+                    {
+                        return true;
+                    }
+
+                    if (++numElements >= MaxElementsPerCollection)
+                    {
+                        break;
+                    }
+                }
+            }
+        }
+        catch (InvalidOperationException)
+        {
+            // Modified while we looked at it.
+        }
+
+        return false;
+    }
+
+    private static bool IsFromContext(object value, AssemblyLoadContext loadContext)
+    {
+        if (value is Delegate multicastDelegate)
+        {
+            foreach (Delegate invocation in multicastDelegate.GetInvocationList())
+            {
+                Type? declaringType = invocation.Method.DeclaringType;
+                if (declaringType != null && AssemblyLoadContext.GetLoadContext(declaringType.Assembly) == loadContext)
+                {
+                    return true;
+                }
+
+                if (invocation.Target != null && AssemblyLoadContext.GetLoadContext(invocation.Target.GetType().Assembly) == loadContext)
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        Type type = value as Type ?? value.GetType();
+        return AssemblyLoadContext.GetLoadContext(type.Assembly) == loadContext;
+    }
+}
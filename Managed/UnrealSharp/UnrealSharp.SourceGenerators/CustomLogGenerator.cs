@@ -88,10 +88,15 @@ public class CustomLogSourceGenerator : IIncrementalGenerator
 
         builder.AppendLine($"public partial class {className}");
         builder.AppendLine("{");
-        builder.AppendLine($"    public static void Log(string message) => UnrealLogger.Log(\"{logFieldName}\", message, {logVerbosity});");
-        builder.AppendLine($"    public static void LogWarning(string message) => UnrealLogger.LogWarning(\"{logFieldName}\", message);");
-        builder.AppendLine($"    public static void LogError(string message) => UnrealLogger.LogError(\"{logFieldName}\", message);");
-        builder.AppendLine($"    public static void LogFatal(string message) => UnrealLogger.LogFatal(\"{logFieldName}\", message);");
+        // Category.Log(ELogVerbosity.Verbose, $"...") skips formatting the message while the verbosity is suppressed.
+        builder.AppendLine($"    public static readonly LogCategory Category = UnrealLogger.GetCategory(\"{logFieldName}\");");
+        builder.AppendLine("    public static bool IsEnabled(ELogVerbosity verbosity) => Category.IsActive(verbosity);");
+        builder.AppendLine($"    public static void Log(string message) => Category.Log({logVerbosity}, message);");
+        builder.AppendLine("    public static void LogWarning(string message) => Category.Log(ELogVerbosity.Warning, message);");
+        builder.AppendLine("    public static void LogError(string message) => Category.Log(ELogVerbosity.Error, message);");
+        builder.AppendLine("    public static void LogFatal(string message) => Category.Log(ELogVerbosity.Fatal, message);");
+        builder.AppendLine("    public static void LogVerbose(string message) => Category.Log(ELogVerbosity.Verbose, message);");
+        builder.AppendLine("    public static void LogVeryVerbose(string message) => Category.Log(ELogVerbosity.VeryVerbose, message);");
         builder.AppendLine("}");
 
         return builder.ToString();
@@ -10,6 +10,8 @@ public struct FEditorDelegates
     public delegate void FOnPIEEvent(NativeBool sessionEnded);
 }
 
+#if WITH_EDITOR
+// Only registered natively in editor builds.
 [NativeCallbacks]
 public static unsafe partial class FEditorDelegatesExporter
 {
@@ -17,4 +19,5 @@ public static unsafe partial class FEditorDelegatesExporter
     public static delegate* unmanaged<IntPtr, out FDelegateHandle, void> BindEndPIE;
     public static delegate* unmanaged<FDelegateHandle, void> UnbindStartPIE;
     public static delegate* unmanaged<FDelegateHandle, void> UnbindEndPIE;
-}
\ No newline at end of file
+}
+#endif
\ No newline at end of file
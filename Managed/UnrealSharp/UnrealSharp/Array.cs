@@ -1,4 +1,6 @@
-﻿using UnrealSharp.Attributes;
+﻿using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+using UnrealSharp.Attributes;
 using UnrealSharp.Core;
 using UnrealSharp.Core.Attributes;
 using UnrealSharp.Core.Marshallers;
@@ -154,6 +156,115 @@ public class TArray<T> : UnrealArrayBase<T>, IList<T>, IReadOnlyList<T>
     {
         RemoveAtInternal(index);
     }
+
+    /// <summary>
+    /// Replaces the contents of the array with the given elements.
+    /// Plain old data is copied in one go, other types are marshalled element by element.
+    /// </summary>
+    /// <param name="items"> The elements to copy into the array. </param>
+    public void CopyFrom(ReadOnlySpan<T> items)
+    {
+        unsafe
+        {
+            if (CanCopyMemory)
+            {
+                fixed (void* itemsPtr = &Unsafe.As<T, byte>(ref MemoryMarshal.GetReference(items)))
+                {
+                    if (FArrayPropertyExporter.CallCopyFromManagedSpan(NativeProperty, NativeBuffer, itemsPtr, items.Length, Unsafe.SizeOf<T>()).ToManagedBool())
+                    {
+                        return;
+                    }
+                }
+            }
+            
+            FArrayPropertyExporter.CallResizeArray(NativeProperty, NativeBuffer, items.Length);
+            for (int i = 0; i < items.Length; ++i)
+            {
+                ToNative(NativeArrayBuffer, i, items[i]);
+            }
+        }
+    }
+
+    /// <summary>
+    /// Copies elements of the array into a span.
+    /// </summary>
+    /// <param name="destination"> The span to copy into. Its length is the number of elements copied. </param>
+    /// <param name="startIndex"> The index of the first element to copy. </param>
+    public void CopyTo(Span<T> destination, int startIndex = 0)
+    {
+        if (startIndex < 0 || startIndex + destination.Length > Count)
+        {
+            throw new ArgumentOutOfRangeException(nameof(destination), $"Can't copy {destination.Length} elements from index {startIndex}. Array size is {Count}.");
+        }
+        
+        unsafe
+        {
+            if (CanCopyMemory)
+            {
+                fixed (void* destinationPtr = &Unsafe.As<T, byte>(ref MemoryMarshal.GetReference(destination)))
+                {
+                    if (FArrayPropertyExporter.CallCopyToManagedSpan(NativeProperty, NativeBuffer, destinationPtr, startIndex, destination.Length, Unsafe.SizeOf<T>()).ToManagedBool())
+                    {
+                        return;
+                    }
+                }
+            }
+        }
+        
+        for (int i = 0; i < destination.Length; ++i)
+        {
+            destination[i] = Get(startIndex + i);
+        }
+    }
+
+    /// <summary>
+    /// Adds the elements to the end of the array.
+    /// </summary>
+    /// <param name="items"> The elements to add. </param>
+    public void AddRange(ReadOnlySpan<T> items)
+    {
+        unsafe
+        {
+            if (CanCopyMemory)
+            {
+                fixed (void* itemsPtr = &Unsafe.As<T, byte>(ref MemoryMarshal.GetReference(items)))
+                {
+                    if (FArrayPropertyExporter.CallAppendRange(NativeProperty, NativeBuffer, itemsPtr, items.Length, Unsafe.SizeOf<T>()).ToManagedBool())
+                    {
+                        return;
+                    }
+                }
+            }
+            
+            int firstIndex = Count;
+            FArrayPropertyExporter.CallResizeArray(NativeProperty, NativeBuffer, firstIndex + items.Length);
+            for (int i = 0; i < items.Length; ++i)
+            {
+                ToNative(NativeArrayBuffer, firstIndex + i, items[i]);
+            }
+        }
+    }
+
+    /// <summary>
+    /// Removes a range of elements from the array.
+    /// </summary>
+    /// <param name="index"> The index of the first element to remove. </param>
+    /// <param name="count"> The number of elements to remove. </param>
+    public void RemoveRange(int index, int count)
+    {
+        if (index < 0 || count < 0 || index + count > Count)
+        {
+            throw new ArgumentOutOfRangeException(nameof(count), $"Can't remove {count} elements from index {index}. Array size is {Count}.");
+        }
+        
+        unsafe
+        {
+            FArrayPropertyExporter.CallRemoveRange(NativeProperty, NativeBuffer, index, count);
+        }
+    }
+
+    // Managed types holding references can never match the native memory layout. The native side checks the rest.
+    private static bool CanCopyMemory => !RuntimeHelpers.IsReferenceOrContainsReferences<T>();
 }
 
 public class ArrayMarshaller<T>(IntPtr nativeProperty, MarshallingDelegates<T>.ToNative toNative, MarshallingDelegates<T>.FromNative fromNative)
@@ -52,6 +52,44 @@ public sealed class ScriptNameAttribute(string ScriptName) : Attribute { }
 // Classes can use the following Metatag Specifiers:	
 //----------------------------------------------------
 #region Class
+/// <summary>
+/// [BatchedTick]
+/// UnrealSharp only. Used for Actor and Component classes that override ReceiveTick. Instead of a tick function per instance,
+/// all instances in a world are ticked by one tick function per tick group, with a single call into C#.
+/// The native Tick of the parent class doesn't run, and SetActorTickEnabled / SetComponentTickEnabled have no effect.
+/// Inherited by subclasses.
+/// </summary>
+[AttributeUsage(AttributeTargets.Class)]
+public sealed class BatchedTickAttribute : Attribute { }
+
+/// <summary>
+/// [ParallelTick]
+/// UnrealSharp only. Used for world subsystems. Instead of Tick, ParallelTick is called on a task graph worker, concurrently with
+/// the other parallel subsystems of the world in the same phase. Phases run in ascending order and are all done before the
+/// world moves on. Subsystems that share a resource declared with [ParallelTickReads] / [ParallelTickWrites], where at least
+/// one of them writes it, run one after the other in the order they were initialized.
+/// ParallelTick must not touch anything it hasn't declared, including UObjects the game thread may change. Inherited by subclasses.
+/// </summary>
+/// <param name="Phase">The phase to tick in</param>
+[AttributeUsage(AttributeTargets.Class)]
+public sealed class ParallelTickAttribute(int Phase = 0) : Attribute { }
+
+/// <summary>
+/// [ParallelTickReads]
+/// UnrealSharp only. The resources a [ParallelTick] subsystem reads, names of your choosing.
+/// </summary>
+/// <param name="ParallelTickReads">Resource1, Resource2, ..</param>
+[AttributeUsage(AttributeTargets.Class)]
+public sealed class ParallelTickReadsAttribute(string ParallelTickReads) : Attribute { }
+
+/// <summary>
+/// [ParallelTickWrites]
+/// UnrealSharp only. The resources a [ParallelTick] subsystem writes, names of your choosing.
+/// </summary>
+/// <param name="ParallelTickWrites">Resource1, Resource2, ..</param>
+[AttributeUsage(AttributeTargets.Class)]
+public sealed class ParallelTickWritesAttribute(string ParallelTickWrites) : Attribute { }
+
 /// <summary>
 /// [BlueprintSpawnableComponent]
 /// If present, the component Class can be spawned by a Blueprint.
@@ -225,6 +263,14 @@ public sealed class HasNativeMakeAttribute(string HasNativeMake) : Attribute { }
 [AttributeUsage(AttributeTargets.Struct)]
 public sealed class HiddenByDefaultAttribute : Attribute { }
 
+/// <summary>
+/// [OptimizeLayout]
+/// Reorders the properties that aren't visible to Blueprint or the editor by alignment when the struct is built, to cut down on padding.
+/// The struct is always marshalled property by property instead of copied as a whole, since its native layout no longer matches the C# one.
+/// </summary>
+[AttributeUsage(AttributeTargets.Struct)]
+public sealed class OptimizeLayoutAttribute : Attribute { }
+
 #endregion
 
 
@@ -710,4 +756,21 @@ public sealed class BindWidgetAnimAttribute : Attribute { }
 [AttributeUsage(AttributeTargets.Property | AttributeTargets.Field | AttributeTargets.Parameter)]
 public sealed class CategoriesAttribute(string Categories) : Attribute { }
 
+/// <summary>
+/// [NetQuantize]
+/// UnrealSharp only. Used for replicated FVector properties. Replicates the vector rounded to the given precision with
+/// only as many bits as the value needs, the same as FVector_NetQuantize, FVector_NetQuantize10 and FVector_NetQuantize100 in C++.
+/// </summary>
+/// <param name="Precision">1 for whole numbers, 10 for one decimal place, 100 for two decimal places</param>
+[AttributeUsage(AttributeTargets.Property | AttributeTargets.Field)]
+public sealed class NetQuantizeAttribute(int Precision = 1) : Attribute { }
+
+/// <summary>
+/// [NetQuantizeNormal]
+/// UnrealSharp only. Used for replicated FVector properties holding a unit vector. Replicates each component with 16 bits,
+/// the same as FVector_NetQuantizeNormal in C++.
+/// </summary>
+[AttributeUsage(AttributeTargets.Property | AttributeTargets.Field)]
+public sealed class NetQuantizeNormalAttribute : Attribute { }
+
 #endregion
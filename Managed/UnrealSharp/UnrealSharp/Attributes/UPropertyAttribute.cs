@@ -117,6 +117,13 @@ public sealed class UPropertyAttribute(PropertyFlags flags = PropertyFlags.None)
     /// </summary>
     public LifetimeCondition LifetimeCondition = LifetimeCondition.None;
 
+    /// <summary>
+    /// Replicates the property with the push model: the setter marks it dirty, and the engine only compares it
+    /// after it was set instead of every update. Only takes effect when push model replication is enabled.
+    /// Changes made without going through the setter, such as mutating an array in place, aren't sent.
+    /// </summary>
+    public bool PushBased = false;
+
     /// <summary>
     /// The function to call when the property is changed.
     /// </summary>
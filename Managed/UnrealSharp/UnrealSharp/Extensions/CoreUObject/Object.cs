@@ -253,6 +253,75 @@ public partial class UObject
         return spawnedActor;
     }
 
+    /// <summary>
+    /// Spawns one actor of the specified type per transform, in a single native call.
+    /// </summary>
+    /// <param name="spawnTransforms"> The transforms to spawn the actors at. </param>
+    /// <param name="actorType"> The type of the actors to spawn. </param>
+    /// <param name="spawnParameters"> The parameters to use when spawning the actors. </param>
+    /// <typeparam name="T"> The type of the actors to spawn. </typeparam>
+    /// <returns> The spawned actors, in the order of the transforms. Actors that failed to spawn are null. </returns>
+    public static IList<T?> SpawnActors<T>(IList<FTransform> spawnTransforms, TSubclassOf<T> actorType, FCSSpawnActorParameters spawnParameters) where T : AActor
+    {
+        IList<AActor> spawnedActors = UCSWorldExtensions.SpawnActorsBatch(new TSubclassOf<AActor>(actorType), spawnTransforms, spawnParameters);
+        return CastSpawnedActors<T>(spawnedActors);
+    }
+
+    /// <summary>
+    /// Spawns one actor of the specified type per transform, with callbacks to initialize each actor.
+    /// Spawning, construction and post construction each cross into native code once for the whole batch.
+    /// </summary>
+    /// <param name="spawnTransforms"> The transforms to spawn the actors at. </param>
+    /// <param name="actorType"> The type of the actors to spawn. </param>
+    /// <param name="spawnParameters"> The parameters to use when spawning the actors. </param>
+    /// <param name="initializeActor"> Callback to initialize actor properties, with the actor's index. C# spawned components are not yet valid here.</param>
+    /// <param name="initializeComponents"> Callback to initialize components properties, with the actor's index. Both actor and components are valid here.</param>
+    /// <typeparam name="T"> The type of the actors to spawn. </typeparam>
+    /// <returns> The spawned actors, in the order of the transforms. Actors that failed to spawn are null. </returns>
+    public static IList<T?> SpawnActorsDeferred<T>(IList<FTransform> spawnTransforms, TSubclassOf<T> actorType, FCSSpawnActorParameters spawnParameters, Action<T, int>? initializeActor = null, Action<T, int>? initializeComponents = null) where T : AActor
+    {
+        IList<AActor> spawnedActors = UCSWorldExtensions.SpawnActorsDeferredBatch(new TSubclassOf<AActor>(actorType), spawnTransforms, spawnParameters);
+        IList<T?> typedActors = CastSpawnedActors<T>(spawnedActors);
+
+        if (initializeActor != null)
+        {
+            for (int i = 0; i < typedActors.Count; i++)
+            {
+                if (typedActors[i] is { } actor)
+                {
+                    initializeActor(actor, i);
+                }
+            }
+        }
+
+        UCSWorldExtensions.ExecuteConstructionBatch(spawnedActors, spawnTransforms);
+
+        if (initializeComponents != null)
+        {
+            for (int i = 0; i < typedActors.Count; i++)
+            {
+                if (typedActors[i] is { } actor)
+                {
+                    initializeComponents(actor, i);
+                }
+            }
+        }
+
+        UCSWorldExtensions.PostActorConstructionBatch(spawnedActors);
+        return typedActors;
+    }
+
+    private static IList<T?> CastSpawnedActors<T>(IList<AActor> spawnedActors) where T : AActor
+    {
+        T?[] typedActors = new T?[spawnedActors.Count];
+        for (int i = 0; i < typedActors.Length; i++)
+        {
+            typedActors[i] = spawnedActors[i] as T;
+        }
+
+        return typedActors;
+    }
+
     /// <summary>
     /// Gets the world subsystem of the specified type.
     /// </summary>
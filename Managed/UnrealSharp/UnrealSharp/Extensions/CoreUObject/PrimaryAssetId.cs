@@ -1,14 +1,42 @@
 ﻿using UnrealSharp.Engine;
+using UnrealSharp.Interop;
 
 namespace UnrealSharp.CoreUObject;
 
 public partial struct FPrimaryAssetId
 {
+    private static readonly Dictionary<ulong, FPrimaryAssetId> HashedAssetIds = new();
+
     public FPrimaryAssetId(FPrimaryAssetType type, FName name)
     {
         PrimaryAssetType = type;
         PrimaryAssetName = name;
     }
+
+    /// <summary>
+    /// Gets the primary asset ID of a hash generated into the AssetIdHashes glue class.
+    /// Resolved ids are cached, so repeated lookups don't convert any strings to names.
+    /// </summary>
+    /// <param name="hash">The generated hash of the asset ID.</param>
+    /// <param name="type">The primary asset type, used if the hash can't be resolved.</param>
+    /// <param name="name">The primary asset name, used if the hash can't be resolved.</param>
+    public static FPrimaryAssetId FromHash(ulong hash, string type, string name)
+    {
+        if (HashedAssetIds.TryGetValue(hash, out FPrimaryAssetId assetId))
+        {
+            return assetId;
+        }
+
+        if (UAssetManagerExporter.CallFindPrimaryAssetIdByHash(hash, out FName assetType, out FName assetName).ToManagedBool())
+        {
+            assetId = new FPrimaryAssetId(new FPrimaryAssetType(assetType), assetName);
+            HashedAssetIds.Add(hash, assetId);
+            return assetId;
+        }
+
+        // Not registered with the asset manager (yet), don't cache so it's resolved once it is
+        return new FPrimaryAssetId(new FPrimaryAssetType(new FName(type)), new FName(name));
+    }
     
     /// <summary>
     /// Is this a valid primary asset ID?
@@ -60,6 +60,23 @@ public partial struct FQuat
         UCSQuatExtensions.ToRotator(out var rotator, this);
         return rotator;
     }
+    
+    /// <summary>
+    /// Converts all Quats to Rotators with a single call into native code.
+    /// </summary>
+    public static unsafe void ToRotators(ReadOnlySpan<FQuat> quats, Span<FRotator> outRotators)
+    {
+        if (outRotators.Length < quats.Length)
+        {
+            throw new ArgumentException("The output span is shorter than the input span", nameof(outRotators));
+        }
+        
+        fixed (FQuat* quatsPtr = quats)
+        fixed (FRotator* rotatorsPtr = outRotators)
+        {
+            FRotatorExporter.CallFromQuats(quatsPtr, rotatorsPtr, quats.Length);
+        }
+    }
 
     /// <summary>
     /// Calculates the length of the Quat.
@@ -89,4 +89,37 @@ public partial struct FRandomStream
 	{
 		return FRandomStreamExporter.CallVRandCone2(ref this, dir, horizontalConeHalfAngleRad, verticalConeHalfAngleRad);
 	}
+	
+	/// <summary>
+	/// Fills the span with fractions in one native call. The stream advances exactly as if GetFraction was called for every value.
+	/// </summary>
+	public unsafe void FillFractions(Span<float> values)
+	{
+		fixed (float* valuesPtr = values)
+		{
+			FRandomStreamExporter.CallFillRandFloats(ref this, valuesPtr, values.Length);
+		}
+	}
+	
+	/// <summary>
+	/// Fills the span with integers in [min, max] in one native call. The stream advances exactly as if RandRange was called for every value.
+	/// </summary>
+	public unsafe void FillRandRange(Span<int> values, int min, int max)
+	{
+		fixed (int* valuesPtr = values)
+		{
+			FRandomStreamExporter.CallFillRandRange(ref this, min, max, valuesPtr, values.Length);
+		}
+	}
+	
+	/// <summary>
+	/// Fills the span with unit vectors in one native call. The stream advances exactly as if GetUnitVector was called for every value.
+	/// </summary>
+	public unsafe void FillUnitVectors(Span<FVector> vectors)
+	{
+		fixed (FVector* vectorsPtr = vectors)
+		{
+			FRandomStreamExporter.CallFillUnitVectors(ref this, vectorsPtr, vectors.Length);
+		}
+	}
 }
\ No newline at end of file
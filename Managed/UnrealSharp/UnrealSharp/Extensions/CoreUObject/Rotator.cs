@@ -79,6 +79,40 @@ public partial struct FRotator
         return FVectorExporter.CallFromRotator(this);
     }
 
+    /// <summary>
+    /// Converts all rotators to quaternions with a single call into native code.
+    /// </summary>
+    public static unsafe void ToQuaternions(ReadOnlySpan<FRotator> rotators, Span<FQuat> outQuats)
+    {
+        if (outQuats.Length < rotators.Length)
+        {
+            throw new ArgumentException("The output span is shorter than the input span", nameof(outQuats));
+        }
+        
+        fixed (FRotator* rotatorsPtr = rotators)
+        fixed (FQuat* quatsPtr = outQuats)
+        {
+            FRotatorExporter.CallToQuats(rotatorsPtr, quatsPtr, rotators.Length);
+        }
+    }
+
+    /// <summary>
+    /// Converts all rotators to vectors facing in their direction with a single call into native code.
+    /// </summary>
+    public static unsafe void ToVectors(ReadOnlySpan<FRotator> rotators, Span<FVector> outVectors)
+    {
+        if (outVectors.Length < rotators.Length)
+        {
+            throw new ArgumentException("The output span is shorter than the input span", nameof(outVectors));
+        }
+        
+        fixed (FRotator* rotatorsPtr = rotators)
+        fixed (FVector* vectorsPtr = outVectors)
+        {
+            FVectorExporter.CallFromRotators(rotatorsPtr, vectorsPtr, rotators.Length);
+        }
+    }
+
     public static FRotator operator + (FRotator lhs, FRotator rhs)
     {
         return new FRotator
@@ -54,9 +54,12 @@ public static class FSoftObjectPathExtensions
 
     public static async Task<T> LoadAsync<T>(this FSoftObjectPath softObjectPath) where T : UObject
     {
-        IReadOnlyList<FSoftObjectPath> loadedPaths = await UCSAsyncLoadSoftPtr.LoadAsync(new List<FSoftObjectPath> { softObjectPath });
+        using (StreamingBatch batch = new StreamingBatch(new[] { softObjectPath }))
+        {
+            await batch.Task;
+        }
 
-        if (loadedPaths.Count == 0 || loadedPaths[0].Object is not T resolved)
+        if (softObjectPath.Object is not T resolved)
         {
             throw new Exception($"Failed to load or cast asset at '{softObjectPath}' to '{typeof(T).Name}'");
         }
@@ -69,11 +72,17 @@ public static class FSoftObjectPathExtensions
         return softObjectPaths.LoadAsync<UObject>();
     }
 
-    public static async Task<IList<T>> LoadAsync<T>(this IList<FSoftObjectPath> softObjectPaths) where T : UObject
+    public static async Task<IList<T>> LoadAsync<T>(this IList<FSoftObjectPath> softObjectPaths, int priority = 0) where T : UObject
     {
-        IReadOnlyList<FSoftObjectPath> loadedPaths = await UCSAsyncLoadSoftPtr.LoadAsync(softObjectPaths.AsReadOnly());
+        FSoftObjectPath[] loadedPaths = softObjectPaths.ToArray();
+        
+        // One streamable handle for the whole list, no async action object per request.
+        using (StreamingBatch batch = new StreamingBatch(loadedPaths, priority))
+        {
+            await batch.Task;
+        }
 
-        List<T> result = new(loadedPaths.Count);
+        List<T> result = new(loadedPaths.Length);
         foreach (FSoftObjectPath path in loadedPaths)
         {
             if (path.Object is T resolved)
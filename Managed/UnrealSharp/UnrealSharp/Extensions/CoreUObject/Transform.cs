@@ -1,4 +1,5 @@
 ﻿using System.Runtime.CompilerServices;
+using UnrealSharp.Interop;
 
 namespace UnrealSharp.CoreUObject;
 
@@ -48,6 +49,59 @@ public partial struct FTransform
         return Rotation.RotateVector(v);
     }
 
+    /// <summary>
+    /// Transforms all positions with a single call into native code. The output may be the input span.
+    /// </summary>
+    public unsafe void TransformPositions(ReadOnlySpan<FVector> positions, Span<FVector> outPositions)
+    {
+        if (outPositions.Length < positions.Length)
+        {
+            throw new ArgumentException("The output span is shorter than the input span", nameof(outPositions));
+        }
+        
+        fixed (FVector* positionsPtr = positions)
+        fixed (FVector* outPositionsPtr = outPositions)
+        {
+            FTransformExporter.CallTransformPositions(ref this, positionsPtr, outPositionsPtr, positions.Length);
+        }
+    }
+    
+    /// <summary>
+    /// Inverse transforms all positions with a single call into native code. The output may be the input span.
+    /// </summary>
+    public unsafe void InverseTransformPositions(ReadOnlySpan<FVector> positions, Span<FVector> outPositions)
+    {
+        if (outPositions.Length < positions.Length)
+        {
+            throw new ArgumentException("The output span is shorter than the input span", nameof(outPositions));
+        }
+        
+        fixed (FVector* positionsPtr = positions)
+        fixed (FVector* outPositionsPtr = outPositions)
+        {
+            FTransformExporter.CallInverseTransformPositions(ref this, positionsPtr, outPositionsPtr, positions.Length);
+        }
+    }
+    
+    /// <summary>
+    /// Composes the transforms pairwise with a single call into native code, outTransforms[i] = a[i] * b[i] like FTransform's operator* in C++.
+    /// The output may be either input span.
+    /// </summary>
+    public static unsafe void Compose(ReadOnlySpan<FTransform> a, ReadOnlySpan<FTransform> b, Span<FTransform> outTransforms)
+    {
+        if (b.Length != a.Length || outTransforms.Length < a.Length)
+        {
+            throw new ArgumentException("The spans don't have matching lengths");
+        }
+        
+        fixed (FTransform* aPtr = a)
+        fixed (FTransform* bPtr = b)
+        fixed (FTransform* outPtr = outTransforms)
+        {
+            FTransformExporter.CallComposeTransforms(aPtr, bPtr, outPtr, a.Length);
+        }
+    }
+
     public static readonly FTransform ZeroTransform = new(FQuat.Identity, FVector.Zero, FVector.Zero);
     public static readonly FTransform Identity = new(FQuat.Identity, FVector.Zero, FVector.One);
     
@@ -6,6 +6,21 @@ namespace UnrealSharp.Engine;
 
 public partial class AActor
 {
+    /// <summary>
+    /// Called when the actor is handed out by <see cref="UCSActorPoolSubsystem"/>, newly spawned or reused.
+    /// Reused actors keep their managed state from the last use, put it back the way a new actor has it.
+    /// </summary>
+    protected internal virtual void OnAcquire()
+    {
+    }
+
+    /// <summary>
+    /// Called right before the actor goes back to the <see cref="UCSActorPoolSubsystem"/>. Stop anything it has running here.
+    /// </summary>
+    protected internal virtual void OnRelease()
+    {
+    }
+
     /// <summary>
     /// Bind an action to a callback.
     /// </summary>
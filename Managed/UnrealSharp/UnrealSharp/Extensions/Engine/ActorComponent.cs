@@ -5,6 +5,21 @@ namespace UnrealSharp.Engine;
 
 public partial class UActorComponent
 {
+    /// <summary>
+    /// Called when the component is handed out by <see cref="UCSActorPoolSubsystem"/>, newly created or reused.
+    /// Reused components keep their managed state from the last use, put it back the way a new component has it.
+    /// </summary>
+    protected internal virtual void OnAcquire()
+    {
+    }
+
+    /// <summary>
+    /// Called right before the component goes back to the <see cref="UCSActorPoolSubsystem"/>. Stop anything it has running here.
+    /// </summary>
+    protected internal virtual void OnRelease()
+    {
+    }
+
     /// <summary>
     /// Register a SubObject that will get replicated along with the actor component.
     /// The subobject needs to be manually removed from the list before it gets deleted.
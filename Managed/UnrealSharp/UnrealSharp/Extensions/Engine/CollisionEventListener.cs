@@ -0,0 +1,167 @@
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+using System.Runtime.Loader;
+using UnrealSharp.Core;
+using UnrealSharp.CoreUObject;
+using UnrealSharp.Interop;
+
+namespace UnrealSharp.Engine;
+
+public enum CollisionEventType : byte
+{
+    Hit,
+    BeginOverlap,
+    EndOverlap,
+}
+
+[Flags]
+public enum CollisionEventMask : byte
+{
+    None = 0,
+    Hit = 1 << 0,
+    BeginOverlap = 1 << 1,
+    EndOverlap = 1 << 2,
+    All = Hit | BeginOverlap | EndOverlap,
+}
+
+/// <summary>
+/// A hit or overlap event delivered by a <see cref="CollisionEventListener"/>.
+/// The components and actor are only valid during the callback, and null if they were destroyed since the event happened.
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+public struct CollisionEvent
+{
+    /// <summary>
+    /// Where the hit happened. Zero for overlaps that didn't come from a sweep.
+    /// </summary>
+    public FVector ImpactPoint;
+    public FVector ImpactNormal;
+
+    /// <summary>
+    /// The impulse the hit applied, only set for hits.
+    /// </summary>
+    public FVector NormalImpulse;
+    private IntPtr _component;
+    private IntPtr _otherComponent;
+    private IntPtr _otherActor;
+    public int OtherBodyIndex;
+    public CollisionEventType Type;
+    private byte _fromSweep;
+
+    public bool FromSweep => _fromSweep != 0;
+
+    /// <summary>
+    /// The listened to component the event happened on.
+    /// </summary>
+    public UPrimitiveComponent? Component => FindManagedObject<UPrimitiveComponent>(_component);
+    public UPrimitiveComponent? OtherComponent => FindManagedObject<UPrimitiveComponent>(_otherComponent);
+    public AActor? OtherActor => FindManagedObject<AActor>(_otherActor);
+
+    private static T? FindManagedObject<T>(IntPtr nativeObject) where T : UnrealSharpObject
+    {
+        if (nativeObject == IntPtr.Zero)
+        {
+            return null;
+        }
+
+        return GCHandleUtilities.GetObjectFromHandlePtr<T>(FCSManagerExporter.CallFindManagedObject(nativeObject));
+    }
+}
+
+/// <summary>
+/// Collects the hit and overlap events of components, and delivers all events of a frame at once, after the world ticked.
+/// Much cheaper than binding OnComponentHit / OnComponentBeginOverlap on many components, which calls into C# once per event.
+/// Hit events need the component to have Simulation Generates Hit Events on, like the delegate.
+/// </summary>
+public sealed class CollisionEventListener : IDisposable
+{
+    private readonly UObject _worldContextObject;
+    private readonly Action<ReadOnlySpan<CollisionEvent>> _onEvents;
+    private GCHandle _handle;
+    private int _listenerId;
+
+    /// <param name="worldContextObject">The world to listen in. The listener stops once the world goes away.</param>
+    /// <param name="onEvents">Called once per frame with the events of the frame, in the order they happened.</param>
+    public unsafe CollisionEventListener(UObject worldContextObject, Action<ReadOnlySpan<CollisionEvent>> onEvents)
+    {
+        _worldContextObject = worldContextObject;
+        _onEvents = onEvents;
+        _handle = GCHandle.Alloc(this);
+
+        _listenerId = FCSCollisionEventsExporter.CallAddListener(worldContextObject.NativeObject,
+            (IntPtr) (delegate* unmanaged<IntPtr, CollisionEvent*, int, void>) &DeliverEvents, GCHandle.ToIntPtr(_handle));
+
+        if (_listenerId == 0)
+        {
+            _handle.Free();
+            throw new InvalidOperationException($"{worldContextObject} has no world to listen in");
+        }
+
+        // The callback's code must not outlive its assembly.
+        AssemblyLoadContext? loadContext = AssemblyLoadContext.GetLoadContext(onEvents.Method.Module.Assembly);
+        if (loadContext != null && loadContext.IsCollectible)
+        {
+            loadContext.Unloading += _ => Dispose();
+        }
+    }
+
+    public bool IsListening => _listenerId != 0;
+
+    /// <summary>
+    /// Starts delivering the given events of the component. Listening to a component again replaces its events.
+    /// </summary>
+    public void Listen(UPrimitiveComponent component, CollisionEventMask events = CollisionEventMask.All)
+    {
+        if (!IsListening)
+        {
+            throw new ObjectDisposedException(nameof(CollisionEventListener));
+        }
+
+        FCSCollisionEventsExporter.CallListen(_worldContextObject.NativeObject, _listenerId, component.NativeObject, (byte) events);
+    }
+
+    public void StopListening(UPrimitiveComponent component)
+    {
+        if (!IsListening || !_worldContextObject.IsValid || !component.IsValid)
+        {
+            return;
+        }
+
+        FCSCollisionEventsExporter.CallStopListening(_worldContextObject.NativeObject, _listenerId, component.NativeObject);
+    }
+
+    /// <summary>
+    /// Stops listening to every component. Events that weren't delivered yet are dropped.
+    /// </summary>
+    public void Dispose()
+    {
+        if (!IsListening)
+        {
+            return;
+        }
+
+        // The world took its listeners with it when the context is gone.
+        if (_worldContextObject.IsValid)
+        {
+            FCSCollisionEventsExporter.CallRemoveListener(_worldContextObject.NativeObject, _listenerId);
+        }
+
+        _listenerId = 0;
+        _handle.Free();
+    }
+
+    [UnmanagedCallersOnly]
+    private static unsafe void DeliverEvents(IntPtr state, CollisionEvent* events, int count)
+    {
+        CollisionEventListener listener = Unsafe.As<CollisionEventListener>(GCHandle.FromIntPtr(state).Target!);
+
+        try
+        {
+            listener._onEvents(new ReadOnlySpan<CollisionEvent>(events, count));
+        }
+        catch (Exception exception)
+        {
+            LogUnrealSharp.LogError($"Collision event listener threw an exception: {exception}");
+        }
+    }
+}
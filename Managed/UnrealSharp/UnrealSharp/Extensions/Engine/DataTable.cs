@@ -75,6 +75,23 @@ public partial class UDataTable
         return true;
     }
     
+    /// <summary>
+    /// Gets every row of the table in one native call, without going through row names or JSON.
+    /// Rows are read from native memory when they're accessed.
+    /// </summary>
+    /// <typeparam name="T">The row struct of the table</typeparam>
+    /// <returns>A view of the rows, valid until the table changes</returns>
+    public DataTableRows<T> GetRows<T>() where T : struct, MarshalledStruct<T>
+    {
+        NativeDataTableRows rows;
+        unsafe
+        {
+            UDataTableExporter.CallGetRows(NativeObject, (IntPtr)(&rows));
+        }
+
+        return new DataTableRows<T>(NativeObject, rows);
+    }
+    
     /// <summary>
     /// Check if a row exists in the table by name.
     /// </summary>
@@ -0,0 +1,115 @@
+using UnrealSharp.Interop;
+
+namespace UnrealSharp.Engine;
+
+/// <summary>
+/// A view of every row of a <see cref="UDataTable"/>, read straight from native memory.
+/// Fetched in one call with <see cref="UDataTable.GetRows{T}"/>. The view is only valid until the table changes,
+/// check <see cref="IsStale"/> before using one that was kept around.
+/// </summary>
+/// <typeparam name="T">The row struct of the table</typeparam>
+public readonly unsafe struct DataTableRows<T> where T : struct, MarshalledStruct<T>
+{
+    private readonly NativeDataTableRows _rows;
+    private readonly IntPtr _dataTable;
+
+    internal DataTableRows(IntPtr dataTable, NativeDataTableRows rows)
+    {
+        _dataTable = dataTable;
+        _rows = rows;
+    }
+
+    /// <summary>
+    /// The number of rows in the table.
+    /// </summary>
+    public int Count => _rows.NumRows;
+
+    /// <summary>
+    /// True if the table changed since the view was fetched. The row pointers may be gone by then.
+    /// </summary>
+    public bool IsStale => UDataTableExporter.CallGetRowsVersion(_dataTable) != _rows.Version;
+
+    /// <summary>
+    /// Gets the row at the index, in the order of the table.
+    /// </summary>
+    public T this[int index] => T.FromNative(GetRowData(index));
+
+    /// <summary>
+    /// Gets the name of the row at the index.
+    /// </summary>
+    public FName GetRowName(int index)
+    {
+        CheckIndex(index);
+        return _rows.Rows[index].RowName;
+    }
+
+    /// <summary>
+    /// Gets a pointer to the native memory of the row at the index.
+    /// </summary>
+    public IntPtr GetRowData(int index)
+    {
+        CheckIndex(index);
+        return _rows.Rows[index].RowData;
+    }
+
+    /// <summary>
+    /// Finds the index of a row by name with a binary search over the native name table.
+    /// </summary>
+    /// <param name="rowName">The name of the row to find</param>
+    /// <returns>The index of the row, or -1 if the table has no row with that name</returns>
+    public int IndexOf(FName rowName)
+    {
+        int low = 0;
+        int high = _rows.NumRows - 1;
+
+        while (low <= high)
+        {
+            int middle = low + ((high - low) >> 1);
+            int rowIndex = _rows.SortedIndices[middle];
+            int comparison = FName.CompareIndices(_rows.Rows[rowIndex].RowName, rowName);
+
+            if (comparison == 0)
+            {
+                return rowIndex;
+            }
+
+            if (comparison < 0)
+            {
+                low = middle + 1;
+            }
+            else
+            {
+                high = middle - 1;
+            }
+        }
+
+        return -1;
+    }
+
+    /// <summary>
+    /// Finds a row by name.
+    /// </summary>
+    /// <param name="rowName">The name of the row to find</param>
+    /// <param name="row">The row if found</param>
+    /// <returns>True if the row was found</returns>
+    public bool TryGetRow(FName rowName, out T row)
+    {
+        int index = IndexOf(rowName);
+        if (index < 0)
+        {
+            row = default;
+            return false;
+        }
+
+        row = T.FromNative(_rows.Rows[index].RowData);
+        return true;
+    }
+
+    private void CheckIndex(int index)
+    {
+        if ((uint)index >= (uint)_rows.NumRows)
+        {
+            throw new IndexOutOfRangeException($"Row index {index} is out of range, the table has {_rows.NumRows} rows.");
+        }
+    }
+}
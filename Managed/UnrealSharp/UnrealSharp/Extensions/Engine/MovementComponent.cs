@@ -105,4 +105,15 @@ public partial class UMovementComponent : UActorComponent
     {
         return UCSMovementComponentExtensions.ResolvePenetrationRotator(this, adjustment, hit, newRotation);
     }
+
+    /// <summary>
+    /// SafeMoveUpdatedComponent for every request in one native call, in order. Use this to move many agents per frame.
+    /// </summary>
+    /// <param name="requests">The moves to make, requests with an invalid movement component are skipped.</param>
+    /// <param name="hits">The hit of the last move of each request, lines up with requests.</param>
+    /// <returns>A bitmask where bit i is set if the move of requests[i] succeeded</returns>
+    public static IList<long> SafeMoveUpdatedComponents(IList<FCSMovementRequest> requests, out IList<FHitResult> hits)
+    {
+        return UCSMovementComponentExtensions.SafeMoveUpdatedComponentsBatch(requests, out hits);
+    }
 }
\ No newline at end of file
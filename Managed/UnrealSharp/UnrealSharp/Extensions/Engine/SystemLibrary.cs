@@ -1,3 +1,4 @@
+using System.Runtime.InteropServices;
 using UnrealSharp.Core;
 using UnrealSharp.CoreUObject;
 using UnrealSharp.Interop;
@@ -30,6 +31,29 @@ public partial class SystemLibrary
         }
     }
     
+    /// <summary>
+    /// Set a timer to call the specified action after the specified duration, without going through a UFunction.
+    /// The action can be any method or lambda, the timer stops when the owner is destroyed.
+    /// Timers set this way are cleared when the managed assemblies are unloaded, such as on hot reload.
+    /// </summary>
+    /// <param name="owner"> The object the timer belongs to, its world runs the timer. </param>
+    /// <param name="action"> The function to call. </param>
+    /// <param name="time"> The time in seconds before the function is called. </param>
+    /// <param name="bLooping"> Whether the timer should loop. </param>
+    /// <param name="initialStartDelay"> The initial delay before the timer starts. </param>
+    public static FTimerHandle SetManagedTimer(UObject owner, Action action, float time, bool bLooping, float initialStartDelay = 0.000000f)
+    {
+        unsafe
+        {
+            // Freed by the timer once it is done.
+            GCHandle actionHandle = GCHandle.Alloc(action);
+            
+            FTimerHandle timerHandle = new FTimerHandle();
+            UWorldExporter.CallSetManagedTimer(owner.NativeObject, GCHandle.ToIntPtr(actionHandle), time, bLooping.ToNativeBool(), initialStartDelay, &timerHandle);
+            return timerHandle;
+        }
+    }
+    
     /// <summary>
     /// Does a collision trace along the given line and returns the first blocking hit encountered.
     /// This trace finds the objects that RESPONDS to the given TraceChannel
@@ -0,0 +1,142 @@
+using System.Runtime.InteropServices;
+using UnrealSharp.Core;
+using UnrealSharp.CoreUObject;
+using UnrealSharp.Interop;
+
+namespace UnrealSharp.Engine;
+
+/// <summary>
+/// One trace of a <see cref="TraceBatch"/>. Traces a line, or sweeps a sphere when the sweep radius is above zero.
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+public struct TraceRequest
+{
+    public FVector Start;
+    public FVector End;
+    public float SweepRadius;
+    private int _traceChannel;
+    private byte _traceComplex;
+    
+    public TraceRequest(FVector start, FVector end, ETraceTypeQuery traceChannel, float sweepRadius = 0.0f, bool traceComplex = false)
+    {
+        Start = start;
+        End = end;
+        SweepRadius = sweepRadius;
+        _traceChannel = (int) traceChannel;
+        _traceComplex = traceComplex ? (byte) 1 : (byte) 0;
+    }
+    
+    public ETraceTypeQuery TraceChannel
+    {
+        get => (ETraceTypeQuery) _traceChannel;
+        set => _traceChannel = (int) value;
+    }
+    
+    public bool TraceComplex
+    {
+        get => _traceComplex != 0;
+        set => _traceComplex = value ? (byte) 1 : (byte) 0;
+    }
+}
+
+/// <summary>
+/// The first blocking hit of a <see cref="TraceRequest"/>, if any.
+/// The hit actor and component are only valid during the frame the result is delivered in.
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+public struct TraceResult
+{
+    public FVector Location;
+    public FVector ImpactPoint;
+    public FVector ImpactNormal;
+    private IntPtr _component;
+    private IntPtr _actor;
+    public float Distance;
+    private byte _blockingHit;
+    private byte _startPenetrating;
+    
+    public bool BlockingHit => _blockingHit != 0;
+    public bool StartPenetrating => _startPenetrating != 0;
+    
+    public UPrimitiveComponent? Component => FindManagedObject<UPrimitiveComponent>(_component);
+    public AActor? Actor => FindManagedObject<AActor>(_actor);
+
+    private static T? FindManagedObject<T>(IntPtr nativeObject) where T : UnrealSharpObject
+    {
+        if (nativeObject == IntPtr.Zero)
+        {
+            return null;
+        }
+        
+        return GCHandleUtilities.GetObjectFromHandlePtr<T>(FCSManagerExporter.CallFindManagedObject(nativeObject));
+    }
+}
+
+/// <summary>
+/// Runs many traces by channel with a single call into native code, for code that traces a lot every frame, like AI perception.
+/// </summary>
+public static class TraceBatch
+{
+    /// <summary>
+    /// Runs the traces right away, spread over worker threads. Results are in the same order as the requests.
+    /// </summary>
+    public static unsafe void Trace(UObject worldContextObject, ReadOnlySpan<TraceRequest> requests, Span<TraceResult> outResults, IList<AActor>? actorsToIgnore = null)
+    {
+        if (outResults.Length < requests.Length)
+        {
+            throw new ArgumentException("The output span is shorter than the requests", nameof(outResults));
+        }
+        
+        Span<IntPtr> ignoredActors = GetIgnoredActors(actorsToIgnore, stackalloc IntPtr[Math.Min(actorsToIgnore?.Count ?? 0, 16)]);
+        
+        fixed (TraceRequest* requestsPtr = requests)
+        fixed (TraceResult* resultsPtr = outResults)
+        fixed (IntPtr* ignoredActorsPtr = ignoredActors)
+        {
+            FCSTraceBatchExporter.CallTraceBatch(worldContextObject.NativeObject, requestsPtr, resultsPtr, requests.Length, ignoredActorsPtr, ignoredActors.Length);
+        }
+    }
+    
+    /// <summary>
+    /// Queues the traces as async traces of the world. Once all of them are done, next frame, onCompleted runs once with
+    /// the results in the same order as the requests. It doesn't run if the world goes away first.
+    /// </summary>
+    public static unsafe void TraceAsync(UObject worldContextObject, ReadOnlySpan<TraceRequest> requests, Action<TraceResult[]> onCompleted, IList<AActor>? actorsToIgnore = null)
+    {
+        // Native code writes the results into the array when the traces complete, so it must not move.
+        TraceResult[] results = GC.AllocateArray<TraceResult>(requests.Length, pinned: true);
+        GCHandle callbackHandle = GCHandle.Alloc(() => onCompleted(results));
+        
+        Span<IntPtr> ignoredActors = GetIgnoredActors(actorsToIgnore, stackalloc IntPtr[Math.Min(actorsToIgnore?.Count ?? 0, 16)]);
+        
+        fixed (TraceRequest* requestsPtr = requests)
+        fixed (TraceResult* resultsPtr = results)
+        fixed (IntPtr* ignoredActorsPtr = ignoredActors)
+        {
+            NativeBool queued = FCSTraceBatchExporter.CallAsyncTraceBatch(worldContextObject.NativeObject, requestsPtr, resultsPtr, requests.Length, 
+                ignoredActorsPtr, ignoredActors.Length, GCHandle.ToIntPtr(callbackHandle));
+            
+            if (!queued.ToManagedBool())
+            {
+                callbackHandle.Free();
+                throw new InvalidOperationException($"{worldContextObject} has no world to trace in");
+            }
+        }
+    }
+    
+    private static Span<IntPtr> GetIgnoredActors(IList<AActor>? actorsToIgnore, Span<IntPtr> buffer)
+    {
+        if (actorsToIgnore == null || actorsToIgnore.Count == 0)
+        {
+            return Span<IntPtr>.Empty;
+        }
+        
+        Span<IntPtr> ignoredActors = actorsToIgnore.Count <= buffer.Length ? buffer : new IntPtr[actorsToIgnore.Count];
+        for (int i = 0; i < actorsToIgnore.Count; i++)
+        {
+            ignoredActors[i] = actorsToIgnore[i].NativeObject;
+        }
+        
+        return ignoredActors;
+    }
+}
@@ -1,21 +1,50 @@
-﻿using UnrealSharp.CoreUObject;
+﻿using System.Reflection;
+using System.Runtime.InteropServices;
+using UnrealSharp.Attributes;
+using UnrealSharp.Core;
+using UnrealSharp.CoreUObject;
 using UnrealSharp.Interop;
 
 namespace UnrealSharp.EnhancedInput;
 
 public partial class UEnhancedInputComponent
 {
+    private sealed class InputActionBinding(Action<FInputActionValue, float, float, UInputAction> callback, UInputAction action)
+    {
+        public readonly Action<FInputActionValue, float, float, UInputAction> Callback = callback;
+        public readonly UInputAction Action = action;
+    }
+
+    /// <summary>
+    /// Binds the callback directly to the action. Events call it without looking up a UFunction, so the callback
+    /// doesn't need to be a UFunction and can be a lambda. Events stop once the object declaring the callback is destroyed,
+    /// or this component when the callback isn't declared in a UObject. When the callback is a UFunction of a UObject,
+    /// the binding falls back to calling it by name once a hot reload unloads the old assembly. Other callbacks, like lambdas,
+    /// stop firing with the reload and need to be bound again.
+    /// </summary>
     public bool BindAction(UInputAction action, ETriggerEvent triggerEvent, Action<FInputActionValue, float, float, UInputAction> callback, out uint handle)
     {
-        if (callback.Target is not UObject unrealObject)
-        {
-            throw new ArgumentException("The callback must be a method within a UObject class.", nameof(callback));
-        }
+        UObject? targetObject = callback.Target as UObject;
+        UObject owner = targetObject ?? this;
+        FName functionName = targetObject != null && callback.Method.IsDefined(typeof(UFunctionAttribute), true) ? new FName(callback.Method.Name) : FName.None;
+
+        GCHandle bindingHandle = GCHandleUtilities.AllocateStrongPointer(new InputActionBinding(callback, action), callback.Method.Module.Assembly);
+
         unsafe
         {
             fixed (uint* handlePtr = &handle)
             {
-                return UEnhancedInputComponentExporter.CallBindAction(NativeObject, action.NativeObject, triggerEvent, unrealObject.NativeObject, callback.Method.Name, (IntPtr) handlePtr);
+                bool bound = UEnhancedInputComponentExporter.CallBindActionCallback(NativeObject, action.NativeObject, triggerEvent, owner.NativeObject, functionName,
+                    (IntPtr) (delegate* unmanaged<IntPtr, FVector*, byte, float, float, NativeBool>) &InvokeBinding,
+                    (IntPtr) (delegate* unmanaged<IntPtr, void>) &ReleaseBinding,
+                    GCHandle.ToIntPtr(bindingHandle), (IntPtr) handlePtr);
+
+                if (!bound)
+                {
+                    GCHandleUtilities.Free(bindingHandle, callback.Method.Module.Assembly);
+                }
+
+                return bound;
             }
         }
     }
@@ -28,4 +57,34 @@ public partial class UEnhancedInputComponent
     {
         return UEnhancedInputComponentExporter.CallRemoveBindingByHandle(NativeObject, handle);
     }
-}
\ No newline at end of file
+
+    [UnmanagedCallersOnly]
+    private static unsafe NativeBool InvokeBinding(IntPtr bindingHandle, FVector* axisValue, byte valueType, float elapsedSeconds, float triggeredSeconds)
+    {
+        // Collected once the assembly of the callback unloads.
+        InputActionBinding? binding = GCHandleUtilities.GetObjectFromHandlePtr<InputActionBinding>(bindingHandle);
+        if (binding == null)
+        {
+            return NativeBool.False;
+        }
+
+        try
+        {
+            binding.Callback(new FInputActionValue(*axisValue, (EInputActionValueType) valueType), elapsedSeconds, triggeredSeconds, binding.Action);
+        }
+        catch (Exception exception)
+        {
+            LogUnrealSharp.LogError($"Input action callback threw an exception: {exception}");
+        }
+
+        return NativeBool.True;
+    }
+
+    [UnmanagedCallersOnly]
+    private static void ReleaseBinding(IntPtr bindingHandle)
+    {
+        GCHandle handle = GCHandle.FromIntPtr(bindingHandle);
+        Assembly? assembly = (handle.Target as InputActionBinding)?.Callback.Method.Module.Assembly;
+        GCHandleUtilities.Free(handle, assembly);
+    }
+}
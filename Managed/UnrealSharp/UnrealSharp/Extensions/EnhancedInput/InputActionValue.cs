@@ -8,6 +8,12 @@ public partial struct FInputActionValue
 {
     private FVector AxisValue;
     private EInputActionValueType ValueType;
+
+    internal FInputActionValue(FVector axisValue, EInputActionValueType valueType)
+    {
+        AxisValue = axisValue;
+        ValueType = valueType;
+    }
     
     public float GetAxis1D()
     {
@@ -1,8 +1,9 @@
+using UnrealSharp.Interop;
 using UnrealSharp.UnrealSharpCore;
 
 namespace UnrealSharp.GameplayTags;
 
-public partial struct FGameplayTag
+public partial struct FGameplayTag : IUnrealTypeHash
 {
     public FGameplayTag(FName tagName)
     {
@@ -15,6 +16,30 @@ public partial struct FGameplayTag
     
     public FGameplayTag(string tagName) : this(new FName(tagName)) {}
 
+    /// <summary>
+    /// Resolves a comma separated table of tags with a single native call, instead of one call per tag.
+    /// Used by the generated GameplayTags class. Tags that aren't registered are left as None.
+    /// </summary>
+    /// <param name="tagTable">The tag names, separated by commas</param>
+    /// <param name="numTags">The number of tags in the table</param>
+    public static unsafe FGameplayTag[] RequestGameplayTags(string tagTable, int numTags)
+    {
+        FName[] tagNames = new FName[numTags];
+        fixed (char* tagTablePtr = tagTable)
+        fixed (FName* tagNamesPtr = tagNames)
+        {
+            FGameplayTagExporter.CallRequestGameplayTags(tagTablePtr, tagTable.Length, tagNamesPtr, numTags);
+        }
+
+        FGameplayTag[] tags = new FGameplayTag[numTags];
+        for (int i = 0; i < numTags; i++)
+        {
+            tags[i].TagName = tagNames[i];
+        }
+
+        return tags;
+    }
+
     /// <summary>
     /// Returns empty GameplayTag
     /// </summary>
@@ -60,6 +85,12 @@ public partial struct FGameplayTag
         return TagName.GetHashCode();
     }
 
+    /// <inheritdoc />
+    public uint GetTypeHash()
+    {
+        return TagName.GetTypeHash();
+    }
+
     public override string ToString()
     {
         return TagName.ToString();
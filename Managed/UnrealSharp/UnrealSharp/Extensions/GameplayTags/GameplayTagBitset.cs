@@ -0,0 +1,188 @@
+using System.Numerics;
+using UnrealSharp.UnrealSharpCore;
+
+namespace UnrealSharp.GameplayTags;
+
+/// <summary>
+/// A flattened copy of a <see cref="FGameplayTagContainer"/> as two bitsets over interned tag indices: the explicit tags, and
+/// the explicit tags with all their parents. Queries are bit tests in managed memory and don't cross into native code.
+/// Build one per container and rebuild it with <see cref="Set"/> whenever the container changes.
+/// </summary>
+public sealed class GameplayTagBitset
+{
+    private static readonly Dictionary<FGameplayTag, int[]> TagIndices = new();
+
+    private ulong[] _explicitBits = Array.Empty<ulong>();
+    private ulong[] _expandedBits = Array.Empty<ulong>();
+
+    public GameplayTagBitset()
+    {
+    }
+
+    public GameplayTagBitset(FGameplayTagContainer container)
+    {
+        Set(container);
+    }
+
+    public GameplayTagBitset(IEnumerable<FGameplayTag> tags)
+    {
+        Set(tags);
+    }
+
+    /// <summary>
+    /// Rebuilds the bitsets from the explicit tags of the container.
+    /// </summary>
+    public void Set(FGameplayTagContainer container)
+    {
+        Set(container.GameplayTags);
+    }
+
+    /// <summary>
+    /// Rebuilds the bitsets from the tags.
+    /// </summary>
+    public void Set(IEnumerable<FGameplayTag> tags)
+    {
+        Array.Clear(_explicitBits);
+        Array.Clear(_expandedBits);
+
+        foreach (FGameplayTag tag in tags)
+        {
+            int[] indices = GetIndices(tag);
+            if (indices.Length == 0)
+            {
+                continue;
+            }
+
+            SetBit(ref _explicitBits, indices[0]);
+            foreach (int index in indices)
+            {
+                SetBit(ref _expandedBits, index);
+            }
+        }
+    }
+
+    /// <summary>
+    /// Same as <see cref="FGameplayTagContainer.HasTag"/>, also matches parents of the tags in this set.
+    /// </summary>
+    public bool HasTag(FGameplayTag tag)
+    {
+        int[] indices = GetIndices(tag);
+        return indices.Length != 0 && TestBit(_expandedBits, indices[0]);
+    }
+
+    /// <summary>
+    /// Only matches tags that were explicitly added.
+    /// </summary>
+    public bool HasTagExact(FGameplayTag tag)
+    {
+        int[] indices = GetIndices(tag);
+        return indices.Length != 0 && TestBit(_explicitBits, indices[0]);
+    }
+
+    /// <summary>
+    /// True if this set has any of the tags of the other set, also matching parents of the tags in this set.
+    /// </summary>
+    public bool HasAny(GameplayTagBitset other) => Intersects(_expandedBits, other._explicitBits);
+
+    public bool HasAnyExact(GameplayTagBitset other) => Intersects(_explicitBits, other._explicitBits);
+
+    /// <summary>
+    /// True if this set has all the tags of the other set, also matching parents of the tags in this set. True if the other set is empty.
+    /// </summary>
+    public bool HasAll(GameplayTagBitset other) => Contains(_expandedBits, other._explicitBits);
+
+    public bool HasAllExact(GameplayTagBitset other) => Contains(_explicitBits, other._explicitBits);
+
+    private static int[] GetIndices(FGameplayTag tag)
+    {
+        if (TagIndices.TryGetValue(tag, out int[]? indices))
+        {
+            return indices;
+        }
+
+        UCSGameplayTagExtensions.GetTagIndices(tag, out IList<int> nativeIndices);
+        indices = nativeIndices.ToArray();
+        TagIndices.Add(tag, indices);
+        return indices;
+    }
+
+    private static void SetBit(ref ulong[] bits, int index)
+    {
+        int word = index >> 6;
+        if (word >= bits.Length)
+        {
+            Array.Resize(ref bits, Math.Max(word + 1, bits.Length * 2));
+        }
+
+        bits[word] |= 1UL << (index & 63);
+    }
+
+    private static bool TestBit(ulong[] bits, int index)
+    {
+        int word = index >> 6;
+        return word < bits.Length && (bits[word] & (1UL << (index & 63))) != 0;
+    }
+
+    private static bool Intersects(ReadOnlySpan<ulong> bits, ReadOnlySpan<ulong> other)
+    {
+        int length = Math.Min(bits.Length, other.Length);
+        int i = 0;
+
+        if (Vector.IsHardwareAccelerated)
+        {
+            for (; i <= length - Vector<ulong>.Count; i += Vector<ulong>.Count)
+            {
+                if (!Vector.EqualsAll(new Vector<ulong>(bits.Slice(i)) & new Vector<ulong>(other.Slice(i)), Vector<ulong>.Zero))
+                {
+                    return true;
+                }
+            }
+        }
+
+        for (; i < length; i++)
+        {
+            if ((bits[i] & other[i]) != 0)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    private static bool Contains(ReadOnlySpan<ulong> bits, ReadOnlySpan<ulong> other)
+    {
+        int length = Math.Min(bits.Length, other.Length);
+        int i = 0;
+
+        if (Vector.IsHardwareAccelerated)
+        {
+            for (; i <= length - Vector<ulong>.Count; i += Vector<ulong>.Count)
+            {
+                if (!Vector.EqualsAll(Vector.AndNot(new Vector<ulong>(other.Slice(i)), new Vector<ulong>(bits.Slice(i))), Vector<ulong>.Zero))
+                {
+                    return false;
+                }
+            }
+        }
+
+        for (; i < length; i++)
+        {
+            if ((other[i] & ~bits[i]) != 0)
+            {
+                return false;
+            }
+        }
+
+        // Anything the other set has past our end is a tag we don't have.
+        for (; i < other.Length; i++)
+        {
+            if (other[i] != 0)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
@@ -129,6 +129,33 @@ public partial struct FGameplayTagContainer
     /// </summary>
     /// <returns>True if the container is valid</returns>
     public bool IsValid => UCSGameplayTagContainerExtensions.IsValid(this);
+
+    /// <summary>
+    /// Checks this container against every tag in one native call.
+    /// </summary>
+    /// <param name="tags">The tags to check for</param>
+    /// <param name="exactMatch">Only allow exact matches, like HasTagExact</param>
+    /// <returns>A bitmask where bit i is set if this container has tags[i]</returns>
+    public IList<long> HasTagsMask(IList<FGameplayTag> tags, bool exactMatch = false) => UCSGameplayTagContainerExtensions.HasTagsMask(this, tags, exactMatch);
+
+    /// <summary>
+    /// Checks every container against the tag in one native call.
+    /// </summary>
+    /// <param name="containers">The containers to check</param>
+    /// <param name="tag">The tag to check for</param>
+    /// <param name="exactMatch">Only allow exact matches, like HasTagExact</param>
+    /// <returns>A bitmask where bit i is set if containers[i] has the tag</returns>
+    public static IList<long> HaveTagMask(IList<FGameplayTagContainer> containers, FGameplayTag tag, bool exactMatch = false) 
+        => UCSGameplayTagContainerExtensions.ContainersHaveTagMask(containers, tag, exactMatch);
+
+    /// <summary>
+    /// Checks every container against the query in one native call.
+    /// </summary>
+    /// <param name="containers">The containers to check</param>
+    /// <param name="query">The query to match</param>
+    /// <returns>A bitmask where bit i is set if containers[i] matches the query</returns>
+    public static IList<long> MatchQueryMask(IList<FGameplayTagContainer> containers, FGameplayTagQuery query) 
+        => UCSGameplayTagContainerExtensions.ContainersMatchQueryMask(containers, query);
     
     public override string ToString()
     {
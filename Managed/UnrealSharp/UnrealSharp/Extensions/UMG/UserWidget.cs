@@ -5,6 +5,21 @@ namespace UnrealSharp.UMG;
 
 public partial class UUserWidget
 {
+    /// <summary>
+    /// Called when the widget is handed out by <see cref="UCSWidgetPoolSubsystem"/>, newly created or reused.
+    /// Reused widgets keep their state from the last use, put it back the way a new widget has it.
+    /// </summary>
+    protected internal virtual void OnAcquire()
+    {
+    }
+
+    /// <summary>
+    /// Called right before the widget goes back to the <see cref="UCSWidgetPoolSubsystem"/>. Unbind anything it listens to here.
+    /// </summary>
+    protected internal virtual void OnRelease()
+    {
+    }
+
     /// <summary>
     /// Get the owning player controller of this widget as a specific type.
     /// </summary>
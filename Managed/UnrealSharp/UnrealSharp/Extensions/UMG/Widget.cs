@@ -1,4 +1,5 @@
 ﻿using UnrealSharp.Engine;
+using UnrealSharp.UnrealSharpCore;
 
 namespace UnrealSharp.UMG;
 
@@ -16,4 +17,13 @@ public partial class UWidget
     /// <typeparam name="T">The type of the local player.</typeparam>
     /// <returns>The owning local player of this widget.</returns>
     public T OwningLocalPlayerAs<T>() where T : ULocalPlayer => (T) OwningLocalPlayer;
+
+    /// <summary>
+    /// Writes the staged values of the block to this widget and pushes them to its Slate widget once.
+    /// </summary>
+    public void ApplyPropertyBlock(PropertyBlock block)
+    {
+        block.Apply(this);
+        UCSUserWidgetExtensions.SynchronizeProperties(this);
+    }
 }
\ No newline at end of file
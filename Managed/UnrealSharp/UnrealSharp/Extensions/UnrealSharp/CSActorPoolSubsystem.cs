@@ -0,0 +1,55 @@
+using UnrealSharp.CoreUObject;
+using UnrealSharp.Engine;
+
+namespace UnrealSharp.UnrealSharpCore;
+
+public partial class UCSActorPoolSubsystem
+{
+    /// <summary>
+    /// Gets an actor of the specified type from the pool, or spawns one when the pool is empty.
+    /// <see cref="AActor.OnAcquire"/> is called on it in both cases.
+    /// </summary>
+    /// <param name="actorType"> The type of the actor. Pooled actors are only reused for exactly this type. </param>
+    /// <param name="spawnTransform"> The transform to put the actor at. </param>
+    /// <param name="spawnParameters"> The owner and instigator are applied to reused actors too. </param>
+    /// <typeparam name="T"> The type of the actor. </typeparam>
+    /// <returns> The actor, or null if it failed to spawn. </returns>
+    public T? Acquire<T>(TSubclassOf<T> actorType, FTransform spawnTransform, FCSSpawnActorParameters spawnParameters = default) where T : AActor
+    {
+        T? actor = AcquireActor(new TSubclassOf<AActor>(actorType), spawnTransform, spawnParameters) as T;
+        actor?.OnAcquire();
+        return actor;
+    }
+
+    /// <summary>
+    /// Calls <see cref="AActor.OnRelease"/> and hands the actor back to the pool.
+    /// Actors that can't be pooled, because they aren't C# types or the pool is full, are destroyed instead.
+    /// </summary>
+    /// <returns> True if the actor was pooled. </returns>
+    public bool Release(AActor actor)
+    {
+        actor.OnRelease();
+        return ReleaseActor(actor);
+    }
+
+    /// <summary>
+    /// Gets a component of the specified type from the pool, or creates one, and registers it with the owner.
+    /// <see cref="UActorComponent.OnAcquire"/> is called on it in both cases.
+    /// </summary>
+    public T? Acquire<T>(AActor owner, TSubclassOf<T> componentType) where T : UActorComponent
+    {
+        T? component = AcquireComponent(owner, new TSubclassOf<UActorComponent>(componentType)) as T;
+        component?.OnAcquire();
+        return component;
+    }
+
+    /// <summary>
+    /// Calls <see cref="UActorComponent.OnRelease"/>, unregisters the component and hands it back to the pool.
+    /// </summary>
+    /// <returns> True if the component was pooled. </returns>
+    public bool Release(UActorComponent component)
+    {
+        component.OnRelease();
+        return ReleaseComponent(component);
+    }
+}
@@ -0,0 +1,41 @@
+using UnrealSharp.CoreUObject;
+using UnrealSharp.Engine;
+
+namespace UnrealSharp.UnrealSharpCore;
+
+public partial class UCSPrimaryDataAssetCacheSubsystem
+{
+    /// <summary>
+    /// Loads all primary assets of the type with the given bundles in one request, and keeps them within the memory budget of the cache.
+    /// </summary>
+    /// <param name="assetType"> The primary asset type to preload, all of its assets are loaded. </param>
+    /// <param name="bundles"> The bundles to load with each asset. </param>
+    public async Task PreloadAsync(FPrimaryAssetType assetType, IList<FName>? bundles = null)
+    {
+        UAssetManager.Get().GetPrimaryAssetIdList(assetType, out IList<FPrimaryAssetId> assetIds);
+        await PreloadAsync(assetIds, bundles);
+    }
+    
+    /// <summary>
+    /// Loads the primary assets with the given bundles in one request, and keeps them within the memory budget of the cache.
+    /// </summary>
+    public async Task PreloadAsync(IList<FPrimaryAssetId> assetIds, IList<FName>? bundles = null)
+    {
+        if (assetIds.Count == 0)
+        {
+            return;
+        }
+        
+        await UAssetManager.Get().LoadPrimaryAssets(assetIds, bundles);
+        TrackPrimaryAssets(assetIds);
+    }
+    
+    /// <summary>
+    /// Gets a loaded data asset and marks it as used, so it's evicted last.
+    /// </summary>
+    /// <returns> The data asset, or null if it isn't loaded or isn't of the type. </returns>
+    public T? Get<T>(FPrimaryAssetId assetId) where T : UObject
+    {
+        return GetDataAsset(assetId) as T;
+    }
+}
@@ -0,0 +1,33 @@
+using UnrealSharp.CoreUObject;
+using UnrealSharp.Engine;
+using UnrealSharp.UMG;
+
+namespace UnrealSharp.UnrealSharpCore;
+
+public partial class UCSWidgetPoolSubsystem
+{
+    /// <summary>
+    /// Gets a widget of the specified type from the pool, or creates one when the pool is empty.
+    /// <see cref="UUserWidget.OnAcquire"/> is called on it in both cases.
+    /// </summary>
+    /// <param name="widgetType"> The type of the widget. Pooled widgets are only reused for exactly this type. </param>
+    /// <param name="owningController"> The owning player controller, reused widgets keep theirs when null. </param>
+    /// <typeparam name="T"> The type of the widget. </typeparam>
+    /// <returns> The widget, or null if it failed to be created. </returns>
+    public T? Acquire<T>(TSubclassOf<T> widgetType, APlayerController? owningController = null) where T : UUserWidget
+    {
+        T? widget = AcquireWidget(new TSubclassOf<UUserWidget>(widgetType), owningController) as T;
+        widget?.OnAcquire();
+        return widget;
+    }
+
+    /// <summary>
+    /// Calls <see cref="UUserWidget.OnRelease"/>, removes the widget from its parent and hands it back to the pool.
+    /// </summary>
+    /// <returns> True if the widget was pooled. </returns>
+    public bool Release(UUserWidget widget)
+    {
+        widget.OnRelease();
+        return ReleaseWidget(widget);
+    }
+}
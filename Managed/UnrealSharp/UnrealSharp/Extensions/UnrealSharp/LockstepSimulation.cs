@@ -0,0 +1,139 @@
+using System.Runtime.Loader;
+using UnrealSharp.Core;
+using UnrealSharp.CoreUObject;
+using UnrealSharp.Interop;
+
+namespace UnrealSharp.UnrealSharpCore;
+
+/// <summary>
+/// An object stepped by a <see cref="LockstepSimulation"/>. Steps must only depend on the saved state and the inputs
+/// of the frame for resimulation to give the same result.
+/// </summary>
+public interface ILockstepSimulated
+{
+    void SimulateStep(int frame, float deltaSeconds);
+}
+
+/// <summary>
+/// Saves, restores and steps the simulation state of a fixed set of objects, for rollback netcode.
+/// The properties the objects declare in C# are saved into numbered slots of one native buffer each, in a single call for all objects.
+/// Stepping calls <see cref="ILockstepSimulated.SimulateStep"/> of the objects directly, so resimulating any number of
+/// frames doesn't go through UFunction calls or look up the objects again.
+/// Properties that hold object references from within structs or containers aren't saved. Game thread only.
+/// </summary>
+public sealed class LockstepSimulation : IDisposable
+{
+    private readonly ILockstepSimulated[] _simulated;
+    private IntPtr _snapshot;
+
+    /// <param name="objects">The objects to save and restore. Those that implement <see cref="ILockstepSimulated"/> are stepped, in this order.</param>
+    public unsafe LockstepSimulation(IReadOnlyList<UObject> objects)
+    {
+        IntPtr[] nativeObjects = new IntPtr[objects.Count];
+        List<ILockstepSimulated> simulated = new(objects.Count);
+
+        for (int i = 0; i < objects.Count; i++)
+        {
+            nativeObjects[i] = objects[i].NativeObject;
+
+            if (objects[i] is ILockstepSimulated simulatedObject)
+            {
+                simulated.Add(simulatedObject);
+            }
+        }
+
+        _simulated = simulated.ToArray();
+
+        fixed (IntPtr* nativeObjectsPtr = nativeObjects)
+        {
+            _snapshot = FCSSimulationExporter.CallCreateSnapshot(nativeObjectsPtr, nativeObjects.Length);
+        }
+
+        // The saved state is laid out for the classes of this assembly.
+        AssemblyLoadContext? loadContext = AssemblyLoadContext.GetLoadContext(GetType().Assembly);
+        if (loadContext != null && loadContext.IsCollectible)
+        {
+            loadContext.Unloading += _ => Dispose();
+        }
+    }
+
+    /// <summary>
+    /// Bytes of native memory one saved slot takes.
+    /// </summary>
+    public int StateSize => FCSSimulationExporter.CallGetStateSize(GetSnapshot());
+
+    /// <summary>
+    /// Saves the current state of the objects into the slot, replacing what it held.
+    /// </summary>
+    public void SaveState(int slot)
+    {
+        if (slot < 0)
+        {
+            throw new ArgumentOutOfRangeException(nameof(slot), slot, "Slots start at 0");
+        }
+
+        FCSSimulationExporter.CallSaveState(GetSnapshot(), slot);
+    }
+
+    /// <summary>
+    /// Restores the state saved in the slot.
+    /// </summary>
+    /// <returns>False if the slot was never saved, or an object was destroyed or its class rebuilt. The other objects are restored anyway.</returns>
+    public bool RestoreState(int slot)
+    {
+        return FCSSimulationExporter.CallRestoreState(GetSnapshot(), slot).ToManagedBool();
+    }
+
+    /// <summary>
+    /// Steps every simulated object once.
+    /// </summary>
+    public void Step(int frame, float deltaSeconds)
+    {
+        foreach (ILockstepSimulated simulated in _simulated)
+        {
+            simulated.SimulateStep(frame, deltaSeconds);
+        }
+    }
+
+    /// <summary>
+    /// Restores the slot, then steps every frame from <paramref name="fromFrame"/> up to but not including <paramref name="toFrame"/>.
+    /// </summary>
+    /// <param name="onFrameSimulated">Called after every frame, to save its state or check it against the authority.</param>
+    /// <returns>False if the slot couldn't be restored, nothing is stepped then.</returns>
+    public bool Resimulate(int slot, int fromFrame, int toFrame, float deltaSeconds, Action<int>? onFrameSimulated = null)
+    {
+        if (!RestoreState(slot))
+        {
+            return false;
+        }
+
+        for (int frame = fromFrame; frame < toFrame; frame++)
+        {
+            Step(frame, deltaSeconds);
+            onFrameSimulated?.Invoke(frame);
+        }
+
+        return true;
+    }
+
+    public void Dispose()
+    {
+        if (_snapshot == IntPtr.Zero)
+        {
+            return;
+        }
+
+        FCSSimulationExporter.CallDestroySnapshot(_snapshot);
+        _snapshot = IntPtr.Zero;
+    }
+
+    private IntPtr GetSnapshot()
+    {
+        if (_snapshot == IntPtr.Zero)
+        {
+            throw new ObjectDisposedException(nameof(LockstepSimulation));
+        }
+
+        return _snapshot;
+    }
+}
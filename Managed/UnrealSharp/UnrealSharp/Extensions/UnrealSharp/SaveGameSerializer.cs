@@ -0,0 +1,129 @@
+using System.Runtime.InteropServices;
+using UnrealSharp.Core;
+using UnrealSharp.CoreUObject;
+using UnrealSharp.Interop;
+
+namespace UnrealSharp.UnrealSharpCore;
+
+/// <summary>
+/// Binary save data for objects and structs, much faster to write and read than tagged property serialization.
+/// Objects save their properties marked SaveGame, structs save all of their properties.
+/// Data saved by an older version of a type still loads, properties that were removed or changed type are skipped.
+/// </summary>
+public static class SaveGameSerializer
+{
+    private const int StructAlignment = 16;
+
+    /// <summary>
+    /// Saves the objects into one blob. Saving many objects in one call is much cheaper than saving them one by one.
+    /// </summary>
+    public static unsafe byte[] SaveObjects(IReadOnlyList<UObject?> objects)
+    {
+        IntPtr[] nativeObjects = GetNativeObjects(objects);
+        UnmanagedArray data = default;
+
+        try
+        {
+            fixed (IntPtr* nativeObjectsPtr = nativeObjects)
+            {
+                FCSSaveGameSerializerExporter.CallSaveObjects(nativeObjectsPtr, nativeObjects.Length, ref data);
+            }
+
+            return new ReadOnlySpan<byte>((void*) data.Data, data.ArrayNum).ToArray();
+        }
+        finally
+        {
+            data.Destroy();
+        }
+    }
+
+    /// <summary>
+    /// Loads data saved by <see cref="SaveObjects"/> into the objects, which must be in the order they were saved in.
+    /// </summary>
+    /// <returns>False if the data is corrupt, or doesn't hold one record per object.</returns>
+    public static unsafe bool LoadObjects(IReadOnlyList<UObject?> objects, ReadOnlySpan<byte> data)
+    {
+        IntPtr[] nativeObjects = GetNativeObjects(objects);
+
+        fixed (IntPtr* nativeObjectsPtr = nativeObjects)
+        fixed (byte* dataPtr = data)
+        {
+            return FCSSaveGameSerializerExporter.CallLoadObjects(nativeObjectsPtr, nativeObjects.Length, dataPtr, data.Length).ToManagedBool();
+        }
+    }
+
+    public static unsafe byte[] SaveStruct<T>(T value) where T : struct, MarshalledStruct<T>
+    {
+        IntPtr nativeStruct = T.GetNativeClassPtr();
+        IntPtr buffer = AllocateStruct(nativeStruct, T.GetNativeDataSize());
+        UnmanagedArray data = default;
+
+        try
+        {
+            value.ToNative(buffer);
+            FCSSaveGameSerializerExporter.CallSaveStruct(nativeStruct, buffer, ref data);
+            return new ReadOnlySpan<byte>((void*) data.Data, data.ArrayNum).ToArray();
+        }
+        finally
+        {
+            data.Destroy();
+            FreeStruct(nativeStruct, buffer);
+        }
+    }
+
+    /// <summary>
+    /// Loads data saved by <see cref="SaveStruct{T}"/> into value. Properties the data doesn't have keep their current value.
+    /// </summary>
+    /// <returns>False if the data is corrupt, value is left as is.</returns>
+    public static unsafe bool LoadStruct<T>(ReadOnlySpan<byte> data, ref T value) where T : struct, MarshalledStruct<T>
+    {
+        IntPtr nativeStruct = T.GetNativeClassPtr();
+        IntPtr buffer = AllocateStruct(nativeStruct, T.GetNativeDataSize());
+
+        try
+        {
+            value.ToNative(buffer);
+
+            bool loaded;
+            fixed (byte* dataPtr = data)
+            {
+                loaded = FCSSaveGameSerializerExporter.CallLoadStruct(nativeStruct, buffer, dataPtr, data.Length).ToManagedBool();
+            }
+
+            if (loaded)
+            {
+                value = T.FromNative(buffer);
+            }
+
+            return loaded;
+        }
+        finally
+        {
+            FreeStruct(nativeStruct, buffer);
+        }
+    }
+
+    private static IntPtr[] GetNativeObjects(IReadOnlyList<UObject?> objects)
+    {
+        IntPtr[] nativeObjects = new IntPtr[objects.Count];
+        for (int i = 0; i < objects.Count; i++)
+        {
+            nativeObjects[i] = objects[i]?.NativeObject ?? IntPtr.Zero;
+        }
+
+        return nativeObjects;
+    }
+
+    private static unsafe IntPtr AllocateStruct(IntPtr nativeStruct, int size)
+    {
+        IntPtr buffer = (IntPtr) NativeMemory.AlignedAlloc((nuint) Math.Max(size, 1), StructAlignment);
+        UStructExporter.CallInitializeStruct(nativeStruct, buffer);
+        return buffer;
+    }
+
+    private static unsafe void FreeStruct(IntPtr nativeStruct, IntPtr buffer)
+    {
+        UScriptStructExporter.CallNativeDestroy(nativeStruct, buffer);
+        NativeMemory.AlignedFree((void*) buffer);
+    }
+}
@@ -46,12 +46,20 @@ internal partial class UCSAsyncLoadSoftPtr
         AsyncLoadUtilities.DisposeAsyncLoadTask(ref _tcs);
     }
 
+    protected internal override void ResetForReuse()
+    {
+        if (_tcs.Task.IsCompleted)
+        {
+            _tcs = new TaskCompletionSource<IReadOnlyList<FSoftObjectPath>>();
+        }
+    }
+
     internal static async Task<IReadOnlyList<FSoftObjectPath>> LoadAsync(FSoftObjectPath softObjectPath) =>
         await LoadAsync(new List<FSoftObjectPath> { softObjectPath });
 
     internal static async Task<IReadOnlyList<FSoftObjectPath>> LoadAsync(IReadOnlyList<FSoftObjectPath> softObjectPaths)
     {
-        UCSAsyncLoadSoftPtr loader = NewObject<UCSAsyncLoadSoftPtr>(AsyncLoadUtilities.WorldContextObject);
+        UCSAsyncLoadSoftPtr loader = NativeAsyncUtilities.AcquireAsyncAction<UCSAsyncLoadSoftPtr>(AsyncLoadUtilities.WorldContextObject);
         loader._loadedPaths = softObjectPaths;
 
         NativeAsyncUtilities.InitializeAsyncAction(loader, loader._onAsyncCompleted);
@@ -85,12 +93,20 @@ internal partial class UCSAsyncLoadPrimaryDataAssets
         AsyncLoadUtilities.DisposeAsyncLoadTask(ref _tcs);
     }
 
+    protected internal override void ResetForReuse()
+    {
+        if (_tcs.Task.IsCompleted)
+        {
+            _tcs = new TaskCompletionSource<IList<FPrimaryAssetId>>();
+        }
+    }
+
     internal static async Task<IList<FPrimaryAssetId>> LoadAsync(FPrimaryAssetId primaryAssetId, IList<FName>? assetBundles = null) =>
         await LoadAsync(new List<FPrimaryAssetId> { primaryAssetId }, assetBundles);
 
     internal static async Task<IList<FPrimaryAssetId>> LoadAsync(IList<FPrimaryAssetId> primaryAssetIds, IList<FName>? assetBundles = null)
     {
-        UCSAsyncLoadPrimaryDataAssets loader = NewObject<UCSAsyncLoadPrimaryDataAssets>(AsyncLoadUtilities.WorldContextObject);
+        UCSAsyncLoadPrimaryDataAssets loader = NativeAsyncUtilities.AcquireAsyncAction<UCSAsyncLoadPrimaryDataAssets>(AsyncLoadUtilities.WorldContextObject);
         loader._loadedIds = primaryAssetIds;
 
         NativeAsyncUtilities.InitializeAsyncAction(loader, loader._onAsyncCompleted);
@@ -0,0 +1,12 @@
+namespace UnrealSharp.UnrealSharpAsync;
+
+public partial class UCSAsyncActionBase
+{
+    /// <summary>
+    /// Called every time the action is handed out by <see cref="NativeAsyncUtilities.AcquireAsyncAction{T}"/>, new or reused.
+    /// Pooled actions keep their managed state between uses, put it back the way a new action has it.
+    /// </summary>
+    protected internal virtual void ResetForReuse()
+    {
+    }
+}
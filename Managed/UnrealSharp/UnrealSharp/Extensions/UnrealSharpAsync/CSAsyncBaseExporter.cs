@@ -6,4 +6,5 @@ namespace UnrealSharp.UnrealSharpAsync;
 public static unsafe partial class UCSAsyncBaseExporter
 {
     public static delegate* unmanaged<IntPtr, IntPtr, void> InitializeAsyncObject;
+    public static delegate* unmanaged<IntPtr, IntPtr, IntPtr> AcquireAsyncAction;
 }
\ No newline at end of file
@@ -0,0 +1,16 @@
+using UnrealSharp.Binds;
+using UnrealSharp.Core;
+
+namespace UnrealSharp.UnrealSharpAsync;
+
+[NativeCallbacks]
+public static unsafe partial class CSStreamingBatchExporter
+{
+    public static delegate* unmanaged<FName*, int, int, IntPtr, IntPtr> RequestAsyncLoad;
+    public static delegate* unmanaged<IntPtr, float> GetProgress;
+    public static delegate* unmanaged<IntPtr, int*, int*, void> GetLoadedCount;
+    public static delegate* unmanaged<IntPtr, NativeBool> HasLoadCompleted;
+    public static delegate* unmanaged<IntPtr, NativeBool> WasCanceled;
+    public static delegate* unmanaged<IntPtr, void> CancelLoad;
+    public static delegate* unmanaged<IntPtr, void> ReleaseBatch;
+}
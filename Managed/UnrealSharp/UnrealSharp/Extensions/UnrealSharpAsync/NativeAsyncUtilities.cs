@@ -1,10 +1,23 @@
 using System.Runtime.InteropServices;
 using UnrealSharp.Core;
+using UnrealSharp.CoreUObject;
 
 namespace UnrealSharp.UnrealSharpAsync;
 
 public static class NativeAsyncUtilities
 {
+    /// <summary>
+    /// Gets an async action of type T, reusing one that was destroyed when the world context has a game instance.
+    /// Reused actions get <see cref="UCSAsyncActionBase.ResetForReuse"/> called before they're returned.
+    /// </summary>
+    public static T AcquireAsyncAction<T>(UObject worldContextObject) where T : UCSAsyncActionBase
+    {
+        IntPtr handle = UCSAsyncBaseExporter.CallAcquireAsyncAction(worldContextObject.NativeObject, new TSubclassOf<T>().NativeClass);
+        T action = GCHandleUtilities.GetObjectFromHandlePtr<T>(handle)!;
+        action.ResetForReuse();
+        return action;
+    }
+    
     public static void InitializeAsyncAction(UCSAsyncActionBase action, Action managedCallback)
     {
         GCHandle callbackHandle = GCHandleUtilities.AllocateWeakPointer(managedCallback);
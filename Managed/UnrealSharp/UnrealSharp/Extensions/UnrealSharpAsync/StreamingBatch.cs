@@ -0,0 +1,98 @@
+using System.Runtime.InteropServices;
+using UnrealSharp.Core;
+using UnrealSharp.CoreUObject;
+
+namespace UnrealSharp.UnrealSharpAsync;
+
+/// <summary>
+/// Streams a batch of assets in with a single streamable handle and a single completion callback.
+/// Dispose it once the assets are no longer needed, disposing cancels the load if it's still running.
+/// </summary>
+public sealed unsafe class StreamingBatch : IDisposable
+{
+    private const int MaxStackAllocatedNames = 256;
+
+    private IntPtr _nativeBatch;
+    private readonly TaskCompletionSource _tcs = new();
+
+    /// <param name="assets">Assets to load. Sub-object paths load their outer asset.</param>
+    /// <param name="priority">Async loading priority, higher loads first.</param>
+    public StreamingBatch(ReadOnlySpan<FSoftObjectPath> assets, int priority = 0)
+    {
+        int numNames = assets.Length * 2;
+        Span<FName> assetPathNames = numNames <= MaxStackAllocatedNames ? stackalloc FName[numNames] : new FName[numNames];
+
+        for (int i = 0; i < assets.Length; i++)
+        {
+            assetPathNames[i * 2] = assets[i].AssetPath.PackageName;
+            assetPathNames[i * 2 + 1] = assets[i].AssetPath.AssetName;
+        }
+
+        Action onFinished = OnFinished;
+        GCHandle callbackHandle = GCHandle.Alloc(onFinished);
+
+        fixed (FName* assetPathNamesPtr = assetPathNames)
+        {
+            _nativeBatch = CSStreamingBatchExporter.CallRequestAsyncLoad(assetPathNamesPtr, assets.Length, priority, GCHandle.ToIntPtr(callbackHandle));
+        }
+    }
+
+    /// <summary>
+    /// Completes when every asset has loaded, or is canceled along with the load.
+    /// </summary>
+    public Task Task => _tcs.Task;
+
+    public float Progress => IsValid ? CSStreamingBatchExporter.CallGetProgress(_nativeBatch) : 0.0f;
+
+    public (int Loaded, int Requested) LoadedCount
+    {
+        get
+        {
+            if (!IsValid)
+            {
+                return (0, 0);
+            }
+
+            int loaded, requested;
+            CSStreamingBatchExporter.CallGetLoadedCount(_nativeBatch, &loaded, &requested);
+            return (loaded, requested);
+        }
+    }
+
+    public bool IsCompleted => IsValid && CSStreamingBatchExporter.CallHasLoadCompleted(_nativeBatch).ToManagedBool();
+    public bool WasCanceled => IsValid && CSStreamingBatchExporter.CallWasCanceled(_nativeBatch).ToManagedBool();
+
+    private bool IsValid => _nativeBatch != IntPtr.Zero;
+
+    public void Cancel()
+    {
+        if (IsValid)
+        {
+            CSStreamingBatchExporter.CallCancelLoad(_nativeBatch);
+        }
+    }
+
+    public void Dispose()
+    {
+        if (!IsValid)
+        {
+            return;
+        }
+
+        CSStreamingBatchExporter.CallReleaseBatch(_nativeBatch);
+        _nativeBatch = IntPtr.Zero;
+        _tcs.TrySetCanceled();
+    }
+
+    private void OnFinished()
+    {
+        if (WasCanceled)
+        {
+            _tcs.TrySetCanceled();
+        }
+        else
+        {
+            _tcs.TrySetResult();
+        }
+    }
+}
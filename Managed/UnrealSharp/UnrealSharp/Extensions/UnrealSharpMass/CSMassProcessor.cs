@@ -0,0 +1,75 @@
+using UnrealSharp.Core;
+
+namespace UnrealSharp.UnrealSharpMass;
+
+public partial class UCSMassProcessor
+{
+    private unsafe NativeMassChunk* _currentChunk;
+
+    /// <summary>
+    /// The chunk being executed, only valid in ExecuteChunk.
+    /// </summary>
+    protected unsafe MassChunk CurrentChunk
+    {
+        get
+        {
+            if (_currentChunk == null)
+            {
+                _currentChunk = (NativeMassChunk*) CSMassProcessorExporter.CallGetCurrentChunk(NativeObject);
+            }
+
+            return new MassChunk(_currentChunk);
+        }
+    }
+
+    /// <summary>
+    /// Adds a fragment the query of this processor requires. Only call it from ConfigureQueries.
+    /// </summary>
+    /// <param name="fragmentName">Path of the fragment struct, like /Script/MassCommon.TransformFragment, or its name without the F prefix.</param>
+    protected MassFragment<T> AddFragmentRequirement<T>(string fragmentName,
+        MassFragmentAccess access = MassFragmentAccess.ReadWrite,
+        MassFragmentPresence presence = MassFragmentPresence.All) where T : unmanaged
+    {
+        return AddFragmentRequirement<T>(FindStruct(fragmentName), access, presence);
+    }
+
+    /// <inheritdoc cref="AddFragmentRequirement{T}(string, MassFragmentAccess, MassFragmentPresence)"/>
+    /// <param name="fragmentStruct">The native UScriptStruct of the fragment.</param>
+    protected MassFragment<T> AddFragmentRequirement<T>(IntPtr fragmentStruct,
+        MassFragmentAccess access = MassFragmentAccess.ReadWrite,
+        MassFragmentPresence presence = MassFragmentPresence.All) where T : unmanaged
+    {
+        int index = CSMassProcessorExporter.CallAddFragmentRequirement(NativeObject, fragmentStruct, (byte) access, (byte) presence);
+        if (index < 0)
+        {
+            throw new ArgumentException($"Failed to add the fragment requirement for {typeof(T)}, see the log for why.");
+        }
+
+        return new MassFragment<T>(index);
+    }
+
+    /// <summary>
+    /// Adds a tag the entities matched by the query of this processor must, or must not, have. Only call it from ConfigureQueries.
+    /// </summary>
+    protected void AddTagRequirement(string tagName, MassFragmentPresence presence = MassFragmentPresence.All)
+    {
+        if (!CSMassProcessorExporter.CallAddTagRequirement(NativeObject, FindStruct(tagName), (byte) presence).ToManagedBool())
+        {
+            throw new ArgumentException($"Failed to add the tag requirement for {tagName}, see the log for why.");
+        }
+    }
+
+    private static unsafe IntPtr FindStruct(string name)
+    {
+        fixed (char* namePtr = name)
+        {
+            IntPtr foundStruct = CSMassProcessorExporter.CallFindStruct(namePtr);
+            if (foundStruct == IntPtr.Zero)
+            {
+                throw new ArgumentException($"Couldn't find the struct {name}.", nameof(name));
+            }
+
+            return foundStruct;
+        }
+    }
+}
@@ -0,0 +1,13 @@
+using UnrealSharp.Binds;
+using UnrealSharp.Core;
+
+namespace UnrealSharp.UnrealSharpMass;
+
+[NativeCallbacks]
+public static unsafe partial class CSMassProcessorExporter
+{
+    public static delegate* unmanaged<char*, IntPtr> FindStruct;
+    public static delegate* unmanaged<IntPtr, IntPtr, byte, byte, int> AddFragmentRequirement;
+    public static delegate* unmanaged<IntPtr, IntPtr, byte, NativeBool> AddTagRequirement;
+    public static delegate* unmanaged<IntPtr, IntPtr> GetCurrentChunk;
+}
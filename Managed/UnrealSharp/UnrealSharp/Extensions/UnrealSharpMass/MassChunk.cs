@@ -0,0 +1,122 @@
+using System.Runtime.InteropServices;
+
+namespace UnrealSharp.UnrealSharpMass;
+
+/// <summary>
+/// How a processor uses a fragment, same values as EMassFragmentAccess.
+/// </summary>
+public enum MassFragmentAccess : byte
+{
+    None,
+    ReadOnly,
+    ReadWrite,
+}
+
+/// <summary>
+/// Which entities a requirement matches, same values as EMassFragmentPresence.
+/// </summary>
+public enum MassFragmentPresence : byte
+{
+    All,
+    Any,
+    Optional,
+    None,
+}
+
+/// <summary>
+/// Same layout as FMassEntityHandle.
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+public readonly struct MassEntityHandle
+{
+    public readonly int Index;
+    public readonly int SerialNumber;
+
+    public bool IsSet => Index != 0 && SerialNumber != 0;
+}
+
+/// <summary>
+/// A fragment required by a <see cref="UCSMassProcessor"/>, T being a blittable struct with the layout of the native fragment.
+/// </summary>
+public readonly struct MassFragment<T> where T : unmanaged
+{
+    internal readonly int Index;
+
+    internal MassFragment(int index)
+    {
+        Index = index;
+    }
+}
+
+// Same layout as FCSMassChunk.
+[StructLayout(LayoutKind.Sequential)]
+internal unsafe struct NativeMassChunk
+{
+    public IntPtr* Fragments;
+    public int* FragmentSizes;
+    public MassEntityHandle* Entities;
+    public int NumEntities;
+    public int NumFragments;
+    public float DeltaTime;
+}
+
+/// <summary>
+/// The chunk a <see cref="UCSMassProcessor"/> is executing. The fragment arrays are spans over the native memory of the chunk,
+/// with one element per entity, and are only valid until ExecuteChunk returns.
+/// </summary>
+public readonly unsafe ref struct MassChunk
+{
+    private readonly NativeMassChunk* _chunk;
+
+    internal MassChunk(NativeMassChunk* chunk)
+    {
+        _chunk = chunk;
+    }
+
+    /// <summary>
+    /// Number of entities in the chunk.
+    /// </summary>
+    public int Count => _chunk->NumEntities;
+
+    public float DeltaTime => _chunk->DeltaTime;
+
+    public ReadOnlySpan<MassEntityHandle> Entities => new(_chunk->Entities, _chunk->NumEntities);
+
+    /// <summary>
+    /// False for optional fragments the entities of this chunk don't have.
+    /// </summary>
+    public bool HasFragment<T>(MassFragment<T> fragment) where T : unmanaged
+    {
+        return GetFragmentData(fragment) != null;
+    }
+
+    /// <summary>
+    /// Only write to fragments that were required with <see cref="MassFragmentAccess.ReadWrite"/>, Mass schedules processors based on it.
+    /// </summary>
+    public Span<T> GetMutableFragments<T>(MassFragment<T> fragment) where T : unmanaged
+    {
+        void* data = GetFragmentData(fragment);
+        return data != null ? new Span<T>(data, _chunk->NumEntities) : Span<T>.Empty;
+    }
+
+    public ReadOnlySpan<T> GetFragments<T>(MassFragment<T> fragment) where T : unmanaged
+    {
+        void* data = GetFragmentData(fragment);
+        return data != null ? new ReadOnlySpan<T>(data, _chunk->NumEntities) : ReadOnlySpan<T>.Empty;
+    }
+
+    private void* GetFragmentData<T>(MassFragment<T> fragment) where T : unmanaged
+    {
+        if ((uint) fragment.Index >= (uint) _chunk->NumFragments)
+        {
+            throw new ArgumentOutOfRangeException(nameof(fragment), "The fragment isn't required by this processor.");
+        }
+
+        if (sizeof(T) != _chunk->FragmentSizes[fragment.Index])
+        {
+            throw new InvalidOperationException($"{typeof(T)} is {sizeof(T)} bytes, the native fragment is {_chunk->FragmentSizes[fragment.Index]}.");
+        }
+
+        return (void*) _chunk->Fragments[fragment.Index];
+    }
+}
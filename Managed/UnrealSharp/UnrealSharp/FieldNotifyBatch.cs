@@ -0,0 +1,125 @@
+using System.Runtime.InteropServices;
+using UnrealSharp.Core;
+using UnrealSharp.Interop;
+
+namespace UnrealSharp;
+
+/// <summary>
+/// Collects the field notifications of view models and broadcasts them once per frame with a single call into native code,
+/// instead of one call per changed field. Changes are broadcast once actors ticked, or at the end of the frame for changes made after that.
+/// A field that changes several times in a frame is only broadcast once. Game thread only.
+/// </summary>
+public static unsafe class FieldNotifyBatch
+{
+    // Indices of the fields in the field notification descriptor, per view model type. They're the same for Blueprint subclasses.
+    private static readonly Dictionary<(Type, string), int> FieldIndices = new();
+    
+    // Dirty bits per view model, in the order the view models were first marked this frame.
+    private static readonly Dictionary<UnrealSharpObject, int> DirtyViewModelIndices = new(ReferenceEqualityComparer.Instance);
+    private static readonly List<UnrealSharpObject> DirtyViewModels = new();
+    private static readonly List<ulong[]> DirtyBits = new();
+    
+    private static readonly Action FlushAction = Flush;
+    private static bool _flushRequested;
+    
+    /// <summary>
+    /// Marks a field notify field of the view model as changed. Its value changed event is broadcast at the next flush.
+    /// </summary>
+    public static void MarkDirty(UnrealSharpObject viewModel, string fieldName)
+    {
+        IntPtr nativeObject = viewModel.NativeObject;
+        if (nativeObject == IntPtr.Zero)
+        {
+            return;
+        }
+        
+        int fieldIndex = GetFieldIndex(viewModel, nativeObject, fieldName);
+        if (fieldIndex < 0)
+        {
+            LogUnrealSharp.LogWarning($"{viewModel.GetType().Name} has no field notify field named {fieldName}");
+            return;
+        }
+        
+        if (!DirtyViewModelIndices.TryGetValue(viewModel, out int viewModelIndex))
+        {
+            viewModelIndex = DirtyViewModels.Count;
+            DirtyViewModelIndices.Add(viewModel, viewModelIndex);
+            DirtyViewModels.Add(viewModel);
+            DirtyBits.Add(new ulong[fieldIndex / 64 + 1]);
+        }
+        
+        ulong[] bits = DirtyBits[viewModelIndex];
+        if (fieldIndex / 64 >= bits.Length)
+        {
+            Array.Resize(ref bits, fieldIndex / 64 + 1);
+            DirtyBits[viewModelIndex] = bits;
+        }
+        
+        bits[fieldIndex / 64] |= 1UL << (fieldIndex % 64);
+        
+        if (!_flushRequested)
+        {
+            _flushRequested = true;
+            FCSFieldNotifyExporter.CallRequestFieldNotifyFlush(GCHandle.ToIntPtr(GCHandle.Alloc(FlushAction)));
+        }
+    }
+    
+    private static int GetFieldIndex(UnrealSharpObject viewModel, IntPtr nativeObject, string fieldName)
+    {
+        (Type, string) key = (viewModel.GetType(), fieldName);
+        
+        if (!FieldIndices.TryGetValue(key, out int fieldIndex))
+        {
+            fieldIndex = FCSFieldNotifyExporter.CallGetFieldNotifyIndex(nativeObject, fieldName);
+            FieldIndices.Add(key, fieldIndex);
+        }
+        
+        return fieldIndex;
+    }
+    
+    private static void Flush()
+    {
+        _flushRequested = false;
+        
+        int numViewModels = DirtyViewModels.Count;
+        if (numViewModels == 0)
+        {
+            return;
+        }
+        
+        int numWords = 0;
+        foreach (ulong[] bits in DirtyBits)
+        {
+            numWords += bits.Length;
+        }
+        
+        IntPtr[] objects = new IntPtr[numViewModels];
+        int[] wordOffsets = new int[numViewModels + 1];
+        ulong[] packedBits = new ulong[numWords];
+        
+        int wordOffset = 0;
+        for (int i = 0; i < numViewModels; i++)
+        {
+            // Disposed view models have lost their native object, native code skips them.
+            objects[i] = DirtyViewModels[i].NativeObject;
+            wordOffsets[i] = wordOffset;
+            
+            DirtyBits[i].CopyTo(packedBits, wordOffset);
+            wordOffset += DirtyBits[i].Length;
+        }
+        
+        wordOffsets[numViewModels] = wordOffset;
+        
+        // Cleared before broadcasting, handlers can mark fields again for the next flush.
+        DirtyViewModelIndices.Clear();
+        DirtyViewModels.Clear();
+        DirtyBits.Clear();
+        
+        fixed (IntPtr* objectsPtr = objects)
+        fixed (int* wordOffsetsPtr = wordOffsets)
+        fixed (ulong* packedBitsPtr = packedBits)
+        {
+            FCSFieldNotifyExporter.CallBroadcastFieldsValueChanged(objectsPtr, wordOffsetsPtr, packedBitsPtr, numViewModels);
+        }
+    }
+}
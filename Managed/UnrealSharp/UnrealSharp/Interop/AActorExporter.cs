@@ -5,5 +5,7 @@ namespace UnrealSharp.Interop;
 [NativeCallbacks]
 public static unsafe partial class AActorExporter
 {
-    
+    public static delegate* unmanaged<IntPtr, IntPtr, void> K2_SetActorLocation;
+    public static delegate* unmanaged<IntPtr, IntPtr, void> K2_GetActorLocation;
+    public static delegate* unmanaged<IntPtr, IntPtr, void> GetTransform;
 }
\ No newline at end of file
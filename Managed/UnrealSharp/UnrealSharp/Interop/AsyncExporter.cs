@@ -7,4 +7,6 @@ public static unsafe partial class AsyncExporter
 {
     public static delegate* unmanaged<WeakObjectData, int, IntPtr, void> RunOnThread;
     public static delegate* unmanaged<int> GetCurrentNamedThread;
+    public static delegate* unmanaged<WeakObjectData, int, IntPtr, void> PostGameThreadContinuation;
+    public static delegate* unmanaged<IntPtr, void> PostNextTickContinuation;
 }
\ No newline at end of file
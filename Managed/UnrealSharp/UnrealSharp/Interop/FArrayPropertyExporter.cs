@@ -13,4 +13,8 @@ public static unsafe partial class FArrayPropertyExporter
     public static delegate* unmanaged<IntPtr, UnmanagedArray*, int, void> RemoveFromArray;
     public static delegate* unmanaged<IntPtr, UnmanagedArray*, int, void> ResizeArray;
     public static delegate* unmanaged<IntPtr, UnmanagedArray*, int, int, void> SwapValues;
+    public static delegate* unmanaged<IntPtr, UnmanagedArray*, void*, int, int, NativeBool> CopyFromManagedSpan;
+    public static delegate* unmanaged<IntPtr, UnmanagedArray*, void*, int, int, int, NativeBool> CopyToManagedSpan;
+    public static delegate* unmanaged<IntPtr, UnmanagedArray*, void*, int, int, NativeBool> AppendRange;
+    public static delegate* unmanaged<IntPtr, UnmanagedArray*, int, int, void> RemoveRange;
 }
\ No newline at end of file
@@ -0,0 +1,12 @@
+using UnrealSharp.Binds;
+
+namespace UnrealSharp.Interop;
+
+[NativeCallbacks]
+public static unsafe partial class FCSCollisionEventsExporter
+{
+    public static delegate* unmanaged<IntPtr, IntPtr, IntPtr, int> AddListener;
+    public static delegate* unmanaged<IntPtr, int, void> RemoveListener;
+    public static delegate* unmanaged<IntPtr, int, IntPtr, byte, void> Listen;
+    public static delegate* unmanaged<IntPtr, int, IntPtr, void> StopListening;
+}
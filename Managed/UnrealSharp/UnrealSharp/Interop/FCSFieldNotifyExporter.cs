@@ -0,0 +1,11 @@
+using UnrealSharp.Binds;
+
+namespace UnrealSharp.Interop;
+
+[NativeCallbacks]
+public static unsafe partial class FCSFieldNotifyExporter
+{
+    public static delegate* unmanaged<IntPtr, string, int> GetFieldNotifyIndex;
+    public static delegate* unmanaged<IntPtr, void> RequestFieldNotifyFlush;
+    public static delegate* unmanaged<IntPtr*, int*, ulong*, int, void> BroadcastFieldsValueChanged;
+}
@@ -0,0 +1,14 @@
+using UnrealSharp.Binds;
+using UnrealSharp.Core;
+
+namespace UnrealSharp.Interop;
+
+[NativeCallbacks]
+public static unsafe partial class FCSManagedJobsExporter
+{
+    public static delegate* unmanaged<IntPtr, IntPtr*, int, int, IntPtr*, int, IntPtr*, void> LaunchJobs;
+    public static delegate* unmanaged<IntPtr, NativeBool> IsJobCompleted;
+    public static delegate* unmanaged<IntPtr, void> WaitForJob;
+    public static delegate* unmanaged<IntPtr, void> ReleaseJob;
+    public static delegate* unmanaged<IntPtr, IntPtr, int, int, void> ParallelFor;
+}
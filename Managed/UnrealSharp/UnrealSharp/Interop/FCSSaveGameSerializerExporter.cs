@@ -0,0 +1,13 @@
+using UnrealSharp.Binds;
+using UnrealSharp.Core;
+
+namespace UnrealSharp.Interop;
+
+[NativeCallbacks]
+public static unsafe partial class FCSSaveGameSerializerExporter
+{
+    public static delegate* unmanaged<IntPtr*, int, ref UnmanagedArray, void> SaveObjects;
+    public static delegate* unmanaged<IntPtr*, int, byte*, int, NativeBool> LoadObjects;
+    public static delegate* unmanaged<IntPtr, IntPtr, ref UnmanagedArray, void> SaveStruct;
+    public static delegate* unmanaged<IntPtr, IntPtr, byte*, int, NativeBool> LoadStruct;
+}
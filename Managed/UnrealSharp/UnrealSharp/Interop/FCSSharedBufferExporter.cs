@@ -0,0 +1,11 @@
+using UnrealSharp.Binds;
+
+namespace UnrealSharp.Interop;
+
+[NativeCallbacks]
+public static unsafe partial class FCSSharedBufferExporter
+{
+    public static delegate* unmanaged<long, long*, IntPtr> AcquireSharedBuffer;
+    public static delegate* unmanaged<IntPtr, void> AddRefSharedBuffer;
+    public static delegate* unmanaged<IntPtr, void> ReleaseSharedBuffer;
+}
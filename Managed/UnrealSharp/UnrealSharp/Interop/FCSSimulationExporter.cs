@@ -0,0 +1,14 @@
+using UnrealSharp.Binds;
+using UnrealSharp.Core;
+
+namespace UnrealSharp.Interop;
+
+[NativeCallbacks]
+public static unsafe partial class FCSSimulationExporter
+{
+    public static delegate* unmanaged<IntPtr*, int, IntPtr> CreateSnapshot;
+    public static delegate* unmanaged<IntPtr, void> DestroySnapshot;
+    public static delegate* unmanaged<IntPtr, int, void> SaveState;
+    public static delegate* unmanaged<IntPtr, int, NativeBool> RestoreState;
+    public static delegate* unmanaged<IntPtr, int> GetStateSize;
+}
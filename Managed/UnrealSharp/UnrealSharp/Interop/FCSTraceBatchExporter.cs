@@ -0,0 +1,12 @@
+using UnrealSharp.Binds;
+using UnrealSharp.Core;
+using UnrealSharp.Engine;
+
+namespace UnrealSharp.Interop;
+
+[NativeCallbacks]
+public static unsafe partial class FCSTraceBatchExporter
+{
+    public static delegate* unmanaged<IntPtr, TraceRequest*, TraceResult*, int, IntPtr*, int, void> TraceBatch;
+    public static delegate* unmanaged<IntPtr, TraceRequest*, TraceResult*, int, IntPtr*, int, IntPtr, NativeBool> AsyncTraceBatch;
+}
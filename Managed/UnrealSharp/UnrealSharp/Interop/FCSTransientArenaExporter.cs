@@ -0,0 +1,11 @@
+using UnrealSharp.Binds;
+
+namespace UnrealSharp.Interop;
+
+[NativeCallbacks]
+public static unsafe partial class FCSTransientArenaExporter
+{
+    public static delegate* unmanaged<long, int, IntPtr> AllocateTransient;
+    public static delegate* unmanaged<void> PushTransientScope;
+    public static delegate* unmanaged<void> PopTransientScope;
+}
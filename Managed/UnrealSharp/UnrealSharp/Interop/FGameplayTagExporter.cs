@@ -0,0 +1,10 @@
+using UnrealSharp.Binds;
+using UnrealSharp.Core;
+
+namespace UnrealSharp.Interop;
+
+[NativeCallbacks]
+public static unsafe partial class FGameplayTagExporter
+{
+    public static delegate* unmanaged<char*, int, FName*, int, int> RequestGameplayTags;
+}
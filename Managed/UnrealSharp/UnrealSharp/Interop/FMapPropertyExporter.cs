@@ -7,4 +7,5 @@ public static unsafe partial class FMapPropertyExporter
 {
     public static delegate* unmanaged<IntPtr, IntPtr> GetKey;
     public static delegate* unmanaged<IntPtr, IntPtr> GetValue;
+    public static delegate* unmanaged<IntPtr, int> GetPairStride;
 }
\ No newline at end of file
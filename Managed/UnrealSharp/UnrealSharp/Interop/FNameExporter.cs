@@ -9,4 +9,9 @@ public static unsafe partial class FNameExporter
     public static delegate* unmanaged<FName, ref UnmanagedArray, void> NameToString;
     public static delegate* unmanaged<ref FName, char*, void> StringToName;
     public static delegate* unmanaged<FName, NativeBool> IsValid;
+    public static delegate* unmanaged<FName, char*, int, int> NameToStringBuffer;
+    public static delegate* unmanaged<ref FName, char*, int, void> StringViewToName;
+    public static delegate* unmanaged<FName*, int, char*, int, void> StringTableToNames;
+    public static delegate* unmanaged<ref FName, char*, int, NativeBool> FindName;
+    public static delegate* unmanaged<FName, char*, int, NativeBool> EqualsStringView;
 }
\ No newline at end of file
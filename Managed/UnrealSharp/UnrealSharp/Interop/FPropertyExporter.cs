@@ -14,6 +14,7 @@ public static unsafe partial class FPropertyExporter
     public static delegate* unmanaged<IntPtr, IntPtr, void> DestroyValue_InContainer;
     public static delegate* unmanaged<IntPtr, IntPtr, void> InitializeValue;
     public static delegate* unmanaged<IntPtr, string, int> GetPropertyOffsetFromName;
+    public static delegate* unmanaged<IntPtr, FPropertyLayout*, int, int> DescribeStructLayout;
     public static delegate* unmanaged<IntPtr, string, int> GetPropertyArrayDimFromName;
     public static delegate* unmanaged<IntPtr, ref UnmanagedArray, void> GetInnerFields;
     public static delegate* unmanaged<IntPtr, IntPtr, IntPtr, NativeBool> Identical;
@@ -23,5 +24,6 @@ public static unsafe partial class FPropertyExporter
     public static delegate* unmanaged<IntPtr, IntPtr, IntPtr, void> CopySingleValue;
     public static delegate* unmanaged<IntPtr, IntPtr, IntPtr, void> GetValue_InContainer;
     public static delegate* unmanaged<IntPtr, IntPtr, IntPtr, void> SetValue_InContainer;
+    public static delegate* unmanaged<IntPtr*, IntPtr, byte*, int*, int, void> SetValues_InContainer;
     public static delegate* unmanaged<IntPtr, string, byte> GetBoolPropertyFieldMaskFromName;
 }
\ No newline at end of file
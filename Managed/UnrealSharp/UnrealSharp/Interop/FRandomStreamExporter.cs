@@ -13,4 +13,7 @@ public static unsafe partial class FRandomStreamExporter
     public static delegate* unmanaged<ref FRandomStream, int, int, int> RandRange;
     public static delegate* unmanaged<ref FRandomStream, FVector, float, FVector> VRandCone;
     public static delegate* unmanaged<ref FRandomStream, FVector, float, float, FVector> VRandCone2;
+    public static delegate* unmanaged<ref FRandomStream, float*, int, void> FillRandFloats;
+    public static delegate* unmanaged<ref FRandomStream, int, int, int*, int, void> FillRandRange;
+    public static delegate* unmanaged<ref FRandomStream, FVector*, int, void> FillUnitVectors;
 }
\ No newline at end of file
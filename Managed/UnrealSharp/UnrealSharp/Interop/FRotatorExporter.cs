@@ -7,4 +7,6 @@ namespace UnrealSharp.Interop;
 public static unsafe partial class FRotatorExporter
 {
     public static delegate* unmanaged<ref FRotator, FMatrix, void> FromMatrix;
+    public static delegate* unmanaged<FRotator*, FQuat*, int, void> ToQuats;
+    public static delegate* unmanaged<FQuat*, FRotator*, int, void> FromQuats;
 }
\ No newline at end of file
@@ -9,6 +9,7 @@ public static unsafe partial class FScriptMapHelperExporter
     public static delegate* unmanaged<IntPtr, IntPtr, IntPtr, IntPtr, void> AddPair;
     public static delegate* unmanaged<IntPtr, IntPtr, IntPtr, IntPtr> FindOrAdd;
     public static delegate* unmanaged<IntPtr, IntPtr, IntPtr, int> FindMapPairIndexFromHash;
+    public static delegate* unmanaged<IntPtr, IntPtr, IntPtr, uint, int> FindMapPairIndexWithHash;
     public static delegate* unmanaged<IntPtr, IntPtr, int> Num;
     public static delegate* unmanaged<IntPtr, IntPtr, void> EmptyValues;
     public static delegate* unmanaged<IntPtr, IntPtr, IntPtr, void> Remove;
@@ -16,4 +17,7 @@ public static unsafe partial class FScriptMapHelperExporter
     public static delegate* unmanaged<IntPtr, IntPtr, int, NativeBool> IsValidIndex;
     public static delegate* unmanaged<IntPtr, IntPtr, int> GetMaxIndex;
     public static delegate* unmanaged<IntPtr, IntPtr, int, IntPtr> GetPairPtr;
+    public static delegate* unmanaged<IntPtr, IntPtr, IntPtr*, int, int> GetPairPtrs;
+    public static delegate* unmanaged<IntPtr, IntPtr, IntPtr, IntPtr, int, void> AddPairs;
+    public static delegate* unmanaged<IntPtr, IntPtr, IntPtr, int, int> RemoveKeys;
 }
\ No newline at end of file
@@ -1,4 +1,5 @@
-﻿using UnrealSharp.Binds;
+﻿using System.Runtime.InteropServices;
+using UnrealSharp.Binds;
 using UnrealSharp.Core;
 
 namespace UnrealSharp.Interop;
@@ -16,4 +17,23 @@ public static unsafe partial class FScriptSetExporter
     public static delegate* unmanaged<IntPtr, IntPtr, IntPtr, HashDelegates.GetKeyHash, HashDelegates.Equality, int> FindIndex;
     public static delegate* unmanaged<IntPtr, IntPtr, IntPtr, HashDelegates.GetKeyHash, HashDelegates.Equality, HashDelegates.Construct, HashDelegates.Destruct, void> Add;
     public static delegate* unmanaged<IntPtr, IntPtr, IntPtr, HashDelegates.GetKeyHash, HashDelegates.Equality, HashDelegates.Construct, int> FindOrAdd;
+    public static delegate* unmanaged<IntPtr, IntPtr, IntPtr, uint, int> FindIndexWithHash;
+    public static delegate* unmanaged<IntPtr, IntPtr, IntPtr*, int, int> GetElementPtrs;
+    public static delegate* unmanaged<IntPtr, IntPtr, IntPtr, int, void> AddElements;
+    public static delegate* unmanaged<IntPtr, IntPtr, IntPtr, int, int> RemoveElements;
+    public static delegate* unmanaged<FSparseArrayLayout*, void> GetSparseArrayLayout;
+}
+
+/// <summary>
+/// Offsets of the fields of a FScriptSet in the running engine. Mirrors FCSSparseArrayLayout.
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+public struct FSparseArrayLayout
+{
+    public int DataOffset;
+    public int MaxIndexOffset;
+    public int NumFreeIndicesOffset;
+    public int InlineAllocationFlagsOffset;
+    public int SecondaryAllocationFlagsOffset;
+    public int IsValid;
 }
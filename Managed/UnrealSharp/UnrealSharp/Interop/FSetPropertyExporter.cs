@@ -6,4 +6,5 @@ namespace UnrealSharp.Interop;
 public static unsafe partial class FSetPropertyExporter
 {
     public static delegate* unmanaged<IntPtr, IntPtr> GetElement;
+    public static delegate* unmanaged<IntPtr, int> GetElementStride;
 }
\ No newline at end of file
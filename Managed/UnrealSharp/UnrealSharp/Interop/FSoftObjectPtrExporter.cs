@@ -1,4 +1,5 @@
 using UnrealSharp.Binds;
+using UnrealSharp.Core;
 using UnrealSharp.EnhancedInput;
 
 namespace UnrealSharp.Interop;
@@ -7,4 +8,5 @@ namespace UnrealSharp.Interop;
 public static unsafe partial class FSoftObjectPtrExporter
 {
     public static delegate* unmanaged<ref FPersistentObjectPtrData<FSoftObjectPathUnsafe>, IntPtr> LoadSynchronous;
+    public static delegate* unmanaged<ref FPersistentObjectPtrData<FSoftObjectPathUnsafe>, NativeBool> ShouldWarnOnBlockingLoad;
 }
\ No newline at end of file
@@ -6,7 +6,9 @@ namespace UnrealSharp.Interop;
 public static unsafe partial class FTextExporter
 {
     public static delegate* unmanaged<ref FTextData, char*> ToString;
+    public static delegate* unmanaged<ref FTextData, out int, char*> ToStringView;
     public static delegate* unmanaged<ref FTextData, string, void> FromString;
+    public static delegate* unmanaged<ref FTextData, char*, int, void> FromStringView;
     public static delegate* unmanaged<ref FTextData, FName, void> FromName;
     public static delegate* unmanaged<ref FTextData, void> CreateEmptyText;
 }
\ No newline at end of file
@@ -0,0 +1,12 @@
+using UnrealSharp.Binds;
+using UnrealSharp.CoreUObject;
+
+namespace UnrealSharp.Interop;
+
+[NativeCallbacks]
+public static unsafe partial class FTransformExporter
+{
+    public static delegate* unmanaged<FTransform*, FTransform*, FTransform*, int, void> ComposeTransforms;
+    public static delegate* unmanaged<ref FTransform, FVector*, FVector*, int, void> TransformPositions;
+    public static delegate* unmanaged<ref FTransform, FVector*, FVector*, int, void> InverseTransformPositions;
+}
@@ -7,4 +7,5 @@ namespace UnrealSharp.Interop;
 public unsafe partial class FVectorExporter
 {
     public static delegate* unmanaged<FRotator, FVector> FromRotator;
+    public static delegate* unmanaged<FRotator*, FVector*, int, void> FromRotators;
 }
\ No newline at end of file
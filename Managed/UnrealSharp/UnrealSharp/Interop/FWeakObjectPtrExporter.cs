@@ -11,4 +11,5 @@ public static unsafe partial class FWeakObjectPtrExporter
     public static delegate* unmanaged<WeakObjectData, NativeBool> IsValid;
     public static delegate* unmanaged<WeakObjectData, NativeBool> IsStale;
     public static delegate* unmanaged<WeakObjectData, WeakObjectData, NativeBool> NativeEquals;
+    public static delegate* unmanaged<FObjectArrayLayout*> GetObjectArrayLayout;
 }
\ No newline at end of file
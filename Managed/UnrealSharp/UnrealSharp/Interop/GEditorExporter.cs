@@ -3,6 +3,8 @@ using UnrealSharp.Binds;
 
 namespace UnrealSharp.Interop;
 
+#if WITH_EDITOR
+// Only registered natively in editor builds.
 [NativeCallbacks]
 public static unsafe partial class GEditorExporter
 {
@@ -12,4 +14,5 @@ public static unsafe partial class GEditorExporter
     {
         GetEditorSubsystem = (delegate* unmanaged<IntPtr, IntPtr>)test;
     }
-}
\ No newline at end of file
+}
+#endif
\ No newline at end of file
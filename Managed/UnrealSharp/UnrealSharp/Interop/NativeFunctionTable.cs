@@ -0,0 +1,64 @@
+using System.Text;
+
+namespace UnrealSharp.Interop;
+
+/// <summary>
+/// The UFunctions of a class, resolved in one native call. The static constructors of the generated classes
+/// fetch their functions through this instead of one name lookup per function.
+/// </summary>
+public sealed unsafe class NativeFunctionTable
+{
+    private readonly IntPtr _nativeClass;
+    private readonly Dictionary<string, IntPtr> _functions;
+
+    private NativeFunctionTable(IntPtr nativeClass, string[] functionNames)
+    {
+        _nativeClass = nativeClass;
+        _functions = new Dictionary<string, IntPtr>(functionNames.Length);
+
+        int packedLength = 0;
+        foreach (string functionName in functionNames)
+        {
+            packedLength += Encoding.UTF8.GetByteCount(functionName) + 1;
+        }
+
+        byte[] packedNames = new byte[packedLength];
+        int offset = 0;
+        foreach (string functionName in functionNames)
+        {
+            offset += Encoding.UTF8.GetBytes(functionName, 0, functionName.Length, packedNames, offset);
+            packedNames[offset++] = 0;
+        }
+
+        IntPtr[] functions = new IntPtr[functionNames.Length];
+        fixed (byte* packedNamesPtr = packedNames)
+        fixed (IntPtr* functionsPtr = functions)
+        {
+            UClassExporter.CallGetNativeFunctionsFromClassAndNames(nativeClass, packedNamesPtr, functionNames.Length, functionsPtr);
+        }
+
+        for (int i = 0; i < functionNames.Length; i++)
+        {
+            _functions[functionNames[i]] = functions[i];
+        }
+    }
+
+    public static NativeFunctionTable Resolve(IntPtr nativeClass, params string[] functionNames)
+    {
+        return new NativeFunctionTable(nativeClass, functionNames);
+    }
+
+    /// <summary>
+    /// Gets a function of the table. Names that weren't resolved, or that the class doesn't have, go through the
+    /// single lookup, which warns about missing functions.
+    /// </summary>
+    public IntPtr Get(string functionName)
+    {
+        if (_functions.TryGetValue(functionName, out IntPtr function) && function != IntPtr.Zero)
+        {
+            return function;
+        }
+
+        return UClassExporter.CallGetNativeFunctionFromClassAndName(_nativeClass, functionName);
+    }
+}
@@ -0,0 +1,113 @@
+using System.Runtime.InteropServices;
+
+namespace UnrealSharp.Interop;
+
+/// <summary>
+/// One property of a struct, as FPropertyExporter.DescribeStructLayout reports it. Mirrors FCSPropertyLayout.
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+public struct FPropertyLayout
+{
+    public IntPtr Property;
+    public ulong PropertyFlags;
+    public uint NameHash;
+    public int Offset;
+    public int Size;
+    public int ArrayDim;
+}
+
+/// <summary>
+/// The properties of a struct, class or function, fetched in one native call. The static constructors of the
+/// generated types resolve their properties through this instead of one name lookup per property.
+/// </summary>
+public sealed unsafe class NativeStructLayout
+{
+    private const int InitialCapacity = 64;
+    
+    private readonly IntPtr _nativeStruct;
+    private readonly Dictionary<uint, FPropertyLayout> _properties;
+    
+    // Hashes shared by more than one property, those fall back to a name lookup.
+    private HashSet<uint>? _collisions;
+
+    private NativeStructLayout(IntPtr nativeStruct)
+    {
+        _nativeStruct = nativeStruct;
+
+        FPropertyLayout* layouts = stackalloc FPropertyLayout[InitialCapacity];
+        int numProperties = FPropertyExporter.CallDescribeStructLayout(nativeStruct, layouts, InitialCapacity);
+        
+        if (numProperties > InitialCapacity)
+        {
+            FPropertyLayout[] allLayouts = new FPropertyLayout[numProperties];
+            fixed (FPropertyLayout* allLayoutsPtr = allLayouts)
+            {
+                FPropertyExporter.CallDescribeStructLayout(nativeStruct, allLayoutsPtr, numProperties);
+                _properties = ToDictionary(allLayoutsPtr, numProperties);
+            }
+        }
+        else
+        {
+            _properties = ToDictionary(layouts, numProperties);
+        }
+    }
+
+    public static NativeStructLayout Describe(IntPtr nativeStruct)
+    {
+        return new NativeStructLayout(nativeStruct);
+    }
+
+    public IntPtr GetProperty(string name)
+    {
+        return TryFind(name, out FPropertyLayout layout) ? layout.Property : FPropertyExporter.CallGetNativePropertyFromName(_nativeStruct, name);
+    }
+
+    public int GetOffset(string name)
+    {
+        return TryFind(name, out FPropertyLayout layout) ? layout.Offset : FPropertyExporter.CallGetPropertyOffsetFromName(_nativeStruct, name);
+    }
+
+    public int GetArrayDim(string name)
+    {
+        return TryFind(name, out FPropertyLayout layout) ? layout.ArrayDim : FPropertyExporter.CallGetPropertyArrayDimFromName(_nativeStruct, name);
+    }
+
+    private bool TryFind(string name, out FPropertyLayout layout)
+    {
+        uint hash = HashName(name);
+        if (_collisions != null && _collisions.Contains(hash))
+        {
+            layout = default;
+            return false;
+        }
+        
+        return _properties.TryGetValue(hash, out layout);
+    }
+
+    private Dictionary<uint, FPropertyLayout> ToDictionary(FPropertyLayout* layouts, int numProperties)
+    {
+        Dictionary<uint, FPropertyLayout> properties = new(numProperties);
+        for (int i = 0; i < numProperties; i++)
+        {
+            // Most derived first, a property hiding one of its super struct wins like it does in FindFProperty.
+            if (!properties.TryAdd(layouts[i].NameHash, layouts[i]) && properties[layouts[i].NameHash].Property != layouts[i].Property)
+            {
+                _collisions ??= new HashSet<uint>();
+                _collisions.Add(layouts[i].NameHash);
+            }
+        }
+        
+        return properties;
+    }
+
+    private static uint HashName(string name)
+    {
+        uint hash = 2166136261u;
+        foreach (char character in name)
+        {
+            hash = (hash ^ character) * 16777619u;
+        }
+        
+        return hash;
+    }
+}
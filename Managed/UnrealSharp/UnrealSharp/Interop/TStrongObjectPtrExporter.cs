@@ -7,4 +7,7 @@ public static unsafe partial class TStrongObjectPtrExporter
 {
     public static delegate* unmanaged<ref FStrongObjectPtr, IntPtr, void> ConstructStrongObjectPtr;
     public static delegate* unmanaged<ref FStrongObjectPtr, void> DestroyStrongObjectPtr;
+    public static delegate* unmanaged<IntPtr, int> AddRoot;
+    public static delegate* unmanaged<int, void> RemoveRoot;
+    public static delegate* unmanaged<int, IntPtr> GetRootManagedObject;
 }
\ No newline at end of file
@@ -1,4 +1,5 @@
 ﻿using UnrealSharp.Binds;
+using UnrealSharp.Core;
 
 namespace UnrealSharp.Interop;
 
@@ -6,4 +7,5 @@ namespace UnrealSharp.Interop;
 public static unsafe partial class UAssetManagerExporter
 {
     public static delegate* unmanaged<IntPtr> GetAssetManager;
+    public static delegate* unmanaged<ulong, out FName, out FName, NativeBool> FindPrimaryAssetIdByHash;
 }
\ No newline at end of file
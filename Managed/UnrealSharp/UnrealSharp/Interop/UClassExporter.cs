@@ -6,6 +6,7 @@ namespace UnrealSharp.Interop;
 public static unsafe partial class UClassExporter
 {
     public static delegate* unmanaged<IntPtr, string, IntPtr> GetNativeFunctionFromClassAndName;
+    public static delegate* unmanaged<IntPtr, byte*, int, IntPtr*, void> GetNativeFunctionsFromClassAndNames;
     public static delegate* unmanaged<IntPtr, string, IntPtr> GetNativeFunctionFromInstanceAndName;
     public static delegate* unmanaged<string, string, string, IntPtr> GetDefaultFromName;
     public static delegate* unmanaged<IntPtr, IntPtr> GetDefaultFromInstance;
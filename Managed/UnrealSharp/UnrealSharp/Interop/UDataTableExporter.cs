@@ -1,9 +1,28 @@
+using System.Runtime.InteropServices;
 using UnrealSharp.Binds;
 
 namespace UnrealSharp.Interop;
 
+[StructLayout(LayoutKind.Sequential)]
+public struct DataTableRowEntry
+{
+    public FName RowName;
+    public IntPtr RowData;
+}
+
+[StructLayout(LayoutKind.Sequential)]
+public unsafe struct NativeDataTableRows
+{
+    public DataTableRowEntry* Rows;
+    public int* SortedIndices;
+    public int NumRows;
+    public uint Version;
+}
+
 [NativeCallbacks]
 public static unsafe partial class UDataTableExporter
 {
     public static delegate* unmanaged<IntPtr, FName, IntPtr> GetRow;
-}
\ No newline at end of file
+    public static delegate* unmanaged<IntPtr, IntPtr, void> GetRows;
+    public static delegate* unmanaged<IntPtr, uint> GetRowsVersion;
+}
@@ -7,5 +7,6 @@ namespace UnrealSharp.Interop;
 public static unsafe partial class UEnhancedInputComponentExporter
 {
     public static delegate* unmanaged<IntPtr, IntPtr, ETriggerEvent, IntPtr, FName, IntPtr, bool> BindAction;
+    public static delegate* unmanaged<IntPtr, IntPtr, ETriggerEvent, IntPtr, FName, IntPtr, IntPtr, IntPtr, IntPtr, bool> BindActionCallback;
     public static delegate* unmanaged<IntPtr, uint, bool> RemoveBindingByHandle;
 }
\ No newline at end of file
@@ -10,6 +10,7 @@ public static unsafe partial class UFunctionExporter
     public static delegate* unmanaged<IntPtr, IntPtr, IntPtr, IntPtr> CreateNativeFunctionCustomStructSpecialization;
     public static delegate* unmanaged<IntPtr, IntPtr, void> InitializeFunctionParams;
     public static delegate* unmanaged<IntPtr, NativeBool> HasBlueprintEventBeenImplemented;
+    public static delegate* unmanaged<IntPtr, IntPtr> GetNativeFunctionInvocation;
     
     public static bool IsFunctionImplemented(IntPtr function)
     {
@@ -13,7 +13,9 @@ public static unsafe partial class UObjectExporter
     public static delegate* unmanaged<IntPtr, IntPtr, IntPtr, IntPtr, void> InvokeNativeStaticFunction;
     public static delegate* unmanaged<IntPtr, IntPtr, IntPtr, IntPtr, void> InvokeNativeFunctionOutParms;
     public static delegate* unmanaged<IntPtr, IntPtr, IntPtr, IntPtr, void> InvokeNativeNetFunction;
+    public static delegate* unmanaged<IntPtr, IntPtr, IntPtr, IntPtr, void> InvokeNativeFunctionWithInvocation;
     public static delegate* unmanaged<IntPtr, NativeBool> NativeIsValid;
     public static delegate* unmanaged<IntPtr, IntPtr> GetWorld_Internal;
     public static delegate* unmanaged<IntPtr, int> GetUniqueID;
+    public static delegate* unmanaged<IntPtr, IntPtr, void> MarkPropertyDirty;
 }
\ No newline at end of file
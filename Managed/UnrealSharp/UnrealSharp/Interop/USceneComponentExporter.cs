@@ -0,0 +1,10 @@
+using UnrealSharp.Binds;
+
+namespace UnrealSharp.Interop;
+
+[NativeCallbacks]
+public static unsafe partial class USceneComponentExporter
+{
+    public static delegate* unmanaged<IntPtr, IntPtr, void> K2_GetComponentLocation;
+    public static delegate* unmanaged<IntPtr, IntPtr, void> K2_GetComponentToWorld;
+}
\ No newline at end of file
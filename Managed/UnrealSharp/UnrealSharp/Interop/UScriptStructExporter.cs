@@ -16,4 +16,10 @@ public static unsafe partial class UScriptStructExporter
     public static delegate* unmanaged<ref NativeStructHandleData, IntPtr, void> DeallocateNativeStruct;
     
     public static delegate* unmanaged<NativeStructHandleData*, IntPtr, IntPtr> GetStructLocation;
+
+    public static delegate* unmanaged<IntPtr, IntPtr, int, void> InitializeStructArray;
+
+    public static delegate* unmanaged<IntPtr, IntPtr, IntPtr, int, void> CopyStructArray;
+
+    public static delegate* unmanaged<IntPtr, IntPtr, int, void> DestroyStructArray;
 }
\ No newline at end of file
@@ -9,6 +9,7 @@ namespace UnrealSharp.Interop;
 public static unsafe partial class UWorldExporter
 {
     public static delegate* unmanaged<IntPtr, FName, float, NativeBool, float, FTimerHandle*, void> SetTimer;
+    public static delegate* unmanaged<IntPtr, IntPtr, float, NativeBool, float, FTimerHandle*, void> SetManagedTimer;
     public static delegate* unmanaged<IntPtr, FTimerHandle*, void> InvalidateTimer;
     public static delegate* unmanaged<IntPtr, IntPtr, IntPtr> GetWorldSubsystem;
     public static delegate* unmanaged<IntPtr, IntPtr> GetNetMode;
@@ -0,0 +1,217 @@
+using System.Runtime.CompilerServices;
+using System.Runtime.ExceptionServices;
+using System.Runtime.InteropServices;
+using UnrealSharp.Core;
+using UnrealSharp.Interop;
+
+namespace UnrealSharp;
+
+/// <summary>
+/// Priority of a job on the task system's workers, same values as UE::Tasks::ETaskPriority.
+/// </summary>
+public enum JobPriority
+{
+    High,
+    Normal,
+    BackgroundHigh,
+    BackgroundNormal,
+    BackgroundLow,
+}
+
+/// <summary>
+/// A job launched through <see cref="ManagedJobs"/>. Can be waited on and passed as a prerequisite of other jobs.
+/// Dispose once it's no longer needed, disposing doesn't cancel the job. Jobs that are never disposed are released by the finalizer.
+/// </summary>
+public sealed class ManagedJob : IDisposable
+{
+    private IntPtr _nativeJob;
+
+    internal ManagedJob(IntPtr nativeJob)
+    {
+        _nativeJob = nativeJob;
+    }
+
+    ~ManagedJob()
+    {
+        Release();
+    }
+
+    public bool IsValid => _nativeJob != IntPtr.Zero;
+    public bool IsCompleted => FCSManagedJobsExporter.CallIsJobCompleted(NativeJob).ToManagedBool();
+
+    internal IntPtr NativeJob
+    {
+        get
+        {
+            ObjectDisposedException.ThrowIf(_nativeJob == IntPtr.Zero, this);
+            return _nativeJob;
+        }
+    }
+
+    public void Wait()
+    {
+        FCSManagedJobsExporter.CallWaitForJob(NativeJob);
+    }
+
+    public void Dispose()
+    {
+        Release();
+        GC.SuppressFinalize(this);
+    }
+
+    private void Release()
+    {
+        // Only the first of concurrent or repeated calls gets the job.
+        IntPtr nativeJob = Interlocked.Exchange(ref _nativeJob, IntPtr.Zero);
+        if (nativeJob != IntPtr.Zero)
+        {
+            FCSManagedJobsExporter.CallReleaseJob(nativeJob);
+        }
+    }
+}
+
+/// <summary>
+/// Runs C# work on Unreal's task system workers instead of the game thread.
+/// Jobs must not touch UObjects that the game thread may be changing at the same time.
+/// </summary>
+public static unsafe class ManagedJobs
+{
+    private sealed class ParallelForState(Action<int, int> body)
+    {
+        public readonly Action<int, int> Body = body;
+        public Exception? Exception;
+    }
+
+    public static ManagedJob Launch(Action work, JobPriority priority = JobPriority.Normal, params ReadOnlySpan<ManagedJob> prerequisites)
+    {
+        ManagedJob[] jobs = new ManagedJob[1];
+        LaunchBatch([work], jobs, priority, prerequisites);
+        return jobs[0];
+    }
+
+    /// <summary>
+    /// Launches a job per work item in a single call into native code. <paramref name="outJobs"/> gets a job per work item.
+    /// </summary>
+    public static void LaunchBatch(ReadOnlySpan<Action> work, Span<ManagedJob> outJobs, JobPriority priority = JobPriority.Normal, params ReadOnlySpan<ManagedJob> prerequisites)
+    {
+        if (outJobs.Length < work.Length)
+        {
+            throw new ArgumentException("Needs room for a job per work item.", nameof(outJobs));
+        }
+
+        if (work.IsEmpty)
+        {
+            return;
+        }
+
+        Span<IntPtr> nativePrerequisites = prerequisites.Length <= 64 ? stackalloc IntPtr[prerequisites.Length] : new IntPtr[prerequisites.Length];
+        for (int i = 0; i < prerequisites.Length; i++)
+        {
+            nativePrerequisites[i] = prerequisites[i].NativeJob;
+        }
+
+        Span<IntPtr> states = work.Length <= 64 ? stackalloc IntPtr[work.Length] : new IntPtr[work.Length];
+        for (int i = 0; i < work.Length; i++)
+        {
+            states[i] = GCHandle.ToIntPtr(GCHandle.Alloc(work[i]));
+        }
+
+        Span<IntPtr> nativeJobs = work.Length <= 64 ? stackalloc IntPtr[work.Length] : new IntPtr[work.Length];
+
+        fixed (IntPtr* statesPtr = states)
+        fixed (IntPtr* prerequisitesPtr = nativePrerequisites)
+        fixed (IntPtr* nativeJobsPtr = nativeJobs)
+        {
+            FCSManagedJobsExporter.CallLaunchJobs((IntPtr) (delegate* unmanaged<IntPtr, int, int, void>) &RunJob,
+                statesPtr, work.Length, (int) priority,
+                prerequisitesPtr, prerequisites.Length,
+                nativeJobsPtr);
+        }
+
+        // The prerequisites must not be released by their finalizer while the native side still reads them.
+        for (int i = 0; i < prerequisites.Length; i++)
+        {
+            GC.KeepAlive(prerequisites[i]);
+        }
+
+        for (int i = 0; i < work.Length; i++)
+        {
+            outJobs[i] = new ManagedJob(nativeJobs[i]);
+        }
+    }
+
+    /// <summary>
+    /// Calls <paramref name="body"/> with consecutive ranges [start, end) that together cover [0, count), spread across the workers.
+    /// Returns once every range is done. The first exception thrown by the body is rethrown here.
+    /// </summary>
+    public static void ParallelFor(int count, Action<int, int> body, int minBatchSize = 64)
+    {
+        if (count <= 0)
+        {
+            return;
+        }
+
+        ParallelForState state = new ParallelForState(body);
+        GCHandle stateHandle = GCHandle.Alloc(state);
+
+        try
+        {
+            FCSManagedJobsExporter.CallParallelFor((IntPtr) (delegate* unmanaged<IntPtr, int, int, void>) &RunRange,
+                GCHandle.ToIntPtr(stateHandle), count, minBatchSize);
+        }
+        finally
+        {
+            stateHandle.Free();
+        }
+
+        if (state.Exception != null)
+        {
+            ExceptionDispatchInfo.Throw(state.Exception);
+        }
+    }
+
+    public static void ParallelFor(int count, Action<int> body, int minBatchSize = 64)
+    {
+        ParallelFor(count, (start, end) =>
+        {
+            for (int i = start; i < end; i++)
+            {
+                body(i);
+            }
+        }, minBatchSize);
+    }
+
+    [UnmanagedCallersOnly]
+    private static void RunJob(IntPtr state, int start, int end)
+    {
+        GCHandle handle = GCHandle.FromIntPtr(state);
+
+        try
+        {
+            Unsafe.As<Action>(handle.Target!)();
+        }
+        catch (Exception exception)
+        {
+            LogUnrealSharp.LogError($"Managed job threw an exception: {exception}");
+        }
+        finally
+        {
+            handle.Free();
+        }
+    }
+
+    [UnmanagedCallersOnly]
+    private static void RunRange(IntPtr state, int start, int end)
+    {
+        ParallelForState parallelForState = Unsafe.As<ParallelForState>(GCHandle.FromIntPtr(state).Target!);
+
+        try
+        {
+            parallelForState.Body(start, end);
+        }
+        catch (Exception exception)
+        {
+            Interlocked.CompareExchange(ref parallelForState.Exception, exception, null);
+        }
+    }
+}
@@ -52,6 +52,25 @@ public class TMap<TKey, TValue> : MapBase<TKey, TValue>, IDictionary<TKey, TValu
     {
         ClearInternal();
     }
+    
+    /// <summary>
+    /// Adds all pairs in a single native call. Existing keys get their value replaced.
+    /// </summary>
+    /// <param name="pairs"> The pairs to add. </param>
+    public void AddRange(ReadOnlySpan<KeyValuePair<TKey, TValue>> pairs)
+    {
+        AddRangeInternal(pairs);
+    }
+    
+    /// <summary>
+    /// Removes all keys in a single native call.
+    /// </summary>
+    /// <param name="keys"> The keys to remove. </param>
+    /// <returns> The number of keys that were in the map. </returns>
+    public int RemoveRange(ReadOnlySpan<TKey> keys)
+    {
+        return RemoveRangeInternal(keys);
+    }
 
     /// <inheritdoc />
     public bool Contains(KeyValuePair<TKey, TValue> item)
@@ -62,14 +81,10 @@ public class TMap<TKey, TValue> : MapBase<TKey, TValue>, IDictionary<TKey, TValu
     /// <inheritdoc />
     public void CopyTo(KeyValuePair<TKey, TValue>[] array, int arrayIndex)
     {
-        int maxIndex = GetMaxIndex();
         int index = arrayIndex;
-        for (int i = 0; i < maxIndex; ++i)
+        foreach (KeyValuePair<TKey, TValue> pair in this)
         {
-            if (IsValidIndex(i))
-            {
-                array[index++] = GetAt(i);
-            }
+            array[index++] = pair;
         }
     }
 
@@ -51,10 +51,53 @@ public unsafe class MapBase<TKey, TValue> : IEnumerable<KeyValuePair<TKey, TValu
         return _helper.GetPairPtr(index, out keyPtr, out valuePtr);
     }
 
+    /// <summary>
+    /// Fetches the pointers of all pairs in a single native call.
+    /// The buffer is rented from the shared pool and must be disposed.
+    /// </summary>
+    internal PooledPointerBuffer RentPairPtrs()
+    {
+        PooledPointerBuffer pairPtrs = new PooledPointerBuffer(Count);
+        IntPtr[] pointers = pairPtrs.Pointers;
+        fixed (IntPtr* pairPtrsPtr = pointers)
+        {
+            pairPtrs.Count = Math.Min(_helper.GetPairPtrs(pairPtrsPtr, pointers.Length), pointers.Length);
+        }
+        return pairPtrs;
+    }
+    
+    internal KeyValuePair<TKey, TValue> GetPairFromPtr(IntPtr pairPtr)
+    {
+        _helper.KeyValueFromPairPtr(pairPtr, out IntPtr keyPtr, out IntPtr valuePtr);
+        return new KeyValuePair<TKey, TValue>(_keyFromNative(keyPtr, 0), _valueFromNative(valuePtr, 0));
+    }
+    
+    internal TKey GetKeyFromPairPtr(IntPtr pairPtr)
+    {
+        _helper.KeyValueFromPairPtr(pairPtr, out IntPtr keyPtr, out _);
+        return _keyFromNative(keyPtr, 0);
+    }
+    
+    internal TValue GetValueFromPairPtr(IntPtr pairPtr)
+    {
+        _helper.KeyValueFromPairPtr(pairPtr, out _, out IntPtr valuePtr);
+        return _valueFromNative(valuePtr, 0);
+    }
+
     protected void ClearInternal()
     {
         _helper.EmptyValues();
     }
+    
+    protected void AddRangeInternal(ReadOnlySpan<KeyValuePair<TKey, TValue>> pairs)
+    {
+        _helper.AddPairs(pairs, _keyToNative, _valueToNative);
+    }
+    
+    protected int RemoveRangeInternal(ReadOnlySpan<TKey> keys)
+    {
+        return _helper.RemoveKeys(keys, _keyToNative);
+    }
 
     protected void AddInternal(TKey key, TValue value)
     {
@@ -130,10 +173,9 @@ public unsafe class MapBase<TKey, TValue> : IEnumerable<KeyValuePair<TKey, TValu
     public bool ContainsValue(TValue value)
     {
         EqualityComparer<TValue> comparer = EqualityComparer<TValue>.Default;
-        int maxIndex = GetMaxIndex();
-        for (int i = 0; i < maxIndex; ++i)
+        foreach (TValue element in new ValueCollection(this))
         {
-            if (IsValidIndex(i) && comparer.Equals(GetAt(i).Value, value))
+            if (comparer.Equals(element, value))
             {
                 return true;
             }
@@ -154,7 +196,9 @@ public unsafe class MapBase<TKey, TValue> : IEnumerable<KeyValuePair<TKey, TValu
         _keyProperty.InitializeValue(keyPtr);
         _keyToNative(keyPtr, 0, value);
         
-        int index = FScriptMapHelperExporter.CallFindMapPairIndexFromHash(_nativeProperty.Property, _helper.MapAddress, keyPtr);
+        int index = TypeHash<TKey>.TryGetHash(value, keyPtr, _keyProperty, out uint keyHash)
+            ? FScriptMapHelperExporter.CallFindMapPairIndexWithHash(_nativeProperty.Property, _helper.MapAddress, keyPtr, keyHash)
+            : FScriptMapHelperExporter.CallFindMapPairIndexFromHash(_nativeProperty.Property, _helper.MapAddress, keyPtr);
         
         _keyProperty.DestroyValue(keyPtr);
         return index;
@@ -178,28 +222,35 @@ public unsafe class MapBase<TKey, TValue> : IEnumerable<KeyValuePair<TKey, TValu
     /// <inheritdoc />
     public struct Enumerator(MapBase<TKey, TValue> map) : IEnumerator<KeyValuePair<TKey, TValue>>
     {
+        // Shared by copies of the enumerator, so only one of them returns it to the pool.
+        private PooledPointerBuffer? _pairPtrs;
         private int index = -1;
 
-        public KeyValuePair<TKey, TValue> Current => map.GetAt(index);
+        public KeyValuePair<TKey, TValue> Current => map.GetPairFromPtr(CurrentPairPtr);
+        
+        internal IntPtr CurrentPairPtr => _pairPtrs!.Pointers[index];
 
         object IEnumerator.Current => Current;
 
         /// <inheritdoc />
         public void Dispose()
         {
+            _pairPtrs?.Dispose();
+            _pairPtrs = null;
         }
 
         /// <inheritdoc />
         public bool MoveNext()
         {
-            int maxIndex = map.GetMaxIndex();
-            while (++index < maxIndex && !map.IsValidIndex(index)) { }
-            return index < maxIndex;
+            // Fetch every pair up front, so stepping through the map doesn't cross into native code per slot.
+            _pairPtrs ??= map.RentPairPtrs();
+            return ++index < _pairPtrs.Count;
         }
 
         /// <inheritdoc />
         public void Reset()
         {
+            Dispose();
             index = -1;
         }
     }
@@ -234,14 +285,10 @@ public unsafe class MapBase<TKey, TValue> : IEnumerable<KeyValuePair<TKey, TValu
 
         public void CopyTo(TKey[] array, int arrayIndex)
         {
-            int maxIndex = map.GetMaxIndex();
             int index = arrayIndex;
-            for (int i = 0; i < maxIndex; ++i)
+            foreach (TKey key in this)
             {
-                if (map.IsValidIndex(i))
-                {
-                    array[index++] = map.GetAt(i).Key;
-                }
+                array[index++] = key;
             }
         }
 
@@ -267,7 +314,7 @@ public unsafe class MapBase<TKey, TValue> : IEnumerable<KeyValuePair<TKey, TValu
 
         public struct Enumerator : IEnumerator<TKey>
         {
-            private int index;
+            private MapBase<TKey, TValue>.Enumerator pairs;
             private MapBase<TKey, TValue> map;
 
             public int Count => map.Count;
@@ -275,27 +322,25 @@ public unsafe class MapBase<TKey, TValue> : IEnumerable<KeyValuePair<TKey, TValu
             public Enumerator(MapBase<TKey, TValue> map)
             {
                 this.map = map;
-                index = -1;
+                pairs = new MapBase<TKey, TValue>.Enumerator(map);
             }
 
-            public TKey Current => map.GetAt(index).Key;
+            public TKey Current => map.GetKeyFromPairPtr(pairs.CurrentPairPtr);
             object IEnumerator.Current => Current;
 
             public void Dispose()
             {
-                
+                pairs.Dispose();
             }
 
             public bool MoveNext()
             {
-                int maxIndex = map.GetMaxIndex();
-                while (++index < maxIndex && !map.IsValidIndex(index)) { }
-                return index < maxIndex;
+                return pairs.MoveNext();
             }
 
             public void Reset()
             {
-                index = -1;
+                pairs.Reset();
             }
         }
     }
@@ -330,14 +375,10 @@ public unsafe class MapBase<TKey, TValue> : IEnumerable<KeyValuePair<TKey, TValu
 
         public void CopyTo(TValue[] array, int arrayIndex)
         {
-            int maxIndex = map.GetMaxIndex();
             int index = arrayIndex;
-            for (int i = 0; i < maxIndex; ++i)
+            foreach (TValue value in this)
             {
-                if (map.IsValidIndex(i))
-                {
-                    array[index++] = map.GetAt(i).Value;
-                }
+                array[index++] = value;
             }
         }
 
@@ -363,7 +404,7 @@ public unsafe class MapBase<TKey, TValue> : IEnumerable<KeyValuePair<TKey, TValu
 
         public struct Enumerator : IEnumerator<TValue>
         {
-            private int index;
+            private MapBase<TKey, TValue>.Enumerator pairs;
             private MapBase<TKey, TValue> map;
 
             public int Count => map.Count;
@@ -371,27 +412,26 @@ public unsafe class MapBase<TKey, TValue> : IEnumerable<KeyValuePair<TKey, TValu
             public Enumerator(MapBase<TKey, TValue> map)
             {
                 this.map = map;
-                index = -1;
+                pairs = new MapBase<TKey, TValue>.Enumerator(map);
             }
 
-            public TValue Current => map.GetAt(index).Value;
+            public TValue Current => map.GetValueFromPairPtr(pairs.CurrentPairPtr);
 
             object? IEnumerator.Current => Current;
 
             public void Dispose()
             {
+                pairs.Dispose();
             }
 
             public bool MoveNext()
             {
-                int maxIndex = map.GetMaxIndex();
-                while (++index < maxIndex && !map.IsValidIndex(index)) { }
-                return index < maxIndex;
+                return pairs.MoveNext();
             }
 
             public void Reset()
             {
-                index = -1;
+                pairs.Reset();
             }
         }
     }
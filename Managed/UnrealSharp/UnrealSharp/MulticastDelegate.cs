@@ -1,4 +1,5 @@
-﻿using UnrealSharp.Attributes;
+﻿using System.Collections.Concurrent;
+using UnrealSharp.Attributes;
 using UnrealSharp.Core;
 using UnrealSharp.Core.Attributes;
 using UnrealSharp.CoreUObject;
@@ -12,6 +13,14 @@ public abstract class MulticastDelegate<TDelegate> : DelegateBase<TDelegate> whe
     protected IntPtr NativeProperty;
     protected IntPtr NativeDelegate;
 
+    // Handler names are turned into FNames once, not on every add, remove and contains.
+    private static readonly ConcurrentDictionary<string, FName> FunctionNames = new();
+
+    private static FName GetFunctionName(TDelegate handler)
+    {
+        return FunctionNames.GetOrAdd(handler.Method.Name, static name => new FName(name));
+    }
+
     public override void FromNative(IntPtr address, IntPtr nativeProperty)
     {
         // Keep a reference to the property and delegate for later usage
@@ -32,7 +41,7 @@ public abstract class MulticastDelegate<TDelegate> : DelegateBase<TDelegate> whe
 
     public override void BindUFunction(UObject targetObject, FName functionName)
     {
-        FMulticastDelegatePropertyExporter.CallAddDelegate(NativeProperty, NativeDelegate, targetObject.NativeObject, functionName.ToString());
+        FMulticastDelegatePropertyExporter.CallAddDelegate(NativeProperty, NativeDelegate, targetObject.NativeObject, functionName);
     }
 
     public override void BindUFunction(TWeakObjectPtr<UObject> targetObjectPtr, FName functionName)
@@ -46,7 +55,7 @@ public abstract class MulticastDelegate<TDelegate> : DelegateBase<TDelegate> whe
         {
             throw new ArgumentException("The callback for a multicast delegate must be a valid UFunction defined on a UClass", nameof(handler));
         }
-        FMulticastDelegatePropertyExporter.CallAddDelegate(NativeProperty, NativeDelegate, targetObject.NativeObject, handler.Method.Name);
+        FMulticastDelegatePropertyExporter.CallAddDelegate(NativeProperty, NativeDelegate, targetObject.NativeObject, GetFunctionName(handler));
     }
 
     public override void Remove(TDelegate handler)
@@ -55,7 +64,7 @@ public abstract class MulticastDelegate<TDelegate> : DelegateBase<TDelegate> whe
         {
             return;
         }
-        FMulticastDelegatePropertyExporter.CallRemoveDelegate(NativeProperty, NativeDelegate, targetObject.NativeObject, handler.Method.Name);
+        FMulticastDelegatePropertyExporter.CallRemoveDelegate(NativeProperty, NativeDelegate, targetObject.NativeObject, GetFunctionName(handler));
     }
 
     public override bool Contains(TDelegate handler)
@@ -64,7 +73,7 @@ public abstract class MulticastDelegate<TDelegate> : DelegateBase<TDelegate> whe
         {
             return false;
         }
-        return FMulticastDelegatePropertyExporter.CallContainsDelegate(NativeProperty, NativeDelegate, targetObject.NativeObject, handler.Method.Name).ToManagedBool();
+        return FMulticastDelegatePropertyExporter.CallContainsDelegate(NativeProperty, NativeDelegate, targetObject.NativeObject, GetFunctionName(handler)).ToManagedBool();
     }
 
     public override bool IsBound => FMulticastDelegatePropertyExporter.CallIsBound(NativeDelegate).ToManagedBool();
@@ -7,7 +7,7 @@ using UnrealSharp.Interop;
 namespace UnrealSharp;
 
 [UStruct, StructLayout(LayoutKind.Sequential)]
-public struct FName : IEquatable<FName>, IComparable<FName>
+public struct FName : IEquatable<FName>, IComparable<FName>, IUnrealTypeHash
 {
 #if !WITH_EDITOR
     private uint ComparisonIndex;
@@ -20,17 +20,42 @@ public struct FName : IEquatable<FName>, IComparable<FName>
 
     public static readonly FName None = new(0, 0);
     
-    public FName(string name)
+    public FName(string name) : this(name.AsSpan())
+    {
+    }
+    
+    public FName(ReadOnlySpan<char> name)
     {
         unsafe
         {
             fixed (char* stringPtr = name)
             {
-                FNameExporter.CallStringToName(ref this, stringPtr);
+                FNameExporter.CallStringViewToName(ref this, stringPtr, name.Length);
             }
         }
     }
 
+    /// <summary>
+    /// Makes names out of a table of null separated strings with a single native call.
+    /// The generated glue keeps its name literals in such tables instead of making each name on use.
+    /// </summary>
+    /// <param name="table">The strings, separated by '\0'.</param>
+    /// <param name="count">The number of strings in the table.</param>
+    public static FName[] FromStringTable(string table, int count)
+    {
+        FName[] names = new FName[count];
+        unsafe
+        {
+            fixed (char* tablePtr = table)
+            fixed (FName* namesPtr = names)
+            {
+                FNameExporter.CallStringTableToNames(namesPtr, count, tablePtr, table.Length);
+            }
+        }
+
+        return names;
+    }
+
     private FName(uint comparisonIndex, uint number)
     {
         ComparisonIndex = comparisonIndex;
@@ -42,15 +67,55 @@ public struct FName : IEquatable<FName>, IComparable<FName>
     {
         unsafe
         {
-            UnmanagedArray buffer = new UnmanagedArray();
-            try
+            const int stackBufferLength = 256;
+            char* stackBuffer = stackalloc char[stackBufferLength];
+            
+            int length = FNameExporter.CallNameToStringBuffer(this, stackBuffer, stackBufferLength);
+            if (length <= stackBufferLength)
+            {
+                return new string(stackBuffer, 0, length);
+            }
+            
+            return string.Create(length, this, static (span, name) =>
+            {
+                fixed (char* spanPtr = span)
+                {
+                    FNameExporter.CallNameToStringBuffer(name, spanPtr, span.Length);
+                }
+            });
+        }
+    }
+    
+    /// <summary>
+    /// Look up a name without adding it to the name table.
+    /// </summary>
+    /// <param name="name">The name to look up.</param>
+    /// <param name="result">The found name, or None.</param>
+    /// <returns>True if the name exists.</returns>
+    public static bool TryFind(ReadOnlySpan<char> name, out FName result)
+    {
+        unsafe
+        {
+            result = None;
+            fixed (char* stringPtr = name)
             {
-                FNameExporter.CallNameToString(this, ref buffer);
-                return new string((char*)buffer.Data);
+                return FNameExporter.CallFindName(ref result, stringPtr, name.Length).ToManagedBool();
             }
-            finally
+        }
+    }
+    
+    /// <summary>
+    /// Compare the name against a string with FName rules (case-insensitive, number suffix aware) without allocating.
+    /// </summary>
+    /// <param name="other">The string to compare against.</param>
+    /// <returns>True if the string names this name.</returns>
+    public bool Equals(ReadOnlySpan<char> other)
+    {
+        unsafe
+        {
+            fixed (char* stringPtr = other)
             {
-                buffer.Destroy();
+                return FNameExporter.CallEqualsStringView(this, stringPtr, other.Length).ToManagedBool();
             }
         }
     }
@@ -111,6 +176,26 @@ public struct FName : IEquatable<FName>, IComparable<FName>
     {
         return (int)ComparisonIndex;
     }
+
+    /// <inheritdoc />
+    public uint GetTypeHash()
+    {
+        return ComparisonIndex + Number;
+    }
+    
+    /// <summary>
+    /// Orders names by comparison index and then number, the same way the native data table row cache sorts them.
+    /// Not alphabetical, only meant for binary searching arrays that were sorted natively.
+    /// </summary>
+    internal static int CompareIndices(FName lhs, FName rhs)
+    {
+        if (lhs.ComparisonIndex != rhs.ComparisonIndex)
+        {
+            return lhs.ComparisonIndex < rhs.ComparisonIndex ? -1 : 1;
+        }
+
+        return lhs.Number.CompareTo(rhs.Number);
+    }
     
     /// <summary>
     /// Compare two names.
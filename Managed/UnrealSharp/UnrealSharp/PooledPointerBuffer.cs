@@ -0,0 +1,31 @@
+using System.Buffers;
+
+namespace UnrealSharp;
+
+/// <summary>
+/// Pointers rented from the shared pool, owned by a single object so copies of the struct enumerators
+/// that hold it share it instead of each returning the array.
+/// The array goes back to the pool once, on the first Dispose, later accesses throw.
+/// </summary>
+internal sealed class PooledPointerBuffer : IDisposable
+{
+    private IntPtr[]? _pointers;
+
+    public PooledPointerBuffer(int minimumLength)
+    {
+        _pointers = ArrayPool<IntPtr>.Shared.Rent(Math.Max(minimumLength, 1));
+    }
+
+    public int Count { get; set; }
+
+    public IntPtr[] Pointers => _pointers ?? throw new ObjectDisposedException(nameof(PooledPointerBuffer));
+
+    public void Dispose()
+    {
+        IntPtr[]? pointers = Interlocked.Exchange(ref _pointers, null);
+        if (pointers != null)
+        {
+            ArrayPool<IntPtr>.Shared.Return(pointers);
+        }
+    }
+}
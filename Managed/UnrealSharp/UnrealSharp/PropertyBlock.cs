@@ -0,0 +1,93 @@
+using System.Runtime.InteropServices;
+using UnrealSharp.CoreUObject;
+using UnrealSharp.Interop;
+
+namespace UnrealSharp;
+
+/// <summary>
+/// A set of properties of a class, written to an object in one native call. Resolve it once per class and reuse it.
+/// Values are set through the properties, so bitfield bools are written correctly.
+/// Only blittable property types are supported, values are copied as they are.
+/// </summary>
+public sealed unsafe class PropertyBlock : IDisposable
+{
+    private const int ValueAlignment = 16;
+    
+    private readonly int _count;
+    private IntPtr* _properties;
+    private int* _valueOffsets;
+    private readonly int[] _valueSizes;
+    private byte* _values;
+
+    private PropertyBlock(IntPtr nativeClass, string[] propertyNames)
+    {
+        _count = propertyNames.Length;
+        _properties = (IntPtr*) NativeMemory.Alloc((nuint) (_count * sizeof(IntPtr)));
+        _valueOffsets = (int*) NativeMemory.Alloc((nuint) (_count * sizeof(int)));
+        _valueSizes = new int[_count];
+
+        int valuesSize = 0;
+        for (int i = 0; i < _count; i++)
+        {
+            IntPtr property = FPropertyExporter.CallGetNativePropertyFromName(nativeClass, propertyNames[i]);
+            if (property == IntPtr.Zero)
+            {
+                Dispose();
+                throw new ArgumentException($"Property {propertyNames[i]} not found");
+            }
+
+            _properties[i] = property;
+            _valueSizes[i] = FPropertyExporter.CallGetSize(property) / FPropertyExporter.CallGetArrayDim(property);
+            _valueOffsets[i] = valuesSize;
+            valuesSize += (_valueSizes[i] + ValueAlignment - 1) & ~(ValueAlignment - 1);
+        }
+
+        _values = (byte*) NativeMemory.AlignedAlloc((nuint) Math.Max(valuesSize, ValueAlignment), ValueAlignment);
+        NativeMemory.Clear(_values, (nuint) valuesSize);
+    }
+
+    ~PropertyBlock()
+    {
+        Dispose();
+    }
+
+    /// <summary>
+    /// Resolves the named properties of the class.
+    /// </summary>
+    public static PropertyBlock Create<T>(TSubclassOf<T> ownerClass, params string[] propertyNames) where T : UObject
+    {
+        return new PropertyBlock(ownerClass.NativeClass, propertyNames);
+    }
+
+    /// <summary>
+    /// Stages the value of the property at index, in the order the names were given.
+    /// </summary>
+    public void Set<T>(int index, T value) where T : unmanaged
+    {
+        if (sizeof(T) != _valueSizes[index])
+        {
+            throw new ArgumentException($"Value of {sizeof(T)} bytes does not match the property size of {_valueSizes[index]} bytes");
+        }
+
+        *(T*) (_values + _valueOffsets[index]) = value;
+    }
+
+    /// <summary>
+    /// Writes every staged value to the object.
+    /// </summary>
+    public void Apply(UObject target)
+    {
+        FPropertyExporter.CallSetValues_InContainer(_properties, target.NativeObject, _values, _valueOffsets, _count);
+    }
+
+    public void Dispose()
+    {
+        NativeMemory.Free(_properties);
+        NativeMemory.Free(_valueOffsets);
+        NativeMemory.AlignedFree(_values);
+        _properties = null;
+        _valueOffsets = null;
+        _values = null;
+        GC.SuppressFinalize(this);
+    }
+}
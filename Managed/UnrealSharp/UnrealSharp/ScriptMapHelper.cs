@@ -1,4 +1,5 @@
 ﻿
+using System.Runtime.InteropServices;
 using UnrealSharp.Core;
 using UnrealSharp.Core.Marshallers;
 using UnrealSharp.Interop;
@@ -13,6 +14,7 @@ internal unsafe struct ScriptMapHelper
     private readonly NativeProperty _mapProperty;
     private readonly NativeProperty _keyProp;
     private readonly NativeProperty _valueProp;
+    private readonly int _pairStride;
     
     public ScriptMapHelper(NativeProperty mapProperty, NativeProperty key, NativeProperty value, IntPtr map = default)
     {
@@ -21,6 +23,7 @@ internal unsafe struct ScriptMapHelper
         _mapProperty = mapProperty;
         _keyProp = key;
         _valueProp = value;
+        _pairStride = GetPairStride(mapProperty.Property);
     }
     
     public ScriptMapHelper(IntPtr mapProperty)
@@ -30,6 +33,12 @@ internal unsafe struct ScriptMapHelper
         _mapProperty = new NativeProperty(mapProperty);
         _keyProp = new NativeProperty(FMapPropertyExporter.CallGetKey(mapProperty));
         _valueProp = new NativeProperty(FMapPropertyExporter.CallGetValue(mapProperty));
+        _pairStride = GetPairStride(mapProperty);
+    }
+
+    private static int GetPairStride(IntPtr mapProperty)
+    {
+        return SparseArrayLayout.IsValid ? FMapPropertyExporter.CallGetPairStride(mapProperty) : 0;
     }
 
     /// <summary>
@@ -39,6 +48,11 @@ internal unsafe struct ScriptMapHelper
     /// <returns>true if accessing this element is legal.</returns>
     public bool IsValidIndex(int index)
     {
+        if (SparseArrayLayout.IsValid)
+        {
+            return SparseArrayLayout.IsValidIndex(MapAddress, index);
+        }
+        
         return FScriptMapHelperExporter.CallIsValidIndex(_mapProperty.Property, MapAddress, index).ToManagedBool();
     }
 
@@ -48,6 +62,11 @@ internal unsafe struct ScriptMapHelper
     /// <returns>The number of elements in the map.</returns>
     public int Num()
     {
+        if (SparseArrayLayout.IsValid)
+        {
+            return SparseArrayLayout.Num(MapAddress);
+        }
+        
         return FScriptMapHelperExporter.CallNum(_mapProperty.Property, MapAddress);
     }
 
@@ -57,12 +76,25 @@ internal unsafe struct ScriptMapHelper
     /// <returns>The (non-inclusive) maximum index of elements in the map.</returns>
     public int GetMaxIndex()
     {
+        if (SparseArrayLayout.IsValid)
+        {
+            return SparseArrayLayout.GetMaxIndex(MapAddress);
+        }
+        
         return FScriptMapHelperExporter.CallGetMaxIndex(_mapProperty.Property, MapAddress);
     }
 
     public bool GetPairPtr(int index, out IntPtr keyPtr, out IntPtr valuePtr)
     {
-        IntPtr pairPtr = FScriptMapHelperExporter.CallGetPairPtr(_mapProperty.Property, MapAddress, index);
+        IntPtr pairPtr;
+        if (SparseArrayLayout.IsValid)
+        {
+            pairPtr = IsValidIndex(index) ? SparseArrayLayout.GetData(MapAddress, index, _pairStride) : IntPtr.Zero;
+        }
+        else
+        {
+            pairPtr = FScriptMapHelperExporter.CallGetPairPtr(_mapProperty.Property, MapAddress, index);
+        }
         
         if (pairPtr == IntPtr.Zero)
         {
@@ -119,4 +151,101 @@ internal unsafe struct ScriptMapHelper
         _keyProp.DestroyValue(keyPtr);
         _valueProp.DestroyValue(valuePtr);
     }
+    
+    /// <summary>
+    /// Writes the pointers of up to maxPairs valid pairs into outPairs in a single call.
+    /// </summary>
+    /// <returns>The number of pairs in the map.</returns>
+    public int GetPairPtrs(IntPtr* outPairs, int maxPairs)
+    {
+        return FScriptMapHelperExporter.CallGetPairPtrs(_mapProperty.Property, MapAddress, outPairs, maxPairs);
+    }
+    
+    public void KeyValueFromPairPtr(IntPtr pairPtr, out IntPtr keyPtr, out IntPtr valuePtr)
+    {
+        keyPtr = pairPtr + _keyProp.Offset;
+        valuePtr = pairPtr + _valueProp.Offset;
+    }
+    
+    public void AddPairs<TKey, TValue>(ReadOnlySpan<KeyValuePair<TKey, TValue>> pairs, MarshallingDelegates<TKey>.ToNative keyToNative,
+        MarshallingDelegates<TValue>.ToNative valueToNative)
+    {
+        if (pairs.IsEmpty)
+        {
+            return;
+        }
+        
+        int keySize = _keyProp.Size;
+        int valueSize = _valueProp.Size;
+        using TransientMemoryScope scope = TransientMemoryScope.Begin();
+        byte* keys = TransientMemory.Allocate((long) keySize * pairs.Length);
+        byte* values = TransientMemory.Allocate((long) valueSize * pairs.Length);
+        
+        // A marshaller can throw halfway through, only what was initialized gets destroyed.
+        int numKeys = 0;
+        int numValues = 0;
+        
+        try
+        {
+            for (int i = 0; i < pairs.Length; ++i)
+            {
+                IntPtr keyPtr = new IntPtr(keys + i * keySize);
+                _keyProp.InitializeValue(keyPtr);
+                ++numKeys;
+                keyToNative(keyPtr, 0, pairs[i].Key);
+                
+                IntPtr valuePtr = new IntPtr(values + i * valueSize);
+                _valueProp.InitializeValue(valuePtr);
+                ++numValues;
+                valueToNative(valuePtr, 0, pairs[i].Value);
+            }
+            
+            FScriptMapHelperExporter.CallAddPairs(_mapProperty.Property, MapAddress, (IntPtr) keys, (IntPtr) values, pairs.Length);
+        }
+        finally
+        {
+            for (int i = 0; i < numKeys; ++i)
+            {
+                _keyProp.DestroyValue(new IntPtr(keys + i * keySize));
+            }
+            
+            for (int i = 0; i < numValues; ++i)
+            {
+                _valueProp.DestroyValue(new IntPtr(values + i * valueSize));
+            }
+        }
+    }
+    
+    public int RemoveKeys<TKey>(ReadOnlySpan<TKey> keysToRemove, MarshallingDelegates<TKey>.ToNative keyToNative)
+    {
+        if (keysToRemove.IsEmpty)
+        {
+            return 0;
+        }
+        
+        int keySize = _keyProp.Size;
+        using TransientMemoryScope scope = TransientMemoryScope.Begin();
+        byte* keys = TransientMemory.Allocate((long) keySize * keysToRemove.Length);
+        int numKeys = 0;
+        
+        try
+        {
+            for (int i = 0; i < keysToRemove.Length; ++i)
+            {
+                IntPtr keyPtr = new IntPtr(keys + i * keySize);
+                _keyProp.InitializeValue(keyPtr);
+                ++numKeys;
+                keyToNative(keyPtr, 0, keysToRemove[i]);
+            }
+            
+            return FScriptMapHelperExporter.CallRemoveKeys(_mapProperty.Property, MapAddress, (IntPtr) keys, keysToRemove.Length);
+        }
+        finally
+        {
+            for (int i = 0; i < numKeys; ++i)
+            {
+                _keyProp.DestroyValue(new IntPtr(keys + i * keySize));
+            }
+        }
+    }
 }
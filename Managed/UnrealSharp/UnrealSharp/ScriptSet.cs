@@ -4,6 +4,64 @@ using UnrealSharp.Interop;
 
 namespace UnrealSharp;
 
+/// <summary>
+/// Where the running engine keeps the fields of a FScriptSet, fetched once. Lets sets and maps read their counts,
+/// allocation flags and element pointers inline, unless the engine lays them out differently than expected.
+/// </summary>
+internal static unsafe class SparseArrayLayout
+{
+    public static readonly bool IsValid;
+    private static readonly int DataOffset;
+    private static readonly int MaxIndexOffset;
+    private static readonly int NumFreeIndicesOffset;
+    private static readonly int InlineAllocationFlagsOffset;
+    private static readonly int SecondaryAllocationFlagsOffset;
+
+    static SparseArrayLayout()
+    {
+        FSparseArrayLayout layout;
+        FScriptSetExporter.CallGetSparseArrayLayout(&layout);
+        
+        IsValid = layout.IsValid != 0;
+        DataOffset = layout.DataOffset;
+        MaxIndexOffset = layout.MaxIndexOffset;
+        NumFreeIndicesOffset = layout.NumFreeIndicesOffset;
+        InlineAllocationFlagsOffset = layout.InlineAllocationFlagsOffset;
+        SecondaryAllocationFlagsOffset = layout.SecondaryAllocationFlagsOffset;
+    }
+
+    public static int GetMaxIndex(IntPtr set)
+    {
+        return *(int*) (set + MaxIndexOffset);
+    }
+
+    public static int Num(IntPtr set)
+    {
+        return GetMaxIndex(set) - *(int*) (set + NumFreeIndicesOffset);
+    }
+
+    public static bool IsValidIndex(IntPtr set, int index)
+    {
+        if ((uint) index >= (uint) GetMaxIndex(set))
+        {
+            return false;
+        }
+        
+        uint* allocationFlags = *(uint**) (set + SecondaryAllocationFlagsOffset);
+        if (allocationFlags == null)
+        {
+            allocationFlags = (uint*) (set + InlineAllocationFlagsOffset);
+        }
+        
+        return (allocationFlags[index >> 5] & (1u << (index & 31))) != 0;
+    }
+
+    public static IntPtr GetData(IntPtr set, int index, int stride)
+    {
+        return *(IntPtr*) (set + DataOffset) + index * stride;
+    }
+}
+
 [StructLayout(LayoutKind.Sequential)]
 public struct FScriptSet
 {
@@ -16,16 +74,31 @@ public struct FScriptSet
     
     internal bool IsValidIndex(int index)
     {
+        if (SparseArrayLayout.IsValid)
+        {
+            return SparseArrayLayout.IsValidIndex(SetPointer, index);
+        }
+        
         return FScriptSetExporter.CallIsValidIndex(SetPointer, index).ToManagedBool();
     }
 
     internal int Num()
     {
+        if (SparseArrayLayout.IsValid)
+        {
+            return SparseArrayLayout.Num(SetPointer);
+        }
+        
         return FScriptSetExporter.CallNum(SetPointer);
     }
 
     internal int GetMaxIndex()
     {
+        if (SparseArrayLayout.IsValid)
+        {
+            return SparseArrayLayout.GetMaxIndex(SetPointer);
+        }
+        
         return FScriptSetExporter.CallGetMaxIndex(SetPointer);
     }
 
@@ -34,6 +107,19 @@ public struct FScriptSet
         return FScriptSetExporter.CallGetData(index, SetPointer, nativeProperty);
     }
 
+    /// <summary>
+    /// Reads the element pointer inline when the layout is known, stride being FSetPropertyExporter.GetElementStride.
+    /// </summary>
+    internal IntPtr GetData(int index, IntPtr nativeProperty, int stride)
+    {
+        if (SparseArrayLayout.IsValid)
+        {
+            return SparseArrayLayout.GetData(SetPointer, index, stride);
+        }
+        
+        return FScriptSetExporter.CallGetData(index, SetPointer, nativeProperty);
+    }
+
     internal void Empty(int slack, IntPtr nativeProperty)
     {
         FScriptSetExporter.CallEmpty(slack, SetPointer, nativeProperty);
@@ -63,4 +149,24 @@ public struct FScriptSet
     {
         return FScriptSetExporter.CallFindIndex(SetPointer, nativeProperty, elementToFind, elementHash, elementEquality);
     }
+
+    internal int FindIndexWithHash(IntPtr elementToFind, IntPtr nativeProperty, uint elementHash)
+    {
+        return FScriptSetExporter.CallFindIndexWithHash(SetPointer, nativeProperty, elementToFind, elementHash);
+    }
+
+    internal unsafe int GetElementPtrs(IntPtr nativeProperty, IntPtr* outElements, int maxElements)
+    {
+        return FScriptSetExporter.CallGetElementPtrs(SetPointer, nativeProperty, outElements, maxElements);
+    }
+
+    internal void AddElements(IntPtr elements, int count, IntPtr nativeProperty)
+    {
+        FScriptSetExporter.CallAddElements(SetPointer, nativeProperty, elements, count);
+    }
+
+    internal int RemoveElements(IntPtr elements, int count, IntPtr nativeProperty)
+    {
+        return FScriptSetExporter.CallRemoveElements(SetPointer, nativeProperty, elements, count);
+    }
 }
\ No newline at end of file
@@ -31,6 +31,7 @@ internal unsafe struct FScriptSetHelper
 {        
     private readonly NativeProperty _setProperty;
     private readonly NativeProperty _elementProp;
+    private readonly int _elementStride;
     
     public FScriptSet Set;
     public int Count => Set.Num();
@@ -40,6 +41,7 @@ internal unsafe struct FScriptSetHelper
         Set = new FScriptSet(set);
         _setProperty = setProperty;
         _elementProp = new NativeProperty(FSetPropertyExporter.CallGetElement(setProperty.Property));
+        _elementStride = SparseArrayLayout.IsValid ? FSetPropertyExporter.CallGetElementStride(setProperty.Property) : 0;
     }
 
     /// <summary>
@@ -78,7 +80,7 @@ internal unsafe struct FScriptSetHelper
     /// <returns>Pointer to the element, or nullptr if the set is empty.</returns>
     internal IntPtr GetElementPtr(int index)
     {
-        return Count == 0 ? IntPtr.Zero : Set.GetData(index, _setProperty.Property);
+        return Count == 0 ? IntPtr.Zero : Set.GetData(index, _setProperty.Property, _elementStride);
     }
 
     /// <summary>
@@ -185,19 +187,15 @@ internal unsafe struct FScriptSetHelper
     /// </summary>
     internal int FindElementIndexFromHash(IntPtr elementToFind)
     {
-        NativeProperty nativeProperty = _elementProp;
-
-        uint ElementHash(IntPtr elementKey)
-        {
-            return nativeProperty.GetValueTypeHash(elementKey);
-        }
-
-        NativeBool ElementEquality(IntPtr a, IntPtr b)
-        {
-            return nativeProperty.Identical(a, b).ToNativeBool();
-        }
+        return FindElementIndexWithHash(elementToFind, _elementProp.GetValueTypeHash(elementToFind));
+    }
 
-        return Set.FindIndex(elementToFind, _setProperty.Property, ElementHash, ElementEquality);
+    /// <summary>
+    /// Finds element index from a hash the caller already computed, comparing the elements natively
+    /// </summary>
+    internal int FindElementIndexWithHash(IntPtr elementToFind, uint elementHash)
+    {
+        return Set.FindIndexWithHash(elementToFind, _setProperty.Property, elementHash);
     }
 
     internal int IndexOf<T>(T item, MarshallingDelegates<T>.ToNative toNative)
@@ -208,7 +206,10 @@ internal unsafe struct FScriptSetHelper
         _elementProp.InitializeValue(tempPtr);
         toNative(tempPtr, 0, item);
 
-        int index = FindElementIndexFromHash(tempPtr);
+        int index = TypeHash<T>.TryGetHash(item, tempPtr, _elementProp, out uint elementHash)
+            ? FindElementIndexWithHash(tempPtr, elementHash)
+            : FindElementIndexFromHash(tempPtr);
+        
         _elementProp.DestroyValue(tempPtr);
         return index;
     }
@@ -238,6 +239,81 @@ internal unsafe struct FScriptSetHelper
         return index;
     }
 
+    /// <summary>
+    /// Writes the pointers of up to maxElements valid elements into outElements in a single call.
+    /// </summary>
+    /// <returns>The number of elements in the set.</returns>
+    internal int GetElementPtrs(IntPtr* outElements, int maxElements)
+    {
+        return Set.GetElementPtrs(_setProperty.Property, outElements, maxElements);
+    }
+
+    internal void AddElements<T>(ReadOnlySpan<T> items, MarshallingDelegates<T>.ToNative toNative)
+    {
+        if (items.IsEmpty)
+        {
+            return;
+        }
+        
+        int elementSize = _elementProp.Size;
+        using TransientMemoryScope scope = TransientMemoryScope.Begin();
+        byte* elements = TransientMemory.Allocate((long) elementSize * items.Length);
+        int numInitialized = 0;
+        
+        try
+        {
+            InitializeElements(elements, elementSize, items, toNative, ref numInitialized);
+            Set.AddElements((IntPtr) elements, items.Length, _setProperty.Property);
+        }
+        finally
+        {
+            DestroyElements(elements, elementSize, numInitialized);
+        }
+    }
+
+    internal int RemoveElements<T>(ReadOnlySpan<T> items, MarshallingDelegates<T>.ToNative toNative)
+    {
+        if (items.IsEmpty)
+        {
+            return 0;
+        }
+        
+        int elementSize = _elementProp.Size;
+        using TransientMemoryScope scope = TransientMemoryScope.Begin();
+        byte* elements = TransientMemory.Allocate((long) elementSize * items.Length);
+        int numInitialized = 0;
+        
+        try
+        {
+            InitializeElements(elements, elementSize, items, toNative, ref numInitialized);
+            return Set.RemoveElements((IntPtr) elements, items.Length, _setProperty.Property);
+        }
+        finally
+        {
+            DestroyElements(elements, elementSize, numInitialized);
+        }
+    }
+
+    // Counts the elements as they're initialized, so a marshaller that throws halfway leaves only those to destroy.
+    private void InitializeElements<T>(byte* elements, int elementSize, ReadOnlySpan<T> items, MarshallingDelegates<T>.ToNative toNative, ref int numInitialized)
+    {
+        for (int i = 0; i < items.Length; ++i)
+        {
+            IntPtr elementPtr = new IntPtr(elements + i * elementSize);
+            _elementProp.InitializeValue(elementPtr);
+            ++numInitialized;
+            toNative(elementPtr, 0, items[i]);
+        }
+    }
+
+    private void DestroyElements(byte* elements, int elementSize, int count)
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            _elementProp.DestroyValue(new IntPtr(elements + i * elementSize));
+        }
+    }
+
     /// <summary>
     /// Adds the element to the set, returning true if the element was added, or false if the element was already present
     /// </summary>
@@ -302,19 +378,7 @@ internal unsafe struct FScriptSetHelper
     /// </summary>
     internal bool RemoveElement(IntPtr elementToRemove)
     {
-        NativeProperty property = _elementProp;
-
-        uint ElementHash(IntPtr elementKey)
-        {
-            return property.GetValueTypeHash(elementKey);
-        }
-
-        NativeBool ElementEquality(IntPtr a, IntPtr b)
-        {
-            return property.Identical(a, b).ToNativeBool();
-        }
-
-        int foundIndex = Set.FindIndex(elementToRemove, _setProperty.Property, ElementHash, ElementEquality);
+        int foundIndex = FindElementIndexFromHash(elementToRemove);
         
         if (foundIndex == -1)
         {
@@ -365,6 +429,6 @@ internal unsafe struct FScriptSetHelper
     /// <returns>Pointer to the element, or nullptr if the array is empty.</returns>
     internal IntPtr GetElementPtrWithoutCheck(int index)
     {
-        return Set.GetData(index, _setProperty.Property);
+        return Set.GetData(index, _setProperty.Property, _elementStride);
     }
 }
\ No newline at end of file
@@ -35,16 +35,31 @@ public class TSet<T> : TSetBase<T>, ISet<T>, IReadOnlySet<T>
 
     public void CopyTo(T[] array, int arrayIndex)
     {
-        int maxIndex = SetHelper.GetMaxIndex();
         int index = arrayIndex;
-        for (int i = 0; i < maxIndex; ++i)
+        foreach (T item in this)
         {
-            if (SetHelper.IsValidIndex(i))
-            {
-                array[index++] = Get(i);
-            }
+            array[index++] = item;
         }
     }
+    
+    /// <summary>
+    /// Adds all elements in a single native call. Elements already in the set are not duplicated.
+    /// </summary>
+    /// <param name="items"> The elements to add. </param>
+    public void AddRange(ReadOnlySpan<T> items)
+    {
+        AddRangeInternal(items);
+    }
+    
+    /// <summary>
+    /// Removes all elements in a single native call.
+    /// </summary>
+    /// <param name="items"> The elements to remove. </param>
+    /// <returns> The number of elements that were in the set. </returns>
+    public int RemoveRange(ReadOnlySpan<T> items)
+    {
+        return RemoveRangeInternal(items);
+    }
 
     public void ExceptWith(IEnumerable<T> other)
     {
@@ -50,10 +50,38 @@ public abstract class TSetBase<T> : IEnumerable<T>
         return SetHelper.IndexOf(item, ToNative);
     }
     
+    /// <summary>
+    /// Fetches the pointers of all elements in a single native call.
+    /// The buffer is rented from the shared pool and must be disposed.
+    /// </summary>
+    internal PooledPointerBuffer RentElementPtrs()
+    {
+        PooledPointerBuffer elementPtrs = new PooledPointerBuffer(Count);
+        IntPtr[] pointers = elementPtrs.Pointers;
+        unsafe
+        {
+            fixed (IntPtr* elementPtrsPtr = pointers)
+            {
+                elementPtrs.Count = Math.Min(SetHelper.GetElementPtrs(elementPtrsPtr, pointers.Length), pointers.Length);
+            }
+        }
+        return elementPtrs;
+    }
+    
     protected void ClearInternal()
     {
         SetHelper.EmptyValues();
     }
+    
+    protected void AddRangeInternal(ReadOnlySpan<T> items)
+    {
+        SetHelper.AddElements(items, ToNative);
+    }
+    
+    protected int RemoveRangeInternal(ReadOnlySpan<T> items)
+    {
+        return SetHelper.RemoveElements(items, ToNative);
+    }
 
     protected void AddInternal(T item)
     {
@@ -305,30 +333,30 @@ public abstract class TSetBase<T> : IEnumerable<T>
 
     public struct Enumerator(TSetBase<T> set) : IEnumerator<T>
     {
+        // Shared by copies of the enumerator, so only one of them returns it to the pool.
+        private PooledPointerBuffer? _elementPtrs;
         private int _index = -1;
 
-        public T Current => set.Get(_index);
+        public T Current => set.FromNative(_elementPtrs!.Pointers[_index], 0);
 
         object? IEnumerator.Current => Current;
 
         public void Dispose()
         {
+            _elementPtrs?.Dispose();
+            _elementPtrs = null;
         }
 
         public bool MoveNext()
         {
-            int maxIndex = set.SetHelper.GetMaxIndex();
-            
-            while (++_index < maxIndex && !set.SetHelper.IsValidIndex(_index))
-            {
-                
-            }
-            
-            return _index < maxIndex;
+            // Fetch every element up front, so stepping through the set doesn't cross into native code per slot.
+            _elementPtrs ??= set.RentElementPtrs();
+            return ++_index < _elementPtrs.Count;
         }
 
         public void Reset()
         {
+            Dispose();
             _index = -1;
         }
     }
@@ -0,0 +1,65 @@
+using UnrealSharp.Interop;
+
+namespace UnrealSharp;
+
+/// <summary>
+/// A reference to a native-owned buffer that C# and C++ both read and write in place, without copying it across the boundary.
+/// The memory lives outside the managed heap, so it is never pinned and never moved by the GC.
+/// Pass <see cref="NativePointer"/> to native code, which can keep the buffer alive with its own reference.
+/// Each acquired or added reference must be disposed exactly once.
+/// </summary>
+public readonly unsafe struct SharedBuffer : IDisposable
+{
+    public readonly IntPtr NativePointer;
+    public readonly long Capacity;
+
+    private SharedBuffer(IntPtr nativePointer, long capacity)
+    {
+        NativePointer = nativePointer;
+        Capacity = capacity;
+    }
+
+    public bool IsValid => NativePointer != IntPtr.Zero;
+
+    /// <summary>
+    /// Gets a buffer with room for at least <paramref name="size"/> bytes. The contents are uninitialized.
+    /// </summary>
+    public static SharedBuffer Acquire(long size)
+    {
+        long capacity;
+        IntPtr nativePointer = FCSSharedBufferExporter.CallAcquireSharedBuffer(size, &capacity);
+        return new SharedBuffer(nativePointer, capacity);
+    }
+
+    /// <summary>
+    /// Takes another reference to a buffer handed over by native code.
+    /// </summary>
+    public static SharedBuffer AddRef(IntPtr nativePointer, long capacity)
+    {
+        FCSSharedBufferExporter.CallAddRefSharedBuffer(nativePointer);
+        return new SharedBuffer(nativePointer, capacity);
+    }
+
+    public Span<T> AsSpan<T>() where T : unmanaged
+    {
+        return new Span<T>((void*) NativePointer, checked((int) (Capacity / sizeof(T))));
+    }
+
+    public Span<T> AsSpan<T>(int length) where T : unmanaged
+    {
+        if ((long) length * sizeof(T) > Capacity)
+        {
+            throw new ArgumentOutOfRangeException(nameof(length));
+        }
+
+        return new Span<T>((void*) NativePointer, length);
+    }
+
+    public void Dispose()
+    {
+        if (IsValid)
+        {
+            FCSSharedBufferExporter.CallReleaseSharedBuffer(NativePointer);
+        }
+    }
+}
@@ -61,11 +61,12 @@ public struct TSoftObjectPtr<T> where T : UObject
     }
 
     /// <summary>
-    /// Loads the object asynchronously.
+    /// Loads the object synchronously, blocking the game thread until it is loaded. Prefer LoadValueAsync during gameplay.
     /// </summary>
-    /// <returns></returns>
+    /// <returns> The loaded object. </returns>
     public T LoadSynchronous()
     {
+        WarnOnBlockingLoad();
         IntPtr handle = FSoftObjectPtrExporter.CallLoadSynchronous(ref SoftObjectPtr.Data);
         return GCHandleUtilities.GetObjectFromHandlePtr<T>(handle);
     }
@@ -88,27 +89,55 @@ public struct TSoftObjectPtr<T> where T : UObject
         var foundObject = SoftObjectPtr.Get();
         return foundObject as T;
     }
+
+    [Conditional("DEBUG")]
+    private void WarnOnBlockingLoad()
+    {
+        if (FSoftObjectPtrExporter.CallShouldWarnOnBlockingLoad(ref SoftObjectPtr.Data).ToManagedBool())
+        {
+            LogUnrealSharp.LogWarning($"Loading {SoftObjectPath} synchronously during gameplay blocks the game thread, use LoadValueAsync instead. Set UnrealSharp.WarnOnBlockingLoads 0 to silence this.\n{Environment.StackTrace}");
+        }
+    }
 };
 
 public static class SoftObjectPtrExtensions
 {
-    public static async Task<T> LoadAsync<T>(this TSoftObjectPtr<T> softObjectPtr) where T : UObject
+    public static Task<T> LoadAsync<T>(this TSoftObjectPtr<T> softObjectPtr) where T : UObject
     {
-        if (softObjectPtr.IsNull)
+        return softObjectPtr.LoadValueAsync().AsTask();
+    }
+    
+    /// <summary>
+    /// Loads the object through the streamable manager without blocking the game thread.
+    /// Completes synchronously, without allocating, when the object is already loaded.
+    /// </summary>
+    /// <param name="softObjectPtr"> The object to load. </param>
+    /// <param name="priority"> Priority of the streaming request, higher loads first. </param>
+    public static ValueTask<T> LoadValueAsync<T>(this TSoftObjectPtr<T> softObjectPtr, int priority = 0) where T : UObject
+    {
+        if (softObjectPtr.Object is { } resident)
         {
-            throw new Exception($"SoftObjectPath is null: {softObjectPtr.SoftObjectPath}");
+            return new ValueTask<T>(resident);
         }
         
-        if (softObjectPtr.IsValid)
+        return new ValueTask<T>(StreamAsync(softObjectPtr.SoftObjectPath, priority));
+    }
+    
+    private static async Task<T> StreamAsync<T>(FSoftObjectPath softObjectPath, int priority) where T : UObject
+    {
+        if (softObjectPath.Null)
         {
-            return softObjectPtr.Object!;
+            throw new Exception($"SoftObjectPath is null: {softObjectPath}");
         }
         
-        T loadedObject = await softObjectPtr.SoftObjectPath.LoadAsync<T>();
+        using (StreamingBatch batch = new StreamingBatch(new[] { softObjectPath }, priority))
+        {
+            await batch.Task;
+        }
         
-        if (loadedObject == null)
+        if (softObjectPath.Object is not T loadedObject)
         {
-            throw new Exception($"Failed to load object at {softObjectPtr.SoftObjectPath}");
+            throw new Exception($"Failed to load object at {softObjectPath}");
         }
         
         return loadedObject;
@@ -16,16 +16,30 @@ public struct FStrongObjectPtr
     internal IntPtr NativeObject;
 }
 
+/// <summary>
+/// Keeps an object alive until disposed. The objects of all strong pointers are held by a single native root set,
+/// which the garbage collector visits in one pass.
+/// </summary>
 public abstract class TStrongObjectPtr : IEquatable<TStrongObjectPtr>, IDisposable
 {
     [DebuggerBrowsable(DebuggerBrowsableState.Never)]
     private FStrongObjectPtr _nativePtr;
 
+    // Slot in the native root set, -1 when pointing to nothing.
+    [DebuggerBrowsable(DebuggerBrowsableState.Never)]
+    private readonly int _rootIndex = -1;
+
     private bool _isDisposed;
 
     protected TStrongObjectPtr(UObject? obj = null)
     {
-        TStrongObjectPtrExporter.CallConstructStrongObjectPtr(ref _nativePtr, obj?.NativeObject ?? IntPtr.Zero);
+        if (obj == null)
+        {
+            return;
+        }
+        
+        _nativePtr.NativeObject = obj.NativeObject;
+        _rootIndex = TStrongObjectPtrExporter.CallAddRoot(_nativePtr.NativeObject);
     }
 
     ~TStrongObjectPtr()
@@ -43,7 +57,8 @@ public abstract class TStrongObjectPtr : IEquatable<TStrongObjectPtr>, IDisposab
                 return null;
             }
             
-            IntPtr handle = FCSManagerExporter.CallFindManagedObject(_nativePtr.NativeObject);
+            // Looked up through the root set, which drops objects that were marked as garbage.
+            IntPtr handle = TStrongObjectPtrExporter.CallGetRootManagedObject(_rootIndex);
             return GCHandleUtilities.GetObjectFromHandlePtr<UObject>(handle);
         }
     }
@@ -85,7 +100,11 @@ public abstract class TStrongObjectPtr : IEquatable<TStrongObjectPtr>, IDisposab
             return;
         }
         
-        TStrongObjectPtrExporter.CallDestroyStrongObjectPtr(ref _nativePtr);
+        if (_rootIndex >= 0)
+        {
+            TStrongObjectPtrExporter.CallRemoveRoot(_rootIndex);
+        }
+        
         _isDisposed = true;
         GC.SuppressFinalize(this);
     }
@@ -26,9 +26,19 @@ public class FText
         FTextExporter.CallCreateEmptyText(ref Data);
     }
     
-    public FText(string text)
+    public FText(string text) : this(text.AsSpan())
     {
-        FTextExporter.CallFromString(ref Data, text);
+    }
+    
+    public FText(ReadOnlySpan<char> text)
+    {
+        unsafe
+        {
+            fixed (char* textPtr = text)
+            {
+                FTextExporter.CallFromStringView(ref Data, textPtr, text.Length);
+            }
+        }
     }
     
     public FText(FName name) : this(name.ToString())
@@ -76,7 +86,8 @@ public class FText
         
         unsafe
         {
-            return new string(FTextExporter.CallToString(ref Data));
+            char* textPtr = FTextExporter.CallToStringView(ref Data, out int length);
+            return length == 0 ? string.Empty : new string(textPtr, 0, length);
         }
     }
     
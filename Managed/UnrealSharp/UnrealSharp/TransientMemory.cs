@@ -0,0 +1,41 @@
+using UnrealSharp.Interop;
+
+namespace UnrealSharp;
+
+/// <summary>
+/// Raw native memory from the transient arena of the calling thread, for temporaries that are handed to native code.
+/// Memory allocated inside a <see cref="TransientMemoryScope"/> is released when the scope is disposed,
+/// anything else is released at the start of the next frame. Initializing and destroying values placed in it is up to the caller.
+/// </summary>
+public static class TransientMemory
+{
+    public static unsafe byte* Allocate(long size, int alignment = 16)
+    {
+        return (byte*) FCSTransientArenaExporter.CallAllocateTransient(size, alignment);
+    }
+}
+
+/// <summary>
+/// Releases everything allocated through <see cref="TransientMemory"/> on this thread while the scope was alive.
+/// </summary>
+public ref struct TransientMemoryScope
+{
+    private bool _isOpen;
+    
+    public static TransientMemoryScope Begin()
+    {
+        FCSTransientArenaExporter.CallPushTransientScope();
+        return new TransientMemoryScope { _isOpen = true };
+    }
+
+    public void Dispose()
+    {
+        if (!_isOpen)
+        {
+            return;
+        }
+        
+        _isOpen = false;
+        FCSTransientArenaExporter.CallPopTransientScope();
+    }
+}
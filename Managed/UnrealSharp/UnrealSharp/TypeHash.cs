@@ -0,0 +1,94 @@
+using System.Reflection;
+using System.Runtime.CompilerServices;
+using UnrealSharp.Interop.Properties;
+
+namespace UnrealSharp;
+
+/// <summary>
+/// Implemented by structs that compute the same hash as their native GetTypeHash,
+/// so map and set lookups with them as keys skip the native hash.
+/// </summary>
+public interface IUnrealTypeHash
+{
+    uint GetTypeHash();
+}
+
+/// <summary>
+/// Computes the native GetTypeHash of map and set keys on the managed side, for integers, enums and IUnrealTypeHash structs.
+/// The first lookups of each key type are checked against the native hash, and a mismatch turns the managed hash off for the type.
+/// </summary>
+internal static class TypeHash<T>
+{
+    private const int NumHashesToVerify = 4;
+
+    private static readonly Func<T, uint>? Hasher = CreateHasher();
+    private static int _numVerifiedHashes;
+    private static bool _doesNotMatchNative;
+
+    /// <summary>
+    /// Hashes value, which nativeValue holds marshalled for property.
+    /// </summary>
+    /// <returns>False if the hash of T can't be computed on the managed side.</returns>
+    public static bool TryGetHash(T value, IntPtr nativeValue, NativeProperty property, out uint hash)
+    {
+        if (Hasher == null || _doesNotMatchNative)
+        {
+            hash = 0;
+            return false;
+        }
+
+        hash = Hasher(value);
+        if (_numVerifiedHashes >= NumHashesToVerify)
+        {
+            return true;
+        }
+
+        if (property.GetValueTypeHash(nativeValue) != hash)
+        {
+            LogUnrealSharp.LogWarning($"The managed hash of {typeof(T)} differs from the native one, map and set lookups with it fall back to the native hash.");
+            _doesNotMatchNative = true;
+            return false;
+        }
+
+        ++_numVerifiedHashes;
+        return true;
+    }
+
+    private static Func<T, uint>? CreateHasher()
+    {
+        Type type = typeof(T);
+        if (type.IsEnum)
+        {
+            type = Enum.GetUnderlyingType(type);
+        }
+
+        // Same as the GetTypeHash overloads for integers in TypeHash.h.
+        if (type == typeof(byte)) return static value => Unsafe.As<T, byte>(ref value);
+        if (type == typeof(sbyte)) return static value => (uint) Unsafe.As<T, sbyte>(ref value);
+        if (type == typeof(ushort)) return static value => Unsafe.As<T, ushort>(ref value);
+        if (type == typeof(short)) return static value => (uint) Unsafe.As<T, short>(ref value);
+        if (type == typeof(uint)) return static value => Unsafe.As<T, uint>(ref value);
+        if (type == typeof(int)) return static value => (uint) Unsafe.As<T, int>(ref value);
+        if (type == typeof(ulong)) return static value => HashUInt64(Unsafe.As<T, ulong>(ref value));
+        if (type == typeof(long)) return static value => HashUInt64((ulong) Unsafe.As<T, long>(ref value));
+
+        if (type.IsValueType && typeof(IUnrealTypeHash).IsAssignableFrom(type))
+        {
+            MethodInfo method = typeof(TypeHash<T>).GetMethod(nameof(HashStruct), BindingFlags.NonPublic | BindingFlags.Static)!;
+            return method.MakeGenericMethod(type).CreateDelegate<Func<T, uint>>();
+        }
+
+        return null;
+    }
+
+    private static uint HashUInt64(ulong value)
+    {
+        return (uint) value + (uint) (value >> 32) * 23;
+    }
+
+    // Generic over the struct so calling GetTypeHash doesn't box it.
+    private static uint HashStruct<TStruct>(TStruct value) where TStruct : struct, IUnrealTypeHash
+    {
+        return value.GetTypeHash();
+    }
+}
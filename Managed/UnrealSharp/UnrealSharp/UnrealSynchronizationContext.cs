@@ -1,3 +1,4 @@
+using System.Runtime.CompilerServices;
 using System.Runtime.InteropServices;
 using UnrealSharp.Core;
 using UnrealSharp.CoreUObject;
@@ -61,12 +62,24 @@ namespace UnrealSharp
         AnyBackgroundHiPriTask = AnyThread | BackgroundThreadPriority | HighTaskPriority,
     };
 
+    /// <summary>
+    /// How urgently a continuation resumes on the game thread. Continuations run once per frame within a time budget,
+    /// lower lanes wait for the next frame when the budget runs out. Input continuations always run.
+    /// </summary>
+    public enum ContinuationLane
+    {
+        Input,
+        Gameplay,
+        Background,
+    }
+
     public static class UnrealContextTaskExtension
     {
-        public static Task ConfigureWithUnrealContext(this Task task, NamedThread thread = NamedThread.GameThread, bool throwOnCancel = false)
+        public static Task ConfigureWithUnrealContext(this Task task, NamedThread thread = NamedThread.GameThread, bool throwOnCancel = false, 
+            ContinuationLane lane = ContinuationLane.Gameplay)
         {
             SynchronizationContext? previousContext = SynchronizationContext.Current;
-            UnrealSynchronizationContext unrealContext = new UnrealSynchronizationContext(thread, task);
+            UnrealSynchronizationContext unrealContext = new UnrealSynchronizationContext(thread, task, lane);
             SynchronizationContext.SetSynchronizationContext(unrealContext);
 
             return task.ContinueWith(t =>
@@ -80,13 +93,15 @@ namespace UnrealSharp
             });
         }
 
-        public static Task ConfigureWithUnrealContext(this ValueTask task, NamedThread thread = NamedThread.GameThread, bool throwOnCancel = false) 
-            => task.AsTask().ConfigureWithUnrealContext(thread, throwOnCancel);
+        public static Task ConfigureWithUnrealContext(this ValueTask task, NamedThread thread = NamedThread.GameThread, bool throwOnCancel = false, 
+            ContinuationLane lane = ContinuationLane.Gameplay) 
+            => task.AsTask().ConfigureWithUnrealContext(thread, throwOnCancel, lane);
 
-        public static Task<T> ConfigureWithUnrealContext<T>(this Task<T> task, NamedThread thread = NamedThread.GameThread, bool throwOnCancel = false)
+        public static Task<T> ConfigureWithUnrealContext<T>(this Task<T> task, NamedThread thread = NamedThread.GameThread, bool throwOnCancel = false, 
+            ContinuationLane lane = ContinuationLane.Gameplay)
         {
             SynchronizationContext? previousContext = SynchronizationContext.Current;
-            UnrealSynchronizationContext unrealContext = new UnrealSynchronizationContext(thread, task);
+            UnrealSynchronizationContext unrealContext = new UnrealSynchronizationContext(thread, task, lane);
             SynchronizationContext.SetSynchronizationContext(unrealContext);
 
             return task.ContinueWith(t =>
@@ -103,19 +118,44 @@ namespace UnrealSharp
         }
 
         public static Task<T> ConfigureWithUnrealContext<T>(this ValueTask<T> task, NamedThread thread = NamedThread.GameThread,
-            bool throwOnCancel = false)
-            => task.AsTask().ConfigureWithUnrealContext(thread, throwOnCancel);
+            bool throwOnCancel = false, ContinuationLane lane = ContinuationLane.Gameplay)
+            => task.AsTask().ConfigureWithUnrealContext(thread, throwOnCancel, lane);
+    }
+    
+    /// <summary>
+    /// Awaiting it resumes on the game thread next frame, from any thread.
+    /// </summary>
+    public readonly struct NextTickAwaitable : INotifyCompletion
+    {
+        public NextTickAwaitable GetAwaiter() => this;
+        public bool IsCompleted => false;
+
+        public void OnCompleted(Action continuation)
+        {
+            GCHandle callbackHandle = GCHandle.Alloc(continuation);
+            AsyncExporter.CallPostNextTickContinuation(GCHandle.ToIntPtr(callbackHandle));
+        }
+
+        public void GetResult()
+        {
+        }
     }
     
     public sealed class UnrealSynchronizationContext : SynchronizationContext
     {
         public static NamedThread CurrentThread => (NamedThread)AsyncExporter.CallGetCurrentNamedThread();
+
+        /// <summary>
+        /// await UnrealSynchronizationContext.NextTick(); is the game thread counterpart of await Task.Yield();
+        /// </summary>
+        public static NextTickAwaitable NextTick() => default;
         
         private readonly NamedThread _thread;
+        private readonly ContinuationLane _lane;
         private readonly TWeakObjectPtr<UObject> _worldContext;
         private IDisposable? _task;
 
-        public UnrealSynchronizationContext(NamedThread thread, IDisposable task)
+        public UnrealSynchronizationContext(NamedThread thread, IDisposable task, ContinuationLane lane = ContinuationLane.Gameplay)
         {
             if (FCSManagerExporter.WorldContextObject is not UObject worldContext || !worldContext.IsValid)
             {
@@ -123,6 +163,7 @@ namespace UnrealSharp
             }
             
             _thread = thread;
+            _lane = lane;
             _worldContext = new TWeakObjectPtr<UObject>(worldContext.World);
             _task = task;
         }
@@ -157,7 +198,16 @@ namespace UnrealSharp
             if (worldContextObject.IsValid())
             {
                 GCHandle callbackHandle = GCHandle.Alloc(callback);
-                AsyncExporter.CallRunOnThread(worldContextObject.Data, (int) thread, GCHandle.ToIntPtr(callbackHandle));
+
+                // Continuations on the game thread are budgeted per frame by the native scheduler.
+                if (((int) thread & (int) NamedThread.ThreadIndexMask) == (int) NamedThread.GameThread)
+                {
+                    AsyncExporter.CallPostGameThreadContinuation(worldContextObject.Data, (int) _lane, GCHandle.ToIntPtr(callbackHandle));
+                }
+                else
+                {
+                    AsyncExporter.CallRunOnThread(worldContextObject.Data, (int) thread, GCHandle.ToIntPtr(callbackHandle));
+                }
             }
             
             _task!.Dispose();
@@ -13,6 +13,79 @@ public struct WeakObjectData
     public int ObjectSerialNumber;
 }
 
+/// <summary>
+/// Where the serial number and flags of an object live in GUObjectArray. Mirrors FCSObjectArrayLayout.
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+public unsafe struct FObjectArrayLayout
+{
+    public IntPtr** Chunks;
+    public int NumElementsPerChunk;
+    public int MaxChunks;
+    public int ItemSize;
+    public int ObjectOffset;
+    public int FlagsOffset;
+    public int SerialNumberOffset;
+    public int GarbageFlag;
+    public int* UnreachableFlag;
+}
+
+/// <summary>
+/// Validates weak object pointers by reading GUObjectArray directly, the same way FWeakObjectPtr::IsValid does.
+/// </summary>
+internal static unsafe class WeakObjectValidation
+{
+    private static FObjectArrayLayout* _layout;
+
+    private static FObjectArrayLayout* Layout
+    {
+        get
+        {
+            if (_layout == null)
+            {
+                _layout = FWeakObjectPtrExporter.CallGetObjectArrayLayout();
+            }
+
+            return _layout;
+        }
+    }
+
+    public static bool IsValid(WeakObjectData data)
+    {
+        if (data.ObjectSerialNumber == 0 || data.ObjectIndex < 0)
+        {
+            return false;
+        }
+
+        FObjectArrayLayout* layout = Layout;
+        if (layout->Chunks == null)
+        {
+            return FWeakObjectPtrExporter.CallIsValid(data).ToManagedBool();
+        }
+
+        int chunkIndex = data.ObjectIndex / layout->NumElementsPerChunk;
+        if (chunkIndex >= layout->MaxChunks)
+        {
+            return false;
+        }
+
+        byte* chunk = (byte*) (*layout->Chunks)[chunkIndex];
+        if (chunk == null)
+        {
+            return false;
+        }
+
+        byte* item = chunk + (data.ObjectIndex % layout->NumElementsPerChunk) * layout->ItemSize;
+        if (*(int*) (item + layout->SerialNumberOffset) != data.ObjectSerialNumber || *(IntPtr*) (item + layout->ObjectOffset) == IntPtr.Zero)
+        {
+            return false;
+        }
+
+        int flags = *(int*) (item + layout->FlagsOffset);
+        return (flags & (layout->GarbageFlag | *layout->UnreachableFlag)) == 0;
+    }
+}
+
 /// <summary>
 /// A weak reference to an Unreal Engine UObject.
 /// </summary>
@@ -54,6 +127,11 @@ public struct TWeakObjectPtr<T> : IEquatable<TWeakObjectPtr<T>> where T : UObjec
     
     private T? Get()
     {
+        if (!WeakObjectValidation.IsValid(Data))
+        {
+            return null;
+        }
+        
         IntPtr handle = FWeakObjectPtrExporter.CallGetObject(Data);
         return GCHandleUtilities.GetObjectFromHandlePtr<T>(handle);
     }
@@ -64,7 +142,7 @@ public struct TWeakObjectPtr<T> : IEquatable<TWeakObjectPtr<T>> where T : UObjec
     /// <returns>True if the object is valid, false otherwise.</returns>
     public bool IsValid()
     {
-        return FWeakObjectPtrExporter.CallIsValid(Data).ToManagedBool();
+        return WeakObjectValidation.IsValid(Data);
     }
 
     /// <summary>
@@ -102,6 +180,12 @@ public struct TWeakObjectPtr<T> : IEquatable<TWeakObjectPtr<T>> where T : UObjec
     /// <inheritdoc />
     public bool Equals(TWeakObjectPtr<T> other)
     {
-        return FWeakObjectPtrExporter.CallNativeEquals(Data, other.Data).ToManagedBool();
+        // Same as FWeakObjectPtr::operator==, two invalid pointers are equal whatever they pointed to.
+        if (Data.ObjectIndex == other.Data.ObjectIndex && Data.ObjectSerialNumber == other.Data.ObjectSerialNumber)
+        {
+            return true;
+        }
+        
+        return !IsValid() && !other.IsValid();
     }
 }
\ No newline at end of file
@@ -38,6 +38,17 @@ public class BuildSolution : BuildToolAction
         buildSolutionProcess.StartInfo.ArgumentList.Add("--configuration");
         buildSolutionProcess.StartInfo.ArgumentList.Add(Program.GetBuildConfiguration(_buildConfig));
         buildSolutionProcess.StartInfo.WorkingDirectory = _folder;
+
+        // Build the projects as a graph, in parallel wherever their references allow it
+        buildSolutionProcess.StartInfo.ArgumentList.Add("-graph");
+        buildSolutionProcess.StartInfo.ArgumentList.Add("-m");
+
+        if (BuildServer.IsRunning)
+        {
+            // Keep the MSBuild nodes and the compiler server alive for the next request
+            buildSolutionProcess.StartInfo.ArgumentList.Add("-nodeReuse:true");
+            buildSolutionProcess.StartInfo.ArgumentList.Add("-p:UseSharedCompilation=true");
+        }
         
         if (_extraArguments != null)
         {
@@ -4,6 +4,12 @@ namespace UnrealSharpBuildTool.Actions;
 
 public class PackageProject : BuildToolAction
 {
+    // Lines starting with this are shown as the packaging progress in the editor, followed by "<step>/<steps> <description>"
+    public const string ProgressPrefix = "UnrealSharpPackageProgress=";
+
+    private int _step;
+    private int _stepCount;
+
     public override bool RunAction()
     {
         string archiveDirectoryPath = Program.TryGetArgument("ArchiveDirectory");
@@ -17,26 +23,64 @@ public class PackageProject : BuildToolAction
         string binariesPath = Program.GetOutputPath(rootProjectPath);
         string bindingsPath = Path.Combine(Program.BuildToolOptions.PluginDirectory, "Managed", "UnrealSharp");
         string bindingsOutputPath = Path.Combine(Program.BuildToolOptions.PluginDirectory, "Intermediate", "Build", "Managed");
+        bool readyToRun = Program.TryGetArgument("ReadyToRun") == "true";
+        bool compositeImage = Program.TryGetArgument("CompositeImage") == "true";
+        bool trim = Program.TryGetArgument("Trim") == "true";
+        List<string> profiles = readyToRun ? StartupProfiles.GetProfiles(Program.TryGetArgument("StartupProfileDirectory")) : [];
         
         Collection<string> extraArguments =
         [
             "--self-contained",
             "--runtime",
-            "win-x64",
+            ReadyToRunCompile.RuntimeIdentifier,
 			"-p:DisableWithEditor=true",
             $"-p:PublishDir=\"{binariesPath}\"",
             $"-p:OutputPath=\"{bindingsOutputPath}\"",
         ];
 
+        if (trim)
+        {
+            // Only the framework assemblies are trimmed. The bindings and the project assemblies are looked up by name from native code.
+            extraArguments.Add("-p:PublishTrimmed=true");
+            extraArguments.Add("-p:TrimMode=partial");
+        }
+
+        if (readyToRun)
+        {
+            // The bindings aren't woven, so the SDK can precompile them. This also restores the crossgen package.
+            extraArguments.Add("-p:PublishReadyToRun=true");
+
+            if (profiles.Count > 0)
+            {
+                extraArguments.Add($"-p:PublishReadyToRunCrossgen2ExtraArgs={StartupProfiles.GetCrossgenArguments(profiles)}");
+            }
+        }
+
+        _stepCount = readyToRun ? 3 : 2;
+
+        // The project assemblies reference the bindings in the plugin binaries, not the ones published here, so both can publish at once.
+        ReportProgress("Publishing assemblies");
         BuildSolution buildBindings = new BuildSolution(bindingsPath, extraArguments, BuildConfig.Publish);
-        buildBindings.RunAction();
-        
         BuildUserSolution buildUserSolution = new BuildUserSolution(null, BuildConfig.Publish);
-        buildUserSolution.RunAction();
-        
+        Task.WhenAll(Task.Run(() => buildBindings.RunAction()), Task.Run(() => buildUserSolution.RunAction())).GetAwaiter().GetResult();
+
+        ReportProgress("Weaving assemblies");
         WeaveProject weaveProject = new WeaveProject(binariesPath);
         weaveProject.RunAction();
+
+        if (readyToRun)
+        {
+            // The project assemblies can only be precompiled once they're woven.
+            ReportProgress("Precompiling assemblies");
+            ReadyToRunCompile readyToRunCompile = new ReadyToRunCompile(binariesPath, compositeImage, profiles);
+            readyToRunCompile.RunAction();
+        }
         
         return true;
     }
+
+    private void ReportProgress(string description)
+    {
+        Console.WriteLine($"{ProgressPrefix}{++_step}/{_stepCount} {description}");
+    }
 }
@@ -0,0 +1,179 @@
+using System.Runtime.ExceptionServices;
+
+namespace UnrealSharpBuildTool.Actions;
+
+/// <summary>
+/// Precompiles the woven project assemblies in place with crossgen2, so they start without being JIT compiled.
+/// The bindings in the same folder are only used as references, they're precompiled when they're published.
+/// </summary>
+public class ReadyToRunCompile : BuildToolAction
+{
+    public const string RuntimeIdentifier = "win-x64";
+    
+    private readonly string _binariesPath;
+    private readonly bool _compositeImage;
+    private readonly List<string> _profiles;
+
+    public ReadyToRunCompile(string binariesPath, bool compositeImage, List<string>? profiles = null)
+    {
+        _binariesPath = Program.FixPath(binariesPath);
+        _compositeImage = compositeImage;
+        _profiles = profiles ?? [];
+    }
+
+    public override bool RunAction()
+    {
+        List<string> projectAssemblies = GetProjectAssemblies();
+        if (projectAssemblies.Count == 0)
+        {
+            Console.WriteLine("No project assemblies found. Skipping ReadyToRun compilation...");
+            return true;
+        }
+
+        string crossgenPath = FindCrossgen();
+        string tempDirectory = Path.Combine(_binariesPath, "_ReadyToRun");
+        
+        if (Directory.Exists(tempDirectory))
+        {
+            Directory.Delete(tempDirectory, true);
+        }
+        
+        Directory.CreateDirectory(tempDirectory);
+
+        try
+        {
+            if (_compositeImage)
+            {
+                Compile(crossgenPath, projectAssemblies, tempDirectory, composite: true);
+            }
+            else
+            {
+                // Each assembly is its own crossgen process, so they can all compile at once.
+                try
+                {
+                    Parallel.ForEach(projectAssemblies, projectAssembly =>
+                    {
+                        Compile(crossgenPath, [projectAssembly], tempDirectory, composite: false);
+                    });
+                }
+                catch (AggregateException exception)
+                {
+                    ExceptionDispatchInfo.Capture(exception.InnerExceptions[0]).Throw();
+                }
+            }
+
+            // Crossgen can't write over its inputs, so the images are moved in once they're all done.
+            foreach (string compiledFile in Directory.GetFiles(tempDirectory))
+            {
+                File.Move(compiledFile, Path.Combine(_binariesPath, Path.GetFileName(compiledFile)), true);
+            }
+        }
+        finally
+        {
+            Directory.Delete(tempDirectory, true);
+        }
+
+        return true;
+    }
+
+    private List<string> GetProjectAssemblies()
+    {
+        DirectoryInfo scriptRootDirInfo = new DirectoryInfo(Program.GetProjectDirectory());
+        
+        return Program.GetProjectFilesByDirectory(scriptRootDirInfo).Values
+            .SelectMany(x => x)
+            .Select(projectFile => Path.Combine(_binariesPath, Path.GetFileNameWithoutExtension(projectFile.Name) + ".dll"))
+            .Where(File.Exists)
+            .ToList();
+    }
+
+    private void Compile(string crossgenPath, List<string> inputs, string outputDirectory, bool composite)
+    {
+        using BuildToolProcess crossgenProcess = crossgenPath.EndsWith(".dll") ? new BuildToolProcess() : new BuildToolProcess(crossgenPath);
+        
+        if (crossgenPath.EndsWith(".dll"))
+        {
+            crossgenProcess.StartInfo.ArgumentList.Add(crossgenPath);
+        }
+
+        foreach (string input in inputs)
+        {
+            crossgenProcess.StartInfo.ArgumentList.Add(input);
+        }
+
+        if (composite)
+        {
+            crossgenProcess.StartInfo.ArgumentList.Add("--composite");
+            crossgenProcess.StartInfo.ArgumentList.Add("--inputbubble");
+            // The rewritten component assemblies are written next to the composite image.
+            crossgenProcess.StartInfo.ArgumentList.Add("-o");
+            crossgenProcess.StartInfo.ArgumentList.Add(Path.Combine(outputDirectory, Program.BuildToolOptions.ProjectName + ".r2r.dll"));
+        }
+        else
+        {
+            crossgenProcess.StartInfo.ArgumentList.Add("-o");
+            crossgenProcess.StartInfo.ArgumentList.Add(Path.Combine(outputDirectory, Path.GetFileName(inputs[0])));
+        }
+
+        // Everything else in the folder is the published runtime and bindings the inputs depend on.
+        foreach (string reference in Directory.GetFiles(_binariesPath, "*.dll"))
+        {
+            if (inputs.Contains(reference))
+            {
+                continue;
+            }
+            
+            crossgenProcess.StartInfo.ArgumentList.Add("-r");
+            crossgenProcess.StartInfo.ArgumentList.Add(reference);
+        }
+
+        crossgenProcess.StartInfo.ArgumentList.Add("--targetos:windows");
+        crossgenProcess.StartInfo.ArgumentList.Add("--targetarch:x64");
+        crossgenProcess.StartInfo.ArgumentList.Add("-O");
+
+        foreach (string profile in _profiles)
+        {
+            crossgenProcess.StartInfo.ArgumentList.Add($"--mibc:{profile}");
+        }
+
+        if (_profiles.Count > 0)
+        {
+            crossgenProcess.StartInfo.ArgumentList.Add("--method-layout:hotcold");
+        }
+
+        crossgenProcess.StartBuildToolProcess();
+    }
+
+    private static string FindCrossgen()
+    {
+        string? packagesRoot = Environment.GetEnvironmentVariable("NUGET_PACKAGES");
+        if (string.IsNullOrEmpty(packagesRoot))
+        {
+            packagesRoot = Path.Combine(Environment.GetFolderPath(Environment.SpecialFolder.UserProfile), ".nuget", "packages");
+        }
+
+        string packageDirectory = Path.Combine(packagesRoot, "microsoft.netcore.app.crossgen2." + RuntimeIdentifier);
+        string versionPrefix = $"{Environment.Version.Major}.{Environment.Version.Minor}.";
+        
+        if (Directory.Exists(packageDirectory))
+        {
+            IEnumerable<DirectoryInfo> versions = new DirectoryInfo(packageDirectory).GetDirectories()
+                .Where(x => x.Name.StartsWith(versionPrefix))
+                .OrderByDescending(x => Version.TryParse(x.Name.Split('-')[0], out Version? version) ? version : new Version());
+            
+            foreach (DirectoryInfo version in versions)
+            {
+                foreach (string crossgenName in new[] { "crossgen2.dll", "crossgen2.exe" })
+                {
+                    string crossgenPath = Path.Combine(version.FullName, "tools", crossgenName);
+                    if (File.Exists(crossgenPath))
+                    {
+                        return crossgenPath;
+                    }
+                }
+            }
+        }
+
+        throw new Exception($"Couldn't find crossgen2 for {RuntimeIdentifier} in \"{packagesRoot}\". Publishing with ReadyToRun enabled restores it.");
+    }
+}
@@ -0,0 +1,50 @@
+namespace UnrealSharpBuildTool.Actions;
+
+/// <summary>
+/// Collects the method profiles recorded with -RecordManagedProfile for the ReadyToRun compiler.
+/// Recorded traces are converted to .mibc with dotnet-pgo, .mibc files in the folder are used as they are.
+/// </summary>
+public static class StartupProfiles
+{
+    public static List<string> GetProfiles(string profileDirectory)
+    {
+        profileDirectory = Program.FixPath(profileDirectory);
+        
+        if (string.IsNullOrEmpty(profileDirectory) || !Directory.Exists(profileDirectory))
+        {
+            return [];
+        }
+
+        foreach (string tracePath in Directory.GetFiles(profileDirectory, "*.nettrace"))
+        {
+            string mibcPath = Path.ChangeExtension(tracePath, ".mibc");
+            if (File.Exists(mibcPath) && File.GetLastWriteTimeUtc(mibcPath) >= File.GetLastWriteTimeUtc(tracePath))
+            {
+                continue;
+            }
+
+            try
+            {
+                using BuildToolProcess convertProcess = new BuildToolProcess("dotnet-pgo");
+                convertProcess.StartInfo.ArgumentList.Add("create-mibc");
+                convertProcess.StartInfo.ArgumentList.Add("--trace");
+                convertProcess.StartInfo.ArgumentList.Add(tracePath);
+                convertProcess.StartInfo.ArgumentList.Add("--output");
+                convertProcess.StartInfo.ArgumentList.Add(mibcPath);
+                convertProcess.StartBuildToolProcess();
+            }
+            catch (Exception exception)
+            {
+                // A missing profile only costs startup time, don't fail the package over it.
+                Console.WriteLine($"Couldn't convert {tracePath} to a profile, is dotnet-pgo installed? {exception.Message}");
+            }
+        }
+
+        return Directory.GetFiles(profileDirectory, "*.mibc").ToList();
+    }
+
+    public static string GetCrossgenArguments(List<string> profiles)
+    {
+        return string.Join(' ', profiles.Select(profile => $"--mibc:\"{profile}\"")) + " --method-layout:hotcold";
+    }
+}
@@ -0,0 +1,235 @@
+﻿using System.Collections.Concurrent;
+using System.Net;
+using System.Net.Sockets;
+using System.Text;
+using Newtonsoft.Json;
+
+namespace UnrealSharpBuildTool;
+
+public class BuildServerResponse
+{
+    public int ExitCode { get; set; }
+    public string Output { get; set; } = string.Empty;
+}
+
+// Keeps the build tool alive between invocations, so .NET startup is only paid once and the MSBuild nodes and compiler
+// server started by the builds stay warm. The editor talks to it over a loopback connection with length-prefixed
+// UTF-8 JSON frames:
+// - The editor sends the arguments of an invocation as an array, or "Cancel" to cancel the running one
+// - The server streams the output as { "Line": ... } frames, and ends the invocation with a BuildServerResponse
+public static class BuildServer
+{
+    // Written to the standard output once the server listens, the editor reads the port from it
+    public const string PortAnnouncement = "UnrealSharpBuildServerPort=";
+
+    private const string CancelRequest = "Cancel";
+
+    // Sanity limit for a single message
+    private const int MaxFrameSize = 64 * 1024 * 1024;
+
+    private static readonly TimeSpan ConnectTimeout = TimeSpan.FromMinutes(1);
+
+    private static readonly object WriteLock = new object();
+    private static BinaryWriter? _writer;
+    private static volatile bool _cancellationRequested;
+
+    public static bool IsRunning { get; private set; }
+
+    public static bool IsCancellationRequested => _cancellationRequested;
+
+    public static void ThrowIfCancellationRequested()
+    {
+        if (_cancellationRequested)
+        {
+            throw new OperationCanceledException("The build was canceled.");
+        }
+    }
+
+    public static int Run()
+    {
+        if (IsRunning)
+        {
+            throw new Exception("The build server is already running.");
+        }
+
+        IsRunning = true;
+
+        TcpListener listener = new TcpListener(IPAddress.Loopback, Program.BuildToolOptions.ServerPort);
+        listener.Start();
+
+        int port = ((IPEndPoint) listener.LocalEndpoint).Port;
+        Console.WriteLine(PortAnnouncement + port);
+        Console.Out.Flush();
+
+        // The server belongs to a single editor, and exits once its connection is closed
+        Task<TcpClient> acceptTask = listener.AcceptTcpClientAsync();
+        if (!acceptTask.Wait(ConnectTimeout))
+        {
+            listener.Stop();
+            Console.WriteLine("No editor connected to the build server, shutting down.");
+            return 1;
+        }
+
+        listener.Stop();
+
+        using TcpClient client = acceptTask.Result;
+        client.NoDelay = true;
+
+        using NetworkStream stream = client.GetStream();
+        using BinaryReader reader = new BinaryReader(stream, Encoding.UTF8, true);
+        using BinaryWriter writer = new BinaryWriter(stream, Encoding.UTF8, true);
+        _writer = writer;
+
+        // Frames are read on their own thread, so a cancel request can arrive while an invocation runs
+        using BlockingCollection<string[]> requests = new BlockingCollection<string[]>();
+        Task readTask = Task.Run(() => ReadRequests(reader, requests));
+
+        foreach (string[] args in requests.GetConsumingEnumerable())
+        {
+            _cancellationRequested = false;
+            WriteFrame(ExecuteRequest(args));
+        }
+
+        readTask.Wait();
+        return 0;
+    }
+
+    private static void ReadRequests(BinaryReader reader, BlockingCollection<string[]> requests)
+    {
+        while (TryReadFrame(reader, out byte[] frame))
+        {
+            string request = Encoding.UTF8.GetString(frame);
+            if (request.TrimStart().StartsWith('['))
+            {
+                requests.Add(JsonConvert.DeserializeObject<string[]>(request) ?? Array.Empty<string>());
+            }
+            else if (JsonConvert.DeserializeObject<string>(request) == CancelRequest)
+            {
+                _cancellationRequested = true;
+            }
+        }
+
+        // Let a running invocation stop early, nobody is waiting for it anymore
+        _cancellationRequested = true;
+        requests.CompleteAdding();
+    }
+
+    private static BuildServerResponse ExecuteRequest(string[] args)
+    {
+        // Everything the action writes is streamed to the editor instead of the standard output
+        TextWriter standardOutput = Console.Out;
+        TextWriter standardError = Console.Error;
+        using BuildServerOutputWriter output = new BuildServerOutputWriter();
+
+        Console.SetOut(output);
+        Console.SetError(output);
+
+        try
+        {
+            int exitCode = Program.Execute(args);
+            output.Flush();
+
+            return new BuildServerResponse
+            {
+                ExitCode = exitCode,
+                Output = output.GetOutput(),
+            };
+        }
+        finally
+        {
+            Console.SetOut(standardOutput);
+            Console.SetError(standardError);
+        }
+    }
+
+    public static void WriteFrame(object message)
+    {
+        byte[] data = Encoding.UTF8.GetBytes(JsonConvert.SerializeObject(message));
+
+        lock (WriteLock)
+        {
+            try
+            {
+                _writer!.Write(data.Length);
+                _writer.Write(data);
+                _writer.Flush();
+            }
+            catch (IOException)
+            {
+                // The editor is gone, the read thread ends the server
+            }
+        }
+    }
+
+    private static bool TryReadFrame(BinaryReader reader, out byte[] payload)
+    {
+        payload = Array.Empty<byte>();
+
+        try
+        {
+            int size = reader.ReadInt32();
+            if (size < 0 || size > MaxFrameSize)
+            {
+                return false;
+            }
+
+            payload = reader.ReadBytes(size);
+            return payload.Length == size;
+        }
+        catch (Exception exception) when (exception is EndOfStreamException or IOException)
+        {
+            return false;
+        }
+    }
+}
+
+// Sends every completed line to the editor as it's written, and keeps the whole output for the response
+public class BuildServerOutputWriter : TextWriter
+{
+    private readonly StringBuilder _output = new StringBuilder();
+    private readonly StringBuilder _line = new StringBuilder();
+
+    public override Encoding Encoding => Encoding.UTF8;
+
+    public override void Write(char value)
+    {
+        lock (_output)
+        {
+            _output.Append(value);
+
+            if (value == '\n')
+            {
+                SendLine();
+            }
+            else if (value != '\r')
+            {
+                _line.Append(value);
+            }
+        }
+    }
+
+    public override void Flush()
+    {
+        lock (_output)
+        {
+            if (_line.Length > 0)
+            {
+                SendLine();
+            }
+        }
+    }
+
+    public string GetOutput()
+    {
+        lock (_output)
+        {
+            return _output.ToString();
+        }
+    }
+
+    private void SendLine()
+    {
+        BuildServer.WriteFrame(new { Line = _line.ToString() });
+        _line.Clear();
+    }
+}
@@ -15,6 +15,7 @@ public enum BuildAction : int
     PackageProject,
     GenerateSolution,
     BuildWeave,
+    Serve,
 }
 
 public enum BuildConfig : int
@@ -26,7 +27,7 @@ public enum BuildConfig : int
 
 public class BuildToolOptions
 {
-    [Option("Action", Required = true, HelpText = "The action the build tool should process. Possible values: Build, Clean, GenerateProject, Rebuild, Weave, PackageProject, GenerateSolution, BuildWeave.")]
+    [Option("Action", Required = true, HelpText = "The action the build tool should process. Possible values: Build, Clean, GenerateProject, Rebuild, Weave, PackageProject, GenerateSolution, BuildWeave, Serve.")]
     public BuildAction Action { get; set; }
 
     [Option("DotNetPath", Required = false, HelpText = "The path to the dotnet.exe")]
@@ -44,6 +45,9 @@ public class BuildToolOptions
     [Option("ProjectName", Required = true, HelpText = "The name of the Unreal Engine project.")]
     public string ProjectName { get; set; } = string.Empty;
 
+    [Option("ServerPort", Required = false, HelpText = "The loopback port the Serve action listens on. 0 picks a free port.")]
+    public int ServerPort { get; set; }
+
     [Option("AdditionalArgs", Required = false, HelpText = "Additional key-value arguments for the build tool.")]
     public IEnumerable<string> AdditionalArgs { get; set; } = new List<string>();
 
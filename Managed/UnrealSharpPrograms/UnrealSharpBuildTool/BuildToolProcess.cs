@@ -32,12 +32,17 @@ public class BuildToolProcess : Process
     
     public bool StartBuildToolProcess()
     {
+        BuildServer.ThrowIfCancellationRequested();
+
+        // The build server streams the output to the editor as it comes, otherwise it's reported once the process failed
+        bool streamOutput = BuildServer.IsRunning;
+
         StringBuilder output = new StringBuilder();
         OutputDataReceived += (sender, e) =>
         {
             if (e.Data != null)
             {
-                output.AppendLine(e.Data);
+                OnOutputReceived(output, e.Data, streamOutput);
             }
         };
             
@@ -45,7 +50,7 @@ public class BuildToolProcess : Process
         {
             if (e.Data != null)
             {
-                output.AppendLine(e.Data);
+                OnOutputReceived(output, e.Data, streamOutput);
             }
         };
             
@@ -56,10 +61,27 @@ public class BuildToolProcess : Process
             
         BeginErrorReadLine();
         BeginOutputReadLine();
+
+        while (!WaitForExit(100))
+        {
+            if (BuildServer.IsCancellationRequested)
+            {
+                Kill(true);
+                WaitForExit();
+                BuildServer.ThrowIfCancellationRequested();
+            }
+        }
+
+        // Waits for the redirected output to be read to the end
         WaitForExit();
 
         if (ExitCode != 0)
         {
+            if (streamOutput)
+            {
+                throw new Exception($"BuildTool process failed with exit code {ExitCode}.");
+            }
+
             string errorMessage = output.ToString();
             if (string.IsNullOrEmpty(errorMessage))
             {
@@ -71,4 +93,18 @@ public class BuildToolProcess : Process
 
         return true;
     }
-}
\ No newline at end of file
+
+    private static void OnOutputReceived(StringBuilder output, string line, bool streamOutput)
+    {
+        if (streamOutput)
+        {
+            Console.WriteLine(line);
+            return;
+        }
+
+        lock (output)
+        {
+            output.AppendLine(line);
+        }
+    }
+}
@@ -10,6 +10,11 @@ public static class Program
     public static BuildToolOptions BuildToolOptions = null!;
 
     public static int Main(string[] args)
+    {
+        return Execute(args);
+    }
+
+    public static int Execute(string[] args)
     {
         try
         {
@@ -34,6 +39,11 @@ public static class Program
             }
 
             BuildToolOptions = result.Value;
+
+            if (BuildToolOptions.Action == BuildAction.Serve)
+            {
+                return BuildServer.Run();
+            }
             
             if (!BuildToolAction.InitializeAction())
             {
@@ -19,4 +19,7 @@ public class ApiMetaData
     public List<DelegateMetaData> DelegateMetaData { get; set; }
     
     public string AssemblyName { get; set; }
+
+    // Hash of all the type hashes, lets the engine skip the whole file when nothing changed.
+    public string? ContentHash { get; set; }
 }
\ No newline at end of file
@@ -0,0 +1,145 @@
+using System.Text;
+using System.Text.Json;
+
+namespace UnrealSharpWeaver.MetaData;
+
+/// <summary>
+/// Writes the assembly metadata as the binary value tree FCSBinaryMetaData reads in place (see CSMetaDataView.h).
+/// Nodes are written children first, so every node only refers to offsets that are already known.
+/// </summary>
+public static class BinaryMetaDataWriter
+{
+    private const uint Magic = 0x444D5355; // "USMD"
+    private const uint Version = 1;
+    private const int HeaderSize = 4 * sizeof(uint);
+
+    private enum NodeTag : byte
+    {
+        Null,
+        False,
+        True,
+        Number,
+        String,
+        Array,
+        Object,
+    }
+
+    public static void Write(JsonElement root, Stream output)
+    {
+        using BinaryWriter writer = new BinaryWriter(output, Encoding.UTF8, leaveOpen: true);
+        Dictionary<string, uint> stringIndices = new();
+        List<string> strings = new();
+
+        uint GetStringIndex(string value)
+        {
+            if (!stringIndices.TryGetValue(value, out uint index))
+            {
+                index = (uint) strings.Count;
+                stringIndices.Add(value, index);
+                strings.Add(value);
+            }
+
+            return index;
+        }
+
+        uint WriteNode(JsonElement element)
+        {
+            switch (element.ValueKind)
+            {
+                case JsonValueKind.Object:
+                {
+                    List<(uint Key, uint Value)> fields = new();
+                    foreach (JsonProperty property in element.EnumerateObject())
+                    {
+                        fields.Add((GetStringIndex(property.Name), WriteNode(property.Value)));
+                    }
+
+                    uint offset = (uint) writer.BaseStream.Position;
+                    writer.Write((byte) NodeTag.Object);
+                    writer.Write((uint) fields.Count);
+                    foreach ((uint key, uint value) in fields)
+                    {
+                        writer.Write(key);
+                        writer.Write(value);
+                    }
+
+                    return offset;
+                }
+                case JsonValueKind.Array:
+                {
+                    List<uint> elements = new();
+                    foreach (JsonElement arrayElement in element.EnumerateArray())
+                    {
+                        elements.Add(WriteNode(arrayElement));
+                    }
+
+                    uint offset = (uint) writer.BaseStream.Position;
+                    writer.Write((byte) NodeTag.Array);
+                    writer.Write((uint) elements.Count);
+                    foreach (uint elementOffset in elements)
+                    {
+                        writer.Write(elementOffset);
+                    }
+
+                    return offset;
+                }
+                case JsonValueKind.String:
+                {
+                    uint stringIndex = GetStringIndex(element.GetString()!);
+                    uint offset = (uint) writer.BaseStream.Position;
+                    writer.Write((byte) NodeTag.String);
+                    writer.Write(stringIndex);
+                    return offset;
+                }
+                case JsonValueKind.Number:
+                {
+                    uint offset = (uint) writer.BaseStream.Position;
+                    writer.Write((byte) NodeTag.Number);
+                    writer.Write(element.GetDouble());
+                    return offset;
+                }
+                default:
+                {
+                    uint offset = (uint) writer.BaseStream.Position;
+                    NodeTag tag = element.ValueKind switch
+                    {
+                        JsonValueKind.True => NodeTag.True,
+                        JsonValueKind.False => NodeTag.False,
+                        _ => NodeTag.Null,
+                    };
+                    
+                    writer.Write((byte) tag);
+                    return offset;
+                }
+            }
+        }
+
+        long start = writer.BaseStream.Position;
+        writer.Write(new byte[HeaderSize]);
+
+        uint rootOffset = WriteNode(root);
+
+        List<(uint Offset, uint Length)> stringEntries = new(strings.Count);
+        foreach (string value in strings)
+        {
+            byte[] bytes = Encoding.UTF8.GetBytes(value);
+            stringEntries.Add(((uint) writer.BaseStream.Position, (uint) bytes.Length));
+            writer.Write(bytes);
+        }
+
+        uint stringTableOffset = (uint) writer.BaseStream.Position;
+        writer.Write((uint) stringEntries.Count);
+        foreach ((uint offset, uint length) in stringEntries)
+        {
+            writer.Write(offset);
+            writer.Write(length);
+        }
+
+        writer.BaseStream.Position = start;
+        writer.Write(Magic);
+        writer.Write(Version);
+        writer.Write(stringTableOffset);
+        writer.Write(rootOffset);
+        writer.Flush();
+    }
+}
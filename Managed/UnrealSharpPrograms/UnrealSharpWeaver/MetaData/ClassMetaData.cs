@@ -1,4 +1,5 @@
 ﻿using Mono.Cecil;
+using Mono.Cecil.Cil;
 using Mono.Cecil.Rocks;
 using UnrealSharpWeaver.TypeProcessors;
 using UnrealSharpWeaver.Utilities;
@@ -15,6 +16,9 @@ public class ClassMetaData : TypeReferenceMetadata
     public string ConfigCategory { get; set; } 
     public ClassFlags ClassFlags { get; set; }
     
+    // The default constructor doesn't write to native memory, so the engine may create the C# object on first use instead of on construction.
+    public bool HasTrivialConstructor { get; set; }
+    
     // Non-serialized for JSON
     public bool HasProperties => Properties.Count > 0;
     private readonly TypeDefinition _classDefinition;
@@ -37,6 +41,8 @@ public class ClassMetaData : TypeReferenceMetadata
         
         AddConfigCategory();
         
+        HasTrivialConstructor = IsDefaultConstructorTrivial();
+        
         ParentClass = new TypeReferenceMetadata(type.BaseType.Resolve());
         ClassFlags |= GetClassFlags(type, AttributeName) | ClassFlags.CompiledFromBlueprint;
         
@@ -158,6 +164,44 @@ public class ClassMetaData : TypeReferenceMetadata
         }
     }
 
+    private bool IsDefaultConstructorTrivial()
+    {
+        MethodDefinition? constructor = _classDefinition.GetConstructors().FirstOrDefault(ctor => !ctor.IsStatic && !ctor.HasParameters);
+        if (constructor == null || !constructor.HasBody)
+        {
+            return false;
+        }
+        
+        HashSet<string> propertyBackingFields = Properties.Select(property => $"<{property.Name}>k__BackingField").ToHashSet();
+        bool baseConstructorCalled = false;
+        
+        foreach (Instruction instruction in constructor.Body.Instructions)
+        {
+            if (!baseConstructorCalled)
+            {
+                // Initializers of plain fields only touch the C# object, the ones of UProperties are moved after the base call and write to native memory.
+                if (instruction.OpCode == OpCodes.Stfld && instruction.Operand is FieldReference field && propertyBackingFields.Contains(field.Name))
+                {
+                    return false;
+                }
+                
+                if (instruction.OpCode == OpCodes.Call && instruction.Operand is MethodReference { Name: ".ctor" } baseConstructor)
+                {
+                    baseConstructorCalled = baseConstructor.DeclaringType.Resolve() == _classDefinition.BaseType.Resolve();
+                }
+                
+                continue;
+            }
+            
+            if (instruction.OpCode != OpCodes.Nop && instruction.OpCode != OpCodes.Ret)
+            {
+                return false;
+            }
+        }
+        
+        return baseConstructorCalled;
+    }
+
     private static ClassFlags GetClassFlags(TypeReference classReference, string flagsAttributeName)
     {
         return (ClassFlags) GetFlags(classReference.Resolve().CustomAttributes, flagsAttributeName);
@@ -0,0 +1,70 @@
+using System.Security.Cryptography;
+using System.Text;
+using System.Text.Json;
+using Mono.Cecil;
+using Mono.Cecil.Cil;
+
+namespace UnrealSharpWeaver.MetaData;
+
+/// <summary>
+/// Adds the content hashes the engine uses on hot reload to skip types that didn't change.
+/// The structure hash covers the metadata of the type, the function bodies hash covers the IL of its methods.
+/// </summary>
+public static class MetaDataHasher
+{
+    public static void AddContentHashes(ApiMetaData metadata)
+    {
+        IEnumerable<TypeReferenceMetadata> types = metadata.ClassMetaData
+            .Concat<TypeReferenceMetadata>(metadata.StructMetaData)
+            .Concat(metadata.EnumMetaData)
+            .Concat(metadata.InterfacesMetaData)
+            .Concat(metadata.DelegateMetaData);
+
+        using IncrementalHash contentHash = IncrementalHash.CreateHash(HashAlgorithmName.SHA1);
+
+        foreach (TypeReferenceMetadata type in types)
+        {
+            // Hashes from an earlier write are not part of the structure.
+            type.StructureHash = null;
+            type.FunctionBodiesHash = null;
+            
+            type.StructureHash = Convert.ToHexString(SHA1.HashData(JsonSerializer.SerializeToUtf8Bytes(type, type.GetType())));
+            type.FunctionBodiesHash = GetFunctionBodiesHash(type.TypeRef.Resolve());
+
+            contentHash.AppendData(Encoding.UTF8.GetBytes(type.StructureHash));
+            contentHash.AppendData(Encoding.UTF8.GetBytes(type.FunctionBodiesHash));
+        }
+
+        metadata.ContentHash = Convert.ToHexString(contentHash.GetHashAndReset());
+    }
+
+    private static string GetFunctionBodiesHash(TypeDefinition type)
+    {
+        using IncrementalHash hash = IncrementalHash.CreateHash(HashAlgorithmName.SHA1);
+        AppendFunctionBodies(hash, type);
+        return Convert.ToHexString(hash.GetHashAndReset());
+    }
+
+    private static void AppendFunctionBodies(IncrementalHash hash, TypeDefinition type)
+    {
+        foreach (MethodDefinition method in type.Methods)
+        {
+            if (!method.HasBody)
+            {
+                continue;
+            }
+
+            hash.AppendData(Encoding.UTF8.GetBytes(method.FullName));
+            foreach (Instruction instruction in method.Body.Instructions)
+            {
+                hash.AppendData(Encoding.UTF8.GetBytes(instruction.ToString()));
+            }
+        }
+
+        // Lambdas, iterators and async methods end up in compiler generated nested types.
+        foreach (TypeDefinition nestedType in type.NestedTypes)
+        {
+            AppendFunctionBodies(hash, nestedType);
+        }
+    }
+}
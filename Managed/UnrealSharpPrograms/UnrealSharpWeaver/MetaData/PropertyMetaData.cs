@@ -12,11 +12,15 @@ public class PropertyMetaData : BaseMetaData
     public NativeDataType PropertyDataType { get; set; } = null!;
     public string RepNotifyFunctionName { get; set; } = string.Empty;
     public LifetimeCondition LifetimeCondition { get; set; } = LifetimeCondition.None;
+    public bool IsPushBased { get; set; } = false;
     public string BlueprintSetter { get; set; } = string.Empty;
     public string BlueprintGetter { get; set; } = string.Empty;
     public bool HasCustomAccessors { get; set; } = false;
     [JsonIgnore]
     public PropertyDefinition? GeneratedAccessorProperty { get; set; } = null;
+    // Backing field of a property with custom accessors that is moved into the native property memory, see RegisterCustomAccessors.
+    [JsonIgnore]
+    public FieldDefinition? NativeBackingField { get; set; } = null;
 
     // Non-serialized for JSON
     public FieldDefinition? PropertyOffsetField;
@@ -94,12 +98,6 @@ public class PropertyMetaData : BaseMetaData
                 throw new InvalidPropertyException(property, "Setter can not have a body for Unreal properties unless it's a custom accessor");
             }
         }
-        else
-        {
-            // Register custom accessors as UFunctions if they have BlueprintGetter/Setter specified
-            RegisterPropertyAccessorAsUFunction(property.GetMethod, true);
-            RegisterPropertyAccessorAsUFunction(property.SetMethod, false);
-        }
         
         if (getter.IsPrivate && PropertyFlags.HasFlag(PropertyFlags.BlueprintVisible))
         {
@@ -110,6 +108,11 @@ public class PropertyMetaData : BaseMetaData
         }
         
         Initialize(property, property.PropertyType);
+
+        if (HasCustomAccessors)
+        {
+            RegisterCustomAccessors(property);
+        }
     }
 
     public PropertyMetaData(FieldDefinition property) : this((MemberReference) property)
@@ -187,6 +190,17 @@ public class PropertyMetaData : BaseMetaData
             RepNotifyFunctionName = notifyMethodName;
         }
         
+        CustomAttributeArgument? pushBasedArgument = upropertyAttribute.FindAttributeField("PushBased");
+        if (pushBasedArgument.HasValue && (bool) pushBasedArgument.Value.Value)
+        {
+            if (!flags.HasFlag(PropertyFlags.Net))
+            {
+                throw new InvalidPropertyException(property, $"{Name} is marked as push based but isn't replicated");
+            }
+
+            IsPushBased = true;
+        }
+        
         if (flags.HasFlag(PropertyFlags.Net) && !PropertyDataType.IsNetworkSupported)
         {
             throw new InvalidPropertyException(property, $"{Name} is marked as replicated but the {PropertyDataType.CSharpType} is not supported for replication");
@@ -239,6 +253,120 @@ public class PropertyMetaData : BaseMetaData
         return metadata;
     }
     
+    private void RegisterCustomAccessors(PropertyDefinition property)
+    {
+        // An accessor that only loads or stores a field doesn't need to run C# code, as long as the field lives in the native property memory.
+        // Only the accessor with a body is registered as a UFunction then, and reflection reads or writes the property memory for the other one.
+        FieldDefinition? getterField = GetTrivialAccessorField(property.GetMethod, true);
+        FieldDefinition? setterField = GetTrivialAccessorField(property.SetMethod, false);
+        FieldDefinition? backingField = getterField ?? setterField;
+        
+        if (backingField != null && (setterField == null || setterField == backingField) && CanMoveToNativeMemory(property, backingField))
+        {
+            NativeBackingField = backingField;
+        }
+        
+        if (NativeBackingField == null || getterField == null)
+        {
+            RegisterPropertyAccessorAsUFunction(property.GetMethod, true);
+        }
+        
+        if (NativeBackingField == null || setterField == null)
+        {
+            RegisterPropertyAccessorAsUFunction(property.SetMethod, false);
+        }
+    }
+    
+    // Returns the field of an accessor that is just "get => field" or "set => field = value".
+    private static FieldDefinition? GetTrivialAccessorField(MethodDefinition? accessor, bool isGetter)
+    {
+        if (accessor == null || !accessor.HasBody)
+        {
+            return null;
+        }
+        
+        Instruction[] instructions = accessor.Body.Instructions.Where(instruction => instruction.OpCode != OpCodes.Nop).ToArray();
+        OpCode[] expectedOpCodes = isGetter
+            ? [OpCodes.Ldarg_0, OpCodes.Ldfld, OpCodes.Ret]
+            : [OpCodes.Ldarg_0, OpCodes.Ldarg_1, OpCodes.Stfld, OpCodes.Ret];
+        
+        if (!instructions.Select(instruction => instruction.OpCode).SequenceEqual(expectedOpCodes))
+        {
+            return null;
+        }
+        
+        return ((FieldReference) instructions[^2].Operand).Resolve();
+    }
+    
+    private bool CanMoveToNativeMemory(PropertyDefinition property, FieldDefinition field)
+    {
+        TypeDefinition type = property.DeclaringType;
+        
+        if (!PropertyDataType.IsBlittable || type.IsValueType)
+        {
+            return false;
+        }
+        
+        if (field.IsStatic || !field.IsPrivate || field.DeclaringType != type || field.FieldType.FullName != property.PropertyType.FullName)
+        {
+            return false;
+        }
+        
+        // Loads and stores are redirected to the native memory, taking the address of the field can't be.
+        foreach (MethodDefinition method in GetMethodsWithAccessTo(type))
+        {
+            if (!method.HasBody)
+            {
+                continue;
+            }
+            
+            bool baseConstructorCalled = !method.IsConstructor || method.IsStatic || method.DeclaringType != type;
+            
+            foreach (Instruction instruction in method.Body.Instructions)
+            {
+                if (instruction.OpCode == OpCodes.Call && instruction.Operand is MethodReference { Name: ".ctor" } constructor)
+                {
+                    TypeDefinition? constructorType = constructor.DeclaringType.Resolve();
+                    baseConstructorCalled |= constructorType == type || constructorType == type.BaseType?.Resolve();
+                }
+                
+                if (instruction.Operand is not FieldReference fieldReference || fieldReference.Resolve() != field)
+                {
+                    continue;
+                }
+                
+                if (instruction.OpCode != OpCodes.Ldfld && instruction.OpCode != OpCodes.Stfld)
+                {
+                    return false;
+                }
+                
+                // Field initializers run before the native object is set.
+                if (!baseConstructorCalled)
+                {
+                    return false;
+                }
+            }
+        }
+        
+        return true;
+    }
+    
+    private static IEnumerable<MethodDefinition> GetMethodsWithAccessTo(TypeDefinition type)
+    {
+        foreach (MethodDefinition method in type.Methods)
+        {
+            yield return method;
+        }
+        
+        foreach (TypeDefinition nestedType in type.NestedTypes)
+        {
+            foreach (MethodDefinition method in GetMethodsWithAccessTo(nestedType))
+            {
+                yield return method;
+            }
+        }
+    }
+    
     private void RegisterPropertyAccessorAsUFunction(MethodDefinition accessorMethod, bool isGetter)
     {
         if (accessorMethod == null)
@@ -246,12 +374,15 @@ public class PropertyMetaData : BaseMetaData
             return;
         }
 
-        // Set the appropriate blueprint accessor name based on getter or setter
+        // Set the appropriate blueprint accessor name based on getter or setter, unless the attribute already named one
         if (isGetter)
         {
-            BlueprintGetter = accessorMethod.Name;
+            if (string.IsNullOrEmpty(BlueprintGetter))
+            {
+                BlueprintGetter = accessorMethod.Name;
+            }
         }
-        else
+        else if (string.IsNullOrEmpty(BlueprintSetter))
         {
             BlueprintSetter = accessorMethod.Name;
         }
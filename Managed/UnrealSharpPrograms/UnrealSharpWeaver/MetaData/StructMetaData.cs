@@ -76,6 +76,12 @@ public partial class StructMetaData : TypeReferenceMetadata
             StructFlags |= StructFlags.ZeroConstructor;
         }
 
+        // The native layout of the struct is reordered, so it can't be copied as is.
+        if (MetaData.ContainsKey("OptimizeLayout"))
+        {
+            IsBlittableStruct = false;
+        }
+        
         if (!IsBlittableStruct)
         {
             return;
@@ -1,4 +1,5 @@
-﻿using Mono.Cecil;
+﻿using System.Text.Json.Serialization;
+using Mono.Cecil;
 
 namespace UnrealSharpWeaver.MetaData;
 
@@ -7,6 +8,12 @@ public class TypeReferenceMetadata : BaseMetaData
     public string AssemblyName { get; set; }
     public string Namespace { get; set; }
     
+    // Only set on the types of the assembly, see MetaDataHasher.
+    [JsonIgnore(Condition = JsonIgnoreCondition.WhenWritingNull)]
+    public string? StructureHash { get; set; }
+    [JsonIgnore(Condition = JsonIgnoreCondition.WhenWritingNull)]
+    public string? FunctionBodiesHash { get; set; }
+    
     // Non-serialized for JSON
     public readonly TypeReference TypeRef;
     // End non-serialized
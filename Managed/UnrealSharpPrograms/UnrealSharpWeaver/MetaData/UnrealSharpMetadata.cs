@@ -3,4 +3,7 @@
 public class UnrealSharpMetadata
 {
     public ICollection<string> AssemblyLoadingOrder { get; set; } = [];
+    
+    // The user assemblies each user assembly references. Lets hot reload only cycle the assemblies affected by a change.
+    public Dictionary<string, List<string>> AssemblyReferences { get; set; } = [];
 }
\ No newline at end of file
@@ -1,3 +1,5 @@
+using System.Security.Cryptography;
+using System.Text;
 using System.Text.Json;
 using Mono.Cecil;
 using Mono.Cecil.Pdb;
@@ -87,10 +89,21 @@ public static class Program
 
     private static void WriteUnrealSharpMetadataFile(ICollection<AssemblyDefinition> orderedAssemblies, DirectoryInfo outputDirectory)
     {
+        Dictionary<string, string> userAssemblyNames = orderedAssemblies.ToDictionary(
+            x => x.FullName, 
+            x => Path.GetFileNameWithoutExtension(x.MainModule.FileName));
+        
         UnrealSharpMetadata unrealSharpMetadata = new UnrealSharpMetadata
         {
             AssemblyLoadingOrder = orderedAssemblies
                 .Select(x => Path.GetFileNameWithoutExtension(x.MainModule.FileName)).ToList(),
+            
+            AssemblyReferences = orderedAssemblies.ToDictionary(
+                x => Path.GetFileNameWithoutExtension(x.MainModule.FileName),
+                x => x.MainModule.AssemblyReferences
+                    .Where(reference => userAssemblyNames.ContainsKey(reference.FullName))
+                    .Select(reference => userAssemblyNames[reference.FullName])
+                    .ToList()),
         };
 
         string metaDataContent = JsonSerializer.Serialize(unrealSharpMetadata, new JsonSerializerOptions
@@ -98,8 +111,12 @@ public static class Program
             WriteIndented = false,
         });
 
+        // Left untouched when nothing changed, so its timestamp doesn't suggest otherwise.
         string fileName = Path.Combine(outputDirectory.FullName, "UnrealSharp.assemblyloadorder.json");
-        File.WriteAllText(fileName, metaDataContent);
+        if (!File.Exists(fileName) || File.ReadAllText(fileName) != metaDataContent)
+        {
+            File.WriteAllText(fileName, metaDataContent);
+        }
     }
 
     private static void ProcessOrderedAssemblies(ICollection<AssemblyDefinition> assemblies, DirectoryInfo outputDirectory)
@@ -116,7 +133,20 @@ public static class Program
             try
             {
                 string outputPath = Path.Combine(outputDirectory.FullName, Path.GetFileName(assembly.MainModule.FileName));
+                string inputHashPath = Path.ChangeExtension(outputPath, "weaverinput");
+                string inputHash = GetWeaverInputHash(assembly);
+
+                if (IsWeavedOutputUpToDate(outputPath, inputHashPath, inputHash))
+                {
+                    Console.WriteLine($"{assembly.Name.Name} is up to date, skipping weaving.");
+                    CopyAssemblyDependencies(outputPath, Path.GetDirectoryName(assembly.MainModule.FileName)!);
+                    continue;
+                }
+
+                // A failed weave must not leave a hash behind that matches the next attempt
+                File.Delete(inputHashPath);
                 StartWeavingAssembly(assembly, outputPath);
+                File.WriteAllText(inputHashPath, inputHash);
             }
             catch (Exception ex)
             {
@@ -136,6 +166,66 @@ public static class Program
         }
     }
 
+    // Hash of everything the woven output depends on: the compiled assembly, the versions of the assemblies it
+    // references and the weaver itself.
+    private static string GetWeaverInputHash(AssemblyDefinition assembly)
+    {
+        using IncrementalHash hash = IncrementalHash.CreateHash(HashAlgorithmName.SHA256);
+
+        hash.AppendData(typeof(Program).Assembly.ManifestModule.ModuleVersionId.ToByteArray());
+        hash.AppendData(File.ReadAllBytes(assembly.MainModule.FileName));
+
+        string pdbPath = Path.ChangeExtension(assembly.MainModule.FileName, ".pdb");
+        if (File.Exists(pdbPath))
+        {
+            hash.AppendData(File.ReadAllBytes(pdbPath));
+        }
+
+        foreach (AssemblyNameReference reference in assembly.MainModule.AssemblyReferences)
+        {
+            hash.AppendData(Encoding.UTF8.GetBytes(GetReferenceVersion(reference)));
+        }
+
+        return Convert.ToHexString(hash.GetHashAndReset());
+    }
+
+    private static string GetReferenceVersion(AssemblyNameReference reference)
+    {
+        // User assemblies are already loaded, the bindings and other references are resolved from the search paths.
+        AssemblyDefinition? projectAssembly = WeaverImporter.Instance.AllProjectAssemblies.FirstOrDefault(x => x.FullName == reference.FullName);
+        if (projectAssembly != null)
+        {
+            return projectAssembly.MainModule.Mvid.ToString();
+        }
+
+        try
+        {
+            AssemblyDefinition? resolvedAssembly = GetAssemblyResolver().Resolve(reference);
+            if (resolvedAssembly != null)
+            {
+                return resolvedAssembly.MainModule.Mvid.ToString();
+            }
+        }
+        catch (AssemblyResolutionException)
+        {
+            // Framework assemblies aren't in the search paths, their full name is enough.
+        }
+
+        return reference.FullName;
+    }
+
+    private static bool IsWeavedOutputUpToDate(string outputPath, string inputHashPath, string inputHash)
+    {
+        if (!File.Exists(inputHashPath) || File.ReadAllText(inputHashPath) != inputHash)
+        {
+            return false;
+        }
+
+        return File.Exists(outputPath)
+               && File.Exists(Path.ChangeExtension(outputPath, "metadata.json"))
+               && File.Exists(Path.ChangeExtension(outputPath, "metadata.bin"));
+    }
+
     private static ICollection<AssemblyDefinition> OrderInputAssembliesByReferences(ICollection<AssemblyDefinition> assemblies)
     {
         HashSet<string> assemblyNames = new HashSet<string>();
@@ -338,13 +428,20 @@ public static class Program
 
     private static void WriteAssemblyMetaDataFile(ApiMetaData metadata, string outputPath)
     {
-        string metaDataContent = JsonSerializer.Serialize(metadata, new JsonSerializerOptions
+        MetaDataHasher.AddContentHashes(metadata);
+        
+        JsonElement metaDataContent = JsonSerializer.SerializeToElement(metadata, new JsonSerializerOptions
         {
             WriteIndented = false,
         });
 
+        // The JSON file is kept as a fallback and for debugging, the engine prefers the binary file.
         string metadataFilePath = Path.ChangeExtension(outputPath, "metadata.json");
-        File.WriteAllText(metadataFilePath, metaDataContent);
+        File.WriteAllText(metadataFilePath, metaDataContent.GetRawText());
+
+        string binaryMetadataFilePath = Path.ChangeExtension(outputPath, "metadata.bin");
+        using FileStream binaryMetadataFile = File.Create(binaryMetadataFilePath);
+        BinaryMetaDataWriter.Write(metaDataContent, binaryMetadataFile);
     }
 
     private static void StartProcessingAssembly(AssemblyDefinition userAssembly, ApiMetaData metadata)
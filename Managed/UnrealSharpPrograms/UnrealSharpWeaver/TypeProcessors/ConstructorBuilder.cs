@@ -88,7 +88,7 @@ public static class ConstructorBuilder
         ILProcessor processor = staticConstructor.Body.GetILProcessor();
         foreach (var property in fields)
         {
-            if (property.HasCustomAccessors) 
+            if (property.HasCustomAccessors && property.NativeBackingField == null) 
             {
                 continue;
             }
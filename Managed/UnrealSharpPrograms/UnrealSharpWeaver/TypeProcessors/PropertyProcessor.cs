@@ -20,6 +20,11 @@ public static class PropertyProcessor
         {
             if (prop.HasCustomAccessors)
             {
+                if (prop.NativeBackingField != null)
+                {
+                    MoveBackingFieldToNativeMemory(type, prop, propertyOffsetsToInitialize, propertyPointersToInitialize);
+                }
+                
                 continue;
             }
             
@@ -34,6 +39,15 @@ public static class PropertyProcessor
                 propertyPointersToInitialize.Add(Tuple.Create(nativePropertyField, prop));
             }
 
+            // Push based properties need their FProperty to be marked dirty when they're set.
+            bool markDirty = !type.IsValueType && prop.IsPushBased;
+            if (markDirty && prop.NativePropertyField == null)
+            {
+                FieldDefinition replicatedPropertyField = CreateNativePropertyField(type, prop, WeaverImporter.Instance.IntPtrType);
+                prop.NativePropertyField = replicatedPropertyField;
+                propertyPointersToInitialize.Add(Tuple.Create(replicatedPropertyField, prop));
+            }
+
             if (prop.MemberRef == null)
             {
                 throw new InvalidDataException($"Property '{prop.Name}' does not have a member reference");
@@ -49,6 +63,11 @@ public static class PropertyProcessor
                 prop.PropertyDataType.WriteGetter(type, propertyRef.GetMethod, loadBuffer, nativePropertyField);
                 if (propertyRef.SetMethod is not null) {
                   prop.PropertyDataType.WriteSetter(type, propertyRef.SetMethod, loadBuffer, nativePropertyField);
+
+                  if (markDirty)
+                  {
+                      WriteMarkPropertyDirty(propertyRef.SetMethod, prop.NativePropertyField!);
+                  }
                 }
                 
                 string backingFieldName = RemovePropertyBackingField(type, prop);
@@ -61,6 +80,74 @@ public static class PropertyProcessor
         RemoveBackingFieldReferences(type, removedBackingFields);
     }
     
+    // Stores the backing field of a property with custom accessors in the native property memory, so the trivial accessor
+    // can be read or written without calling into C#. Every load and store of the field goes through native accessors instead.
+    private static void MoveBackingFieldToNativeMemory(TypeDefinition type, PropertyMetaData prop,
+        List<Tuple<FieldDefinition, PropertyMetaData>> propertyOffsetsToInitialize,
+        List<Tuple<FieldDefinition, PropertyMetaData>> propertyPointersToInitialize)
+    {
+        FieldDefinition backingField = prop.NativeBackingField!;
+        FieldDefinition offsetField = AddOffsetField(type, prop, WeaverImporter.Instance.Int32TypeRef);
+        FieldDefinition? nativePropertyField = AddNativePropertyField(type, prop, WeaverImporter.Instance.IntPtrType);
+        
+        propertyOffsetsToInitialize.Add(Tuple.Create(offsetField, prop));
+        
+        if (nativePropertyField != null)
+        {
+            prop.NativePropertyField = nativePropertyField;
+            propertyPointersToInitialize.Add(Tuple.Create(nativePropertyField, prop));
+        }
+        
+        prop.PropertyDataType.PrepareForRewrite(type, prop, prop.MemberRef!);
+        
+        Instruction[] loadBuffer = NativeDataType.GetArgumentBufferInstructions(null, offsetField);
+        
+        MethodDefinition nativeGetter = type.AddMethod($"Get{prop.Name}_Native", backingField.FieldType, MethodAttributes.Private | MethodAttributes.HideBySig);
+        prop.PropertyDataType.WriteGetter(type, nativeGetter, loadBuffer, nativePropertyField);
+        
+        MethodDefinition nativeSetter = type.AddMethod($"Set{prop.Name}_Native", null, MethodAttributes.Private | MethodAttributes.HideBySig, backingField.FieldType);
+        prop.PropertyDataType.WriteSetter(type, nativeSetter, loadBuffer, nativePropertyField);
+        
+        // The native accessors take the same arguments off the stack as the field access they replace.
+        foreach (MethodDefinition method in GetMethodsWithBodies(type))
+        {
+            if (method == nativeGetter || method == nativeSetter)
+            {
+                continue;
+            }
+            
+            foreach (Instruction instruction in method.Body.Instructions)
+            {
+                if (instruction.Operand is not FieldReference field || field.Resolve() != backingField)
+                {
+                    continue;
+                }
+                
+                instruction.Operand = instruction.OpCode == OpCodes.Ldfld ? nativeGetter : nativeSetter;
+                instruction.OpCode = OpCodes.Call;
+            }
+        }
+        
+        type.Fields.Remove(backingField);
+        prop.PropertyOffsetField = offsetField;
+    }
+    
+    private static IEnumerable<MethodDefinition> GetMethodsWithBodies(TypeDefinition type)
+    {
+        foreach (MethodDefinition method in type.Methods.Where(method => method.HasBody))
+        {
+            yield return method;
+        }
+        
+        foreach (TypeDefinition nestedType in type.NestedTypes)
+        {
+            foreach (MethodDefinition method in GetMethodsWithBodies(nestedType))
+            {
+                yield return method;
+            }
+        }
+    }
+    
     private static void RemoveBackingFieldReferences(TypeDefinition type, Dictionary<string, (PropertyMetaData, PropertyDefinition, FieldDefinition, FieldDefinition?)> strippedFields)
     {
         foreach (MethodDefinition? method in type.GetConstructors().ToArray())
@@ -240,11 +327,54 @@ public static class PropertyProcessor
             return null;
         }
 
+        return CreateNativePropertyField(type, prop, intPtrTypeRef);
+    }
+
+    private static FieldDefinition CreateNativePropertyField(TypeDefinition type, PropertyMetaData prop, TypeReference intPtrTypeRef)
+    {
         FieldDefinition field = new FieldDefinition(prop.Name + "_NativeProperty", FieldAttributes.InitOnly | FieldAttributes.Static | FieldAttributes.Private, intPtrTypeRef);
         type.Fields.Add(field);
         return field;
     }
 
+    // Calls UObjectExporter.CallMarkPropertyDirty(NativeObject, NativeProperty) before every return of the setter.
+    private static void WriteMarkPropertyDirty(MethodDefinition setter, FieldDefinition nativePropertyField)
+    {
+        setter.Body.SimplifyMacros();
+        ILProcessor processor = setter.Body.GetILProcessor();
+
+        Instruction[] returns = setter.Body.Instructions.Where(instruction => instruction.OpCode == OpCodes.Ret).ToArray();
+        foreach (Instruction ret in returns)
+        {
+            Instruction markDirty = processor.Create(OpCodes.Ldarg_0);
+            processor.InsertBefore(ret, markDirty);
+            processor.InsertBefore(ret, processor.Create(OpCodes.Call, WeaverImporter.Instance.NativeObjectGetter));
+            processor.InsertBefore(ret, processor.Create(OpCodes.Ldsfld, nativePropertyField));
+            processor.InsertBefore(ret, processor.Create(OpCodes.Call, WeaverImporter.Instance.MarkPropertyDirtyMethod));
+
+            // Branches to the return have to run the dirty marking too.
+            foreach (Instruction instruction in setter.Body.Instructions)
+            {
+                if (instruction.Operand == ret)
+                {
+                    instruction.Operand = markDirty;
+                }
+                else if (instruction.Operand is Instruction[] targets)
+                {
+                    for (int i = 0; i < targets.Length; i++)
+                    {
+                        if (targets[i] == ret)
+                        {
+                            targets[i] = markDirty;
+                        }
+                    }
+                }
+            }
+        }
+
+        setter.OptimizeMethod();
+    }
+
     public static bool IsLdconst(Instruction ldconst)
     {
         return ldconst.OpCode.Op1 == 0xff && ldconst.OpCode.Op2 >= 0x14 && ldconst.OpCode.Op2 <= 0x23;
@@ -71,6 +71,7 @@ public class WeaverImporter
     public MethodReference InvokeNativeFunctionMethod = null!;
     public MethodReference InvokeNativeNetFunction = null!;
     public MethodReference InvokeNativeFunctionOutParms = null!;
+    public MethodReference MarkPropertyDirtyMethod = null!;
 
     public MethodReference GeneratedTypeCtor = null!;
     
@@ -149,6 +150,7 @@ public class WeaverImporter
         InvokeNativeFunctionMethod = FindExporterMethod(UObjectCallbacks, "CallInvokeNativeFunction");
         InvokeNativeNetFunction = FindExporterMethod(UObjectCallbacks, "CallInvokeNativeNetFunction");
         InvokeNativeFunctionOutParms = FindExporterMethod(UObjectCallbacks, "CallInvokeNativeFunctionOutParms");
+        MarkPropertyDirtyMethod = FindExporterMethod(UObjectCallbacks, "CallMarkPropertyDirty");
         
         GetSignatureFunction = FindExporterMethod(MulticastDelegatePropertyCallbacks, "CallGetSignatureFunction");
         
@@ -1,4 +1,6 @@
 ﻿#include "CSAsyncActionBase.h"
+#include "CSAsyncActionPool.h"
+#include "CSManager.h"
 #include "UnrealSharpAsync.h"
 
 void UCSAsyncActionBase::Destroy()
@@ -9,6 +11,13 @@ void UCSAsyncActionBase::Destroy()
 	}
 
 	ManagedCallback.Dispose();
+
+	UCSAsyncActionPool* Pool = Cast<UCSAsyncActionPool>(GetOuter());
+	if (Pool && Pool->Release(this))
+	{
+		return;
+	}
+	
 	MarkAsGarbage();
 }
 
@@ -42,3 +51,28 @@ void UUCSAsyncBaseExporter::InitializeAsyncObject(UCSAsyncActionBase* AsyncActio
 	
 	AsyncAction->InitializeManagedCallback(Callback);
 }
+
+void* UUCSAsyncBaseExporter::AcquireAsyncAction(UObject* WorldContextObject, UClass* Class)
+{
+	if (!IsValid(WorldContextObject) || !Class || !Class->IsChildOf<UCSAsyncActionBase>())
+	{
+		UE_LOG(LogUnrealSharpAsync, Warning, TEXT("UUCSAsyncBaseExporter::AcquireAsyncAction: Invalid world context or class"));
+		return nullptr;
+	}
+
+	UCSAsyncActionBase* AsyncAction = nullptr;
+
+	const UWorld* World = WorldContextObject->GetWorld();
+	const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	
+	if (UCSAsyncActionPool* Pool = GameInstance ? GameInstance->GetSubsystem<UCSAsyncActionPool>() : nullptr)
+	{
+		AsyncAction = Pool->Acquire(Class);
+	}
+	else
+	{
+		AsyncAction = NewObject<UCSAsyncActionBase>(WorldContextObject, Class);
+	}
+	
+	return UCSManager::Get().FindManagedObject(AsyncAction);
+}
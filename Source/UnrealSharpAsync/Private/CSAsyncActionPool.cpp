@@ -0,0 +1,58 @@
+#include "CSAsyncActionPool.h"
+#include "CSAsyncActionBase.h"
+
+void UCSAsyncActionPool::Deinitialize()
+{
+	bDeinitialized = true;
+
+	for (TPair<TObjectPtr<UClass>, FCSPooledAsyncActions>& Pair : PooledActions)
+	{
+		for (UCSAsyncActionBase* Action : Pair.Value.Actions)
+		{
+			Action->MarkAsGarbage();
+		}
+	}
+	
+	PooledActions.Empty();
+	Super::Deinitialize();
+}
+
+UCSAsyncActionBase* UCSAsyncActionPool::Acquire(UClass* Class)
+{
+	if (FCSPooledAsyncActions* Pool = PooledActions.Find(Class))
+	{
+		while (!Pool->Actions.IsEmpty())
+		{
+			UCSAsyncActionBase* Action = Pool->Actions.Pop();
+			if (IsValid(Action))
+			{
+				return Action;
+			}
+		}
+	}
+
+	return NewObject<UCSAsyncActionBase>(this, Class);
+}
+
+bool UCSAsyncActionPool::Release(UCSAsyncActionBase* Action)
+{
+	if (bDeinitialized)
+	{
+		return false;
+	}
+
+	FCSPooledAsyncActions& Pool = PooledActions.FindOrAdd(Action->GetClass());
+	if (Pool.Actions.Contains(Action))
+	{
+		return true;
+	}
+	
+	if (Pool.Actions.Num() >= MaxPooledActionsPerClass)
+	{
+		return false;
+	}
+
+	Action->ResetForReuse();
+	Pool.Actions.Add(Action);
+	return true;
+}
@@ -4,10 +4,20 @@
 void UCSAsyncLoadPrimaryDataAssets::LoadPrimaryDataAssets(const TArray<FPrimaryAssetId>& AssetIds, const TArray<FName>& AssetBundles)
 {
 	UAssetManager& AssetManager = UAssetManager::Get();
-	AssetManager.LoadPrimaryAssets(AssetIds, AssetBundles, FStreamableDelegate::CreateUObject(this, &UCSAsyncLoadPrimaryDataAssets::OnPrimaryDataAssetsLoaded));
+	StreamableHandle = AssetManager.LoadPrimaryAssets(AssetIds, AssetBundles, FStreamableDelegate::CreateUObject(this, &UCSAsyncLoadPrimaryDataAssets::OnPrimaryDataAssetsLoaded));
 }
 
 void UCSAsyncLoadPrimaryDataAssets::OnPrimaryDataAssetsLoaded()
 {
+	StreamableHandle.Reset();
 	InvokeManagedCallback();
 }
+
+void UCSAsyncLoadPrimaryDataAssets::ResetForReuse()
+{
+	if (StreamableHandle.IsValid())
+	{
+		StreamableHandle->CancelHandle();
+		StreamableHandle.Reset();
+	}
+}
@@ -4,12 +4,22 @@
 
 void UCSAsyncLoadSoftPtr::LoadSoftObjectPaths(const TArray<FSoftObjectPath>& SoftObjectPtr)
 {
-	UAssetManager::Get().GetStreamableManager().RequestAsyncLoad(SoftObjectPtr,
+	StreamableHandle = UAssetManager::Get().GetStreamableManager().RequestAsyncLoad(SoftObjectPtr,
 	FStreamableDelegate::CreateUObject(this, &UCSAsyncLoadSoftPtr::OnAsyncLoadComplete));
 }
 
 void UCSAsyncLoadSoftPtr::OnAsyncLoadComplete()
 {
+	StreamableHandle.Reset();
 	InvokeManagedCallback();
 }
 
+void UCSAsyncLoadSoftPtr::ResetForReuse()
+{
+	if (StreamableHandle.IsValid())
+	{
+		StreamableHandle->CancelHandle();
+		StreamableHandle.Reset();
+	}
+}
+
@@ -0,0 +1,113 @@
+#include "CSStreamingBatchExporter.h"
+#include "CSManagedDelegate.h"
+#include "CSGameThreadContinuations.h"
+#include "Engine/AssetManager.h"
+
+void FCSStreamingBatch::NotifyManaged()
+{
+	if (bNotified)
+	{
+		return;
+	}
+
+	bNotified = true;
+	FCSManagedDelegate(Callback).Invoke(nullptr, false);
+}
+
+FCSStreamingBatch* UCSStreamingBatchExporter::RequestAsyncLoad(const FName* AssetPathNames, int32 NumAssets, int32 Priority, FGCHandleIntPtr Callback)
+{
+	TArray<FSoftObjectPath> AssetPaths;
+	AssetPaths.Reserve(NumAssets);
+
+	for (int32 i = 0; i < NumAssets; ++i)
+	{
+		const FName PackageName = AssetPathNames[i * 2];
+		const FName AssetName = AssetPathNames[i * 2 + 1];
+		AssetPaths.Emplace(FTopLevelAssetPath(PackageName, AssetName));
+	}
+
+	TSharedRef<FCSStreamingBatch> Batch = MakeShared<FCSStreamingBatch>();
+	Batch->Callback = FGCHandle(Callback, GCHandleType::StrongHandle);
+	Batch->ManagedReference = Batch;
+
+	TWeakPtr<FCSStreamingBatch> WeakBatch = Batch;
+	FStreamableDelegate OnFinished = FStreamableDelegate::CreateLambda([WeakBatch]()
+	{
+		if (TSharedPtr<FCSStreamingBatch> PinnedBatch = WeakBatch.Pin())
+		{
+			PinnedBatch->NotifyManaged();
+		}
+	});
+
+	Batch->Handle = UAssetManager::Get().GetStreamableManager().RequestAsyncLoad(MoveTemp(AssetPaths), OnFinished, Priority);
+
+	if (Batch->Handle.IsValid())
+	{
+		Batch->Handle->BindCancelDelegate(OnFinished);
+	}
+	else
+	{
+		// Nothing valid to load, finish on the next tick like a load that completed right away.
+		FCSGameThreadContinuations::PostNextTick([](void* Payload, UObject* WorldContextObject, bool bCancelled)
+		{
+			TWeakPtr<FCSStreamingBatch>* WeakBatchPtr = static_cast<TWeakPtr<FCSStreamingBatch>*>(Payload);
+			if (TSharedPtr<FCSStreamingBatch> PinnedBatch = WeakBatchPtr->Pin(); PinnedBatch && !bCancelled)
+			{
+				PinnedBatch->NotifyManaged();
+			}
+			delete WeakBatchPtr;
+		}, new TWeakPtr<FCSStreamingBatch>(Batch));
+	}
+
+	return &Batch.Get();
+}
+
+float UCSStreamingBatchExporter::GetProgress(FCSStreamingBatch* Batch)
+{
+	return Batch->Handle.IsValid() ? Batch->Handle->GetProgress() : 1.0f;
+}
+
+void UCSStreamingBatchExporter::GetLoadedCount(FCSStreamingBatch* Batch, int32* OutLoaded, int32* OutRequested)
+{
+	if (!Batch->Handle.IsValid())
+	{
+		*OutLoaded = 0;
+		*OutRequested = 0;
+		return;
+	}
+
+	Batch->Handle->GetLoadedCount(*OutLoaded, *OutRequested);
+}
+
+bool UCSStreamingBatchExporter::HasLoadCompleted(FCSStreamingBatch* Batch)
+{
+	return !Batch->Handle.IsValid() || Batch->Handle->HasLoadCompleted();
+}
+
+bool UCSStreamingBatchExporter::WasCanceled(FCSStreamingBatch* Batch)
+{
+	return Batch->Handle.IsValid() && Batch->Handle->WasCanceled();
+}
+
+void UCSStreamingBatchExporter::CancelLoad(FCSStreamingBatch* Batch)
+{
+	if (Batch->Handle.IsValid() && Batch->Handle->IsLoadingInProgress())
+	{
+		Batch->Handle->CancelHandle();
+	}
+}
+
+void UCSStreamingBatchExporter::ReleaseBatch(FCSStreamingBatch* Batch)
+{
+	// Don't call back into managed code that is done with the batch.
+	Batch->bNotified = true;
+	Batch->Callback.Dispose();
+
+	if (Batch->Handle.IsValid() && Batch->Handle->IsLoadingInProgress())
+	{
+		Batch->Handle->CancelHandle();
+	}
+
+	// Last reference, unless the streamable manager is running one of our delegates right now.
+	Batch->ManagedReference.Reset();
+}
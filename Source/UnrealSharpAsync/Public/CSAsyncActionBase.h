@@ -18,9 +18,13 @@ public:
 	void Destroy();
 protected:
 	friend class UUCSAsyncBaseExporter;
+	friend class UCSAsyncActionPool;
 
 	void InvokeManagedCallback(bool bDispose = true);
 	void InitializeManagedCallback(FGCHandleIntPtr Callback);
+
+	// Called when a destroyed action goes back to its pool. Stop anything that could still call back into this action.
+	virtual void ResetForReuse() {}
 	
 	FCSManagedDelegate ManagedCallback;
 };
@@ -32,4 +36,8 @@ class UUCSAsyncBaseExporter : public UObject
 public:
 	UNREALSHARP_FUNCTION()
 	static void InitializeAsyncObject(UCSAsyncActionBase* AsyncAction, FGCHandleIntPtr Callback);
+
+	// Reuses a destroyed action of the class when the world context has a game instance, otherwise creates a new one.
+	UNREALSHARP_FUNCTION()
+	static void* AcquireAsyncAction(UObject* WorldContextObject, UClass* Class);
 };
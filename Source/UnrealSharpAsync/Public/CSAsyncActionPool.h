@@ -0,0 +1,41 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "CSAsyncActionPool.generated.h"
+
+class UCSAsyncActionBase;
+
+USTRUCT()
+struct FCSPooledAsyncActions
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UCSAsyncActionBase>> Actions;
+};
+
+// Keeps destroyed async actions around per class, so awaits that run every frame don't create and collect a UObject each time.
+// Pooled actions are outered to the pool, which is how UCSAsyncActionBase::Destroy finds its way back here.
+UCLASS()
+class UCSAsyncActionPool : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+public:
+	// UGameInstanceSubsystem interface
+	virtual void Deinitialize() override;
+	// End of UGameInstanceSubsystem interface
+
+	UCSAsyncActionBase* Acquire(UClass* Class);
+
+	// Returns false if the action should be garbage collected instead, because its pool is full or shutting down.
+	bool Release(UCSAsyncActionBase* Action);
+
+private:
+	static constexpr int32 MaxPooledActionsPerClass = 64;
+	
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<UClass>, FCSPooledAsyncActions> PooledActions;
+
+	bool bDeinitialized = false;
+};
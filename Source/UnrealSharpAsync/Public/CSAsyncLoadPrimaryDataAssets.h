@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "CSAsyncActionBase.h"
+#include "Engine/StreamableManager.h"
 #include "CSAsyncLoadPrimaryDataAssets.generated.h"
 
 UCLASS(meta = (InternalType))
@@ -15,4 +16,10 @@ public:
 	void LoadPrimaryDataAssets(const TArray<FPrimaryAssetId>& AssetIds, const TArray<FName>& AssetBundles);
 private:
 	void OnPrimaryDataAssetsLoaded();
+
+	// UCSAsyncActionBase interface
+	virtual void ResetForReuse() override;
+	// End of UCSAsyncActionBase interface
+
+	TSharedPtr<FStreamableHandle> StreamableHandle;
 };
@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "CSAsyncActionBase.h"
+#include "Engine/StreamableManager.h"
 #include "CSAsyncLoadSoftObjectPtr.generated.h"
 
 UCLASS(meta = (InternalType))
@@ -13,6 +14,12 @@ public:
 	void LoadSoftObjectPaths(const TArray<FSoftObjectPath>& SoftObjectPtr);
 protected:
 	void OnAsyncLoadComplete();
+
+	// UCSAsyncActionBase interface
+	virtual void ResetForReuse() override;
+	// End of UCSAsyncActionBase interface
+
+	TSharedPtr<FStreamableHandle> StreamableHandle;
 };
 
 
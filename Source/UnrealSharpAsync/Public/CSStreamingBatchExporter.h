@@ -0,0 +1,50 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CSManagedGCHandle.h"
+#include "UnrealSharpBinds/Public/CSBindsManager.h"
+#include "Engine/StreamableManager.h"
+#include "CSStreamingBatchExporter.generated.h"
+
+// One streamable handle for a whole batch of assets, owned by managed code until it releases it.
+// The completion callback runs on the game thread when the batch finishes loading or is canceled.
+struct FCSStreamingBatch
+{
+	TSharedPtr<FStreamableHandle> Handle;
+	FGCHandle Callback;
+	bool bNotified = false;
+
+	// Released by ReleaseBatch. The streamable delegates only hold weak references.
+	TSharedPtr<FCSStreamingBatch> ManagedReference;
+
+	void NotifyManaged();
+};
+
+UCLASS(meta = (InternalType))
+class UCSStreamingBatchExporter : public UObject
+{
+	GENERATED_BODY()
+public:
+	// AssetPathNames holds a package name and an asset name per asset.
+	UNREALSHARP_FUNCTION()
+	static FCSStreamingBatch* RequestAsyncLoad(const FName* AssetPathNames, int32 NumAssets, int32 Priority, FGCHandleIntPtr Callback);
+
+	UNREALSHARP_FUNCTION()
+	static float GetProgress(FCSStreamingBatch* Batch);
+
+	UNREALSHARP_FUNCTION()
+	static void GetLoadedCount(FCSStreamingBatch* Batch, int32* OutLoaded, int32* OutRequested);
+
+	UNREALSHARP_FUNCTION()
+	static bool HasLoadCompleted(FCSStreamingBatch* Batch);
+
+	UNREALSHARP_FUNCTION()
+	static bool WasCanceled(FCSStreamingBatch* Batch);
+
+	UNREALSHARP_FUNCTION()
+	static void CancelLoad(FCSStreamingBatch* Batch);
+
+	// Cancels the load if it's still running. The callback isn't called after this.
+	UNREALSHARP_FUNCTION()
+	static void ReleaseBatch(FCSStreamingBatch* Batch);
+};
@@ -13,11 +13,34 @@ FCSBindsManager* FCSBindsManager::Get()
 	return BindsManagerInstance;
 }
 
-void FCSBindsManager::RegisterExportedFunction(const FName& ClassName, const FCSExportedFunction& ExportedFunction)
+void FCSBindsManager::RegisterExportedFunction(const FCSExportedFunction& ExportedFunction)
 {
 	FCSBindsManager* Instance = Get();
-	TArray<FCSExportedFunction>& ExportedFunctions = Instance->ExportedFunctionsMap.FindOrAdd(ClassName);
-	ExportedFunctions.Add(ExportedFunction);
+	const uint64 Hash = HashExportedFunctionName(ExportedFunction.OuterName, ExportedFunction.Name);
+
+	const FCSExportedFunction* ExistingFunction = Instance->ExportedFunctionsMap.Find(Hash);
+	if (!ExistingFunction)
+	{
+		Instance->ExportedFunctionsMap.Add(Hash, ExportedFunction);
+		return;
+	}
+
+	// The same export registered twice.
+	if (FCStringAnsi::Stricmp(ExistingFunction->OuterName, ExportedFunction.OuterName) == 0
+		&& FCStringAnsi::Stricmp(ExistingFunction->Name, ExportedFunction.Name) == 0)
+	{
+		return;
+	}
+
+	// Runs during static initialization, so this can't log. Kept aside and resolved by name instead.
+	Instance->CollidingFunctions.Add(ExportedFunction);
+	Instance->CollidingHashes.Add(Hash);
+}
+
+bool FCSBindsManager::HasName(const FCSExportedFunction& ExportedFunction, const TCHAR* OuterName, const TCHAR* FunctionName)
+{
+	return FCString::Stricmp(OuterName, ANSI_TO_TCHAR(ExportedFunction.OuterName)) == 0
+		&& FCString::Stricmp(FunctionName, ANSI_TO_TCHAR(ExportedFunction.Name)) == 0;
 }
 
 void* FCSBindsManager::GetBoundFunction(const TCHAR* InOuterName, const TCHAR* InFunctionName, int32 ManagedFunctionSize)
@@ -25,33 +48,90 @@ void* FCSBindsManager::GetBoundFunction(const TCHAR* InOuterName, const TCHAR* I
 	TRACE_CPUPROFILER_EVENT_SCOPE(UCSBindsManager::GetBoundFunction);
 	
 	FCSBindsManager* Instance = Get();
-	FName ManagedOuterName = FName(InOuterName);
-	FName ManagedFunctionName = FName(InFunctionName);
-	
-	TArray<FCSExportedFunction>* ExportedFunctions = Instance->ExportedFunctionsMap.Find(ManagedOuterName);
+	const FCSExportedFunction* NativeFunction = Instance->ExportedFunctionsMap.Find(HashExportedFunctionName(InOuterName, InFunctionName));
 
-	if (!ExportedFunctions)
+	if (NativeFunction && !HasName(*NativeFunction, InOuterName, InFunctionName))
 	{
-		UE_LOG(LogUnrealSharpBinds, Error, TEXT("Failed to get BoundNativeFunction: No exported functions found for %s"), InOuterName);
+		NativeFunction = Instance->CollidingFunctions.FindByPredicate([InOuterName, InFunctionName](const FCSExportedFunction& CollidingFunction)
+		{
+			return HasName(CollidingFunction, InOuterName, InFunctionName);
+		});
+	}
+
+	if (!NativeFunction)
+	{
+		UE_LOG(LogUnrealSharpBinds, Error, TEXT("Failed to get BoundNativeFunction: No function found for %s.%s"), InOuterName, InFunctionName);
 		return nullptr;
 	}
 
-	for (FCSExportedFunction& NativeFunction : *ExportedFunctions)
+	if (NativeFunction->Size != ManagedFunctionSize)
 	{
-		if (NativeFunction.Name != ManagedFunctionName)
+		UE_LOG(LogUnrealSharpBinds, Error, TEXT("Failed to get BoundNativeFunction: Function size mismatch for %s::%s."), InOuterName, InFunctionName);
+		return nullptr;
+	}
+
+	return NativeFunction->FunctionPointer;
+}
+
+int32 FCSBindsManager::GetExportedFunctions(FCSExportedFunctionEntry* OutEntries, int32 MaxEntries)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCSBindsManager::GetExportedFunctions);
+
+	FCSBindsManager* Instance = Get();
+
+	// Called once to size the table and once to fill it, reporting on the second call is enough.
+	if (MaxEntries > 0)
+	{
+		for (const FCSExportedFunction& CollidingFunction : Instance->CollidingFunctions)
+		{
+			const FCSExportedFunction& ExportedFunction = Instance->ExportedFunctionsMap.FindChecked(HashExportedFunctionName(CollidingFunction.OuterName, CollidingFunction.Name));
+			UE_LOG(LogUnrealSharpBinds, Error, TEXT("%hs.%hs and %hs.%hs have the same name hash, both are resolved by name. Rename one of them."),
+				ExportedFunction.OuterName, ExportedFunction.Name, CollidingFunction.OuterName, CollidingFunction.Name);
+		}
+	}
+
+	int32 NumEntries = 0;
+	for (const TPair<uint64, FCSExportedFunction>& ExportedFunction : Instance->ExportedFunctionsMap)
+	{
+		// The hash can't tell these apart, C# has to ask by name.
+		if (Instance->CollidingHashes.Contains(ExportedFunction.Key))
 		{
 			continue;
 		}
-			
-		if (NativeFunction.Size != ManagedFunctionSize)
+
+		if (NumEntries < MaxEntries)
+		{
+			FCSExportedFunctionEntry& Entry = OutEntries[NumEntries];
+			Entry.Hash = ExportedFunction.Key;
+			Entry.FunctionPointer = ExportedFunction.Value.FunctionPointer;
+			Entry.Size = ExportedFunction.Value.Size;
+		}
+
+		++NumEntries;
+	}
+
+	return NumEntries;
+}
+
+const FCSExportedFunction* FCSBindsManager::FindExportedFunction(const void* NativeFunction)
+{
+	FCSBindsManager* Instance = Get();
+	for (const TPair<uint64, FCSExportedFunction>& ExportedFunction : Instance->ExportedFunctionsMap)
+	{
+		if (ExportedFunction.Value.NativeFunctionPointer == NativeFunction)
 		{
-			UE_LOG(LogUnrealSharpBinds, Error, TEXT("Failed to get BoundNativeFunction: Function size mismatch for %s::%s."), InOuterName, InFunctionName);
-			return nullptr;
+			return &ExportedFunction.Value;
 		}
-			
-		return NativeFunction.FunctionPointer;
 	}
 
-	UE_LOG(LogUnrealSharpBinds, Error, TEXT("Failed to get BoundNativeFunction: No function found for %s.%s"), *ManagedOuterName.ToString(), *ManagedFunctionName.ToString());
-	return nullptr;
+	return Instance->CollidingFunctions.FindByPredicate([NativeFunction](const FCSExportedFunction& CollidingFunction)
+	{
+		return CollidingFunction.NativeFunctionPointer == NativeFunction;
+	});
+}
+
+const FCSBindsCallbacks& FCSBindsManager::GetBindsCallbacks()
+{
+	static const FCSBindsCallbacks BindsCallbacks { &GetBoundFunction, &GetExportedFunctions };
+	return BindsCallbacks;
 }
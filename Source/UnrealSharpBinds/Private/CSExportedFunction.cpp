@@ -1,11 +1,37 @@
 #include "CSExportedFunction.h"
 
 #include "CSBindsManager.h"
+#include "UnrealSharpBinds.h"
 
-FCSExportedFunction::FCSExportedFunction(const FName& OuterName, const FName& Name, void* InFunctionPointer, int32 InSize):
-	Name(Name),
+FCSExportedFunction::FCSExportedFunction(const ANSICHAR* InOuterName, const ANSICHAR* InName, void* InFunctionPointer, int32 InSize, 
+	ECSExportThreadSafety InThreadSafety, void* InNativeFunctionPointer):
+	OuterName(InOuterName),
+	Name(InName),
 	FunctionPointer(InFunctionPointer),
-	Size(InSize)
+	Size(InSize),
+	ThreadSafety(InThreadSafety),
+	NativeFunctionPointer(InNativeFunctionPointer ? InNativeFunctionPointer : InFunctionPointer)
 {
-	FCSBindsManager::RegisterExportedFunction(OuterName, *this);
+	FCSBindsManager::RegisterExportedFunction(*this);
+}
+
+void FCSExportedFunction::ReportCalledOffGameThread(const void* NativeFunction)
+{
+	static FCriticalSection ReportedFunctionsLock;
+	static TSet<const void*> ReportedFunctions;
+
+	{
+		FScopeLock Lock(&ReportedFunctionsLock);
+		bool bAlreadyReported = false;
+		ReportedFunctions.Add(NativeFunction, &bAlreadyReported);
+		
+		if (bAlreadyReported)
+		{
+			return;
+		}
+	}
+
+	const FCSExportedFunction* ExportedFunction = FCSBindsManager::FindExportedFunction(NativeFunction);
+	UE_LOG(LogUnrealSharpBinds, Error, TEXT("%hs.%hs was called off the game thread, but isn't marked UNREALSHARP_FUNCTION(AnyThread)."), 
+		ExportedFunction ? ExportedFunction->OuterName : "Unknown", ExportedFunction ? ExportedFunction->Name : "Unknown");
 }
@@ -4,7 +4,26 @@
 
 // Native bound function. If you want to bind a function to C#, use this macro.
 // The managed delegate signature must match the native function signature + outer name, and all params need to be blittable.
-#define UNREALSHARP_FUNCTION()
+// UNREALSHARP_FUNCTION(AnyThread) marks functions that can be called from worker threads, see ECSExportThreadSafety.
+// UNREALSHARP_FUNCTION(EditorOnly) registers the function in editor builds only, its C# side has to be behind WITH_EDITOR too.
+// Specifiers can be combined, like UNREALSHARP_FUNCTION(AnyThread, EditorOnly).
+#define UNREALSHARP_FUNCTION(...)
+
+// Entry of the export table handed to C# in one go, see FCSBindsManager::GetExportedFunctions.
+// Layout must match ExportedFunctionEntry in BindsManager.cs.
+struct FCSExportedFunctionEntry
+{
+	uint64 Hash;
+	void* FunctionPointer;
+	int32 Size;
+};
+
+// Passed to InitializeUnrealSharp. Layout must match BindsCallbacks in BindsManager.cs.
+struct FCSBindsCallbacks
+{
+	void* (*GetBoundFunction)(const TCHAR*, const TCHAR*, int32);
+	int32 (*GetExportedFunctions)(FCSExportedFunctionEntry*, int32);
+};
 
 class FCSBindsManager
 {
@@ -12,12 +31,60 @@ public:
 	
 	static FCSBindsManager* Get();
 	
-	UNREALSHARPBINDS_API static void RegisterExportedFunction(const FName& ClassName, const FCSExportedFunction& ExportedFunction);
+	UNREALSHARPBINDS_API static void RegisterExportedFunction(const FCSExportedFunction& ExportedFunction);
 
 	UNREALSHARPBINDS_API static void* GetBoundFunction(const TCHAR* InOuterName, const TCHAR* InFunctionName, int32 ManagedFunctionSize);
 
+	// Copies up to MaxEntries entries of the export table into OutEntries and returns the total number of entries.
+	// Functions whose name hash collides with another export are left out, so C# resolves them by name through GetBoundFunction.
+	UNREALSHARPBINDS_API static int32 GetExportedFunctions(FCSExportedFunctionEntry* OutEntries, int32 MaxEntries);
+
+	UNREALSHARPBINDS_API static const FCSBindsCallbacks& GetBindsCallbacks();
+
+	// The export whose unchecked function pointer is NativeFunction, for diagnostics. Walks the whole table.
+	UNREALSHARPBINDS_API static const FCSExportedFunction* FindExportedFunction(const void* NativeFunction);
+
+	// Case-insensitive FNV-1a over "Outer.Function". NativeBinds.HashExportedFunctionName in C# must produce the same value.
+	template<typename CharType>
+	static uint64 HashExportedFunctionName(const CharType* OuterName, const CharType* FunctionName)
+	{
+		uint64 Hash = 14695981039346656037ull;
+		auto HashChar = [&Hash](uint32 Char)
+		{
+			if (Char >= 'A' && Char <= 'Z')
+			{
+				Char += 'a' - 'A';
+			}
+			
+			Hash ^= Char;
+			Hash *= 1099511628211ull;
+		};
+
+		for (const CharType* Char = OuterName; *Char; ++Char)
+		{
+			HashChar(static_cast<uint32>(*Char));
+		}
+
+		HashChar('.');
+
+		for (const CharType* Char = FunctionName; *Char; ++Char)
+		{
+			HashChar(static_cast<uint32>(*Char));
+		}
+
+		return Hash;
+	}
+
 private:
 	FCSBindsManager() = default;
+
+	static bool HasName(const FCSExportedFunction& ExportedFunction, const TCHAR* OuterName, const TCHAR* FunctionName);
+	
 	static FCSBindsManager* BindsManagerInstance;
-	TMap<FName, TArray<FCSExportedFunction>> ExportedFunctionsMap;
+	TMap<uint64, FCSExportedFunction> ExportedFunctionsMap;
+
+	// Exports whose hash was already taken by an export with another name, and the hashes that are shared.
+	// Registration runs during static initialization, so they're only reported once the table is handed to C#.
+	TArray<FCSExportedFunction> CollidingFunctions;
+	TSet<uint64> CollidingHashes;
 };
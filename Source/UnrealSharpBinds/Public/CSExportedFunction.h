@@ -40,11 +40,59 @@ constexpr size_t GetFunctionSize(ReturnType (*)(Args...))
 	}
 }
 
+// Reports exports that are called off the game thread without being marked UNREALSHARP_FUNCTION(AnyThread).
+// Costs a thread check per call, so only on in debug and development builds by default.
+#ifndef UNREALSHARP_CHECK_EXPORT_THREAD_SAFETY
+#define UNREALSHARP_CHECK_EXPORT_THREAD_SAFETY (UE_BUILD_DEBUG || UE_BUILD_DEVELOPMENT)
+#endif
+
+enum class ECSExportThreadSafety : uint8
+{
+	// Touches engine state that is owned by the game thread. The default.
+	GameThread,
+	// Safe to call from any thread at any time. Doesn't take locks or touch shared engine state.
+	AnyThread,
+};
+
 struct UNREALSHARPBINDS_API FCSExportedFunction
 {
-	FName Name;
+	// Both names are string literals from the generated bind code, so they live as long as the module.
+	const ANSICHAR* OuterName;
+	const ANSICHAR* Name;
+	// What C# calls. For game thread exports in checked builds, a wrapper that checks the thread first.
 	void* FunctionPointer;
 	int32 Size;
+	ECSExportThreadSafety ThreadSafety;
+	// The export itself.
+	void* NativeFunctionPointer;
+
+	FCSExportedFunction(const ANSICHAR* InOuterName, const ANSICHAR* InName, void* InFunctionPointer, int32 InSize, 
+		ECSExportThreadSafety InThreadSafety = ECSExportThreadSafety::GameThread, void* InNativeFunctionPointer = nullptr);
+
+	// Logs the first off-thread call of a game thread export. NativeFunction is the unchecked function pointer.
+	static void ReportCalledOffGameThread(const void* NativeFunction);
+};
+
+#if UNREALSHARP_CHECK_EXPORT_THREAD_SAFETY
+template <typename FunctionType, FunctionType Function>
+struct TCSGameThreadCheckedExport;
 
-	FCSExportedFunction(const FName& OuterName, const FName& Name, void* InFunctionPointer, int32 InSize);
+// Same signature as the export, checks the calling thread before forwarding to it.
+template <typename ReturnType, typename... Args, ReturnType (*Function)(Args...)>
+struct TCSGameThreadCheckedExport<ReturnType (*)(Args...), Function>
+{
+	static ReturnType Call(Args... Arguments)
+	{
+		if (!IsInGameThread())
+		{
+			FCSExportedFunction::ReportCalledOffGameThread(reinterpret_cast<const void*>(Function));
+		}
+		
+		return Function(Arguments...);
+	}
 };
+
+#define UNREALSHARP_GAME_THREAD_EXPORT(Function) (void*)&TCSGameThreadCheckedExport<decltype(&Function), &Function>::Call
+#else
+#define UNREALSHARP_GAME_THREAD_EXPORT(Function) (void*)&Function
+#endif
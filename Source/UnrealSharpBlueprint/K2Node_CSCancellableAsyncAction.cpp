@@ -88,12 +88,11 @@ void UK2Node_CSCancellableAsyncAction::GetMenuActions(FBlueprintActionDatabaseRe
 	UClass* NodeClass = GetClass();
 	UClass* TargetType = UCSCancellableAsyncAction::StaticClass();
 
-	for (TObjectIterator<UCSClass> ClassIt; ClassIt; ++ClassIt)
+	auto RegisterFactoryMethods = [&ActionRegistrar, NodeClass, TargetType](UCSClass* Class)
 	{
-		UCSClass* Class = *ClassIt;
 		if (Class->HasAnyClassFlags(CLASS_Abstract) || !Class->IsChildOf(TargetType))
 		{
-			continue;
+			return;
 		}
 
 		for (TFieldIterator<UFunction> FuncIt(Class, EFieldIteratorFlags::ExcludeSuper); FuncIt; ++FuncIt)
@@ -108,6 +107,21 @@ void UK2Node_CSCancellableAsyncAction::GetMenuActions(FBlueprintActionDatabaseRe
 				ActionRegistrar.AddBlueprintAction(Class, NewAction);
 			}
 		}
+	};
+
+	// Refreshing a single class only registers that class, instead of walking every managed class for each one refreshed after a reload.
+	if (const UObject* ActionKeyFilter = ActionRegistrar.GetActionKeyFilter())
+	{
+		if (const UCSClass* Class = Cast<UCSClass>(ActionKeyFilter))
+		{
+			RegisterFactoryMethods(const_cast<UCSClass*>(Class));
+		}
+		return;
+	}
+
+	for (TObjectIterator<UCSClass> ClassIt; ClassIt; ++ClassIt)
+	{
+		RegisterFactoryMethods(*ClassIt);
 	}
 }
 
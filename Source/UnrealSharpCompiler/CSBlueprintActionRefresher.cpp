@@ -0,0 +1,85 @@
+#include "CSBlueprintActionRefresher.h"
+
+#include "BlueprintActionDatabase.h"
+#include "CSManager.h"
+#include "Containers/Ticker.h"
+#include "HAL/IConsoleManager.h"
+
+namespace
+{
+	float RefreshBudgetMs = 5.0f;
+
+	FAutoConsoleVariableRef CVarActionRefreshBudgetMs(
+		TEXT("UnrealSharp.ActionRefreshBudgetMs"),
+		RefreshBudgetMs,
+		TEXT("Time per frame spent refreshing the Blueprint actions of rebuilt managed classes. At least one class is refreshed every frame."));
+
+	// In queue order, a class queued again keeps its place.
+	TArray<TWeakObjectPtr<UClass>> PendingClasses;
+	TSet<TWeakObjectPtr<UClass>> PendingClassSet;
+	FTSTicker::FDelegateHandle TickerHandle;
+	
+	void RefreshClass(const TWeakObjectPtr<UClass>& WeakClass)
+	{
+		PendingClassSet.Remove(WeakClass);
+		
+		if (UClass* Class = WeakClass.Get())
+		{
+			FBlueprintActionDatabase::Get().RefreshClassActions(Class);
+		}
+	}
+
+	bool Tick(float)
+	{
+		// Classes keep being rebuilt until the last assembly is loaded.
+		if (UCSManager::Get().IsLoadingAnyAssembly())
+		{
+			return true;
+		}
+
+		const double EndTime = FPlatformTime::Seconds() + RefreshBudgetMs / 1000.0;
+		int32 NumRefreshed = 0;
+		
+		do
+		{
+			RefreshClass(PendingClasses[NumRefreshed++]);
+		}
+		while (NumRefreshed < PendingClasses.Num() && FPlatformTime::Seconds() < EndTime);
+
+		PendingClasses.RemoveAt(0, NumRefreshed);
+		if (!PendingClasses.IsEmpty())
+		{
+			return true;
+		}
+
+		TickerHandle.Reset();
+		return false;
+	}
+}
+
+void FCSBlueprintActionRefresher::QueueRefresh(UClass* Class)
+{
+	check(IsInGameThread());
+	
+	bool bIsAlreadyQueued;
+	PendingClassSet.Add(Class, &bIsAlreadyQueued);
+	if (bIsAlreadyQueued)
+	{
+		return;
+	}
+
+	PendingClasses.Add(Class);
+	
+	if (!TickerHandle.IsValid())
+	{
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&Tick));
+	}
+}
+
+void FCSBlueprintActionRefresher::Shutdown()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	TickerHandle.Reset();
+	PendingClasses.Empty();
+	PendingClassSet.Empty();
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Coalesces the Blueprint action database refreshes of rebuilt managed classes.
+ * A class queued several times during a reload is refreshed once, after all assemblies are loaded,
+ * and the refreshes are spread over frames within UnrealSharp.ActionRefreshBudgetMs. Editor only, game thread only.
+ */
+class FCSBlueprintActionRefresher
+{
+public:
+	static void QueueRefresh(UClass* Class);
+
+	static void Shutdown();
+};
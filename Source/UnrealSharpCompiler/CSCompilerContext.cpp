@@ -1,6 +1,7 @@
 #include "CSCompilerContext.h"
 
-#include "BlueprintActionDatabase.h"
+#include "CSBlueprintActionRefresher.h"
+#include "CSTypeBuildProfiler.h"
 #include "ISettingsModule.h"
 #include "BehaviorTree/Tasks/BTTask_BlueprintBase.h"
 #include "Blueprint/StateTreeTaskBlueprintBase.h"
@@ -29,6 +30,8 @@ FCSCompilerContext::FCSCompilerContext(UCSBlueprint* Blueprint, FCompilerResults
 
 void FCSCompilerContext::FinishCompilingClass(UClass* Class)
 {
+	FCSScopedTypeCompileTime CompileTime(GetMainClass());
+
 	bool bIsSkeletonClass = FCSClassUtilities::IsSkeletonType(Class);
 	
 	if (!bIsSkeletonClass)
@@ -39,6 +42,13 @@ void FCSCompilerContext::FinishCompilingClass(UClass* Class)
 
 	Super::FinishCompilingClass(Class);
 
+	if (UCSClass* ManagedClass = Cast<UCSClass>(Class))
+	{
+		ManagedClass->UpdateManagedHandleOffset();
+		ManagedClass->UpdateNonZeroInitializedProperties();
+		ManagedClass->UpdateCanCreateManagedObjectLazily();
+	}
+
 	TSharedPtr<FCSClassMetaData> TypeMetaData = GetClassInfo()->GetTypeMetaData<FCSClassMetaData>();
 
 	// Super call overrides the class flags, so we need to set after that
@@ -62,6 +72,8 @@ void FCSCompilerContext::FinishCompilingClass(UClass* Class)
 
 void FCSCompilerContext::OnPostCDOCompiled(const UObject::FPostCDOCompiledContext& Context)
 {
+	FCSScopedTypeCompileTime CompileTime(GetMainClass());
+
 	FKismetCompilerContext::OnPostCDOCompiled(Context);
 	
 	UCSGeneratedClassBuilder::SetupDefaultTickSettings(NewClass->GetDefaultObject(), NewClass);
@@ -73,18 +85,22 @@ void FCSCompilerContext::OnPostCDOCompiled(const UObject::FPostCDOCompiledContex
 		
 		if (GEditor)
 		{
-			FBlueprintActionDatabase::Get().RefreshClassActions(Class);
+			FCSBlueprintActionRefresher::QueueRefresh(Class);
 		}
 	}
 }
 
 void FCSCompilerContext::CreateClassVariablesFromBlueprint()
 {
+	FCSScopedTypeCompileTime CompileTime(GetMainClass());
+
 	TSharedPtr<FCSClassInfo> ClassInfo = GetMainClass()->GetManagedTypeInfo<FCSClassInfo>();
 	const TArray<FCSPropertyMetaData>& Properties = ClassInfo->GetTypeMetaData<FCSClassMetaData>()->Properties;
 
 	NewClass->PropertyGuids.Empty(Properties.Num());
 	TryValidateSimpleConstructionScript(ClassInfo);
+
+	UCSClass::TryAddManagedHandleProperty(NewClass);
 	
 	FCSPropertyFactory::CreateAndAssignProperties(NewClass, Properties, [this](const FProperty* NewProperty)
 	{
@@ -100,6 +116,8 @@ void FCSCompilerContext::CreateClassVariablesFromBlueprint()
 
 void FCSCompilerContext::CleanAndSanitizeClass(UBlueprintGeneratedClass* ClassToClean, UObject*& InOldCDO)
 {
+	FCSScopedTypeCompileTime CompileTime(GetMainClass());
+
 	FKismetCompilerContext::CleanAndSanitizeClass(ClassToClean, InOldCDO);
 	NewClass->FieldNotifies.Reset();
 	
@@ -111,6 +129,8 @@ void FCSCompilerContext::CleanAndSanitizeClass(UBlueprintGeneratedClass* ClassTo
 
 void FCSCompilerContext::SpawnNewClass(const FString& NewClassName)
 {
+	FCSScopedTypeCompileTime CompileTime(GetMainClass());
+
 	UCSClass* MainClass = GetMainClass();
 	UCSSkeletonClass* NewSkeletonClass = NewObject<UCSSkeletonClass>(Blueprint->GetOutermost(), FName(*NewClassName), RF_Public | RF_Transactional);
 	NewSkeletonClass->SetGeneratedClass(MainClass);
@@ -205,6 +225,9 @@ void FCSCompilerContext::TryInitializeAsDeveloperSettings(const UClass* Class) c
 		return;
 	}
 
+	// Creating the default object already loads its config, only an existing one needs to read it again.
+	const bool bHasDefaultObject = Class->GetDefaultObject(false) != nullptr;
+	
 	UDeveloperSettings* Settings = static_cast<UDeveloperSettings*>(Class->GetDefaultObject());
 	ISettingsModule& SettingsModule = FModuleManager::GetModuleChecked<ISettingsModule>("Settings");
 		
@@ -213,7 +236,10 @@ void FCSCompilerContext::TryInitializeAsDeveloperSettings(const UClass* Class) c
 		Settings->GetSectionDescription(),
 		Settings);
 
-	Settings->LoadConfig();
+	if (bHasDefaultObject)
+	{
+		Settings->LoadConfig();
+	}
 }
 
 void FCSCompilerContext::TryDeinitializeAsDeveloperSettings(UObject* Settings) const
@@ -1,7 +1,7 @@
 ﻿#include "UnrealSharpCompiler.h"
 
-#include "BlueprintActionDatabase.h"
 #include "BlueprintCompilationManager.h"
+#include "CSBlueprintActionRefresher.h"
 #include "CSBlueprintCompiler.h"
 #include "CSCompilerContext.h"
 #include "CSManager.h"
@@ -11,6 +11,8 @@
 #include "TypeGenerator/CSEnum.h"
 #include "TypeGenerator/CSInterface.h"
 #include "TypeGenerator/CSScriptStruct.h"
+#include "TypeGenerator/Register/TypeInfo/CSClassInfo.h"
+#include "ThreadSafety/CSAtomicHotReloadState.h"
 
 #define LOCTEXT_NAMESPACE "FUnrealSharpCompilerModule"
 
@@ -37,16 +39,13 @@ void FUnrealSharpCompilerModule::StartupModule()
 	CSManager.OnManagedAssemblyLoadedEvent().AddRaw(this, &FUnrealSharpCompilerModule::OnManagedAssemblyLoaded);
 
 	// Try to recompile and reinstance all blueprints when the module is loaded.
-	CSManager.ForEachManagedPackage([this](const UPackage* Package)
+	CSManager.ForEachManagedField([this](UField* Field)
 	{
-		ForEachObjectWithPackage(Package, [this](UObject* Object)
+		UCSClass* ManagedClass = Cast<UCSClass>(Field);
+		if (ManagedClass && ManagedClass->ClassGeneratedBy)
 		{
-			if (UBlueprint* Blueprint = Cast<UBlueprint>(Object))
-			{
-				OnNewClass(static_cast<UCSClass*>(Blueprint->GeneratedClass.Get()));
-			}
-			return true;
-		}, false);
+			OnNewClass(ManagedClass);
+		}
 	});
 	
 	RecompileAndReinstanceBlueprints();
@@ -54,7 +53,7 @@ void FUnrealSharpCompilerModule::StartupModule()
 
 void FUnrealSharpCompilerModule::ShutdownModule()
 {
-    
+	FCSBlueprintActionRefresher::Shutdown();
 }
 
 void FUnrealSharpCompilerModule::RecompileAndReinstanceBlueprints()
@@ -70,41 +69,108 @@ void FUnrealSharpCompilerModule::RecompileAndReinstanceBlueprints()
 		// Nothing to compile.
 		return;
 	}
+
+	FCSScopedHotReloadPhase ReinstancePhase(FCSAtomicHotReloadState::EHotReloadPhase::Reinstance);
 	
-	auto CompileBlueprints = [this](TArray<UBlueprint*>& Blueprints)
+	// Components needs be compiled first, as they are instantiated by the owning actor, and needs their size to be known.
+	CompileBlueprints(ManagedComponentsToCompile);
+	CompileBlueprints(ManagedClassesToCompile);
+	ForcedCompiles.Reset();
+
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+}
+
+void FUnrealSharpCompilerModule::CompileBlueprints(TArray<UBlueprint*>& Blueprints)
+{
+	if (Blueprints.IsEmpty())
 	{
-		if (Blueprints.IsEmpty())
+		return;
+	}
+
+	TArray<TPair<UBlueprint*, FString>> QueuedBlueprints;
+	QueuedBlueprints.Reserve(Blueprints.Num());
+	int32 NumSkipped = 0;
+
+	for (UBlueprint* Blueprint : Blueprints)
+	{
+		if (!Blueprint)
 		{
-			return;
+			UE_LOGFMT(LogUnrealSharpCompiler, Error, "Blueprint is null, skipping compilation.");
+			continue;
 		}
 		
-		for (int32 i = 0; i < Blueprints.Num(); ++i)
+		if (!IsValid(Blueprint))
 		{
-			UBlueprint* Blueprint = Blueprints[i];
-
-			if (!Blueprint)
-			{
-				UE_LOGFMT(LogUnrealSharpCompiler, Error, "Blueprint is null, skipping compilation.");
-				continue;
-			}
-			
-			if (!IsValid(Blueprint))
-			{
-				UE_LOGFMT(LogUnrealSharpCompiler, Error, "Blueprint {0} is garbage, skipping compilation.", *Blueprint->GetName());
-				continue;
-			}
-
-			FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::SkipGarbageCollection);
+			UE_LOGFMT(LogUnrealSharpCompiler, Error, "Blueprint {0} is garbage, skipping compilation.", *Blueprint->GetName());
+			continue;
 		}
-		
-		Blueprints.Reset();
-	};
 
-	// Components needs be compiled first, as they are instantiated by the owning actor, and needs their size to be known.
-	CompileBlueprints(ManagedComponentsToCompile);
-	CompileBlueprints(ManagedClassesToCompile);
+		UCSClass* ManagedClass = Cast<UCSClass>(Blueprint->GeneratedClass);
+		FString CompileHash = ManagedClass && ManagedClass->HasTypeInfo() ? GetCompileHash(ManagedClass) : FString();
 
-	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+		if (!ForcedCompiles.Contains(Blueprint) && IsCompileUpToDate(Blueprint, CompileHash))
+		{
+			// Same layout as the last compile, only the method handles point into the reloaded assembly.
+			ManagedClass->GetManagedTypeInfo<FCSClassInfo>()->RebindFunctionBodies();
+			NumSkipped++;
+			continue;
+		}
+
+		FBlueprintCompilationManager::QueueForCompilation(Blueprint);
+		QueuedBlueprints.Emplace(Blueprint, MoveTemp(CompileHash));
+	}
+
+	// One pass compiles and reinstances all of them, instead of recompiling children once for each of their parents.
+	FBlueprintCompilationManager::FlushCompilationQueueAndReinstance();
+
+	for (const TPair<UBlueprint*, FString>& QueuedBlueprint : QueuedBlueprints)
+	{
+		UBlueprint* Blueprint = QueuedBlueprint.Key;
+		if (QueuedBlueprint.Value.IsEmpty() || Blueprint->Status == BS_Error)
+		{
+			CompiledHashes.Remove(Blueprint);
+			continue;
+		}
+
+		CompiledHashes.Add(Blueprint, QueuedBlueprint.Value);
+	}
+
+	UE_LOGFMT(LogUnrealSharpCompiler, Verbose, "Compiled {0} Blueprints, skipped {1} that were up to date.", QueuedBlueprints.Num(), NumSkipped);
+	Blueprints.Reset();
+}
+
+bool FUnrealSharpCompilerModule::IsCompileUpToDate(const UBlueprint* Blueprint, const FString& CompileHash) const
+{
+	if (CompileHash.IsEmpty() || Blueprint->Status != BS_UpToDate)
+	{
+		return false;
+	}
+
+	const FString* CompiledHash = CompiledHashes.Find(Blueprint);
+	return CompiledHash && *CompiledHash == CompileHash;
+}
+
+FString FUnrealSharpCompilerModule::GetCompileHash(const UCSClass* ManagedClass)
+{
+	FString CompileHash;
+	
+	for (const UCSClass* Class = ManagedClass; Class; Class = Cast<UCSClass>(Class->GetSuperClass()))
+	{
+		if (!Class->HasTypeInfo())
+		{
+			continue;
+		}
+
+		const FString& StructureHash = Class->GetManagedTypeInfo<FCSClassInfo>()->GetStructureHash();
+		if (StructureHash.IsEmpty())
+		{
+			return FString();
+		}
+
+		CompileHash += StructureHash;
+	}
+
+	return CompileHash;
 }
 
 void FUnrealSharpCompilerModule::AddManagedReferences(FCSManagedReferencesCollection& Collection)
@@ -113,12 +179,12 @@ void FUnrealSharpCompilerModule::AddManagedReferences(FCSManagedReferencesCollec
 	{
 		if (UCSClass* Class = Cast<UCSClass>(Struct))
 		{
-			OnNewClass(Class);
+			AddToCompileQueue(Class, true);
 		}
 	});
 }
 
-void FUnrealSharpCompilerModule::OnNewClass(UCSClass* NewClass)
+void FUnrealSharpCompilerModule::AddToCompileQueue(UCSClass* NewClass, bool bForceCompile)
 {
 	UBlueprint* Blueprint = Cast<UBlueprint>(NewClass->ClassGeneratedBy);
 	if (!IsValid(Blueprint))
@@ -126,6 +192,11 @@ void FUnrealSharpCompilerModule::OnNewClass(UCSClass* NewClass)
 		return;
 	}
 
+	if (bForceCompile)
+	{
+		ForcedCompiles.Add(Blueprint);
+	}
+
 	auto AddToCompileList = [this](TArray<UBlueprint*>& List, UBlueprint* Blueprint)
 	{
 		if (List.Contains(Blueprint))
@@ -163,7 +234,7 @@ void FUnrealSharpCompilerModule::OnNewInterface(UCSInterface* NewInterface)
 		return;
 	}
 	
-	FBlueprintActionDatabase::Get().RefreshClassActions(NewInterface);
+	FCSBlueprintActionRefresher::QueueRefresh(NewInterface);
 }
 
 void FUnrealSharpCompilerModule::OnManagedAssemblyLoaded(const FName& AssemblyName)
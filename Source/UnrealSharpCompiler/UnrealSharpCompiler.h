@@ -19,7 +19,7 @@ public:
     virtual void ShutdownModule() override;
 private:
     
-    void OnNewClass(UCSClass* NewClass);
+    void OnNewClass(UCSClass* NewClass) { AddToCompileQueue(NewClass, false); }
     void OnNewStruct(UCSScriptStruct* NewStruct);
     void OnNewEnum(UCSEnum* NewEnum);
     void OnNewInterface(UCSInterface* NewInterface);
@@ -28,9 +28,23 @@ private:
     void RecompileAndReinstanceBlueprints();
 
     void AddManagedReferences(FCSManagedReferencesCollection& Collection);
+    void AddToCompileQueue(UCSClass* NewClass, bool bForceCompile);
+
+    // Compiles the Blueprints in one batch through the compilation manager, skipping the ones whose managed type hasn't changed
+    void CompileBlueprints(TArray<UBlueprint*>& Blueprints);
+    bool IsCompileUpToDate(const UBlueprint* Blueprint, const FString& CompileHash) const;
+
+    // Structure hashes of the managed class and its managed parents. Empty if any of them has no hash.
+    static FString GetCompileHash(const UCSClass* ManagedClass);
 
     FCSBlueprintCompiler BlueprintCompiler;
     
     TArray<UBlueprint*> ManagedClassesToCompile;
     TArray<UBlueprint*> ManagedComponentsToCompile;
+
+    // Blueprints that reference a changed struct or enum. Their own hash is the same, but they still need to compile.
+    TSet<TObjectKey<UBlueprint>> ForcedCompiles;
+
+    // Compile hash of each Blueprint at its last successful compile
+    TMap<TObjectKey<UBlueprint>, FString> CompiledHashes;
 };
\ No newline at end of file
@@ -1,7 +1,17 @@
 ﻿#include "CSAssembly.h"
 #include "UnrealSharpCore.h"
 #include "Misc/Paths.h"
+#include "Async/ParallelFor.h"
+#include "Algo/StableSort.h"
 #include "CSManager.h"
+#include "CSManagedJobs.h"
+#include "CSManagedTimers.h"
+#include "CSSubsystemHandleCache.h"
+#include "CSInterfaceDispatchCache.h"
+#include "CSSaveGameSerializer.h"
+#include "Export/UFunctionExporter.h"
+#include "CSHandleMemoryReport.h"
+#include "CSStartupReport.h"
 #include "CSUnrealSharpSettings.h"
 #include "Logging/StructuredLog.h"
 #include "TypeGenerator/CSClass.h"
@@ -14,8 +24,56 @@
 #include "TypeGenerator/Register/MetaData/CSInterfaceMetaData.h"
 #include "TypeGenerator/Register/MetaData/CSStructMetaData.h"
 #include "GCOptimizations/CSObjectManager.h"
+#include "ThreadSafety/CSAtomicHotReloadState.h"
 #include "TypeGenerator/Register/TypeInfo/CSClassInfo.h"
 #include "Utils/CSClassUtilities.h"
+#include "Utils/CSMappedFile.h"
+
+struct FCSPrefetchedAssembly
+{
+	FCSMappedFile AssemblyFile;
+	FCSMappedFile PdbFile;
+
+	// One of the two, depending on what the weaver wrote.
+	TUniquePtr<FCSBinaryMetaData> BinaryMetaData;
+	TSharedPtr<FJsonObject> JsonMetaData;
+};
+
+TSharedPtr<FCSPrefetchedAssembly> UCSAssembly::PrefetchAssembly(const FString& InAssemblyPath, bool bReadImage)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCSAssembly::PrefetchAssembly);
+
+	TSharedPtr<FCSPrefetchedAssembly> Prefetched = MakeShared<FCSPrefetchedAssembly>();
+	if (bReadImage && Prefetched->AssemblyFile.Open(InAssemblyPath))
+	{
+		const FString PdbPath = FPaths::ChangeExtension(InAssemblyPath, TEXT("pdb"));
+		if (FPaths::FileExists(PdbPath))
+		{
+			Prefetched->PdbFile.Open(PdbPath);
+		}
+	}
+
+	// Anything that fails here is read again by LoadAssembly, which reports the error.
+	const FString BinaryMetadataPath = FPaths::ChangeExtension(InAssemblyPath, "metadata.bin");
+	if (FPaths::FileExists(BinaryMetadataPath))
+	{
+		TUniquePtr<FCSBinaryMetaData> BinaryMetaData = MakeUnique<FCSBinaryMetaData>();
+		if (BinaryMetaData->Open(BinaryMetadataPath))
+		{
+			Prefetched->BinaryMetaData = MoveTemp(BinaryMetaData);
+		}
+
+		return Prefetched;
+	}
+
+	FString JsonString;
+	if (FFileHelper::LoadFileToString(JsonString, *FPaths::ChangeExtension(InAssemblyPath, "metadata.json")))
+	{
+		FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(JsonString), Prefetched->JsonMetaData);
+	}
+
+	return Prefetched;
+}
 
 void UCSAssembly::SetAssemblyPath(const FStringView InAssemblyPath)
 {
@@ -36,7 +94,7 @@ void UCSAssembly::SetAssemblyPath(const FStringView InAssemblyPath)
 
 bool UCSAssembly::LoadAssembly(bool bisCollectible)
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(*FString(TEXT("UCSAssembly::LoadAssembly: " + AssemblyName.ToString())));
+	FCSScopedStartupPhase LoadAssemblyPhase(TEXT("UCSAssembly::LoadAssembly: ") + AssemblyName.ToString());
 
 	if (IsValidAssembly())
 	{
@@ -51,8 +109,12 @@ bool UCSAssembly::LoadAssembly(bool bisCollectible)
 	}
 
 	bIsLoading = true;
-	FGCHandle NewHandle = UCSManager::Get().GetManagedPluginsCallbacks().LoadPlugin(*AssemblyPath, bisCollectible);
-	NewHandle.Type = GCHandleType::WeakHandle;
+	FGCHandle NewHandle;
+	{
+		FCSScopedStartupPhase LoadPluginPhase(TEXT("LoadPlugin"));
+		NewHandle = LoadManagedPlugin(bisCollectible);
+	}
+	NewHandle.SetType(GCHandleType::WeakHandle);
 
 	if (NewHandle.IsNull())
 	{
@@ -60,47 +122,175 @@ bool UCSAssembly::LoadAssembly(bool bisCollectible)
 		return false;
 	}
 	
-	ManagedAssemblyHandle = MakeShared<FGCHandle>(NewHandle);
+	ManagedAssemblyHandle = NewHandle;
+	ManagedHandles.SetAssemblyHandle(NewHandle.GetHandle());
 	FModuleManager::Get().OnModulesChanged().AddUObject(this, &UCSAssembly::OnModulesChanged);
 
-	if (ProcessTypeMetadata())
+	bool bProcessedTypeMetadata;
 	{
-		for (const TPair<FCSFieldName, TSharedPtr<FCSManagedTypeInfo>>& NameToTypeInfo : AllTypes)
-		{
-			NameToTypeInfo.Value->StartBuildingManagedType();
-		}
+		FCSScopedStartupPhase ProcessMetadataPhase(TEXT("ProcessTypeMetadata"));
+		FCSScopedHotReloadPhase ParseMetadataPhase(FCSAtomicHotReloadState::EHotReloadPhase::ParseMetadata, AssemblyName);
+		bProcessedTypeMetadata = ProcessTypeMetadata();
+	}
+	
+	if (bProcessedTypeMetadata)
+	{
+		FCSScopedStartupPhase BuildTypesPhase(TEXT("BuildManagedTypes"));
+		FCSScopedHotReloadPhase RebuildTypesPhase(FCSAtomicHotReloadState::EHotReloadPhase::BuildTypes, AssemblyName);
+		BuildManagedTypes();
 	}
 
 	bIsLoading = false;
+	PrefetchedAssembly.Reset();
 	UCSManager::Get().OnManagedAssemblyLoadedEvent().Broadcast(AssemblyName);
 	return true;
 }
 
+// Too few entries to make dispatching to the task graph worth it.
+constexpr int32 MinEntriesForParallelWork = 16;
+
+struct FCSMetaDataEntry
+{
+	int32 Index;
+	FString StructureHash;
+	FString FunctionBodiesHash;
+};
+
+// Checks the content hashes of the entries against the registered types, without parsing the entries.
+// Entries whose structure is unchanged are left out of OutEntriesToParse.
+void FilterChangedMetaData(const FCSMetaDataArrayView& MetaDataArray, const TMap<FCSFieldName, TSharedPtr<FCSManagedTypeInfo>>& Map, TArray<FCSMetaDataEntry>& OutEntriesToParse)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCSAssembly::FilterChangedMetaData);
+	
+	OutEntriesToParse.Reserve(MetaDataArray.Num());
+	
+	for (int32 i = 0; i < MetaDataArray.Num(); ++i)
+	{
+		const FCSMetaDataView Entry = MetaDataArray.GetObject(i);
+
+		FCSMetaDataEntry& EntryToParse = OutEntriesToParse.Add_GetRef({ i });
+		Entry.TryGetStringField(TEXT("StructureHash"), EntryToParse.StructureHash);
+		Entry.TryGetStringField(TEXT("FunctionBodiesHash"), EntryToParse.FunctionBodiesHash);
+
+		// Nothing to compare against on the first load of an assembly, which is every load outside the editor.
+		if (EntryToParse.StructureHash.IsEmpty() || Map.IsEmpty())
+		{
+			continue;
+		}
+
+		const FCSFieldName FieldName(Entry.GetNameField(TEXT("Name")), Entry.GetNameField(TEXT("Namespace")));
+		TSharedPtr<FCSManagedTypeInfo> ExistingValue = Map.FindRef(FieldName);
+
+		if (!ExistingValue.IsValid() || ExistingValue->IsNativeType() || ExistingValue->GetStructureHash() != EntryToParse.StructureHash)
+		{
+			continue;
+		}
+
+		// Same structure, the metadata we already have is identical to this entry.
+		if (ExistingValue->GetStructureState() == UpToDate && ExistingValue->GetFunctionBodiesHash() != EntryToParse.FunctionBodiesHash)
+		{
+			ExistingValue->SetStructureState(HasChangedFunctionBodies);
+		}
+		
+		ExistingValue->SetContentHashes(EntryToParse.StructureHash, EntryToParse.FunctionBodiesHash);
+		OutEntriesToParse.Pop();
+	}
+}
+
+FGCHandleIntPtr UCSAssembly::LoadManagedPlugin(bool bIsCollectible) const
+{
+	const FCSManagedPluginCallbacks& PluginCallbacks = UCSManager::Get().GetManagedPluginsCallbacks();
+
+	if (GetDefault<UCSUnrealSharpSettings>()->ShouldShareAssemblyImages())
+	{
+		return PluginCallbacks.LoadPluginFromFile(*AssemblyPath, bIsCollectible);
+	}
+
+	if (PrefetchedAssembly.IsValid() && !PrefetchedAssembly->AssemblyFile.GetData().IsEmpty())
+	{
+		return PluginCallbacks.LoadPluginFromMemory(*AssemblyPath,
+			PrefetchedAssembly->AssemblyFile.GetData().GetData(), PrefetchedAssembly->AssemblyFile.GetData().Num(),
+			PrefetchedAssembly->PdbFile.GetData().GetData(), PrefetchedAssembly->PdbFile.GetData().Num(),
+			bIsCollectible);
+	}
+
+	// Map the image here so the runtime reads it straight from the mapping instead of opening the file on its own.
+	// Also works for assemblies that only exist in a pak, the platform file reads those if it can't map them.
+	FCSMappedFile AssemblyFile;
+	if (!AssemblyFile.Open(AssemblyPath))
+	{
+		return PluginCallbacks.LoadPlugin(*AssemblyPath, bIsCollectible);
+	}
+
+	FCSMappedFile PdbFile;
+	const FString PdbPath = FPaths::ChangeExtension(AssemblyPath, TEXT("pdb"));
+	if (FPaths::FileExists(PdbPath))
+	{
+		PdbFile.Open(PdbPath);
+	}
+
+	// The runtime keeps its own copy of the image, so the mappings can go as soon as this returns.
+	return PluginCallbacks.LoadPluginFromMemory(*AssemblyPath,
+		AssemblyFile.GetData().GetData(), AssemblyFile.GetData().Num(),
+		PdbFile.GetData().GetData(), PdbFile.GetData().Num(),
+		bIsCollectible);
+}
+
+template <typename MetaDataType>
+void ParseMetaData(const FCSMetaDataArrayView& MetaDataArray, TConstArrayView<FCSMetaDataEntry> Entries, TArray<TSharedPtr<MetaDataType>>& OutParsedMetaData)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCSAssembly::ParseMetaData);
+	
+	OutParsedMetaData.SetNum(Entries.Num());
+
+	// Each entry only reads its own part of the metadata and writes its own slot, so entries can be parsed in any order.
+	ParallelFor(Entries.Num(), [&MetaDataArray, &Entries, &OutParsedMetaData](int32 Index)
+	{
+		TSharedPtr<MetaDataType> ParsedMeta = MakeShared<MetaDataType>();
+		ParsedMeta->SerializeFromJson(MetaDataArray.GetObject(Entries[Index].Index));
+		OutParsedMetaData[Index] = MoveTemp(ParsedMeta);
+	}, Entries.Num() < MinEntriesForParallelWork ? EParallelForFlags::ForceSingleThread : EParallelForFlags::Unbalanced);
+}
+
+// Only classes can be patched in place, every other type is rebuilt when it changes.
+template <typename MetaDataType>
+bool CanPatchInPlace(const MetaDataType& NewMetaData, const MetaDataType& OldMetaData)
+{
+	return false;
+}
+
+bool CanPatchInPlace(const FCSClassMetaData& NewMetaData, const FCSClassMetaData& OldMetaData)
+{
+	return GetDefault<UCSUnrealSharpSettings>()->bPatchClassesInPlace && NewMetaData.CanPatchInPlace(OldMetaData);
+}
+
 template <typename T, typename MetaDataType>
-void RegisterMetaData(UCSAssembly* OwningAssembly, const TSharedPtr<FJsonValue>& MetaData,
+void RegisterMetaData(UCSAssembly* OwningAssembly, const TSharedPtr<MetaDataType>& ParsedMeta, const FCSMetaDataEntry& Entry,
 	TMap<FCSFieldName,
 	TSharedPtr<FCSManagedTypeInfo>>& Map,
 	UClass* FieldType,
 	TFunction<void(TSharedPtr<FCSManagedTypeInfo>)> OnRebuild = nullptr)
 {
-	const TSharedPtr<FJsonObject>& MetaDataObject = MetaData->AsObject();
-
-	const FString Name= MetaDataObject->GetStringField(TEXT("Name"));
-	const FString Namespace = MetaDataObject->GetStringField(TEXT("Namespace"));
-	const FCSFieldName FullName(*Name, *Namespace);
-
+	const FCSFieldName& FullName = ParsedMeta->FieldName;
 	TSharedPtr<FCSManagedTypeInfo> ExistingValue = Map.FindRef(FullName);
 
 	if (ExistingValue.IsValid())
 	{
-		// Parse fresh metadata and update the existing info
-		MetaDataType NewMeta;
-		NewMeta.SerializeFromJson(MetaDataObject);
-
-		if (ExistingValue->GetStructureState() == HasChangedStructure || NewMeta != *ExistingValue->GetTypeMetaData<MetaDataType>())
+		ExistingValue->SetContentHashes(Entry.StructureHash, Entry.FunctionBodiesHash);
+		
+		// Update the existing info with the fresh metadata
+		const TSharedPtr<MetaDataType> ExistingMeta = ExistingValue->GetTypeMetaData<MetaDataType>();
+		if (ExistingValue->GetStructureState() == HasChangedStructure || *ParsedMeta != *ExistingMeta)
 		{
-			TSharedPtr<MetaDataType> MetaDataPtr = MakeShared<MetaDataType>(NewMeta);
-			ExistingValue->SetTypeMetaData(MetaDataPtr);
+			// Same layout, so the built field keeps its instances and nothing deriving from it has to be rebuilt.
+			if (ExistingValue->IsBuilt() && ExistingValue->GetStructureState() != HasChangedStructure && CanPatchInPlace(*ParsedMeta, *ExistingMeta))
+			{
+				ExistingValue->SetTypeMetaData(ParsedMeta);
+				ExistingValue->SetStructureState(HasAddedFunctions);
+				return;
+			}
+			
+			ExistingValue->SetTypeMetaData(ParsedMeta);
 			ExistingValue->SetStructureState(HasChangedStructure);
 			
 			if (OnRebuild)
@@ -111,17 +301,101 @@ void RegisterMetaData(UCSAssembly* OwningAssembly, const TSharedPtr<FJsonValue>&
 	}
 	else
 	{
-		TSharedPtr<MetaDataType> ParsedMeta = MakeShared<MetaDataType>();
-		ParsedMeta->SerializeFromJson(MetaDataObject);
-		
 		TSharedPtr<T> NewValue = MakeShared<T>(ParsedMeta, OwningAssembly, FieldType);
+		NewValue->SetContentHashes(Entry.StructureHash, Entry.FunctionBodiesHash);
 		Map.Add(FullName, NewValue);
 	}
 }
 
-bool UCSAssembly::ProcessTypeMetadata()
+// Looking up the managed type handle is the slow part of registering a new type, so look them all up before registering.
+// Registering then finds them in the handle cache of the assembly.
+template <typename MetaDataType>
+void PrefetchTypeHandles(UCSAssembly* OwningAssembly, TConstArrayView<TSharedPtr<MetaDataType>> ParsedMetaData,
+	const TMap<FCSFieldName, TSharedPtr<FCSManagedTypeInfo>>& Map, UClass* FieldType)
+{
+	// Delegates are never looked up, see FCSManagedTypeInfo.
+	if (FieldType == UDelegateFunction::StaticClass())
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCSAssembly::PrefetchTypeHandles);
+
+	TArray<const FCSFieldName*> NewTypes;
+	NewTypes.Reserve(ParsedMetaData.Num());
+
+	for (const TSharedPtr<MetaDataType>& ParsedMeta : ParsedMetaData)
+	{
+		if (!Map.Contains(ParsedMeta->FieldName))
+		{
+			NewTypes.Add(&ParsedMeta->FieldName);
+		}
+	}
+
+	ParallelFor(NewTypes.Num(), [OwningAssembly, &NewTypes](int32 Index)
+	{
+		OwningAssembly->TryFindTypeHandle(*NewTypes[Index]);
+	}, NewTypes.Num() < MinEntriesForParallelWork ? EParallelForFlags::ForceSingleThread : EParallelForFlags::Unbalanced);
+}
+
+template <typename T, typename MetaDataType>
+void ParseAndRegisterMetaData(UCSAssembly* OwningAssembly, const FCSMetaDataArrayView& MetaDataArray,
+	TMap<FCSFieldName,
+	TSharedPtr<FCSManagedTypeInfo>>& Map,
+	UClass* FieldType,
+	TFunction<void(TSharedPtr<FCSManagedTypeInfo>)> OnRebuild = nullptr)
+{
+	TArray<FCSMetaDataEntry> EntriesToParse;
+	FilterChangedMetaData(MetaDataArray, Map, EntriesToParse);
+	
+	TArray<TSharedPtr<MetaDataType>> ParsedMetaData;
+	ParseMetaData(MetaDataArray, EntriesToParse, ParsedMetaData);
+	PrefetchTypeHandles<MetaDataType>(OwningAssembly, ParsedMetaData, Map, FieldType);
+
+	// Registering touches the type map and UObjects, keep that on this thread and in metadata order.
+	for (int32 i = 0; i < ParsedMetaData.Num(); ++i)
+	{
+		RegisterMetaData<T, MetaDataType>(OwningAssembly, ParsedMetaData[i], EntriesToParse[i], Map, FieldType, OnRebuild);
+	}
+}
+
+bool UCSAssembly::ReadTypeMetadata(TFunctionRef<void(const FCSMetaDataView&)> Callback) const
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(UCSAssembly::ProcessTypeMetadata);
+	if (PrefetchedAssembly.IsValid())
+	{
+		if (const FCSBinaryMetaData* BinaryMetaData = PrefetchedAssembly->BinaryMetaData.Get())
+		{
+			Callback(FCSMetaDataView(BinaryMetaData, BinaryMetaData->GetRootOffset()));
+			return true;
+		}
+
+		if (PrefetchedAssembly->JsonMetaData.IsValid())
+		{
+			Callback(PrefetchedAssembly->JsonMetaData);
+			return true;
+		}
+	}
+
+	// Prefer the binary metadata, it's read in place without building a DOM.
+	const FString BinaryMetadataPath = FPaths::ChangeExtension(AssemblyPath, "metadata.bin");
+	if (FPaths::FileExists(BinaryMetadataPath))
+	{
+		FCSBinaryMetaData BinaryMetaData;
+		if (BinaryMetaData.Open(BinaryMetadataPath))
+		{
+			Callback(FCSMetaDataView(&BinaryMetaData, BinaryMetaData.GetRootOffset()));
+			return true;
+		}
+
+		UE_LOGFMT(LogUnrealSharp, Warning, "Failed to read binary metadata at {0}, falling back to JSON", *BinaryMetadataPath);
+	}
+#if !WITH_EDITOR
+	else
+	{
+		// Packaged builds are expected to stage the binary metadata, the JSON fallback costs every boot a full parse.
+		UE_LOGFMT(LogUnrealSharp, Warning, "No binary metadata staged for {0}, falling back to JSON", *AssemblyName.ToString());
+	}
+#endif
 
 	const FString MetadataPath = FPaths::ChangeExtension(AssemblyPath, "metadata.json");
 	if (!FPaths::FileExists(MetadataPath))
@@ -142,39 +416,146 @@ bool UCSAssembly::ProcessTypeMetadata()
 		UE_LOG(LogUnrealSharp, Fatal, TEXT("Failed to parse JSON at: %s"), *MetadataPath);
 		return false;
 	}
-	
-	UCSManager& Manager = UCSManager::Get();
 
-	const TArray<TSharedPtr<FJsonValue>>& StructMetaData = JsonObject->GetArrayField(TEXT("StructMetaData"));
-	for (const TSharedPtr<FJsonValue>& MetaData : StructMetaData)
+	Callback(JsonObject);
+	return true;
+}
+
+bool UCSAssembly::ProcessTypeMetadata()
+{
+	return ReadTypeMetadata([this](const FCSMetaDataView& RootObject)
+	{
+		// The weaver hashes the metadata as a whole. When it matches what is registered, every entry would be filtered out anyway.
+		FString MetadataHash;
+		RootObject.TryGetStringField(TEXT("ContentHash"), MetadataHash);
+		
+		if (!MetadataHash.IsEmpty() && MetadataHash == RegisteredMetadataHash && !AllTypes.IsEmpty())
+		{
+			UE_LOGFMT(LogUnrealSharp, Verbose, "Metadata of {0} is unchanged, skipping registration", *AssemblyName.ToString());
+			return;
+		}
+		
+		RegisterTypeMetadata(RootObject);
+		RegisteredMetadataHash = MetadataHash;
+	});
+}
+
+void UCSAssembly::GetBuildOrder(TArray<TSharedPtr<FCSManagedTypeInfo>>& OutBuildOrder) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCSAssembly::GetBuildOrder);
+
+	// Non-class types go first, since the properties and functions of classes reference them. Classes follow by how many
+	// of their parents are defined in this assembly, so a parent is always built before its children.
+	// Anything still out of order, like structs that reference other structs, is built on demand through FindType.
+	TArray<TPair<int32, TSharedPtr<FCSManagedTypeInfo>>> RankedTypes;
+	RankedTypes.Reserve(AllTypes.Num());
+
+	for (const TPair<FCSFieldName, TSharedPtr<FCSManagedTypeInfo>>& NameToTypeInfo : AllTypes)
 	{
-		RegisterMetaData<FCSManagedTypeInfo, FCSStructMetaData>(this, MetaData, AllTypes, UCSScriptStruct::StaticClass());
+		const TSharedPtr<FCSManagedTypeInfo>& TypeInfo = NameToTypeInfo.Value;
+
+		int32 Rank = 0;
+		if (!TypeInfo->IsNativeType() && TypeInfo->GetFieldClass() == UCSClass::StaticClass())
+		{
+			Rank = 1;
+
+			const FCSManagedTypeInfo* Current = TypeInfo.Get();
+			while (Rank <= AllTypes.Num())
+			{
+				const FCSFieldName& ParentName = Current->GetTypeMetaData<FCSClassMetaData>()->ParentClass.FieldName;
+				const TSharedPtr<FCSManagedTypeInfo>* Parent = AllTypes.Find(ParentName);
+
+				if (!Parent || (*Parent)->IsNativeType() || (*Parent)->GetFieldClass() != UCSClass::StaticClass())
+				{
+					break;
+				}
+
+				Current = Parent->Get();
+				++Rank;
+			}
+		}
+
+		RankedTypes.Emplace(Rank, TypeInfo);
 	}
 
-	const TArray<TSharedPtr<FJsonValue>>& EnumMetaData = JsonObject->GetArrayField(TEXT("EnumMetaData"));
-	for (const TSharedPtr<FJsonValue>& MetaData : EnumMetaData)
+	Algo::StableSortBy(RankedTypes, [](const TPair<int32, TSharedPtr<FCSManagedTypeInfo>>& RankedType) { return RankedType.Key; });
+
+	OutBuildOrder.Reset(RankedTypes.Num());
+	for (TPair<int32, TSharedPtr<FCSManagedTypeInfo>>& RankedType : RankedTypes)
 	{
-		RegisterMetaData<FCSManagedTypeInfo, FCSEnumMetaData>(this, MetaData, AllTypes, UCSEnum::StaticClass());
+		OutBuildOrder.Add(MoveTemp(RankedType.Value));
 	}
+}
 
-	const TArray<TSharedPtr<FJsonValue>>& InterfacesMetaData = JsonObject->GetArrayField(TEXT("InterfacesMetaData"));
-	for (const TSharedPtr<FJsonValue>& MetaData : InterfacesMetaData)
+void UCSAssembly::BuildManagedTypes()
+{
+	const UCSUnrealSharpSettings* Settings = GetDefault<UCSUnrealSharpSettings>();
+	if (!Settings->UseLazyTypeBuilding())
 	{
-		RegisterMetaData<FCSManagedTypeInfo, FCSInterfaceMetaData>(this, MetaData, AllTypes, UCSInterface::StaticClass());
+		TArray<TSharedPtr<FCSManagedTypeInfo>> BuildOrder;
+		GetBuildOrder(BuildOrder);
+
+		for (const TSharedPtr<FCSManagedTypeInfo>& TypeInfo : BuildOrder)
+		{
+			TypeInfo->StartBuildingManagedType();
+		}
+		
+		return;
 	}
 
-	const TArray<TSharedPtr<FJsonValue>>& DelegatesMetaData = JsonObject->GetArrayField(TEXT("DelegateMetaData"));
-	for (const TSharedPtr<FJsonValue>& MetaData : DelegatesMetaData)
+	// The rest is built through FindType the first time something references it.
+	// Already built types still need to pick up structural changes right away.
+	for (const TPair<FCSFieldName, TSharedPtr<FCSManagedTypeInfo>>& NameToTypeInfo : AllTypes)
 	{
-		RegisterMetaData<FCSManagedTypeInfo, FCSDelegateMetaData>(this, MetaData, AllTypes, UDelegateFunction::StaticClass());
+		if (NameToTypeInfo.Value->IsBuilt())
+		{
+			NameToTypeInfo.Value->StartBuildingManagedType();
+		}
 	}
 
-	const TArray<TSharedPtr<FJsonValue>>& ClassesMetaData = JsonObject->GetArrayField(TEXT("ClassMetaData"));
-	for (const TSharedPtr<FJsonValue>& MetaData : ClassesMetaData)
+	for (const FString& WarmUpType : Settings->WarmUpTypes)
 	{
-		RegisterMetaData<FCSClassInfo, FCSClassMetaData>(this, MetaData, AllTypes, UCSClass::StaticClass(),
+		FString Namespace;
+		FString TypeName;
+		if (!WarmUpType.Split(TEXT("."), &Namespace, &TypeName, ESearchCase::CaseSensitive, ESearchDir::FromEnd))
+		{
+			TypeName = WarmUpType;
+		}
+
+		TSharedPtr<FCSManagedTypeInfo> TypeInfo = AllTypes.FindRef(FCSFieldName(*TypeName, *Namespace));
+		if (TypeInfo.IsValid())
+		{
+			TypeInfo->StartBuildingManagedType();
+		}
+	}
+}
+
+void UCSAssembly::RegisterTypeMetadata(const FCSMetaDataView& RootObject)
+{
+	UCSManager& Manager = UCSManager::Get();
+
+	const FCSMetaDataArrayView StructMetaData = RootObject.GetArrayField(TEXT("StructMetaData"));
+	ParseAndRegisterMetaData<FCSManagedTypeInfo, FCSStructMetaData>(this, StructMetaData, AllTypes, UCSScriptStruct::StaticClass());
+
+	const FCSMetaDataArrayView EnumMetaData = RootObject.GetArrayField(TEXT("EnumMetaData"));
+	ParseAndRegisterMetaData<FCSManagedTypeInfo, FCSEnumMetaData>(this, EnumMetaData, AllTypes, UCSEnum::StaticClass());
+
+	const FCSMetaDataArrayView InterfacesMetaData = RootObject.GetArrayField(TEXT("InterfacesMetaData"));
+	ParseAndRegisterMetaData<FCSManagedTypeInfo, FCSInterfaceMetaData>(this, InterfacesMetaData, AllTypes, UCSInterface::StaticClass());
+
+	const FCSMetaDataArrayView DelegatesMetaData = RootObject.GetArrayField(TEXT("DelegateMetaData"));
+	ParseAndRegisterMetaData<FCSManagedTypeInfo, FCSDelegateMetaData>(this, DelegatesMetaData, AllTypes, UDelegateFunction::StaticClass());
+
+	const FCSMetaDataArrayView ClassesMetaData = RootObject.GetArrayField(TEXT("ClassMetaData"));
+	ParseAndRegisterMetaData<FCSClassInfo, FCSClassMetaData>(this, ClassesMetaData, AllTypes, UCSClass::StaticClass(),
          [&Manager](const TSharedPtr<FCSManagedTypeInfo>& ClassInfo)
          {
+             if (!ClassInfo->IsBuilt())
+             {
+                 // Never built, so nothing can derive from it yet.
+                 return;
+             }
+             
              // Structure has been changed. We must trigger full reload on all managed classes that derive from this class.
              TArray<UClass*> DerivedClasses;
              GetDerivedClasses(ClassInfo->GetFieldChecked<UClass>(), DerivedClasses);
@@ -191,9 +572,6 @@ bool UCSAssembly::ProcessTypeMetadata()
                  ChildClassInfo->SetStructureState(HasChangedStructure);
              }
          });
-	}
-
-	return true;
 }
 
 bool UCSAssembly::UnloadAssembly()
@@ -207,52 +585,151 @@ bool UCSAssembly::UnloadAssembly()
 
 	TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(*FString(TEXT("UCSAssembly::UnloadAssembly: " + AssemblyName.ToString())));
 
-	FGCHandleIntPtr AssemblyHandle = ManagedAssemblyHandle->GetHandle();
-	for (TSharedPtr<FGCHandle>& Handle : AllocatedManagedHandles)
+	// Jobs on worker threads may still be running code from the assembly.
+	FCSManagedJobs::WaitForInFlightJobs();
+
+	// Delegates of managed timers may come from the assembly.
+	FCSManagedTimers::ClearAll();
+
+	// The counterparts of the subsystems are about to be replaced.
+	FCSSubsystemHandleCache::Reset();
+
+	// So are the type handles of the interface wrappers.
+	FCSInterfaceDispatchCache::Reset();
+
+	// And the properties the save data layouts of its types point at.
+	FCSSaveGameSerializer::Reset();
+
+	// And the params of its functions the cached native invocations point at.
+	UUFunctionExporter::FlushNativeFunctionInvocations();
+
+	// Handles of deleted objects may still be waiting for disposal, they must go before the assembly does.
+	UCSManager::Get().FlushDeferredHandles(true);
+
+	// The wrappers are disposed with the rest of the store, the table must not hand them out afterwards.
+	UCSManager::Get().RemoveInterfaceWrappers(ManagedHandles);
+
+	// Instances outlive the store, they must not keep pointing into it.
+	UCSManager::Get().ClearCachedManagedHandles(ManagedHandles);
+
+	FGCHandleIntPtr AssemblyHandle = ManagedAssemblyHandle.GetHandle();
+	ManagedHandles.DisposeAll(AssemblyHandle);
+	ManagedHandles.SetAssemblyHandle(FGCHandleIntPtr());
 	{
-		Handle->Dispose(AssemblyHandle);
-		Handle.Reset();
+		FWriteScopeLock WriteLock(ManagedClassHandlesLock);
+		ManagedClassHandles.Reset();
 	}
 
-	ManagedClassHandles.Reset();
-	AllocatedManagedHandles.Reset();
-
 	// Don't need the assembly handle anymore, we use the path to unload the assembly.
-	ManagedAssemblyHandle->Dispose(ManagedAssemblyHandle->GetHandle());
-	ManagedAssemblyHandle.Reset();
+	ManagedAssemblyHandle.Dispose(AssemblyHandle);
 
 	return UCSManager::Get().GetManagedPluginsCallbacks().UnloadPlugin(*AssemblyPath);
 }
 
-TSharedPtr<FGCHandle> UCSAssembly::TryFindTypeHandle(const FCSFieldName& FieldName)
+FGCHandle* UCSAssembly::TryFindTypeHandle(const FCSFieldName& FieldName)
 {
 	if (!IsValidAssembly())
 	{
 		return nullptr;
 	}
 
-	if (TSharedPtr<FGCHandle>* Handle = ManagedClassHandles.Find(FieldName))
 	{
-		return *Handle;
+		FReadScopeLock ReadLock(ManagedClassHandlesLock);
+		if (FGCHandle* const* Handle = ManagedClassHandles.Find(FieldName))
+		{
+			return *Handle;
+		}
 	}
 
 	FString FullName = FieldName.GetFullName().ToString();
-	uint8* TypeHandle = FCSManagedCallbacks::ManagedCallbacks.LookupManagedType(ManagedAssemblyHandle->GetPointer(), *FullName);
+	uint8* TypeHandle = FCSManagedCallbacks::ManagedCallbacks.LookupManagedType(ManagedAssemblyHandle.GetPointer(), *FullName);
 
 	if (!TypeHandle)
 	{
 		return nullptr;
 	}
 
-	TSharedPtr<FGCHandle> AllocatedHandle = MakeShared<FGCHandle>(TypeHandle, GCHandleType::WeakHandle);
-	AllocatedManagedHandles.Add(AllocatedHandle);
+	FWriteScopeLock WriteLock(ManagedClassHandlesLock);
+	
+	// Another thread may have looked up the same type in the meantime, keep theirs.
+	if (FGCHandle* const* RacedHandle = ManagedClassHandles.Find(FieldName))
+	{
+		FGCHandle DuplicateHandle(TypeHandle, GCHandleType::WeakHandle);
+		DuplicateHandle.Dispose(ManagedAssemblyHandle.GetHandle());
+		return *RacedHandle;
+	}
+
+	FGCHandle* AllocatedHandle = ManagedHandles.Allocate(FGCHandle(TypeHandle, GCHandleType::WeakHandle));
 	ManagedClassHandles.Add(FieldName, AllocatedHandle);
 	return AllocatedHandle;
 }
 
-TSharedPtr<FGCHandle> UCSAssembly::GetManagedMethod(const TSharedPtr<FGCHandle>& TypeHandle, const FString& MethodName)
+void UCSAssembly::GetManagedMethods(const FGCHandle* TypeHandle, TConstArrayView<FName> FunctionNames, TArray<FGCHandle*>& OutMethodHandles)
 {
-	if (!TypeHandle.IsValid())
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCSAssembly::GetManagedMethods);
+	
+	OutMethodHandles.Reset(FunctionNames.Num());
+	OutMethodHandles.AddZeroed(FunctionNames.Num());
+	
+	if (!TypeHandle || TypeHandle->IsNull() || FunctionNames.IsEmpty())
+	{
+		return;
+	}
+
+	TArray<FString> NameStrings;
+	TArray<const TCHAR*> NamePtrs;
+	NameStrings.Reserve(FunctionNames.Num());
+	NamePtrs.Reserve(FunctionNames.Num());
+	
+	for (const FName& FunctionName : FunctionNames)
+	{
+		NamePtrs.Add(*NameStrings.Add_GetRef(FunctionName.ToString()));
+	}
+
+	TArray<uint8*> MethodPtrs;
+	MethodPtrs.SetNumZeroed(FunctionNames.Num());
+	
+	const int32 NumFound = FCSManagedCallbacks::ManagedCallbacks.LookupManagedMethods(TypeHandle->GetPointer(), NamePtrs.GetData(), MethodPtrs.GetData(), FunctionNames.Num());
+	if (NumFound == 0)
+	{
+		return;
+	}
+
+	for (int32 i = 0; i < MethodPtrs.Num(); ++i)
+	{
+		if (MethodPtrs[i])
+		{
+			OutMethodHandles[i] = ManagedHandles.Allocate(FGCHandle(MethodPtrs[i], GCHandleType::WeakHandle));
+		}
+	}
+}
+
+void UCSAssembly::GetGeneratedTypeNames(TArray<FString>& OutTypeNames) const
+{
+	if (!IsValidAssembly())
+	{
+		return;
+	}
+
+	FString TypeNames;
+	FCSManagedCallbacks::ManagedCallbacks.GetGeneratedTypeNames(ManagedAssemblyHandle.GetPointer(), &TypeNames);
+	TypeNames.ParseIntoArray(OutTypeNames, TEXT(";"));
+}
+
+int32 UCSAssembly::PrepareChangedMethods() const
+{
+	if (!IsValidAssembly() || !FCSManagedCallbacks::ManagedCallbacks.PrepareChangedMethods)
+	{
+		return 0;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCSAssembly::PrepareChangedMethods);
+	return FCSManagedCallbacks::ManagedCallbacks.PrepareChangedMethods(ManagedAssemblyHandle.GetPointer());
+}
+
+FGCHandle* UCSAssembly::GetManagedMethod(const FGCHandle* TypeHandle, const FString& MethodName)
+{
+	if (!TypeHandle)
 	{
 		UE_LOGFMT(LogUnrealSharp, Error, "Type handle is invalid for method %s", *MethodName);
 		return nullptr;
@@ -266,19 +743,31 @@ TSharedPtr<FGCHandle> UCSAssembly::GetManagedMethod(const TSharedPtr<FGCHandle>&
 		return nullptr;
 	}
 
-	TSharedPtr<FGCHandle> AllocatedHandle = MakeShared<FGCHandle>(MethodHandle, GCHandleType::WeakHandle);
-	AllocatedManagedHandles.Add(AllocatedHandle);
-	return AllocatedHandle;
+	return ManagedHandles.Allocate(FGCHandle(MethodHandle, GCHandleType::WeakHandle));
+}
+
+void UCSAssembly::GatherMemoryStats(FCSAssemblyMemoryStats& OutStats) const
+{
+	const FCSManagedHandleStore::FStats HandleStats = ManagedHandles.GetStats();
+
+	OutStats.AssemblyName = AssemblyName;
+	OutStats.NumHandles = ManagedHandles.Num();
+	OutStats.NumStrongHandles = HandleStats.NumStrongHandles;
+	OutStats.NumWeakHandles = HandleStats.NumWeakHandles;
+	OutStats.NumPinnedHandles = HandleStats.NumPinnedHandles;
+	OutStats.HandleBytes = HandleStats.AllocatedBytes;
+	OutStats.NumTypes = AllTypes.Num();
+	OutStats.TypeTableBytes = AllTypes.GetAllocatedSize();
 }
 
-TSharedPtr<FGCHandle> UCSAssembly::CreateManagedObject(const UObject* Object)
+FGCHandle* UCSAssembly::CreateManagedObject(const UObject* Object)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(UCSAssembly::CreateManagedObject);
 	
 	// Only managed/native classes have a C# counterpart.
 	UClass* Class = FCSClassUtilities::GetFirstNonBlueprintClass(Object->GetClass());
 	TSharedPtr<FCSManagedTypeInfo> TypeInfo = FindOrAddTypeInfo(Class);
-	TSharedPtr<FGCHandle> TypeHandle = TypeInfo->GetManagedTypeHandle();
+	FGCHandle* TypeHandle = TypeInfo->GetManagedTypeHandle();
 
 	TCHAR* Error = nullptr;
 	// 使用智能对象管理器创建优化的句柄
@@ -298,60 +787,93 @@ TSharedPtr<FGCHandle> UCSAssembly::CreateManagedObject(const UObject* Object)
 		return nullptr;
 	}
 
-	TSharedPtr<FGCHandle> Handle = MakeShared<FGCHandle>(NewManagedObject);
-	AllocatedManagedHandles.Add(Handle);
+	FGCHandle* Handle = ManagedHandles.Allocate(NewManagedObject);
+	UCSManager::Get().AddManagedObjectHandle(Object, Handle);
 
-	uint32 ObjectID = Object->GetUniqueID();
-	
-	// Use write lock to safely add to ManagedObjectHandles
+	if (UCSClass* ManagedClass = FCSClassUtilities::GetFirstManagedClass(Object->GetClass()))
 	{
-		FWriteScopeLock WriteLock(UCSManager::Get().ManagedObjectHandlesLock);
-		UCSManager::Get().ManagedObjectHandles.AddByHash(ObjectID, ObjectID, Handle);
+		ManagedClass->CacheManagedHandle(const_cast<UObject*>(Object), Handle);
 	}
 
 	return Handle;
 }
 
-TSharedPtr<FGCHandle> UCSAssembly::FindOrCreateManagedInterfaceWrapper(UObject* Object, UClass* InterfaceClass)
+int32 UCSAssembly::CreateManagedObjects(UClass* Class, TConstArrayView<const UObject*> Objects)
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(UCSAssembly::FindOrCreateManagedInterfaceWrapper);
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCSAssembly::CreateManagedObjects);
+
+	if (Objects.IsEmpty())
+	{
+		return 0;
+	}
+
+	TSharedPtr<FCSManagedTypeInfo> TypeInfo = FindOrAddTypeInfo(Class);
+	FGCHandle* TypeHandle = TypeInfo.IsValid() ? TypeInfo->GetManagedTypeHandle() : nullptr;
+	if (!TypeHandle || TypeHandle->IsNull())
+	{
+		UE_LOGFMT(LogUnrealSharp, Warning, "Failed to find the managed type of {0}", *Class->GetName());
+		return 0;
+	}
+
+	TArray<FGCHandleIntPtr> NewHandles;
+	NewHandles.SetNum(Objects.Num());
+
+	const int32 NumCreated = FCSManagedCallbacks::ManagedCallbacks.CreateNewManagedObjects(reinterpret_cast<const void* const*>(Objects.GetData()),
+		TypeHandle->GetPointer(), NewHandles.GetData(), Objects.Num());
+
+	UCSClass* ManagedClass = FCSClassUtilities::GetFirstManagedClass(Class);
+	for (int32 i = 0; i < Objects.Num(); ++i)
+	{
+		if (!NewHandles[i].IntPtr)
+		{
+			continue;
+		}
+
+		const UObject* Object = Objects[i];
+		FGCHandle* Handle = ManagedHandles.Allocate(FGCHandle(NewHandles[i], UCSObjectManager::DetermineOptimalHandleType(Object)));
+		UCSManager::Get().AddManagedObjectHandle(Object, Handle);
+
+		if (ManagedClass)
+		{
+			ManagedClass->CacheManagedHandle(const_cast<UObject*>(Object), Handle);
+		}
+	}
+
+	return NumCreated;
+}
 
+FGCHandle* UCSAssembly::FindInterfaceTypeHandle(UClass* InterfaceClass)
+{
 	UClass* NonBlueprintClass = FCSClassUtilities::GetFirstNonBlueprintClass(InterfaceClass);
 	TSharedPtr<FCSManagedTypeInfo> ClassInfo = FindOrAddTypeInfo(NonBlueprintClass);
-	TSharedPtr<FGCHandle> TypeHandle = ClassInfo->GetManagedTypeHandle();
-	
-	uint32 ObjectID = Object->GetUniqueID();
-	uint32 TypeId = InterfaceClass->GetUniqueID();
+	return ClassInfo ? ClassInfo->GetManagedTypeHandle() : nullptr;
+}
+
+FGCHandle* UCSAssembly::FindOrCreateManagedInterfaceWrapper(UObject* Object, UClass* InterfaceClass, const FGCHandle& TypeHandle)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCSAssembly::FindOrCreateManagedInterfaceWrapper);
 	
-	// Use locks to safely access both ManagedInterfaceWrappers and ManagedObjectHandles
-	TSharedPtr<FGCHandle>* ObjectHandle = nullptr;
-	TSharedPtr<FGCHandle>* ExistingWrapper = nullptr;
+	UCSManager& Manager = UCSManager::Get();
+	const int32 ObjectID = Object->GetUniqueID();
+	const uint32 TypeId = InterfaceClass->GetUniqueID();
 	
-	// First, check for existing wrapper and get object handle (read locks)
+	// Objects that never got a wrapper don't need to touch the wrapper table at all.
+	if (Manager.ManagedObjectHandles.HasInterfaceWrappers(Object))
 	{
-		FReadScopeLock InterfaceReadLock(UCSManager::Get().ManagedInterfaceWrappersLock);
-		if (TMap<uint32, TSharedPtr<FGCHandle>>* TypeMap = UCSManager::Get().ManagedInterfaceWrappers.FindByHash(ObjectID, ObjectID))
+		if (FGCHandle* ExistingWrapper = Manager.ManagedInterfaceWrappers.Find(ObjectID, TypeId))
 		{
-			ExistingWrapper = TypeMap->FindByHash(TypeId, TypeId);
-			if (ExistingWrapper)
-			{
-				return *ExistingWrapper;
-			}
+			return ExistingWrapper;
 		}
 	}
 	
-	// Get object handle
+	const FGCHandle* ObjectHandle = Manager.ManagedObjectHandles.Find(Object);
+	if (ObjectHandle == nullptr)
 	{
-		FReadScopeLock ObjectReadLock(UCSManager::Get().ManagedObjectHandlesLock);
-		ObjectHandle = UCSManager::Get().ManagedObjectHandles.FindByHash(ObjectID, ObjectID);
-		if (ObjectHandle == nullptr)
-		{
-			return nullptr;
-		}
+		return nullptr;
 	}
     
-	FGCHandle NewManagedObjectWrapper = FCSManagedCallbacks::ManagedCallbacks.CreateNewManagedObjectWrapper((*ObjectHandle)->GetPointer(), TypeHandle->GetPointer());
-	NewManagedObjectWrapper.Type = GCHandleType::StrongHandle;
+	FGCHandle NewManagedObjectWrapper = FCSManagedCallbacks::ManagedCallbacks.CreateNewManagedObjectWrapper(ObjectHandle->GetPointer(), TypeHandle.GetPointer());
+	NewManagedObjectWrapper.SetType(GCHandleType::StrongHandle);
 
 	if (NewManagedObjectWrapper.IsNull())
 	{
@@ -360,22 +882,20 @@ TSharedPtr<FGCHandle> UCSAssembly::FindOrCreateManagedInterfaceWrapper(UObject*
 		return nullptr;
 	}
 
-	TSharedPtr<FGCHandle> Handle = MakeShared<FGCHandle>(NewManagedObjectWrapper);
-	AllocatedManagedHandles.Add(Handle);
+	FGCHandle* Handle = ManagedHandles.Allocate(NewManagedObjectWrapper);
+
+	// Flag the object before publishing the wrapper, so the deletion of the object always sees it.
+	Manager.ManagedObjectHandles.MarkHasInterfaceWrappers(Object);
 	
-	// Use write lock to safely add new wrapper to ManagedInterfaceWrappers
+	// Another thread may have added the same wrapper in the meantime, keep theirs.
+	FGCHandle* AddedWrapper = Manager.ManagedInterfaceWrappers.FindOrAdd(ObjectID, TypeId, Handle);
+	if (AddedWrapper != Handle)
 	{
-		FWriteScopeLock InterfaceWriteLock(UCSManager::Get().ManagedInterfaceWrappersLock);
-		TMap<uint32, TSharedPtr<FGCHandle>>& TypeMap = UCSManager::Get().ManagedInterfaceWrappers.FindOrAddByHash(ObjectID, ObjectID);
-		
-		// Double-check pattern: verify no other thread added the same wrapper
-		if (!TypeMap.FindByHash(TypeId, TypeId))
-		{
-			TypeMap.AddByHash(TypeId, TypeId, Handle);
-		}
+		Handle->Dispose(ManagedAssemblyHandle.GetHandle());
+		ManagedHandles.Free(Handle);
 	}
 	
-	return Handle;
+	return AddedWrapper;
 }
 
 void UCSAssembly::AddPendingClass(const FCSTypeReferenceMetaData& ParentClass, FCSClassInfo* NewClass)
@@ -1,6 +1,7 @@
 ﻿#pragma once
 
 #include "CSManagedGCHandle.h"
+#include "CSManagedHandleStore.h"
 #include "UnrealSharpCore.h"
 #include "Logging/StructuredLog.h"
 #include "TypeGenerator/Register/MetaData/CSTypeReferenceMetaData.h"
@@ -13,6 +14,8 @@
 
 struct FCSClassInfo;
 struct FCSManagedMethod;
+struct FCSAssemblyMemoryStats;
+struct FCSPrefetchedAssembly;
 class UCSClass;
 
 /**
@@ -26,17 +29,32 @@ class UCSAssembly : public UObject
 public:
 	void SetAssemblyPath(const FStringView InAssemblyPath);
 
+	// Reads the image, symbols and type metadata of an assembly so LoadAssembly doesn't have to. Safe on any thread.
+	// Without bReadImage only the metadata is read, for when the runtime maps the image itself.
+	static TSharedPtr<FCSPrefetchedAssembly> PrefetchAssembly(const FString& InAssemblyPath, bool bReadImage = true);
+	void SetPrefetchedAssembly(TSharedPtr<FCSPrefetchedAssembly> InPrefetchedAssembly) { PrefetchedAssembly = MoveTemp(InPrefetchedAssembly); }
+
 	UNREALSHARPCORE_API bool LoadAssembly(bool bIsCollectible = true);
 	UNREALSHARPCORE_API bool UnloadAssembly();
-	UNREALSHARPCORE_API bool IsValidAssembly() const { return ManagedAssemblyHandle.IsValid() && !ManagedAssemblyHandle->IsNull(); }
+	UNREALSHARPCORE_API bool IsValidAssembly() const { return !ManagedAssemblyHandle.IsNull(); }
 
 	FName GetAssemblyName() const { return AssemblyName; }
 	const FString& GetAssemblyPath() const { return AssemblyPath; }
 
 	bool IsLoading() const { return bIsLoading; }
 
-	TSharedPtr<FGCHandle> TryFindTypeHandle(const FCSFieldName& FieldName);
-	TSharedPtr<FGCHandle> GetManagedMethod(const TSharedPtr<FGCHandle>& TypeHandle, const FString& MethodName);
+	// Safe to call from any thread.
+	FGCHandle* TryFindTypeHandle(const FCSFieldName& FieldName);
+
+	// Full names of the glue types in this assembly, the C# counterparts of native types.
+	void GetGeneratedTypeNames(TArray<FString>& OutTypeNames) const;
+
+	// Compiles the methods whose IL changed since the last call for this assembly, on worker threads. Returns the number of methods compiled.
+	int32 PrepareChangedMethods() const;
+	FGCHandle* GetManagedMethod(const FGCHandle* TypeHandle, const FString& MethodName);
+
+	// Resolves the Invoke_ methods of all the functions in one call. Functions without a method get a null entry.
+	void GetManagedMethods(const FGCHandle* TypeHandle, TConstArrayView<FName> FunctionNames, TArray<FGCHandle*>& OutMethodHandles);
 
 	template<typename T = FCSManagedTypeInfo>
 	TSharedPtr<T> FindOrAddTypeInfo(UClass* Field)
@@ -112,17 +130,39 @@ public:
 	}
 
 	// Creates a C# counterpart for the given UObject.
-	TSharedPtr<FGCHandle> CreateManagedObject(const UObject* Object);
-	TSharedPtr<FGCHandle> FindOrCreateManagedInterfaceWrapper(UObject* Object, UClass* InterfaceClass);
+	FGCHandle* CreateManagedObject(const UObject* Object);
+
+	// Creates the C# counterparts of objects whose first non-Blueprint class is Class, with a single transition into C#.
+	// The objects must not have a counterpart yet. Returns the number created, the rest get theirs on first use.
+	int32 CreateManagedObjects(UClass* Class, TConstArrayView<const UObject*> Objects);
+
+	// The type handle of the managed wrapper of an interface, see FCSInterfaceDispatchCache.
+	FGCHandle* FindInterfaceTypeHandle(UClass* InterfaceClass);
+	FGCHandle* FindOrCreateManagedInterfaceWrapper(UObject* Object, UClass* InterfaceClass, const FGCHandle& TypeHandle);
+
+	// Gives a disposed object or wrapper handle back to the handle store.
+	void FreeManagedHandle(FGCHandle* Handle) { ManagedHandles.Free(Handle); }
+	int32 GetNumManagedHandles() const { return ManagedHandles.Num(); }
 
 	// Add a class that is waiting for its parent class to be loaded before it can be created.
 	void AddPendingClass(const FCSTypeReferenceMetaData& ParentClass, FCSClassInfo* NewClass);
 
-	TSharedPtr<const FGCHandle> GetManagedAssemblyHandle() const { return ManagedAssemblyHandle; }
+	const FGCHandle& GetManagedAssemblyHandle() const { return ManagedAssemblyHandle; }
+
+	// Handles and types of this assembly, for FCSHandleMemoryReport.
+	void GatherMemoryStats(FCSAssemblyMemoryStats& OutStats) const;
 
 private:
 	
+	FGCHandleIntPtr LoadManagedPlugin(bool bIsCollectible) const;
+	
+	bool ReadTypeMetadata(TFunctionRef<void(const FCSMetaDataView&)> Callback) const;
 	bool ProcessTypeMetadata();
+	void RegisterTypeMetadata(const FCSMetaDataView& RootObject);
+	void BuildManagedTypes();
+
+	// All types of this assembly, in the order they should be built in.
+	void GetBuildOrder(TArray<TSharedPtr<FCSManagedTypeInfo>>& OutBuildOrder) const;
 
 	void OnModulesChanged(FName InModuleName, EModuleChangeReason InModuleChangeReason);
 
@@ -150,18 +190,25 @@ private:
 
 	// All Unreal types that are defined in this assembly.
 	TMap<FCSFieldName, TSharedPtr<FCSManagedTypeInfo>> AllTypes;
+
+	// Content hash of the metadata that AllTypes was last registered from.
+	FString RegisteredMetadataHash;
 	
 	// All handles allocated by this assembly. Handles to types, methods, objects.
-	TArray<TSharedPtr<FGCHandle>> AllocatedManagedHandles;
+	FCSManagedHandleStore ManagedHandles;
+
+	// Files read ahead of LoadAssembly, released once it's done with them.
+	TSharedPtr<FCSPrefetchedAssembly> PrefetchedAssembly;
 
 	// Handles to all allocated UTypes (UClass/UStruct, etc) that are defined in this assembly.
-	TMap<FCSFieldName, TSharedPtr<FGCHandle>> ManagedClassHandles;
+	TMap<FCSFieldName, FGCHandle*> ManagedClassHandles;
+	FRWLock ManagedClassHandlesLock;
 
 	// Pending classes that are waiting for their parent class to be loaded by the engine.
 	TMap<FCSTypeReferenceMetaData, TSet<FCSClassInfo*>> PendingClasses;
 
 	// Handle to the Assembly object in C#.
-	TSharedPtr<FGCHandle> ManagedAssemblyHandle;
+	FGCHandle ManagedAssemblyHandle;
 
 	// Full path to the assembly file.
 	FString AssemblyPath;
@@ -0,0 +1,191 @@
+#include "CSAssemblyBudgets.h"
+#include "CSAssembly.h"
+#include "CSManager.h"
+#include "CSUnrealSharpSettings.h"
+#include "UnrealSharpCore.h"
+#include "HAL/IConsoleManager.h"
+#include "Logging/StructuredLog.h"
+#include "TypeGenerator/Functions/CSFunction.h"
+
+bool FCSAssemblyBudgets::bEnabled = false;
+bool FCSAssemblyBudgets::bHasBudgets = false;
+FCSOnAssemblyBudgetExceeded FCSAssemblyBudgets::OnBudgetExceeded;
+
+namespace
+{
+	FCriticalSection UsageLock;
+	TMap<FName, TUniquePtr<FCSAssemblyUsage>> UsageByAssembly;
+
+	float WarningInterval = 5.0f;
+
+	FAutoConsoleVariableRef CVarAssemblyBudgets(
+		TEXT("UnrealSharp.AssemblyBudgets"),
+		FCSAssemblyBudgets::bEnabled,
+		TEXT("Accounts the time of managed UFunction calls per assembly even when no assembly has a budget, for UnrealSharp.AssemblyUsage."));
+
+	FAutoConsoleVariableRef CVarAssemblyBudgetWarningInterval(
+		TEXT("UnrealSharp.AssemblyBudgets.WarningInterval"),
+		WarningInterval,
+		TEXT("Seconds between two warnings about the same assembly going over its budget."));
+
+	FAutoConsoleCommandWithOutputDevice DumpAssemblyUsageCommand(
+		TEXT("UnrealSharp.AssemblyUsage"),
+		TEXT("Prints the time and GC handles of every assembly whose managed UFunctions were called while accounting was on, against its budget."),
+		FConsoleCommandWithOutputDeviceDelegate::CreateStatic(&FCSAssemblyBudgets::Dump));
+
+	FAutoConsoleCommand ResetAssemblyUsageCommand(
+		TEXT("UnrealSharp.AssemblyUsage.Reset"),
+		TEXT("Resets the averages, peaks and frames over budget of UnrealSharp.AssemblyUsage."),
+		FConsoleCommandDelegate::CreateStatic(&FCSAssemblyBudgets::Reset));
+
+	// Weight of the last frame in the moving average.
+	constexpr double AverageWeight = 0.1;
+}
+
+FCSAssemblyUsage* FCSAssemblyBudgets::FindOrAddUsage(const UCSFunctionBase* Function)
+{
+	const UCSAssembly* Assembly = UCSManager::Get().FindOwningAssembly(Function->GetOwnerClass());
+	if (!Assembly)
+	{
+		return nullptr;
+	}
+
+	const FName AssemblyName = Assembly->GetAssemblyName();
+
+	FScopeLock Lock(&UsageLock);
+	TUniquePtr<FCSAssemblyUsage>& Usage = UsageByAssembly.FindOrAdd(AssemblyName);
+	if (!Usage)
+	{
+		Usage = MakeUnique<FCSAssemblyUsage>();
+		Usage->AssemblyName = AssemblyName;
+	}
+
+	return Usage.Get();
+}
+
+void FCSAssemblyBudgets::EndFrame()
+{
+	check(IsInGameThread());
+
+	const TMap<FName, FCSAssemblyBudget>& Budgets = GetDefault<UCSUnrealSharpSettings>()->AssemblyBudgets;
+	bHasBudgets = !Budgets.IsEmpty();
+
+	TArray<TPair<const FCSAssemblyUsage*, ECSAssemblyBudgetAction>, TInlineAllocator<4>> ExceededBudgets;
+	const double Now = FPlatformTime::Seconds();
+	UCSManager& Manager = UCSManager::Get();
+
+	{
+		FScopeLock Lock(&UsageLock);
+		for (const TPair<FName, TUniquePtr<FCSAssemblyUsage>>& Pair : UsageByAssembly)
+		{
+			FCSAssemblyUsage& Usage = *Pair.Value;
+			Usage.LastFrameCalls = Usage.FrameCalls.exchange(0, std::memory_order_relaxed);
+			Usage.LastFrameMs = FPlatformTime::ToMilliseconds64(Usage.FrameCycles.exchange(0, std::memory_order_relaxed));
+			Usage.AverageFrameMs += (Usage.LastFrameMs - Usage.AverageFrameMs) * AverageWeight;
+			Usage.PeakFrameMs = FMath::Max(Usage.PeakFrameMs, Usage.LastFrameMs);
+
+			const UCSAssembly* Assembly = Manager.FindAssembly(Usage.AssemblyName);
+			Usage.NumManagedHandles = Assembly ? Assembly->GetNumManagedHandles() : 0;
+
+			const FCSAssemblyBudget* Budget = Budgets.Find(Usage.AssemblyName);
+			const bool bOverTime = Budget && Budget->FrameTimeMs > 0.0f && Usage.LastFrameMs > Budget->FrameTimeMs;
+			const bool bOverHandles = Budget && Budget->MaxManagedHandles > 0 && Usage.NumManagedHandles > Budget->MaxManagedHandles;
+
+			// Only the time budget throttles, holding work back doesn't free any handles. Never twice in a row, so work
+			// that is over budget on its own still runs every other frame instead of starving.
+			const bool bWasThrottled = Usage.bThrottled.load(std::memory_order_relaxed);
+			Usage.bThrottled.store(bOverTime && Budget->Action == ECSAssemblyBudgetAction::Throttle && !bWasThrottled, std::memory_order_relaxed);
+
+			if (!bOverTime && !bOverHandles)
+			{
+				continue;
+			}
+
+			++Usage.NumFramesOverBudget;
+			ExceededBudgets.Emplace(&Usage, Budget->Action);
+
+			if (Now - Usage.LastWarningTime < WarningInterval)
+			{
+				continue;
+			}
+
+			Usage.LastWarningTime = Now;
+			if (bOverTime)
+			{
+				UE_LOGFMT(LogUnrealSharp, Warning, "{0} took {1} ms in {2} managed calls last frame, over its budget of {3} ms",
+					*Usage.AssemblyName.ToString(), Usage.LastFrameMs, Usage.LastFrameCalls, Budget->FrameTimeMs);
+			}
+
+			if (bOverHandles)
+			{
+				UE_LOGFMT(LogUnrealSharp, Warning, "{0} holds {1} GC handles, over its budget of {2}",
+					*Usage.AssemblyName.ToString(), Usage.NumManagedHandles, Budget->MaxManagedHandles);
+			}
+		}
+	}
+
+	// Usage entries are never removed, so they outlive the lock.
+	for (const TPair<const FCSAssemblyUsage*, ECSAssemblyBudgetAction>& Exceeded : ExceededBudgets)
+	{
+		OnBudgetExceeded.Broadcast(*Exceeded.Key, Exceeded.Value);
+	}
+}
+
+void FCSAssemblyBudgets::Dump(FOutputDevice& Ar)
+{
+	const TMap<FName, FCSAssemblyBudget>& Budgets = GetDefault<UCSUnrealSharpSettings>()->AssemblyBudgets;
+
+	FScopeLock Lock(&UsageLock);
+	if (UsageByAssembly.IsEmpty())
+	{
+		Ar.Logf(TEXT("No managed calls accounted, set a budget in the UnrealSharp settings or UnrealSharp.AssemblyBudgets 1."));
+		return;
+	}
+
+	Ar.Logf(TEXT("%-40s %10s %10s %10s %10s %12s %12s %10s %10s"), TEXT("Assembly"), TEXT("LastMs"), TEXT("AvgMs"), TEXT("PeakMs"),
+		TEXT("BudgetMs"), TEXT("Handles"), TEXT("MaxHandles"), TEXT("OverBudget"), TEXT("Throttled"));
+
+	for (const TPair<FName, TUniquePtr<FCSAssemblyUsage>>& Pair : UsageByAssembly)
+	{
+		const FCSAssemblyUsage& Usage = *Pair.Value;
+		const FCSAssemblyBudget* Budget = Budgets.Find(Usage.AssemblyName);
+
+		Ar.Logf(TEXT("%-40s %10.3f %10.3f %10.3f %10.3f %12d %12d %10lld %10s"), *Usage.AssemblyName.ToString(), Usage.LastFrameMs,
+			Usage.AverageFrameMs, Usage.PeakFrameMs, Budget ? Budget->FrameTimeMs : 0.0f, Usage.NumManagedHandles,
+			Budget ? Budget->MaxManagedHandles : 0, Usage.NumFramesOverBudget, Usage.bThrottled ? TEXT("yes") : TEXT("no"));
+	}
+}
+
+void FCSAssemblyBudgets::Reset()
+{
+	FScopeLock Lock(&UsageLock);
+	for (const TPair<FName, TUniquePtr<FCSAssemblyUsage>>& Pair : UsageByAssembly)
+	{
+		Pair.Value->AverageFrameMs = 0.0;
+		Pair.Value->PeakFrameMs = 0.0;
+		Pair.Value->NumFramesOverBudget = 0;
+	}
+}
+
+FCSScopedAssemblyUsage::FCSScopedAssemblyUsage(UCSFunctionBase* Function, int32 InNumCalls)
+{
+	if (!FCSAssemblyBudgets::IsEnabled())
+	{
+		return;
+	}
+
+	Usage = Function->GetAssemblyUsage();
+	NumCalls = InNumCalls;
+	StartCycles = FPlatformTime::Cycles64();
+}
+
+FCSScopedAssemblyUsage::~FCSScopedAssemblyUsage()
+{
+	if (!Usage)
+	{
+		return;
+	}
+
+	Usage->FrameCalls.fetch_add(NumCalls, std::memory_order_relaxed);
+	Usage->FrameCycles.fetch_add(FPlatformTime::Cycles64() - StartCycles, std::memory_order_relaxed);
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+class UCSFunctionBase;
+enum class ECSAssemblyBudgetAction : uint8;
+
+/**
+ * Time the managed UFunctions of one assembly took, and the GC handles it holds. Shared by every load of the assembly,
+ * so the numbers carry over hot reloads. Times are inclusive, a managed function that calls into another assembly counts the time of both.
+ */
+struct FCSAssemblyUsage
+{
+	FName AssemblyName;
+
+	// Written from any thread, collected by FCSAssemblyBudgets::EndFrame on the game thread.
+	std::atomic<int64> FrameCalls { 0 };
+	std::atomic<uint64> FrameCycles { 0 };
+
+	// Set on the game thread, read by the schedulers of managed work from any thread.
+	std::atomic<bool> bThrottled { false };
+
+	// Only touched on the game thread.
+	int64 LastFrameCalls = 0;
+	double LastFrameMs = 0.0;
+	double AverageFrameMs = 0.0;
+	double PeakFrameMs = 0.0;
+	int32 NumManagedHandles = 0;
+	int64 NumFramesOverBudget = 0;
+	double LastWarningTime = -DBL_MAX;
+};
+
+DECLARE_MULTICAST_DELEGATE_TwoParams(FCSOnAssemblyBudgetExceeded, const FCSAssemblyUsage&, ECSAssemblyBudgetAction);
+
+/**
+ * Accounts the game thread and worker time of managed UFunction calls to the assembly that owns the function, and checks it
+ * against the AssemblyBudgets of UCSUnrealSharpSettings once per frame. The memory of an assembly is measured by the GC handles
+ * it holds for its objects, which is what keeps its managed objects alive.
+ * An assembly over budget is warned about, at most once per UnrealSharp.AssemblyBudgets.WarningInterval, or throttled:
+ * its batched tick skips the next frame and catches up on the time it missed the frame after. OnBudgetExceeded lets game code
+ * hook its own scheduled work in. Accounting is on while any budget is set or UnrealSharp.AssemblyBudgets is set,
+ * UnrealSharp.AssemblyUsage prints the numbers.
+ */
+class UNREALSHARPCORE_API FCSAssemblyBudgets
+{
+public:
+	static bool IsEnabled() { return bEnabled || bHasBudgets; }
+
+	// Usage of the assembly that owns the function, created the first time one of its functions is accounted.
+	static FCSAssemblyUsage* FindOrAddUsage(const UCSFunctionBase* Function);
+
+	// Whether work scheduled for the assembly should wait a frame. Null usage, from a function that was never accounted, is never throttled.
+	static bool ShouldThrottle(const FCSAssemblyUsage* Usage)
+	{
+		return Usage && Usage->bThrottled.load(std::memory_order_relaxed);
+	}
+
+	// Must run on the game thread, once per frame.
+	static void EndFrame();
+
+	static void Dump(FOutputDevice& Ar);
+	static void Reset();
+
+	// Broadcast on the game thread for every assembly over one of its budgets at the end of a frame.
+	static FCSOnAssemblyBudgetExceeded OnBudgetExceeded;
+
+	// Set by UnrealSharp.AssemblyBudgets.
+	static bool bEnabled;
+
+private:
+	// Whether UCSUnrealSharpSettings has any budget, refreshed every frame.
+	static bool bHasBudgets;
+};
+
+/**
+ * Accounts one managed call, or one batch of them, to the assembly of the function.
+ */
+class FCSScopedAssemblyUsage
+{
+public:
+	FCSScopedAssemblyUsage(UCSFunctionBase* Function, int32 NumCalls = 1);
+	~FCSScopedAssemblyUsage();
+
+private:
+	FCSAssemblyUsage* Usage = nullptr;
+	uint64 StartCycles = 0;
+	int32 NumCalls = 0;
+};
@@ -0,0 +1,276 @@
+#include "CSBatchedTick.h"
+#include "CSAssemblyBudgets.h"
+#include "Components/ActorComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "TypeGenerator/CSClass.h"
+#include "TypeGenerator/Functions/CSFunction.h"
+#include "Utils/CSClassUtilities.h"
+
+namespace
+{
+	struct FBatchedTickGroup
+	{
+		TWeakObjectPtr<UCSClass> Class;
+		TArray<TWeakObjectPtr<UObject>> Objects;
+
+		// Time the group missed while its assembly was throttled, added to the next tick that runs.
+		float PendingDeltaTime = 0.0f;
+	};
+
+	struct FCSBatchedTickFunction : FTickFunction
+	{
+		// One group per managed class, since each of them has its own ReceiveTick override.
+		TArray<FBatchedTickGroup> Groups;
+
+		virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+
+		virtual FString DiagnosticMessage() override
+		{
+			return TEXT("FCSBatchedTick");
+		}
+	};
+
+	struct FWorldTickFunctions
+	{
+		TUniquePtr<FCSBatchedTickFunction> TickGroups[TG_MAX];
+	};
+
+	// Objects can be constructed on the async loading thread.
+	FCriticalSection PendingObjectsLock;
+	TArray<TWeakObjectPtr<UObject>> PendingObjects;
+
+	// Only touched on the game thread.
+	TMap<TObjectKey<UWorld>, FWorldTickFunctions> WorldTickFunctions;
+
+	FDelegateHandle PreActorTickHandle;
+	FDelegateHandle WorldCleanupHandle;
+
+	// Reused between ticks, so ticking doesn't allocate once they've grown.
+	TArray<UObject*> ObjectsToTick;
+	TArray<uint8> ParamsBlock;
+
+	bool TryGetDeltaTime(UObject* Object, float DeltaTime, float& OutDeltaTime)
+	{
+		if (AActor* Actor = Cast<AActor>(Object))
+		{
+			if (!Actor->HasActorBegunPlay() || Actor->IsActorBeingDestroyed())
+			{
+				return false;
+			}
+
+			OutDeltaTime = DeltaTime * Actor->CustomTimeDilation;
+			return true;
+		}
+
+		UActorComponent* Component = CastChecked<UActorComponent>(Object);
+		if (!Component->HasBegunPlay() || !Component->IsRegistered() || !Component->IsActive())
+		{
+			return false;
+		}
+
+		const AActor* Owner = Component->GetOwner();
+		OutDeltaTime = Owner ? DeltaTime * Owner->CustomTimeDilation : DeltaTime;
+		return true;
+	}
+
+	void TickClassGroup(FBatchedTickGroup& Group, float DeltaTime)
+	{
+		Group.Objects.RemoveAllSwap([](const TWeakObjectPtr<UObject>& Object) { return !Object.IsValid(); });
+
+		UCSFunctionBase* TickFunction = Group.Class->GetBatchedTickFunction();
+		const FFloatProperty* DeltaSecondsProperty = TickFunction ? CastField<FFloatProperty>(TickFunction->ChildProperties) : nullptr;
+		if (!DeltaSecondsProperty)
+		{
+			Group.Objects.Reset();
+			return;
+		}
+
+		if (FCSAssemblyBudgets::IsEnabled() && FCSAssemblyBudgets::ShouldThrottle(TickFunction->GetAssemblyUsage()))
+		{
+			Group.PendingDeltaTime += DeltaTime;
+			return;
+		}
+
+		DeltaTime += Group.PendingDeltaTime;
+		Group.PendingDeltaTime = 0.0f;
+
+		const int32 Stride = TickFunction->ParmsSize;
+
+		ObjectsToTick.Reset();
+		if (ParamsBlock.Num() < Group.Objects.Num() * Stride)
+		{
+			ParamsBlock.SetNumUninitialized(Group.Objects.Num() * Stride);
+		}
+
+		for (const TWeakObjectPtr<UObject>& WeakObject : Group.Objects)
+		{
+			UObject* Object = WeakObject.Get();
+
+			float ObjectDeltaTime;
+			if (!TryGetDeltaTime(Object, DeltaTime, ObjectDeltaTime))
+			{
+				continue;
+			}
+
+			uint8* Params = ParamsBlock.GetData() + ObjectsToTick.Num() * Stride;
+			DeltaSecondsProperty->SetPropertyValue_InContainer(Params, ObjectDeltaTime);
+			ObjectsToTick.Add(Object);
+		}
+
+		TickFunction->InvokeManagedMethodBatch(ObjectsToTick, ParamsBlock.GetData(), Stride);
+	}
+
+	void FCSBatchedTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FCSBatchedTick::ExecuteTick);
+
+		for (int32 i = Groups.Num() - 1; i >= 0; --i)
+		{
+			FBatchedTickGroup& Group = Groups[i];
+			if (Group.Class.IsValid())
+			{
+				TickClassGroup(Group, DeltaTime);
+			}
+
+			if (Group.Objects.IsEmpty())
+			{
+				Groups.RemoveAtSwap(i);
+			}
+		}
+	}
+
+	FCSBatchedTickFunction& FindOrAddTickFunction(UWorld* World, ETickingGroup TickGroup)
+	{
+		TUniquePtr<FCSBatchedTickFunction>& TickFunction = WorldTickFunctions.FindOrAdd(World).TickGroups[TickGroup];
+		if (!TickFunction)
+		{
+			TickFunction = MakeUnique<FCSBatchedTickFunction>();
+			TickFunction->bCanEverTick = true;
+			TickFunction->bStartWithTickEnabled = true;
+			TickFunction->bAllowTickOnDedicatedServer = true;
+			TickFunction->TickGroup = TickGroup;
+			TickFunction->RegisterTickFunction(World->PersistentLevel);
+		}
+
+		return *TickFunction;
+	}
+
+	void AddToWorld(UWorld* World, UObject* Object)
+	{
+		UCSClass* Class = FCSClassUtilities::GetFirstManagedClass(Object->GetClass());
+		FCSBatchedTickFunction& TickFunction = FindOrAddTickFunction(World, Class->GetBatchedTickGroup());
+
+		FBatchedTickGroup* Group = TickFunction.Groups.FindByPredicate([Class](const FBatchedTickGroup& ExistingGroup)
+		{
+			return ExistingGroup.Class == Class;
+		});
+
+		if (!Group)
+		{
+			Group = &TickFunction.Groups.AddDefaulted_GetRef();
+			Group->Class = Class;
+		}
+
+		Group->Objects.Add(Object);
+	}
+
+	void OnWorldPreActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+	{
+		if (!World->IsGameWorld())
+		{
+			return;
+		}
+
+		FScopeLock Lock(&PendingObjectsLock);
+
+		for (int32 i = PendingObjects.Num() - 1; i >= 0; --i)
+		{
+			UObject* Object = PendingObjects[i].Get();
+			if (!Object || Object->HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
+			{
+				PendingObjects.RemoveAtSwap(i);
+				continue;
+			}
+
+			UWorld* ObjectWorld = Object->GetWorld();
+			if (ObjectWorld == World)
+			{
+				AddToWorld(World, Object);
+				PendingObjects.RemoveAtSwap(i);
+				continue;
+			}
+
+			// Objects of streamed sublevels and World Partition cells are loaded before their level joins a game world,
+			// they wait until it does. Only editor worlds never become game worlds.
+			if (ObjectWorld && (ObjectWorld->WorldType == EWorldType::Editor || ObjectWorld->WorldType == EWorldType::EditorPreview))
+			{
+				PendingObjects.RemoveAtSwap(i);
+			}
+		}
+	}
+
+	void OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+	{
+		FWorldTickFunctions* TickFunctions = WorldTickFunctions.Find(World);
+		if (!TickFunctions)
+		{
+			return;
+		}
+
+		for (TUniquePtr<FCSBatchedTickFunction>& TickFunction : TickFunctions->TickGroups)
+		{
+			if (TickFunction)
+			{
+				TickFunction->UnRegisterTickFunction();
+			}
+		}
+
+		WorldTickFunctions.Remove(World);
+	}
+}
+
+void FCSBatchedTick::Initialize()
+{
+	check(IsInGameThread());
+
+	if (!PreActorTickHandle.IsValid())
+	{
+		PreActorTickHandle = FWorldDelegates::OnWorldPreActorTick.AddStatic(&OnWorldPreActorTick);
+		WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddStatic(&OnWorldCleanup);
+	}
+}
+
+void FCSBatchedTick::Shutdown()
+{
+	check(IsInGameThread());
+
+	FWorldDelegates::OnWorldPreActorTick.Remove(PreActorTickHandle);
+	FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
+	PreActorTickHandle.Reset();
+	WorldCleanupHandle.Reset();
+
+	for (TPair<TObjectKey<UWorld>, FWorldTickFunctions>& TickFunctions : WorldTickFunctions)
+	{
+		for (TUniquePtr<FCSBatchedTickFunction>& TickFunction : TickFunctions.Value.TickGroups)
+		{
+			if (TickFunction)
+			{
+				TickFunction->UnRegisterTickFunction();
+			}
+		}
+	}
+
+	WorldTickFunctions.Empty();
+
+	FScopeLock Lock(&PendingObjectsLock);
+	PendingObjects.Empty();
+}
+
+void FCSBatchedTick::Register(UObject* Object)
+{
+	check(Object->IsA<AActor>() || Object->IsA<UActorComponent>());
+
+	FScopeLock Lock(&PendingObjectsLock);
+	PendingObjects.Add(Object);
+}
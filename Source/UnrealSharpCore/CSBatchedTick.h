@@ -0,0 +1,20 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Ticks the instances of [BatchedTick] C# actors and components. Every game world gets a tick function per tick group in use,
+ * which calls the ReceiveTick override of each class on all its instances with a single transition into C#.
+ * Instances are registered on construction, from any thread, and picked up by their world before it ticks actors. Instances of levels that are
+ * still streaming in stay pending until their level is added to a game world. They tick once they began play,
+ * with the custom time dilation of their actor applied, and are dropped once they're destroyed.
+ */
+class UNREALSHARPCORE_API FCSBatchedTick
+{
+public:
+	static void Initialize();
+	static void Shutdown();
+
+	// Called from the managed object constructor for instances of batched classes.
+	static void Register(UObject* Object);
+};
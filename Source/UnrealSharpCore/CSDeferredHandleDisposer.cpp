@@ -0,0 +1,118 @@
+#include "CSDeferredHandleDisposer.h"
+#include "CSHandleEpoch.h"
+#include "CSManagedHandleStore.h"
+
+void FCSDeferredHandleDisposer::Enqueue(FGCHandle* Handle, FGCHandleIntPtr AssemblyHandle)
+{
+	if (!Handle)
+	{
+		return;
+	}
+
+	PendingHandles.Enqueue({ Handle, AssemblyHandle });
+	NumPending.fetch_add(1, std::memory_order_relaxed);
+}
+
+void FCSDeferredHandleDisposer::Flush(bool bWaitForReaders)
+{
+	check(IsInGameThread());
+	
+	if (PendingHandles.IsEmpty() && RetiredBatches.IsEmpty())
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(FCSDeferredHandleDisposer::Flush);
+
+	if (!PendingHandles.IsEmpty())
+	{
+		FRetiredBatch NewBatch;
+		if (!FreeBatches.IsEmpty())
+		{
+			NewBatch = FreeBatches.Pop();
+		}
+		
+		FPendingHandle PendingHandle;
+		while (PendingHandles.Dequeue(PendingHandle))
+		{
+			NewBatch.Handles.Add(PendingHandle);
+		}
+
+		NumPending.fetch_sub(NewBatch.Handles.Num(), std::memory_order_relaxed);
+		NumRetired += NewBatch.Handles.Num();
+
+		// Everything dequeued was unlinked before this point, readers that enter from now on can't find it.
+		NewBatch.Epoch = FCSHandleEpoch::Advance();
+		RetiredBatches.Add(MoveTemp(NewBatch));
+	}
+
+	DisposeReclaimable();
+
+	while (bWaitForReaders && !RetiredBatches.IsEmpty())
+	{
+		FPlatformProcess::Yield();
+		DisposeReclaimable();
+	}
+}
+
+void FCSDeferredHandleDisposer::DisposeReclaimable()
+{
+	int32 NumReclaimable = 0;
+	while (NumReclaimable < RetiredBatches.Num() && FCSHandleEpoch::IsQuiescent(RetiredBatches[NumReclaimable].Epoch))
+	{
+		++NumReclaimable;
+	}
+
+	if (NumReclaimable == 0)
+	{
+		return;
+	}
+
+	Batch.Reset();
+	for (int32 i = 0; i < NumReclaimable; ++i)
+	{
+		for (const FPendingHandle& PendingHandle : RetiredBatches[i].Handles)
+		{
+			if (!PendingHandle.Handle->IsNull() && PendingHandle.Handle->GetType() != GCHandleType::Null)
+			{
+				Batch.Add(PendingHandle.Handle->GetHandle());
+				Batch.Add(PendingHandle.AssemblyHandle);
+			}
+		}
+	}
+
+	if (!Batch.IsEmpty())
+	{
+		FCSManagedCallbacks::ManagedCallbacks.DisposeHandles(Batch.GetData(), Batch.Num() / 2);
+	}
+
+	for (int32 i = 0; i < NumReclaimable; ++i)
+	{
+		FRetiredBatch& Retired = RetiredBatches[i];
+		for (const FPendingHandle& PendingHandle : Retired.Handles)
+		{
+			FCSManagedHandleStore::GetOwningStore(PendingHandle.Handle).Free(PendingHandle.Handle);
+		}
+
+		NumRetired -= Retired.Handles.Num();
+
+		// Don't hold on to the memory of a one-off spike, like a level unloading.
+		if (Retired.Handles.Max() > 8 * 1024)
+		{
+			Retired.Handles.Empty();
+		}
+		else
+		{
+			Retired.Handles.Reset();
+		}
+
+		FreeBatches.Add(MoveTemp(Retired));
+	}
+
+	RetiredBatches.RemoveAt(0, NumReclaimable);
+
+	if (Batch.Max() > 16 * 1024)
+	{
+		Batch.Empty();
+	}
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "CSManagedGCHandle.h"
+#include "Containers/Queue.h"
+#include <atomic>
+
+/**
+ * Collects the handles of deleted UObjects and disposes them in one managed transition.
+ * Objects are deleted in bulk during the garbage purge, so disposing them one by one costs a transition each.
+ * Any thread can queue handles, only the game thread flushes.
+ * Worker threads may still be reading a queued handle, so each flush retires what was queued under the current
+ * FCSHandleEpoch and disposes it once those readers have moved on.
+ */
+class UNREALSHARPCORE_API FCSDeferredHandleDisposer
+{
+public:
+	// Queues the handle for disposal. The disposer frees its slot in the owning store once no reader can see it anymore.
+	void Enqueue(FGCHandle* Handle, FGCHandleIntPtr AssemblyHandle);
+
+	// Disposes the queued handles no thread can still be reading. With bWaitForReaders, waits until that's all of them,
+	// which has to happen before any assembly that owns queued handles is unloaded.
+	void Flush(bool bWaitForReaders = false);
+
+	int32 Num() const { return NumPending.load(std::memory_order_relaxed) + NumRetired; }
+
+private:
+
+	struct FPendingHandle
+	{
+		FGCHandle* Handle;
+		FGCHandleIntPtr AssemblyHandle;
+	};
+
+	struct FRetiredBatch
+	{
+		uint64 Epoch;
+		TArray<FPendingHandle> Handles;
+	};
+
+	void DisposeReclaimable();
+
+	TQueue<FPendingHandle, EQueueMode::Mpsc> PendingHandles;
+	std::atomic<int32> NumPending { 0 };
+
+	// Oldest first. Batches are recycled so flushing doesn't allocate every frame.
+	TArray<FRetiredBatch> RetiredBatches;
+	TArray<FRetiredBatch> FreeBatches;
+	int32 NumRetired = 0;
+
+	// Laid out as (handle, assembly handle) pairs. Kept around so flushing doesn't allocate every frame.
+	TArray<FGCHandleIntPtr> Batch;
+};
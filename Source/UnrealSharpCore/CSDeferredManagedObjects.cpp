@@ -0,0 +1,88 @@
+#include "CSDeferredManagedObjects.h"
+
+#include "CSAssembly.h"
+#include "CSManager.h"
+#include "Containers/Queue.h"
+#include "UnrealSharpCore.h"
+#include "Utils/CSClassUtilities.h"
+
+bool FCSDeferredManagedObjects::bDeferOffGameThread = false;
+
+namespace
+{
+	TQueue<FWeakObjectPtr, EQueueMode::Mpsc> PendingObjects;
+
+	// Dequeued objects the async loader still owns, retried next frame.
+	TArray<FWeakObjectPtr> LoadingObjects;
+}
+
+void FCSDeferredManagedObjects::Initialize(bool bEnabled)
+{
+	check(IsInGameThread());
+	bDeferOffGameThread = bEnabled;
+}
+
+void FCSDeferredManagedObjects::Shutdown()
+{
+	check(IsInGameThread());
+	bDeferOffGameThread = false;
+	PendingObjects.Empty();
+	LoadingObjects.Empty();
+}
+
+void FCSDeferredManagedObjects::Enqueue(const UObject* Object)
+{
+	PendingObjects.Enqueue(FWeakObjectPtr(Object));
+}
+
+void FCSDeferredManagedObjects::Flush()
+{
+	check(IsInGameThread());
+
+	// The types of the queued objects may be in the middle of a reload.
+	UCSManager& Manager = UCSManager::Get();
+	if ((PendingObjects.IsEmpty() && LoadingObjects.IsEmpty()) || Manager.IsLoadingAnyAssembly())
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(FCSDeferredManagedObjects::Flush);
+
+	TArray<FWeakObjectPtr> Objects = MoveTemp(LoadingObjects);
+	FWeakObjectPtr QueuedObject;
+	while (PendingObjects.Dequeue(QueuedObject))
+	{
+		Objects.Add(QueuedObject);
+	}
+
+	// Grouped by the class the counterparts are created from, Blueprint classes share the one of their managed parent.
+	TMap<UClass*, TArray<const UObject*>> ObjectsByClass;
+	for (const FWeakObjectPtr& WeakObject : Objects)
+	{
+		// Gone already, or used since and given its counterpart then.
+		const UObject* Object = WeakObject.Get();
+		if (!Object || Manager.FindManagedObjectHandle(Object))
+		{
+			continue;
+		}
+
+		if (Object->HasAnyInternalFlags(EInternalObjectFlags::Async))
+		{
+			LoadingObjects.Add(WeakObject);
+			continue;
+		}
+
+		ObjectsByClass.FindOrAdd(FCSClassUtilities::GetFirstNonBlueprintClass(Object->GetClass())).Add(Object);
+	}
+
+	for (const TPair<UClass*, TArray<const UObject*>>& ClassObjects : ObjectsByClass)
+	{
+		UCSAssembly* OwningAssembly = Manager.FindOwningAssembly(ClassObjects.Key);
+		if (!IsValid(OwningAssembly))
+		{
+			continue;
+		}
+
+		OwningAssembly->CreateManagedObjects(ClassObjects.Key, ClassObjects.Value);
+	}
+}
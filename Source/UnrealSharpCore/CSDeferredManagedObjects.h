@@ -0,0 +1,28 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Holds back the C# counterparts of managed objects constructed off the game thread, mostly by the async loading thread while streaming.
+ * Their construction only queues them, and the queue is turned into counterparts at the end of the frame with one transition into C# per class,
+ * once the loader has handed the objects over. Anything touching one of them before that creates its counterpart on first use as usual.
+ * Enabled by bDeferAsyncConstructedManagedObjects in the UnrealSharp settings.
+ */
+class UNREALSHARPCORE_API FCSDeferredManagedObjects
+{
+public:
+	static void Initialize(bool bEnabled);
+	static void Shutdown();
+
+	// Whether the counterpart of an object constructed on the calling thread should wait for the game thread.
+	static bool ShouldDefer() { return bDeferOffGameThread && !IsInGameThread(); }
+
+	// Thread safe.
+	static void Enqueue(const UObject* Object);
+
+	// Creates the counterparts of the queued objects that finished loading. Game thread only, called at the end of every frame.
+	static void Flush();
+
+private:
+	static bool bDeferOffGameThread;
+};
@@ -11,4 +11,6 @@ FCSFieldName::FCSFieldName(UField* Field)
 	
 	Name = Field->GetFName();
 	Namespace = FCSUnrealSharpUtils::GetNamespace(Field);
+	FullName = ComputeFullName(Name, Namespace);
+	Hash = ComputeHash(Name, Namespace);
 }
@@ -4,8 +4,8 @@
 
 struct UNREALSHARPCORE_API FCSFieldName
 {
-	FCSFieldName() = default;
-	FCSFieldName(FName Name, FName Namespace) : Name(Name), Namespace(Namespace) {}
+	FCSFieldName() : Hash(ComputeHash(NAME_None, FCSNamespace())) {}
+	FCSFieldName(FName Name, FName Namespace) : Name(Name), Namespace(Namespace), FullName(ComputeFullName(Name, Namespace)), Hash(ComputeHash(Name, Namespace)) {}
 	FCSFieldName(UField* Field);
 
 	FName GetFName() const { return Name; }
@@ -17,21 +17,40 @@ struct UNREALSHARPCORE_API FCSFieldName
 	UPackage* GetPackage() const { return Namespace.GetPackage(); }
 	FName GetPackageName() const { return Namespace.GetPackageName(); }
 	
-	FName GetFullName() const
-	{
-		return *FString::Printf(TEXT("%s.%s"), *Namespace.GetName(), *Name.ToString());
-	}
+	FName GetFullName() const { return FullName; }
 
 	bool operator == (const FCSFieldName& Other) const
 	{
-		return Name == Other.Name && Namespace == Other.Namespace;
+		return Hash == Other.Hash && Name == Other.Name && Namespace == Other.Namespace;
 	}
 
 	friend uint32 GetTypeHash(const FCSFieldName& Field)
 	{
-		return GetTypeHash(Field.Name) ^ GetTypeHash(Field.Namespace);
+		return Field.Hash;
 	}
 private:
+	static FName ComputeFullName(FName Name, const FCSNamespace& Namespace)
+	{
+		if (Name.IsNone())
+		{
+			return NAME_None;
+		}
+
+		TStringBuilder<256> Builder;
+		Builder << Namespace.GetFName() << TEXT('.') << Name;
+		return FName(Builder.ToView());
+	}
+
+	// Combined rather than XORed, so swapping the name and namespace doesn't give the same hash.
+	static uint32 ComputeHash(FName Name, const FCSNamespace& Namespace)
+	{
+		return HashCombineFast(GetTypeHash(Name), GetTypeHash(Namespace));
+	}
+
 	FName Name;
 	FCSNamespace Namespace;
+	
+	// Both are looked up for every type reference while loading, so they're computed once on construction.
+	FName FullName;
+	uint32 Hash;
 };
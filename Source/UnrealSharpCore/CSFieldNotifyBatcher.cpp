@@ -0,0 +1,187 @@
+#include "CSFieldNotifyBatcher.h"
+#include "CSManagedDelegate.h"
+#include "CSManager.h"
+#include "Engine/World.h"
+#include "INotifyFieldValueChanged.h"
+#include "UnrealSharpCore.h"
+
+namespace
+{
+	// Fields of a class by their index in its descriptor, built the first time one of its objects is flushed.
+	TMap<TObjectKey<UClass>, TArray<UE::FieldNotification::FFieldId>> ClassFields;
+
+	FGCHandleIntPtr PendingFlush;
+
+	FDelegateHandle PostActorTickHandle;
+	FDelegateHandle EndFrameHandle;
+
+	void ResetClassFields()
+	{
+		ClassFields.Reset();
+	}
+
+#if WITH_EDITOR
+	void OnClassRebuilt(UCSClass*)
+	{
+		ResetClassFields();
+	}
+#endif
+
+	void BindCacheInvalidation()
+	{
+		static bool bBoundToClassRebuilds = false;
+		if (!bBoundToClassRebuilds)
+		{
+			UCSManager& Manager = UCSManager::Get();
+#if WITH_EDITOR
+			Manager.OnNewClassEvent().AddStatic(&OnClassRebuilt);
+#endif
+			Manager.OnAssembliesLoadedEvent().AddStatic(&ResetClassFields);
+			bBoundToClassRebuilds = true;
+		}
+	}
+
+	const TArray<UE::FieldNotification::FFieldId>* FindOrAddClassFields(UObject* Object)
+	{
+		const INotifyFieldValueChanged* Notify = Cast<INotifyFieldValueChanged>(Object);
+		if (!Notify)
+		{
+			return nullptr;
+		}
+
+		UClass* Class = Object->GetClass();
+		if (const TArray<UE::FieldNotification::FFieldId>* Fields = ClassFields.Find(Class))
+		{
+			return Fields;
+		}
+
+		BindCacheInvalidation();
+
+		TArray<UE::FieldNotification::FFieldId>& Fields = ClassFields.Add(Class);
+		Notify->GetFieldNotificationDescriptor().ForEachField(Class, [&Fields](UE::FieldNotification::FFieldId FieldId)
+		{
+			if (Fields.Num() <= FieldId.GetIndex())
+			{
+				Fields.SetNum(FieldId.GetIndex() + 1);
+			}
+
+			Fields[FieldId.GetIndex()] = FieldId;
+			return true;
+		});
+
+		return &Fields;
+	}
+
+	void Flush()
+	{
+		if (!PendingFlush.IntPtr)
+		{
+			return;
+		}
+
+		// Cleared first, the flush may mark fields again and ask for the next one.
+		FCSManagedDelegate FlushDelegate = FGCHandle(PendingFlush, GCHandleType::StrongHandle);
+		PendingFlush = FGCHandleIntPtr();
+		FlushDelegate.Invoke(nullptr);
+	}
+
+	void OnWorldPostActorTick(UWorld*, ELevelTick, float)
+	{
+		Flush();
+	}
+}
+
+void FCSFieldNotifyBatcher::Initialize()
+{
+	check(IsInGameThread());
+
+	if (!PostActorTickHandle.IsValid())
+	{
+		PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddStatic(&OnWorldPostActorTick);
+		EndFrameHandle = FCoreDelegates::OnEndFrame.AddStatic(&Flush);
+	}
+}
+
+void FCSFieldNotifyBatcher::Shutdown()
+{
+	check(IsInGameThread());
+
+	FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+	FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+	PostActorTickHandle.Reset();
+	EndFrameHandle.Reset();
+
+	if (PendingFlush.IntPtr)
+	{
+		FCSManagedDelegate FlushDelegate = FGCHandle(PendingFlush, GCHandleType::StrongHandle);
+		FlushDelegate.Dispose();
+		PendingFlush = FGCHandleIntPtr();
+	}
+
+	ClassFields.Reset();
+}
+
+int32 FCSFieldNotifyBatcher::GetFieldIndex(UObject* Object, FName FieldName)
+{
+	check(IsInGameThread());
+
+	const TArray<UE::FieldNotification::FFieldId>* Fields = FindOrAddClassFields(Object);
+	if (!Fields)
+	{
+		return INDEX_NONE;
+	}
+
+	return Fields->IndexOfByPredicate([FieldName](const UE::FieldNotification::FFieldId& FieldId)
+	{
+		return FieldId.GetName() == FieldName;
+	});
+}
+
+void FCSFieldNotifyBatcher::RequestFlush(FGCHandleIntPtr FlushDelegate)
+{
+	check(IsInGameThread());
+
+	if (PendingFlush.IntPtr)
+	{
+		UE_LOG(LogUnrealSharp, Warning, TEXT("A field notification flush was requested while another one is pending, dropping it."));
+		FCSManagedDelegate DroppedDelegate = FGCHandle(FlushDelegate, GCHandleType::StrongHandle);
+		DroppedDelegate.Dispose();
+		return;
+	}
+
+	PendingFlush = FlushDelegate;
+}
+
+void FCSFieldNotifyBatcher::Broadcast(UObject* const* Objects, const int32* WordOffsets, const uint64* DirtyBits, int32 NumObjects)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FCSFieldNotifyBatcher::Broadcast);
+	check(IsInGameThread());
+
+	for (int32 i = 0; i < NumObjects; ++i)
+	{
+		UObject* Object = Objects[i];
+		if (!IsValid(Object))
+		{
+			continue;
+		}
+
+		const TArray<UE::FieldNotification::FFieldId>* Fields = FindOrAddClassFields(Object);
+		if (!Fields)
+		{
+			continue;
+		}
+
+		INotifyFieldValueChanged* Notify = CastChecked<INotifyFieldValueChanged>(Object);
+		for (int32 Word = WordOffsets[i]; Word < WordOffsets[i + 1]; ++Word)
+		{
+			for (uint64 Bits = DirtyBits[Word]; Bits; Bits &= Bits - 1)
+			{
+				const int32 FieldIndex = (Word - WordOffsets[i]) * 64 + FMath::CountTrailingZeros64(Bits);
+				if (Fields->IsValidIndex(FieldIndex) && (*Fields)[FieldIndex].IsValid())
+				{
+					Notify->BroadcastFieldValueChanged((*Fields)[FieldIndex]);
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CSManagedGCHandle.h"
+
+/**
+ * Broadcasts the field notifications of C# view models in one pass per frame. C# sets a bit per changed field, and asks for a flush
+ * the first time it does in a frame. The flush runs once actors ticked, so bindings see the values of this frame,
+ * or at the end of the frame for changes made after that. It calls back into C# once, which hands all the dirty bits over in a single call.
+ * Bits are indices in the field notification descriptor of the class of the view model. Game thread only.
+ */
+class UNREALSHARPCORE_API FCSFieldNotifyBatcher
+{
+public:
+	static void Initialize();
+	static void Shutdown();
+
+	// Index of the field in the field notification descriptor of the class of the object, INDEX_NONE if it has no such field.
+	static int32 GetFieldIndex(UObject* Object, FName FieldName);
+
+	// Invokes the managed delegate at the next flush, and disposes it. Only one flush can be pending.
+	static void RequestFlush(FGCHandleIntPtr FlushDelegate);
+
+	// Broadcasts a field value changed event for every set bit. The bits of object i are the words in [WordOffsets[i], WordOffsets[i + 1]).
+	static void Broadcast(UObject* const* Objects, const int32* WordOffsets, const uint64* DirtyBits, int32 NumObjects);
+};
@@ -0,0 +1,268 @@
+#include "CSGameThreadContinuations.h"
+#include "Containers/Queue.h"
+#include "Engine/World.h"
+#include "CSManagedDelegate.h"
+#include "UnrealSharpCore.h"
+
+namespace
+{
+	struct FContinuation
+	{
+		FCSGameThreadContinuations::FContinuationFunction Function = nullptr;
+		void* Payload = nullptr;
+		TWeakObjectPtr<UObject> WorldContextObject;
+	};
+
+	struct FNextTickContinuation : FContinuation
+	{
+		uint64 Frame = 0;
+	};
+
+	struct FContinuationLane
+	{
+		TQueue<FContinuation, EQueueMode::Mpsc> Queue;
+		std::atomic<int32> NumPending { 0 };
+	};
+
+	struct FCSContinuationTickFunction : FTickFunction
+	{
+		virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override
+		{
+			FCSGameThreadContinuations::Drain();
+		}
+
+		virtual FString DiagnosticMessage() override
+		{
+			return TEXT("FCSGameThreadContinuations");
+		}
+	};
+
+	// The lanes below Input always get to run this many continuations, so a busy frame can't starve them.
+	constexpr int32 MinContinuationsPerLane = 8;
+
+	FContinuationLane Lanes[static_cast<int32>(ECSContinuationLane::Count)];
+
+	// Only touched on the game thread. Ordered by frame, NextTickStart is the first one that hasn't run yet.
+	TArray<FNextTickContinuation> NextTickContinuations;
+	int32 NextTickStart = 0;
+
+	TMap<TObjectKey<UWorld>, TUniquePtr<FCSContinuationTickFunction>> WorldTickFunctions;
+
+	ETickingGroup TickGroup = TG_PrePhysics;
+	double FrameBudgetSeconds = 0.002;
+	uint64 LastDrainedFrame = MAX_uint64;
+	FDelegateHandle PostWorldInitializationHandle;
+	FDelegateHandle WorldCleanupHandle;
+
+	void InvokeManagedDelegate(void* Payload, UObject* WorldContextObject, bool bCancelled)
+	{
+		FCSManagedDelegate ManagedDelegate = FGCHandle(static_cast<uint8*>(Payload), GCHandleType::StrongHandle);
+
+		if (bCancelled)
+		{
+			ManagedDelegate.Dispose();
+			return;
+		}
+
+		ManagedDelegate.Invoke(WorldContextObject);
+	}
+
+	void RunContinuation(const FContinuation& Continuation, bool bCancel)
+	{
+		UObject* WorldContextObject = Continuation.WorldContextObject.Get();
+		const bool bLostWorldContext = !WorldContextObject && !Continuation.WorldContextObject.IsExplicitlyNull();
+		Continuation.Function(Continuation.Payload, WorldContextObject, bCancel || bLostWorldContext);
+	}
+
+	void DrainLane(FContinuationLane& Lane, double Deadline)
+	{
+		// Only what was queued before we started, continuations that post more wait for the next frame.
+		const int32 NumToRun = Lane.NumPending.load(std::memory_order_acquire);
+
+		int32 NumRun = 0;
+		FContinuation Continuation;
+		while (NumRun < NumToRun && Lane.Queue.Dequeue(Continuation))
+		{
+			++NumRun;
+			RunContinuation(Continuation, false);
+
+			if (NumRun >= MinContinuationsPerLane && FPlatformTime::Seconds() >= Deadline)
+			{
+				break;
+			}
+		}
+
+		Lane.NumPending.fetch_sub(NumRun, std::memory_order_relaxed);
+	}
+
+	void DrainNextTick(double Deadline)
+	{
+		int32 NumRun = 0;
+		while (NextTickStart < NextTickContinuations.Num() && NextTickContinuations[NextTickStart].Frame < GFrameCounter)
+		{
+			// Copy, the continuation may post another one and grow the array.
+			const FContinuation Continuation = NextTickContinuations[NextTickStart++];
+			RunContinuation(Continuation, false);
+
+			if (++NumRun >= MinContinuationsPerLane && FPlatformTime::Seconds() >= Deadline)
+			{
+				break;
+			}
+		}
+
+		if (NextTickStart == NextTickContinuations.Num())
+		{
+			NextTickContinuations.Reset();
+			NextTickStart = 0;
+		}
+		else if (NextTickStart > NextTickContinuations.Num() / 2)
+		{
+			NextTickContinuations.RemoveAt(0, NextTickStart);
+			NextTickStart = 0;
+		}
+	}
+
+	void CancelLane(FContinuationLane& Lane)
+	{
+		int32 NumCancelled = 0;
+		FContinuation Continuation;
+		while (Lane.Queue.Dequeue(Continuation))
+		{
+			++NumCancelled;
+			RunContinuation(Continuation, true);
+		}
+
+		Lane.NumPending.fetch_sub(NumCancelled, std::memory_order_relaxed);
+	}
+
+	void OnPostWorldInitialization(UWorld* World, const UWorld::InitializationValues IVS)
+	{
+		if (!World->IsGameWorld() || WorldTickFunctions.Contains(World))
+		{
+			return;
+		}
+
+		TUniquePtr<FCSContinuationTickFunction> TickFunction = MakeUnique<FCSContinuationTickFunction>();
+		TickFunction->bCanEverTick = true;
+		TickFunction->bStartWithTickEnabled = true;
+		TickFunction->bTickEvenWhenPaused = true;
+		TickFunction->bAllowTickOnDedicatedServer = true;
+		TickFunction->TickGroup = TickGroup;
+		TickFunction->EndTickGroup = TickGroup;
+		TickFunction->RegisterTickFunction(World->PersistentLevel);
+
+		WorldTickFunctions.Add(World, MoveTemp(TickFunction));
+	}
+
+	void OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+	{
+		TUniquePtr<FCSContinuationTickFunction> TickFunction;
+		if (WorldTickFunctions.RemoveAndCopyValue(World, TickFunction))
+		{
+			TickFunction->UnRegisterTickFunction();
+		}
+	}
+}
+
+void FCSGameThreadContinuations::Initialize(ETickingGroup InTickGroup, double InFrameBudgetSeconds)
+{
+	check(IsInGameThread());
+
+	TickGroup = InTickGroup;
+	FrameBudgetSeconds = InFrameBudgetSeconds;
+
+	if (!PostWorldInitializationHandle.IsValid())
+	{
+		PostWorldInitializationHandle = FWorldDelegates::OnPostWorldInitialization.AddStatic(&OnPostWorldInitialization);
+		WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddStatic(&OnWorldCleanup);
+	}
+}
+
+void FCSGameThreadContinuations::Shutdown()
+{
+	check(IsInGameThread());
+
+	FWorldDelegates::OnPostWorldInitialization.Remove(PostWorldInitializationHandle);
+	FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
+	PostWorldInitializationHandle.Reset();
+	WorldCleanupHandle.Reset();
+
+	for (TPair<TObjectKey<UWorld>, TUniquePtr<FCSContinuationTickFunction>>& TickFunction : WorldTickFunctions)
+	{
+		TickFunction.Value->UnRegisterTickFunction();
+	}
+	WorldTickFunctions.Empty();
+
+	for (FContinuationLane& Lane : Lanes)
+	{
+		CancelLane(Lane);
+	}
+
+	for (; NextTickStart < NextTickContinuations.Num(); ++NextTickStart)
+	{
+		RunContinuation(NextTickContinuations[NextTickStart], true);
+	}
+	NextTickContinuations.Empty();
+	NextTickStart = 0;
+}
+
+void FCSGameThreadContinuations::Post(ECSContinuationLane Lane, FGCHandleIntPtr DelegateHandle, const TWeakObjectPtr<UObject>& WorldContextObject)
+{
+	Post(Lane, &InvokeManagedDelegate, DelegateHandle.IntPtr, WorldContextObject);
+}
+
+void FCSGameThreadContinuations::Post(ECSContinuationLane Lane, FContinuationFunction Function, void* Payload, const TWeakObjectPtr<UObject>& WorldContextObject)
+{
+	check(Lane < ECSContinuationLane::Count);
+
+	FContinuationLane& ContinuationLane = Lanes[static_cast<int32>(Lane)];
+	ContinuationLane.Queue.Enqueue({ Function, Payload, WorldContextObject });
+	ContinuationLane.NumPending.fetch_add(1, std::memory_order_release);
+}
+
+void FCSGameThreadContinuations::PostNextTick(FGCHandleIntPtr DelegateHandle, const TWeakObjectPtr<UObject>& WorldContextObject)
+{
+	PostNextTick(&InvokeManagedDelegate, DelegateHandle.IntPtr, WorldContextObject);
+}
+
+void FCSGameThreadContinuations::PostNextTick(FContinuationFunction Function, void* Payload, const TWeakObjectPtr<UObject>& WorldContextObject)
+{
+	if (!IsInGameThread())
+	{
+		Post(ECSContinuationLane::Gameplay, Function, Payload, WorldContextObject);
+		return;
+	}
+
+	FNextTickContinuation& Continuation = NextTickContinuations.AddDefaulted_GetRef();
+	Continuation.Function = Function;
+	Continuation.Payload = Payload;
+	Continuation.WorldContextObject = WorldContextObject;
+	Continuation.Frame = GFrameCounter;
+}
+
+void FCSGameThreadContinuations::Drain()
+{
+	check(IsInGameThread());
+
+	// Every game world has a tick function, the budget is for the whole frame.
+	if (LastDrainedFrame == GFrameCounter)
+	{
+		return;
+	}
+
+	LastDrainedFrame = GFrameCounter;
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(FCSGameThreadContinuations::Drain);
+
+	const double Deadline = FrameBudgetSeconds > 0.0 ? FPlatformTime::Seconds() + FrameBudgetSeconds : DBL_MAX;
+
+	DrainLane(Lanes[static_cast<int32>(ECSContinuationLane::Input)], DBL_MAX);
+	DrainNextTick(Deadline);
+	DrainLane(Lanes[static_cast<int32>(ECSContinuationLane::Gameplay)], Deadline);
+	DrainLane(Lanes[static_cast<int32>(ECSContinuationLane::Background)], Deadline);
+}
+
+int32 FCSGameThreadContinuations::GetNumPending(ECSContinuationLane Lane)
+{
+	return Lanes[static_cast<int32>(Lane)].NumPending.load(std::memory_order_relaxed);
+}
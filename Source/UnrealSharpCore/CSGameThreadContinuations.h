@@ -0,0 +1,46 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineBaseTypes.h"
+#include "CSManagedGCHandle.h"
+
+// Continuations in a lower lane wait for the ones above them when the frame budget runs out.
+enum class ECSContinuationLane : uint8
+{
+	// Always drained completely, the budget doesn't apply.
+	Input,
+	Gameplay,
+	Background,
+
+	Count
+};
+
+/**
+ * Resumes managed continuations on the game thread, once per frame, within a time budget.
+ * Anything that is posted from any thread is queued in its lane and run when the queues are drained: from a tick function
+ * registered in every game world at the configured tick group, or at the end of the frame when no world ticked.
+ * Continuations that don't fit in the budget stay queued for the next frame, in order. Continuations posted while
+ * draining run next frame, so awaits that resume into another await can't keep the drain going.
+ */
+class UNREALSHARPCORE_API FCSGameThreadContinuations
+{
+public:
+	using FContinuationFunction = void(*)(void* Payload, UObject* WorldContextObject, bool bCancelled);
+
+	static void Initialize(ETickingGroup InTickGroup, double InFrameBudgetSeconds);
+	static void Shutdown();
+
+	// Invokes the managed delegate on the game thread, and disposes it. If the world context is set but gone by then, the delegate is only disposed.
+	static void Post(ECSContinuationLane Lane, FGCHandleIntPtr DelegateHandle, const TWeakObjectPtr<UObject>& WorldContextObject = nullptr);
+	static void Post(ECSContinuationLane Lane, FContinuationFunction Function, void* Payload, const TWeakObjectPtr<UObject>& WorldContextObject = nullptr);
+
+	// Runs the function in the next frame's drain, ahead of the gameplay lane and within the same budget.
+	// From the game thread this only appends to an array, from other threads it's the same as posting to the gameplay lane.
+	static void PostNextTick(FGCHandleIntPtr DelegateHandle, const TWeakObjectPtr<UObject>& WorldContextObject = nullptr);
+	static void PostNextTick(FContinuationFunction Function, void* Payload, const TWeakObjectPtr<UObject>& WorldContextObject = nullptr);
+
+	// Runs the queued continuations that fit in this frame's budget. Only the first call of a frame does anything.
+	static void Drain();
+
+	static int32 GetNumPending(ECSContinuationLane Lane);
+};
@@ -0,0 +1,103 @@
+#include "CSHandleEpoch.h"
+
+namespace
+{
+	struct FThreadRecord
+	{
+		// Epoch the thread entered its outermost scope at, zero while outside of any scope.
+		alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint64> Epoch { 0 };
+		int32 Depth = 0;
+		FThreadRecord* NextFree = nullptr;
+	};
+
+	std::atomic<uint64> GlobalEpoch { 1 };
+
+	// Records are never freed. A thread that exits hands its record over to the next thread that needs one.
+	FCriticalSection RecordsLock;
+	TArray<FThreadRecord*> Records;
+	FThreadRecord* FirstFreeRecord = nullptr;
+
+	struct FThreadRecordHolder
+	{
+		FThreadRecord* Record = nullptr;
+
+		FThreadRecord& Get()
+		{
+			if (!Record)
+			{
+				FScopeLock Lock(&RecordsLock);
+				if (FirstFreeRecord)
+				{
+					Record = FirstFreeRecord;
+					FirstFreeRecord = Record->NextFree;
+				}
+				else
+				{
+					Record = new FThreadRecord();
+					Records.Add(Record);
+				}
+			}
+
+			return *Record;
+		}
+
+		~FThreadRecordHolder()
+		{
+			if (!Record)
+			{
+				return;
+			}
+
+			Record->Epoch.store(0, std::memory_order_release);
+			Record->Depth = 0;
+
+			FScopeLock Lock(&RecordsLock);
+			Record->NextFree = FirstFreeRecord;
+			FirstFreeRecord = Record;
+		}
+	};
+
+	thread_local FThreadRecordHolder ThreadRecord;
+}
+
+void FCSHandleEpoch::Enter()
+{
+	FThreadRecord& Record = ThreadRecord.Get();
+	if (Record.Depth++ == 0)
+	{
+		// Announcing a slightly old epoch only delays reclamation. The store has to be visible
+		// before any handle is read though, hence seq_cst.
+		Record.Epoch.store(GlobalEpoch.load(std::memory_order_acquire), std::memory_order_seq_cst);
+	}
+}
+
+void FCSHandleEpoch::Exit()
+{
+	FThreadRecord& Record = ThreadRecord.Get();
+	check(Record.Depth > 0);
+
+	if (--Record.Depth == 0)
+	{
+		Record.Epoch.store(0, std::memory_order_release);
+	}
+}
+
+uint64 FCSHandleEpoch::Advance()
+{
+	return GlobalEpoch.fetch_add(1, std::memory_order_seq_cst);
+}
+
+bool FCSHandleEpoch::IsQuiescent(uint64 RetireEpoch)
+{
+	FScopeLock Lock(&RecordsLock);
+	for (const FThreadRecord* Record : Records)
+	{
+		const uint64 Epoch = Record->Epoch.load(std::memory_order_seq_cst);
+		if (Epoch != 0 && Epoch <= RetireEpoch)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
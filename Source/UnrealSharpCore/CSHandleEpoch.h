@@ -0,0 +1,33 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+/**
+ * Epoch based reclamation for managed handles read off the game thread.
+ * Threads that look up handles without holding a lock do so inside an FReadScope. The game thread retires handles
+ * of deleted objects under the current epoch and only disposes them, and recycles their slots, once every thread
+ * that was reading at the time has left its scope. Reading stays lock-free, a scope costs two stores to a thread local record.
+ * The game thread reclaims and doesn't need a scope of its own.
+ */
+class UNREALSHARPCORE_API FCSHandleEpoch
+{
+public:
+	struct FReadScope
+	{
+		FReadScope() { Enter(); }
+		~FReadScope() { Exit(); }
+
+		UE_NONCOPYABLE(FReadScope);
+	};
+
+	// Scopes nest, only the outermost one counts.
+	static void Enter();
+	static void Exit();
+
+	// Starts a new epoch. Returns the epoch that handles unlinked until now belong to.
+	static uint64 Advance();
+
+	// True once no thread can still be reading handles retired during RetireEpoch.
+	static bool IsQuiescent(uint64 RetireEpoch);
+};
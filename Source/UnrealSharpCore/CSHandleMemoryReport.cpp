@@ -0,0 +1,88 @@
+#include "CSHandleMemoryReport.h"
+#include "CSManager.h"
+#include "HAL/IConsoleManager.h"
+
+namespace
+{
+	void PrintMemoryReport(const TArray<FString>& Args, UWorld*, FOutputDevice& Ar)
+	{
+		int32 NumTopClasses = 20;
+		if (Args.Num() > 0)
+		{
+			LexFromString(NumTopClasses, *Args[0]);
+		}
+
+		FCSHandleMemoryReport::Capture(FMath::Max(NumTopClasses, 0)).Print(Ar);
+	}
+
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice MemoryReportCommand(
+		TEXT("UnrealSharp.Memory"),
+		TEXT("Prints the handle tables, the handles and types of every assembly, the managed heap and the classes with the most managed objects. ")
+		TEXT("Takes the number of classes to list, 20 by default."),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateStatic(&PrintMemoryReport));
+
+	double BytesToKB(SIZE_T Bytes)
+	{
+		return Bytes / 1024.0;
+	}
+}
+
+FCSHandleMemoryReport FCSHandleMemoryReport::Capture(int32 NumTopClasses)
+{
+	check(IsInGameThread());
+
+	FCSHandleMemoryReport Report;
+	Report.CaptureTimeSeconds = FPlatformTime::Seconds();
+
+	UCSManager::Get().GatherHandleMemoryReport(Report, NumTopClasses);
+
+	for (const FCSAssemblyMemoryStats& Assembly : Report.Assemblies)
+	{
+		Report.NumStrongHandles += Assembly.NumStrongHandles;
+		Report.NumWeakHandles += Assembly.NumWeakHandles;
+		Report.NumPinnedHandles += Assembly.NumPinnedHandles;
+		Report.HandleBytes += Assembly.HandleBytes;
+	}
+
+	Report.GCStats = FCSGCPressureMonitor::GetCurrentGCStatistics();
+	Report.bHasManagedHeapSample = FCSGCPressureMonitor::GetManagedMemoryInfo().HeapSizeBytes > 0;
+
+	return Report;
+}
+
+void FCSHandleMemoryReport::Print(FOutputDevice& Ar) const
+{
+	Ar.Logf(TEXT("Object handles: %d (%d stale), table %.1f KB"), NumObjectHandles, NumStaleObjectHandles, BytesToKB(ObjectHandleTableBytes));
+	Ar.Logf(TEXT("Interface wrappers: %d, table %.1f KB"), NumInterfaceWrappers, BytesToKB(InterfaceWrapperTableBytes));
+	Ar.Logf(TEXT("Handles: %d strong, %d weak, %d pinned, %.1f KB"), NumStrongHandles, NumWeakHandles, NumPinnedHandles, BytesToKB(HandleBytes));
+	Ar.Logf(TEXT("Orphaned handles: %d, shared buffers: %d (%.2f MB), pressure: %s"), GCStats.OrphanedHandleCount, GCStats.SharedBufferCount,
+		GCStats.SharedBufferMB, *FCSGCPressureMonitor::GetPressureLevelDescription(GCStats.PressureLevel));
+
+	if (bHasManagedHeapSample)
+	{
+		Ar.Logf(TEXT("Managed heap: %.2f MB (fragmented %.2f MB), Gen0 %.2f MB, Gen1 %.2f MB, Gen2 %.2f MB, LOH %.2f MB, POH %.2f MB, allocating %.2f MB/s"),
+			GCStats.ManagedHeapSizeMB, GCStats.ManagedFragmentedMB, GCStats.ManagedGen0SizeMB, GCStats.ManagedGen1SizeMB, GCStats.ManagedGen2SizeMB,
+			GCStats.ManagedLargeObjectHeapSizeMB, GCStats.ManagedPinnedObjectHeapSizeMB, GCStats.ManagedAllocationRateMBPerSecond);
+	}
+	else
+	{
+		Ar.Logf(TEXT("Managed heap: not sampled"));
+	}
+
+	Ar.Logf(TEXT("%-40s %10s %10s %10s %10s %12s %10s %12s"), TEXT("Assembly"), TEXT("Handles"), TEXT("Strong"), TEXT("Weak"), TEXT("Pinned"),
+		TEXT("HandleKB"), TEXT("Types"), TEXT("TypeTableKB"));
+	for (const FCSAssemblyMemoryStats& Assembly : Assemblies)
+	{
+		Ar.Logf(TEXT("%-40s %10d %10d %10d %10d %12.1f %10d %12.1f"), *Assembly.AssemblyName.ToString(), Assembly.NumHandles, Assembly.NumStrongHandles,
+			Assembly.NumWeakHandles, Assembly.NumPinnedHandles, BytesToKB(Assembly.HandleBytes), Assembly.NumTypes, BytesToKB(Assembly.TypeTableBytes));
+	}
+
+	if (!TopClasses.IsEmpty())
+	{
+		Ar.Logf(TEXT("%-60s %10s"), TEXT("Class"), TEXT("Objects"));
+		for (const FCSClassHandleCount& ClassCount : TopClasses)
+		{
+			Ar.Logf(TEXT("%-60s %10d"), *ClassCount.ClassName.ToString(), ClassCount.NumObjects);
+		}
+	}
+}
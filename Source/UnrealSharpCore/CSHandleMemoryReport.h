@@ -0,0 +1,67 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GCOptimizations/CSGCPressureMonitor.h"
+
+/**
+ * Handles and type tables of one loaded assembly.
+ */
+struct FCSAssemblyMemoryStats
+{
+	FName AssemblyName;
+
+	// Handles allocated by the assembly: types, methods, objects and interface wrappers.
+	int32 NumHandles = 0;
+	int32 NumStrongHandles = 0;
+	int32 NumWeakHandles = 0;
+	int32 NumPinnedHandles = 0;
+	SIZE_T HandleBytes = 0;
+
+	// Entries in AllTypes, the type infos themselves aren't counted.
+	int32 NumTypes = 0;
+	SIZE_T TypeTableBytes = 0;
+};
+
+struct FCSClassHandleCount
+{
+	FName ClassName;
+	int32 NumObjects = 0;
+};
+
+/**
+ * Snapshot of the handle tables, the handle stores of all assemblies and the managed heap, for tracking down
+ * handle leaks and memory growth. Printed by UnrealSharp.Memory and shown in the UnrealSharp Memory editor tab.
+ */
+struct UNREALSHARPCORE_API FCSHandleMemoryReport
+{
+	// ManagedObjectHandles of UCSManager, indexed by the GUObjectArray index of the object.
+	int32 NumObjectHandles = 0;
+	int32 NumStaleObjectHandles = 0;
+	SIZE_T ObjectHandleTableBytes = 0;
+
+	// ManagedInterfaceWrappers of UCSManager.
+	int32 NumInterfaceWrappers = 0;
+	SIZE_T InterfaceWrapperTableBytes = 0;
+
+	TArray<FCSAssemblyMemoryStats> Assemblies;
+
+	// Sums over all assemblies.
+	int32 NumStrongHandles = 0;
+	int32 NumWeakHandles = 0;
+	int32 NumPinnedHandles = 0;
+	SIZE_T HandleBytes = 0;
+
+	// Classes with the most objects in ManagedObjectHandles, most first.
+	TArray<FCSClassHandleCount> TopClasses;
+
+	// Pressure level, orphaned handles, shared buffers and the last managed heap sample.
+	FCSGCPressureMonitor::FGCStats GCStats;
+	bool bHasManagedHeapSample = false;
+
+	double CaptureTimeSeconds = 0.0;
+
+	// Must run on the game thread. Walks every slot of ManagedObjectHandles, so it isn't meant to run every frame.
+	static FCSHandleMemoryReport Capture(int32 NumTopClasses = 20);
+
+	void Print(FOutputDevice& Ar) const;
+};
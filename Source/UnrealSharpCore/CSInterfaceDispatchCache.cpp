@@ -0,0 +1,92 @@
+#include "CSInterfaceDispatchCache.h"
+#include "CSAssembly.h"
+#include "CSManager.h"
+#include "UnrealSharpCore.h"
+#include "Logging/StructuredLog.h"
+
+namespace
+{
+	using FCacheKey = TPair<TObjectKey<UClass>, TObjectKey<UClass>>;
+
+	TMap<FCacheKey, FCSInterfaceDispatch> CachedDispatches;
+
+#if WITH_EDITOR
+	void OnClassRebuilt(UCSClass*)
+	{
+		FCSInterfaceDispatchCache::Reset();
+	}
+
+	void OnInterfaceRebuilt(UCSInterface*)
+	{
+		FCSInterfaceDispatchCache::Reset();
+	}
+#endif
+
+	void BindCacheInvalidation()
+	{
+		static bool bBoundToRebuilds = false;
+		if (bBoundToRebuilds)
+		{
+			return;
+		}
+
+		UCSManager& Manager = UCSManager::Get();
+#if WITH_EDITOR
+		Manager.OnNewClassEvent().AddStatic(&OnClassRebuilt);
+		Manager.OnNewInterfaceEvent().AddStatic(&OnInterfaceRebuilt);
+#endif
+		Manager.OnAssembliesLoadedEvent().AddStatic(&FCSInterfaceDispatchCache::Reset);
+		bBoundToRebuilds = true;
+	}
+
+	bool CanCache(const UClass* Class)
+	{
+#if WITH_EDITOR
+		return !Class->HasAnyClassFlags(CLASS_CompiledFromBlueprint);
+#else
+		return true;
+#endif
+	}
+
+	FCSInterfaceDispatch Resolve(const UClass* Class, UClass* InterfaceClass)
+	{
+		if (!Class->ImplementsInterface(InterfaceClass))
+		{
+			return {};
+		}
+
+		UCSAssembly* OwningAssembly = UCSManager::Get().FindOwningAssembly(InterfaceClass);
+		if (!IsValid(OwningAssembly))
+		{
+			UE_LOGFMT(LogUnrealSharp, Error, "Failed to find assembly for {0}", *InterfaceClass->GetName());
+			return {};
+		}
+
+		return { OwningAssembly, OwningAssembly->FindInterfaceTypeHandle(InterfaceClass) };
+	}
+}
+
+FCSInterfaceDispatch FCSInterfaceDispatchCache::FindOrAdd(const UClass* Class, UClass* InterfaceClass)
+{
+	if (!IsInGameThread() || !CanCache(Class))
+	{
+		return Resolve(Class, InterfaceClass);
+	}
+
+	const FCacheKey Key(Class, InterfaceClass);
+	if (const FCSInterfaceDispatch* CachedDispatch = CachedDispatches.Find(Key))
+	{
+		return *CachedDispatch;
+	}
+
+	const FCSInterfaceDispatch Dispatch = Resolve(Class, InterfaceClass);
+
+	BindCacheInvalidation();
+	CachedDispatches.Add(Key, Dispatch);
+	return Dispatch;
+}
+
+void FCSInterfaceDispatchCache::Reset()
+{
+	CachedDispatches.Reset();
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UCSAssembly;
+struct FGCHandle;
+
+/**
+ * What an interface cast of an object of some class needs: the assembly and the type handle of the interface's wrapper.
+ * Both are null when the class doesn't implement the interface, or when the interface has no managed type.
+ */
+struct FCSInterfaceDispatch
+{
+	UCSAssembly* Assembly = nullptr;
+	FGCHandle* TypeHandle = nullptr;
+
+	bool IsValid() const { return TypeHandle != nullptr; }
+};
+
+/**
+ * Interface dispatch resolved per class and interface, so casting objects to interfaces in C# doesn't check the
+ * interfaces of the class, find the owning assembly and look up the type handle of the wrapper on every call.
+ * Entries go when the class or the interface is rebuilt, and all of them when an assembly is unloaded.
+ * Blueprint classes aren't cached in the editor, recompiling them can change their interfaces in place.
+ * Only used on the game thread, other threads always take the slow path.
+ */
+class UNREALSHARPCORE_API FCSInterfaceDispatchCache
+{
+public:
+	static FCSInterfaceDispatch FindOrAdd(const UClass* Class, UClass* InterfaceClass);
+
+	static void Reset();
+};
@@ -0,0 +1,129 @@
+#include "CSInterfaceWrapperTable.h"
+
+FGCHandle* FCSInterfaceWrapperTable::Find(int32 ObjectIndex, uint32 InterfaceClassId) const
+{
+	FReadScopeLock ReadLock(Lock);
+	
+	const int32 EntryIndex = FindEntryIndex(ObjectIndex, InterfaceClassId);
+	return EntryIndex != INDEX_NONE ? Entries[EntryIndex].Wrapper : nullptr;
+}
+
+FGCHandle* FCSInterfaceWrapperTable::FindOrAdd(int32 ObjectIndex, uint32 InterfaceClassId, FGCHandle* Wrapper)
+{
+	FWriteScopeLock WriteLock(Lock);
+
+	const int32 ExistingIndex = FindEntryIndex(ObjectIndex, InterfaceClassId);
+	if (ExistingIndex != INDEX_NONE)
+	{
+		return Entries[ExistingIndex].Wrapper;
+	}
+
+	// Keep the load factor below 3/4, counting removed entries since they lengthen probes just the same.
+	if ((NumOccupied + 1) * 4 > Entries.Num() * 3)
+	{
+		const int32 NewCapacity = (NumEntries + 1) * 2 > Entries.Num() ? Entries.Num() * 2 : Entries.Num();
+		Rehash(FMath::Max(NewCapacity, MinCapacity));
+	}
+
+	const int32 Mask = Entries.Num() - 1;
+	for (int32 EntryIndex = GetFirstProbe(ObjectIndex);; EntryIndex = (EntryIndex + 1) & Mask)
+	{
+		FEntry& Entry = Entries[EntryIndex];
+		if (Entry.ObjectIndex == EmptyEntry || Entry.ObjectIndex == RemovedEntry)
+		{
+			if (Entry.ObjectIndex == EmptyEntry)
+			{
+				++NumOccupied;
+			}
+			
+			Entry.ObjectIndex = ObjectIndex;
+			Entry.InterfaceClassId = InterfaceClassId;
+			Entry.Wrapper = Wrapper;
+			++NumEntries;
+			return Wrapper;
+		}
+	}
+}
+
+void FCSInterfaceWrapperTable::RemoveAll(int32 ObjectIndex, TFunctionRef<void(FGCHandle*)> OnRemoved)
+{
+	FWriteScopeLock WriteLock(Lock);
+
+	if (Entries.IsEmpty())
+	{
+		return;
+	}
+
+	const int32 Mask = Entries.Num() - 1;
+	for (int32 EntryIndex = GetFirstProbe(ObjectIndex); Entries[EntryIndex].ObjectIndex != EmptyEntry; EntryIndex = (EntryIndex + 1) & Mask)
+	{
+		FEntry& Entry = Entries[EntryIndex];
+		if (Entry.ObjectIndex == ObjectIndex)
+		{
+			OnRemoved(Entry.Wrapper);
+			
+			Entry.ObjectIndex = RemovedEntry;
+			Entry.Wrapper = nullptr;
+			--NumEntries;
+		}
+	}
+}
+
+void FCSInterfaceWrapperTable::RemoveIf(TFunctionRef<bool(FGCHandle*)> Predicate)
+{
+	FWriteScopeLock WriteLock(Lock);
+
+	for (FEntry& Entry : Entries)
+	{
+		if (Entry.ObjectIndex >= 0 && Predicate(Entry.Wrapper))
+		{
+			Entry.ObjectIndex = RemovedEntry;
+			Entry.Wrapper = nullptr;
+			--NumEntries;
+		}
+	}
+}
+
+int32 FCSInterfaceWrapperTable::FindEntryIndex(int32 ObjectIndex, uint32 InterfaceClassId) const
+{
+	if (Entries.IsEmpty())
+	{
+		return INDEX_NONE;
+	}
+	
+	const int32 Mask = Entries.Num() - 1;
+	for (int32 EntryIndex = GetFirstProbe(ObjectIndex); Entries[EntryIndex].ObjectIndex != EmptyEntry; EntryIndex = (EntryIndex + 1) & Mask)
+	{
+		const FEntry& Entry = Entries[EntryIndex];
+		if (Entry.ObjectIndex == ObjectIndex && Entry.InterfaceClassId == InterfaceClassId)
+		{
+			return EntryIndex;
+		}
+	}
+
+	return INDEX_NONE;
+}
+
+void FCSInterfaceWrapperTable::Rehash(int32 NewCapacity)
+{
+	TArray<FEntry> OldEntries = MoveTemp(Entries);
+	Entries.SetNum(NewCapacity);
+	NumOccupied = NumEntries;
+	
+	const int32 Mask = NewCapacity - 1;
+	for (const FEntry& OldEntry : OldEntries)
+	{
+		if (OldEntry.ObjectIndex < 0)
+		{
+			continue;
+		}
+
+		int32 EntryIndex = GetFirstProbe(OldEntry.ObjectIndex);
+		while (Entries[EntryIndex].ObjectIndex != EmptyEntry)
+		{
+			EntryIndex = (EntryIndex + 1) & Mask;
+		}
+
+		Entries[EntryIndex] = OldEntry;
+	}
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "CSManagedGCHandle.h"
+
+/**
+ * The C# interface wrappers of UObjects, keyed by (object index, interface class id) in a single open-addressed table.
+ * Probing starts from the hash of the object index alone, so every wrapper of an object lies on the same probe
+ * sequence and they can all be removed in one walk when the object is deleted.
+ */
+class UNREALSHARPCORE_API FCSInterfaceWrapperTable
+{
+public:
+	FGCHandle* Find(int32 ObjectIndex, uint32 InterfaceClassId) const;
+
+	// Adds the wrapper unless one was registered in the meantime. Returns the wrapper that ends up in the table.
+	FGCHandle* FindOrAdd(int32 ObjectIndex, uint32 InterfaceClassId, FGCHandle* Wrapper);
+
+	// Removes every wrapper of the object, calling OnRemoved for each of them.
+	void RemoveAll(int32 ObjectIndex, TFunctionRef<void(FGCHandle*)> OnRemoved);
+
+	// Removes every wrapper Predicate returns true for, of any object. Walks the whole table.
+	void RemoveIf(TFunctionRef<bool(FGCHandle*)> Predicate);
+
+	int32 Num() const { return NumEntries; }
+
+	SIZE_T GetAllocatedSize() const
+	{
+		FReadScopeLock ReadLock(Lock);
+		return Entries.GetAllocatedSize();
+	}
+
+private:
+
+	static constexpr int32 EmptyEntry = INDEX_NONE;
+	static constexpr int32 RemovedEntry = INDEX_NONE - 1;
+	static constexpr int32 MinCapacity = 64;
+
+	struct FEntry
+	{
+		int32 ObjectIndex = EmptyEntry;
+		uint32 InterfaceClassId = 0;
+		FGCHandle* Wrapper = nullptr;
+	};
+
+	int32 GetFirstProbe(int32 ObjectIndex) const
+	{
+		// Capacity is always a power of two.
+		return static_cast<int32>(MurmurFinalize32(static_cast<uint32>(ObjectIndex)) & static_cast<uint32>(Entries.Num() - 1));
+	}
+
+	int32 FindEntryIndex(int32 ObjectIndex, uint32 InterfaceClassId) const;
+	void Rehash(int32 NewCapacity);
+
+	TArray<FEntry> Entries;
+
+	// Live entries, and live plus removed entries. Removed entries only go away on rehash.
+	int32 NumEntries = 0;
+	int32 NumOccupied = 0;
+	
+	mutable FRWLock Lock;
+};
@@ -0,0 +1,140 @@
+#include "CSInteropAllocationTracker.h"
+
+#if UNREALSHARP_TRACK_INTEROP_ALLOCATIONS
+
+#include "HAL/IConsoleManager.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "UnrealSharpCore.h"
+
+CSV_DEFINE_CATEGORY(UnrealSharpInterop, true);
+
+TRACE_DECLARE_INT_COUNTER(UnrealSharpInteropAllocations, TEXT("UnrealSharp/InteropAllocations"));
+TRACE_DECLARE_MEMORY_COUNTER(UnrealSharpInteropAllocatedBytes, TEXT("UnrealSharp/InteropAllocatedBytes"));
+
+namespace
+{
+	std::atomic<FCSInteropAllocationSite*> FirstSite { nullptr };
+
+	int32 InteropAllocationBudget = -1;
+	FAutoConsoleVariableRef CVarInteropAllocationBudget(
+		TEXT("UnrealSharp.InteropAllocationBudget"),
+		InteropAllocationBudget,
+		TEXT("Number of native allocations interop may cause per frame before a warning is logged. -1 disables the check."));
+
+	FAutoConsoleCommandWithOutputDevice DumpInteropAllocationsCommand(
+		TEXT("UnrealSharp.InteropAllocations"),
+		TEXT("Prints the native allocations caused by interop, per exporter and call site."),
+		FConsoleCommandWithOutputDeviceDelegate::CreateStatic(&FCSInteropAllocationTracker::Dump));
+
+	FAutoConsoleCommand ResetInteropAllocationsCommand(
+		TEXT("UnrealSharp.InteropAllocations.Reset"),
+		TEXT("Resets the peak and total counts of UnrealSharp.InteropAllocations."),
+		FConsoleCommandDelegate::CreateStatic(&FCSInteropAllocationTracker::Reset));
+
+	double LastBudgetWarningTime = 0.0;
+}
+
+FCSInteropAllocationSite::FCSInteropAllocationSite(const TCHAR* InExporter, const TCHAR* InSite)
+	: Exporter(InExporter)
+	, Site(InSite)
+#if COUNTERSTRACE_ENABLED
+	, TraceCounter(*FString::Printf(TEXT("UnrealSharp/InteropAllocations/%s::%s"), InExporter, InSite), TraceCounterDisplayHint_None)
+#endif
+{
+	FCSInteropAllocationTracker::Register(this);
+}
+
+void FCSInteropAllocationTracker::Register(FCSInteropAllocationSite* Site)
+{
+	FCSInteropAllocationSite* Head = FirstSite.load(std::memory_order_relaxed);
+	do
+	{
+		Site->Next = Head;
+	}
+	while (!FirstSite.compare_exchange_weak(Head, Site, std::memory_order_release, std::memory_order_relaxed));
+}
+
+void FCSInteropAllocationTracker::EndFrame()
+{
+	check(IsInGameThread());
+
+	int32 FrameCount = 0;
+	int64 FrameBytes = 0;
+
+	for (FCSInteropAllocationSite* Site = FirstSite.load(std::memory_order_acquire); Site; Site = Site->Next)
+	{
+		Site->LastFrameCount = Site->FrameCount.exchange(0, std::memory_order_relaxed);
+		Site->LastFrameBytes = Site->FrameBytes.exchange(0, std::memory_order_relaxed);
+		Site->PeakFrameCount = FMath::Max(Site->PeakFrameCount, Site->LastFrameCount);
+		Site->TotalCount += Site->LastFrameCount;
+		Site->TotalBytes += Site->LastFrameBytes;
+
+		FrameCount += Site->LastFrameCount;
+		FrameBytes += Site->LastFrameBytes;
+
+#if COUNTERSTRACE_ENABLED
+		Site->TraceCounter.Set(Site->LastFrameCount);
+#endif
+	}
+
+	TRACE_COUNTER_SET(UnrealSharpInteropAllocations, FrameCount);
+	TRACE_COUNTER_SET(UnrealSharpInteropAllocatedBytes, FrameBytes);
+	CSV_CUSTOM_STAT(UnrealSharpInterop, Allocations, FrameCount, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(UnrealSharpInterop, AllocatedKB, FrameBytes / 1024.0, ECsvCustomStatOp::Set);
+
+	if (InteropAllocationBudget < 0 || FrameCount <= InteropAllocationBudget)
+	{
+		return;
+	}
+
+	// Once a second at most, a system that allocates every frame would drown the log otherwise.
+	const double Now = FPlatformTime::Seconds();
+	if (Now - LastBudgetWarningTime < 1.0)
+	{
+		return;
+	}
+
+	LastBudgetWarningTime = Now;
+	UE_LOG(LogUnrealSharp, Warning, TEXT("Interop caused %d native allocations (%lld bytes) this frame, the budget is %d:"), FrameCount, FrameBytes, InteropAllocationBudget);
+
+	for (const FCSInteropAllocationSite* Site = FirstSite.load(std::memory_order_acquire); Site; Site = Site->Next)
+	{
+		if (Site->LastFrameCount > 0)
+		{
+			UE_LOG(LogUnrealSharp, Warning, TEXT("    %s::%s: %d (%lld bytes)"), Site->Exporter, Site->Site, Site->LastFrameCount, Site->LastFrameBytes);
+		}
+	}
+}
+
+void FCSInteropAllocationTracker::Dump(FOutputDevice& Ar)
+{
+	TArray<const FCSInteropAllocationSite*> Sites;
+	for (const FCSInteropAllocationSite* Site = FirstSite.load(std::memory_order_acquire); Site; Site = Site->Next)
+	{
+		Sites.Add(Site);
+	}
+
+	Sites.Sort([](const FCSInteropAllocationSite& A, const FCSInteropAllocationSite& B)
+	{
+		return A.TotalCount > B.TotalCount;
+	});
+
+	Ar.Logf(TEXT("%-60s %10s %10s %12s %14s"), TEXT("Site"), TEXT("LastFrame"), TEXT("Peak"), TEXT("Total"), TEXT("TotalBytes"));
+	for (const FCSInteropAllocationSite* Site : Sites)
+	{
+		Ar.Logf(TEXT("%-60s %10d %10d %12lld %14lld"), *FString::Printf(TEXT("%s::%s"), Site->Exporter, Site->Site),
+			Site->LastFrameCount, Site->PeakFrameCount, Site->TotalCount, Site->TotalBytes);
+	}
+}
+
+void FCSInteropAllocationTracker::Reset()
+{
+	for (FCSInteropAllocationSite* Site = FirstSite.load(std::memory_order_acquire); Site; Site = Site->Next)
+	{
+		Site->PeakFrameCount = 0;
+		Site->TotalCount = 0;
+		Site->TotalBytes = 0;
+	}
+}
+
+#endif
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CountersTrace.h"
+#include <atomic>
+
+// Counts the native allocations interop causes, per call site. Compiled out of shipping builds unless asked for.
+#ifndef UNREALSHARP_TRACK_INTEROP_ALLOCATIONS
+#define UNREALSHARP_TRACK_INTEROP_ALLOCATIONS !UE_BUILD_SHIPPING
+#endif
+
+#if UNREALSHARP_TRACK_INTEROP_ALLOCATIONS
+
+/**
+ * A place in the interop layer that allocates native memory. Declared as a function local static by
+ * CS_TRACK_INTEROP_ALLOCATION, so every call site registers itself the first time it allocates.
+ */
+struct UNREALSHARPCORE_API FCSInteropAllocationSite
+{
+	FCSInteropAllocationSite(const TCHAR* InExporter, const TCHAR* InSite);
+
+	void Record(int64 Bytes)
+	{
+		FrameCount.fetch_add(1, std::memory_order_relaxed);
+		FrameBytes.fetch_add(Bytes, std::memory_order_relaxed);
+	}
+
+	const TCHAR* Exporter;
+	const TCHAR* Site;
+
+	// Written from any thread, collected by FCSInteropAllocationTracker::EndFrame on the game thread.
+	std::atomic<int32> FrameCount { 0 };
+	std::atomic<int64> FrameBytes { 0 };
+
+	// Only touched on the game thread.
+	int32 LastFrameCount = 0;
+	int64 LastFrameBytes = 0;
+	int32 PeakFrameCount = 0;
+	int64 TotalCount = 0;
+	int64 TotalBytes = 0;
+
+#if COUNTERSTRACE_ENABLED
+	FCountersTrace::FCounterInt TraceCounter;
+#endif
+
+	FCSInteropAllocationSite* Next = nullptr;
+};
+
+/**
+ * Rolls the per-frame counts of all allocation sites over, publishes them to Insights and the CSV profiler,
+ * and warns when a frame goes over UnrealSharp.InteropAllocationBudget.
+ * UnrealSharp.InteropAllocations prints the breakdown per call site.
+ */
+class UNREALSHARPCORE_API FCSInteropAllocationTracker
+{
+public:
+	static void Register(FCSInteropAllocationSite* Site);
+
+	// Must run on the game thread, once per frame.
+	static void EndFrame();
+
+	static void Dump(FOutputDevice& Ar);
+	static void Reset();
+};
+
+#define CS_TRACK_INTEROP_ALLOCATION(Exporter, SiteName, Bytes) \
+	do \
+	{ \
+		static FCSInteropAllocationSite PREPROCESSOR_JOIN(InteropAllocationSite, __LINE__)(TEXT(Exporter), TEXT(SiteName)); \
+		PREPROCESSOR_JOIN(InteropAllocationSite, __LINE__).Record(Bytes); \
+	} while (0)
+
+#else
+
+#define CS_TRACK_INTEROP_ALLOCATION(Exporter, SiteName, Bytes) do {} while (0)
+
+#endif
+
+// Records an allocation if the string had to grow its buffer since OldCapacity was taken.
+#define CS_TRACK_INTEROP_STRING_ALLOCATION(Exporter, SiteName, String, OldCapacity) \
+	do \
+	{ \
+		if ((String).GetCharArray().Max() > (OldCapacity)) \
+		{ \
+			CS_TRACK_INTEROP_ALLOCATION(Exporter, SiteName, (String).GetCharArray().Max() * sizeof(TCHAR)); \
+		} \
+	} while (0)
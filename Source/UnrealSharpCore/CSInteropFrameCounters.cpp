@@ -0,0 +1,69 @@
+#include "CSInteropFrameCounters.h"
+
+#if UNREALSHARP_CSV_INTEROP_COUNTERS
+
+#include "CSManagedCallbacksCache.h"
+#include "GCOptimizations/CSGCPressureMonitor.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+CSV_DEFINE_CATEGORY(UnrealSharp, true);
+
+std::atomic<int32> FCSInteropFrameCounters::ManagedToNativeCalls { 0 };
+std::atomic<int32> FCSInteropFrameCounters::NativeToManagedCalls { 0 };
+std::atomic<int32> FCSInteropFrameCounters::HandlesCreated { 0 };
+std::atomic<int32> FCSInteropFrameCounters::HandlesDisposed { 0 };
+std::atomic<uint64> FCSInteropFrameCounters::InvokeManagedMethodCycles { 0 };
+std::atomic<uint64> FCSInteropFrameCounters::InvokeDelegateCycles { 0 };
+bool FCSInteropFrameCounters::bCapturing = false;
+
+namespace
+{
+	// Total bytes the managed heap had allocated at the end of the last captured frame, -1 before the first one.
+	int64 LastTotalAllocatedBytes = -1;
+}
+
+void FCSInteropFrameCounters::EndFrame()
+{
+	check(IsInGameThread());
+
+	const int32 FrameManagedToNativeCalls = ManagedToNativeCalls.exchange(0, std::memory_order_relaxed);
+	const int32 FrameNativeToManagedCalls = NativeToManagedCalls.exchange(0, std::memory_order_relaxed);
+	const int32 FrameHandlesCreated = HandlesCreated.exchange(0, std::memory_order_relaxed);
+	const int32 FrameHandlesDisposed = HandlesDisposed.exchange(0, std::memory_order_relaxed);
+	const uint64 FrameInvokeManagedMethodCycles = InvokeManagedMethodCycles.exchange(0, std::memory_order_relaxed);
+	const uint64 FrameInvokeDelegateCycles = InvokeDelegateCycles.exchange(0, std::memory_order_relaxed);
+
+	const bool bWasCapturing = bCapturing;
+	bCapturing = FCsvProfiler::Get()->IsCapturing();
+
+	if (!bWasCapturing)
+	{
+		LastTotalAllocatedBytes = -1;
+		return;
+	}
+
+	CSV_CUSTOM_STAT(UnrealSharp, ManagedToNativeCalls, FrameManagedToNativeCalls, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(UnrealSharp, NativeToManagedCalls, FrameNativeToManagedCalls, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(UnrealSharp, HandlesCreated, FrameHandlesCreated, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(UnrealSharp, HandlesDisposed, FrameHandlesDisposed, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(UnrealSharp, InvokeManagedMethodMs, FPlatformTime::ToMilliseconds64(FrameInvokeManagedMethodCycles), ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(UnrealSharp, InvokeDelegateMs, FPlatformTime::ToMilliseconds64(FrameInvokeDelegateCycles), ECsvCustomStatOp::Set);
+
+	if (!FCSManagedCallbacks::ManagedCallbacks.GetGCMemoryInfo)
+	{
+		return;
+	}
+
+	FCSManagedGCMemoryInfo MemoryInfo;
+	FCSManagedCallbacks::ManagedCallbacks.GetGCMemoryInfo(&MemoryInfo);
+
+	// The first captured frame only establishes the baseline.
+	if (LastTotalAllocatedBytes >= 0)
+	{
+		CSV_CUSTOM_STAT(UnrealSharp, ManagedAllocatedKB, (MemoryInfo.TotalAllocatedBytes - LastTotalAllocatedBytes) / 1024.0, ECsvCustomStatOp::Set);
+	}
+
+	LastTotalAllocatedBytes = MemoryInfo.TotalAllocatedBytes;
+}
+
+#endif
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CsvProfilerConfig.h"
+#include <atomic>
+
+// Publishes per-frame interop counters to the CSV profiler. On wherever the CSV profiler is, which includes Test builds.
+#ifndef UNREALSHARP_CSV_INTEROP_COUNTERS
+#define UNREALSHARP_CSV_INTEROP_COUNTERS CSV_PROFILER
+#endif
+
+#if UNREALSHARP_CSV_INTEROP_COUNTERS
+
+/**
+ * Counts the transitions between native and managed code, the handles the handle stores hand out and take back,
+ * and the time spent in managed UFunctions and delegates, and writes them to the UnrealSharp CSV category at
+ * the end of every frame, along with the bytes the managed heap allocated.
+ * Counting is a relaxed atomic add, timing only happens while a CSV capture is running.
+ */
+class UNREALSHARPCORE_API FCSInteropFrameCounters
+{
+public:
+	static void RecordManagedToNativeCall()
+	{
+		ManagedToNativeCalls.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	static void RecordNativeToManagedCall()
+	{
+		NativeToManagedCalls.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	static void RecordHandleCreated()
+	{
+		HandlesCreated.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	static void RecordHandlesDisposed(int32 NumHandles = 1)
+	{
+		HandlesDisposed.fetch_add(NumHandles, std::memory_order_relaxed);
+	}
+
+	// Whether a CSV capture was running at the end of the last frame.
+	static bool IsCapturing() { return bCapturing; }
+
+	// Must run on the game thread, once per frame.
+	static void EndFrame();
+
+private:
+	friend class FCSScopedManagedInvokeTimer;
+
+	static std::atomic<int32> ManagedToNativeCalls;
+	static std::atomic<int32> NativeToManagedCalls;
+	static std::atomic<int32> HandlesCreated;
+	static std::atomic<int32> HandlesDisposed;
+	static std::atomic<uint64> InvokeManagedMethodCycles;
+	static std::atomic<uint64> InvokeDelegateCycles;
+
+	static bool bCapturing;
+};
+
+/**
+ * Counts one native to managed call, and times it while a CSV capture is running.
+ */
+class FCSScopedManagedInvokeTimer
+{
+public:
+	enum class EKind : uint8
+	{
+		Method,
+		Delegate,
+	};
+
+	explicit FCSScopedManagedInvokeTimer(EKind InKind)
+		: Kind(InKind)
+		, StartCycles(FCSInteropFrameCounters::IsCapturing() ? FPlatformTime::Cycles64() : 0)
+	{
+		FCSInteropFrameCounters::RecordNativeToManagedCall();
+	}
+
+	~FCSScopedManagedInvokeTimer()
+	{
+		if (!StartCycles)
+		{
+			return;
+		}
+
+		std::atomic<uint64>& Cycles = Kind == EKind::Method ? FCSInteropFrameCounters::InvokeManagedMethodCycles : FCSInteropFrameCounters::InvokeDelegateCycles;
+		Cycles.fetch_add(FPlatformTime::Cycles64() - StartCycles, std::memory_order_relaxed);
+	}
+
+private:
+	EKind Kind;
+	uint64 StartCycles;
+};
+
+#define CS_COUNT_MANAGED_TO_NATIVE_CALL() FCSInteropFrameCounters::RecordManagedToNativeCall()
+#define CS_COUNT_HANDLE_CREATED() FCSInteropFrameCounters::RecordHandleCreated()
+#define CS_COUNT_HANDLES_DISPOSED(NumHandles) FCSInteropFrameCounters::RecordHandlesDisposed(NumHandles)
+#define CS_SCOPED_MANAGED_INVOKE(Kind) FCSScopedManagedInvokeTimer PREPROCESSOR_JOIN(ScopedManagedInvoke, __LINE__)(FCSScopedManagedInvokeTimer::EKind::Kind)
+
+#else
+
+#define CS_COUNT_MANAGED_TO_NATIVE_CALL() do {} while (0)
+#define CS_COUNT_HANDLE_CREATED() do {} while (0)
+#define CS_COUNT_HANDLES_DISPOSED(NumHandles) do {} while (0)
+#define CS_SCOPED_MANAGED_INVOKE(Kind)
+
+#endif
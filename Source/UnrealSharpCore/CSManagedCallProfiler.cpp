@@ -0,0 +1,189 @@
+#include "CSManagedCallProfiler.h"
+
+#if UNREALSHARP_PROFILE_MANAGED_CALLS
+
+#include "HAL/IConsoleManager.h"
+#include "ProfilingDebugging/CountersTrace.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "TypeGenerator/Functions/CSFunction.h"
+
+CSV_DEFINE_CATEGORY(UnrealSharpManagedCalls, true);
+
+TRACE_DECLARE_INT_COUNTER(UnrealSharpManagedCalls, TEXT("UnrealSharp/ManagedCalls"));
+TRACE_DECLARE_FLOAT_COUNTER(UnrealSharpManagedCallMs, TEXT("UnrealSharp/ManagedCallMs"));
+TRACE_DECLARE_FLOAT_COUNTER(UnrealSharpManagedCallBoundaryMs, TEXT("UnrealSharp/ManagedCallBoundaryMs"));
+
+bool FCSManagedCallProfiler::bEnabled = false;
+
+namespace
+{
+	FCriticalSection StatsLock;
+	TMap<FName, TUniquePtr<FCSManagedCallStats>> StatsByName;
+
+	FAutoConsoleVariableRef CVarProfileManagedCalls(
+		TEXT("UnrealSharp.ProfileManagedCalls"),
+		FCSManagedCallProfiler::bEnabled,
+		TEXT("Gives every managed UFunction its own CPU trace scope, and counts calls and time per function for UnrealSharp.ManagedCalls."));
+
+	FAutoConsoleCommandWithOutputDevice DumpManagedCallsCommand(
+		TEXT("UnrealSharp.ManagedCalls"),
+		TEXT("Prints the calls and time of every managed UFunction called while UnrealSharp.ProfileManagedCalls was set, hottest first."),
+		FConsoleCommandWithOutputDeviceDelegate::CreateStatic(&FCSManagedCallProfiler::Dump));
+
+	FAutoConsoleCommand ResetManagedCallsCommand(
+		TEXT("UnrealSharp.ManagedCalls.Reset"),
+		TEXT("Resets the totals of UnrealSharp.ManagedCalls."),
+		FConsoleCommandDelegate::CreateStatic(&FCSManagedCallProfiler::Reset));
+
+	double CyclesToMs(uint64 Cycles)
+	{
+		return FPlatformTime::ToMilliseconds64(Cycles);
+	}
+}
+
+FCSManagedCallStats* FCSManagedCallProfiler::FindOrAddStats(const UCSFunctionBase* Function)
+{
+	const FName FunctionName(*FString::Printf(TEXT("%s::%s"), *Function->GetOwnerClass()->GetName(), *Function->GetName()));
+
+	FScopeLock Lock(&StatsLock);
+	TUniquePtr<FCSManagedCallStats>& Stats = StatsByName.FindOrAdd(FunctionName);
+	if (!Stats)
+	{
+		Stats = MakeUnique<FCSManagedCallStats>();
+		Stats->FunctionName = FunctionName;
+#if CPUPROFILERTRACE_ENABLED
+		Stats->TraceSpecId = FCpuProfilerTrace::OutputEventType(*FunctionName.ToString());
+#endif
+	}
+
+	return Stats.Get();
+}
+
+void FCSManagedCallProfiler::EndFrame()
+{
+	check(IsInGameThread());
+
+	int64 FrameCalls = 0;
+	uint64 FrameCycles = 0;
+	uint64 FrameManagedCycles = 0;
+
+	{
+		FScopeLock Lock(&StatsLock);
+		for (const TPair<FName, TUniquePtr<FCSManagedCallStats>>& Pair : StatsByName)
+		{
+			FCSManagedCallStats& Stats = *Pair.Value;
+			const int64 Calls = Stats.FrameCalls.exchange(0, std::memory_order_relaxed);
+			const uint64 Cycles = Stats.FrameCycles.exchange(0, std::memory_order_relaxed);
+			const uint64 ManagedCycles = Stats.FrameManagedCycles.exchange(0, std::memory_order_relaxed);
+
+			Stats.TotalCalls += Calls;
+			Stats.TotalCycles += Cycles;
+			Stats.TotalManagedCycles += ManagedCycles;
+
+			FrameCalls += Calls;
+			FrameCycles += Cycles;
+			FrameManagedCycles += ManagedCycles;
+		}
+	}
+
+	if (!bEnabled && FrameCalls == 0)
+	{
+		return;
+	}
+
+	const double ManagedMs = CyclesToMs(FrameManagedCycles);
+	const double BoundaryMs = CyclesToMs(FrameCycles - FrameManagedCycles);
+
+	TRACE_COUNTER_SET(UnrealSharpManagedCalls, FrameCalls);
+	TRACE_COUNTER_SET(UnrealSharpManagedCallMs, ManagedMs);
+	TRACE_COUNTER_SET(UnrealSharpManagedCallBoundaryMs, BoundaryMs);
+	CSV_CUSTOM_STAT(UnrealSharpManagedCalls, Calls, static_cast<int32>(FrameCalls), ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(UnrealSharpManagedCalls, ManagedMs, ManagedMs, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(UnrealSharpManagedCalls, BoundaryMs, BoundaryMs, ECsvCustomStatOp::Set);
+}
+
+void FCSManagedCallProfiler::Dump(FOutputDevice& Ar)
+{
+	TArray<const FCSManagedCallStats*> AllStats;
+	{
+		FScopeLock Lock(&StatsLock);
+		for (const TPair<FName, TUniquePtr<FCSManagedCallStats>>& Pair : StatsByName)
+		{
+			if (Pair.Value->TotalCalls > 0)
+			{
+				AllStats.Add(Pair.Value.Get());
+			}
+		}
+	}
+
+	if (AllStats.IsEmpty())
+	{
+		Ar.Logf(TEXT("No managed calls recorded, set UnrealSharp.ProfileManagedCalls 1 to record them."));
+		return;
+	}
+
+	AllStats.Sort([](const FCSManagedCallStats& A, const FCSManagedCallStats& B)
+	{
+		return A.TotalCycles > B.TotalCycles;
+	});
+
+	Ar.Logf(TEXT("%-60s %12s %12s %12s %12s %10s"), TEXT("Function"), TEXT("Calls"), TEXT("TotalMs"), TEXT("ManagedMs"), TEXT("BoundaryMs"), TEXT("AvgUs"));
+	for (const FCSManagedCallStats* Stats : AllStats)
+	{
+		const double TotalMs = CyclesToMs(Stats->TotalCycles);
+		Ar.Logf(TEXT("%-60s %12lld %12.3f %12.3f %12.3f %10.3f"), *Stats->FunctionName.ToString(), Stats->TotalCalls, TotalMs,
+			CyclesToMs(Stats->TotalManagedCycles), CyclesToMs(Stats->TotalCycles - Stats->TotalManagedCycles), TotalMs * 1000.0 / Stats->TotalCalls);
+	}
+}
+
+void FCSManagedCallProfiler::Reset()
+{
+	FScopeLock Lock(&StatsLock);
+	for (const TPair<FName, TUniquePtr<FCSManagedCallStats>>& Pair : StatsByName)
+	{
+		Pair.Value->TotalCalls = 0;
+		Pair.Value->TotalCycles = 0;
+		Pair.Value->TotalManagedCycles = 0;
+	}
+}
+
+FCSScopedManagedCallProfile::FCSScopedManagedCallProfile(UCSFunctionBase* Function)
+{
+	if (!FCSManagedCallProfiler::IsEnabled())
+	{
+		return;
+	}
+
+	Stats = Function->GetProfilerStats();
+
+#if CPUPROFILERTRACE_ENABLED
+	if (UE_TRACE_CHANNELEXPR_IS_ENABLED(CpuChannel))
+	{
+		FCpuProfilerTrace::OutputBeginEvent(Stats->TraceSpecId);
+		bTraceEvent = true;
+	}
+#endif
+
+	StartCycles = FPlatformTime::Cycles64();
+}
+
+FCSScopedManagedCallProfile::~FCSScopedManagedCallProfile()
+{
+	if (!Stats)
+	{
+		return;
+	}
+
+	Stats->FrameCalls.fetch_add(1, std::memory_order_relaxed);
+	Stats->FrameCycles.fetch_add(FPlatformTime::Cycles64() - StartCycles, std::memory_order_relaxed);
+	Stats->FrameManagedCycles.fetch_add(ManagedCycles, std::memory_order_relaxed);
+
+#if CPUPROFILERTRACE_ENABLED
+	if (bTraceEvent)
+	{
+		FCpuProfilerTrace::OutputEndEvent();
+	}
+#endif
+}
+
+#endif
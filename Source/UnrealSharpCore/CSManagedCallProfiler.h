@@ -0,0 +1,106 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include <atomic>
+
+class UCSFunctionBase;
+
+// Profiles managed UFunction calls per function. Compiled out of shipping builds unless asked for.
+#ifndef UNREALSHARP_PROFILE_MANAGED_CALLS
+#define UNREALSHARP_PROFILE_MANAGED_CALLS !UE_BUILD_SHIPPING
+#endif
+
+#if UNREALSHARP_PROFILE_MANAGED_CALLS
+
+/**
+ * Call count and time of one managed function, shared by every version of it hot reload creates.
+ * Times are inclusive, a managed function that calls another one counts the time of both.
+ */
+struct FCSManagedCallStats
+{
+	FName FunctionName;
+
+	// Written from any thread, the last frame's values are collected by FCSManagedCallProfiler::EndFrame on the game thread.
+	std::atomic<int64> FrameCalls { 0 };
+	std::atomic<uint64> FrameCycles { 0 };
+	std::atomic<uint64> FrameManagedCycles { 0 };
+
+	// Only touched on the game thread.
+	int64 TotalCalls = 0;
+	uint64 TotalCycles = 0;
+	uint64 TotalManagedCycles = 0;
+
+#if CPUPROFILERTRACE_ENABLED
+	uint32 TraceSpecId = 0;
+#endif
+};
+
+/**
+ * Gives every managed UFunction a CPU trace scope of its own and counts its calls and time, when
+ * UnrealSharp.ProfileManagedCalls is set. The time spent in the managed method is reported apart from the
+ * boundary overhead around it: finding the managed object, setting up the world context and handling exceptions.
+ * UnrealSharp.ManagedCalls prints the breakdown per function.
+ */
+class UNREALSHARPCORE_API FCSManagedCallProfiler
+{
+public:
+	static bool IsEnabled() { return bEnabled; }
+
+	// Stats of a function, created the first time it is called while profiling.
+	static FCSManagedCallStats* FindOrAddStats(const UCSFunctionBase* Function);
+
+	// Must run on the game thread, once per frame.
+	static void EndFrame();
+
+	static void Dump(FOutputDevice& Ar);
+	static void Reset();
+
+	// Set by UnrealSharp.ProfileManagedCalls.
+	static bool bEnabled;
+};
+
+/**
+ * Profiles one call of a managed function, for UCSFunctionBase::InvokeManagedMethod
+ */
+class FCSScopedManagedCallProfile
+{
+public:
+	explicit FCSScopedManagedCallProfile(UCSFunctionBase* Function);
+	~FCSScopedManagedCallProfile();
+
+	void BeginManagedCall()
+	{
+		if (Stats)
+		{
+			ManagedStartCycles = FPlatformTime::Cycles64();
+		}
+	}
+
+	void EndManagedCall()
+	{
+		if (Stats)
+		{
+			ManagedCycles += FPlatformTime::Cycles64() - ManagedStartCycles;
+		}
+	}
+
+private:
+	FCSManagedCallStats* Stats = nullptr;
+	uint64 StartCycles = 0;
+	uint64 ManagedStartCycles = 0;
+	uint64 ManagedCycles = 0;
+	bool bTraceEvent = false;
+};
+
+#else
+
+class FCSScopedManagedCallProfile
+{
+public:
+	explicit FCSScopedManagedCallProfile(UCSFunctionBase*) {}
+	void BeginManagedCall() {}
+	void EndManagedCall() {}
+};
+
+#endif
@@ -8,6 +8,8 @@ struct FScopedGCHandle;
 struct FInvokeManagedMethodData;
 struct FGCHandleIntPtr;
 struct FGCHandle;
+class FCSDeferredHandleDisposer;
+struct FCSManagedGCMemoryInfo;
 
 class UNREALSHARPCORE_API FCSManagedCallbacks
 {
@@ -17,15 +19,28 @@ class UNREALSHARPCORE_API FCSManagedCallbacks
 	{
 		using ManagedCallbacks_CreateNewManagedObject = FGCHandleIntPtr(__stdcall*)(const void*, void*, TCHAR**);
 		using ManagedCallbacks_CreateNewManagedObjectWrapper = FGCHandleIntPtr(__stdcall*)(void*, void*);
-		using ManagedCallbacks_InvokeManagedEvent = int(__stdcall*)(void*, void*, void*, void*, void*);
+		using ManagedCallbacks_InvokeManagedEvent = int(__stdcall*)(void*, void*, void*, void*);
 		using ManagedCallbacks_InvokeDelegate = int(__stdcall*)(FGCHandleIntPtr);
 		using ManagedCallbacks_LookupMethod = uint8*(__stdcall*)(void*, const TCHAR*);
 		using ManagedCallbacks_LookupType = uint8*(__stdcall*)(uint8*, const TCHAR*);
 		using ManagedCallbacks_Dispose = void(__stdcall*)(FGCHandleIntPtr, FGCHandleIntPtr);
 		using ManagedCallbacks_FreeHandle = void(__stdcall*)(FGCHandleIntPtr);
+		using ManagedCallbacks_InvokeManagedMethodBatch = int(__stdcall*)(void*, void* const*, void*, int, int);
+		using ManagedCallbacks_DisposeHandles = void(__stdcall*)(const FGCHandleIntPtr*, int);
+		using ManagedCallbacks_GetGeneratedTypeNames = void(__stdcall*)(void*, FString*);
+		using ManagedCallbacks_LookupMethods = int(__stdcall*)(void*, const TCHAR* const*, uint8**, int);
+		using ManagedCallbacks_CollectGarbage = void(__stdcall*)(int, bool);
+		using ManagedCallbacks_TryStartNoGCRegion = bool(__stdcall*)(int64);
+		using ManagedCallbacks_EndNoGCRegion = void(__stdcall*)();
+		using ManagedCallbacks_GetGCMemoryInfo = void(__stdcall*)(FCSManagedGCMemoryInfo*);
+		using ManagedCallbacks_FindDeadHandles = int(__stdcall*)(const FGCHandleIntPtr*, uint8*, int);
+		using ManagedCallbacks_PrepareChangedMethods = int(__stdcall*)(void*);
+		using ManagedCallbacks_CreateNewManagedObjects = int(__stdcall*)(const void* const*, void*, FGCHandleIntPtr*, int);
+		using ManagedCallbacks_GetLastManagedException = void(__stdcall*)(FString*);
 		
 		ManagedCallbacks_CreateNewManagedObject CreateNewManagedObject;
 		ManagedCallbacks_CreateNewManagedObjectWrapper CreateNewManagedObjectWrapper;
+		// Returns 1 if the method threw, GetLastManagedException has the exception.
 		ManagedCallbacks_InvokeManagedEvent InvokeManagedMethod;
 		ManagedCallbacks_InvokeDelegate InvokeDelegate;
 		ManagedCallbacks_LookupMethod LookupManagedMethod;
@@ -37,6 +52,48 @@ class UNREALSHARPCORE_API FCSManagedCallbacks
 	    friend FScopedGCHandle;
 		ManagedCallbacks_Dispose Dispose;
 		ManagedCallbacks_FreeHandle FreeHandle;
+
+	public:
+		// Invokes one method on many objects in a single transition. Returns the number of invocations that threw,
+		// GetLastManagedException has the first exception.
+		ManagedCallbacks_InvokeManagedMethodBatch InvokeManagedMethodBatch;
+
+	private:
+		// Disposes (handle, assembly handle) pairs in a single transition.
+		friend FCSDeferredHandleDisposer;
+		ManagedCallbacks_DisposeHandles DisposeHandles;
+
+	public:
+		// Returns the full names of all glue types in an assembly, separated by semicolons.
+		ManagedCallbacks_GetGeneratedTypeNames GetGeneratedTypeNames;
+
+		// Looks up the Invoke_ methods of many functions of a type at once. Returns the number of methods found.
+		ManagedCallbacks_LookupMethods LookupManagedMethods;
+
+		// Blocking .NET collection of the generation and everything younger. Compacting also compacts the large object heap once.
+		ManagedCallbacks_CollectGarbage CollectGarbage;
+
+		// Reserves the budget up front so no .NET collection happens until it is allocated, or EndNoGCRegion is called.
+		ManagedCallbacks_TryStartNoGCRegion TryStartNoGCRegion;
+		ManagedCallbacks_EndNoGCRegion EndNoGCRegion;
+
+		// Fills in a snapshot of the .NET heap. Only allocates on the managed side when a collection happened since the last call.
+		ManagedCallbacks_GetGCMemoryInfo GetGCMemoryInfo;
+
+		// Flags the handles whose target has been collected, or that were already freed. Returns the number of dead handles.
+		ManagedCallbacks_FindDeadHandles FindDeadHandles;
+
+		// Compiles the methods of an assembly whose IL changed since the last call for an assembly of the same name, on worker threads.
+		// Returns the number of methods compiled.
+		ManagedCallbacks_PrepareChangedMethods PrepareChangedMethods;
+
+		// Creates the C# counterparts of many objects of the same type in a single transition. Objects that failed get a null handle.
+		// Returns the number of counterparts created.
+		ManagedCallbacks_CreateNewManagedObjects CreateNewManagedObjects;
+
+		// Takes the last exception a managed method invoked on this thread threw, and writes it out unless the message is null.
+		// Exceptions are only formatted here, so calls that don't report them don't pay for it.
+		ManagedCallbacks_GetLastManagedException GetLastManagedException;
 	};
 	
 	static inline FManagedCallbacks ManagedCallbacks;
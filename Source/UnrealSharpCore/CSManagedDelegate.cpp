@@ -1,6 +1,7 @@
 ﻿#include "CSManagedDelegate.h"
 
 #include "CSManager.h"
+#include "CSInteropFrameCounters.h"
 
 void FCSManagedDelegate::Invoke(UObject* WorldContextObject, bool bDispose)
 {
@@ -12,13 +13,12 @@ void FCSManagedDelegate::Invoke(UObject* WorldContextObject, bool bDispose)
 		return;
 	}
 
-	if (IsValid(WorldContextObject))
 	{
-		UCSManager::Get().SetCurrentWorldContext(WorldContextObject);
+		FCSScopedInvokeWorldContext ScopedWorldContext(IsValid(WorldContextObject) ? WorldContextObject : GCSInvokeWorldContext);
+		CS_SCOPED_MANAGED_INVOKE(Delegate);
+		FCSManagedCallbacks::ManagedCallbacks.InvokeDelegate(CallbackHandle.GetHandle());
 	}
 
-	FCSManagedCallbacks::ManagedCallbacks.InvokeDelegate(CallbackHandle.GetHandle());
-
 	if (bDispose)
 	{
 		Dispose();
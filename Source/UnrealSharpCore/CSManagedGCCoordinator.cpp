@@ -0,0 +1,128 @@
+#include "CSManagedGCCoordinator.h"
+#include "CSManagedCallbacksCache.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GCOptimizations/CSGCPressureMonitor.h"
+#include "UObject/UObjectGlobals.h"
+
+void FCSManagedGCCoordinator::Initialize(int64 InNoGCRegionBudget)
+{
+	if (InNoGCRegionBudget <= 0 || IsActive())
+	{
+		return;
+	}
+
+	NoGCRegionBudget = InNoGCRegionBudget;
+	PreLoadMapHandle = FCoreUObjectDelegates::PreLoadMap.AddRaw(this, &FCSManagedGCCoordinator::OnPreLoadMap);
+	PostLoadMapHandle = FCoreUObjectDelegates::PostLoadMapWithWorld.AddRaw(this, &FCSManagedGCCoordinator::OnPostLoadMap);
+}
+
+void FCSManagedGCCoordinator::Shutdown()
+{
+	if (!IsActive())
+	{
+		return;
+	}
+
+	FCoreUObjectDelegates::PreLoadMap.Remove(PreLoadMapHandle);
+	FCoreUObjectDelegates::PostLoadMapWithWorld.Remove(PostLoadMapHandle);
+
+	ExitNoGCRegion();
+	NoGCRegionBudget = 0;
+}
+
+void FCSManagedGCCoordinator::OnGarbagePurged()
+{
+	// Map loads collect once they are done, don't collect for every purge along the way.
+	if (!IsActive() || bIsLoadingMap || !IsPlayingGame())
+	{
+		return;
+	}
+
+	bool bCompact;
+	const int32 Generation = GetCollectionGeneration(bCompact);
+	CollectAndEnterNoGCRegion(Generation, bCompact);
+}
+
+void FCSManagedGCCoordinator::OnPreLoadMap(const FString& MapName)
+{
+	// Loading allocates a lot of short lived managed objects, let the runtime collect as it needs to.
+	bIsLoadingMap = true;
+	ExitNoGCRegion();
+}
+
+void FCSManagedGCCoordinator::OnPostLoadMap(UWorld* World)
+{
+	bIsLoadingMap = false;
+
+	if (!World || !World->IsGameWorld())
+	{
+		return;
+	}
+
+	// The previous map is gone, clean out everything it left behind before gameplay starts.
+	CollectAndEnterNoGCRegion(2, true);
+}
+
+void FCSManagedGCCoordinator::CollectAndEnterNoGCRegion(int32 Generation, bool bCompact)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FCSManagedGCCoordinator::CollectAndEnterNoGCRegion);
+
+	ExitNoGCRegion();
+	FCSManagedCallbacks::ManagedCallbacks.CollectGarbage(Generation, bCompact);
+
+	bInNoGCRegion = FCSManagedCallbacks::ManagedCallbacks.TryStartNoGCRegion(NoGCRegionBudget);
+	if (!bInNoGCRegion)
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("CSManagedGCCoordinator: Couldn't reserve %lld bytes for a no GC region"), NoGCRegionBudget);
+	}
+}
+
+void FCSManagedGCCoordinator::ExitNoGCRegion()
+{
+	if (!bInNoGCRegion)
+	{
+		return;
+	}
+
+	FCSManagedCallbacks::ManagedCallbacks.EndNoGCRegion();
+	bInNoGCRegion = false;
+}
+
+int32 FCSManagedGCCoordinator::GetCollectionGeneration(bool& bOutCompact)
+{
+	bOutCompact = false;
+
+	switch (FCSGCPressureMonitor::GetCurrentGCStatistics().PressureLevel)
+	{
+		case FCSGCPressureMonitor::EGCPressureLevel::Low:
+			return 0;
+		case FCSGCPressureMonitor::EGCPressureLevel::Moderate:
+			return 1;
+		case FCSGCPressureMonitor::EGCPressureLevel::High:
+			return 2;
+		case FCSGCPressureMonitor::EGCPressureLevel::Critical:
+		default:
+			bOutCompact = true;
+			return 2;
+	}
+}
+
+bool FCSManagedGCCoordinator::IsPlayingGame()
+{
+	if (!GEngine)
+	{
+		return false;
+	}
+
+	for (const FWorldContext& WorldContext : GEngine->GetWorldContexts())
+	{
+		const UWorld* World = WorldContext.World();
+		if (World && World->IsGameWorld() && World->HasBegunPlay())
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
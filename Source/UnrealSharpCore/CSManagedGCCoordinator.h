@@ -0,0 +1,43 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UWorld;
+
+/**
+ * Moves .NET collections out of gameplay frames and into the windows where Unreal already hitches.
+ * While a game world is playing the managed heap runs inside a no GC region with a fixed budget. When Unreal has
+ * purged its garbage, or a map has been loaded, the region is ended, the managed heap is collected to a depth picked
+ * from the GC pressure level and a new region is started. If gameplay allocates more than the budget, the runtime
+ * leaves the region on its own and collects as usual until the next window.
+ */
+class UNREALSHARPCORE_API FCSManagedGCCoordinator
+{
+public:
+	void Initialize(int64 InNoGCRegionBudget);
+	void Shutdown();
+
+	// Called once the handles of the objects Unreal purged have been disposed, so their C# counterparts are collectable.
+	void OnGarbagePurged();
+
+	bool IsActive() const { return NoGCRegionBudget > 0; }
+
+private:
+
+	void OnPreLoadMap(const FString& MapName);
+	void OnPostLoadMap(UWorld* World);
+
+	void CollectAndEnterNoGCRegion(int32 Generation, bool bCompact);
+	void ExitNoGCRegion();
+
+	// Collection depth for the current pressure: gen0 when low, gen1 when moderate, a full collection otherwise.
+	static int32 GetCollectionGeneration(bool& bOutCompact);
+	static bool IsPlayingGame();
+
+	int64 NoGCRegionBudget = 0;
+	bool bInNoGCRegion = false;
+	bool bIsLoadingMap = false;
+
+	FDelegateHandle PreLoadMapHandle;
+	FDelegateHandle PostLoadMapHandle;
+};
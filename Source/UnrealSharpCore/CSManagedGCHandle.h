@@ -28,57 +28,68 @@ struct FGCHandleIntPtr
 
 static_assert(sizeof(FGCHandleIntPtr) == sizeof(void *));
 
+/**
+ * A GC handle along with its type, packed into one pointer-sized word so tables of handles stay dense.
+ * The type lives in the top byte. CoreCLR handles are addresses in the user half of the address space and
+ * Mono handles are small integers, so those bits are always free. The low bits aren't, Mono tags its handles there.
+ */
 struct FGCHandle
 {
-	FGCHandleIntPtr Handle;
-	GCHandleType Type = GCHandleType::Null;
+	static FGCHandle Null() { return FGCHandle(); }
 
-	static FGCHandle Null() { return FGCHandle(nullptr, GCHandleType::Null); }
+	bool IsNull() const { return GetPointer() == nullptr; }
+	bool IsWeakPointer() const { return GetType() == GCHandleType::WeakHandle; }
 
-	bool IsNull() const { return !Handle.IntPtr; }
-	bool IsWeakPointer() const { return Type == GCHandleType::WeakHandle; }
+	GCHandleType GetType() const { return static_cast<GCHandleType>(PackedHandle >> TypeShift); }
+	void SetType(const GCHandleType InType) { PackedHandle = Pack(GetPointer(), InType); }
 	
-	FGCHandleIntPtr GetHandle() const { return Handle; }
-	uint8* GetPointer() const { return Handle.IntPtr; };
+	FGCHandleIntPtr GetHandle() const
+	{
+		FGCHandleIntPtr Handle;
+		Handle.IntPtr = GetPointer();
+		return Handle;
+	}
+	
+	uint8* GetPointer() const { return reinterpret_cast<uint8*>(static_cast<UPTRINT>(PackedHandle & PointerMask)); }
 	
 	void Dispose(FGCHandleIntPtr AssemblyHandle = FGCHandleIntPtr())
 	{
-		if (!Handle.IntPtr || Type == GCHandleType::Null)
+		if (IsNull() || GetType() == GCHandleType::Null)
 		{
 			return;
 		}
 
-		FCSManagedCallbacks::ManagedCallbacks.Dispose(Handle, AssemblyHandle);
-	
-		Handle.IntPtr = nullptr;
-		Type = GCHandleType::Null;
-	}
-
-	void operator = (const FGCHandle& Other)
-	{
-		Handle = Other.Handle;
-		Type = Other.Type;
+		FCSManagedCallbacks::ManagedCallbacks.Dispose(GetHandle(), AssemblyHandle);
+		PackedHandle = 0;
 	}
 	
 	operator void*() const
 	{
-		return Handle.IntPtr;
+		return GetPointer();
 	}
 
-	FGCHandle(){}
-	FGCHandle(const FGCHandleIntPtr InHandle, const GCHandleType InType) : Handle(InHandle), Type(InType) {}
+	FGCHandle() = default;
+	FGCHandle(const FGCHandleIntPtr InHandle, const GCHandleType InType) : PackedHandle(Pack(InHandle.IntPtr, InType)) {}
+	FGCHandle(uint8* InHandle, const GCHandleType InType) : PackedHandle(Pack(InHandle, InType)) {}
+	FGCHandle(const FGCHandleIntPtr InHandle) : PackedHandle(Pack(InHandle.IntPtr, GCHandleType::Null)) {}
 
-	FGCHandle(uint8* InHandle, const GCHandleType InType) : Type(InType)
-	{
-		Handle.IntPtr = InHandle;
-	}
+private:
 
-	FGCHandle(const FGCHandleIntPtr InHandle) : Handle(InHandle)
+	static constexpr uint64 TypeShift = 56;
+	static constexpr uint64 PointerMask = (uint64(1) << TypeShift) - 1;
+
+	static uint64 Pack(uint8* Pointer, const GCHandleType Type)
 	{
-		Type = GCHandleType::Null;
+		const uint64 Address = static_cast<uint64>(reinterpret_cast<UPTRINT>(Pointer));
+		checkSlow((Address & ~PointerMask) == 0);
+		return Address | (static_cast<uint64>(static_cast<uint8>(Type)) << TypeShift);
 	}
+
+	uint64 PackedHandle = 0;
 };
 
+static_assert(sizeof(FGCHandle) == sizeof(void*), "FGCHandle is packed into one word, see the comment above it.");
+
 struct FScopedGCHandle
 {
     
@@ -0,0 +1,151 @@
+#include "CSManagedHandleStore.h"
+#include "CSInteropAllocationTracker.h"
+#include "CSInteropFrameCounters.h"
+
+FGCHandle* FCSManagedHandleStore::Allocate(const FGCHandle& Handle)
+{
+	FScopeLock ScopeLock(&Lock);
+
+	int32 SlotIndex;
+	if (FirstFree != INDEX_NONE)
+	{
+		SlotIndex = FirstFree;
+		FirstFree = Chunks[SlotIndex / NumSlotsPerChunk][SlotIndex % NumSlotsPerChunk].NextFree;
+	}
+	else
+	{
+		SlotIndex = NumUsedSlots++;
+		if (SlotIndex / NumSlotsPerChunk >= Chunks.Num())
+		{
+			FSlot* NewChunk = Chunks.Add_GetRef(MakeUnique<FSlot[]>(NumSlotsPerChunk)).Get();
+			CS_TRACK_INTEROP_ALLOCATION("FCSManagedHandleStore", "AllocateChunk", sizeof(FSlot) * NumSlotsPerChunk);
+			for (int32 i = 0; i < NumSlotsPerChunk; ++i)
+			{
+				NewChunk[i].Store = this;
+			}
+		}
+	}
+
+	// NextFree doubles as the index of the slot while it's in use.
+	FSlot* Slot = &Chunks[SlotIndex / NumSlotsPerChunk][SlotIndex % NumSlotsPerChunk];
+	Slot->NextFree = SlotIndex;
+	Slot->Handle = Handle;
+	Slot->bInUse = true;
+	++NumHandles;
+	CS_COUNT_HANDLE_CREATED();
+	
+	return &Slot->Handle;
+}
+
+void FCSManagedHandleStore::Free(FGCHandle* Handle)
+{
+	if (!Handle)
+	{
+		return;
+	}
+	
+	FSlot* Slot = reinterpret_cast<FSlot*>(Handle);
+	if (Slot->Store != this)
+	{
+		Slot->Store->Free(Handle);
+		return;
+	}
+	
+	FScopeLock ScopeLock(&Lock);
+	
+	if (!Slot->bInUse)
+	{
+		// Already released by DisposeAll, the slot belongs to a retired chunk.
+		return;
+	}
+
+	const int32 SlotIndex = Slot->NextFree;
+	Slot->Handle = FGCHandle::Null();
+	Slot->bInUse = false;
+	Slot->NextFree = FirstFree;
+	FirstFree = SlotIndex;
+	--NumHandles;
+	CS_COUNT_HANDLES_DISPOSED(1);
+}
+
+void FCSManagedHandleStore::DisposeAll(FGCHandleIntPtr AssemblyHandle)
+{
+	FScopeLock ScopeLock(&Lock);
+
+	// Handle and assembly pairs, disposed in one managed call instead of one per handle.
+	TArray<FGCHandleIntPtr> Batch;
+	Batch.Reserve(NumHandles * 2);
+
+	for (TUniquePtr<FSlot[]>& Chunk : Chunks)
+	{
+		for (int32 i = 0; i < NumSlotsPerChunk; ++i)
+		{
+			FSlot& Slot = Chunk[i];
+			if (!Slot.bInUse)
+			{
+				continue;
+			}
+
+			if (!Slot.Handle.IsNull() && Slot.Handle.GetType() != GCHandleType::Null)
+			{
+				Batch.Add(Slot.Handle.GetHandle());
+				Batch.Add(AssemblyHandle);
+			}
+
+			Slot.Handle = FGCHandle::Null();
+			Slot.bInUse = false;
+		}
+	}
+
+	if (!Batch.IsEmpty())
+	{
+		FCSManagedCallbacks::ManagedCallbacks.DisposeHandles(Batch.GetData(), Batch.Num() / 2);
+	}
+
+	CS_COUNT_HANDLES_DISPOSED(NumHandles);
+
+	RetiredChunks.Append(MoveTemp(Chunks));
+	Chunks.Reset();
+	
+	NumUsedSlots = 0;
+	FirstFree = INDEX_NONE;
+	NumHandles = 0;
+}
+
+FCSManagedHandleStore::FStats FCSManagedHandleStore::GetStats() const
+{
+	FScopeLock ScopeLock(&Lock);
+
+	FStats Stats;
+	Stats.AllocatedBytes = (Chunks.Num() + RetiredChunks.Num()) * NumSlotsPerChunk * sizeof(FSlot)
+		+ Chunks.GetAllocatedSize() + RetiredChunks.GetAllocatedSize();
+
+	for (const TUniquePtr<FSlot[]>& Chunk : Chunks)
+	{
+		for (int32 i = 0; i < NumSlotsPerChunk; ++i)
+		{
+			const FSlot& Slot = Chunk[i];
+			if (!Slot.bInUse)
+			{
+				continue;
+			}
+
+			switch (Slot.Handle.GetType())
+			{
+				case GCHandleType::StrongHandle:
+					++Stats.NumStrongHandles;
+					break;
+				case GCHandleType::WeakHandle:
+					++Stats.NumWeakHandles;
+					break;
+				case GCHandleType::PinnedHandle:
+					++Stats.NumPinnedHandles;
+					break;
+				default:
+					break;
+			}
+		}
+	}
+
+	return Stats;
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "CSManagedGCHandle.h"
+#include "Templates/UniquePtr.h"
+
+/**
+ * Slab of the GC handles owned by an assembly: type handles, method handles, objects and interface wrappers.
+ * Handles live in fixed size chunks, so the pointers handed out stay valid until the store is destroyed,
+ * and freed slots are recycled through a free list instead of going back to the allocator.
+ */
+class UNREALSHARPCORE_API FCSManagedHandleStore
+{
+public:
+	FCSManagedHandleStore() = default;
+
+	FCSManagedHandleStore(const FCSManagedHandleStore&) = delete;
+	FCSManagedHandleStore& operator=(const FCSManagedHandleStore&) = delete;
+
+	FGCHandle* Allocate(const FGCHandle& Handle);
+
+	// Returns the slot to the free list of the store that allocated it. The handle must already be disposed, or queued for disposal.
+	void Free(FGCHandle* Handle);
+
+	// Disposes every live handle. Pointers handed out so far keep pointing at null handles,
+	// their chunks are only released together with the store so stale holders never see a recycled slot.
+	void DisposeAll(FGCHandleIntPtr AssemblyHandle);
+
+	int32 Num() const { return NumHandles; }
+
+	struct FStats
+	{
+		int32 NumStrongHandles = 0;
+		int32 NumWeakHandles = 0;
+		int32 NumPinnedHandles = 0;
+
+		// Chunks in use and retired ones, which are only released together with the store.
+		SIZE_T AllocatedBytes = 0;
+	};
+
+	// Walks every slot, meant for reports rather than hot paths.
+	FStats GetStats() const;
+
+	// The managed assembly the handles belong to, which disposing them requires.
+	void SetAssemblyHandle(FGCHandleIntPtr InAssemblyHandle) { AssemblyHandle = InAssemblyHandle; }
+	FGCHandleIntPtr GetAssemblyHandle() const { return AssemblyHandle; }
+
+	// Finds the store that allocated the handle, without having to look up the owning assembly.
+	static FCSManagedHandleStore& GetOwningStore(const FGCHandle* Handle)
+	{
+		return *reinterpret_cast<const FSlot*>(Handle)->Store;
+	}
+
+private:
+
+	struct FSlot
+	{
+		// Must stay the first member, slots are found from the handle pointer.
+		FGCHandle Handle;
+		FCSManagedHandleStore* Store = nullptr;
+		int32 NextFree = INDEX_NONE;
+		bool bInUse = false;
+	};
+
+	static constexpr int32 NumSlotsPerChunk = 1024;
+
+	TArray<TUniquePtr<FSlot[]>> Chunks;
+	TArray<TUniquePtr<FSlot[]>> RetiredChunks;
+
+	int32 NumUsedSlots = 0;
+	int32 FirstFree = INDEX_NONE;
+	int32 NumHandles = 0;
+
+	FGCHandleIntPtr AssemblyHandle;
+
+	mutable FCriticalSection Lock;
+};
@@ -0,0 +1,70 @@
+#include "CSManagedJobs.h"
+#include "Async/ParallelFor.h"
+#include "CSHandleEpoch.h"
+#include "UnrealSharpCore.h"
+
+std::atomic<int32> FCSManagedJobs::NumInFlightJobs { 0 };
+
+FCSManagedJobs::FJob* FCSManagedJobs::Launch(FManagedJobEntryPoint EntryPoint, void* State, UE::Tasks::ETaskPriority Priority, TConstArrayView<FJob*> Prerequisites)
+{
+	TArray<UE::Tasks::FTask, TInlineAllocator<4>> PrerequisiteTasks;
+	for (const FJob* Prerequisite : Prerequisites)
+	{
+		PrerequisiteTasks.Add(Prerequisite->Task);
+	}
+
+	NumInFlightJobs.fetch_add(1, std::memory_order_relaxed);
+
+	FJob* Job = new FJob();
+	Job->Task = UE::Tasks::Launch(TEXT("UnrealSharp.ManagedJob"), [EntryPoint, State]()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FCSManagedJobs::RunJob);
+		FCSHandleEpoch::FReadScope HandleReadScope;
+		EntryPoint(State, 0, 0);
+		NumInFlightJobs.fetch_sub(1, std::memory_order_release);
+	}, UE::Tasks::Prerequisites(PrerequisiteTasks), Priority);
+
+	return Job;
+}
+
+void FCSManagedJobs::ParallelFor(FManagedJobEntryPoint EntryPoint, void* State, int32 Count, int32 MinBatchSize)
+{
+	if (Count <= 0)
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(FCSManagedJobs::ParallelFor);
+
+	// A few batches per worker keeps them busy when the items don't all cost the same.
+	const int32 MaxBatches = FMath::Max(FTaskGraphInterface::Get().GetNumWorkerThreads() * 4, 1);
+	const int32 NumBatches = FMath::Clamp(Count / FMath::Max(MinBatchSize, 1), 1, MaxBatches);
+
+	NumInFlightJobs.fetch_add(1, std::memory_order_relaxed);
+
+	::ParallelFor(TEXT("UnrealSharp.ManagedParallelFor"), NumBatches, 1, [EntryPoint, State, Count, NumBatches](int32 BatchIndex)
+	{
+		const int32 Start = static_cast<int64>(Count) * BatchIndex / NumBatches;
+		const int32 End = static_cast<int64>(Count) * (BatchIndex + 1) / NumBatches;
+		FCSHandleEpoch::FReadScope HandleReadScope;
+		EntryPoint(State, Start, End);
+	}, NumBatches == 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	NumInFlightJobs.fetch_sub(1, std::memory_order_release);
+}
+
+void FCSManagedJobs::WaitForInFlightJobs()
+{
+	if (NumInFlightJobs.load(std::memory_order_acquire) == 0)
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(FCSManagedJobs::WaitForInFlightJobs);
+	UE_LOG(LogUnrealSharp, Log, TEXT("Waiting for %d managed jobs to finish"), NumInFlightJobs.load(std::memory_order_relaxed));
+
+	while (NumInFlightJobs.load(std::memory_order_acquire) > 0)
+	{
+		FPlatformProcess::Yield();
+	}
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Tasks/Task.h"
+#include <atomic>
+
+/**
+ * Runs managed work on the task system's worker threads, without going through the game thread.
+ * Managed code hands over an unmanaged entry point and a state handle, the entry point is called with the state
+ * and the range of items to process. Single jobs get the range [0, 0).
+ * Assemblies must not unload while their code runs, UCSAssembly waits for the in-flight jobs first.
+ * Jobs run inside an FCSHandleEpoch read scope, so the handles they look up stay alive until they return.
+ */
+class UNREALSHARPCORE_API FCSManagedJobs
+{
+public:
+	using FManagedJobEntryPoint = void(*)(void* State, int32 Start, int32 End);
+
+	// Ref counted handle managed code holds on to, so it can wait for the job or use it as a prerequisite.
+	struct FJob
+	{
+		UE::Tasks::FTask Task;
+	};
+
+	static FJob* Launch(FManagedJobEntryPoint EntryPoint, void* State, UE::Tasks::ETaskPriority Priority, TConstArrayView<FJob*> Prerequisites);
+
+	// Splits [0, Count) into batches of at least MinBatchSize items and runs them across the workers.
+	// Returns once every batch has run, the calling thread helps out.
+	static void ParallelFor(FManagedJobEntryPoint EntryPoint, void* State, int32 Count, int32 MinBatchSize);
+
+	static void WaitForInFlightJobs();
+
+private:
+	static std::atomic<int32> NumInFlightJobs;
+};
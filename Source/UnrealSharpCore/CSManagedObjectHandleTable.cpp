@@ -0,0 +1,180 @@
+#include "CSManagedObjectHandleTable.h"
+
+FCSManagedObjectHandleTable::FCSManagedObjectHandleTable()
+{
+	NumChunks = FMath::DivideAndRoundUp(FMath::Max(GUObjectArray.GetObjectArrayCapacity(), 1), NumSlotsPerChunk);
+	Chunks = new std::atomic<FSlot*>[NumChunks];
+
+	for (int32 i = 0; i < NumChunks; ++i)
+	{
+		Chunks[i].store(nullptr, std::memory_order_relaxed);
+	}
+}
+
+FCSManagedObjectHandleTable::~FCSManagedObjectHandleTable()
+{
+	for (int32 i = 0; i < NumChunks; ++i)
+	{
+		delete[] Chunks[i].load(std::memory_order_relaxed);
+	}
+
+	delete[] Chunks;
+}
+
+FCSManagedObjectHandleTable::FScopedWriteLock::FScopedWriteLock(FCSManagedObjectHandleTable& InTable)
+	: Table(InTable)
+{
+	if (!Table.WriteLock.TryLock())
+	{
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		Table.WriteLock.Lock();
+
+		Table.NumContendedWrites.fetch_add(1, std::memory_order_relaxed);
+		Table.WriteLockWaitCycles.fetch_add(FPlatformTime::Cycles64() - StartCycles, std::memory_order_relaxed);
+	}
+
+	Table.NumWrites.fetch_add(1, std::memory_order_relaxed);
+}
+
+SIZE_T FCSManagedObjectHandleTable::GetAllocatedSize() const
+{
+	SIZE_T AllocatedSize = NumChunks * sizeof(std::atomic<FSlot*>);
+	for (int32 i = 0; i < NumChunks; ++i)
+	{
+		if (Chunks[i].load(std::memory_order_acquire))
+		{
+			AllocatedSize += NumSlotsPerChunk * sizeof(FSlot);
+		}
+	}
+
+	return AllocatedSize;
+}
+
+void FCSManagedObjectHandleTable::Add(const UObjectBase* Object, FGCHandle* Handle, bool* bOutHadInterfaceWrappers)
+{
+	const int32 ObjectIndex = GUObjectArray.ObjectToIndex(Object);
+	const int32 SerialNumber = GUObjectArray.AllocateSerialNumber(ObjectIndex);
+
+	FScopedWriteLock Lock(*this);
+	FSlot& Slot = GetOrAllocateSlot(ObjectIndex);
+
+	// Readers check the handle first, so clear it while the serial number is out of sync.
+	if (!Slot.Handle.exchange(nullptr, std::memory_order_acq_rel))
+	{
+		NumHandles.fetch_add(1, std::memory_order_relaxed);
+	}
+	
+	Slot.SerialNumber.store(SerialNumber, std::memory_order_relaxed);
+	const bool bHadInterfaceWrappers = Slot.bHasInterfaceWrappers.exchange(false, std::memory_order_relaxed);
+	Slot.Handle.store(Handle, std::memory_order_release);
+
+	if (bOutHadInterfaceWrappers)
+	{
+		*bOutHadInterfaceWrappers = bHadInterfaceWrappers;
+	}
+}
+
+FGCHandle* FCSManagedObjectHandleTable::Remove(int32 ObjectIndex, bool* bOutHadInterfaceWrappers)
+{
+	return RemoveIfUnchanged(ObjectIndex, nullptr, bOutHadInterfaceWrappers);
+}
+
+FGCHandle* FCSManagedObjectHandleTable::RemoveIfUnchanged(int32 ObjectIndex, const FGCHandle* ExpectedHandle, bool* bOutHadInterfaceWrappers)
+{
+	if (bOutHadInterfaceWrappers)
+	{
+		*bOutHadInterfaceWrappers = false;
+	}
+	
+	const FSlot* ConstSlot = GetSlot(ObjectIndex);
+
+	// Most deleted objects never had a C# counterpart, don't lock for those.
+	if (!ConstSlot || !ConstSlot->Handle.load(std::memory_order_acquire))
+	{
+		return nullptr;
+	}
+
+	FScopedWriteLock Lock(*this);
+	FSlot& Slot = const_cast<FSlot&>(*ConstSlot);
+
+	if (ExpectedHandle && Slot.Handle.load(std::memory_order_relaxed) != ExpectedHandle)
+	{
+		return nullptr;
+	}
+
+	FGCHandle* Handle = Slot.Handle.exchange(nullptr, std::memory_order_acq_rel);
+	if (!Handle)
+	{
+		return nullptr;
+	}
+
+	Slot.SerialNumber.store(0, std::memory_order_relaxed);
+	NumHandles.fetch_sub(1, std::memory_order_relaxed);
+
+	const bool bHadInterfaceWrappers = Slot.bHasInterfaceWrappers.exchange(false, std::memory_order_acq_rel);
+	if (bOutHadInterfaceWrappers)
+	{
+		*bOutHadInterfaceWrappers = bHadInterfaceWrappers;
+	}
+
+	return Handle;
+}
+
+void FCSManagedObjectHandleTable::MarkHasInterfaceWrappers(const UObjectBase* Object)
+{
+	const int32 ObjectIndex = GUObjectArray.ObjectToIndex(Object);
+	const FSlot* Slot = GetSlot(ObjectIndex);
+	check(Slot);
+	
+	const_cast<FSlot*>(Slot)->bHasInterfaceWrappers.store(true, std::memory_order_release);
+}
+
+int32 FCSManagedObjectHandleTable::VisitSlots(int32 StartIndex, int32 MaxSlots, TFunctionRef<void(int32 ObjectIndex, FGCHandle* Handle, bool bIsStale)> Visitor) const
+{
+	int32 ObjectIndex = FMath::Max(StartIndex, 0);
+	int32 NumVisited = 0;
+
+	while (NumVisited < MaxSlots)
+	{
+		const int32 ChunkIndex = ObjectIndex / NumSlotsPerChunk;
+		if (ChunkIndex >= NumChunks)
+		{
+			return 0;
+		}
+
+		const FSlot* Chunk = Chunks[ChunkIndex].load(std::memory_order_acquire);
+		if (!Chunk)
+		{
+			ObjectIndex = (ChunkIndex + 1) * NumSlotsPerChunk;
+			++NumVisited;
+			continue;
+		}
+
+		const FSlot& Slot = Chunk[ObjectIndex % NumSlotsPerChunk];
+		if (FGCHandle* Handle = Slot.Handle.load(std::memory_order_acquire))
+		{
+			const bool bIsStale = Slot.SerialNumber.load(std::memory_order_relaxed) != GetObjectSerialNumber(ObjectIndex);
+			Visitor(ObjectIndex, Handle, bIsStale);
+		}
+
+		++ObjectIndex;
+		++NumVisited;
+	}
+
+	return ObjectIndex;
+}
+
+FCSManagedObjectHandleTable::FSlot& FCSManagedObjectHandleTable::GetOrAllocateSlot(int32 ObjectIndex)
+{
+	const int32 ChunkIndex = ObjectIndex / NumSlotsPerChunk;
+	check(ChunkIndex >= 0 && ChunkIndex < NumChunks);
+
+	FSlot* Chunk = Chunks[ChunkIndex].load(std::memory_order_acquire);
+	if (!Chunk)
+	{
+		Chunk = new FSlot[NumSlotsPerChunk];
+		Chunks[ChunkIndex].store(Chunk, std::memory_order_release);
+	}
+
+	return Chunk[ObjectIndex % NumSlotsPerChunk];
+}
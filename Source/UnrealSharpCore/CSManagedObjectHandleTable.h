@@ -0,0 +1,153 @@
+#pragma once
+
+#include "CSManagedGCHandle.h"
+#include "UObject/UObjectArray.h"
+#include <atomic>
+
+/**
+ * Flat table of the C# counterparts of UObjects, addressed by the GUObjectArray index of the object.
+ * Lookups are lock-free. Every slot remembers the serial number of the object it was registered for,
+ * so a slot that is left behind when an index gets recycled is never handed out to the new object.
+ * Writers only lock when a slot is actually occupied, so deleting objects without a C# counterpart is free.
+ */
+class UNREALSHARPCORE_API FCSManagedObjectHandleTable
+{
+public:
+	FCSManagedObjectHandleTable();
+	~FCSManagedObjectHandleTable();
+
+	FCSManagedObjectHandleTable(const FCSManagedObjectHandleTable&) = delete;
+	FCSManagedObjectHandleTable& operator=(const FCSManagedObjectHandleTable&) = delete;
+
+	FGCHandle* Find(const UObjectBase* Object) const
+	{
+		return FindByIndex(GUObjectArray.ObjectToIndex(Object));
+	}
+
+	FGCHandle* FindByIndex(int32 ObjectIndex) const
+	{
+		const FSlot* Slot = GetSlot(ObjectIndex);
+		if (!Slot)
+		{
+			return nullptr;
+		}
+
+		FGCHandle* Handle = Slot->Handle.load(std::memory_order_acquire);
+		if (!Handle || Slot->SerialNumber.load(std::memory_order_relaxed) != GetObjectSerialNumber(ObjectIndex))
+		{
+			return nullptr;
+		}
+
+		return Handle;
+	}
+
+	// Registers the handle for the object. Replaces any handle previously registered at the same index.
+	// The handle is owned by the handle store of its assembly, the table only points at it.
+	// bOutHadInterfaceWrappers tells whether the slot was flagged for interface wrappers, which belong to the previous object and need to be released.
+	void Add(const UObjectBase* Object, FGCHandle* Handle, bool* bOutHadInterfaceWrappers = nullptr);
+
+	// Removes the handle registered at the index, if any. Returns the handle so the caller can dispose and free it.
+	// bOutHadInterfaceWrappers tells whether the object got any interface wrappers, which need to be released as well.
+	FGCHandle* Remove(int32 ObjectIndex, bool* bOutHadInterfaceWrappers = nullptr);
+
+	// Same as Remove, but only if the slot still holds ExpectedHandle. For callers that looked at the slot without holding the lock.
+	FGCHandle* RemoveIfUnchanged(int32 ObjectIndex, const FGCHandle* ExpectedHandle, bool* bOutHadInterfaceWrappers = nullptr);
+
+	// Visits the occupied slots from StartIndex on, until MaxSlots slots have been looked at. Chunks that were never allocated count as one slot.
+	// bIsStale is set when the object the handle was registered for is gone. Returns the index to continue from, 0 once the end is reached.
+	int32 VisitSlots(int32 StartIndex, int32 MaxSlots, TFunctionRef<void(int32 ObjectIndex, FGCHandle* Handle, bool bIsStale)> Visitor) const;
+
+	// Flags the object as having interface wrappers. The object must have a handle registered.
+	void MarkHasInterfaceWrappers(const UObjectBase* Object);
+
+	bool HasInterfaceWrappers(const UObjectBase* Object) const
+	{
+		const int32 ObjectIndex = GUObjectArray.ObjectToIndex(Object);
+		const FSlot* Slot = GetSlot(ObjectIndex);
+		return Slot && Slot->bHasInterfaceWrappers.load(std::memory_order_acquire) && FindByIndex(ObjectIndex);
+	}
+
+	int32 Num() const { return NumHandles.load(std::memory_order_relaxed); }
+
+	// Memory of the chunk pointers and of the chunks allocated so far.
+	SIZE_T GetAllocatedSize() const;
+
+	// How often writers took the lock since the table was created, and how often and how long they waited for another writer.
+	struct FWriteLockStats
+	{
+		int64 NumWrites = 0;
+		int64 NumContendedWrites = 0;
+		uint64 WaitCycles = 0;
+	};
+
+	FWriteLockStats GetWriteLockStats() const
+	{
+		FWriteLockStats Stats;
+		Stats.NumWrites = NumWrites.load(std::memory_order_relaxed);
+		Stats.NumContendedWrites = NumContendedWrites.load(std::memory_order_relaxed);
+		Stats.WaitCycles = WriteLockWaitCycles.load(std::memory_order_relaxed);
+		return Stats;
+	}
+
+private:
+
+	struct FSlot
+	{
+		std::atomic<FGCHandle*> Handle { nullptr };
+		std::atomic<int32> SerialNumber { 0 };
+		std::atomic<bool> bHasInterfaceWrappers { false };
+	};
+
+	static constexpr int32 NumSlotsPerChunk = 64 * 1024;
+
+	const FSlot* GetSlot(int32 ObjectIndex) const
+	{
+		if (ObjectIndex < 0)
+		{
+			return nullptr;
+		}
+
+		const int32 ChunkIndex = ObjectIndex / NumSlotsPerChunk;
+		if (ChunkIndex >= NumChunks)
+		{
+			return nullptr;
+		}
+
+		const FSlot* Chunk = Chunks[ChunkIndex].load(std::memory_order_acquire);
+		return Chunk ? &Chunk[ObjectIndex % NumSlotsPerChunk] : nullptr;
+	}
+
+	FSlot& GetOrAllocateSlot(int32 ObjectIndex);
+
+	// Takes WriteLock, only looking at the clock when another writer holds it.
+	class FScopedWriteLock
+	{
+	public:
+		explicit FScopedWriteLock(FCSManagedObjectHandleTable& InTable);
+		~FScopedWriteLock() { Table.WriteLock.Unlock(); }
+
+		UE_NONCOPYABLE(FScopedWriteLock);
+
+	private:
+		FCSManagedObjectHandleTable& Table;
+	};
+
+	static int32 GetObjectSerialNumber(int32 ObjectIndex)
+	{
+		const FUObjectItem* ObjectItem = GUObjectArray.IndexToObject(ObjectIndex);
+		return ObjectItem ? ObjectItem->GetSerialNumber() : 0;
+	}
+
+	// Chunk pointers are published once and never move, so readers don't need a lock to walk them.
+	// Sized for the capacity of GUObjectArray up front.
+	std::atomic<FSlot*>* Chunks = nullptr;
+	int32 NumChunks = 0;
+
+	std::atomic<int32> NumHandles { 0 };
+
+	FCriticalSection WriteLock;
+
+	std::atomic<int64> NumWrites { 0 };
+	std::atomic<int64> NumContendedWrites { 0 };
+	std::atomic<uint64> WriteLockWaitCycles { 0 };
+};
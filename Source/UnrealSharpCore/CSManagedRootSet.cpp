@@ -0,0 +1,51 @@
+#include "CSManagedRootSet.h"
+
+FCSManagedRootSet& FCSManagedRootSet::Get()
+{
+	// Never destroyed, managed finalizers may still remove roots while the engine shuts down.
+	static FCSManagedRootSet* Instance = new FCSManagedRootSet();
+	return *Instance;
+}
+
+int32 FCSManagedRootSet::Add(UObject* Object)
+{
+	FScopeLock ScopeLock(&Lock);
+
+	if (FreeIndices.IsEmpty())
+	{
+		return Objects.Add(Object);
+	}
+
+	const int32 Index = FreeIndices.Pop();
+	Objects[Index] = Object;
+	return Index;
+}
+
+void FCSManagedRootSet::Remove(int32 Index)
+{
+	FScopeLock ScopeLock(&Lock);
+
+	// The slot may already be null, the collector clears references to objects marked as garbage.
+	check(Objects.IsValidIndex(Index));
+	Objects[Index] = nullptr;
+	FreeIndices.Add(Index);
+}
+
+UObject* FCSManagedRootSet::GetObject(int32 Index) const
+{
+	FScopeLock ScopeLock(&Lock);
+	check(Objects.IsValidIndex(Index));
+	return Objects[Index];
+}
+
+int32 FCSManagedRootSet::Num() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return Objects.Num() - FreeIndices.Num();
+}
+
+void FCSManagedRootSet::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	FScopeLock ScopeLock(&Lock);
+	Collector.AddReferencedObjects(Objects);
+}
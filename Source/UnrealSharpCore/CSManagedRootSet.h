@@ -0,0 +1,34 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/GCObject.h"
+
+/**
+ * Objects kept alive by managed code, in one array reported to the garbage collector in a single pass instead of one
+ * FGCObject per TStrongObjectPtr. Slots are reused through a free list, so adding and removing a root is O(1).
+ * Thread safe, managed finalizers remove their roots from the finalizer thread.
+ */
+class UNREALSHARPCORE_API FCSManagedRootSet : public FGCObject
+{
+public:
+	static FCSManagedRootSet& Get();
+
+	// Returns the slot of the root, to pass to Remove.
+	int32 Add(UObject* Object);
+	void Remove(int32 Index);
+
+	// Null once the object was marked as garbage and collected.
+	UObject* GetObject(int32 Index) const;
+
+	int32 Num() const;
+
+	// FGCObject interface implementation
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+	virtual FString GetReferencerName() const override { return TEXT("FCSManagedRootSet"); }
+	// End of implementation
+
+private:
+	mutable FCriticalSection Lock;
+	TArray<TObjectPtr<UObject>> Objects;
+	TArray<int32> FreeIndices;
+};
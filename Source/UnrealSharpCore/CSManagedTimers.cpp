@@ -0,0 +1,109 @@
+#include "CSManagedTimers.h"
+#include "CSManagedDelegate.h"
+#include "Engine/World.h"
+#include "Logging/StructuredLog.h"
+#include "TimerManager.h"
+#include "UnrealSharpCore.h"
+
+namespace
+{
+	struct FManagedTimer
+	{
+		FCSManagedDelegate Delegate;
+		TWeakObjectPtr<UObject> WorldContextObject;
+		TWeakObjectPtr<UWorld> World;
+		FTimerHandle Handle;
+
+		FManagedTimer(FGCHandleIntPtr DelegateHandle, UObject* InWorldContextObject, UWorld* InWorld);
+		~FManagedTimer();
+
+		void Fire();
+	};
+
+	// Every timer the timer managers still hold on to.
+	TSet<FManagedTimer*> ActiveTimers;
+
+	FManagedTimer::FManagedTimer(FGCHandleIntPtr DelegateHandle, UObject* InWorldContextObject, UWorld* InWorld)
+		: Delegate(FGCHandle(DelegateHandle, GCHandleType::StrongHandle))
+		, WorldContextObject(InWorldContextObject)
+		, World(InWorld)
+	{
+		ActiveTimers.Add(this);
+	}
+
+	FManagedTimer::~FManagedTimer()
+	{
+		ActiveTimers.Remove(this);
+		Delegate.Dispose();
+	}
+
+	void FManagedTimer::Fire()
+	{
+		UObject* Object = WorldContextObject.Get();
+		if (!Object)
+		{
+			// Like a timer bound to a UFunction of an object that is gone.
+			if (UWorld* TimerWorld = World.Get())
+			{
+				TimerWorld->GetTimerManager().ClearTimer(Handle);
+			}
+			return;
+		}
+
+		Delegate.Invoke(Object, false);
+	}
+}
+
+FTimerHandle FCSManagedTimers::SetTimer(UObject* WorldContextObject, FGCHandleIntPtr DelegateHandle, float Rate, bool bLoop, float InitialDelay)
+{
+	check(IsInGameThread());
+
+	UWorld* World = IsValid(WorldContextObject) ? WorldContextObject->GetWorld() : nullptr;
+	TSharedRef<FManagedTimer> Timer = MakeShared<FManagedTimer>(DelegateHandle, WorldContextObject, World);
+
+	if (!World)
+	{
+		return FTimerHandle();
+	}
+
+	// The timer manager destroys the delegate, and with it the last reference to the timer, once the timer is done.
+	FTimerDelegate Delegate = FTimerDelegate::CreateLambda([Timer]
+	{
+		// Clearing the timer from its own callback destroys this lambda while it runs.
+		TSharedRef<FManagedTimer> FiringTimer = Timer;
+		FiringTimer->Fire();
+	});
+
+	// Same first delay as K2_SetTimerDelegate, the initial delay comes on top of the rate.
+	World->GetTimerManager().SetTimer(Timer->Handle, MoveTemp(Delegate), Rate, bLoop, Rate + FMath::Max(InitialDelay, 0.0f));
+	return Timer->Handle;
+}
+
+void FCSManagedTimers::ClearAll()
+{
+	check(IsInGameThread());
+
+	if (ActiveTimers.IsEmpty())
+	{
+		return;
+	}
+
+	UE_LOGFMT(LogUnrealSharp, Verbose, "Clearing {0} managed timers", ActiveTimers.Num());
+
+	// Clearing a timer destroys it, which removes it from the set.
+	for (FManagedTimer* Timer : ActiveTimers.Array())
+	{
+		// The timer manager may hold on to a timer that is firing right now, free the delegate regardless.
+		Timer->Delegate.Dispose();
+
+		if (UWorld* World = Timer->World.Get())
+		{
+			World->GetTimerManager().ClearTimer(Timer->Handle);
+		}
+	}
+}
+
+int32 FCSManagedTimers::Num()
+{
+	return ActiveTimers.Num();
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CSManagedGCHandle.h"
+
+struct FTimerHandle;
+
+/**
+ * Timers that call a managed delegate straight from an FTimerDelegate, with no UFunction lookup or FFrame per fire.
+ * The timer owns the delegate handle and frees it once the timer manager lets go of it: when the timer is cleared,
+ * after the last fire of a timer that doesn't loop, or when the world context object is gone. Game thread only.
+ */
+class UNREALSHARPCORE_API FCSManagedTimers
+{
+public:
+	static FTimerHandle SetTimer(UObject* WorldContextObject, FGCHandleIntPtr DelegateHandle, float Rate, bool bLoop, float InitialDelay);
+
+	// Clears every managed timer and frees its delegate, the delegates keep the assemblies they come from loaded.
+	static void ClearAll();
+
+	static int32 Num();
+};
@@ -6,12 +6,14 @@
 #include "Misc/Paths.h"
 #include "Misc/App.h"
 #include "UObject/Object.h"
+#include "UObject/UObjectIterator.h"
 #include "Misc/MessageDialog.h"
 #include "Engine/Blueprint.h"
 #include "UnrealSharpProcHelper/CSProcHelper.h"
 #include <vector>
 #include "CSBindsManager.h"
 #include "CSNamespace.h"
+#include "CSStartupReport.h"
 #include "CSUnrealSharpSettings.h"
 #include "Logging/StructuredLog.h"
 #include "TypeGenerator/CSInterface.h"
@@ -20,8 +22,26 @@
 #include "TypeGenerator/Register/TypeInfo/CSClassInfo.h"
 #include "GCOptimizations/CSObjectSafetyValidator.h"
 #include "GCOptimizations/CSObjectManager.h"
+#include "GCOptimizations/CSGCPressureMonitor.h"
+#include "CSInteropAllocationTracker.h"
+#include "CSInteropFrameCounters.h"
+#include "CSHandleMemoryReport.h"
+#include "CSManagedCallProfiler.h"
+#include "CSAssemblyBudgets.h"
+#include "CSGameThreadContinuations.h"
+#include "CSManagedTimers.h"
+#include "CSBatchedTick.h"
+#include "CSFieldNotifyBatcher.h"
+#include "CSInterfaceDispatchCache.h"
+#include "CSPIEWarmStart.h"
+#include "CSDeferredManagedObjects.h"
+#include "Tasks/Task.h"
 #include "Utils/CSClassUtilities.h"
 
+#if WITH_MONO_RUNTIME && PLATFORM_ANDROID
+#include "Android/UnrealSharp_Android_JITWarmUp.h"
+#endif
+
 #ifdef _WIN32
 	#define PLATFORM_STRING(string) string
 #elif defined(__unix__)
@@ -35,6 +55,26 @@
 #endif
 
 UCSManager* UCSManager::Instance = nullptr;
+thread_local UObject* GCSInvokeWorldContext = nullptr;
+
+namespace
+{
+	// Only written when the world context is set explicitly or read during a call, see GetCurrentWorldContext.
+	thread_local TWeakObjectPtr<UObject> GCSLastWorldContext;
+
+	int32 GetExportedFunctionsWithStartupPhase(FCSExportedFunctionEntry* OutEntries, int32 MaxEntries)
+	{
+		FCSScopedStartupPhase ResolveBindsPhase(TEXT("ResolveBinds"));
+		return FCSBindsManager::GetExportedFunctions(OutEntries, MaxEntries);
+	}
+
+	// Same as FCSBindsManager::GetBindsCallbacks, with the export table lookup showing up in the startup report.
+	const FCSBindsCallbacks& GetStartupBindsCallbacks()
+	{
+		static const FCSBindsCallbacks BindsCallbacks { &FCSBindsManager::GetBoundFunction, &GetExportedFunctionsWithStartupPhase };
+		return BindsCallbacks;
+	}
+}
 
 UPackage* UCSManager::FindOrAddManagedPackage(const FCSNamespace Namespace)
 {
@@ -43,6 +83,11 @@ UPackage* UCSManager::FindOrAddManagedPackage(const FCSNamespace Namespace)
 		return NativePackage;
 	}
 
+	if (UPackage* const* CachedPackage = NamespaceToPackage.Find(Namespace.GetFName()))
+	{
+		return *CachedPackage;
+	}
+
 	FCSNamespace CurrentNamespace = Namespace;
 	TArray<FCSNamespace> ParentNamespaces;
 	while (true)
@@ -61,13 +106,9 @@ UPackage* UCSManager::FindOrAddManagedPackage(const FCSNamespace Namespace)
 		FCSNamespace ParentNamespace = ParentNamespaces[i];
 		FName PackageName = ParentNamespace.GetPackageName();
 
-		for (UPackage* Package : AllPackages)
+		if (UPackage* const* Package = PackageNameToPackage.Find(PackageName))
 		{
-			if (PackageName == Package->GetFName())
-			{
-				ParentPackage = Package;
-				break;
-			}
+			ParentPackage = *Package;
 		}
 
 		if (!ParentPackage)
@@ -75,22 +116,26 @@ UPackage* UCSManager::FindOrAddManagedPackage(const FCSNamespace Namespace)
 			ParentPackage = NewObject<UPackage>(nullptr, PackageName, RF_Public);
 			ParentPackage->SetPackageFlags(PKG_CompiledIn);
 			AllPackages.Add(ParentPackage);
+			ManagedPackages.Add(ParentPackage);
+			PackageNameToPackage.Add(PackageName, ParentPackage);
 		}
 	}
 
+	NamespaceToPackage.Add(Namespace.GetFName(), ParentPackage);
 	return ParentPackage;
 }
 
-void UCSManager::ForEachManagedField(const TFunction<void(UObject*)>& Callback) const
+void UCSManager::RegisterManagedField(UField* Field)
 {
-	for (UPackage* Package : AllPackages)
+	TArray<TWeakObjectPtr<UField>>& Fields = ManagedFieldsByPackage.FindOrAdd(Field->GetPackage());
+
+	// Only pruned when the list is about to grow, which keeps registering amortized constant.
+	if (Fields.Num() == Fields.Max())
 	{
-		ForEachObjectWithPackage(Package, [&Callback](UObject* Object)
-		{
-			Callback(Object);
-			return true;
-		}, false);
+		Fields.RemoveAll([](const TWeakObjectPtr<UField>& WeakField) { return !WeakField.IsValid(); });
 	}
+
+	Fields.Add(Field);
 }
 
 UPackage* UCSManager::GetPackage(const FCSNamespace Namespace)
@@ -140,6 +185,9 @@ void UCSManager::AddDynamicSubsystemClass(TSubclassOf<UDynamicSubsystem> Subsyst
 
 void UCSManager::Initialize()
 {
+	// Starts the clock of the startup report.
+	FCSStartupReport& StartupReport = FCSStartupReport::Get();
+	
 #if WITH_EDITOR
 	FString DotNetInstallationPath = FCSProcHelper::GetDotNetDirectory();
 	if (DotNetInstallationPath.IsEmpty())
@@ -166,10 +214,11 @@ void UCSManager::Initialize()
 	FCSProcHelper::GetAllProjectPaths(ProjectPaths);
 
 	// Compile the C# project for any changes done outside the editor.
-	if (!ProjectPaths.IsEmpty() && !FApp::IsUnattended() && !FCSProcHelper::InvokeUnrealSharpBuildTool(BUILD_ACTION_BUILD_WEAVE))
+	// The build runs in the background while the runtime starts, and is waited for before the user assemblies are loaded.
+	TFuture<FCSCommandResult> PendingBuild;
+	if (!ProjectPaths.IsEmpty() && !FApp::IsUnattended())
 	{
-		Initialize();
-		return;
+		PendingBuild = FCSProcHelper::InvokeUnrealSharpBuildToolAsync(BUILD_ACTION_BUILD_WEAVE);
 	}
 
 	// Remove this listener when the engine is shutting down.
@@ -177,37 +226,112 @@ void UCSManager::Initialize()
 	FCoreDelegates::OnPreExit.AddUObject(this, &UCSManager::OnEnginePreExit);
 #endif
 
-	TypeBuilderManager = NewObject<UCSTypeBuilderManager>(this);
-	TypeBuilderManager->Initialize();
+	{
+		FCSScopedStartupPhase TypeBuilderPhase(TEXT("InitializeTypeBuilders"));
+		TypeBuilderManager = NewObject<UCSTypeBuilderManager>(this);
+		TypeBuilderManager->Initialize();
+	}
 
 	GUObjectArray.AddUObjectDeleteListener(this);
 
+	// Handles of deleted objects are disposed in batches once the purge is done, or at the end of the frame for incremental purges.
+	FCoreUObjectDelegates::GetPostPurgeGarbageDelegate().AddUObject(this, &UCSManager::OnPostPurgeGarbage);
+	FCoreDelegates::OnEndFrame.AddUObject(this, &UCSManager::OnEndFrame);
+
+	UpdateCachedSettings();
+
 	// Initialize the C# runtime.
-	if (!InitializeDotNetRuntime())
 	{
-		return;
+		FCSScopedStartupPhase RuntimePhase(TEXT("InitializeDotNetRuntime"));
+#if UNREALSHARP_NATIVE_AOT
+		const bool bInitializedRuntime = InitializeNativeAotRuntime();
+#else
+		const bool bInitializedRuntime = InitializeDotNetRuntime();
+#endif
+		if (!bInitializedRuntime)
+		{
+			return;
+		}
 	}
 
 	GlobalManagedPackage = FindOrAddManagedPackage(FCSNamespace(TEXT("UnrealSharp")));
 
 	// Initialize the property factory. This is used to create properties for managed structs/classes/functions.
-	FCSPropertyFactory::Initialize();
+	{
+		FCSScopedStartupPhase PropertyFactoryPhase(TEXT("InitializePropertyFactory"));
+		FCSPropertyFactory::Initialize();
+	}
+
+	const UCSUnrealSharpSettings* Settings = GetDefault<UCSUnrealSharpSettings>();
+	FCSGameThreadContinuations::Initialize(Settings->ContinuationTickGroup, Settings->ContinuationFrameBudgetMicroseconds / 1000000.0);
+	FCSBatchedTick::Initialize();
+	FCSFieldNotifyBatcher::Initialize();
+	FCSDeferredManagedObjects::Initialize(Settings->bDeferAsyncConstructedManagedObjects);
+#if WITH_EDITOR
+	FCSPIEWarmStart::Initialize();
+#endif
+
+	if (Settings->bCoordinateManagedGC)
+	{
+		ManagedGCCoordinator.Initialize(static_cast<int64>(Settings->ManagedNoGCRegionBudgetMB) * 1024 * 1024);
+	}
+
+#if WITH_EDITOR
+	if (PendingBuild.IsValid())
+	{
+		FCSScopedStartupPhase BuildPhase(TEXT("BuildWeave"));
+
+		// A failed build is shown to the user and retried, until the errors are fixed.
+		while (!FCSProcHelper::ReportCommandResult(PendingBuild.Get()))
+		{
+			PendingBuild = FCSProcHelper::InvokeUnrealSharpBuildToolAsync(BUILD_ACTION_BUILD_WEAVE);
+		}
+	}
+#endif
 
 	// Try to load the user assembly. Can be empty if the user hasn't created any csproj yet.
-	LoadAllUserAssemblies();
+	{
+		FCSScopedStartupPhase UserAssembliesPhase(TEXT("LoadAllUserAssemblies"));
+		LoadAllUserAssemblies();
+	}
+
+	StartupReport.Finish();
 
 	FModuleManager::Get().OnModulesChanged().AddUObject(this, &UCSManager::OnModulesChanged);
 }
 
 bool UCSManager::InitializeDotNetRuntime()
 {
-	if (!LoadRuntimeHost())
+	bool bLoadedRuntimeHost;
+	{
+		FCSScopedStartupPhase LoadRuntimeHostPhase(TEXT("LoadRuntimeHost"));
+		bLoadedRuntimeHost = LoadRuntimeHost();
+	}
+	
+	if (!bLoadedRuntimeHost)
 	{
 		UE_LOG(LogUnrealSharp, Fatal, TEXT("Failed to load Runtime Host"));
 		return false;
 	}
 
-	load_assembly_and_get_function_pointer_fn LoadAssemblyAndGetFunctionPointer = InitializeNativeHost();
+	if (FParse::Param(FCommandLine::Get(), TEXT("RecordManagedProfile")))
+	{
+		// Records which methods get compiled and loaded, packaging turns the trace into a profile for crossgen.
+		const FString ProfilePath = FPaths::ConvertRelativePathToFull(FCSProcHelper::GetStartupProfileDirectory()
+			/ FString::Printf(TEXT("Profile-%s.nettrace"), *FDateTime::Now().ToString()));
+		
+		FPlatformMisc::SetEnvironmentVar(TEXT("DOTNET_EnableEventPipe"), TEXT("1"));
+		FPlatformMisc::SetEnvironmentVar(TEXT("DOTNET_EventPipeOutputPath"), *ProfilePath);
+		FPlatformMisc::SetEnvironmentVar(TEXT("DOTNET_EventPipeConfig"), TEXT("Microsoft-Windows-DotNETRuntime:0x1F000080018:5"));
+		UE_LOGFMT(LogUnrealSharp, Display, "Recording managed startup profile to {0}", *ProfilePath);
+	}
+	
+	load_assembly_and_get_function_pointer_fn LoadAssemblyAndGetFunctionPointer;
+	{
+		FCSScopedStartupPhase NativeHostPhase(TEXT("InitializeNativeHost"));
+		LoadAssemblyAndGetFunctionPointer = InitializeNativeHost();
+	}
+	
 	if (!LoadAssemblyAndGetFunctionPointer)
 	{
 		UE_LOG(LogUnrealSharp, Fatal, TEXT("Failed to initialize Runtime Host. Check logs for more details."));
@@ -221,12 +345,16 @@ bool UCSManager::InitializeDotNetRuntime()
 	const FString UserWorkingDirectory = FPaths::ConvertRelativePathToFull(FCSProcHelper::GetUserAssemblyDirectory());
 
 	FInitializeRuntimeHost InitializeUnrealSharp = nullptr;
-	const int32 ErrorCode = LoadAssemblyAndGetFunctionPointer(PLATFORM_STRING(*UnrealSharpLibraryAssembly),
-		PLATFORM_STRING(*EntryPointClassName),
-		PLATFORM_STRING(*EntryPointFunctionName),
-		UNMANAGEDCALLERSONLY_METHOD,
-		nullptr,
-		reinterpret_cast<void**>(&InitializeUnrealSharp));
+	int32 ErrorCode;
+	{
+		FCSScopedStartupPhase EntryPointPhase(TEXT("LoadEntryPoint"));
+		ErrorCode = LoadAssemblyAndGetFunctionPointer(PLATFORM_STRING(*UnrealSharpLibraryAssembly),
+			PLATFORM_STRING(*EntryPointClassName),
+			PLATFORM_STRING(*EntryPointFunctionName),
+			UNMANAGEDCALLERSONLY_METHOD,
+			nullptr,
+			reinterpret_cast<void**>(&InitializeUnrealSharp));
+	}
 
 	if (ErrorCode != 0)
 	{
@@ -235,10 +363,51 @@ bool UCSManager::InitializeDotNetRuntime()
 	}
 
 	// Entry point to C# to initialize UnrealSharp
+	FCSScopedStartupPhase ManagedInitializePhase(TEXT("InitializeUnrealSharp"));
 	if (!InitializeUnrealSharp(*UserWorkingDirectory,
 		*UnrealSharpLibraryAssembly,
 		&ManagedPluginsCallbacks,
-		(const void*)&FCSBindsManager::GetBoundFunction,
+		&GetStartupBindsCallbacks(),
+		&FCSManagedCallbacks::ManagedCallbacks))
+	{
+		UE_LOG(LogUnrealSharp, Fatal, TEXT("Failed to initialize UnrealSharp!"));
+		return false;
+	}
+
+	return true;
+}
+
+#if UNREALSHARP_NATIVE_AOT
+bool UCSManager::InitializeNativeAotRuntime()
+{
+	const FString NativeLibraryPath = FPaths::ConvertRelativePathToFull(FCSProcHelper::GetNativeAotLibraryPath());
+	const FString UserWorkingDirectory = FPaths::ConvertRelativePathToFull(FCSProcHelper::GetUserAssemblyDirectory());
+
+	void* NativeLibrary;
+	{
+		FCSScopedStartupPhase LoadLibraryPhase(TEXT("LoadNativeAotLibrary"));
+		NativeLibrary = FPlatformProcess::GetDllHandle(*NativeLibraryPath);
+	}
+
+	if (!NativeLibrary)
+	{
+		UE_LOGFMT(LogUnrealSharp, Fatal, "Failed to load the managed library {0}", *NativeLibraryPath);
+		return false;
+	}
+
+	// Exported by UnmanagedCallersOnly(EntryPoint) on UnrealSharp.Plugins.Main.InitializeUnrealSharp.
+	FInitializeRuntimeHost InitializeUnrealSharp = static_cast<FInitializeRuntimeHost>(FPlatformProcess::GetDllExport(NativeLibrary, TEXT("UnrealSharp_InitializeUnrealSharp")));
+	if (!InitializeUnrealSharp)
+	{
+		UE_LOGFMT(LogUnrealSharp, Fatal, "{0} doesn't export UnrealSharp_InitializeUnrealSharp", *NativeLibraryPath);
+		return false;
+	}
+
+	FCSScopedStartupPhase ManagedInitializePhase(TEXT("InitializeUnrealSharp"));
+	if (!InitializeUnrealSharp(*UserWorkingDirectory,
+		*NativeLibraryPath,
+		&ManagedPluginsCallbacks,
+		&GetStartupBindsCallbacks(),
 		&FCSManagedCallbacks::ManagedCallbacks))
 	{
 		UE_LOG(LogUnrealSharp, Fatal, TEXT("Failed to initialize UnrealSharp!"));
@@ -247,6 +416,7 @@ bool UCSManager::InitializeDotNetRuntime()
 
 	return true;
 }
+#endif
 
 bool UCSManager::LoadRuntimeHost()
 {
@@ -274,6 +444,9 @@ bool UCSManager::LoadRuntimeHost()
 	DLLHandle = FPlatformProcess::GetDllExport(RuntimeHost, TEXT("hostfxr_get_runtime_delegate"));
 	Hostfxr_Get_Runtime_Delegate = static_cast<hostfxr_get_runtime_delegate_fn>(DLLHandle);
 
+	DLLHandle = FPlatformProcess::GetDllExport(RuntimeHost, TEXT("hostfxr_set_runtime_property_value"));
+	Hostfxr_Set_Runtime_Property_Value = static_cast<hostfxr_set_runtime_property_value_fn>(DLLHandle);
+
 	DLLHandle = FPlatformProcess::GetDllExport(RuntimeHost, TEXT("hostfxr_close"));
 	Hostfxr_Close = static_cast<hostfxr_close_fn>(DLLHandle);
 #else
@@ -283,10 +456,12 @@ bool UCSManager::LoadRuntimeHost()
 
 	Hostfxr_Get_Runtime_Delegate = (hostfxr_get_runtime_delegate_fn)FPlatformProcess::GetDllExport(RuntimeHost, TEXT("hostfxr_get_runtime_delegate"));
 
+	Hostfxr_Set_Runtime_Property_Value = (hostfxr_set_runtime_property_value_fn)FPlatformProcess::GetDllExport(RuntimeHost, TEXT("hostfxr_set_runtime_property_value"));
+
 	Hostfxr_Close = (hostfxr_close_fn)FPlatformProcess::GetDllExport(RuntimeHost, TEXT("hostfxr_close"));
 #endif
 
-	return Hostfxr_Initialize_For_Dotnet_Command_Line && Hostfxr_Get_Runtime_Delegate && Hostfxr_Close && Hostfxr_Initialize_For_Runtime_Config;
+	return Hostfxr_Initialize_For_Dotnet_Command_Line && Hostfxr_Get_Runtime_Delegate && Hostfxr_Close && Hostfxr_Initialize_For_Runtime_Config && Hostfxr_Set_Runtime_Property_Value;
 }
 
 bool UCSManager::LoadAllUserAssemblies()
@@ -299,12 +474,33 @@ bool UCSManager::LoadAllUserAssemblies()
 		return true;
 	}
 	
+	// Reading the images and parsing the metadata doesn't depend on other assemblies, so it all happens up front on workers.
+	// Loading stays in order, the managed side resolves references through the assemblies loaded before,
+	// and the first assemblies load while the later ones are still being read.
+	TArray<UE::Tasks::TTask<TSharedPtr<FCSPrefetchedAssembly>>> PrefetchTasks;
+	PrefetchTasks.Reserve(UserAssemblyPaths.Num());
+
+	// Shared images are mapped by the runtime itself when the assembly is loaded.
+	const bool bReadImages = !GetDefault<UCSUnrealSharpSettings>()->ShouldShareAssemblyImages();
+	
 	for (const FString& UserAssemblyPath : UserAssemblyPaths)
 	{
-		LoadAssemblyByPath(UserAssemblyPath);
+		PrefetchTasks.Add(UE::Tasks::Launch(UE_SOURCE_LOCATION, [UserAssemblyPath, bReadImages]()
+		{
+			return UCSAssembly::PrefetchAssembly(UserAssemblyPath, bReadImages);
+		}));
+	}
+	
+	for (int32 i = 0; i < UserAssemblyPaths.Num(); ++i)
+	{
+		LoadAssemblyByPath(UserAssemblyPaths[i], true, PrefetchTasks[i].GetResult());
 	}
 
 	OnAssembliesLoaded.Broadcast();
+
+#if WITH_MONO_RUNTIME && PLATFORM_ANDROID
+	UnrealSharp::Android::JITWarmUp::OnUserAssembliesLoaded();
+#endif
 	return true;
 }
 
@@ -312,48 +508,196 @@ void UCSManager::NotifyUObjectDeleted(const UObjectBase* Object, int32 Index)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(UCSManager::NotifyUObjectDeleted);
 
-	TSharedPtr<FGCHandle> Handle;
-	
-	// Use write lock to safely remove from ManagedObjectHandles
+	bool bHadInterfaceWrappers = false;
+	FGCHandle* Handle = ManagedObjectHandles.Remove(Index, &bHadInterfaceWrappers);
+	if (!Handle)
 	{
-		FWriteScopeLock WriteLock(ManagedObjectHandlesLock);
-		if (!ManagedObjectHandles.RemoveAndCopyValueByHash(Index, Index, Handle))
+		return;
+	}
+
+	ReleaseRemovedHandle(Index, Handle, bHadInterfaceWrappers);
+}
+
+void UCSManager::ReleaseRemovedHandle(int32 ObjectIndex, FGCHandle* Handle, bool bHadInterfaceWrappers)
+{
+	// This runs for every object the garbage purge deletes, so the handles are only queued here
+	// and disposed in one go by FlushDeferredHandles.
+	DeferHandleDisposal(Handle);
+
+	if (!bHadInterfaceWrappers)
+	{
+		return;
+	}
+
+	ManagedInterfaceWrappers.RemoveAll(ObjectIndex, [this](FGCHandle* Wrapper)
+	{
+		DeferHandleDisposal(Wrapper);
+	});
+}
+
+void UCSManager::AddManagedObjectHandle(const UObjectBase* Object, FGCHandle* Handle)
+{
+	bool bHadInterfaceWrappers = false;
+	ManagedObjectHandles.Add(Object, Handle, &bHadInterfaceWrappers);
+
+	// The index was recycled without the previous object's deletion removing its slot.
+	if (bHadInterfaceWrappers)
+	{
+		ManagedInterfaceWrappers.RemoveAll(GUObjectArray.ObjectToIndex(Object), [this](FGCHandle* Wrapper)
+		{
+			DeferHandleDisposal(Wrapper);
+		});
+	}
+}
+
+void UCSManager::RemoveInterfaceWrappers(const FCSManagedHandleStore& Store)
+{
+	ManagedInterfaceWrappers.RemoveIf([&Store](FGCHandle* Wrapper)
+	{
+		return &FCSManagedHandleStore::GetOwningStore(Wrapper) == &Store;
+	});
+}
+
+void UCSManager::ClearCachedManagedHandles(const FCSManagedHandleStore& Store)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCSManager::ClearCachedManagedHandles);
+
+	// Every handle an instance caches was registered in the table first, so walking the table finds all of them.
+	ManagedObjectHandles.VisitSlots(0, MAX_int32, [&Store](int32 ObjectIndex, FGCHandle* Handle, bool bIsStale)
+	{
+		if (bIsStale || &FCSManagedHandleStore::GetOwningStore(Handle) != &Store)
+		{
+			return;
+		}
+
+		const FUObjectItem* ObjectItem = GUObjectArray.IndexToObject(ObjectIndex);
+		UObject* Object = ObjectItem ? static_cast<UObject*>(ObjectItem->Object) : nullptr;
+		if (!Object)
 		{
 			return;
 		}
-	}
 
-	UCSAssembly* Assembly = FindOwningAssembly(Object->GetClass());
-	if (!IsValid(Assembly))
+		const UCSClass* ManagedClass = FCSClassUtilities::GetFirstManagedClass(Object->GetClass());
+		if (ManagedClass && ManagedClass->GetCachedManagedHandle(Object) == Handle)
+		{
+			ManagedClass->CacheManagedHandle(Object, nullptr);
+		}
+	});
+}
+
+void UCSManager::DeferHandleDisposal(FGCHandle* Handle)
+{
+	// The store knows its assembly, no need to look up the owning assembly of the object.
+	FCSManagedHandleStore& Store = FCSManagedHandleStore::GetOwningStore(Handle);
+	DeferredHandleDisposer.Enqueue(Handle, Store.GetAssemblyHandle());
+}
+
+void UCSManager::FlushDeferredHandles(bool bWaitForReaders)
+{
+	DeferredHandleDisposer.Flush(bWaitForReaders);
+}
+
+void UCSManager::OnEndFrame()
+{
+	// Continuations that no game world ticked for this frame.
+	FCSGameThreadContinuations::Drain();
+	FCSDeferredManagedObjects::Flush();
+
+	OrphanedHandleSweeper.Tick(ManagedObjectHandles, OrphanedHandleSweepBudget, [this](int32 ObjectIndex, FGCHandle* Handle, bool bHadInterfaceWrappers)
 	{
-		FString ObjectName = Object->GetFName().ToString();
-		FString ClassName = Object->GetClass()->GetFName().ToString();
-		UE_LOG(LogUnrealSharp, Error, TEXT("Failed to find owning assembly for object %s with class %s. Will cause managed memory leak."), *ObjectName, *ClassName);
-		return;
+		ReleaseRemovedHandle(ObjectIndex, Handle, bHadInterfaceWrappers);
+	});
+
+	FlushDeferredHandles();
+	FCSGCPressureMonitor::SampleManagedMemory();
+
+#if UNREALSHARP_TRACK_INTEROP_ALLOCATIONS
+	FCSInteropAllocationTracker::EndFrame();
+#endif
+
+#if UNREALSHARP_CSV_INTEROP_COUNTERS
+	FCSInteropFrameCounters::EndFrame();
+#endif
+
+#if UNREALSHARP_PROFILE_MANAGED_CALLS
+	FCSManagedCallProfiler::EndFrame();
+#endif
+
+	FCSAssemblyBudgets::EndFrame();
+}
+
+void UCSManager::GatherHandleMemoryReport(FCSHandleMemoryReport& OutReport, int32 NumTopClasses) const
+{
+	check(IsInGameThread());
+
+	OutReport.NumObjectHandles = ManagedObjectHandles.Num();
+	OutReport.ObjectHandleTableBytes = ManagedObjectHandles.GetAllocatedSize();
+	OutReport.NumInterfaceWrappers = ManagedInterfaceWrappers.Num();
+	OutReport.InterfaceWrapperTableBytes = ManagedInterfaceWrappers.GetAllocatedSize();
+
+	for (const TPair<FName, TObjectPtr<UCSAssembly>>& Pair : LoadedAssemblies)
+	{
+		if (IsValid(Pair.Value))
+		{
+			Pair.Value->GatherMemoryStats(OutReport.Assemblies.AddDefaulted_GetRef());
+		}
 	}
 
-	TSharedPtr<const FGCHandle> AssemblyHandle = Assembly->GetManagedAssemblyHandle();
-	Handle->Dispose(AssemblyHandle->GetHandle());
+	OutReport.Assemblies.Sort([](const FCSAssemblyMemoryStats& A, const FCSAssemblyMemoryStats& B)
+	{
+		return A.HandleBytes > B.HandleBytes;
+	});
 
-    // Use write lock to safely access and modify ManagedInterfaceWrappers
+	TMap<const UClass*, int32> ObjectsPerClass;
+	ManagedObjectHandles.VisitSlots(0, MAX_int32, [&OutReport, &ObjectsPerClass](int32 ObjectIndex, FGCHandle* Handle, bool bIsStale)
 	{
-		FWriteScopeLock WriteLock(ManagedInterfaceWrappersLock);
-		TMap<uint32, TSharedPtr<FGCHandle>>* FoundHandles = ManagedInterfaceWrappers.FindByHash(Index, Index);
-		if (FoundHandles == nullptr)
+		if (bIsStale)
 		{
+			++OutReport.NumStaleObjectHandles;
 			return;
 		}
 
-		for (auto &[Key, Value] : *FoundHandles)
+		const FUObjectItem* ObjectItem = GUObjectArray.IndexToObject(ObjectIndex);
+		if (const UObject* Object = ObjectItem ? static_cast<const UObject*>(ObjectItem->Object) : nullptr)
 		{
-			Value->Dispose(AssemblyHandle->GetHandle());
+			++ObjectsPerClass.FindOrAdd(Object->GetClass());
 		}
-		
-		FoundHandles->Empty();
-		ManagedInterfaceWrappers.Remove(Index);
+	});
+
+	ObjectsPerClass.ValueSort(TGreater<int32>());
+
+	for (const TPair<const UClass*, int32>& Pair : ObjectsPerClass)
+	{
+		if (OutReport.TopClasses.Num() >= NumTopClasses)
+		{
+			break;
+		}
+
+		OutReport.TopClasses.Add({ Pair.Key->GetFName(), Pair.Value });
 	}
 }
 
+void UCSManager::OnPostPurgeGarbage()
+{
+	FlushDeferredHandles();
+	ManagedGCCoordinator.OnGarbagePurged();
+}
+
+void UCSManager::OnEnginePreExit()
+{
+	GUObjectArray.RemoveUObjectDeleteListener(this);
+	FCSGameThreadContinuations::Shutdown();
+	FCSBatchedTick::Shutdown();
+	FCSFieldNotifyBatcher::Shutdown();
+	FCSDeferredManagedObjects::Shutdown();
+#if WITH_EDITOR
+	FCSPIEWarmStart::Shutdown();
+#endif
+	FCSManagedTimers::ClearAll();
+	FlushDeferredHandles(true);
+	ManagedGCCoordinator.Shutdown();
+}
+
 void UCSManager::OnModulesChanged(FName InModuleName, EModuleChangeReason InModuleChangeReason)
 {
 	if (InModuleChangeReason != EModuleChangeReason::ModuleLoaded)
@@ -471,6 +815,9 @@ load_assembly_and_get_function_pointer_fn UCSManager::InitializeNativeHost() con
 		return nullptr;
 	}
 
+	// Has to happen before the first runtime delegate is requested, that's when the runtime starts.
+	SetRuntimeProperties(HostFXR_Handle);
+
 	void* LoadAssemblyAndGetFunctionPointer = nullptr;
 	ErrorCode = Hostfxr_Get_Runtime_Delegate(HostFXR_Handle, hdt_load_assembly_and_get_function_pointer, &LoadAssemblyAndGetFunctionPointer);
 	Hostfxr_Close(HostFXR_Handle);
@@ -484,7 +831,25 @@ load_assembly_and_get_function_pointer_fn UCSManager::InitializeNativeHost() con
 	return (load_assembly_and_get_function_pointer_fn)LoadAssemblyAndGetFunctionPointer;
 }
 
-UCSAssembly* UCSManager::LoadAssemblyByPath(const FString& AssemblyPath, bool bIsCollectible)
+void UCSManager::SetRuntimeProperties(hostfxr_handle HostFXR_Handle) const
+{
+	TArray<TPair<FString, FString>> RuntimeProperties;
+	GetDefault<UCSUnrealSharpSettings>()->GetRuntimeSettings().GetRuntimeProperties(RuntimeProperties);
+
+	for (const TPair<FString, FString>& Property : RuntimeProperties)
+	{
+		const int32 ErrorCode = Hostfxr_Set_Runtime_Property_Value(HostFXR_Handle, PLATFORM_STRING(*Property.Key), PLATFORM_STRING(*Property.Value));
+		if (ErrorCode != 0)
+		{
+			UE_LOG(LogUnrealSharp, Warning, TEXT("Failed to set runtime property %s to %s, error code: %d"), *Property.Key, *Property.Value, ErrorCode);
+			continue;
+		}
+
+		UE_LOG(LogUnrealSharp, Log, TEXT("Runtime property %s = %s"), *Property.Key, *Property.Value);
+	}
+}
+
+UCSAssembly* UCSManager::LoadAssemblyByPath(const FString& AssemblyPath, bool bIsCollectible, TSharedPtr<FCSPrefetchedAssembly> PrefetchedAssembly)
 {
 	if (!FPaths::FileExists(AssemblyPath))
 	{
@@ -503,14 +868,20 @@ UCSAssembly* UCSManager::LoadAssemblyByPath(const FString& AssemblyPath, bool bI
 	
 	UCSAssembly* NewAssembly = NewObject<UCSAssembly>(this, *AssemblyName);
 	NewAssembly->SetAssemblyPath(AssemblyPath);
+	NewAssembly->SetPrefetchedAssembly(MoveTemp(PrefetchedAssembly));
 	
-	LoadedAssemblies.Add(NewAssembly->GetAssemblyName(), NewAssembly);
+	{
+		FWriteScopeLock WriteLock(NativeClassToAssemblyLock);
+		LoadedAssemblies.Add(NewAssembly->GetAssemblyName(), NewAssembly);
+	}
 
 	if (!NewAssembly->LoadAssembly(bIsCollectible))
 	{
 		return nullptr;
 	}
 
+	CacheNativeClassAssemblies(NewAssembly);
+
 	OnManagedAssemblyLoaded.Broadcast(NewAssembly->GetAssemblyName());
 
 	UE_LOGFMT(LogUnrealSharp, Display, "Successfully loaded AssemblyHandle with path {AssemblyPath}.", *AssemblyPath);
@@ -541,63 +912,134 @@ UCSAssembly* UCSManager::FindOwningAssembly(UClass* Class)
 
 	Class = FCSClassUtilities::GetFirstNativeClass(Class);
 	uint32 ClassID = Class->GetUniqueID();
-	TObjectPtr<UCSAssembly> Assembly = NativeClassToAssemblyMap.FindOrAddByHash(ClassID, ClassID);
 
-	if (IsValid(Assembly))
+	TArray<UCSAssembly*, TInlineAllocator<8>> AssembliesToSearch;
 	{
-		return Assembly;
+		FReadScopeLock ReadLock(NativeClassToAssemblyLock);
+		if (const TObjectPtr<UCSAssembly>* CachedAssembly = NativeClassToAssemblyMap.FindByHash(ClassID, ClassID))
+		{
+			// Null means no assembly had the class when it was last searched for.
+			if (!*CachedAssembly || (*CachedAssembly)->IsValidAssembly())
+			{
+				return *CachedAssembly;
+			}
+		}
+
+		for (const TPair<FName, TObjectPtr<UCSAssembly>>& LoadedAssembly : LoadedAssemblies)
+		{
+			AssembliesToSearch.Add(LoadedAssembly.Value);
+		}
 	}
 
-	// Slow path for native classes. This runs once per new native class.
+	// Slow path for native classes. This runs once per new native class, and again for misses whenever an assembly is loaded.
 	FCSFieldName ClassName = FCSFieldName(Class);
+	UCSAssembly* Assembly = nullptr;
 
-	for (TPair<FName, TObjectPtr<UCSAssembly>>& LoadedAssembly : LoadedAssemblies)
+	for (UCSAssembly* LoadedAssembly : AssembliesToSearch)
 	{
-		TSharedPtr<FGCHandle> TypeHandle = LoadedAssembly.Value->TryFindTypeHandle(ClassName);
+		FGCHandle* TypeHandle = LoadedAssembly->TryFindTypeHandle(ClassName);
 
-		if (!TypeHandle.IsValid() || TypeHandle->IsNull())
+		if (!TypeHandle || TypeHandle->IsNull())
 		{
 			continue;
 		}
 
-		Assembly = LoadedAssembly.Value;
+		Assembly = LoadedAssembly;
 		break;
 	}
 
+	FWriteScopeLock WriteLock(NativeClassToAssemblyLock);
+	NativeClassToAssemblyMap.AddByHash(ClassID, ClassID, Assembly);
 	return Assembly;
 }
 
+void UCSManager::CacheNativeClassAssemblies(UCSAssembly* Assembly)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCSManager::CacheNativeClassAssemblies);
+
+	TArray<FString> GeneratedTypeNames;
+	Assembly->GetGeneratedTypeNames(GeneratedTypeNames);
+
+	// Glue types are named after the native type, so only classes with a matching name need their full name checked.
+	TMultiMap<FName, FName> FullNamesByName;
+	for (const FString& GeneratedTypeName : GeneratedTypeNames)
+	{
+		int32 NamespaceEnd;
+		if (GeneratedTypeName.FindLastChar(TEXT('.'), NamespaceEnd))
+		{
+			FullNamesByName.Add(FName(GeneratedTypeName.RightChop(NamespaceEnd + 1)), FName(GeneratedTypeName));
+		}
+	}
+
+	FWriteScopeLock WriteLock(NativeClassToAssemblyLock);
+
+	// The assembly may have glue for classes that were cached as misses before it got loaded.
+	for (auto It = NativeClassToAssemblyMap.CreateIterator(); It; ++It)
+	{
+		if (!It.Value())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	if (FullNamesByName.IsEmpty())
+	{
+		return;
+	}
+
+	TArray<FName, TInlineAllocator<4>> FullNames;
+	for (TObjectIterator<UClass> ClassIt; ClassIt; ++ClassIt)
+	{
+		UClass* Class = *ClassIt;
+		if (!Class->HasAnyClassFlags(CLASS_Native))
+		{
+			continue;
+		}
+
+		FullNames.Reset();
+		FullNamesByName.MultiFind(Class->GetFName(), FullNames);
+		
+		if (FullNames.IsEmpty() || !FullNames.Contains(FCSFieldName(Class).GetFullName()))
+		{
+			continue;
+		}
+
+		// Assemblies loaded earlier keep the classes they already own, like the slow path in FindOwningAssembly.
+		const uint32 ClassID = Class->GetUniqueID();
+		TObjectPtr<UCSAssembly>& CachedAssembly = NativeClassToAssemblyMap.FindOrAddByHash(ClassID, ClassID);
+		if (!IsValid(CachedAssembly) || !CachedAssembly->IsValidAssembly())
+		{
+			CachedAssembly = Assembly;
+		}
+	}
+}
+
+template<typename TValidationPolicy>
 FGCHandle UCSManager::FindManagedObject(const UObject* Object)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(UCSManager::FindManagedObject);
 
-	// 使用增强的安全性检查替代简单的IsValid
-	if (!FCSObjectSafetyValidator::IsObjectSafeForManagedAccess(Object))
+	if (!TValidationPolicy::IsObjectSafe(Object))
 	{
+#if UNREALSHARP_FULL_OBJECT_VALIDATION
 		UE_LOG(LogTemp, VeryVerbose, TEXT("CSManager: Object failed safety check: %s"), 
 			   Object ? *FCSObjectSafetyValidator::GetObjectSafetyDescription(Object) : TEXT("null"));
+#endif
 		return FGCHandle::Null();
 	}
 
-	uint32 ObjectID = Object->GetUniqueID();
-	
-	// Use read lock to safely access ManagedObjectHandles
+	if (const FGCHandle* FoundHandle = ManagedObjectHandles.Find(Object))
 	{
-		FReadScopeLock ReadLock(ManagedObjectHandlesLock);
-		if (TSharedPtr<FGCHandle>* FoundHandle = ManagedObjectHandles.FindByHash(ObjectID, ObjectID))
-		{
 #if WITH_EDITOR
-			// During full hot reload only the managed objects are GCd as we reload the assemblies.
-			// So the C# counterpart can be invalid even if the handle can be found, so we need to create a new one.
-			TSharedPtr<FGCHandle> HandlePtr = *FoundHandle;
-			if (HandlePtr.IsValid() && !HandlePtr->IsNull())
-			{
-				return *HandlePtr;
-			}
+		// During full hot reload only the managed objects are GCd as we reload the assemblies.
+		// So the C# counterpart can be invalid even if the handle can be found, so we need to create a new one.
+		if (!FoundHandle->IsNull())
+		{
+			return *FoundHandle;
+		}
 #else
-			return **FoundHandle;
+		return *FoundHandle;
 #endif
-		}
 	}
 
 	// No existing handle found, we need to create a new managed object.
@@ -611,23 +1053,62 @@ FGCHandle UCSManager::FindManagedObject(const UObject* Object)
 	return *OwningAssembly->CreateManagedObject(Object);
 }
 
-FGCHandle UCSManager::FindOrCreateManagedInterfaceWrapper(UObject* Object, UClass* InterfaceClass)
+template FGCHandle UCSManager::FindManagedObject<FCSFullObjectValidationPolicy>(const UObject* Object);
+template FGCHandle UCSManager::FindManagedObject<FCSMinimalObjectValidationPolicy>(const UObject* Object);
+
+void UCSManager::UpdateCachedSettings()
+{
+	const UCSUnrealSharpSettings* Settings = GetDefault<UCSUnrealSharpSettings>();
+	
+#if UNREALSHARP_FULL_OBJECT_VALIDATION
+	bFullObjectValidation = Settings->ObjectValidationMode == ECSObjectValidationMode::Full;
+#endif
+
+	bCrashOnException = Settings->bCrashOnException;
+	OrphanedHandleSweepBudget = Settings->OrphanedHandleSweepBudgetMicroseconds / 1000000.0;
+	ManagedObjectCreation = Settings->ManagedObjectCreation;
+}
+
+bool UCSManager::ShouldCreateManagedObjectLazily(const UCSClass* ManagedClass, const UObject* Object) const
 {
-	if (!Object->GetClass()->ImplementsInterface(InterfaceClass))
+	switch (ManagedObjectCreation)
 	{
-		return FGCHandle::Null();
+	case ECSManagedObjectCreation::LazyTemplates:
+		return ManagedClass->CanCreateManagedObjectLazily() && Object->HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject);
+	case ECSManagedObjectCreation::Lazy:
+		return ManagedClass->CanCreateManagedObjectLazily();
+	default:
+		return false;
 	}
+}
 
-	// No existing handle found, we need to create a new managed object.
-	UCSAssembly* OwningAssembly = FindOwningAssembly(InterfaceClass);
-	if (!IsValid(OwningAssembly))
+void UCSManager::SetCurrentWorldContext(UObject* WorldContext)
+{
+	GCSLastWorldContext = WorldContext;
+}
+
+UObject* UCSManager::GetCurrentWorldContext() const
+{
+	if (UObject* InvokeWorldContext = GCSInvokeWorldContext)
+	{
+		// Keep it around for managed code that runs on this thread outside of a call, like async continuations.
+		GCSLastWorldContext = InvokeWorldContext;
+		return InvokeWorldContext;
+	}
+
+	return GCSLastWorldContext.Get();
+}
+
+FGCHandle UCSManager::FindOrCreateManagedInterfaceWrapper(UObject* Object, UClass* InterfaceClass)
+{
+	const FCSInterfaceDispatch Dispatch = FCSInterfaceDispatchCache::FindOrAdd(Object->GetClass(), InterfaceClass);
+	if (!Dispatch.IsValid())
 	{
-		UE_LOGFMT(LogUnrealSharp, Error, "Failed to find assembly for {0}", *InterfaceClass->GetName());
 		return FGCHandle::Null();
 	}
 	
-	TSharedPtr<FGCHandle> FoundHandle = OwningAssembly->FindOrCreateManagedInterfaceWrapper(Object, InterfaceClass);
-	if (!FoundHandle.IsValid())
+	FGCHandle* FoundHandle = Dispatch.Assembly->FindOrCreateManagedInterfaceWrapper(Object, InterfaceClass, *Dispatch.TypeHandle);
+	if (!FoundHandle)
 	{
 		return FGCHandle::Null();
 	}
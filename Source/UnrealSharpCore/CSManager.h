@@ -4,24 +4,46 @@
 #include <hostfxr.h>
 #include "CSAssembly.h"
 #include "CSManagedCallbacksCache.h"
+#include "CSManagedObjectHandleTable.h"
+#include "CSInterfaceWrapperTable.h"
+#include "CSDeferredHandleDisposer.h"
+#include "CSManagedGCCoordinator.h"
+#include "CSOrphanedHandleSweeper.h"
+#include "GCOptimizations/CSObjectSafetyValidator.h"
 #include "CSManager.generated.h"
 
 class UCSTypeBuilderManager;
 class UCSInterface;
 class UCSEnum;
+class UCSClass;
 class UCSScriptStruct;
 class FUnrealSharpCoreModule;
 class UFunctionsExporter;
+struct FCSHandleMemoryReport;
 struct FCSNamespace;
 struct FCSTypeReferenceMetaData;
+enum class ECSManagedObjectCreation : uint8;
 
 struct FCSManagedPluginCallbacks
 {
 	using LoadPluginCallback = FGCHandleIntPtr(__stdcall*)(const TCHAR*, bool);
 	using UnloadPluginCallback = bool(__stdcall*)(const TCHAR*);
+	using LoadPluginFromMemoryCallback = FGCHandleIntPtr(__stdcall*)(const TCHAR*, const uint8*, int64, const uint8*, int64, bool);
+	using PollPendingUnloadsCallback = int32(__stdcall*)();
+	using LoadPluginFromFileCallback = FGCHandleIntPtr(__stdcall*)(const TCHAR*, bool);
 
 	LoadPluginCallback LoadPlugin = nullptr;
 	UnloadPluginCallback UnloadPlugin = nullptr;
+
+	// Loads the assembly from an image native has already mapped or read, the path is only used to resolve dependencies.
+	LoadPluginFromMemoryCallback LoadPluginFromMemory = nullptr;
+
+	// Collects once and returns how many load contexts that failed to unload in time are still alive.
+	PollPendingUnloadsCallback PollPendingUnloads = nullptr;
+
+	// Lets the runtime map the image and its dependencies from their files, so processes loading the same files share their pages.
+	// The files stay locked while they're loaded.
+	LoadPluginFromFileCallback LoadPluginFromFile = nullptr;
 };
 
 using FInitializeRuntimeHost = bool (*)(const TCHAR*, const TCHAR*, FCSManagedPluginCallbacks*, const void*, FCSManagedCallbacks::FManagedCallbacks*);
@@ -34,6 +56,31 @@ DECLARE_MULTICAST_DELEGATE_OneParam(FCSStructEvent, UCSScriptStruct*);
 DECLARE_MULTICAST_DELEGATE_OneParam(FCSInterfaceEvent, UCSInterface*);
 DECLARE_MULTICAST_DELEGATE_OneParam(FCSEnumEvent, UCSEnum*);
 
+// The world context of the call into C# in progress on this thread. Set for the duration of the call only,
+// so invoking a managed function costs a pointer store instead of a weak pointer assignment.
+// Every thread has its own, so calls made for different worlds don't overwrite each other's context.
+// Not exported, only code in this module can touch it.
+extern thread_local UObject* GCSInvokeWorldContext;
+
+struct FCSScopedInvokeWorldContext
+{
+	explicit FCSScopedInvokeWorldContext(UObject* WorldContext) : PreviousWorldContext(GCSInvokeWorldContext)
+	{
+		GCSInvokeWorldContext = WorldContext;
+	}
+
+	~FCSScopedInvokeWorldContext()
+	{
+		GCSInvokeWorldContext = PreviousWorldContext;
+	}
+
+	FCSScopedInvokeWorldContext(const FCSScopedInvokeWorldContext&) = delete;
+	FCSScopedInvokeWorldContext& operator=(const FCSScopedInvokeWorldContext&) = delete;
+
+private:
+	UObject* PreviousWorldContext;
+};
+
 UCLASS()
 class UNREALSHARPCORE_API UCSManager : public UObject, public FUObjectArray::FUObjectDeleteListener
 {
@@ -56,7 +103,7 @@ public:
 	UPackage* GetGlobalManagedPackage() const { return GlobalManagedPackage; }
 	UPackage* FindOrAddManagedPackage(FCSNamespace Namespace);
 
-	UCSAssembly* LoadAssemblyByPath(const FString& AssemblyPath, bool bIsCollectible = true);
+	UCSAssembly* LoadAssemblyByPath(const FString& AssemblyPath, bool bIsCollectible = true, TSharedPtr<FCSPrefetchedAssembly> PrefetchedAssembly = nullptr);
 
 	// Load an assembly by name that exists in the ProjectRoot/Binaries/Managed folder
 	UCSAssembly* LoadUserAssemblyByName(const FName AssemblyName, bool bIsCollectible = true);
@@ -66,6 +113,10 @@ public:
 
 	UCSAssembly* FindOwningAssembly(UClass* Class);
 
+	// Disposes the handles of deleted objects that are still queued. Runs after every purge and at the end of the frame.
+	// Handles worker threads may still be reading are kept until they aren't, unless bWaitForReaders is set.
+	void FlushDeferredHandles(bool bWaitForReaders = false);
+
 	UCSAssembly* FindAssembly(FName AssemblyName) const
 	{
 		return LoadedAssemblies.FindRef(AssemblyName);
@@ -81,11 +132,38 @@ public:
 		return LoadUserAssemblyByName(AssemblyName);
 	}
 	
+	FGCHandle FindManagedObject(const UObject* Object)
+	{
+#if UNREALSHARP_FULL_OBJECT_VALIDATION
+		if (bFullObjectValidation)
+		{
+			return FindManagedObject<FCSFullObjectValidationPolicy>(Object);
+		}
+#endif
+		return FindManagedObject<FCSMinimalObjectValidationPolicy>(Object);
+	}
+
+	template<typename TValidationPolicy>
 	FGCHandle FindManagedObject(const UObject* Object);
+
+	// Picks up changes to the settings cached here: ObjectValidationMode, bCrashOnException, OrphanedHandleSweepBudgetMicroseconds and ManagedObjectCreation.
+	void UpdateCachedSettings();
+
+	// Whether ManagedObjectConstructor leaves the C# counterpart of an object to its first use, per ManagedObjectCreation.
+	bool ShouldCreateManagedObjectLazily(const UCSClass* ManagedClass, const UObject* Object) const;
+
+	bool ShouldCrashOnException() const { return bCrashOnException; }
+
+	FGCHandle* FindManagedObjectHandle(const UObject* Object) const { return ManagedObjectHandles.Find(Object); }
+	const FCSManagedObjectHandleTable& GetManagedObjectHandles() const { return ManagedObjectHandles; }
 	FGCHandle FindOrCreateManagedInterfaceWrapper(UObject* Object, UClass* InterfaceClass);
 
-	void SetCurrentWorldContext(UObject* WorldContext) { CurrentWorldContext = WorldContext; }
-	UObject* GetCurrentWorldContext() const { return CurrentWorldContext.Get(); }
+	// Sets the world context of managed code that runs on this thread outside of a call into C#.
+	// Calls carry their own, see FCSScopedInvokeWorldContext.
+	void SetCurrentWorldContext(UObject* WorldContext);
+
+	// The world context of the call into C# in progress on this thread, or the last one this thread saw.
+	UObject* GetCurrentWorldContext() const;
 
 	const FCSManagedPluginCallbacks& GetManagedPluginsCallbacks() const { return ManagedPluginsCallbacks; }
 
@@ -101,16 +179,47 @@ public:
 	FSimpleMulticastDelegate& OnProcessedPendingClassesEvent() { return OnProcessedPendingClasses; }
 #endif
 
-	void ForEachManagedPackage(const TFunction<void(UPackage*)>& Callback) const
+	template<typename TVisitor>
+	void ForEachManagedPackage(TVisitor&& Visitor) const
 	{
 		for (UPackage* Package : AllPackages)
 		{
-			Callback(Package);
+			Visitor(Package);
+		}
+	}
+
+	// Visits the managed types, in the order they were created. Doesn't go through the object hash of the packages.
+	template<typename TVisitor>
+	void ForEachManagedField(TVisitor&& Visitor) const
+	{
+		for (const TPair<const UPackage*, TArray<TWeakObjectPtr<UField>>>& PackageFields : ManagedFieldsByPackage)
+		{
+			ForEachManagedField(PackageFields.Key, Visitor);
+		}
+	}
+
+	template<typename TVisitor>
+	void ForEachManagedField(const UPackage* Package, TVisitor&& Visitor) const
+	{
+		const TArray<TWeakObjectPtr<UField>>* Fields = ManagedFieldsByPackage.Find(Package);
+		if (!Fields)
+		{
+			return;
+		}
+
+		for (const TWeakObjectPtr<UField>& WeakField : *Fields)
+		{
+			if (UField* Field = WeakField.Get())
+			{
+				Visitor(Field);
+			}
 		}
 	}
-	void ForEachManagedField(const TFunction<void(UObject*)>& Callback) const;
 
-	bool IsManagedPackage(const UPackage* Package) const { 	return AllPackages.Contains(Package); }
+	// Called by the type builders for every managed type they create.
+	void RegisterManagedField(UField* Field);
+
+	bool IsManagedPackage(const UPackage* Package) const { return ManagedPackages.Contains(Package); }
 	UPackage* GetPackage(const FCSNamespace Namespace);
 
 	bool IsManagedType(const UObject* Field) const { return IsManagedPackage(Field->GetOutermost()); }
@@ -121,6 +230,9 @@ public:
 
 	UCSTypeBuilderManager* GetTypeBuilderManager() const { return TypeBuilderManager; }
 
+	// Fills in the handle tables, the assemblies and the classes with the most objects, see FCSHandleMemoryReport::Capture.
+	void GatherHandleMemoryReport(FCSHandleMemoryReport& OutReport, int32 NumTopClasses) const;
+
 private:
 
 	friend UCSAssembly;
@@ -131,16 +243,45 @@ private:
 
 	load_assembly_and_get_function_pointer_fn InitializeNativeHost() const;
 
+	// Applies the runtime settings of the current target to a runtime that hasn't been started yet.
+	void SetRuntimeProperties(hostfxr_handle HostFXR_Handle) const;
+
 	bool LoadRuntimeHost();
 	bool InitializeDotNetRuntime();
+
+#if UNREALSHARP_NATIVE_AOT
+	// Loads the managed layer compiled with NativeAOT and calls its exported entry point, no hostfxr involved.
+	bool InitializeNativeAotRuntime();
+#endif
+
 	bool LoadAllUserAssemblies();
 
 	// UObjectArray listener interface
 	virtual void NotifyUObjectDeleted(const UObjectBase* Object, int32 Index) override;
 	virtual void OnUObjectArrayShutdown() override { GUObjectArray.RemoveUObjectDeleteListener(this); }
-	void OnEnginePreExit() { GUObjectArray.RemoveUObjectDeleteListener(this); }
+	void OnEnginePreExit();
 	// End of interface
 
+	void DeferHandleDisposal(FGCHandle* Handle);
+
+	// Registers the C# counterpart of the object. Wrappers left behind by a previous object at the same index are released.
+	void AddManagedObjectHandle(const UObjectBase* Object, FGCHandle* Handle);
+
+	// Drops the interface wrappers allocated from the store, which is about to dispose all of its handles.
+	void RemoveInterfaceWrappers(const FCSManagedHandleStore& Store);
+
+	// Clears the handles instances cache in their __ManagedHandle property that were allocated from the store,
+	// which is released with its assembly and would leave them dangling.
+	void ClearCachedManagedHandles(const FCSManagedHandleStore& Store);
+
+	// Disposes a handle that has been removed from ManagedObjectHandles, along with the interface wrappers of its object.
+	void ReleaseRemovedHandle(int32 ObjectIndex, FGCHandle* Handle, bool bHadInterfaceWrappers);
+	void OnPostPurgeGarbage();
+	void OnEndFrame();
+
+	// Maps the native classes the assembly has glue for up front, so FindOwningAssembly doesn't have to search for them.
+	void CacheNativeClassAssemblies(UCSAssembly* Assembly);
+
 	void OnModulesChanged(FName InModuleName, EModuleChangeReason InModuleChangeReason);
 	void TryInitializeDynamicSubsystems();
 
@@ -149,6 +290,16 @@ private:
 	UPROPERTY()
 	TArray<TObjectPtr<UPackage>> AllPackages;
 
+	// Lookups into AllPackages, which keeps the packages alive. Managed packages are never destroyed.
+	TSet<const UPackage*> ManagedPackages;
+	TMap<FName, UPackage*> PackageNameToPackage;
+	
+	// The package FindOrAddManagedPackage returned for each namespace, so the parent chain is only walked once per namespace.
+	TMap<FName, UPackage*> NamespaceToPackage;
+
+	// The managed types of each managed package. Types are standalone and rarely go away, stale entries are dropped as the lists grow.
+	TMap<const UPackage*, TArray<TWeakObjectPtr<UField>>> ManagedFieldsByPackage;
+
 	UPROPERTY()
 	TObjectPtr<UPackage> GlobalManagedPackage;
 
@@ -158,27 +309,38 @@ private:
 	UPROPERTY(Transient)
 	TObjectPtr<UCSTypeBuilderManager> TypeBuilderManager;
 
-	// Handles to all active UObjects that has a C# counterpart. The key is the unique ID of the UObject.
-	TMap<uint32, TSharedPtr<FGCHandle>> ManagedObjectHandles;
-	
-	// Thread-safety protection for ManagedObjectHandles
-	mutable FRWLock ManagedObjectHandlesLock;
+	// Handles to all active UObjects that has a C# counterpart, indexed by the GUObjectArray index of the UObject.
+	FCSManagedObjectHandleTable ManagedObjectHandles;
 
-	// Handles all active UObjects that have interface wrappers in C#. The primary key is the unique ID of the UObject.
-	// The second key is the unique ID of the interface class.
-	TMap<uint32, TMap<uint32, TSharedPtr<FGCHandle>>> ManagedInterfaceWrappers;
-	
-	// Thread-safety protection for ManagedInterfaceWrappers  
-	mutable FRWLock ManagedInterfaceWrappersLock;
+	// Interface wrappers of all active UObjects in C#, keyed by the unique ID of the UObject and of the interface class.
+	// Objects that have any are flagged in ManagedObjectHandles, so the table is only locked for those.
+	FCSInterfaceWrapperTable ManagedInterfaceWrappers;
+
+	// Handles of deleted objects waiting to be disposed in one batch.
+	FCSDeferredHandleDisposer DeferredHandleDisposer;
+
+	// Runs .NET collections when Unreal collects garbage instead of during gameplay frames.
+	FCSManagedGCCoordinator ManagedGCCoordinator;
+
+	// Releases handles whose UObject or C# object is gone a few batches per frame.
+	FCSOrphanedHandleSweeper OrphanedHandleSweeper;
+	double OrphanedHandleSweepBudget = 0.0;
+
+	ECSManagedObjectCreation ManagedObjectCreation = {};
 	
 	// Map to cache assemblies that native classes are associated with, for quick lookup.
+	// Classes without a C# counterpart map to null, so they aren't looked up in every assembly each time.
 	UPROPERTY()
 	TMap<uint32, TObjectPtr<UCSAssembly>> NativeClassToAssemblyMap;
 
+	// Guards NativeClassToAssemblyMap, and LoadedAssemblies against lookups of the owning assembly off the game thread.
+	mutable FRWLock NativeClassToAssemblyLock;
+
 	UPROPERTY()
 	TMap<FName, TObjectPtr<UCSAssembly>> LoadedAssemblies;
 
-	TWeakObjectPtr<UObject> CurrentWorldContext;
+	bool bFullObjectValidation = UNREALSHARP_FULL_OBJECT_VALIDATION;
+	bool bCrashOnException = true;
 
 	FOnManagedAssemblyLoaded OnManagedAssemblyLoaded;
 	FOnAssembliesReloaded OnAssembliesLoaded;
@@ -198,6 +360,7 @@ private:
 	hostfxr_initialize_for_dotnet_command_line_fn Hostfxr_Initialize_For_Dotnet_Command_Line = nullptr;
 	hostfxr_initialize_for_runtime_config_fn Hostfxr_Initialize_For_Runtime_Config = nullptr;
 	hostfxr_get_runtime_delegate_fn Hostfxr_Get_Runtime_Delegate = nullptr;
+	hostfxr_set_runtime_property_value_fn Hostfxr_Set_Runtime_Property_Value = nullptr;
 	hostfxr_close_fn Hostfxr_Close = nullptr;
 
 	void* RuntimeHost = nullptr;
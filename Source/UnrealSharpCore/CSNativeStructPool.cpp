@@ -0,0 +1,141 @@
+#include "CSNativeStructPool.h"
+#include "CSInteropAllocationTracker.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/CoreDelegates.h"
+#include <atomic>
+
+namespace
+{
+	constexpr int32 BlockGranularity = 16;
+
+	int32 MaxPooledStructSize = 1024;
+	FAutoConsoleVariableRef CVarMaxPooledStructSize(
+		TEXT("UnrealSharp.NativeStructPool.MaxSize"),
+		MaxPooledStructSize,
+		TEXT("Largest struct, in bytes, whose native memory is pooled when C# releases it. Structs of up to 64 bytes are stored inline and never pooled."));
+
+	int32 MaxPooledBlocksPerSize = 64;
+	FAutoConsoleVariableRef CVarMaxPooledBlocksPerSize(
+		TEXT("UnrealSharp.NativeStructPool.MaxBlocksPerSize"),
+		MaxPooledBlocksPerSize,
+		TEXT("Number of free blocks kept per block size, blocks released beyond that are freed."));
+
+	FAutoConsoleCommandWithOutputDevice DumpNativeStructPoolCommand(
+		TEXT("UnrealSharp.NativeStructPool"),
+		TEXT("Prints the hit rate of the native struct pool and the blocks it holds per size."),
+		FConsoleCommandWithOutputDeviceDelegate::CreateStatic(&FCSNativeStructPool::Dump));
+
+	FAutoConsoleCommand TrimNativeStructPoolCommand(
+		TEXT("UnrealSharp.NativeStructPool.Trim"),
+		TEXT("Frees every block held by the native struct pool."),
+		FConsoleCommandDelegate::CreateStatic(&FCSNativeStructPool::Trim));
+
+	FCriticalSection PoolLock;
+	TMap<int32, TArray<void*>> FreeBlocks;
+	int64 PooledBytes = 0;
+	bool bRegisteredMemoryTrim = false;
+
+	std::atomic<int64> NumHits { 0 };
+	std::atomic<int64> NumMisses { 0 };
+
+	bool CanPool(int32 Size, int32 Alignment)
+	{
+		return Size <= MaxPooledStructSize && Alignment <= BlockGranularity;
+	}
+}
+
+void* FCSNativeStructPool::Allocate(int32 Size, int32 Alignment)
+{
+	if (!CanPool(Size, Alignment))
+	{
+		CS_TRACK_INTEROP_ALLOCATION("UScriptStructExporter", "AllocateNativeStruct", Size);
+		return FMemory::Malloc(Size, Alignment);
+	}
+
+	const int32 BlockSize = Align(Size, BlockGranularity);
+
+	{
+		FScopeLock Lock(&PoolLock);
+		if (TArray<void*>* Blocks = FreeBlocks.Find(BlockSize); Blocks && !Blocks->IsEmpty())
+		{
+			PooledBytes -= BlockSize;
+			NumHits.fetch_add(1, std::memory_order_relaxed);
+			return Blocks->Pop();
+		}
+	}
+
+	NumMisses.fetch_add(1, std::memory_order_relaxed);
+	CS_TRACK_INTEROP_ALLOCATION("UScriptStructExporter", "AllocateNativeStruct", BlockSize);
+	return FMemory::Malloc(BlockSize, BlockGranularity);
+}
+
+void FCSNativeStructPool::Free(void* Block, int32 Size, int32 Alignment)
+{
+	if (!CanPool(Size, Alignment))
+	{
+		FMemory::Free(Block);
+		return;
+	}
+
+	const int32 BlockSize = Align(Size, BlockGranularity);
+
+	{
+		FScopeLock Lock(&PoolLock);
+
+		if (!bRegisteredMemoryTrim)
+		{
+			FCoreDelegates::GetMemoryTrimDelegate().AddStatic(&FCSNativeStructPool::Trim);
+			bRegisteredMemoryTrim = true;
+		}
+
+		TArray<void*>& Blocks = FreeBlocks.FindOrAdd(BlockSize);
+		if (Blocks.Num() < MaxPooledBlocksPerSize)
+		{
+			Blocks.Add(Block);
+			PooledBytes += BlockSize;
+			return;
+		}
+	}
+
+	FMemory::Free(Block);
+}
+
+void FCSNativeStructPool::Trim()
+{
+	TMap<int32, TArray<void*>> BlocksToFree;
+
+	{
+		FScopeLock Lock(&PoolLock);
+		BlocksToFree = MoveTemp(FreeBlocks);
+		FreeBlocks.Reset();
+		PooledBytes = 0;
+	}
+
+	for (const TPair<int32, TArray<void*>>& Pair : BlocksToFree)
+	{
+		for (void* Block : Pair.Value)
+		{
+			FMemory::Free(Block);
+		}
+	}
+}
+
+void FCSNativeStructPool::Dump(FOutputDevice& Ar)
+{
+	const int64 Hits = NumHits.load(std::memory_order_relaxed);
+	const int64 Misses = NumMisses.load(std::memory_order_relaxed);
+	const double HitRate = Hits + Misses > 0 ? 100.0 * Hits / (Hits + Misses) : 0.0;
+
+	FScopeLock Lock(&PoolLock);
+
+	Ar.Logf(TEXT("Native struct pool: %lld hits, %lld misses (%.1f%% hit rate), %lld bytes pooled"), Hits, Misses, HitRate, PooledBytes);
+
+	TArray<int32> BlockSizes;
+	FreeBlocks.GetKeys(BlockSizes);
+	BlockSizes.Sort();
+
+	for (int32 BlockSize : BlockSizes)
+	{
+		Ar.Logf(TEXT("  %5d bytes: %d blocks"), BlockSize, FreeBlocks[BlockSize].Num());
+	}
+}
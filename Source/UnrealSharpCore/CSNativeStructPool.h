@@ -0,0 +1,27 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Recycles the native memory of the structs C# holds through NativeStructHandle that don't fit its inline storage,
+ * so struct-heavy calls like traces and overlaps don't hit the allocator every time.
+ *
+ * Blocks are pooled by size, rounded up to 16 bytes, instead of by struct: a C# struct rebuilt with a new size keeps
+ * its UScriptStruct, and must not get a block of its old size back. Blocks don't hold a struct while pooled,
+ * the caller initializes and destroys it. Thread safe, handles are also released by the finalizer thread.
+ *
+ * UnrealSharp.NativeStructPool prints the hit rate and what is pooled, the pool is emptied on memory trims.
+ */
+class UNREALSHARPCORE_API FCSNativeStructPool
+{
+public:
+	static void* Allocate(int32 Size, int32 Alignment);
+
+	// Size and Alignment must be the ones the block was allocated with.
+	static void Free(void* Block, int32 Size, int32 Alignment);
+
+	// Gives every pooled block back to the allocator.
+	static void Trim();
+
+	static void Dump(FOutputDevice& Ar);
+};
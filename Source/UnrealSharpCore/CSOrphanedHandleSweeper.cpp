@@ -0,0 +1,79 @@
+#include "CSOrphanedHandleSweeper.h"
+#include "CSManagedObjectHandleTable.h"
+#include "UnrealSharpCore.h"
+
+void FCSOrphanedHandleSweeper::Tick(FCSManagedObjectHandleTable& Table, double BudgetSeconds, TFunctionRef<void(int32 ObjectIndex, FGCHandle* Handle, bool bHadInterfaceWrappers)> Release)
+{
+	check(IsInGameThread());
+
+	if (BudgetSeconds <= 0.0 || Table.Num() == 0 || !FCSManagedCallbacks::ManagedCallbacks.FindDeadHandles)
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(FCSOrphanedHandleSweeper::Tick);
+
+	auto ReleaseIfUnchanged = [&](int32 ObjectIndex, FGCHandle* Handle)
+	{
+		bool bHadInterfaceWrappers = false;
+		if (FGCHandle* RemovedHandle = Table.RemoveIfUnchanged(ObjectIndex, Handle, &bHadInterfaceWrappers))
+		{
+			Release(ObjectIndex, RemovedHandle, bHadInterfaceWrappers);
+			++NumSweptThisPass;
+		}
+	};
+
+	const double EndTime = FPlatformTime::Seconds() + BudgetSeconds;
+
+	do
+	{
+		WeakHandles.Reset();
+
+		Cursor = Table.VisitSlots(Cursor, NumSlotsPerBatch, [&](int32 ObjectIndex, FGCHandle* Handle, bool bIsStale)
+		{
+			if (bIsStale)
+			{
+				ReleaseIfUnchanged(ObjectIndex, Handle);
+			}
+			else if (Handle->IsWeakPointer())
+			{
+				WeakHandles.Add({ ObjectIndex, Handle });
+			}
+		});
+
+		if (!WeakHandles.IsEmpty())
+		{
+			WeakHandlePointers.Reset(WeakHandles.Num());
+			for (const FWeakHandle& WeakHandle : WeakHandles)
+			{
+				WeakHandlePointers.Add(WeakHandle.Handle->GetHandle());
+			}
+
+			DeadFlags.Reset(WeakHandles.Num());
+			DeadFlags.AddUninitialized(WeakHandles.Num());
+			const int32 NumDead = FCSManagedCallbacks::ManagedCallbacks.FindDeadHandles(WeakHandlePointers.GetData(), DeadFlags.GetData(), WeakHandlePointers.Num());
+
+			for (int32 i = 0; i < WeakHandles.Num() && NumDead > 0; ++i)
+			{
+				if (DeadFlags[i])
+				{
+					ReleaseIfUnchanged(WeakHandles[i].ObjectIndex, WeakHandles[i].Handle);
+				}
+			}
+		}
+
+		// Wrapped around, report the pass and start over next frame.
+		if (Cursor == 0)
+		{
+			if (NumSweptThisPass > 0)
+			{
+				UE_LOG(LogUnrealSharp, Verbose, TEXT("Released %d orphaned managed handles"), NumSweptThisPass);
+			}
+
+			NumSwept += NumSweptThisPass;
+			NumSweptThisPass = 0;
+			break;
+		}
+	}
+	while (FPlatformTime::Seconds() < EndTime);
+}
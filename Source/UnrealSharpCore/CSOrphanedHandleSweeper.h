@@ -0,0 +1,39 @@
+#pragma once
+
+#include "CSManagedGCHandle.h"
+
+class FCSManagedObjectHandleTable;
+
+/**
+ * Walks the managed object handle table a batch at a time and releases handles that are orphaned:
+ * the UObject they were registered for is gone, or the C# object behind a weak handle has been collected.
+ * Runs within a time budget every frame, so leaked handles never pile up into one long cleanup.
+ */
+class UNREALSHARPCORE_API FCSOrphanedHandleSweeper
+{
+public:
+	// Sweeps batches until BudgetSeconds have passed. Release is called for every orphaned handle
+	// after it has been removed from the table, so it only needs to dispose and free it.
+	void Tick(FCSManagedObjectHandleTable& Table, double BudgetSeconds, TFunctionRef<void(int32 ObjectIndex, FGCHandle* Handle, bool bHadInterfaceWrappers)> Release);
+
+	int32 GetNumSwept() const { return NumSwept; }
+
+private:
+
+	static constexpr int32 NumSlotsPerBatch = 256;
+
+	int32 Cursor = 0;
+	int32 NumSwept = 0;
+	int32 NumSweptThisPass = 0;
+
+	struct FWeakHandle
+	{
+		int32 ObjectIndex;
+		FGCHandle* Handle;
+	};
+
+	// Weak handles of the current batch, checked in one managed call. Kept around so sweeping doesn't allocate.
+	TArray<FWeakHandle> WeakHandles;
+	TArray<FGCHandleIntPtr> WeakHandlePointers;
+	TArray<uint8> DeadFlags;
+};
@@ -0,0 +1,83 @@
+#include "CSPIEWarmStart.h"
+
+#if WITH_EDITOR
+
+#include "CSAssembly.h"
+#include "CSManager.h"
+#include "CSUnrealSharpSettings.h"
+#include "Engine/World.h"
+#include "UObject/UObjectHash.h"
+#include "UnrealSharpCore.h"
+#include "Utils/CSClassUtilities.h"
+
+namespace
+{
+	FDelegateHandle PostDuplicateHandle;
+
+	void OnPostDuplicate(UWorld* World, bool bDuplicateForPIE, FWorldDelegates::FReplacementMap&, TArray<UObject*>&)
+	{
+		if (bDuplicateForPIE && GetDefault<UCSUnrealSharpSettings>()->bPIEWarmStart)
+		{
+			FCSPIEWarmStart::WarmUp(World);
+		}
+	}
+}
+
+void FCSPIEWarmStart::Initialize()
+{
+	check(IsInGameThread());
+
+	if (!PostDuplicateHandle.IsValid())
+	{
+		PostDuplicateHandle = FWorldDelegates::OnPostDuplicate.AddStatic(&OnPostDuplicate);
+	}
+}
+
+void FCSPIEWarmStart::Shutdown()
+{
+	check(IsInGameThread());
+
+	FWorldDelegates::OnPostDuplicate.Remove(PostDuplicateHandle);
+	PostDuplicateHandle.Reset();
+}
+
+int32 FCSPIEWarmStart::WarmUp(UWorld* World)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FCSPIEWarmStart::WarmUp);
+	check(IsInGameThread());
+
+	UCSManager& Manager = UCSManager::Get();
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Grouped by the class the counterparts are created from, Blueprint classes share the one of their managed parent.
+	TMap<UClass*, TArray<const UObject*>> ObjectsByClass;
+	ForEachObjectWithOuter(World, [&Manager, &ObjectsByClass](UObject* Object)
+	{
+		UClass* Class = Object->GetClass();
+		if (!FCSClassUtilities::GetFirstManagedClass(Class) || Manager.FindManagedObjectHandle(Object))
+		{
+			return;
+		}
+
+		ObjectsByClass.FindOrAdd(FCSClassUtilities::GetFirstNonBlueprintClass(Class)).Add(Object);
+	}, true, RF_ClassDefaultObject | RF_ArchetypeObject, EInternalObjectFlags::Garbage);
+
+	int32 NumCreated = 0;
+	for (const TPair<UClass*, TArray<const UObject*>>& ClassObjects : ObjectsByClass)
+	{
+		UCSAssembly* OwningAssembly = Manager.FindOwningAssembly(ClassObjects.Key);
+		if (!IsValid(OwningAssembly))
+		{
+			continue;
+		}
+
+		NumCreated += OwningAssembly->CreateManagedObjects(ClassObjects.Key, ClassObjects.Value);
+	}
+
+	UE_LOG(LogUnrealSharp, Verbose, TEXT("Created %d managed objects of %d classes for %s in %.2f ms"), NumCreated, ObjectsByClass.Num(),
+		*World->GetName(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+	return NumCreated;
+}
+
+#endif
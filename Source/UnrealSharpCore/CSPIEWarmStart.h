@@ -0,0 +1,23 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_EDITOR
+
+/**
+ * Creates the C# counterparts of the managed actors and components of a PIE world as soon as it is duplicated from the editor world,
+ * with one transition into C# per class, instead of one per object the first time each of them is touched in the first frames of play.
+ * The managed type handles are resolved once per class, and stay with their assembly from one PIE session to the next.
+ * Enabled by bPIEWarmStart in the UnrealSharp settings.
+ */
+class UNREALSHARPCORE_API FCSPIEWarmStart
+{
+public:
+	static void Initialize();
+	static void Shutdown();
+
+	// Creates the counterparts that are still missing for the managed objects in the world. Returns the number created.
+	static int32 WarmUp(UWorld* World);
+};
+
+#endif
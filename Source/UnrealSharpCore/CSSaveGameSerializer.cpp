@@ -0,0 +1,482 @@
+#include "CSSaveGameSerializer.h"
+#include "UnrealSharpCore.h"
+#include "Hash/CityHash.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+#include "UObject/EnumProperty.h"
+#include "UObject/UnrealType.h"
+
+namespace
+{
+	constexpr uint32 SaveGameMagic = 0x47534353; // CSSG
+	constexpr uint32 SaveGameVersion = 1;
+
+	// Size written in the schema for properties that are serialized instead of copied, their data is prefixed with its length.
+	constexpr int32 SerializedPropertySize = -1;
+
+	void SerializeProperty(FArchive& Ar, const FProperty* Property, void* Container)
+	{
+		for (int32 Index = 0; Index < Property->ArrayDim; ++Index)
+		{
+			FStructuredArchiveFromArchive StructuredArchive(Ar);
+			Property->SerializeItem(StructuredArchive.GetSlot(), Property->ContainerPtrToValuePtr<void>(Container, Index), nullptr);
+		}
+	}
+
+	// Whether Size bytes from the current position stay within the record, flags the archive if they don't.
+	bool CheckFitsRecord(FArchive& Ar, int64 Size, int64 RecordEnd)
+	{
+		if (Ar.IsError() || Size < 0 || Ar.Tell() + Size > RecordEnd)
+		{
+			Ar.SetError();
+			return false;
+		}
+
+		return true;
+	}
+
+	// Reads the length prefix of a serialized property, returns where its data ends or INDEX_NONE if it doesn't fit the record.
+	int64 ReadSerializedLength(FArchive& Ar, int64 RecordEnd)
+	{
+		int32 Length = 0;
+		if (!CheckFitsRecord(Ar, sizeof(int32), RecordEnd))
+		{
+			return INDEX_NONE;
+		}
+
+		Ar << Length;
+		return CheckFitsRecord(Ar, Length, RecordEnd) ? Ar.Tell() + Length : INDEX_NONE;
+	}
+
+	// Moves past a serialized property, flags the archive if reading it went past its length.
+	bool SeekToPropertyEnd(FArchive& Ar, int64 EndOffset)
+	{
+		if (Ar.IsError() || Ar.Tell() > EndOffset)
+		{
+			Ar.SetError();
+			return false;
+		}
+
+		Ar.Seek(EndOffset);
+		return true;
+	}
+}
+
+TMap<TObjectKey<UStruct>, TUniquePtr<FCSSaveGameSerializer::FLayout>> FCSSaveGameSerializer::Layouts;
+
+void FCSSaveGameSerializer::SaveObjects(TConstArrayView<UObject*> Objects, TArray<uint8>& OutData)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FCSSaveGameSerializer::SaveObjects);
+
+	TArray<TPair<const UStruct*, const void*>> Records;
+	Records.Reserve(Objects.Num());
+
+	for (UObject* Object : Objects)
+	{
+		Records.Emplace(IsValid(Object) ? Object->GetClass() : nullptr, Object);
+	}
+
+	WriteBlob(Records, OutData);
+}
+
+bool FCSSaveGameSerializer::LoadObjects(TConstArrayView<UObject*> Objects, TConstArrayView<uint8> Data)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FCSSaveGameSerializer::LoadObjects);
+
+	TArray<TPair<const UStruct*, void*>> Records;
+	Records.Reserve(Objects.Num());
+
+	for (UObject* Object : Objects)
+	{
+		Records.Emplace(IsValid(Object) ? Object->GetClass() : nullptr, Object);
+	}
+
+	return ReadBlob(Records, Data);
+}
+
+void FCSSaveGameSerializer::SaveStruct(const UScriptStruct* Struct, const void* StructData, TArray<uint8>& OutData)
+{
+	const TPair<const UStruct*, const void*> Record(Struct, StructData);
+	WriteBlob(MakeArrayView(&Record, 1), OutData);
+}
+
+bool FCSSaveGameSerializer::LoadStruct(const UScriptStruct* Struct, void* StructData, TConstArrayView<uint8> Data)
+{
+	const TPair<const UStruct*, void*> Record(Struct, StructData);
+	return ReadBlob(MakeArrayView(&Record, 1), Data);
+}
+
+void FCSSaveGameSerializer::Reset()
+{
+	check(IsInGameThread());
+	Layouts.Empty();
+}
+
+const FCSSaveGameSerializer::FLayout& FCSSaveGameSerializer::GetLayout(const UStruct* Struct)
+{
+	check(IsInGameThread());
+
+	const uint32 LinkHash = GetLinkHash(Struct);
+	TUniquePtr<FLayout>& Layout = Layouts.FindOrAdd(Struct);
+	if (Layout.IsValid() && Layout->Struct.Get() == Struct && Layout->LinkHash == LinkHash)
+	{
+		return *Layout;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(FCSSaveGameSerializer::BuildLayout);
+
+	Layout = MakeUnique<FLayout>();
+	Layout->Struct = Struct;
+	Layout->LinkHash = LinkHash;
+
+	// Objects only save what is marked as save data, like a SaveGame archive would.
+	const bool bIsClass = Struct->IsA<UClass>();
+
+	for (TFieldIterator<FProperty> It(Struct, EFieldIteratorFlags::IncludeSuper); It; ++It)
+	{
+		const FProperty* Property = *It;
+		if (bIsClass ? !Property->HasAnyPropertyFlags(CPF_SaveGame) : Property->HasAnyPropertyFlags(CPF_Transient))
+		{
+			continue;
+		}
+
+		if (Property->IsA<FDelegateProperty>() || Property->IsA<FMulticastDelegateProperty>())
+		{
+			continue;
+		}
+
+		const FTCHARToUTF8 Name(*Property->GetName());
+
+		FString ExtendedType;
+		const FString Type = Property->GetCPPType(&ExtendedType, 0);
+
+		FLayoutProperty& LayoutProperty = Layout->Properties.AddDefaulted_GetRef();
+		LayoutProperty.Property = Property;
+		LayoutProperty.NameHash = CityHash64(Name.Get(), Name.Length());
+		LayoutProperty.TypeHash = HashCombine(GetTypeHash(Type + ExtendedType), GetTypeHash(Property->GetSize()));
+		LayoutProperty.Offset = Property->GetOffset_ForInternal();
+		LayoutProperty.Size = Property->GetSize();
+		LayoutProperty.bIsPlainData = IsPlainData(Property);
+
+		Layout->SchemaHash = CityHash128to64({ Layout->SchemaHash, LayoutProperty.NameHash ^ LayoutProperty.TypeHash });
+
+		// Plain data that directly follows the previous run in memory joins it, so it's copied with the same memcpy.
+		FLayoutSegment* LastSegment = Layout->Segments.IsEmpty() ? nullptr : &Layout->Segments.Last();
+		if (LayoutProperty.bIsPlainData && LastSegment && !LastSegment->Property && LastSegment->Offset + LastSegment->Size == LayoutProperty.Offset)
+		{
+			LastSegment->Size += LayoutProperty.Size;
+			continue;
+		}
+
+		Layout->Segments.Add({ LayoutProperty.Offset, LayoutProperty.Size, LayoutProperty.bIsPlainData ? nullptr : Property });
+	}
+
+	return *Layout;
+}
+
+uint32 FCSSaveGameSerializer::GetLinkHash(const UStruct* Struct)
+{
+	// Relinking a type creates new properties or moves them, either changes the hash.
+	uint32 Hash = GetTypeHash(Struct->GetPropertiesSize());
+	for (const FProperty* Property = Struct->PropertyLink; Property; Property = Property->PropertyLinkNext)
+	{
+		Hash = HashCombineFast(Hash, HashCombineFast(PointerHash(Property), GetTypeHash(Property->GetOffset_ForInternal())));
+	}
+
+	return Hash;
+}
+
+bool FCSSaveGameSerializer::IsPlainData(const FProperty* Property)
+{
+	// Bools can be bitfields that share their byte with properties that aren't saved.
+	if (Property->IsA<FBoolProperty>())
+	{
+		return false;
+	}
+
+	if (Property->IsA<FNumericProperty>() || Property->IsA<FEnumProperty>())
+	{
+		return true;
+	}
+
+	// Names, objects and anything that owns memory have to be serialized, only structs of plain data can be copied.
+	const FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+	if (!StructProperty || !(StructProperty->Struct->StructFlags & STRUCT_IsPlainOldData))
+	{
+		return false;
+	}
+
+	for (TFieldIterator<FProperty> It(StructProperty->Struct); It; ++It)
+	{
+		if (!IsPlainData(*It))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void FCSSaveGameSerializer::WriteBlob(TConstArrayView<TPair<const UStruct*, const void*>> Records, TArray<uint8>& OutData)
+{
+	TArray<const FLayout*> Schemas;
+	TArray<int32> RecordSchemas;
+	RecordSchemas.Reserve(Records.Num());
+
+	for (const TPair<const UStruct*, const void*>& Record : Records)
+	{
+		RecordSchemas.Add(Record.Key ? Schemas.AddUnique(&GetLayout(Record.Key)) : INDEX_NONE);
+	}
+
+	FMemoryWriter Writer(OutData);
+	FObjectAndNameAsStringProxyArchive Ar(Writer, false);
+
+	uint32 Magic = SaveGameMagic;
+	uint32 Version = SaveGameVersion;
+	Ar << Magic << Version;
+
+	int32 NumSchemas = Schemas.Num();
+	Ar << NumSchemas;
+
+	for (const FLayout* Schema : Schemas)
+	{
+		uint64 SchemaHash = Schema->SchemaHash;
+		int32 NumProperties = Schema->Properties.Num();
+		Ar << SchemaHash << NumProperties;
+
+		for (const FLayoutProperty& Property : Schema->Properties)
+		{
+			uint64 NameHash = Property.NameHash;
+			uint32 TypeHash = Property.TypeHash;
+			int32 Size = Property.bIsPlainData ? Property.Size : SerializedPropertySize;
+			Ar << NameHash << TypeHash << Size;
+		}
+	}
+
+	int32 NumRecords = Records.Num();
+	Ar << NumRecords;
+
+	for (int32 Index = 0; Index < Records.Num(); ++Index)
+	{
+		int32 SchemaIndex = RecordSchemas[Index];
+		Ar << SchemaIndex;
+
+		// Patched once the record is written, so readers can skip records they have nothing to load into.
+		const int64 SizeOffset = Ar.Tell();
+		int32 RecordSize = 0;
+		Ar << RecordSize;
+
+		if (SchemaIndex != INDEX_NONE)
+		{
+			WriteRecord(Ar, *Schemas[SchemaIndex], Records[Index].Value);
+		}
+
+		const int64 EndOffset = Ar.Tell();
+		RecordSize = static_cast<int32>(EndOffset - SizeOffset - sizeof(int32));
+		Ar.Seek(SizeOffset);
+		Ar << RecordSize;
+		Ar.Seek(EndOffset);
+	}
+}
+
+bool FCSSaveGameSerializer::ReadBlob(TConstArrayView<TPair<const UStruct*, void*>> Records, TConstArrayView<uint8> Data)
+{
+	FMemoryReaderView Reader(Data);
+	FObjectAndNameAsStringProxyArchive Ar(Reader, true);
+
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	Ar << Magic << Version;
+
+	if (Ar.IsError() || Magic != SaveGameMagic || Version > SaveGameVersion)
+	{
+		UE_LOG(LogUnrealSharp, Error, TEXT("Failed to load save data, it isn't save data or was saved by a newer version."));
+		return false;
+	}
+
+	int32 NumSchemas = 0;
+	Ar << NumSchemas;
+
+	if (Ar.IsError() || NumSchemas < 0 || NumSchemas > Data.Num())
+	{
+		UE_LOG(LogUnrealSharp, Error, TEXT("Failed to load save data, its schema is corrupt."));
+		return false;
+	}
+
+	TArray<FSavedSchema> Schemas;
+	Schemas.SetNum(NumSchemas);
+
+	for (FSavedSchema& Schema : Schemas)
+	{
+		int32 NumProperties = 0;
+		Ar << Schema.SchemaHash << NumProperties;
+
+		if (Ar.IsError() || NumProperties < 0 || NumProperties > Data.Num())
+		{
+			UE_LOG(LogUnrealSharp, Error, TEXT("Failed to load save data, its schema is corrupt."));
+			return false;
+		}
+
+		Schema.Properties.SetNumZeroed(NumProperties);
+		for (FLayoutProperty& Property : Schema.Properties)
+		{
+			Ar << Property.NameHash << Property.TypeHash << Property.Size;
+			Property.bIsPlainData = Property.Size != SerializedPropertySize;
+
+			if (Ar.IsError() || (Property.bIsPlainData && (Property.Size < 0 || Property.Size > Data.Num())))
+			{
+				UE_LOG(LogUnrealSharp, Error, TEXT("Failed to load save data, its schema is corrupt."));
+				return false;
+			}
+		}
+	}
+
+	int32 NumRecords = 0;
+	Ar << NumRecords;
+
+	if (Ar.IsError() || NumRecords != Records.Num())
+	{
+		UE_LOG(LogUnrealSharp, Error, TEXT("Failed to load save data, it holds %d records but %d were requested."), NumRecords, Records.Num());
+		return false;
+	}
+
+	for (const TPair<const UStruct*, void*>& Record : Records)
+	{
+		int32 SchemaIndex = INDEX_NONE;
+		int32 RecordSize = 0;
+		Ar << SchemaIndex << RecordSize;
+
+		const int64 EndOffset = Ar.Tell() + RecordSize;
+		if (Ar.IsError() || RecordSize < 0 || EndOffset > Ar.TotalSize())
+		{
+			UE_LOG(LogUnrealSharp, Error, TEXT("Failed to load save data, a record is corrupt."));
+			return false;
+		}
+
+		if (Record.Key && Schemas.IsValidIndex(SchemaIndex))
+		{
+			ReadRecord(Ar, GetLayout(Record.Key), Schemas[SchemaIndex], Record.Value, EndOffset);
+		}
+
+		if (Ar.IsError() || Ar.Tell() > EndOffset)
+		{
+			UE_LOG(LogUnrealSharp, Error, TEXT("Failed to load save data, a record is corrupt."));
+			return false;
+		}
+
+		Ar.Seek(EndOffset);
+	}
+
+	return !Ar.IsError();
+}
+
+void FCSSaveGameSerializer::WriteRecord(FArchive& Ar, const FLayout& Layout, const void* Container)
+{
+	// The archive only reads from the container when saving.
+	void* MutableContainer = const_cast<void*>(Container);
+
+	for (const FLayoutSegment& Segment : Layout.Segments)
+	{
+		if (!Segment.Property)
+		{
+			Ar.Serialize(static_cast<uint8*>(MutableContainer) + Segment.Offset, Segment.Size);
+			continue;
+		}
+
+		const int64 LengthOffset = Ar.Tell();
+		int32 Length = 0;
+		Ar << Length;
+
+		SerializeProperty(Ar, Segment.Property, MutableContainer);
+
+		const int64 EndOffset = Ar.Tell();
+		Length = static_cast<int32>(EndOffset - LengthOffset - sizeof(int32));
+		Ar.Seek(LengthOffset);
+		Ar << Length;
+		Ar.Seek(EndOffset);
+	}
+}
+
+void FCSSaveGameSerializer::ReadRecord(FArchive& Ar, const FLayout& Layout, const FSavedSchema& Schema, void* Container, int64 RecordEnd)
+{
+	if (Schema.SchemaHash == Layout.SchemaHash)
+	{
+		// Saved by the same version of the type, the data is in the order of the segments.
+		for (const FLayoutSegment& Segment : Layout.Segments)
+		{
+			if (!Segment.Property)
+			{
+				if (!CheckFitsRecord(Ar, Segment.Size, RecordEnd))
+				{
+					return;
+				}
+
+				Ar.Serialize(static_cast<uint8*>(Container) + Segment.Offset, Segment.Size);
+				continue;
+			}
+
+			const int64 EndOffset = ReadSerializedLength(Ar, RecordEnd);
+			if (EndOffset == INDEX_NONE)
+			{
+				return;
+			}
+
+			SerializeProperty(Ar, Segment.Property, Container);
+			if (!SeekToPropertyEnd(Ar, EndOffset))
+			{
+				return;
+			}
+		}
+
+		return;
+	}
+
+	// The type changed since the data was saved, load what still matches by name and type.
+	TMap<uint64, const FLayoutProperty*> CurrentProperties;
+	CurrentProperties.Reserve(Layout.Properties.Num());
+	for (const FLayoutProperty& Property : Layout.Properties)
+	{
+		CurrentProperties.Add(Property.NameHash, &Property);
+	}
+
+	for (const FLayoutProperty& SavedProperty : Schema.Properties)
+	{
+		const FLayoutProperty* const* FoundProperty = CurrentProperties.Find(SavedProperty.NameHash);
+		const FLayoutProperty* CurrentProperty = FoundProperty && (*FoundProperty)->TypeHash == SavedProperty.TypeHash ? *FoundProperty : nullptr;
+
+		if (SavedProperty.bIsPlainData)
+		{
+			if (!CheckFitsRecord(Ar, SavedProperty.Size, RecordEnd))
+			{
+				return;
+			}
+
+			if (CurrentProperty && CurrentProperty->bIsPlainData && CurrentProperty->Size == SavedProperty.Size)
+			{
+				Ar.Serialize(static_cast<uint8*>(Container) + CurrentProperty->Offset, CurrentProperty->Size);
+			}
+			else
+			{
+				Ar.Seek(Ar.Tell() + SavedProperty.Size);
+			}
+			continue;
+		}
+
+		const int64 EndOffset = ReadSerializedLength(Ar, RecordEnd);
+		if (EndOffset == INDEX_NONE)
+		{
+			return;
+		}
+
+		if (CurrentProperty && !CurrentProperty->bIsPlainData)
+		{
+			SerializeProperty(Ar, CurrentProperty->Property, Container);
+		}
+
+		if (!SeekToPropertyEnd(Ar, EndOffset))
+		{
+			return;
+		}
+	}
+}
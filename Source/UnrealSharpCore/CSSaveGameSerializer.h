@@ -0,0 +1,81 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+/**
+ * Binary save data for objects and structs, without tagged property serialization. Objects save their SaveGame
+ * properties, structs save all of their non-transient properties.
+ *
+ * Properties are written in the order of a layout built once per type. Runs of plain data are copied with a single
+ * memcpy, everything else goes through SerializeItem with object and name references saved as strings.
+ * Each blob starts with the schema of the types it holds, keyed by property name hash, so data saved by an older
+ * version of a type still loads: properties that were removed or changed type are skipped, new ones keep their value.
+ *
+ * Data is validated as it's read, a blob whose records or properties run past their end fails to load instead of being read out of bounds.
+ *
+ * Game thread only.
+ */
+class UNREALSHARPCORE_API FCSSaveGameSerializer
+{
+public:
+	static void SaveObjects(TConstArrayView<UObject*> Objects, TArray<uint8>& OutData);
+
+	// Loads the records of Data into Objects, in the order they were saved in. Returns false if Data isn't save data or
+	// doesn't hold one record per object.
+	static bool LoadObjects(TConstArrayView<UObject*> Objects, TConstArrayView<uint8> Data);
+
+	static void SaveStruct(const UScriptStruct* Struct, const void* StructData, TArray<uint8>& OutData);
+	static bool LoadStruct(const UScriptStruct* Struct, void* StructData, TConstArrayView<uint8> Data);
+
+	// Drops every cached layout. Called when an assembly unloads, since its types are about to be rebuilt.
+	static void Reset();
+
+private:
+	struct FLayoutProperty
+	{
+		const FProperty* Property;
+		uint64 NameHash;
+		uint32 TypeHash;
+		int32 Offset;
+		int32 Size;
+		bool bIsPlainData;
+	};
+
+	// A run of adjacent plain data properties, or a single property that has to be serialized.
+	struct FLayoutSegment
+	{
+		int32 Offset;
+		int32 Size;
+		const FProperty* Property;
+	};
+
+	struct FLayout
+	{
+		TArray<FLayoutProperty> Properties;
+		TArray<FLayoutSegment> Segments;
+		uint64 SchemaHash = 0;
+
+		// The layout is built again when the type is rebuilt, which creates new properties, or when it's gone.
+		TWeakObjectPtr<const UStruct> Struct;
+		uint32 LinkHash = 0;
+	};
+
+	struct FSavedSchema
+	{
+		uint64 SchemaHash = 0;
+		TArray<FLayoutProperty> Properties;
+	};
+
+	static const FLayout& GetLayout(const UStruct* Struct);
+	static uint32 GetLinkHash(const UStruct* Struct);
+	static bool IsPlainData(const FProperty* Property);
+
+	static void WriteBlob(TConstArrayView<TPair<const UStruct*, const void*>> Records, TArray<uint8>& OutData);
+	static bool ReadBlob(TConstArrayView<TPair<const UStruct*, void*>> Records, TConstArrayView<uint8> Data);
+
+	static void WriteRecord(FArchive& Ar, const FLayout& Layout, const void* Container);
+	static void ReadRecord(FArchive& Ar, const FLayout& Layout, const FSavedSchema& Schema, void* Container, int64 RecordEnd);
+
+	static TMap<TObjectKey<UStruct>, TUniquePtr<FLayout>> Layouts;
+};
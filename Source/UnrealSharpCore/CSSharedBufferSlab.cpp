@@ -0,0 +1,115 @@
+#include "CSSharedBufferSlab.h"
+#include "Containers/LockFreeList.h"
+#include "CSInteropAllocationTracker.h"
+#include "GCOptimizations/CSGCPressureMonitor.h"
+
+namespace
+{
+	// Size classes go from 4 KB to 4 MB, anything larger is allocated and freed on demand.
+	constexpr int32 MinSizeClassShift = 12;
+	constexpr int32 NumSizeClasses = 11;
+
+	// Each size class caches at most this many bytes worth of released buffers.
+	constexpr int64 MaxCachedBytesPerClass = 16 * 1024 * 1024;
+
+	struct FSizeClassFreeList
+	{
+		TLockFreePointerListUnordered<FCSSharedBufferSlab::FBuffer, PLATFORM_CACHE_LINE_SIZE> Buffers;
+		std::atomic<int32> NumCached { 0 };
+	};
+
+	FSizeClassFreeList* GetFreeLists()
+	{
+		static FSizeClassFreeList FreeLists[NumSizeClasses];
+		return FreeLists;
+	}
+
+	int32 GetSizeClass(int64 Size)
+	{
+		const int32 SizeClass = FMath::Max(static_cast<int32>(FMath::CeilLogTwo64(Size)) - MinSizeClassShift, 0);
+		return SizeClass < NumSizeClasses ? SizeClass : INDEX_NONE;
+	}
+
+	int32 GetMaxCachedBuffers(int32 SizeClass)
+	{
+		return FMath::Max<int32>(MaxCachedBytesPerClass >> (SizeClass + MinSizeClassShift), 2);
+	}
+
+	FCSSharedBufferSlab::FBuffer* AllocateBuffer(int64 Capacity, int32 SizeClass)
+	{
+		void* Memory = FMemory::Malloc(sizeof(FCSSharedBufferSlab::FBuffer) + Capacity, alignof(FCSSharedBufferSlab::FBuffer));
+		CS_TRACK_INTEROP_ALLOCATION("FCSSharedBufferSlab", "AllocateBuffer", sizeof(FCSSharedBufferSlab::FBuffer) + Capacity);
+		FCSSharedBufferSlab::FBuffer* Buffer = static_cast<FCSSharedBufferSlab::FBuffer*>(Memory);
+		new (&Buffer->RefCount) std::atomic<int32>(0);
+		Buffer->SizeClass = SizeClass;
+		Buffer->Capacity = Capacity;
+		return Buffer;
+	}
+}
+
+FCSSharedBufferSlab::FBuffer* FCSSharedBufferSlab::Acquire(int64 Size)
+{
+	check(Size >= 0);
+	const int32 SizeClass = GetSizeClass(FMath::Max<int64>(Size, 1));
+
+	FBuffer* Buffer = nullptr;
+	if (SizeClass == INDEX_NONE)
+	{
+		Buffer = AllocateBuffer(Size, INDEX_NONE);
+	}
+	else
+	{
+		FSizeClassFreeList& FreeList = GetFreeLists()[SizeClass];
+		Buffer = FreeList.Buffers.Pop();
+
+		if (Buffer)
+		{
+			FreeList.NumCached.fetch_sub(1, std::memory_order_relaxed);
+		}
+		else
+		{
+			Buffer = AllocateBuffer(static_cast<int64>(1) << (SizeClass + MinSizeClassShift), SizeClass);
+		}
+	}
+
+	Buffer->RefCount.store(1, std::memory_order_relaxed);
+	FCSGCPressureMonitor::TrackSharedBuffer(Buffer->Capacity);
+	return Buffer;
+}
+
+void FCSSharedBufferSlab::Release(FBuffer* Buffer)
+{
+	if (Buffer->RefCount.fetch_sub(1, std::memory_order_acq_rel) != 1)
+	{
+		return;
+	}
+
+	FCSGCPressureMonitor::UntrackSharedBuffer(Buffer->Capacity);
+
+	if (Buffer->SizeClass != INDEX_NONE)
+	{
+		FSizeClassFreeList& FreeList = GetFreeLists()[Buffer->SizeClass];
+		if (FreeList.NumCached.fetch_add(1, std::memory_order_relaxed) < GetMaxCachedBuffers(Buffer->SizeClass))
+		{
+			FreeList.Buffers.Push(Buffer);
+			return;
+		}
+
+		FreeList.NumCached.fetch_sub(1, std::memory_order_relaxed);
+	}
+
+	FMemory::Free(Buffer);
+}
+
+void FCSSharedBufferSlab::Trim()
+{
+	for (int32 SizeClass = 0; SizeClass < NumSizeClasses; ++SizeClass)
+	{
+		FSizeClassFreeList& FreeList = GetFreeLists()[SizeClass];
+		while (FBuffer* Buffer = FreeList.Buffers.Pop())
+		{
+			FreeList.NumCached.fetch_sub(1, std::memory_order_relaxed);
+			FMemory::Free(Buffer);
+		}
+	}
+}
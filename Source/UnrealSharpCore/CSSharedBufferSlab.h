@@ -0,0 +1,36 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+/**
+ * Native-owned buffers that C# and C++ read and write in place, for payloads that stream across the boundary
+ * every frame like replay frames, telemetry batches and procedural mesh data.
+ * The memory lives outside the managed heap, so it never has to be pinned and the .NET GC never has to move or scan it.
+ * Buffers are reference counted, either side can keep one alive past the call that handed it over.
+ * Released buffers are cached per power of two size class and handed out again.
+ */
+class UNREALSHARPCORE_API FCSSharedBufferSlab
+{
+public:
+	struct alignas(64) FBuffer
+	{
+		std::atomic<int32> RefCount;
+		int32 SizeClass;
+		int64 Capacity;
+
+		uint8* GetData() { return reinterpret_cast<uint8*>(this + 1); }
+	};
+
+	// Returns a buffer with a reference count of one and room for at least Size bytes. The contents are uninitialized.
+	static FBuffer* Acquire(int64 Size);
+
+	static void AddRef(FBuffer* Buffer) { Buffer->RefCount.fetch_add(1, std::memory_order_relaxed); }
+	static void Release(FBuffer* Buffer);
+
+	// Managed code only sees the data pointer.
+	static FBuffer* FromData(void* Data) { return static_cast<FBuffer*>(Data) - 1; }
+
+	// Drops the cached buffers, live ones are left alone.
+	static void Trim();
+};
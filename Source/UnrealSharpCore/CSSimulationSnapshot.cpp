@@ -0,0 +1,280 @@
+#include "CSSimulationSnapshot.h"
+#include "UnrealSharpCore.h"
+#include "Logging/StructuredLog.h"
+#include "UObject/EnumProperty.h"
+#include "UObject/UnrealType.h"
+#include "Utils/CSClassUtilities.h"
+
+namespace
+{
+	constexpr int32 SlotAlignment = 16;
+}
+
+FCSSimulationSnapshot::FCSSimulationSnapshot(TConstArrayView<UObject*> Objects)
+{
+	check(IsInGameThread());
+	TRACE_CPUPROFILER_EVENT_SCOPE(FCSSimulationSnapshot::FCSSimulationSnapshot);
+
+	Entries.Reserve(Objects.Num());
+
+	for (UObject* Object : Objects)
+	{
+		if (!IsValid(Object))
+		{
+			continue;
+		}
+
+		const FLayout& Layout = FindOrAddLayout(Object->GetClass());
+		if (Layout.Segments.IsEmpty())
+		{
+			continue;
+		}
+
+		Entries.Add({ Object, Object->GetClass(), &Layout, StateSize });
+		StateSize += Layout.Size;
+	}
+}
+
+FCSSimulationSnapshot::~FCSSimulationSnapshot()
+{
+	for (FSlot& Slot : Slots)
+	{
+		DestroySlot(Slot);
+	}
+}
+
+void FCSSimulationSnapshot::Save(int32 Slot)
+{
+	check(IsInGameThread());
+	check(Slot >= 0);
+	TRACE_CPUPROFILER_EVENT_SCOPE(FCSSimulationSnapshot::Save);
+
+	if (Slot >= Slots.Num())
+	{
+		Slots.SetNum(Slot + 1);
+	}
+
+	FSlot& SavedSlot = Slots[Slot];
+	if (SavedSlot.Data.IsEmpty() && StateSize > 0)
+	{
+		SavedSlot.Data.SetNumZeroed(StateSize);
+		InitializeSlot(SavedSlot);
+	}
+
+	for (const FEntry& Entry : Entries)
+	{
+		const UObject* Object = Entry.Object.Get();
+		if (!Object || Object->GetClass() != Entry.Class)
+		{
+			continue;
+		}
+
+		const uint8* ObjectData = reinterpret_cast<const uint8*>(Object);
+		uint8* EntryData = SavedSlot.Data.GetData() + Entry.BufferOffset;
+
+		for (const FLayoutSegment& Segment : Entry.Layout->Segments)
+		{
+			if (Segment.Property)
+			{
+				Segment.Property->CopyCompleteValue(EntryData + Segment.BufferOffset, ObjectData + Segment.ObjectOffset);
+			}
+			else
+			{
+				FMemory::Memcpy(EntryData + Segment.BufferOffset, ObjectData + Segment.ObjectOffset, Segment.Size);
+			}
+		}
+	}
+
+	SavedSlot.bSaved = true;
+}
+
+bool FCSSimulationSnapshot::Restore(int32 Slot) const
+{
+	check(IsInGameThread());
+	TRACE_CPUPROFILER_EVENT_SCOPE(FCSSimulationSnapshot::Restore);
+
+	if (!Slots.IsValidIndex(Slot) || !Slots[Slot].bSaved)
+	{
+		return false;
+	}
+
+	const FSlot& SavedSlot = Slots[Slot];
+	bool bRestoredAll = true;
+
+	for (const FEntry& Entry : Entries)
+	{
+		UObject* Object = Entry.Object.Get();
+		if (!Object || Object->GetClass() != Entry.Class)
+		{
+			bRestoredAll = false;
+			continue;
+		}
+
+		uint8* ObjectData = reinterpret_cast<uint8*>(Object);
+		const uint8* EntryData = SavedSlot.Data.GetData() + Entry.BufferOffset;
+
+		for (const FLayoutSegment& Segment : Entry.Layout->Segments)
+		{
+			if (Segment.Property)
+			{
+				Segment.Property->CopyCompleteValue(ObjectData + Segment.ObjectOffset, EntryData + Segment.BufferOffset);
+			}
+			else
+			{
+				FMemory::Memcpy(ObjectData + Segment.ObjectOffset, EntryData + Segment.BufferOffset, Segment.Size);
+			}
+		}
+	}
+
+	return bRestoredAll;
+}
+
+void FCSSimulationSnapshot::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	for (FEntry& Entry : Entries)
+	{
+		// Keeps the properties of the layout alive.
+		Collector.AddReferencedObject(Entry.Class);
+	}
+
+	for (FSlot& Slot : Slots)
+	{
+		if (Slot.Data.IsEmpty())
+		{
+			continue;
+		}
+
+		for (const FEntry& Entry : Entries)
+		{
+			for (const int32 SegmentIndex : Entry.Layout->ObjectSegments)
+			{
+				const FLayoutSegment& Segment = Entry.Layout->Segments[SegmentIndex];
+				TObjectPtr<UObject>* References = reinterpret_cast<TObjectPtr<UObject>*>(Slot.Data.GetData() + Entry.BufferOffset + Segment.BufferOffset);
+
+				for (int32 Index = 0; Index < Segment.Property->ArrayDim; ++Index)
+				{
+					Collector.AddReferencedObject(References[Index]);
+				}
+			}
+		}
+	}
+}
+
+const FCSSimulationSnapshot::FLayout& FCSSimulationSnapshot::FindOrAddLayout(UClass* Class)
+{
+	TUniquePtr<FLayout>& Layout = Layouts.FindOrAdd(Class);
+	if (Layout.IsValid())
+	{
+		return *Layout;
+	}
+
+	Layout = MakeUnique<FLayout>();
+
+	for (TFieldIterator<FProperty> It(Class, EFieldIteratorFlags::IncludeSuper); It; ++It)
+	{
+		const FProperty* Property = *It;
+
+		// Only the state C# declared, the native state of the object is up to its class.
+		const UClass* OwnerClass = Property->GetOwnerClass();
+		if (!OwnerClass || !FCSClassUtilities::IsManagedClass(OwnerClass))
+		{
+			continue;
+		}
+
+		if (Property->IsA<FDelegateProperty>() || Property->IsA<FMulticastDelegateProperty>())
+		{
+			continue;
+		}
+
+		const bool bIsObjectProperty = Property->IsA<FObjectProperty>();
+		TArray<const FStructProperty*> EncounteredStructProperties;
+		if (!bIsObjectProperty && Property->ContainsObjectReference(EncounteredStructProperties))
+		{
+			UE_LOGFMT(LogUnrealSharp, Warning, "{0}.{1} holds object references the simulation snapshot can't keep alive, it isn't saved",
+				*Class->GetName(), *Property->GetName());
+			continue;
+		}
+
+		const int32 ObjectOffset = Property->GetOffset_ForInternal();
+		const int32 Size = Property->GetSize();
+
+		// Plain data that directly follows the previous run in memory joins it, so it's copied with the same memcpy.
+		if (IsPlainData(Property))
+		{
+			FLayoutSegment* LastSegment = Layout->Segments.IsEmpty() ? nullptr : &Layout->Segments.Last();
+			if (LastSegment && !LastSegment->Property && LastSegment->ObjectOffset + LastSegment->Size == ObjectOffset)
+			{
+				LastSegment->Size += Size;
+				Layout->Size += Size;
+				continue;
+			}
+
+			Layout->Segments.Add({ ObjectOffset, Layout->Size, Size, nullptr });
+			Layout->Size += Size;
+			continue;
+		}
+
+		Layout->Size = Align(Layout->Size, Property->GetMinAlignment());
+		const int32 SegmentIndex = Layout->Segments.Add({ ObjectOffset, Layout->Size, Size, Property });
+		Layout->Size += Size;
+
+		if (bIsObjectProperty)
+		{
+			Layout->ObjectSegments.Add(SegmentIndex);
+		}
+	}
+
+	// Keeps the values of the next entry aligned.
+	Layout->Size = Align(Layout->Size, SlotAlignment);
+	return *Layout;
+}
+
+bool FCSSimulationSnapshot::IsPlainData(const FProperty* Property)
+{
+	// Bools can be bitfields that share their byte with properties that aren't saved.
+	if (Property->IsA<FBoolProperty>() || Property->IsA<FObjectProperty>())
+	{
+		return false;
+	}
+
+	if (Property->IsA<FNumericProperty>() || Property->IsA<FEnumProperty>())
+	{
+		return true;
+	}
+
+	const FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+	return StructProperty && (StructProperty->Struct->StructFlags & STRUCT_IsPlainOldData);
+}
+
+void FCSSimulationSnapshot::InitializeSlot(FSlot& Slot) const
+{
+	for (const FEntry& Entry : Entries)
+	{
+		for (const FLayoutSegment& Segment : Entry.Layout->Segments)
+		{
+			if (Segment.Property)
+			{
+				Segment.Property->InitializeValue(Slot.Data.GetData() + Entry.BufferOffset + Segment.BufferOffset);
+			}
+		}
+	}
+}
+
+void FCSSimulationSnapshot::DestroySlot(FSlot& Slot) const
+{
+	if (Slot.Data.IsEmpty())
+	{
+		return;
+	}
+
+	for (const FEntry& Entry : Entries)
+	{
+		for (const FLayoutSegment& Segment : Entry.Layout->Segments)
+		{
+			if (Segment.Property)
+			{
+				Segment.Property->DestroyValue(Slot.Data.GetData() + Entry.BufferOffset + Segment.BufferOffset);
+			}
+		}
+	}
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/GCObject.h"
+
+/**
+ * Saves and restores the C# declared properties of a fixed set of objects, for rollback and lock-step simulation.
+ * Every object gets a region of one contiguous buffer per slot, laid out once per class. Runs of plain data are copied with
+ * a single memcpy, everything else is copied into a value constructed in the buffer. Object references are kept alive
+ * while a slot holds them, properties that reference objects from within structs or containers are left out.
+ * Delegates are never saved.
+ *
+ * Objects that are destroyed, or whose class was rebuilt since the snapshot was created, are skipped by Restore.
+ * Game thread only.
+ */
+class UNREALSHARPCORE_API FCSSimulationSnapshot : public FGCObject
+{
+public:
+	explicit FCSSimulationSnapshot(TConstArrayView<UObject*> Objects);
+	virtual ~FCSSimulationSnapshot() override;
+
+	// Saves the current state of every object into the slot, creating it the first time.
+	void Save(int32 Slot);
+
+	// Copies the state saved in the slot back into the objects. Returns false if the slot was never saved or an object was skipped.
+	bool Restore(int32 Slot) const;
+
+	// Bytes one slot takes.
+	int32 GetStateSize() const { return StateSize; }
+
+	// FGCObject interface implementation
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+	virtual FString GetReferencerName() const override { return TEXT("FCSSimulationSnapshot"); }
+	// End of FGCObject interface implementation
+
+private:
+	// A run of adjacent plain data properties, or a single property that is copied into a value of its own.
+	struct FLayoutSegment
+	{
+		int32 ObjectOffset;
+		int32 BufferOffset;
+		int32 Size;
+		const FProperty* Property;
+	};
+
+	struct FLayout
+	{
+		TArray<FLayoutSegment> Segments;
+		// Segments of object properties, reported to the GC for every saved slot.
+		TArray<int32> ObjectSegments;
+		int32 Size = 0;
+	};
+
+	struct FEntry
+	{
+		TWeakObjectPtr<UObject> Object;
+		TObjectPtr<UClass> Class;
+		const FLayout* Layout;
+		int32 BufferOffset;
+	};
+
+	struct FSlot
+	{
+		TArray<uint8, TAlignedHeapAllocator<16>> Data;
+		bool bSaved = false;
+	};
+
+	const FLayout& FindOrAddLayout(UClass* Class);
+	static bool IsPlainData(const FProperty* Property);
+
+	// Constructs or destroys the values of the slot that aren't plain data.
+	void InitializeSlot(FSlot& Slot) const;
+	void DestroySlot(FSlot& Slot) const;
+
+	TArray<FEntry> Entries;
+	TArray<FSlot> Slots;
+
+	// Layouts of the classes of the entries, built when the snapshot is created.
+	TMap<UClass*, TUniquePtr<FLayout>> Layouts;
+
+	int32 StateSize = 0;
+};
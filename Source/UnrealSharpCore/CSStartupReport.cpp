@@ -0,0 +1,166 @@
+#include "CSStartupReport.h"
+#include "UnrealSharpCore.h"
+#include "Dom/JsonObject.h"
+#include "Logging/StructuredLog.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Serialization/JsonSerializer.h"
+
+FCSStartupReport& FCSStartupReport::Get()
+{
+	static FCSStartupReport Instance;
+	return Instance;
+}
+
+int32 FCSStartupReport::BeginPhase(const FString& PhaseName)
+{
+	if (!bIsRecording || !IsInGameThread())
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 PhaseIndex = Phases.Add({ PhaseName, CurrentDepth, FPlatformTime::Seconds(), 0.0 });
+	++CurrentDepth;
+	return PhaseIndex;
+}
+
+void FCSStartupReport::EndPhase(int32 PhaseIndex)
+{
+	if (!Phases.IsValidIndex(PhaseIndex))
+	{
+		return;
+	}
+
+	FPhase& Phase = Phases[PhaseIndex];
+	Phase.Duration = FPlatformTime::Seconds() - Phase.StartTime;
+	--CurrentDepth;
+}
+
+void FCSStartupReport::AddTypeBuildTime(const FString& TypeName, double Seconds)
+{
+	if (bIsRecording && IsInGameThread())
+	{
+		TypeBuildTimes.Add({ TypeName, Seconds });
+	}
+}
+
+void FCSStartupReport::Finish()
+{
+	if (!bIsRecording)
+	{
+		return;
+	}
+
+	bIsRecording = false;
+	
+	const double TotalTime = FPlatformTime::Seconds() - StartTime;
+	UE_LOGFMT(LogUnrealSharp, Display, "UnrealSharp started in {0} ms", FMath::RoundToInt(TotalTime * 1000.0));
+
+	for (const FPhase& Phase : Phases)
+	{
+		UE_LOGFMT(LogUnrealSharp, Display, "  {0}{1}: {2} ms", FString::ChrN(Phase.Depth * 2, TEXT(' ')), Phase.Name, FMath::RoundToInt(Phase.Duration * 1000.0));
+	}
+
+	TypeBuildTimes.Sort([](const FTypeBuildTime& A, const FTypeBuildTime& B)
+	{
+		return A.Duration > B.Duration;
+	});
+
+	constexpr int32 NumSlowestTypesToLog = 10;
+	if (!TypeBuildTimes.IsEmpty())
+	{
+		double TotalTypeTime = 0.0;
+		for (const FTypeBuildTime& TypeBuildTime : TypeBuildTimes)
+		{
+			TotalTypeTime += TypeBuildTime.Duration;
+		}
+
+		UE_LOGFMT(LogUnrealSharp, Display, "  Built {0} types in {1} ms, slowest:", TypeBuildTimes.Num(), FMath::RoundToInt(TotalTypeTime * 1000.0));
+		
+		for (int32 i = 0; i < FMath::Min(NumSlowestTypesToLog, TypeBuildTimes.Num()); ++i)
+		{
+			UE_LOGFMT(LogUnrealSharp, Display, "    {0}: {1} ms", TypeBuildTimes[i].TypeName, TypeBuildTimes[i].Duration * 1000.0);
+		}
+	}
+
+	LastReport = BuildReport();
+
+	FString ReportString;
+	FJsonSerializer::Serialize(LastReport.ToSharedRef(), TJsonWriterFactory<>::Create(&ReportString));
+	
+	const FString ReportPath = FPaths::ProjectSavedDir() / TEXT("UnrealSharp") / TEXT("StartupReport.json");
+	FFileHelper::SaveStringToFile(ReportString, *ReportPath);
+
+	Phases.Empty();
+	TypeBuildTimes.Empty();
+}
+
+void FCSStartupReport::Restart()
+{
+	Phases.Empty();
+	TypeBuildTimes.Empty();
+	CurrentDepth = 0;
+	StartTime = FPlatformTime::Seconds();
+	bIsRecording = true;
+}
+
+TSharedRef<FJsonObject> FCSStartupReport::BuildReport() const
+{
+	TSharedRef<FJsonObject> Report = MakeShared<FJsonObject>();
+	Report->SetNumberField(TEXT("TotalMs"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+	TArray<TSharedPtr<FJsonValue>> PhaseValues;
+	PhaseValues.Reserve(Phases.Num());
+	
+	for (const FPhase& Phase : Phases)
+	{
+		TSharedRef<FJsonObject> PhaseObject = MakeShared<FJsonObject>();
+		PhaseObject->SetStringField(TEXT("Name"), Phase.Name);
+		PhaseObject->SetNumberField(TEXT("Depth"), Phase.Depth);
+		PhaseObject->SetNumberField(TEXT("StartMs"), (Phase.StartTime - StartTime) * 1000.0);
+		PhaseObject->SetNumberField(TEXT("DurationMs"), Phase.Duration * 1000.0);
+		PhaseValues.Add(MakeShared<FJsonValueObject>(PhaseObject));
+	}
+	
+	Report->SetArrayField(TEXT("Phases"), PhaseValues);
+
+	TArray<TSharedPtr<FJsonValue>> TypeValues;
+	TypeValues.Reserve(TypeBuildTimes.Num());
+	
+	for (const FTypeBuildTime& TypeBuildTime : TypeBuildTimes)
+	{
+		TSharedRef<FJsonObject> TypeObject = MakeShared<FJsonObject>();
+		TypeObject->SetStringField(TEXT("Name"), TypeBuildTime.TypeName);
+		TypeObject->SetNumberField(TEXT("DurationMs"), TypeBuildTime.Duration * 1000.0);
+		TypeValues.Add(MakeShared<FJsonValueObject>(TypeObject));
+	}
+	
+	Report->SetArrayField(TEXT("Types"), TypeValues);
+	return Report;
+}
+
+FCSScopedStartupPhase::FCSScopedStartupPhase(const FString& PhaseName)
+{
+#if CPUPROFILERTRACE_ENABLED
+	if (UE_TRACE_CHANNELEXPR_IS_ENABLED(CpuChannel))
+	{
+		FCpuProfilerTrace::OutputBeginDynamicEvent(*PhaseName);
+		bTraceEvent = true;
+	}
+#endif
+	
+	PhaseIndex = FCSStartupReport::Get().BeginPhase(PhaseName);
+}
+
+FCSScopedStartupPhase::~FCSScopedStartupPhase()
+{
+	FCSStartupReport::Get().EndPhase(PhaseIndex);
+	
+#if CPUPROFILERTRACE_ENABLED
+	if (bTraceEvent)
+	{
+		FCpuProfilerTrace::OutputEndEvent();
+	}
+#endif
+}
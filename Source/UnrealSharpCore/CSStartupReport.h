@@ -0,0 +1,72 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FJsonObject;
+
+/**
+ * Breaks the startup of UnrealSharp down into phases, from loading the runtime host to building the managed types.
+ * Every phase shows up in Unreal Insights. Until Finish is called the phases are also timed and,
+ * together with the slowest types to build, logged and written to Saved/UnrealSharp/StartupReport.json.
+ */
+class UNREALSHARPCORE_API FCSStartupReport
+{
+public:
+	static FCSStartupReport& Get();
+
+	bool IsRecording() const { return bIsRecording; }
+
+	int32 BeginPhase(const FString& PhaseName);
+	void EndPhase(int32 PhaseIndex);
+
+	void AddTypeBuildTime(const FString& TypeName, double Seconds);
+
+	// Stops recording, logs the report and writes it to disk.
+	void Finish();
+
+	// Starts recording again from scratch, for timing a later load like the boot benchmark's warm runs.
+	void Restart();
+
+	// The report written by the last Finish, null before that.
+	TSharedPtr<FJsonObject> GetLastReport() const { return LastReport; }
+
+private:
+
+	struct FPhase
+	{
+		FString Name;
+		int32 Depth;
+		double StartTime;
+		double Duration;
+	};
+
+	struct FTypeBuildTime
+	{
+		FString TypeName;
+		double Duration;
+	};
+
+	TSharedRef<FJsonObject> BuildReport() const;
+
+	TArray<FPhase> Phases;
+	TArray<FTypeBuildTime> TypeBuildTimes;
+	TSharedPtr<FJsonObject> LastReport;
+	int32 CurrentDepth = 0;
+	double StartTime = FPlatformTime::Seconds();
+	bool bIsRecording = true;
+};
+
+// Scope of a startup phase. Always emits an Insights event, only recorded while the startup report is.
+struct UNREALSHARPCORE_API FCSScopedStartupPhase
+{
+	explicit FCSScopedStartupPhase(const FString& PhaseName);
+	~FCSScopedStartupPhase();
+
+	UE_NONCOPYABLE(FCSScopedStartupPhase);
+	
+private:
+	int32 PhaseIndex = INDEX_NONE;
+#if CPUPROFILERTRACE_ENABLED
+	bool bTraceEvent = false;
+#endif
+};
@@ -0,0 +1,80 @@
+#include "CSSubsystemHandleCache.h"
+#include "CSManager.h"
+#include "Engine/World.h"
+#include "Subsystems/Subsystem.h"
+
+namespace
+{
+	using FCacheKey = TPair<TObjectKey<UObject>, TObjectKey<UClass>>;
+
+	struct FCachedSubsystem
+	{
+		TWeakObjectPtr<USubsystem> Subsystem;
+		void* ManagedHandle = nullptr;
+	};
+
+	TMap<FCacheKey, FCachedSubsystem> CachedSubsystems;
+	FDelegateHandle WorldCleanupHandle;
+
+	void OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+	{
+		// World subsystems deinitialize with their world, the other owners are dropped once their subsystems are gone.
+		const TObjectKey<UObject> WorldKey(World);
+		for (auto It = CachedSubsystems.CreateIterator(); It; ++It)
+		{
+			if (It->Key.Key == WorldKey || !It->Value.Subsystem.IsValid())
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+}
+
+void* FCSSubsystemHandleCache::FindOrAdd(const UObject* Owner, const UClass* SubsystemClass, TFunctionRef<USubsystem*()> GetSubsystem)
+{
+	if (!IsInGameThread())
+	{
+		return UCSManager::Get().FindManagedObject(GetSubsystem()).GetPointer();
+	}
+
+	const FCacheKey Key(Owner, SubsystemClass);
+	if (const FCachedSubsystem* CachedSubsystem = CachedSubsystems.Find(Key))
+	{
+		if (CachedSubsystem->Subsystem.IsValid())
+		{
+			return CachedSubsystem->ManagedHandle;
+		}
+
+		CachedSubsystems.Remove(Key);
+	}
+
+	USubsystem* Subsystem = GetSubsystem();
+	if (!Subsystem)
+	{
+		return nullptr;
+	}
+
+	void* ManagedHandle = UCSManager::Get().FindManagedObject(Subsystem).GetPointer();
+	if (!ManagedHandle)
+	{
+		return nullptr;
+	}
+
+	if (!WorldCleanupHandle.IsValid())
+	{
+		WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddStatic(&OnWorldCleanup);
+	}
+
+	CachedSubsystems.Add(Key, { Subsystem, ManagedHandle });
+	return ManagedHandle;
+}
+
+void FCSSubsystemHandleCache::Reset()
+{
+	CachedSubsystems.Reset();
+}
+
+int32 FCSSubsystemHandleCache::Num()
+{
+	return CachedSubsystems.Num();
+}
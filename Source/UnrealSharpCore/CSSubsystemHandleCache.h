@@ -0,0 +1,23 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class USubsystem;
+
+/**
+ * Managed counterparts of subsystems, keyed by the object that owns the subsystem collection and the subsystem class,
+ * so GetWorldSubsystem<T>() and friends in C# don't resolve the subsystem and look up its counterpart on every call.
+ * Entries go when their subsystem is gone, when the world they belong to is cleaned up,
+ * and all of them when an assembly is unloaded, since that replaces the managed counterparts.
+ * Only used on the game thread, other threads always take the slow path.
+ */
+class UNREALSHARPCORE_API FCSSubsystemHandleCache
+{
+public:
+	// Returns the managed handle of the subsystem of the class in Owner's collection, GetSubsystem resolves it on a miss.
+	static void* FindOrAdd(const UObject* Owner, const UClass* SubsystemClass, TFunctionRef<USubsystem*()> GetSubsystem);
+
+	static void Reset();
+
+	static int32 Num();
+};
@@ -0,0 +1,98 @@
+#include "CSTransientArena.h"
+#include "CSInteropAllocationTracker.h"
+
+FCSTransientArena::~FCSTransientArena()
+{
+	FBlock* Block = Head;
+	while (Block)
+	{
+		FBlock* Next = Block->Next;
+		FMemory::Free(Block);
+		Block = Next;
+	}
+}
+
+FCSTransientArena& FCSTransientArena::Get()
+{
+	static thread_local FCSTransientArena Arena;
+	return Arena;
+}
+
+void* FCSTransientArena::Allocate(int64 Size, int32 Alignment)
+{
+	check(Size >= 0 && FMath::IsPowerOfTwo(Alignment));
+	
+	ResetIfNewFrame();
+
+	while (Current)
+	{
+		const uint8* BlockData = GetBlockData(Current);
+		const int64 AlignedOffset = Align(reinterpret_cast<UPTRINT>(BlockData) + Offset, Alignment) - reinterpret_cast<UPTRINT>(BlockData);
+		
+		if (AlignedOffset + Size <= Current->Capacity)
+		{
+			Offset = AlignedOffset + Size;
+			return GetBlockData(Current) + AlignedOffset;
+		}
+
+		// Move on to the next block we already have, if it is large enough.
+		if (!Current->Next)
+		{
+			break;
+		}
+
+		Current = Current->Next;
+		Offset = 0;
+	}
+
+	// Oversized allocations get a block of their own, it stays in the chain and is reused like any other.
+	const int64 Capacity = FMath::Max(DefaultBlockSize, Size + Alignment);
+	FBlock* NewBlock = static_cast<FBlock*>(FMemory::Malloc(sizeof(FBlock) + Capacity, alignof(FBlock)));
+	CS_TRACK_INTEROP_ALLOCATION("FCSTransientArena", "AllocateBlock", sizeof(FBlock) + Capacity);
+	NewBlock->Next = nullptr;
+	NewBlock->Capacity = Capacity;
+
+	if (Current)
+	{
+		Current->Next = NewBlock;
+	}
+	else
+	{
+		Head = NewBlock;
+	}
+
+	Current = NewBlock;
+	Offset = 0;
+	return Allocate(Size, Alignment);
+}
+
+void FCSTransientArena::PushScope()
+{
+	ResetIfNewFrame();
+	Scopes.Add({ Current, Offset });
+}
+
+void FCSTransientArena::PopScope()
+{
+	check(!Scopes.IsEmpty());
+	RewindTo(Scopes.Pop());
+}
+
+void FCSTransientArena::RewindTo(const FMark& Mark)
+{
+	Current = Mark.Block ? Mark.Block : Head;
+	Offset = Mark.Block ? Mark.Offset : 0;
+}
+
+void FCSTransientArena::ResetIfNewFrame()
+{
+	// Memory of an open scope has to survive the frame boundary, it is released when the scope pops.
+	if (LastFrame == GFrameCounter || !Scopes.IsEmpty())
+	{
+		return;
+	}
+	
+	LastFrame = GFrameCounter;
+	Current = Head;
+	Offset = 0;
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Per-thread linear allocator for memory that only has to live for a call, or at most until the end of the frame.
+ * Allocations inside a scope are released when the scope is popped. Allocations outside of any scope are released
+ * by the first allocation of the next frame on the same thread. Memory is only ever handed out raw,
+ * constructing and destroying what is placed in it is up to the caller.
+ */
+class UNREALSHARPCORE_API FCSTransientArena
+{
+public:
+	~FCSTransientArena();
+
+	// The arena of the calling thread.
+	static FCSTransientArena& Get();
+
+	void* Allocate(int64 Size, int32 Alignment);
+
+	// Scopes nest. Popping releases everything allocated since the matching push.
+	void PushScope();
+	void PopScope();
+
+private:
+
+	struct FBlock
+	{
+		FBlock* Next;
+		int64 Capacity;
+		// Data follows
+	};
+
+	struct FMark
+	{
+		FBlock* Block;
+		int64 Offset;
+	};
+
+	static constexpr int64 DefaultBlockSize = 64 * 1024;
+
+	uint8* GetBlockData(FBlock* Block) const { return reinterpret_cast<uint8*>(Block + 1); }
+	void RewindTo(const FMark& Mark);
+	void ResetIfNewFrame();
+
+	// Blocks are kept once allocated and reused from the head on. Current is where allocations come from.
+	FBlock* Head = nullptr;
+	FBlock* Current = nullptr;
+	int64 Offset = 0;
+
+	TArray<FMark, TInlineAllocator<8>> Scopes;
+	uint64 LastFrame = 0;
+};
+
+// Releases everything allocated from the arena of the calling thread while the scope is alive.
+struct FCSTransientArenaScope
+{
+	FCSTransientArenaScope() { FCSTransientArena::Get().PushScope(); }
+	~FCSTransientArenaScope() { FCSTransientArena::Get().PopScope(); }
+
+	UE_NONCOPYABLE(FCSTransientArenaScope);
+};
@@ -0,0 +1,218 @@
+#include "CSTypeBuildProfiler.h"
+
+#if UNREALSHARP_PROFILE_TYPE_BUILDS
+
+#include "CSAssembly.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "TypeGenerator/CSInterface.h"
+#include "TypeGenerator/Register/MetaData/CSClassMetaData.h"
+#include "TypeGenerator/Register/MetaData/CSInterfaceMetaData.h"
+#include "TypeGenerator/Register/MetaData/CSPropertyMetaData.h"
+#include "TypeGenerator/Register/MetaData/CSStructMetaData.h"
+#include "TypeGenerator/Register/TypeInfo/CSManagedTypeInfo.h"
+#include "UObject/UObjectHash.h"
+#include "UnrealSharpCore.h"
+
+bool FCSTypeBuildProfiler::bEnabled = WITH_EDITOR;
+
+namespace
+{
+	// Keyed by the path of the type, which stays the same when a type is rebuilt.
+	TMap<FString, FCSTypeBuildRecord> Records;
+
+	FAutoConsoleVariableRef CVarProfileTypeBuilds(
+		TEXT("UnrealSharp.ProfileTypeBuilds"),
+		FCSTypeBuildProfiler::bEnabled,
+		TEXT("Records the time, size and reinstanced objects of every managed type build for UnrealSharp.TypeBuilds."));
+
+	void DumpTypeBuilds(const TArray<FString>& Args, UWorld*, FOutputDevice& Ar)
+	{
+		FCSTypeBuildProfiler::Dump(Args, Ar);
+	}
+
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice DumpTypeBuildsCommand(
+		TEXT("UnrealSharp.TypeBuilds"),
+		TEXT("Prints the build cost of the managed types, most expensive first. Takes the number of types to list, 30 by default."),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateStatic(&DumpTypeBuilds));
+
+	FAutoConsoleCommand ExportTypeBuildsCommand(
+		TEXT("UnrealSharp.TypeBuilds.Export"),
+		TEXT("Writes the build cost of all managed types to Saved/UnrealSharp/TypeBuilds.csv, most expensive first."),
+		FConsoleCommandDelegate::CreateStatic(&FCSTypeBuildProfiler::Export));
+
+	FAutoConsoleCommand ResetTypeBuildsCommand(
+		TEXT("UnrealSharp.TypeBuilds.Reset"),
+		TEXT("Forgets the build cost recorded for UnrealSharp.TypeBuilds."),
+		FConsoleCommandDelegate::CreateStatic(&FCSTypeBuildProfiler::Reset));
+
+	int32 CountDefaultComponents(const TArray<FCSPropertyMetaData>& Properties)
+	{
+		int32 NumDefaultComponents = 0;
+		for (const FCSPropertyMetaData& Property : Properties)
+		{
+			if (Property.Type->PropertyType == ECSPropertyType::DefaultComponent)
+			{
+				++NumDefaultComponents;
+			}
+		}
+		return NumDefaultComponents;
+	}
+
+	// The properties and functions of a class only exist after the Blueprint compiler ran in the editor, the metadata always has them.
+	void GatherMetaDataCounts(const FCSManagedTypeInfo& TypeInfo, const UField* Field, FCSTypeBuildRecord& Record)
+	{
+		if (Field->IsA<UCSInterface>())
+		{
+			Record.NumFunctions = TypeInfo.GetTypeMetaData<FCSInterfaceMetaData>()->Functions.Num();
+		}
+		else if (Field->IsA<UClass>())
+		{
+			const TSharedPtr<FCSClassMetaData> ClassMetaData = TypeInfo.GetTypeMetaData<FCSClassMetaData>();
+			Record.NumProperties = ClassMetaData->Properties.Num();
+			Record.NumFunctions = ClassMetaData->Functions.Num() + ClassMetaData->VirtualFunctions.Num();
+			Record.NumSCSNodes = CountDefaultComponents(ClassMetaData->Properties);
+		}
+		else if (Field->IsA<UScriptStruct>())
+		{
+			Record.NumProperties = TypeInfo.GetTypeMetaData<FCSStructMetaData>()->Properties.Num();
+		}
+	}
+}
+
+int32 FCSTypeBuildProfiler::CountObjectsToReinstance(const UField* OldField)
+{
+	const UClass* OldClass = Cast<UClass>(OldField);
+	if (!OldClass)
+	{
+		return 0;
+	}
+
+	int32 NumObjects = 0;
+	ForEachObjectOfClass(OldClass, [&NumObjects](UObject*)
+	{
+		++NumObjects;
+	}, true, RF_ClassDefaultObject, EInternalObjectFlags::Garbage);
+
+	return NumObjects;
+}
+
+void FCSTypeBuildProfiler::RecordTypeBuild(const FCSManagedTypeInfo& TypeInfo, const UField* Field, int32 NumReinstancedObjects, double Seconds)
+{
+	if (!IsEnabled() || !Field || TypeInfo.IsNativeType())
+	{
+		return;
+	}
+
+	FCSTypeBuildRecord& Record = Records.FindOrAdd(Field->GetPathName());
+	if (Record.TypeName.IsEmpty())
+	{
+		Record.TypeName = Field->GetName();
+		Record.TypeKind = Field->GetClass()->GetFName();
+
+		if (const UCSAssembly* Assembly = TypeInfo.GetOwningAssembly())
+		{
+			Record.AssemblyName = Assembly->GetAssemblyName();
+		}
+	}
+
+	++Record.NumBuilds;
+	Record.LastBuildSeconds = Seconds;
+	Record.TotalBuildSeconds += Seconds;
+	Record.LastCompileSeconds = 0.0;
+	Record.NumReinstancedObjects = NumReinstancedObjects;
+
+	if (const UStruct* Struct = Cast<UStruct>(Field))
+	{
+		Record.InstanceSize = Struct->GetStructureSize();
+	}
+
+	GatherMetaDataCounts(TypeInfo, Field, Record);
+}
+
+void FCSTypeBuildProfiler::AddCompileTime(const UClass* Class, double Seconds)
+{
+	if (FCSTypeBuildRecord* Record = Records.Find(Class->GetPathName()))
+	{
+		Record->LastCompileSeconds += Seconds;
+		Record->TotalCompileSeconds += Seconds;
+
+		// Properties are added by the compiler in the editor, the size after the build was the one of the parent.
+		Record->InstanceSize = Class->GetStructureSize();
+	}
+}
+
+void FCSTypeBuildProfiler::GetRecords(TArray<FCSTypeBuildRecord>& OutRecords)
+{
+	Records.GenerateValueArray(OutRecords);
+	OutRecords.Sort([](const FCSTypeBuildRecord& A, const FCSTypeBuildRecord& B)
+	{
+		return A.GetTotalSeconds() > B.GetTotalSeconds();
+	});
+}
+
+void FCSTypeBuildProfiler::Dump(const TArray<FString>& Args, FOutputDevice& Ar)
+{
+	int32 NumTypes = 30;
+	if (Args.Num() > 0)
+	{
+		LexFromString(NumTypes, *Args[0]);
+	}
+
+	TArray<FCSTypeBuildRecord> SortedRecords;
+	GetRecords(SortedRecords);
+
+	if (SortedRecords.IsEmpty())
+	{
+		Ar.Logf(TEXT("No type builds recorded, set UnrealSharp.ProfileTypeBuilds 1 to record them."));
+		return;
+	}
+
+	double TotalSeconds = 0.0;
+	for (const FCSTypeBuildRecord& Record : SortedRecords)
+	{
+		TotalSeconds += Record.GetTotalSeconds();
+	}
+
+	Ar.Logf(TEXT("%d types, %.1f ms in total"), SortedRecords.Num(), TotalSeconds * 1000.0);
+	Ar.Logf(TEXT("%-50s %-24s %7s %10s %10s %10s %10s %7s %7s %7s %10s %10s"), TEXT("Type"), TEXT("Assembly"), TEXT("Builds"), TEXT("TotalMs"),
+		TEXT("BuildMs"), TEXT("CompileMs"), TEXT("LastMs"), TEXT("Props"), TEXT("Funcs"), TEXT("SCS"), TEXT("Reinst"), TEXT("Size"));
+
+	for (int32 i = 0; i < FMath::Min(FMath::Max(NumTypes, 0), SortedRecords.Num()); ++i)
+	{
+		const FCSTypeBuildRecord& Record = SortedRecords[i];
+		Ar.Logf(TEXT("%-50s %-24s %7d %10.2f %10.2f %10.2f %10.2f %7d %7d %7d %10d %10d"), *Record.TypeName, *Record.AssemblyName.ToString(), Record.NumBuilds,
+			Record.GetTotalSeconds() * 1000.0, Record.TotalBuildSeconds * 1000.0, Record.TotalCompileSeconds * 1000.0,
+			(Record.LastBuildSeconds + Record.LastCompileSeconds) * 1000.0, Record.NumProperties, Record.NumFunctions, Record.NumSCSNodes,
+			Record.NumReinstancedObjects, Record.InstanceSize);
+	}
+}
+
+void FCSTypeBuildProfiler::Export()
+{
+	TArray<FCSTypeBuildRecord> SortedRecords;
+	GetRecords(SortedRecords);
+
+	FString Csv = TEXT("Type,Kind,Assembly,Builds,TotalMs,BuildMs,CompileMs,LastBuildMs,LastCompileMs,Properties,Functions,SCSNodes,ReinstancedObjects,InstanceSize\n");
+	for (const FCSTypeBuildRecord& Record : SortedRecords)
+	{
+		Csv += FString::Printf(TEXT("%s,%s,%s,%d,%.3f,%.3f,%.3f,%.3f,%.3f,%d,%d,%d,%d,%d\n"), *Record.TypeName, *Record.TypeKind.ToString(),
+			*Record.AssemblyName.ToString(), Record.NumBuilds, Record.GetTotalSeconds() * 1000.0, Record.TotalBuildSeconds * 1000.0,
+			Record.TotalCompileSeconds * 1000.0, Record.LastBuildSeconds * 1000.0, Record.LastCompileSeconds * 1000.0, Record.NumProperties,
+			Record.NumFunctions, Record.NumSCSNodes, Record.NumReinstancedObjects, Record.InstanceSize);
+	}
+
+	const FString ReportPath = FPaths::ProjectSavedDir() / TEXT("UnrealSharp") / TEXT("TypeBuilds.csv");
+	if (FFileHelper::SaveStringToFile(Csv, *ReportPath))
+	{
+		UE_LOG(LogUnrealSharp, Display, TEXT("Wrote the build cost of %d types to %s"), SortedRecords.Num(), *ReportPath);
+	}
+}
+
+void FCSTypeBuildProfiler::Reset()
+{
+	Records.Reset();
+}
+
+#endif
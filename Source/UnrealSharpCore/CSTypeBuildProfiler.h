@@ -0,0 +1,108 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FCSManagedTypeInfo;
+
+// Records the cost of building every managed type. Compiled out of shipping builds unless asked for.
+#ifndef UNREALSHARP_PROFILE_TYPE_BUILDS
+#define UNREALSHARP_PROFILE_TYPE_BUILDS !UE_BUILD_SHIPPING
+#endif
+
+/**
+ * Build cost of one managed type, over all the times it was built this session.
+ */
+struct FCSTypeBuildRecord
+{
+	FString TypeName;
+	FName AssemblyName;
+	FName TypeKind;
+
+	int32 NumBuilds = 0;
+
+	// Time in the type builder, CreateType and RebuildType.
+	double LastBuildSeconds = 0.0;
+	double TotalBuildSeconds = 0.0;
+
+	// Time the Blueprint compiler spent in the managed class compiler context, editor only.
+	double LastCompileSeconds = 0.0;
+	double TotalCompileSeconds = 0.0;
+
+	// Taken from the metadata of the last build.
+	int32 NumProperties = 0;
+	int32 NumFunctions = 0;
+	int32 NumSCSNodes = 0;
+
+	// Live objects of the type when it was last rebuilt, which all get reinstanced.
+	int32 NumReinstancedObjects = 0;
+
+	// Size of one instance of the type, after the last build.
+	int32 InstanceSize = 0;
+
+	double GetTotalSeconds() const { return TotalBuildSeconds + TotalCompileSeconds; }
+};
+
+#if UNREALSHARP_PROFILE_TYPE_BUILDS
+
+/**
+ * Keeps a FCSTypeBuildRecord per managed type while UnrealSharp.ProfileTypeBuilds is set, on by default in the editor.
+ * UnrealSharp.TypeBuilds prints them, most expensive first. Game thread only, like type building itself.
+ */
+class UNREALSHARPCORE_API FCSTypeBuildProfiler
+{
+public:
+	static bool IsEnabled() { return bEnabled && IsInGameThread(); }
+
+	// Live objects of a type about to be rebuilt. Walks the object hash of the class, so only call it when enabled.
+	static int32 CountObjectsToReinstance(const UField* OldField);
+
+	static void RecordTypeBuild(const FCSManagedTypeInfo& TypeInfo, const UField* Field, int32 NumReinstancedObjects, double Seconds);
+	static void AddCompileTime(const UClass* Class, double Seconds);
+
+	// All records, most expensive first.
+	static void GetRecords(TArray<FCSTypeBuildRecord>& OutRecords);
+
+	static void Dump(const TArray<FString>& Args, FOutputDevice& Ar);
+	static void Export();
+	static void Reset();
+
+	// Set by UnrealSharp.ProfileTypeBuilds.
+	static bool bEnabled;
+};
+
+/**
+ * Adds the time of a scope to the compile time of a managed class, for the Blueprint compiler context
+ */
+class FCSScopedTypeCompileTime
+{
+public:
+	explicit FCSScopedTypeCompileTime(const UClass* InClass)
+		: Class(FCSTypeBuildProfiler::IsEnabled() ? InClass : nullptr)
+		, StartTime(Class ? FPlatformTime::Seconds() : 0.0)
+	{
+	}
+
+	~FCSScopedTypeCompileTime()
+	{
+		if (Class)
+		{
+			FCSTypeBuildProfiler::AddCompileTime(Class, FPlatformTime::Seconds() - StartTime);
+		}
+	}
+
+	UE_NONCOPYABLE(FCSScopedTypeCompileTime);
+
+private:
+	const UClass* Class;
+	double StartTime;
+};
+
+#else
+
+class FCSScopedTypeCompileTime
+{
+public:
+	explicit FCSScopedTypeCompileTime(const UClass*) {}
+};
+
+#endif
@@ -0,0 +1,92 @@
+﻿#include "CSUnmanagedDataStore.h"
+#include "Containers/LockFreeList.h"
+#include "CSInteropAllocationTracker.h"
+
+namespace
+{
+	// Size classes are 64, 128, 256, 512 and 1024 bytes. That covers the usual event and payload structs.
+	constexpr int32 MinSizeClassShift = 6;
+	constexpr int32 NumSizeClasses = 5;
+
+	// Upper bound of cached blocks per size class, so a burst of large payloads doesn't keep its memory forever.
+	constexpr int32 MaxCachedBlocksPerClass = 1024;
+
+	struct FSizeClassFreeList
+	{
+		TLockFreePointerListUnordered<FCSUnmanagedDataPool::FBlock, PLATFORM_CACHE_LINE_SIZE> Blocks;
+		std::atomic<int32> NumCached { 0 };
+	};
+
+	FSizeClassFreeList* GetFreeLists()
+	{
+		static FSizeClassFreeList FreeLists[NumSizeClasses];
+		return FreeLists;
+	}
+
+	int32 GetSizeClass(size_t Size)
+	{
+		const int32 SizeClass = FMath::Max(static_cast<int32>(FMath::CeilLogTwo64(Size)) - MinSizeClassShift, 0);
+		return SizeClass < NumSizeClasses ? SizeClass : INDEX_NONE;
+	}
+
+	FCSUnmanagedDataPool::FBlock* AllocateBlock(size_t Capacity, int32 SizeClass)
+	{
+		void* Memory = FMemory::Malloc(sizeof(FCSUnmanagedDataPool::FBlock) + Capacity, alignof(FCSUnmanagedDataPool::FBlock));
+		CS_TRACK_INTEROP_ALLOCATION("FCSUnmanagedDataStore", "AllocateBlock", sizeof(FCSUnmanagedDataPool::FBlock) + Capacity);
+		FCSUnmanagedDataPool::FBlock* Block = static_cast<FCSUnmanagedDataPool::FBlock*>(Memory);
+		new (&Block->RefCount) std::atomic<int32>(0);
+		Block->SizeClass = SizeClass;
+		Block->Capacity = Capacity;
+		return Block;
+	}
+}
+
+FCSUnmanagedDataPool::FBlock* FCSUnmanagedDataPool::Allocate(size_t Size)
+{
+	const int32 SizeClass = GetSizeClass(Size);
+
+	FBlock* Block = nullptr;
+	if (SizeClass == INDEX_NONE)
+	{
+		Block = AllocateBlock(Size, INDEX_NONE);
+	}
+	else
+	{
+		FSizeClassFreeList& FreeList = GetFreeLists()[SizeClass];
+		Block = FreeList.Blocks.Pop();
+		
+		if (Block)
+		{
+			FreeList.NumCached.fetch_sub(1, std::memory_order_relaxed);
+		}
+		else
+		{
+			Block = AllocateBlock(static_cast<size_t>(1) << (SizeClass + MinSizeClassShift), SizeClass);
+		}
+	}
+
+	Block->RefCount.store(1, std::memory_order_relaxed);
+	return Block;
+}
+
+void FCSUnmanagedDataPool::Release(FBlock* Block)
+{
+	if (Block->RefCount.fetch_sub(1, std::memory_order_acq_rel) != 1)
+	{
+		return;
+	}
+
+	if (Block->SizeClass != INDEX_NONE)
+	{
+		FSizeClassFreeList& FreeList = GetFreeLists()[Block->SizeClass];
+		if (FreeList.NumCached.fetch_add(1, std::memory_order_relaxed) < MaxCachedBlocksPerClass)
+		{
+			FreeList.Blocks.Push(Block);
+			return;
+		}
+		
+		FreeList.NumCached.fetch_sub(1, std::memory_order_relaxed);
+	}
+
+	FMemory::Free(Block);
+}
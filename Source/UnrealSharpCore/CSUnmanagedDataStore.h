@@ -3,25 +3,100 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 
 #include "CoreMinimal.h"
 #include "CSUnmanagedDataStore.generated.h"
 
+// Payloads up to this many bytes are stored inline in FUnmanagedDataStore.
+// Targets can change it with GlobalDefinitions in their Target.cs, e.g. "UNREALSHARP_UNMANAGED_DATA_SMALL_STORAGE_SIZE=120".
+#ifndef UNREALSHARP_UNMANAGED_DATA_SMALL_STORAGE_SIZE
+#define UNREALSHARP_UNMANAGED_DATA_SMALL_STORAGE_SIZE 56
+#endif
+
+/**
+ * Reference counted blocks for payloads that don't fit inline in FUnmanagedDataStore.
+ * Blocks are grouped in power of two size classes and recycled through lock-free free lists,
+ * anything larger than the biggest size class goes straight to the allocator.
+ */
+class UNREALSHARPCORE_API FCSUnmanagedDataPool
+{
+public:
+    struct alignas(16) FBlock
+    {
+        std::atomic<int32> RefCount;
+        int32 SizeClass;
+        size_t Capacity;
+
+        void* GetData() { return this + 1; }
+        const void* GetData() const { return this + 1; }
+    };
+
+    // Returns a block with a reference count of one and room for at least Size bytes.
+    static FBlock* Allocate(size_t Size);
+    
+    static void AddRef(FBlock* Block) { Block->RefCount.fetch_add(1, std::memory_order_relaxed); }
+    static void Release(FBlock* Block);
+};
+
 USTRUCT()
 struct FUnmanagedDataStore
 {
     GENERATED_BODY()
 
 private:
-    static constexpr size_t SmallStorageSize = 56;
+    static constexpr size_t SmallStorageSize = UNREALSHARP_UNMANAGED_DATA_SMALL_STORAGE_SIZE;
     using FSmallStorage = std::array<std::byte, SmallStorageSize>;
 
-    struct FLargeStorageDeleter 
+    // Shares the pooled block between copies of the store, like the TSharedPtr it replaces, without the separate control block.
+    struct FLargeStorage
     {
-        void operator()(void* Ptr) const
+        explicit FLargeStorage(size_t Size) : Block(FCSUnmanagedDataPool::Allocate(Size)) {}
+        FLargeStorage(const FLargeStorage& Other) : Block(Other.Block) { FCSUnmanagedDataPool::AddRef(Block); }
+        FLargeStorage(FLargeStorage&& Other) noexcept : Block(Other.Block) { Other.Block = nullptr; }
+        ~FLargeStorage() { Reset(); }
+
+        FLargeStorage& operator=(const FLargeStorage& Other)
+        {
+            if (Block != Other.Block)
+            {
+                Reset();
+                Block = Other.Block;
+                FCSUnmanagedDataPool::AddRef(Block);
+            }
+            return *this;
+        }
+        
+        FLargeStorage& operator=(FLargeStorage&& Other) noexcept
+        {
+            if (this != &Other)
+            {
+                Reset();
+                Block = Other.Block;
+                Other.Block = nullptr;
+            }
+            return *this;
+        }
+
+        // Writing into a block that other copies still see would change their value too.
+        bool CanReuse(size_t Size) const
+        {
+            return Block && Block->Capacity >= Size && Block->RefCount.load(std::memory_order_acquire) == 1;
+        }
+
+        void* GetData() const { return Block->GetData(); }
+
+    private:
+        void Reset()
         {
-            FMemory::Free(Ptr);
+            if (Block)
+            {
+                FCSUnmanagedDataPool::Release(Block);
+                Block = nullptr;
+            }
         }
+        
+        FCSUnmanagedDataPool::FBlock* Block;
     };
 
 public:
@@ -36,8 +111,13 @@ public:
         }
         else
         {
-            Data.Emplace<TSharedPtr<void>>(FMemory::Malloc(Size), FLargeStorageDeleter());
-            FMemory::Memcpy(Data.Get<TSharedPtr<void>>().Get(), InData, Size);
+            const FLargeStorage* LargeStorage = Data.TryGet<FLargeStorage>();
+            if (!LargeStorage || !LargeStorage->CanReuse(Size))
+            {
+                Data.Emplace<FLargeStorage>(Size);
+            }
+            
+            FMemory::Memcpy(Data.Get<FLargeStorage>().GetData(), InData, Size);
         }
     }
 
@@ -49,11 +129,11 @@ public:
         }
         else
         {
-            FMemory::Memcpy(OutData, Data.Get<TSharedPtr<void>>().Get(), Size);
+            FMemory::Memcpy(OutData, Data.Get<FLargeStorage>().GetData(), Size);
         }
     }
 
 private:
-    TVariant<FSmallStorage, TSharedPtr<void>> Data;
+    TVariant<FSmallStorage, FLargeStorage> Data;
     
 };
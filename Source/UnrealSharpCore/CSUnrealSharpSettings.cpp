@@ -1,4 +1,5 @@
 #include "CSUnrealSharpSettings.h"
+#include "CSManager.h"
 
 UCSUnrealSharpSettings::UCSUnrealSharpSettings()
 {
@@ -23,7 +24,14 @@ void UCSUnrealSharpSettings::PostEditChangeProperty(FPropertyChangedEvent& Prope
 	if (PropertyChangedEvent.Property)
 	{
 		const FName PropertyName = PropertyChangedEvent.Property->GetFName();
-		if (PropertyName == GET_MEMBER_NAME_CHECKED(UCSUnrealSharpSettings, bEnableNamespaceSupport))
+		if (PropertyName == GET_MEMBER_NAME_CHECKED(UCSUnrealSharpSettings, ObjectValidationMode)
+			|| PropertyName == GET_MEMBER_NAME_CHECKED(UCSUnrealSharpSettings, bCrashOnException)
+			|| PropertyName == GET_MEMBER_NAME_CHECKED(UCSUnrealSharpSettings, OrphanedHandleSweepBudgetMicroseconds)
+			|| PropertyName == GET_MEMBER_NAME_CHECKED(UCSUnrealSharpSettings, ManagedObjectCreation))
+		{
+			UCSManager::Get().UpdateCachedSettings();
+		}
+		else if (PropertyName == GET_MEMBER_NAME_CHECKED(UCSUnrealSharpSettings, bEnableNamespaceSupport))
 		{
 			bRecentlyChangedNamespaceSupport = true;
 
@@ -53,3 +61,74 @@ bool UCSUnrealSharpSettings::HasNamespaceSupport() const
 	
 	return bEnableNamespaceSupport;
 }
+
+bool UCSUnrealSharpSettings::UseLazyTypeBuilding() const
+{
+	// The editor needs every type up front for asset loading, Blueprint reparenting and hot reload.
+	return bLazyTypeBuilding && !GIsEditor;
+}
+
+bool UCSUnrealSharpSettings::ShouldShareAssemblyImages() const
+{
+	// Hot reload rewrites the assemblies, which can't be done while they're mapped.
+	return bShareAssemblyImages && !GIsEditor;
+}
+
+const FCSRuntimeSettings& UCSUnrealSharpSettings::GetRuntimeSettings() const
+{
+	if (bOverrideDedicatedServerRuntimeSettings && IsRunningDedicatedServer())
+	{
+		return DedicatedServerRuntimeSettings;
+	}
+
+	return RuntimeSettings;
+}
+
+void FCSRuntimeSettings::GetRuntimeProperties(TArray<TPair<FString, FString>>& OutProperties) const
+{
+	auto AddBool = [&OutProperties](const TCHAR* Name, bool bValue)
+	{
+		OutProperties.Emplace(Name, bValue ? TEXT("true") : TEXT("false"));
+	};
+
+	// Numbers are read like the ones in runtimeconfig.json, as decimals.
+	auto AddInt = [&OutProperties](const TCHAR* Name, int64 Value)
+	{
+		OutProperties.Emplace(Name, LexToString(Value));
+	};
+
+	if (GarbageCollector != ECSGarbageCollectorMode::Default)
+	{
+		AddBool(TEXT("System.GC.Server"), GarbageCollector == ECSGarbageCollectorMode::Server);
+	}
+
+	if (bOverride_ConcurrentGC)
+	{
+		AddBool(TEXT("System.GC.Concurrent"), bConcurrentGC);
+	}
+
+	if (bOverride_DynamicAdaptation)
+	{
+		AddInt(TEXT("System.GC.DynamicAdaptationMode"), bDynamicAdaptation ? 1 : 0);
+	}
+
+	if (bOverride_HeapCount)
+	{
+		AddInt(TEXT("System.GC.HeapCount"), HeapCount);
+	}
+
+	if (bOverride_HeapHardLimit)
+	{
+		AddInt(TEXT("System.GC.HeapHardLimit"), static_cast<int64>(HeapHardLimitMB) * 1024 * 1024);
+	}
+
+	if (bOverride_ConserveMemory)
+	{
+		AddInt(TEXT("System.GC.ConserveMemory"), ConserveMemory);
+	}
+
+	if (bOverride_TieredCompilation)
+	{
+		AddBool(TEXT("System.Runtime.TieredCompilation"), bTieredCompilation);
+	}
+}
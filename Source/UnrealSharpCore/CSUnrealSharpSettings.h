@@ -2,8 +2,123 @@
 
 #include "CoreMinimal.h"
 #include "Engine/DeveloperSettings.h"
+#include "Engine/EngineBaseTypes.h"
 #include "CSUnrealSharpSettings.generated.h"
 
+UENUM()
+enum class ECSObjectValidationMode : uint8
+{
+	// Run every safety check before handing out a managed handle. Only available in non-shipping builds.
+	Full,
+	// Only reject null and garbage objects.
+	Minimal,
+};
+
+UENUM()
+enum class ECSGarbageCollectorMode : uint8
+{
+	// Use whatever the runtime config of the project asks for.
+	Default,
+	// One heap, tuned for low latency and a small footprint.
+	Workstation,
+	// One heap per core by default, tuned for throughput. Limit the heaps with HeapCount when several instances share a machine.
+	Server,
+};
+
+UENUM()
+enum class ECSManagedObjectCreation : uint8
+{
+	// Create the C# counterpart of every managed object when it's constructed.
+	Eager,
+	// Wait until first use for class default objects and archetypes, which rarely run C# code.
+	LazyTemplates,
+	// Wait until first use for every object, so objects that never run C# code never get a counterpart.
+	Lazy,
+};
+
+// .NET runtime properties that are set before the runtime starts. Unset values are left to the runtime config.
+USTRUCT()
+struct FCSRuntimeSettings
+{
+	GENERATED_BODY()
+
+	// System.GC.Server
+	UPROPERTY(EditAnywhere, config, Category = "Runtime")
+	ECSGarbageCollectorMode GarbageCollector = ECSGarbageCollectorMode::Default;
+
+	UPROPERTY(EditAnywhere, config, Category = "Runtime", meta = (InlineEditConditionToggle))
+	bool bOverride_ConcurrentGC = false;
+
+	// System.GC.Concurrent. Background collections of gen2, on a dedicated thread.
+	UPROPERTY(EditAnywhere, config, Category = "Runtime", meta = (EditCondition = "bOverride_ConcurrentGC"))
+	bool bConcurrentGC = true;
+
+	UPROPERTY(EditAnywhere, config, Category = "Runtime", meta = (InlineEditConditionToggle))
+	bool bOverride_DynamicAdaptation = false;
+
+	// System.GC.DynamicAdaptationMode (DATAS). Lets server GC grow and shrink its heap count with the load. Needs .NET 8.
+	UPROPERTY(EditAnywhere, config, Category = "Runtime", meta = (EditCondition = "bOverride_DynamicAdaptation"))
+	bool bDynamicAdaptation = true;
+
+	UPROPERTY(EditAnywhere, config, Category = "Runtime", meta = (InlineEditConditionToggle))
+	bool bOverride_HeapCount = false;
+
+	// System.GC.HeapCount. Number of heaps server GC creates, each with its own GC thread.
+	UPROPERTY(EditAnywhere, config, Category = "Runtime", meta = (EditCondition = "bOverride_HeapCount", ClampMin = "1"))
+	int32 HeapCount = 1;
+
+	UPROPERTY(EditAnywhere, config, Category = "Runtime", meta = (InlineEditConditionToggle))
+	bool bOverride_HeapHardLimit = false;
+
+	// System.GC.HeapHardLimit, in megabytes. The managed heap never commits more than this.
+	UPROPERTY(EditAnywhere, config, Category = "Runtime", meta = (EditCondition = "bOverride_HeapHardLimit", ClampMin = "16"))
+	int32 HeapHardLimitMB = 512;
+
+	UPROPERTY(EditAnywhere, config, Category = "Runtime", meta = (InlineEditConditionToggle))
+	bool bOverride_ConserveMemory = false;
+
+	// System.GC.ConserveMemory. 0 to 9, higher values compact more often to keep fragmentation down.
+	UPROPERTY(EditAnywhere, config, Category = "Runtime", meta = (EditCondition = "bOverride_ConserveMemory", ClampMin = "0", ClampMax = "9"))
+	int32 ConserveMemory = 0;
+
+	UPROPERTY(EditAnywhere, config, Category = "Runtime", meta = (InlineEditConditionToggle))
+	bool bOverride_TieredCompilation = false;
+
+	// System.Runtime.TieredCompilation. Disabling it JITs fully optimized code up front, at the cost of startup time.
+	UPROPERTY(EditAnywhere, config, Category = "Runtime", meta = (EditCondition = "bOverride_TieredCompilation"))
+	bool bTieredCompilation = true;
+
+	// Runtime property names and values for everything that is set.
+	void GetRuntimeProperties(TArray<TPair<FString, FString>>& OutProperties) const;
+};
+
+UENUM()
+enum class ECSAssemblyBudgetAction : uint8
+{
+	// Log a warning, at most once per UnrealSharp.AssemblyBudgets.WarningInterval.
+	Warn,
+	// Warn, and hold back the batched tick of the assembly's classes for a frame. They catch up on the time they missed the frame after.
+	Throttle,
+};
+
+// Budget of one assembly, checked at the end of every frame. Zero leaves a budget unchecked.
+USTRUCT()
+struct FCSAssemblyBudget
+{
+	GENERATED_BODY()
+
+	// Time the managed UFunctions of the assembly may take per frame, on every thread together.
+	UPROPERTY(EditAnywhere, config, Category = "Budget", meta = (ClampMin = "0", Units = "Milliseconds"))
+	float FrameTimeMs = 0.0f;
+
+	// GC handles the assembly may hold for its objects, which keep their C# counterparts alive.
+	UPROPERTY(EditAnywhere, config, Category = "Budget", meta = (ClampMin = "0"))
+	int32 MaxManagedHandles = 0;
+
+	UPROPERTY(EditAnywhere, config, Category = "Budget")
+	ECSAssemblyBudgetAction Action = ECSAssemblyBudgetAction::Warn;
+};
+
 UCLASS(config = UnrealSharp, defaultconfig, meta = (DisplayName = "UnrealSharp Settings"))
 class UNREALSHARPCORE_API UCSUnrealSharpSettings : public UDeveloperSettings
 {
@@ -24,7 +139,125 @@ public:
 	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Debugging")
 	bool bCrashOnException = true;
 
+	// How thoroughly objects are validated before their C# counterpart is looked up.
+	// Shipping builds always use Minimal, the full checks are compiled out.
+	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Debugging")
+	ECSObjectValidationMode ObjectValidationMode = ECSObjectValidationMode::Full;
+
+	// Only build C# types the first time they are used, instead of building every type as soon as its assembly is loaded.
+	// Ignored in the editor. Types that are only referenced by assets must be listed in WarmUpTypes.
+	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Performance")
+	bool bLazyTypeBuilding = false;
+
+	// Types that are still built when their assembly is loaded while lazy type building is enabled. Formatted as Namespace.TypeName.
+	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Performance", meta = (EditCondition = "bLazyTypeBuilding"))
+	TArray<FString> WarmUpTypes;
+
+	// Hold off .NET collections while a game world is playing, and collect when Unreal collects garbage or a map is loaded instead.
+	// How deep the collection goes depends on the GC pressure. Gameplay can allocate up to ManagedNoGCRegionBudgetMB in between.
+	// Off by default: it only pays off for games whose gameplay allocates little managed memory per frame and that see hitches
+	// from .NET collections. Games that allocate more than the budget between two Unreal collections get the usual .NET collections
+	// plus a deeper one later, so profile with it on before shipping it.
+	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Performance")
+	bool bCoordinateManagedGC = false;
+
+	// Managed memory reserved up front for gameplay frames. If more is allocated, .NET collects as usual until the next collection window.
+	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Performance", meta = (EditCondition = "bCoordinateManagedGC", ClampMin = "1", ClampMax = "256"))
+	int32 ManagedNoGCRegionBudgetMB = 32;
+
+	// Time spent every frame looking for handles whose UObject is gone or whose C# object has been collected, and releasing them. 0 disables the sweep.
+	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Performance", meta = (ClampMin = "0", ClampMax = "2000", Units = "Microseconds"))
+	int32 OrphanedHandleSweepBudgetMicroseconds = 50;
+
+	// Tick group in which C# continuations that were posted to the game thread resume, like code after an await.
+	// Outside of game worlds they resume at the end of the frame.
+	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Performance")
+	TEnumAsByte<ETickingGroup> ContinuationTickGroup = TG_PrePhysics;
+
+	// Time spent every frame resuming gameplay and background continuations, the rest waits for the next frame. Input continuations always run. 0 disables the budget.
+	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Performance", meta = (ClampMin = "0", ClampMax = "100000", Units = "Microseconds"))
+	int32 ContinuationFrameBudgetMicroseconds = 2000;
+
+	// Seconds after the user assemblies are loaded during which the methods the JIT compiles are recorded, to be compiled
+	// in the background on the next launch. Only used by the Mono runtime on Android. 0 disables the warm-up.
+	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Performance", meta = (ClampMin = "0", ClampMax = "600", Units = "Seconds"))
+	int32 AndroidJITWarmUpRecordSeconds = 60;
+
+	// Compile the methods that changed in a hot reload on worker threads before the reloaded assembly is used,
+	// instead of on the game thread the first time each of them is called.
+	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Performance")
+	bool bPrecompileReloadedMethods = true;
+
+	// When a hot reload only adds functions or changes class metadata and method bodies, add the new functions to the existing
+	// class instead of rebuilding it. Its instances and their C# counterparts are kept instead of being reinstanced.
+	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Performance")
+	bool bPatchClassesInPlace = true;
+
+	// Create the C# counterparts of the managed actors and components of a PIE world while it is duplicated, one class at a time,
+	// instead of one by one the first time they are used once play started.
+	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Performance")
+	bool bPIEWarmStart = true;
+
+	// Only queue the C# counterparts of managed objects constructed off the game thread, such as by the async loading thread while streaming,
+	// and create them in batches at the end of the frame. Objects used before that still get theirs right away, but their C# constructor runs later.
+	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Performance")
+	bool bDeferAsyncConstructedManagedObjects = false;
+
+	// When the C# counterparts of managed objects are created. Lazy counterparts are created the first time the object is used from C# or calls into it.
+	// Only applies to classes whose C# constructors, including their property initializers, leave the native object alone. The others are always created eagerly.
+	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Performance")
+	ECSManagedObjectCreation ManagedObjectCreation = ECSManagedObjectCreation::Eager;
+
+	// Let .NET map the user assemblies from their files instead of loading a private copy of each, so server processes running
+	// the same build on one machine share the memory of the images. The assemblies must be staged as loose files, which stay locked while loaded.
+	// Ignored in the editor.
+	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Performance")
+	bool bShareAssemblyImages = false;
+
+	// Estimated memory the primary data assets tracked by UCSPrimaryDataAssetCacheSubsystem may use before the least recently used
+	// ones are unloaded. 0 keeps them all loaded.
+	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Performance", meta = (ClampMin = "0", Units = "Megabytes"))
+	int32 PrimaryDataAssetCacheBudgetMB = 0;
+
+	// Budgets of the user assemblies, by assembly name. See FCSAssemblyBudgets.
+	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Performance")
+	TMap<FName, FCSAssemblyBudget> AssemblyBudgets;
+
+	// Runtime properties of the .NET runtime. Read once when the runtime starts.
+	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Runtime")
+	FCSRuntimeSettings RuntimeSettings;
+
+	// Replaces RuntimeSettings when running as a dedicated server.
+	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Runtime", meta = (InlineEditConditionToggle))
+	bool bOverrideDedicatedServerRuntimeSettings = false;
+
+	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Runtime", meta = (EditCondition = "bOverrideDedicatedServerRuntimeSettings"))
+	FCSRuntimeSettings DedicatedServerRuntimeSettings;
+
+	// Let non-shipping iOS and Android builds receive hot reloaded assemblies from the editor. Anyone who can reach the port
+	// and knows DeviceHotReloadSecret can run code on the device, so only enable it for development.
+	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Device Hot Reload")
+	bool bEnableDeviceHotReload = false;
+
+	// Shared by the editor and the device, which only accepts assemblies from an editor that proves it knows the secret.
+	// At least 16 characters, the device doesn't listen otherwise.
+	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Device Hot Reload", meta = (EditCondition = "bEnableDeviceHotReload", PasswordField = true))
+	FString DeviceHotReloadSecret;
+
+	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Device Hot Reload", meta = (EditCondition = "bEnableDeviceHotReload", ClampMin = "1", ClampMax = "65535"))
+	int32 DeviceHotReloadPort = 41873;
+
+	// Listen on every network interface instead of only on loopback. On loopback the editor connects through a forwarded port,
+	// adb forward on Android or iproxy on iOS.
+	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Device Hot Reload", meta = (EditCondition = "bEnableDeviceHotReload"))
+	bool bDeviceHotReloadOnAllInterfaces = false;
+
 	bool HasNamespaceSupport() const;
+	bool UseLazyTypeBuilding() const;
+	bool ShouldShareAssemblyImages() const;
+
+	// The runtime settings for the current target.
+	const FCSRuntimeSettings& GetRuntimeSettings() const;
 
 protected:
 	
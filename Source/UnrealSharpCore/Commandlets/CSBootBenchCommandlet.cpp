@@ -0,0 +1,326 @@
+#include "CSBootBenchCommandlet.h"
+#include "CSAssembly.h"
+#include "CSManager.h"
+#include "CSStartupReport.h"
+#include "UnrealSharpCore.h"
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformProcess.h"
+#include "Logging/StructuredLog.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "TypeGenerator/CSClass.h"
+#include "UObject/UObjectIterator.h"
+#include "UnrealSharpProcHelper/CSProcHelper.h"
+
+namespace
+{
+	const TCHAR* FirstFindManagedObjectPhase = TEXT("FirstFindManagedObject");
+
+	void AddPhase(FJsonObject& Report, const FString& Name, double DurationMs)
+	{
+		TArray<TSharedPtr<FJsonValue>> Phases = Report.GetArrayField(TEXT("Phases"));
+
+		TSharedRef<FJsonObject> PhaseObject = MakeShared<FJsonObject>();
+		PhaseObject->SetStringField(TEXT("Name"), Name);
+		PhaseObject->SetNumberField(TEXT("Depth"), 0);
+		PhaseObject->SetNumberField(TEXT("StartMs"), Report.GetNumberField(TEXT("TotalMs")));
+		PhaseObject->SetNumberField(TEXT("DurationMs"), DurationMs);
+		Phases.Add(MakeShared<FJsonValueObject>(PhaseObject));
+
+		Report.SetArrayField(TEXT("Phases"), Phases);
+	}
+
+	// Phases that run more than once per boot, like ResolveBinds or ProcessTypeMetadata for every assembly, are summed.
+	TMap<FString, double> SumPhases(const FJsonObject& Run)
+	{
+		TMap<FString, double> Durations;
+		Durations.Add(TEXT("Total"), Run.GetNumberField(TEXT("TotalMs")));
+
+		for (const TSharedPtr<FJsonValue>& PhaseValue : Run.GetArrayField(TEXT("Phases")))
+		{
+			const TSharedPtr<FJsonObject>& Phase = PhaseValue->AsObject();
+			Durations.FindOrAdd(Phase->GetStringField(TEXT("Name"))) += Phase->GetNumberField(TEXT("DurationMs"));
+		}
+
+		return Durations;
+	}
+
+	TSharedRef<FJsonObject> Summarize(const TArray<TSharedPtr<FJsonObject>>& Runs)
+	{
+		TMap<FString, TArray<double>> DurationsByPhase;
+		for (const TSharedPtr<FJsonObject>& Run : Runs)
+		{
+			for (const TPair<FString, double>& Phase : SumPhases(*Run))
+			{
+				DurationsByPhase.FindOrAdd(Phase.Key).Add(Phase.Value);
+			}
+		}
+
+		TSharedRef<FJsonObject> Summary = MakeShared<FJsonObject>();
+		for (TPair<FString, TArray<double>>& Phase : DurationsByPhase)
+		{
+			TArray<double>& Durations = Phase.Value;
+			Durations.Sort();
+
+			double Total = 0.0;
+			for (double Duration : Durations)
+			{
+				Total += Duration;
+			}
+
+			// Phases that didn't run in every boot, like BuildWeave, count for the runs they ran in.
+			TSharedRef<FJsonObject> PhaseSummary = MakeShared<FJsonObject>();
+			PhaseSummary->SetNumberField(TEXT("Runs"), Durations.Num());
+			PhaseSummary->SetNumberField(TEXT("MinMs"), Durations[0]);
+			PhaseSummary->SetNumberField(TEXT("MedianMs"), Durations[Durations.Num() / 2]);
+			PhaseSummary->SetNumberField(TEXT("MeanMs"), Total / Durations.Num());
+			PhaseSummary->SetNumberField(TEXT("MaxMs"), Durations.Last());
+			Summary->SetObjectField(Phase.Key, PhaseSummary);
+		}
+
+		return Summary;
+	}
+
+	TArray<TSharedPtr<FJsonValue>> ToJsonValues(const TArray<TSharedPtr<FJsonObject>>& Runs)
+	{
+		TArray<TSharedPtr<FJsonValue>> Values;
+		Values.Reserve(Runs.Num());
+
+		for (const TSharedPtr<FJsonObject>& Run : Runs)
+		{
+			Values.Add(MakeShared<FJsonValueObject>(Run));
+		}
+
+		return Values;
+	}
+
+	void AppendCsvRows(FString& Csv, const TCHAR* Kind, const TArray<TSharedPtr<FJsonObject>>& Runs)
+	{
+		for (int32 Iteration = 0; Iteration < Runs.Num(); ++Iteration)
+		{
+			for (const TPair<FString, double>& Phase : SumPhases(*Runs[Iteration]))
+			{
+				// Assembly phases are named after the assembly, which can't hold a comma or quote.
+				Csv += FString::Printf(TEXT("%s,%d,%s,%.3f\n"), Kind, Iteration, *Phase.Key, Phase.Value);
+			}
+		}
+	}
+}
+
+UCSBootBenchCommandlet::UCSBootBenchCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UCSBootBenchCommandlet::Main(const FString& Params)
+{
+	FString ChildOutputPath;
+	if (FParse::Value(*Params, TEXT("BootBenchChildOutput="), ChildOutputPath))
+	{
+		return RunColdChild(ChildOutputPath);
+	}
+
+	int32 ColdIterations = 5;
+	int32 WarmIterations = 5;
+	FParse::Value(*Params, TEXT("ColdIterations="), ColdIterations);
+	FParse::Value(*Params, TEXT("WarmIterations="), WarmIterations);
+
+	FString OutputDirectory = FPaths::ProjectSavedDir() / TEXT("UnrealSharp") / TEXT("BootBench");
+	FParse::Value(*Params, TEXT("Output="), OutputDirectory);
+	OutputDirectory = FPaths::ConvertRelativePathToFull(OutputDirectory);
+
+	TArray<TSharedPtr<FJsonObject>> ColdRuns;
+	for (int32 Iteration = 0; Iteration < ColdIterations; ++Iteration)
+	{
+		TSharedPtr<FJsonObject> Run = RunColdIteration(Iteration, OutputDirectory);
+		if (!Run.IsValid())
+		{
+			return 1;
+		}
+
+		UE_LOGFMT(LogUnrealSharp, Display, "Cold boot {0}/{1}: {2} ms", Iteration + 1, ColdIterations, FMath::RoundToInt(Run->GetNumberField(TEXT("TotalMs"))));
+		ColdRuns.Add(Run);
+	}
+
+	TArray<TSharedPtr<FJsonObject>> WarmRuns;
+#if WITH_EDITOR
+	for (int32 Iteration = 0; Iteration < WarmIterations; ++Iteration)
+	{
+		TSharedPtr<FJsonObject> Run = RunWarmIteration();
+		if (!Run.IsValid())
+		{
+			return 1;
+		}
+
+		UE_LOGFMT(LogUnrealSharp, Display, "Warm load {0}/{1}: {2} ms", Iteration + 1, WarmIterations, FMath::RoundToInt(Run->GetNumberField(TEXT("TotalMs"))));
+		WarmRuns.Add(Run);
+	}
+#else
+	if (WarmIterations > 0)
+	{
+		UE_LOGFMT(LogUnrealSharp, Warning, "Warm runs reload the user assemblies, which needs an editor build. Skipping them.");
+	}
+#endif
+
+	WriteResults(OutputDirectory, ColdRuns, WarmRuns);
+	return 0;
+}
+
+int32 UCSBootBenchCommandlet::RunColdChild(const FString& OutputPath)
+{
+	TSharedPtr<FJsonObject> Report = FCSStartupReport::Get().GetLastReport();
+	if (!Report.IsValid())
+	{
+		UE_LOGFMT(LogUnrealSharp, Error, "UnrealSharp didn't finish starting up, there is no startup report.");
+		return 1;
+	}
+
+	AddPhase(*Report, FirstFindManagedObjectPhase, TimeFirstFindManagedObject());
+
+	FString ReportString;
+	FJsonSerializer::Serialize(Report.ToSharedRef(), TJsonWriterFactory<>::Create(&ReportString));
+	return FFileHelper::SaveStringToFile(ReportString, *OutputPath) ? 0 : 1;
+}
+
+TSharedPtr<FJsonObject> UCSBootBenchCommandlet::RunColdIteration(int32 Iteration, const FString& OutputDirectory)
+{
+	const FString ChildOutputPath = OutputDirectory / FString::Printf(TEXT("Cold-%d.json"), Iteration);
+	IFileManager::Get().Delete(*ChildOutputPath);
+
+	// Unattended skips the build of the C# projects, which isn't part of the boot being measured.
+	FString Arguments = FString::Printf(TEXT("-run=CSBootBench -BootBenchChildOutput=\"%s\" -unattended -nullrhi -nosplash -nosound"), *ChildOutputPath);
+	if (FPaths::IsProjectFilePathSet())
+	{
+		Arguments = FString::Printf(TEXT("\"%s\" %s"), *FPaths::ConvertRelativePathToFull(FPaths::GetProjectFilePath()), *Arguments);
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	FProcHandle Process = FPlatformProcess::CreateProc(FPlatformProcess::ExecutablePath(), *Arguments, false, true, true, nullptr, 0, nullptr, nullptr);
+	if (!Process.IsValid())
+	{
+		UE_LOGFMT(LogUnrealSharp, Error, "Failed to start {0} for cold boot {1}", FPlatformProcess::ExecutablePath(), Iteration);
+		return nullptr;
+	}
+
+	FPlatformProcess::WaitForProc(Process);
+	const double ProcessMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+	int32 ReturnCode = 0;
+	FPlatformProcess::GetProcReturnCode(Process, &ReturnCode);
+	FPlatformProcess::CloseProc(Process);
+
+	FString ReportString;
+	TSharedPtr<FJsonObject> Run;
+	if (ReturnCode != 0
+		|| !FFileHelper::LoadFileToString(ReportString, *ChildOutputPath)
+		|| !FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(ReportString), Run)
+		|| !Run.IsValid())
+	{
+		UE_LOGFMT(LogUnrealSharp, Error, "Cold boot {0} failed with exit code {1}, see the log of the process", Iteration, ReturnCode);
+		return nullptr;
+	}
+
+	// The boot of the whole process, engine included, next to the part UnrealSharp takes.
+	Run->SetNumberField(TEXT("ProcessMs"), ProcessMs);
+	return Run;
+}
+
+TSharedPtr<FJsonObject> UCSBootBenchCommandlet::RunWarmIteration()
+{
+	UCSManager& Manager = UCSManager::Get();
+
+	TArray<FString> AssemblyPaths;
+	FCSProcHelper::GetAssemblyPathsByLoadOrder(AssemblyPaths, true);
+
+	// Same order as hot reload, assemblies are unloaded before the ones they depend on.
+	for (int32 i = AssemblyPaths.Num() - 1; i >= 0; --i)
+	{
+		UCSAssembly* Assembly = Manager.FindAssembly(*FPaths::GetBaseFilename(AssemblyPaths[i]));
+		if (IsValid(Assembly) && !Assembly->UnloadAssembly())
+		{
+			UE_LOGFMT(LogUnrealSharp, Error, "Failed to unload {0}, warm runs need every user assembly to unload", *AssemblyPaths[i]);
+			return nullptr;
+		}
+	}
+
+	FCSStartupReport& StartupReport = FCSStartupReport::Get();
+	StartupReport.Restart();
+
+	for (const FString& AssemblyPath : AssemblyPaths)
+	{
+		UCSAssembly* Assembly = Manager.FindAssembly(*FPaths::GetBaseFilename(AssemblyPath));
+		const bool bLoaded = IsValid(Assembly) ? Assembly->LoadAssembly() : Manager.LoadAssemblyByPath(AssemblyPath) != nullptr;
+
+		if (!bLoaded)
+		{
+			UE_LOGFMT(LogUnrealSharp, Error, "Failed to load {0}", *AssemblyPath);
+			StartupReport.Finish();
+			return nullptr;
+		}
+	}
+
+	{
+		FCSScopedStartupPhase FindManagedObjectPhase(FirstFindManagedObjectPhase);
+		TimeFirstFindManagedObject();
+	}
+
+	StartupReport.Finish();
+	return StartupReport.GetLastReport();
+}
+
+double UCSBootBenchCommandlet::TimeFirstFindManagedObject()
+{
+	for (TObjectIterator<UCSClass> It; It; ++It)
+	{
+		UCSClass* ManagedClass = *It;
+		if (!ManagedClass->HasTypeInfo() || ManagedClass->HasAnyClassFlags(CLASS_NewerVersionExists))
+		{
+			continue;
+		}
+
+		UObject* DefaultObject = ManagedClass->GetDefaultObject();
+
+		const double StartTime = FPlatformTime::Seconds();
+		UCSManager::Get().FindManagedObject(DefaultObject);
+		return (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	}
+
+	return 0.0;
+}
+
+void UCSBootBenchCommandlet::WriteResults(const FString& OutputDirectory, const TArray<TSharedPtr<FJsonObject>>& ColdRuns, const TArray<TSharedPtr<FJsonObject>>& WarmRuns)
+{
+	TSharedRef<FJsonObject> Results = MakeShared<FJsonObject>();
+	Results->SetArrayField(TEXT("ColdRuns"), ToJsonValues(ColdRuns));
+	Results->SetArrayField(TEXT("WarmRuns"), ToJsonValues(WarmRuns));
+
+	TSharedRef<FJsonObject> Summary = MakeShared<FJsonObject>();
+	if (!ColdRuns.IsEmpty())
+	{
+		Summary->SetObjectField(TEXT("Cold"), Summarize(ColdRuns));
+	}
+
+	if (!WarmRuns.IsEmpty())
+	{
+		Summary->SetObjectField(TEXT("Warm"), Summarize(WarmRuns));
+	}
+
+	Results->SetObjectField(TEXT("Summary"), Summary);
+
+	FString ResultsString;
+	FJsonSerializer::Serialize(Results, TJsonWriterFactory<>::Create(&ResultsString));
+	FFileHelper::SaveStringToFile(ResultsString, *(OutputDirectory / TEXT("BootBench.json")));
+
+	FString Csv = TEXT("Kind,Iteration,Phase,DurationMs\n");
+	AppendCsvRows(Csv, TEXT("Cold"), ColdRuns);
+	AppendCsvRows(Csv, TEXT("Warm"), WarmRuns);
+	FFileHelper::SaveStringToFile(Csv, *(OutputDirectory / TEXT("BootBench.csv")));
+
+	UE_LOGFMT(LogUnrealSharp, Display, "Wrote the results of {0} cold and {1} warm runs to {2}", ColdRuns.Num(), WarmRuns.Num(), *OutputDirectory);
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "CSBootBenchCommandlet.generated.h"
+
+class FJsonObject;
+
+/**
+ * Times the boot of UnrealSharp, for keeping the startup of servers and the editor under budget.
+ *
+ * Usage: -run=CSBootBench [-ColdIterations=5] [-WarmIterations=5] [-Output=<directory>]
+ *
+ * The runtime can't be started twice in one process, so every cold run is a new process that boots the engine with
+ * UnrealSharp from scratch, from loading hostfxr to the first FindManagedObject. Warm runs unload and load the user
+ * assemblies again in this process, the same path as hot reload, so they only exist in editor builds.
+ * Every phase of the startup report is timed, the results go to BootBench.json and BootBench.csv in the output directory,
+ * Saved/UnrealSharp/BootBench by default.
+ */
+UCLASS()
+class UCSBootBenchCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+
+	UCSBootBenchCommandlet();
+
+	// UCommandlet interface
+	virtual int32 Main(const FString& Params) override;
+	// End of UCommandlet interface
+
+private:
+
+	// Run in the processes of the cold runs, writes the startup report of the process to OutputPath.
+	static int32 RunColdChild(const FString& OutputPath);
+
+	static TSharedPtr<FJsonObject> RunColdIteration(int32 Iteration, const FString& OutputDirectory);
+	static TSharedPtr<FJsonObject> RunWarmIteration();
+
+	// Looks up the C# counterpart of a managed class default object, which creates it when there is none yet.
+	static double TimeFirstFindManagedObject();
+
+	static void WriteResults(const FString& OutputDirectory, const TArray<TSharedPtr<FJsonObject>>& ColdRuns, const TArray<TSharedPtr<FJsonObject>>& WarmRuns);
+};
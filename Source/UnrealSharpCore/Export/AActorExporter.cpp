@@ -0,0 +1,112 @@
+﻿#include "AActorExporter.h"
+#include "UnrealSharpCore.h"
+#include "GameFramework/Actor.h"
+#include "Logging/StructuredLog.h"
+
+// Mirrors of the parameter structs UHT generates for these functions, so the layout matches the params buffer.
+namespace
+{
+	struct FK2_SetActorLocationParms
+	{
+		FVector NewLocation;
+		bool bSweep;
+		FHitResult SweepHitResult;
+		bool bTeleport;
+		bool ReturnValue;
+	};
+
+	struct FK2_GetActorLocationParms
+	{
+		FVector ReturnValue;
+	};
+
+	struct FGetTransformParms
+	{
+		FTransform ReturnValue;
+	};
+
+#if DO_CHECK
+	struct FMirroredParm
+	{
+		const TCHAR* Name;
+		int32 Offset;
+		int32 Size;
+	};
+
+	bool ValidateParms(const TCHAR* FunctionName, int32 ParmsSize, std::initializer_list<FMirroredParm> Parms)
+	{
+		const UFunction* Function = AActor::StaticClass()->FindFunctionByName(FunctionName);
+		if (!Function)
+		{
+			UE_LOGFMT(LogUnrealSharp, Error, "AActor::{0} no longer exists", FunctionName);
+			return false;
+		}
+
+		bool bIsValid = true;
+		if (Function->ParmsSize != ParmsSize || Function->NumParms != static_cast<int32>(Parms.size()))
+		{
+			UE_LOGFMT(LogUnrealSharp, Error, "AActor::{0} takes {1} bytes in {2} parameters, the mirrored struct has {3} bytes in {4}",
+				FunctionName, Function->ParmsSize, Function->NumParms, ParmsSize, static_cast<int32>(Parms.size()));
+			bIsValid = false;
+		}
+
+		for (const FMirroredParm& Parm : Parms)
+		{
+			const FProperty* Property = Function->FindPropertyByName(Parm.Name);
+			if (!Property || Property->GetOffset_ForUFunction() != Parm.Offset || Property->GetSize() != Parm.Size)
+			{
+				UE_LOGFMT(LogUnrealSharp, Error, "Parameter {0} of AActor::{1} doesn't match its mirror at offset {2} with {3} bytes",
+					Parm.Name, FunctionName, Parm.Offset, Parm.Size);
+				bIsValid = false;
+			}
+		}
+
+		return bIsValid;
+	}
+
+#define MIRRORED_PARM(Struct, Member) FMirroredParm { TEXT(#Member), STRUCT_OFFSET(Struct, Member), sizeof(Struct::Member) }
+#endif
+}
+
+void UAActorExporter::ValidateParmsLayouts()
+{
+#if DO_CHECK
+	bool bIsValid = ValidateParms(TEXT("K2_SetActorLocation"), sizeof(FK2_SetActorLocationParms),
+	{
+		MIRRORED_PARM(FK2_SetActorLocationParms, NewLocation),
+		MIRRORED_PARM(FK2_SetActorLocationParms, bSweep),
+		MIRRORED_PARM(FK2_SetActorLocationParms, SweepHitResult),
+		MIRRORED_PARM(FK2_SetActorLocationParms, bTeleport),
+		MIRRORED_PARM(FK2_SetActorLocationParms, ReturnValue),
+	});
+
+	bIsValid &= ValidateParms(TEXT("K2_GetActorLocation"), sizeof(FK2_GetActorLocationParms),
+	{
+		MIRRORED_PARM(FK2_GetActorLocationParms, ReturnValue),
+	});
+
+	bIsValid &= ValidateParms(TEXT("GetTransform"), sizeof(FGetTransformParms),
+	{
+		MIRRORED_PARM(FGetTransformParms, ReturnValue),
+	});
+
+	checkf(bIsValid, TEXT("The parameter structs of UAActorExporter are out of date with AActor, see the log for the functions that changed."));
+#undef MIRRORED_PARM
+#endif
+}
+
+void UAActorExporter::K2_SetActorLocation(AActor* Actor, uint8* Params)
+{
+	FK2_SetActorLocationParms& Parms = *reinterpret_cast<FK2_SetActorLocationParms*>(Params);
+	Parms.ReturnValue = Actor->K2_SetActorLocation(Parms.NewLocation, Parms.bSweep, Parms.SweepHitResult, Parms.bTeleport);
+}
+
+void UAActorExporter::K2_GetActorLocation(const AActor* Actor, uint8* Params)
+{
+	reinterpret_cast<FK2_GetActorLocationParms*>(Params)->ReturnValue = Actor->K2_GetActorLocation();
+}
+
+void UAActorExporter::GetTransform(const AActor* Actor, uint8* Params)
+{
+	reinterpret_cast<FGetTransformParms*>(Params)->ReturnValue = Actor->GetTransform();
+}
@@ -0,0 +1,30 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CSBindsManager.h"
+#include "AActorExporter.generated.h"
+
+// Direct-call trampolines for hot AActor functions. They take the same params buffer the glue would pass to
+// InvokeNativeFunction, but call the C++ function directly instead of going through the FFrame.
+UCLASS()
+class UNREALSHARPCORE_API UAActorExporter : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	UNREALSHARP_FUNCTION()
+	static void K2_SetActorLocation(AActor* Actor, uint8* Params);
+
+	UNREALSHARP_FUNCTION()
+	static void K2_GetActorLocation(const AActor* Actor, uint8* Params);
+
+	UNREALSHARP_FUNCTION()
+	static void GetTransform(const AActor* Actor, uint8* Params);
+
+	// Checks the mirrored parameter structs against the reflected UFunctions, so an engine change to one of the
+	// functions fails at startup instead of corrupting the params buffer. Does nothing in builds without checks.
+	static void ValidateParmsLayouts();
+};
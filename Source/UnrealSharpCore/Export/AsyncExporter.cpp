@@ -1,11 +1,22 @@
 ﻿#include "AsyncExporter.h"
 #include "CSManagedDelegate.h"
 #include "../GCOptimizations/CSHotReloadSafetyLock.h"
+#include "CSHandleEpoch.h"
+#include "CSGameThreadContinuations.h"
 
 void UAsyncExporter::RunOnThread(TWeakObjectPtr<UObject> WorldContextObject, ENamedThreads::Type Thread, FGCHandleIntPtr DelegateHandle)
 {
+	if (ENamedThreads::GetThreadIndex(Thread) == ENamedThreads::GameThread)
+	{
+		FCSGameThreadContinuations::Post(ECSContinuationLane::Gameplay, DelegateHandle, WorldContextObject);
+		return;
+	}
+	
 	AsyncTask(Thread, [WorldContextObject, DelegateHandle]()
 	{
+		// Handles of objects deleted on the game thread meanwhile stay valid until the delegate returns
+		FCSHandleEpoch::FReadScope HandleReadScope;
+		
 		// 使用热重载安全访问确保线程安全
 		bool bAccessSuccess = FHotReloadSafetyLock::SafeManagedObjectAccess([&]()
 		{
@@ -33,4 +44,15 @@ void UAsyncExporter::RunOnThread(TWeakObjectPtr<UObject> WorldContextObject, ENa
 int UAsyncExporter::GetCurrentNamedThread()
 {
 	return FTaskGraphInterface::Get().GetCurrentThreadIfKnown();
+}
+
+void UAsyncExporter::PostGameThreadContinuation(TWeakObjectPtr<UObject> WorldContextObject, int32 Lane, FGCHandleIntPtr DelegateHandle)
+{
+	const int32 LaneIndex = FMath::Clamp(Lane, 0, static_cast<int32>(ECSContinuationLane::Count) - 1);
+	FCSGameThreadContinuations::Post(static_cast<ECSContinuationLane>(LaneIndex), DelegateHandle, WorldContextObject);
+}
+
+void UAsyncExporter::PostNextTickContinuation(FGCHandleIntPtr DelegateHandle)
+{
+	FCSGameThreadContinuations::PostNextTick(DelegateHandle);
 }
\ No newline at end of file
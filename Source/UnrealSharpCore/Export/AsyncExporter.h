@@ -18,5 +18,13 @@ public:
 	
 	UNREALSHARP_FUNCTION()
 	static int GetCurrentNamedThread();
+
+	// Resumes the delegate on the game thread in the given ECSContinuationLane, within the per-frame continuation budget.
+	UNREALSHARP_FUNCTION()
+	static void PostGameThreadContinuation(TWeakObjectPtr<UObject> WorldContextObject, int32 Lane, FGCHandleIntPtr DelegateHandle);
+
+	// Resumes the delegate on the game thread next frame. Doesn't touch the task graph when called from the game thread.
+	UNREALSHARP_FUNCTION()
+	static void PostNextTickContinuation(FGCHandleIntPtr DelegateHandle);
 	
 };
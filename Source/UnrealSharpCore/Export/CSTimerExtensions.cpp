@@ -1,11 +1,14 @@
 #include "CSTimerExtensions.h"
+#include "CSGameThreadContinuations.h"
 
 void UCSTimerExtensions::SetTimerForNextTick(FNextTickEvent NextTickEvent)
 {
-#if WITH_EDITOR
-	FFunctionGraphTask::CreateAndDispatchWhenReady([NextTickEvent]
+	// Shares the per-frame budget with the other continuations instead of going through the editor's timer manager.
+	FCSGameThreadContinuations::PostNextTick([](void* Payload, UObject* WorldContextObject, bool bCancelled)
 	{
-		GEditor->GetTimerManager()->SetTimerForNextTick(FTimerDelegate::CreateLambda(NextTickEvent));
-	}, TStatId(), nullptr, ENamedThreads::GameThread);
-#endif
+		if (!bCancelled)
+		{
+			reinterpret_cast<FNextTickEvent>(Payload)();
+		}
+	}, reinterpret_cast<void*>(NextTickEvent));
 }
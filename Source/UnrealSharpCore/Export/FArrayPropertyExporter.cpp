@@ -1,5 +1,14 @@
 ﻿#include "FArrayPropertyExporter.h"
 
+namespace
+{
+	bool CanCopyMemory(const FArrayProperty* ArrayProperty, int ElementSize)
+	{
+		const FProperty* Inner = ArrayProperty->Inner;
+		return Inner->HasAnyPropertyFlags(CPF_IsPlainOldData) && Inner->GetSize() == ElementSize;
+	}
+}
+
 void UFArrayPropertyExporter::InitializeArray(FArrayProperty* ArrayProperty, const void* ScriptArray, int Length)
 {
 	FScriptArrayHelper Helper(ArrayProperty, ScriptArray);
@@ -41,3 +50,66 @@ void UFArrayPropertyExporter::SwapValues(FArrayProperty* ArrayProperty, const vo
 	FScriptArrayHelper Helper(ArrayProperty, ScriptArray);
 	Helper.SwapValues(indexA, indexB);
 }
+
+bool UFArrayPropertyExporter::CopyFromManagedSpan(FArrayProperty* ArrayProperty, const void* ScriptArray, const void* Source, int Length, int ElementSize)
+{
+	if (!CanCopyMemory(ArrayProperty, ElementSize))
+	{
+		return false;
+	}
+	
+	FScriptArrayHelper Helper(ArrayProperty, ScriptArray);
+	Helper.EmptyAndAddUninitializedValues(Length);
+
+	if (Length > 0)
+	{
+		FMemory::Memcpy(Helper.GetRawPtr(), Source, static_cast<SIZE_T>(Length) * ElementSize);
+	}
+	
+	return true;
+}
+
+bool UFArrayPropertyExporter::CopyToManagedSpan(FArrayProperty* ArrayProperty, const void* ScriptArray, void* Destination, int StartIndex, int Length, int ElementSize)
+{
+	if (!CanCopyMemory(ArrayProperty, ElementSize))
+	{
+		return false;
+	}
+	
+	FScriptArrayHelper Helper(ArrayProperty, ScriptArray);
+	if (StartIndex < 0 || Length < 0 || StartIndex + Length > Helper.Num())
+	{
+		return false;
+	}
+
+	if (Length > 0)
+	{
+		FMemory::Memcpy(Destination, Helper.GetRawPtr(StartIndex), static_cast<SIZE_T>(Length) * ElementSize);
+	}
+	
+	return true;
+}
+
+bool UFArrayPropertyExporter::AppendRange(FArrayProperty* ArrayProperty, const void* ScriptArray, const void* Source, int Length, int ElementSize)
+{
+	if (!CanCopyMemory(ArrayProperty, ElementSize))
+	{
+		return false;
+	}
+
+	if (Length <= 0)
+	{
+		return true;
+	}
+	
+	FScriptArrayHelper Helper(ArrayProperty, ScriptArray);
+	const int32 FirstNewIndex = Helper.AddUninitializedValues(Length);
+	FMemory::Memcpy(Helper.GetRawPtr(FirstNewIndex), Source, static_cast<SIZE_T>(Length) * ElementSize);
+	return true;
+}
+
+void UFArrayPropertyExporter::RemoveRange(FArrayProperty* ArrayProperty, const void* ScriptArray, int Index, int Count)
+{
+	FScriptArrayHelper Helper(ArrayProperty, ScriptArray);
+	Helper.RemoveValues(Index, Count);
+}
@@ -33,5 +33,21 @@ public:
 
 	UNREALSHARP_FUNCTION()
 	static void SwapValues(FArrayProperty* ArrayProperty, const void* ScriptArray, int indexA, int indexB);
+
+	// Bulk operations for arrays of plain old data. They return false without touching the array when the inner property
+	// isn't plain old data or its size doesn't match ElementSize, so the caller can fall back to per-element marshalling.
+	
+	UNREALSHARP_FUNCTION()
+	static bool CopyFromManagedSpan(FArrayProperty* ArrayProperty, const void* ScriptArray, const void* Source, int Length, int ElementSize);
+
+	UNREALSHARP_FUNCTION()
+	static bool CopyToManagedSpan(FArrayProperty* ArrayProperty, const void* ScriptArray, void* Destination, int StartIndex, int Length, int ElementSize);
+
+	UNREALSHARP_FUNCTION()
+	static bool AppendRange(FArrayProperty* ArrayProperty, const void* ScriptArray, const void* Source, int Length, int ElementSize);
+
+	// Works for any inner type, elements are destructed as usual.
+	UNREALSHARP_FUNCTION()
+	static void RemoveRange(FArrayProperty* ArrayProperty, const void* ScriptArray, int Index, int Count);
 	
 };
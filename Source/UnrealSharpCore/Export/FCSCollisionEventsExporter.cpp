@@ -0,0 +1,42 @@
+#include "FCSCollisionEventsExporter.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+namespace
+{
+	UCSCollisionEventSubsystem* GetSubsystem(UObject* WorldContextObject)
+	{
+		const UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+		return World ? World->GetSubsystem<UCSCollisionEventSubsystem>() : nullptr;
+	}
+}
+
+int32 UFCSCollisionEventsExporter::AddListener(UObject* WorldContextObject, UCSCollisionEventSubsystem::FListenerEntryPoint EntryPoint, void* State)
+{
+	UCSCollisionEventSubsystem* Subsystem = GetSubsystem(WorldContextObject);
+	return Subsystem ? Subsystem->AddListener(EntryPoint, State) : 0;
+}
+
+void UFCSCollisionEventsExporter::RemoveListener(UObject* WorldContextObject, int32 ListenerId)
+{
+	if (UCSCollisionEventSubsystem* Subsystem = GetSubsystem(WorldContextObject))
+	{
+		Subsystem->RemoveListener(ListenerId);
+	}
+}
+
+void UFCSCollisionEventsExporter::Listen(UObject* WorldContextObject, int32 ListenerId, UPrimitiveComponent* Component, uint8 Events)
+{
+	if (UCSCollisionEventSubsystem* Subsystem = GetSubsystem(WorldContextObject))
+	{
+		Subsystem->Listen(ListenerId, Component, static_cast<ECSCollisionEventMask>(Events));
+	}
+}
+
+void UFCSCollisionEventsExporter::StopListening(UObject* WorldContextObject, int32 ListenerId, UPrimitiveComponent* Component)
+{
+	if (UCSCollisionEventSubsystem* Subsystem = GetSubsystem(WorldContextObject))
+	{
+		Subsystem->StopListening(ListenerId, Component);
+	}
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CSBindsManager.h"
+#include "Extensions/Subsystems/CSCollisionEventSubsystem.h"
+#include "FCSCollisionEventsExporter.generated.h"
+
+UCLASS()
+class UNREALSHARPCORE_API UFCSCollisionEventsExporter : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	// Returns 0 if there is no world, State is then left to the caller.
+	UNREALSHARP_FUNCTION()
+	static int32 AddListener(UObject* WorldContextObject, UCSCollisionEventSubsystem::FListenerEntryPoint EntryPoint, void* State);
+
+	// The entry point is never called for the listener once this returns.
+	UNREALSHARP_FUNCTION()
+	static void RemoveListener(UObject* WorldContextObject, int32 ListenerId);
+
+	// Events is an ECSCollisionEventMask. Listening to a component again replaces its events.
+	UNREALSHARP_FUNCTION()
+	static void Listen(UObject* WorldContextObject, int32 ListenerId, UPrimitiveComponent* Component, uint8 Events);
+
+	UNREALSHARP_FUNCTION()
+	static void StopListening(UObject* WorldContextObject, int32 ListenerId, UPrimitiveComponent* Component);
+};
@@ -0,0 +1,17 @@
+#include "FCSFieldNotifyExporter.h"
+#include "UnrealSharpCore/CSFieldNotifyBatcher.h"
+
+int32 UFCSFieldNotifyExporter::GetFieldNotifyIndex(UObject* Object, const char* FieldName)
+{
+	return FCSFieldNotifyBatcher::GetFieldIndex(Object, FName(FieldName));
+}
+
+void UFCSFieldNotifyExporter::RequestFieldNotifyFlush(FGCHandleIntPtr FlushDelegate)
+{
+	FCSFieldNotifyBatcher::RequestFlush(FlushDelegate);
+}
+
+void UFCSFieldNotifyExporter::BroadcastFieldsValueChanged(UObject* const* Objects, const int32* WordOffsets, const uint64* DirtyBits, int32 NumObjects)
+{
+	FCSFieldNotifyBatcher::Broadcast(Objects, WordOffsets, DirtyBits, NumObjects);
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CSBindsManager.h"
+#include "CSManagedGCHandle.h"
+#include "FCSFieldNotifyExporter.generated.h"
+
+UCLASS()
+class UNREALSHARPCORE_API UFCSFieldNotifyExporter : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	UNREALSHARP_FUNCTION()
+	static int32 GetFieldNotifyIndex(UObject* Object, const char* FieldName);
+
+	UNREALSHARP_FUNCTION()
+	static void RequestFieldNotifyFlush(FGCHandleIntPtr FlushDelegate);
+
+	UNREALSHARP_FUNCTION()
+	static void BroadcastFieldsValueChanged(UObject* const* Objects, const int32* WordOffsets, const uint64* DirtyBits, int32 NumObjects);
+};
@@ -0,0 +1,32 @@
+#include "FCSManagedJobsExporter.h"
+
+void UFCSManagedJobsExporter::LaunchJobs(FCSManagedJobs::FManagedJobEntryPoint EntryPoint, void** States, int32 NumJobs, int32 Priority, FCSManagedJobs::FJob** Prerequisites, int32 NumPrerequisites, FCSManagedJobs::FJob** OutJobs)
+{
+	const UE::Tasks::ETaskPriority TaskPriority = static_cast<UE::Tasks::ETaskPriority>(FMath::Clamp(Priority, 0, static_cast<int32>(UE::Tasks::ETaskPriority::Count) - 1));
+	const TConstArrayView<FCSManagedJobs::FJob*> PrerequisiteJobs(Prerequisites, NumPrerequisites);
+
+	for (int32 i = 0; i < NumJobs; ++i)
+	{
+		OutJobs[i] = FCSManagedJobs::Launch(EntryPoint, States[i], TaskPriority, PrerequisiteJobs);
+	}
+}
+
+bool UFCSManagedJobsExporter::IsJobCompleted(FCSManagedJobs::FJob* Job)
+{
+	return Job->Task.IsCompleted();
+}
+
+void UFCSManagedJobsExporter::WaitForJob(FCSManagedJobs::FJob* Job)
+{
+	Job->Task.Wait();
+}
+
+void UFCSManagedJobsExporter::ReleaseJob(FCSManagedJobs::FJob* Job)
+{
+	delete Job;
+}
+
+void UFCSManagedJobsExporter::ParallelFor(FCSManagedJobs::FManagedJobEntryPoint EntryPoint, void* State, int32 Count, int32 MinBatchSize)
+{
+	FCSManagedJobs::ParallelFor(EntryPoint, State, Count, MinBatchSize);
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CSBindsManager.h"
+#include "UnrealSharpCore/CSManagedJobs.h"
+#include "FCSManagedJobsExporter.generated.h"
+
+UCLASS()
+class UNREALSHARPCORE_API UFCSManagedJobsExporter : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	// Launches NumJobs jobs that share the entry point, one per state. Writes a job handle per state to OutJobs.
+	UNREALSHARP_FUNCTION(AnyThread)
+	static void LaunchJobs(FCSManagedJobs::FManagedJobEntryPoint EntryPoint, void** States, int32 NumJobs, int32 Priority, FCSManagedJobs::FJob** Prerequisites, int32 NumPrerequisites, FCSManagedJobs::FJob** OutJobs);
+
+	UNREALSHARP_FUNCTION(AnyThread)
+	static bool IsJobCompleted(FCSManagedJobs::FJob* Job);
+
+	UNREALSHARP_FUNCTION(AnyThread)
+	static void WaitForJob(FCSManagedJobs::FJob* Job);
+
+	UNREALSHARP_FUNCTION(AnyThread)
+	static void ReleaseJob(FCSManagedJobs::FJob* Job);
+
+	UNREALSHARP_FUNCTION(AnyThread)
+	static void ParallelFor(FCSManagedJobs::FManagedJobEntryPoint EntryPoint, void* State, int32 Count, int32 MinBatchSize);
+};
@@ -0,0 +1,22 @@
+#include "FCSSaveGameSerializerExporter.h"
+#include "CSSaveGameSerializer.h"
+
+void UFCSSaveGameSerializerExporter::SaveObjects(UObject** Objects, int32 NumObjects, TArray<uint8>* OutData)
+{
+	FCSSaveGameSerializer::SaveObjects(MakeArrayView(Objects, NumObjects), *OutData);
+}
+
+bool UFCSSaveGameSerializerExporter::LoadObjects(UObject** Objects, int32 NumObjects, const uint8* Data, int32 DataLength)
+{
+	return FCSSaveGameSerializer::LoadObjects(MakeArrayView(Objects, NumObjects), MakeArrayView(Data, DataLength));
+}
+
+void UFCSSaveGameSerializerExporter::SaveStruct(const UScriptStruct* Struct, const void* StructData, TArray<uint8>* OutData)
+{
+	FCSSaveGameSerializer::SaveStruct(Struct, StructData, *OutData);
+}
+
+bool UFCSSaveGameSerializerExporter::LoadStruct(const UScriptStruct* Struct, void* StructData, const uint8* Data, int32 DataLength)
+{
+	return FCSSaveGameSerializer::LoadStruct(Struct, StructData, MakeArrayView(Data, DataLength));
+}
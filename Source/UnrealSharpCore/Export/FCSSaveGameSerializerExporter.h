@@ -0,0 +1,25 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CSBindsManager.h"
+#include "FCSSaveGameSerializerExporter.generated.h"
+
+UCLASS()
+class UNREALSHARPCORE_API UFCSSaveGameSerializerExporter : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	UNREALSHARP_FUNCTION()
+	static void SaveObjects(UObject** Objects, int32 NumObjects, TArray<uint8>* OutData);
+
+	UNREALSHARP_FUNCTION()
+	static bool LoadObjects(UObject** Objects, int32 NumObjects, const uint8* Data, int32 DataLength);
+
+	UNREALSHARP_FUNCTION()
+	static void SaveStruct(const UScriptStruct* Struct, const void* StructData, TArray<uint8>* OutData);
+
+	UNREALSHARP_FUNCTION()
+	static bool LoadStruct(const UScriptStruct* Struct, void* StructData, const uint8* Data, int32 DataLength);
+};
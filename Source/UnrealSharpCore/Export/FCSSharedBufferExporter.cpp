@@ -0,0 +1,19 @@
+#include "FCSSharedBufferExporter.h"
+#include "UnrealSharpCore/CSSharedBufferSlab.h"
+
+void* UFCSSharedBufferExporter::AcquireSharedBuffer(int64 Size, int64* OutCapacity)
+{
+	FCSSharedBufferSlab::FBuffer* Buffer = FCSSharedBufferSlab::Acquire(Size);
+	*OutCapacity = Buffer->Capacity;
+	return Buffer->GetData();
+}
+
+void UFCSSharedBufferExporter::AddRefSharedBuffer(void* Data)
+{
+	FCSSharedBufferSlab::AddRef(FCSSharedBufferSlab::FromData(Data));
+}
+
+void UFCSSharedBufferExporter::ReleaseSharedBuffer(void* Data)
+{
+	FCSSharedBufferSlab::Release(FCSSharedBufferSlab::FromData(Data));
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CSBindsManager.h"
+#include "FCSSharedBufferExporter.generated.h"
+
+UCLASS()
+class UNREALSHARPCORE_API UFCSSharedBufferExporter : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	UNREALSHARP_FUNCTION(AnyThread)
+	static void* AcquireSharedBuffer(int64 Size, int64* OutCapacity);
+
+	UNREALSHARP_FUNCTION(AnyThread)
+	static void AddRefSharedBuffer(void* Data);
+
+	UNREALSHARP_FUNCTION(AnyThread)
+	static void ReleaseSharedBuffer(void* Data);
+};
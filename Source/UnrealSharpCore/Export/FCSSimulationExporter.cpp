@@ -0,0 +1,26 @@
+#include "FCSSimulationExporter.h"
+
+FCSSimulationSnapshot* UFCSSimulationExporter::CreateSnapshot(UObject** Objects, int32 NumObjects)
+{
+	return new FCSSimulationSnapshot(MakeArrayView(Objects, NumObjects));
+}
+
+void UFCSSimulationExporter::DestroySnapshot(FCSSimulationSnapshot* Snapshot)
+{
+	delete Snapshot;
+}
+
+void UFCSSimulationExporter::SaveState(FCSSimulationSnapshot* Snapshot, int32 Slot)
+{
+	Snapshot->Save(Slot);
+}
+
+bool UFCSSimulationExporter::RestoreState(FCSSimulationSnapshot* Snapshot, int32 Slot)
+{
+	return Snapshot->Restore(Slot);
+}
+
+int32 UFCSSimulationExporter::GetStateSize(FCSSimulationSnapshot* Snapshot)
+{
+	return Snapshot->GetStateSize();
+}
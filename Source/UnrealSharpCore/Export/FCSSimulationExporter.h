@@ -0,0 +1,30 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CSBindsManager.h"
+#include "CSSimulationSnapshot.h"
+#include "FCSSimulationExporter.generated.h"
+
+UCLASS()
+class UNREALSHARPCORE_API UFCSSimulationExporter : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	// Null objects are skipped. The snapshot is owned by the caller until it's passed to DestroySnapshot.
+	UNREALSHARP_FUNCTION()
+	static FCSSimulationSnapshot* CreateSnapshot(UObject** Objects, int32 NumObjects);
+
+	UNREALSHARP_FUNCTION()
+	static void DestroySnapshot(FCSSimulationSnapshot* Snapshot);
+
+	UNREALSHARP_FUNCTION()
+	static void SaveState(FCSSimulationSnapshot* Snapshot, int32 Slot);
+
+	UNREALSHARP_FUNCTION()
+	static bool RestoreState(FCSSimulationSnapshot* Snapshot, int32 Slot);
+
+	UNREALSHARP_FUNCTION()
+	static int32 GetStateSize(FCSSimulationSnapshot* Snapshot);
+};
@@ -0,0 +1,160 @@
+#include "FCSTraceBatchExporter.h"
+#include "CSManagedDelegate.h"
+#include "Async/ParallelFor.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+namespace
+{
+	// Fewer traces than this aren't worth waking up worker threads for.
+	constexpr int32 MinParallelTraces = 32;
+
+	struct FCSTraceBatchParams
+	{
+		FCollisionQueryParams SimpleParams;
+		FCollisionQueryParams ComplexParams;
+
+		FCSTraceBatchParams(AActor* const* IgnoredActors, int32 NumIgnoredActors)
+			: SimpleParams(SCENE_QUERY_STAT(UnrealSharpTraceBatch), false)
+			, ComplexParams(SCENE_QUERY_STAT(UnrealSharpTraceBatch), true)
+		{
+			for (int32 i = 0; i < NumIgnoredActors; ++i)
+			{
+				SimpleParams.AddIgnoredActor(IgnoredActors[i]);
+				ComplexParams.AddIgnoredActor(IgnoredActors[i]);
+			}
+		}
+
+		const FCollisionQueryParams& Get(const FCSTraceRequest& Request) const
+		{
+			return Request.bTraceComplex ? ComplexParams : SimpleParams;
+		}
+	};
+
+	ECollisionChannel GetCollisionChannel(const FCSTraceRequest& Request)
+	{
+		return UEngineTypes::ConvertToCollisionChannel(static_cast<ETraceTypeQuery>(Request.TraceChannel));
+	}
+
+	void WriteResult(const FHitResult& Hit, bool bBlockingHit, FCSTraceResult& OutResult)
+	{
+		OutResult.Location = Hit.Location;
+		OutResult.ImpactPoint = Hit.ImpactPoint;
+		OutResult.ImpactNormal = Hit.ImpactNormal;
+		OutResult.Component = Hit.GetComponent();
+		OutResult.Actor = Hit.GetActor();
+		OutResult.Distance = Hit.Distance;
+		OutResult.bBlockingHit = bBlockingHit;
+		OutResult.bStartPenetrating = Hit.bStartPenetrating;
+	}
+
+	// Owned by the trace delegate, so it goes with the async traces of the world if they never complete.
+	struct FCSPendingTraceBatch
+	{
+		FCSPendingTraceBatch(FCSTraceResult* InResults, int32 InNumPending, FGCHandleIntPtr CallbackHandle)
+			: Results(InResults)
+			, NumPending(InNumPending)
+			, Callback(FGCHandle(CallbackHandle, GCHandleType::StrongHandle))
+		{
+		}
+
+		~FCSPendingTraceBatch()
+		{
+			if (NumPending > 0)
+			{
+				Callback.Dispose();
+			}
+		}
+
+		FCSTraceResult* Results;
+		int32 NumPending;
+		FCSManagedDelegate Callback;
+	};
+
+	UWorld* GetWorld(UObject* WorldContextObject)
+	{
+		return GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+	}
+}
+
+void UFCSTraceBatchExporter::TraceBatch(UObject* WorldContextObject, const FCSTraceRequest* Requests, FCSTraceResult* OutResults, int32 Count, AActor* const* IgnoredActors, int32 NumIgnoredActors)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UFCSTraceBatchExporter::TraceBatch);
+
+	FMemory::Memzero(OutResults, sizeof(FCSTraceResult) * Count);
+
+	const UWorld* World = GetWorld(WorldContextObject);
+	if (!World)
+	{
+		return;
+	}
+
+	const FCSTraceBatchParams Params(IgnoredActors, NumIgnoredActors);
+
+	// Scene queries are read only and safe to run from several threads, async traces do the same.
+	ParallelFor(Count, [&](int32 Index)
+	{
+		const FCSTraceRequest& Request = Requests[Index];
+
+		FHitResult Hit;
+		const bool bBlockingHit = Request.SweepRadius > 0.0f
+			? World->SweepSingleByChannel(Hit, Request.Start, Request.End, FQuat::Identity, GetCollisionChannel(Request), FCollisionShape::MakeSphere(Request.SweepRadius), Params.Get(Request))
+			: World->LineTraceSingleByChannel(Hit, Request.Start, Request.End, GetCollisionChannel(Request), Params.Get(Request));
+
+		WriteResult(Hit, bBlockingHit, OutResults[Index]);
+	}, Count < MinParallelTraces ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+}
+
+bool UFCSTraceBatchExporter::AsyncTraceBatch(UObject* WorldContextObject, const FCSTraceRequest* Requests, FCSTraceResult* OutResults, int32 Count, AActor* const* IgnoredActors, int32 NumIgnoredActors, FGCHandleIntPtr CallbackHandle)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UFCSTraceBatchExporter::AsyncTraceBatch);
+
+	UWorld* World = GetWorld(WorldContextObject);
+	if (!World)
+	{
+		return false;
+	}
+
+	FMemory::Memzero(OutResults, sizeof(FCSTraceResult) * Count);
+
+	if (Count == 0)
+	{
+		FCSManagedDelegate(FGCHandle(CallbackHandle, GCHandleType::StrongHandle)).Invoke(WorldContextObject);
+		return true;
+	}
+
+	const TSharedRef<FCSPendingTraceBatch> Batch = MakeShared<FCSPendingTraceBatch>(OutResults, Count, CallbackHandle);
+	TWeakObjectPtr<UObject> WeakWorldContext = WorldContextObject;
+
+	// A single delegate for the whole batch, the index of the trace travels as its user data.
+	const FTraceDelegate OnTraceDone = FTraceDelegate::CreateLambda([Batch, WeakWorldContext](const FTraceHandle&, FTraceDatum& Datum)
+	{
+		const FHitResult* Hit = Datum.OutHits.FindByPredicate([](const FHitResult& Candidate) { return Candidate.bBlockingHit; });
+		WriteResult(Hit ? *Hit : FHitResult(), Hit != nullptr, Batch->Results[Datum.UserData]);
+
+		if (--Batch->NumPending == 0)
+		{
+			Batch->Callback.Invoke(WeakWorldContext.Get());
+		}
+	});
+
+	const FCSTraceBatchParams Params(IgnoredActors, NumIgnoredActors);
+
+	for (int32 i = 0; i < Count; ++i)
+	{
+		const FCSTraceRequest& Request = Requests[i];
+
+		if (Request.SweepRadius > 0.0f)
+		{
+			World->AsyncSweepByChannel(EAsyncTraceType::Single, Request.Start, Request.End, FQuat::Identity, GetCollisionChannel(Request),
+				FCollisionShape::MakeSphere(Request.SweepRadius), Params.Get(Request), FCollisionResponseParams::DefaultResponseParam, &OnTraceDone, i);
+		}
+		else
+		{
+			World->AsyncLineTraceByChannel(EAsyncTraceType::Single, Request.Start, Request.End, GetCollisionChannel(Request),
+				Params.Get(Request), FCollisionResponseParams::DefaultResponseParam, &OnTraceDone, i);
+		}
+	}
+
+	return true;
+}
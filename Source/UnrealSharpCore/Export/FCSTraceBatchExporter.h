@@ -0,0 +1,56 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CSBindsManager.h"
+#include "CSManagedGCHandle.h"
+#include "FCSTraceBatchExporter.generated.h"
+
+class UPrimitiveComponent;
+
+// Mirrors TraceRequest in C#.
+struct FCSTraceRequest
+{
+	FVector Start;
+	FVector End;
+
+	// Sweeps a sphere of this radius when above zero, traces a line otherwise.
+	float SweepRadius;
+
+	// An ETraceTypeQuery, like the trace channels generated for C#.
+	int32 TraceChannel;
+
+	uint8 bTraceComplex;
+};
+
+// Mirrors TraceResult in C#. The pointers are only valid for the frame the result is delivered in.
+struct FCSTraceResult
+{
+	FVector Location;
+	FVector ImpactPoint;
+	FVector ImpactNormal;
+	UPrimitiveComponent* Component;
+	AActor* Actor;
+	float Distance;
+	uint8 bBlockingHit;
+	uint8 bStartPenetrating;
+};
+
+/**
+ * Runs many traces by channel with a single call from C#, either right away spread over worker threads,
+ * or as async traces of the world whose results all come back next frame with a single callback.
+ */
+UCLASS()
+class UNREALSHARPCORE_API UFCSTraceBatchExporter : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	UNREALSHARP_FUNCTION()
+	static void TraceBatch(UObject* WorldContextObject, const FCSTraceRequest* Requests, FCSTraceResult* OutResults, int32 Count, AActor* const* IgnoredActors, int32 NumIgnoredActors);
+
+	// OutResults must stay alive until the callback ran, or the world went away, in which case the callback is freed without running.
+	// Returns false if there is no world to trace in, the callback is then left to the caller.
+	UNREALSHARP_FUNCTION()
+	static bool AsyncTraceBatch(UObject* WorldContextObject, const FCSTraceRequest* Requests, FCSTraceResult* OutResults, int32 Count, AActor* const* IgnoredActors, int32 NumIgnoredActors, FGCHandleIntPtr CallbackHandle);
+};
@@ -0,0 +1,75 @@
+#include "FCSTraceExporter.h"
+#include "Misc/CommandLine.h"
+#include "ProfilingDebugging/CountersTrace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/MiscTrace.h"
+
+TRACE_DECLARE_INT_COUNTER(UnrealSharpRuntimeGCCount, TEXT("UnrealSharp/Runtime/GCCount"));
+TRACE_DECLARE_FLOAT_COUNTER(UnrealSharpRuntimeGCPauseMs, TEXT("UnrealSharp/Runtime/GCPauseMs"));
+TRACE_DECLARE_INT_COUNTER(UnrealSharpRuntimeJittedMethods, TEXT("UnrealSharp/Runtime/JittedMethods"));
+TRACE_DECLARE_INT_COUNTER(UnrealSharpRuntimeThreadPoolWorkerThreads, TEXT("UnrealSharp/Runtime/ThreadPoolWorkerThreads"));
+TRACE_DECLARE_INT_COUNTER(UnrealSharpRuntimeThreadPoolQueueLength, TEXT("UnrealSharp/Runtime/ThreadPoolQueueLength"));
+
+bool UFCSTraceExporter::IsRuntimeTracingEnabled()
+{
+	return IsCpuTracing() || FParse::Param(FCommandLine::Get(), TEXT("UnrealSharpTraceRuntime"));
+}
+
+bool UFCSTraceExporter::IsCpuTracing()
+{
+#if CPUPROFILERTRACE_ENABLED
+	return UE_TRACE_CHANNELEXPR_IS_ENABLED(CpuChannel);
+#else
+	return false;
+#endif
+}
+
+uint32 UFCSTraceExporter::GetScopeId(const TCHAR* Name)
+{
+#if CPUPROFILERTRACE_ENABLED
+	return FCpuProfilerTrace::OutputEventType(Name);
+#else
+	return 0;
+#endif
+}
+
+void UFCSTraceExporter::BeginScope(uint32 ScopeId)
+{
+#if CPUPROFILERTRACE_ENABLED
+	FCpuProfilerTrace::OutputBeginEvent(ScopeId);
+#endif
+}
+
+void UFCSTraceExporter::EndScope()
+{
+#if CPUPROFILERTRACE_ENABLED
+	FCpuProfilerTrace::OutputEndEvent();
+#endif
+}
+
+void UFCSTraceExporter::SetRuntimeCounter(int32 Counter, double Value)
+{
+	switch (static_cast<ECSRuntimeTraceCounter>(Counter))
+	{
+	case ECSRuntimeTraceCounter::GCCount:
+		TRACE_COUNTER_SET(UnrealSharpRuntimeGCCount, static_cast<int64>(Value));
+		break;
+	case ECSRuntimeTraceCounter::GCPauseMs:
+		TRACE_COUNTER_SET(UnrealSharpRuntimeGCPauseMs, Value);
+		break;
+	case ECSRuntimeTraceCounter::JittedMethods:
+		TRACE_COUNTER_SET(UnrealSharpRuntimeJittedMethods, static_cast<int64>(Value));
+		break;
+	case ECSRuntimeTraceCounter::ThreadPoolWorkerThreads:
+		TRACE_COUNTER_SET(UnrealSharpRuntimeThreadPoolWorkerThreads, static_cast<int64>(Value));
+		break;
+	case ECSRuntimeTraceCounter::ThreadPoolQueueLength:
+		TRACE_COUNTER_SET(UnrealSharpRuntimeThreadPoolQueueLength, static_cast<int64>(Value));
+		break;
+	}
+}
+
+void UFCSTraceExporter::AddBookmark(const TCHAR* Text)
+{
+	TRACE_BOOKMARK(TEXT("%s"), Text);
+}
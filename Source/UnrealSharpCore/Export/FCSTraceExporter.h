@@ -0,0 +1,51 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CSBindsManager.h"
+#include "FCSTraceExporter.generated.h"
+
+// Runtime counters the managed runtime event bridge reports, mirrors RuntimeTraceCounter in C#.
+enum class ECSRuntimeTraceCounter : int32
+{
+	GCCount,
+	GCPauseMs,
+	JittedMethods,
+	ThreadPoolWorkerThreads,
+	ThreadPoolQueueLength,
+};
+
+/**
+ * Lets managed code write to the trace the editor and Insights read, so managed scopes and runtime events
+ * share a timeline with native code.
+ */
+UCLASS()
+class UNREALSHARPCORE_API UFCSTraceExporter : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	// Whether the runtime event bridge should start: CPU tracing is on, or -UnrealSharpTraceRuntime was passed.
+	UNREALSHARP_FUNCTION()
+	static bool IsRuntimeTracingEnabled();
+
+	// Whether scopes begun now would be recorded.
+	UNREALSHARP_FUNCTION()
+	static bool IsCpuTracing();
+
+	// Registers a CPU scope name, the id is what BeginScope takes.
+	UNREALSHARP_FUNCTION()
+	static uint32 GetScopeId(const TCHAR* Name);
+
+	UNREALSHARP_FUNCTION()
+	static void BeginScope(uint32 ScopeId);
+
+	UNREALSHARP_FUNCTION()
+	static void EndScope();
+
+	UNREALSHARP_FUNCTION()
+	static void SetRuntimeCounter(int32 Counter, double Value);
+
+	UNREALSHARP_FUNCTION()
+	static void AddBookmark(const TCHAR* Text);
+};
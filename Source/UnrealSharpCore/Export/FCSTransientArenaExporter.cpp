@@ -0,0 +1,17 @@
+#include "FCSTransientArenaExporter.h"
+#include "UnrealSharpCore/CSTransientArena.h"
+
+void* UFCSTransientArenaExporter::AllocateTransient(int64 Size, int32 Alignment)
+{
+	return FCSTransientArena::Get().Allocate(Size, Alignment);
+}
+
+void UFCSTransientArenaExporter::PushTransientScope()
+{
+	FCSTransientArena::Get().PushScope();
+}
+
+void UFCSTransientArenaExporter::PopTransientScope()
+{
+	FCSTransientArena::Get().PopScope();
+}
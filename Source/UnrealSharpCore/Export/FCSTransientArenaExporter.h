@@ -0,0 +1,22 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CSBindsManager.h"
+#include "FCSTransientArenaExporter.generated.h"
+
+UCLASS()
+class UNREALSHARPCORE_API UFCSTransientArenaExporter : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	UNREALSHARP_FUNCTION()
+	static void* AllocateTransient(int64 Size, int32 Alignment);
+
+	UNREALSHARP_FUNCTION()
+	static void PushTransientScope();
+
+	UNREALSHARP_FUNCTION()
+	static void PopTransientScope();
+};
@@ -13,15 +13,15 @@ class UNREALSHARPCORE_API UFEditorDelegatesExporter : public UObject
 	
 public:
 
-	UNREALSHARP_FUNCTION()
+	UNREALSHARP_FUNCTION(EditorOnly)
 	static void BindEndPIE(FPIEEvent Delegate, FDelegateHandle* DelegateHandle);
 
-	UNREALSHARP_FUNCTION()
+	UNREALSHARP_FUNCTION(EditorOnly)
 	static void BindStartPIE(FPIEEvent Delegate, FDelegateHandle* DelegateHandle);
 
-	UNREALSHARP_FUNCTION()
+	UNREALSHARP_FUNCTION(EditorOnly)
 	static void UnbindEndPIE(FDelegateHandle DelegateHandle);
 
-	UNREALSHARP_FUNCTION()
+	UNREALSHARP_FUNCTION(EditorOnly)
 	static void UnbindStartPIE(FDelegateHandle DelegateHandle);
 };
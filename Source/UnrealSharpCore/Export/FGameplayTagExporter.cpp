@@ -0,0 +1,39 @@
+﻿#include "FGameplayTagExporter.h"
+#include "GameplayTagsManager.h"
+#include "UnrealSharpCore/UnrealSharpCore.h"
+
+int32 UFGameplayTagExporter::RequestGameplayTags(const TCHAR* TagTable, int32 TableLength, FName* OutTagNames, int32 NumTags)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UFGameplayTagExporter::RequestGameplayTags);
+
+	const UGameplayTagsManager& GameplayTagsManager = UGameplayTagsManager::Get();
+
+	int32 NumResolved = 0;
+	int32 TagIndex = 0;
+	int32 TagStart = 0;
+
+	for (int32 Index = 0; Index <= TableLength && TagIndex < NumTags; ++Index)
+	{
+		if (Index < TableLength && TagTable[Index] != TEXT(','))
+		{
+			continue;
+		}
+
+		const FName TagName(Index - TagStart, TagTable + TagStart);
+		const FGameplayTag Tag = GameplayTagsManager.RequestGameplayTag(TagName, false);
+
+		if (Tag.IsValid())
+		{
+			++NumResolved;
+		}
+		else
+		{
+			UE_LOG(LogUnrealSharp, Warning, TEXT("Failed to resolve GameplayTag %s, it's left as None."), *TagName.ToString());
+		}
+
+		OutTagNames[TagIndex++] = Tag.GetTagName();
+		TagStart = Index + 1;
+	}
+
+	return NumResolved;
+}
@@ -0,0 +1,18 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "CSBindsManager.h"
+#include "FGameplayTagExporter.generated.h"
+
+UCLASS()
+class UNREALSHARPCORE_API UFGameplayTagExporter : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	// Resolves the comma separated tags of TagTable into OutTagNames in one call, used by the generated GameplayTags class.
+	// Tags that aren't registered are left as None. Returns the number of tags that were resolved.
+	UNREALSHARP_FUNCTION()
+	static int32 RequestGameplayTags(const TCHAR* TagTable, int32 TableLength, FName* OutTagNames, int32 NumTags);
+};
@@ -9,3 +9,8 @@ void* UFMapPropertyExporter::GetValue(FMapProperty* MapProperty)
 {
 	return MapProperty->ValueProp;
 }
+
+int UFMapPropertyExporter::GetPairStride(FMapProperty* MapProperty)
+{
+	return MapProperty->MapLayout.SetLayout.SparseArrayLayout.Size;
+}
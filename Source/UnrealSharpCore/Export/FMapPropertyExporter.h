@@ -17,4 +17,8 @@ public:
 
 	UNREALSHARP_FUNCTION()
 	static void* GetValue(FMapProperty* MapProperty);
+
+	// Distance between two pairs of a map of this property, including the hash bookkeeping of the map.
+	UNREALSHARP_FUNCTION()
+	static int GetPairStride(FMapProperty* MapProperty);
 };
@@ -11,7 +11,7 @@ class UNREALSHARPCORE_API UFMatrixExporter : public UObject
 
 public:
 
-	UNREALSHARP_FUNCTION()
+	UNREALSHARP_FUNCTION(AnyThread)
 	static void FromRotator(FMatrix* Matrix, const FRotator Rotator);
 	
 };
@@ -1,9 +1,40 @@
 #include "FMsgExporter.h"
 
-void UFMsgExporter::Log(const UTF16CHAR* ManagedCategoryName, ELogVerbosity::Type Verbosity, const UTF16CHAR* ManagedMessage)
+namespace
 {
-	FString Message = FString(ManagedMessage);
-	FName CategoryName = FName(ManagedCategoryName);
+	FCriticalSection ManagedLogCategoriesLock;
+
+	// Registered with the log suppression system like native categories, so "Log <Category> <Verbosity>" and the ini settings apply.
+	TMap<FName, TUniquePtr<FLogCategoryBase>> ManagedLogCategories;
+}
+
+FLogCategoryBase* UFMsgExporter::GetLogCategory(const UTF16CHAR* ManagedCategoryName)
+{
+	const FName CategoryName(ManagedCategoryName);
+
+	FScopeLock Lock(&ManagedLogCategoriesLock);
+	TUniquePtr<FLogCategoryBase>& Category = ManagedLogCategories.FindOrAdd(CategoryName);
+	if (!Category.IsValid())
+	{
+		Category = MakeUnique<FLogCategoryBase>(CategoryName, ELogVerbosity::Log, ELogVerbosity::All);
+	}
 	
-	FMsg::Logf(nullptr, 0, CategoryName, Verbosity, TEXT("%s"), *Message);
+	return Category.Get();
+}
+
+uint8 UFMsgExporter::IsLogActive(const FLogCategoryBase* Category, ELogVerbosity::Type Verbosity)
+{
+	return !Category->IsSuppressed(Verbosity);
+}
+
+void UFMsgExporter::Log(const FLogCategoryBase* Category, ELogVerbosity::Type Verbosity, const UTF16CHAR* ManagedMessage, int32 Length)
+{
+	if (Category->IsSuppressed(Verbosity))
+	{
+		return;
+	}
+
+	// No copy on platforms where TCHAR is UTF-16 already.
+	const auto Message = StringCast<TCHAR>(ManagedMessage, Length);
+	FMsg::Logf(nullptr, 0, Category->GetCategoryName(), Verbosity, TEXT("%.*s"), Message.Length(), Message.Get());
 }
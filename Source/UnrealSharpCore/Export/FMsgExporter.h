@@ -11,7 +11,15 @@ class UNREALSHARPCORE_API UFMsgExporter : public UObject
 
 public:
 
+	// Finds or creates the log category of a managed log class. Lives until shutdown, so managed code resolves it once and keeps the pointer.
 	UNREALSHARP_FUNCTION()
-	static void Log(const UTF16CHAR* ManagedCategoryName, ELogVerbosity::Type Verbosity, const UTF16CHAR* ManagedMessage);
+	static FLogCategoryBase* GetLogCategory(const UTF16CHAR* ManagedCategoryName);
+
+	UNREALSHARP_FUNCTION()
+	static uint8 IsLogActive(const FLogCategoryBase* Category, ELogVerbosity::Type Verbosity);
+
+	// The message is not null terminated, and is only converted when the category is active.
+	UNREALSHARP_FUNCTION()
+	static void Log(const FLogCategoryBase* Category, ELogVerbosity::Type Verbosity, const UTF16CHAR* ManagedMessage, int32 Length);
 	
 };
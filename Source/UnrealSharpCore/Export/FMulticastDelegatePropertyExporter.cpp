@@ -1,6 +1,86 @@
 ﻿#include "FMulticastDelegatePropertyExporter.h"
+#include "TypeGenerator/Functions/CSFunction.h"
 
-void UFMulticastDelegatePropertyExporter::AddDelegate(FMulticastDelegateProperty* DelegateProperty, FMulticastScriptDelegate* Delegate, UObject* Target, const char* FunctionName)
+namespace
+{
+	// ProcessMulticastDelegate is the only way to walk the bindings, and it calls every one of them through ProcessEvent.
+	struct FInvocationListAccess : FMulticastScriptDelegate
+	{
+		static const auto& Get(const FMulticastScriptDelegate& Delegate)
+		{
+			return Delegate.*(&FInvocationListAccess::InvocationList);
+		}
+	};
+
+	UCSFunctionBase* GetBatchableFunction(UFunction* Function)
+	{
+		UCSFunctionBase* ManagedFunction = Cast<UCSFunctionBase>(Function);
+		if (!ManagedFunction || ManagedFunction->HasAnyFunctionFlags(FUNC_Net) || ManagedFunction->GetReturnProperty())
+		{
+			return nullptr;
+		}
+
+		return ManagedFunction;
+	}
+
+	// Same order and parameters as ProcessMulticastDelegate, but consecutive bindings to the same C# function,
+	// like every listener of a class bound to OnDamaged, are invoked with one transition into C#.
+	void BroadcastBatched(const FMulticastScriptDelegate& Delegate, void* Parameters)
+	{
+		// Handlers may add or remove bindings while we are broadcasting.
+		TArray<FScriptDelegate, TInlineAllocator<16>> Bindings;
+		Bindings.Append(FInvocationListAccess::Get(Delegate));
+
+		UCSFunctionBase* BatchFunction = nullptr;
+		TArray<UObject*, TInlineAllocator<16>> BatchObjects;
+
+		auto FlushBatch = [&]
+		{
+			if (BatchObjects.Num() == 1)
+			{
+				BatchObjects[0]->ProcessEvent(BatchFunction, Parameters);
+			}
+			else if (BatchObjects.Num() > 1)
+			{
+				// Every handler gets the same parameters, a stride of 0 keeps pointing the batch at them.
+				BatchFunction->InvokeManagedMethodBatch(BatchObjects, static_cast<uint8*>(Parameters), 0);
+			}
+
+			BatchFunction = nullptr;
+			BatchObjects.Reset();
+		};
+
+		for (const FScriptDelegate& Binding : Bindings)
+		{
+			UObject* Object = Binding.GetUObject();
+			if (!Object)
+			{
+				continue;
+			}
+
+			UFunction* Function = Object->FindFunctionChecked(Binding.GetFunctionName());
+			UCSFunctionBase* ManagedFunction = GetBatchableFunction(Function);
+
+			if (!ManagedFunction || ManagedFunction != BatchFunction)
+			{
+				FlushBatch();
+			}
+
+			if (!ManagedFunction)
+			{
+				Object->ProcessEvent(Function, Parameters);
+				continue;
+			}
+
+			BatchFunction = ManagedFunction;
+			BatchObjects.Add(Object);
+		}
+
+		FlushBatch();
+	}
+}
+
+void UFMulticastDelegatePropertyExporter::AddDelegate(FMulticastDelegateProperty* DelegateProperty, FMulticastScriptDelegate* Delegate, UObject* Target, FName FunctionName)
 {
 	FScriptDelegate NewScriptDelegate = MakeScriptDelegate(Target, FunctionName);
 	DelegateProperty->AddDelegate(NewScriptDelegate, nullptr, Delegate);
@@ -16,7 +96,7 @@ void UFMulticastDelegatePropertyExporter::ToString(FMulticastScriptDelegate* Del
 	*OutString = Delegate->ToString<UObject>();
 }
 
-void UFMulticastDelegatePropertyExporter::RemoveDelegate(FMulticastDelegateProperty* DelegateProperty, FMulticastScriptDelegate* Delegate, UObject* Target, const char* FunctionName)
+void UFMulticastDelegatePropertyExporter::RemoveDelegate(FMulticastDelegateProperty* DelegateProperty, FMulticastScriptDelegate* Delegate, UObject* Target, FName FunctionName)
 {
 	FScriptDelegate NewScriptDelegate = MakeScriptDelegate(Target, FunctionName);
 	DelegateProperty->RemoveDelegate(NewScriptDelegate, nullptr, Delegate);
@@ -30,10 +110,13 @@ void UFMulticastDelegatePropertyExporter::ClearDelegate(FMulticastDelegateProper
 void UFMulticastDelegatePropertyExporter::BroadcastDelegate(FMulticastDelegateProperty* DelegateProperty, const FMulticastScriptDelegate* Delegate, void* Parameters)
 {
 	Delegate = TryGetSparseMulticastDelegate(DelegateProperty, Delegate);
-	Delegate->ProcessMulticastDelegate<UObject>(Parameters);
+	if (Delegate->IsBound())
+	{
+		BroadcastBatched(*Delegate, Parameters);
+	}
 }
 
-bool UFMulticastDelegatePropertyExporter::ContainsDelegate(FMulticastDelegateProperty* DelegateProperty, const FMulticastScriptDelegate* Delegate, UObject* Target, const char* FunctionName)
+bool UFMulticastDelegatePropertyExporter::ContainsDelegate(FMulticastDelegateProperty* DelegateProperty, const FMulticastScriptDelegate* Delegate, UObject* Target, FName FunctionName)
 {
 	FScriptDelegate NewScriptDelegate = MakeScriptDelegate(Target, FunctionName);
 	Delegate = TryGetSparseMulticastDelegate(DelegateProperty, Delegate);
@@ -45,7 +128,7 @@ void* UFMulticastDelegatePropertyExporter::GetSignatureFunction(FMulticastDelega
 	return DelegateProperty->SignatureFunction;
 }
 
-FScriptDelegate UFMulticastDelegatePropertyExporter::MakeScriptDelegate(UObject* Target, const char* FunctionName)
+FScriptDelegate UFMulticastDelegatePropertyExporter::MakeScriptDelegate(UObject* Target, FName FunctionName)
 {
 	FScriptDelegate NewDelegate;
 	NewDelegate.BindUFunction(Target, FunctionName);
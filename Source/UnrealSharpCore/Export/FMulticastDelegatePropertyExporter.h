@@ -26,7 +26,7 @@ class UNREALSHARPCORE_API UFMulticastDelegatePropertyExporter : public UObject
 
 public:
 	UNREALSHARP_FUNCTION()
-	static void AddDelegate(FMulticastDelegateProperty* DelegateProperty, FMulticastScriptDelegate* Delegate, UObject* Target, const char* FunctionName);
+	static void AddDelegate(FMulticastDelegateProperty* DelegateProperty, FMulticastScriptDelegate* Delegate, UObject* Target, FName FunctionName);
 
 	UNREALSHARP_FUNCTION()
 	static bool IsBound(FMulticastScriptDelegate* Delegate);
@@ -35,22 +35,23 @@ public:
 	static void ToString(FMulticastScriptDelegate* Delegate, FString* OutString);
 	
 	UNREALSHARP_FUNCTION()
-	static void RemoveDelegate(FMulticastDelegateProperty* DelegateProperty, FMulticastScriptDelegate* Delegate, UObject* Target, const char* FunctionName);
+	static void RemoveDelegate(FMulticastDelegateProperty* DelegateProperty, FMulticastScriptDelegate* Delegate, UObject* Target, FName FunctionName);
 
 	UNREALSHARP_FUNCTION()
 	static void ClearDelegate(FMulticastDelegateProperty* DelegateProperty, FMulticastScriptDelegate* Delegate);
 
+	// Bindings in a row that call the same C# function go into C# in a single batched call, the rest through ProcessEvent.
 	UNREALSHARP_FUNCTION()
 	static void BroadcastDelegate(FMulticastDelegateProperty* DelegateProperty, const FMulticastScriptDelegate* Delegate, void* Parameters);
 
 	UNREALSHARP_FUNCTION()
-	static bool ContainsDelegate(FMulticastDelegateProperty* DelegateProperty, const FMulticastScriptDelegate* Delegate, UObject* Target, const char* FunctionName);
+	static bool ContainsDelegate(FMulticastDelegateProperty* DelegateProperty, const FMulticastScriptDelegate* Delegate, UObject* Target, FName FunctionName);
 
 	UNREALSHARP_FUNCTION()
 	static void* GetSignatureFunction(FMulticastDelegateProperty* DelegateProperty);
 
 	UNREALSHARP_FUNCTION()
-	static FScriptDelegate MakeScriptDelegate(UObject* Target, const char* FunctionName);
+	static FScriptDelegate MakeScriptDelegate(UObject* Target, FName FunctionName);
 
 	UNREALSHARP_FUNCTION()
 	static const FMulticastScriptDelegate* TryGetSparseMulticastDelegate(FMulticastDelegateProperty* DelegateProperty, const FMulticastScriptDelegate* Delegate);
@@ -1,8 +1,11 @@
 ﻿#include "FNameExporter.h"
+#include "CSInteropAllocationTracker.h"
 
 void UFNameExporter::NameToString(FName Name, FString* OutString)
 {
+	const int32 OldCapacity = OutString->GetCharArray().Max();
 	Name.ToString(*OutString);
+	CS_TRACK_INTEROP_STRING_ALLOCATION("FNameExporter", "NameToString", *OutString, OldCapacity);
 }
 
 void UFNameExporter::StringToName(FName* Name, const UTF16CHAR* String)
@@ -15,3 +18,58 @@ bool UFNameExporter::IsValid(FName Name)
 	bool bIsValid = Name.IsValid();
 	return bIsValid;
 }
+
+int32 UFNameExporter::NameToStringBuffer(FName Name, TCHAR* Buffer, int32 BufferLength)
+{
+	TStringBuilder<FName::StringBufferSize> Builder;
+	Name.AppendString(Builder);
+
+	const int32 Length = Builder.Len();
+	if (Length <= BufferLength)
+	{
+		FMemory::Memcpy(Buffer, Builder.GetData(), Length * sizeof(TCHAR));
+	}
+	
+	return Length;
+}
+
+void UFNameExporter::StringViewToName(FName* Name, const TCHAR* Data, int32 Length)
+{
+	*Name = FName(Length, Data);
+}
+
+void UFNameExporter::StringTableToNames(FName* OutNames, int32 NumNames, const TCHAR* Table, int32 TableLength)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UFNameExporter::StringTableToNames);
+	
+	int32 NameIndex = 0;
+	int32 NameStart = 0;
+	
+	for (int32 Index = 0; Index <= TableLength && NameIndex < NumNames; ++Index)
+	{
+		if (Index < TableLength && Table[Index] != TEXT('\0'))
+		{
+			continue;
+		}
+		
+		OutNames[NameIndex++] = FName(Index - NameStart, Table + NameStart);
+		NameStart = Index + 1;
+	}
+}
+
+bool UFNameExporter::FindName(FName* Name, const TCHAR* Data, int32 Length)
+{
+	*Name = FName(Length, Data, FNAME_Find);
+	return !Name->IsNone() || Length == 0;
+}
+
+bool UFNameExporter::EqualsStringView(FName Name, const TCHAR* Data, int32 Length)
+{
+	if (Length == 0)
+	{
+		return Name.IsNone();
+	}
+	
+	const FName OtherName(Length, Data, FNAME_Find);
+	return !OtherName.IsNone() && Name == OtherName;
+}
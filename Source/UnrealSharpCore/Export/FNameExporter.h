@@ -19,5 +19,25 @@ public:
 	
 	UNREALSHARP_FUNCTION()
 	static bool IsValid(FName Name);
+
+	// Writes the name into Buffer, up to BufferLength characters without a terminator.
+	// Returns the full length of the name, so the caller can retry with a larger buffer.
+	UNREALSHARP_FUNCTION()
+	static int32 NameToStringBuffer(FName Name, TCHAR* Buffer, int32 BufferLength);
+
+	UNREALSHARP_FUNCTION()
+	static void StringViewToName(FName* Name, const TCHAR* Data, int32 Length);
+
+	// Turns a table of null separated strings into NumNames names in one call, used by the name literals of the generated glue.
+	UNREALSHARP_FUNCTION()
+	static void StringTableToNames(FName* OutNames, int32 NumNames, const TCHAR* Table, int32 TableLength);
+
+	// Looks the name up without adding it to the name table.
+	UNREALSHARP_FUNCTION()
+	static bool FindName(FName* Name, const TCHAR* Data, int32 Length);
+
+	// Compares with the same rules as FName equality, without adding the string to the name table.
+	UNREALSHARP_FUNCTION()
+	static bool EqualsStringView(FName Name, const TCHAR* Data, int32 Length);
 	
 };
@@ -6,6 +6,39 @@ FProperty* UFPropertyExporter::GetNativePropertyFromName(UStruct* Struct, const
 	return Property;
 }
 
+int32 UFPropertyExporter::DescribeStructLayout(UStruct* Struct, FCSPropertyLayout* OutLayouts, int32 MaxLayouts)
+{
+	int32 NumProperties = 0;
+	for (TFieldIterator<FProperty> It(Struct, EFieldIteratorFlags::IncludeSuper); It; ++It)
+	{
+		if (NumProperties < MaxLayouts)
+		{
+			FProperty* Property = *It;
+
+			TStringBuilder<FName::StringBufferSize> Name;
+			Property->GetFName().AppendString(Name);
+
+			uint32 NameHash = 2166136261u;
+			for (const TCHAR Character : Name.ToView())
+			{
+				NameHash = (NameHash ^ static_cast<uint32>(Character)) * 16777619u;
+			}
+
+			FCSPropertyLayout& Layout = OutLayouts[NumProperties];
+			Layout.Property = Property;
+			Layout.PropertyFlags = static_cast<uint64>(Property->PropertyFlags);
+			Layout.NameHash = NameHash;
+			Layout.Offset = Property->GetOffset_ForInternal();
+			Layout.Size = Property->GetSize();
+			Layout.ArrayDim = Property->ArrayDim;
+		}
+
+		++NumProperties;
+	}
+
+	return NumProperties;
+}
+
 int32 UFPropertyExporter::GetPropertyOffset(FProperty* Property)
 {
 	return Property->GetOffset_ForInternal();
@@ -77,6 +110,14 @@ void UFPropertyExporter::SetValue_InContainer(FProperty* Property, void* Contain
 	Property->SetValue_InContainer(Container, Value);
 }
 
+void UFPropertyExporter::SetValues_InContainer(FProperty* const* Properties, void* Container, const uint8* Values, const int32* ValueOffsets, int32 NumProperties)
+{
+	for (int32 i = 0; i < NumProperties; ++i)
+	{
+		Properties[i]->SetValue_InContainer(Container, Values + ValueOffsets[i]);
+	}
+}
+
 uint8 UFPropertyExporter::GetBoolPropertyFieldMaskFromName(UStruct* InStruct, const char* InPropertyName)
 {
 	FBoolProperty* Property = FindFProperty<FBoolProperty>(InStruct, InPropertyName);
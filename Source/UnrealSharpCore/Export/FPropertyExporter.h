@@ -6,6 +6,20 @@
 #include "CSBindsManager.h"
 #include "FPropertyExporter.generated.h"
 
+/**
+ * One property of a struct as DescribeStructLayout reports it. Mirrored by FPropertyLayout in C#.
+ * NameHash is the 32-bit FNV-1a hash of the UTF-16 code units of the property name.
+ */
+struct FCSPropertyLayout
+{
+	FProperty* Property;
+	uint64 PropertyFlags;
+	uint32 NameHash;
+	int32 Offset;
+	int32 Size;
+	int32 ArrayDim;
+};
+
 UCLASS()
 class UNREALSHARPCORE_API UFPropertyExporter : public UObject
 {
@@ -19,6 +33,11 @@ public:
 	UNREALSHARP_FUNCTION()
 	static int32 GetPropertyOffsetFromName(UStruct* InStruct, const char* InPropertyName);
 
+	// Fills OutLayouts with up to MaxLayouts properties of the struct and its super structs, most derived first.
+	// Returns the number of properties, call again with a larger buffer when it's more than MaxLayouts.
+	UNREALSHARP_FUNCTION()
+	static int32 DescribeStructLayout(UStruct* Struct, FCSPropertyLayout* OutLayouts, int32 MaxLayouts);
+
 	UNREALSHARP_FUNCTION()
 	static int32 GetPropertyArrayDimFromName(UStruct* InStruct, const char* PropertyName);
 
@@ -64,6 +83,10 @@ public:
 	UNREALSHARP_FUNCTION()
 	static void SetValue_InContainer(FProperty* Property, void* Container, void* Value);
 
+	// SetValue_InContainer for a block of properties, the value of Properties[i] starts at Values + ValueOffsets[i].
+	UNREALSHARP_FUNCTION()
+	static void SetValues_InContainer(FProperty* const* Properties, void* Container, const uint8* Values, const int32* ValueOffsets, int32 NumProperties);
+
 	UNREALSHARP_FUNCTION()
 	static uint8 GetBoolPropertyFieldMaskFromName(UStruct* InStruct, const char* InPropertyName);
 };
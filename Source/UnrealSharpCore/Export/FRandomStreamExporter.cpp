@@ -35,3 +35,27 @@ FVector UFRandomStreamExporter::VRandCone2(FRandomStream* RandomStream, FVector
 	return RandomStream->VRandCone(Dir, HorizontalConeHalfAngleRad, VerticalConeHalfAngleRad);
 }
 
+void UFRandomStreamExporter::FillRandFloats(FRandomStream* RandomStream, float* OutValues, int32 Count)
+{
+	for (int32 i = 0; i < Count; ++i)
+	{
+		OutValues[i] = RandomStream->GetFraction();
+	}
+}
+
+void UFRandomStreamExporter::FillRandRange(FRandomStream* RandomStream, int32 Min, int32 Max, int32* OutValues, int32 Count)
+{
+	for (int32 i = 0; i < Count; ++i)
+	{
+		OutValues[i] = RandomStream->RandRange(Min, Max);
+	}
+}
+
+void UFRandomStreamExporter::FillUnitVectors(FRandomStream* RandomStream, FVector* OutVectors, int32 Count)
+{
+	for (int32 i = 0; i < Count; ++i)
+	{
+		OutVectors[i] = RandomStream->GetUnitVector();
+	}
+}
+
@@ -14,22 +14,32 @@ public:
 	UNREALSHARP_FUNCTION()
 	static void GenerateNewSeed(FRandomStream* RandomStream);
 
-	UNREALSHARP_FUNCTION()
+	UNREALSHARP_FUNCTION(AnyThread)
 	static float GetFraction(FRandomStream* RandomStream);
 
-	UNREALSHARP_FUNCTION()
+	UNREALSHARP_FUNCTION(AnyThread)
 	static uint32 GetUnsignedInt(FRandomStream* RandomStream);
 
-	UNREALSHARP_FUNCTION()
+	UNREALSHARP_FUNCTION(AnyThread)
 	static FVector GetUnitVector(FRandomStream* RandomStream);
 
-	UNREALSHARP_FUNCTION()
+	UNREALSHARP_FUNCTION(AnyThread)
 	static int RandRange(FRandomStream* RandomStream, int32 Min, int32 Max);
 
-	UNREALSHARP_FUNCTION()
+	UNREALSHARP_FUNCTION(AnyThread)
 	static FVector VRandCone(FRandomStream* RandomStream, FVector Dir, float ConeHalfAngleRad);
 
-	UNREALSHARP_FUNCTION()
+	UNREALSHARP_FUNCTION(AnyThread)
 	static FVector VRandCone2(FRandomStream* RandomStream, FVector Dir, float HorizontalConeHalfAngleRad, float VerticalConeHalfAngleRad);
+
+	// The Fill functions draw from the stream in order, the same values one call per value would give.
+	UNREALSHARP_FUNCTION(AnyThread)
+	static void FillRandFloats(FRandomStream* RandomStream, float* OutValues, int32 Count);
+
+	UNREALSHARP_FUNCTION(AnyThread)
+	static void FillRandRange(FRandomStream* RandomStream, int32 Min, int32 Max, int32* OutValues, int32 Count);
+
+	UNREALSHARP_FUNCTION(AnyThread)
+	static void FillUnitVectors(FRandomStream* RandomStream, FVector* OutVectors, int32 Count);
 	
 };
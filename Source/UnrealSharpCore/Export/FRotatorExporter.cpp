@@ -6,3 +6,21 @@ void UFRotatorExporter::FromMatrix(FRotator* Rotator, const FMatrix& Matrix)
 }
 
 
+
+
+void UFRotatorExporter::ToQuats(const FRotator* Rotators, FQuat* OutQuats, int32 Count)
+{
+	// FRotator::Quaternion computes all three sines and cosines in one vector operation.
+	for (int32 i = 0; i < Count; ++i)
+	{
+		OutQuats[i] = Rotators[i].Quaternion();
+	}
+}
+
+void UFRotatorExporter::FromQuats(const FQuat* Quats, FRotator* OutRotators, int32 Count)
+{
+	for (int32 i = 0; i < Count; ++i)
+	{
+		OutRotators[i] = Quats[i].Rotator();
+	}
+}
@@ -11,7 +11,13 @@ class UNREALSHARPCORE_API UFRotatorExporter : public UObject
 
 public:
 
-	UNREALSHARP_FUNCTION()
+	UNREALSHARP_FUNCTION(AnyThread)
 	static void FromMatrix(FRotator* Rotator, const FMatrix& Matrix);
+
+	UNREALSHARP_FUNCTION(AnyThread)
+	static void ToQuats(const FRotator* Rotators, FQuat* OutQuats, int32 Count);
+
+	UNREALSHARP_FUNCTION(AnyThread)
+	static void FromQuats(const FQuat* Quats, FRotator* OutRotators, int32 Count);
 	
 };
@@ -28,6 +28,15 @@ int UFScriptMapHelperExporter::FindMapPairIndexFromHash(FMapProperty* MapPropert
 #endif
 }
 
+int UFScriptMapHelperExporter::FindMapPairIndexWithHash(FMapProperty* MapProperty, const void* Address, const void* Key, uint32 KeyHash)
+{
+	FScriptMap* Map = static_cast<FScriptMap*>(const_cast<void*>(Address));
+	const FProperty* KeyProp = MapProperty->KeyProp;
+	return Map->FindPairIndex(Key, MapProperty->MapLayout,
+		[KeyHash](const void*) { return KeyHash; },
+		[KeyProp](const void* A, const void* B) { return KeyProp->Identical(A, B); });
+}
+
 void UFScriptMapHelperExporter::RemoveIndex(FMapProperty* MapProperty, const void* Address, int Index)
 {
 	FScriptMapHelper Helper(MapProperty, Address);
@@ -63,3 +72,51 @@ void* UFScriptMapHelperExporter::GetPairPtr(FMapProperty* MapProperty, const voi
 	FScriptMapHelper Helper(MapProperty, Address);
 	return Helper.GetPairPtr(Index);
 }
+
+int UFScriptMapHelperExporter::GetPairPtrs(FMapProperty* MapProperty, const void* Address, void** OutPairs, int MaxPairs)
+{
+	FScriptMapHelper Helper(MapProperty, Address);
+
+	int NumWritten = 0;
+	for (int32 Index = 0, MaxIndex = Helper.GetMaxIndex(); Index < MaxIndex && NumWritten < MaxPairs; ++Index)
+	{
+		if (Helper.IsValidIndex(Index))
+		{
+			OutPairs[NumWritten++] = Helper.GetPairPtrWithoutCheck(Index);
+		}
+	}
+	
+	return Helper.Num();
+}
+
+void UFScriptMapHelperExporter::AddPairs(FMapProperty* MapProperty, const void* Address, const void* Keys, const void* Values, int Count)
+{
+	FScriptMapHelper Helper(MapProperty, Address);
+	const int32 KeyStride = MapProperty->KeyProp->GetSize();
+	const int32 ValueStride = MapProperty->ValueProp->GetSize();
+
+	const uint8* Key = static_cast<const uint8*>(Keys);
+	const uint8* Value = static_cast<const uint8*>(Values);
+	for (int32 i = 0; i < Count; ++i, Key += KeyStride, Value += ValueStride)
+	{
+		Helper.AddPair(Key, Value);
+	}
+}
+
+int UFScriptMapHelperExporter::RemoveKeys(FMapProperty* MapProperty, const void* Address, const void* Keys, int Count)
+{
+	FScriptMapHelper Helper(MapProperty, Address);
+	const int32 KeyStride = MapProperty->KeyProp->GetSize();
+
+	int NumRemoved = 0;
+	const uint8* Key = static_cast<const uint8*>(Keys);
+	for (int32 i = 0; i < Count; ++i, Key += KeyStride)
+	{
+		if (Helper.RemovePair(Key))
+		{
+			++NumRemoved;
+		}
+	}
+	
+	return NumRemoved;
+}
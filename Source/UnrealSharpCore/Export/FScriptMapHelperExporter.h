@@ -23,6 +23,10 @@ public:
 	UNREALSHARP_FUNCTION()
 	static int FindMapPairIndexFromHash(FMapProperty* MapProperty, const void* Address, const void* Key);
 
+	// Same as FindMapPairIndexFromHash, with the hash of the key already computed by managed code.
+	UNREALSHARP_FUNCTION()
+	static int FindMapPairIndexWithHash(FMapProperty* MapProperty, const void* Address, const void* Key, uint32 KeyHash);
+
 	UNREALSHARP_FUNCTION()
 	static void RemoveIndex(FMapProperty* MapProperty, const void* Address, int Index);
 
@@ -40,5 +44,17 @@ public:
 
 	UNREALSHARP_FUNCTION()
 	static void* GetPairPtr(FMapProperty* MapProperty, const void* Address, int Index);
+
+	// Writes the pointers of up to MaxPairs valid pairs into OutPairs. Returns the number of pairs in the map.
+	UNREALSHARP_FUNCTION()
+	static int GetPairPtrs(FMapProperty* MapProperty, const void* Address, void** OutPairs, int MaxPairs);
+
+	// Keys and Values are packed arrays of Count initialized elements, strided by the size of the key and value property.
+	UNREALSHARP_FUNCTION()
+	static void AddPairs(FMapProperty* MapProperty, const void* Address, const void* Keys, const void* Values, int Count);
+
+	// Returns the number of keys that were found and removed.
+	UNREALSHARP_FUNCTION()
+	static int RemoveKeys(FMapProperty* MapProperty, const void* Address, const void* Keys, int Count);
 	
 };
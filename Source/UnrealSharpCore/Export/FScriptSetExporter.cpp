@@ -1,5 +1,96 @@
 ﻿#include "FScriptSetExporter.h"
 
+namespace
+{
+	// Mirror of the private members of TScriptSparseArray and its TScriptBitArray of allocation flags.
+	struct FCSScriptSparseArrayMirror
+	{
+		void* Data;
+		int32 ArrayNum;
+		int32 ArrayMax;
+		uint32 InlineAllocationFlags[4];
+		uint32* SecondaryAllocationFlags;
+		int32 NumBits;
+		int32 MaxBits;
+		int32 FirstFreeIndex;
+		int32 NumFreeIndices;
+	};
+
+	// Reads Set through Layout the way managed code does, and compares the result with the engine's own accessors.
+	bool ReadsLikeEngine(const FCSSparseArrayLayout& Layout, TSet<int32>& Set)
+	{
+		FScriptSet& ScriptSet = reinterpret_cast<FScriptSet&>(Set);
+		const FScriptSetLayout SetLayout = FScriptSet::GetScriptLayout(sizeof(int32), alignof(int32));
+		const uint8* Base = reinterpret_cast<const uint8*>(&ScriptSet);
+
+		const int32 MaxIndex = *reinterpret_cast<const int32*>(Base + Layout.MaxIndexOffset);
+		const int32 NumFreeIndices = *reinterpret_cast<const int32*>(Base + Layout.NumFreeIndicesOffset);
+		if (MaxIndex != ScriptSet.GetMaxIndex() || MaxIndex - NumFreeIndices != ScriptSet.Num())
+		{
+			return false;
+		}
+
+		const uint32* AllocationFlags = *reinterpret_cast<uint32* const*>(Base + Layout.SecondaryAllocationFlagsOffset);
+		if (!AllocationFlags)
+		{
+			AllocationFlags = reinterpret_cast<const uint32*>(Base + Layout.InlineAllocationFlagsOffset);
+		}
+
+		const uint8* Data = *reinterpret_cast<uint8* const*>(Base + Layout.DataOffset);
+		for (int32 Index = 0; Index < MaxIndex; ++Index)
+		{
+			const bool bIsAllocated = (AllocationFlags[Index >> 5] & (1u << (Index & 31))) != 0;
+			if (bIsAllocated != ScriptSet.IsValidIndex(Index))
+			{
+				return false;
+			}
+
+			if (bIsAllocated && Data + Index * SetLayout.SparseArrayLayout.Size != ScriptSet.GetData(Index, SetLayout))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	FCSSparseArrayLayout BuildSparseArrayLayout()
+	{
+		FCSSparseArrayLayout Layout;
+		Layout.DataOffset = offsetof(FCSScriptSparseArrayMirror, Data);
+		Layout.MaxIndexOffset = offsetof(FCSScriptSparseArrayMirror, ArrayNum);
+		Layout.NumFreeIndicesOffset = offsetof(FCSScriptSparseArrayMirror, NumFreeIndices);
+		Layout.InlineAllocationFlagsOffset = offsetof(FCSScriptSparseArrayMirror, InlineAllocationFlags);
+		Layout.SecondaryAllocationFlagsOffset = offsetof(FCSScriptSparseArrayMirror, SecondaryAllocationFlags);
+
+		if (sizeof(FCSScriptSparseArrayMirror) != sizeof(FScriptSparseArray))
+		{
+			return Layout;
+		}
+
+		// Both with the allocation flags inline and on the heap, with holes in the elements.
+		TSet<int32> SmallSet;
+		TSet<int32> LargeSet;
+		for (int32 i = 0; i < 256; ++i)
+		{
+			if (i < 16)
+			{
+				SmallSet.Add(i);
+			}
+			LargeSet.Add(i);
+		}
+
+		for (int32 i = 0; i < 256; i += 3)
+		{
+			SmallSet.Remove(i);
+			LargeSet.Remove(i);
+		}
+
+		Layout.bIsValid = ReadsLikeEngine(Layout, SmallSet) && ReadsLikeEngine(Layout, LargeSet);
+		return Layout;
+	}
+}
+
 bool UFScriptSetExporter::IsValidIndex(FScriptSet* ScriptSet, int32 Index)
 {
 	return ScriptSet->IsValidIndex(Index);
@@ -49,4 +140,61 @@ int32 UFScriptSetExporter::FindOrAdd(FScriptSet* ScriptSet, FSetProperty* Proper
 int UFScriptSetExporter::FindIndex(FScriptSet* ScriptSet, FSetProperty* Property, const void* Element, FGetKeyHash GetKeyHash, FEqualityFn EqualityFn)
 {
 	return ScriptSet->FindIndex(Element, Property->SetLayout, GetKeyHash, EqualityFn);
-}
\ No newline at end of file
+}
+
+int UFScriptSetExporter::FindIndexWithHash(FScriptSet* ScriptSet, FSetProperty* Property, const void* Element, uint32 ElementHash)
+{
+	const FProperty* ElementProp = Property->ElementProp;
+	return ScriptSet->FindIndex(Element, Property->SetLayout,
+		[ElementHash](const void*) { return ElementHash; },
+		[ElementProp](const void* A, const void* B) { return ElementProp->Identical(A, B); });
+}
+int UFScriptSetExporter::GetElementPtrs(FScriptSet* ScriptSet, FSetProperty* Property, void** OutElements, int MaxElements)
+{
+	int NumWritten = 0;
+	for (int32 Index = 0, MaxIndex = ScriptSet->GetMaxIndex(); Index < MaxIndex && NumWritten < MaxElements; ++Index)
+	{
+		if (ScriptSet->IsValidIndex(Index))
+		{
+			OutElements[NumWritten++] = ScriptSet->GetData(Index, Property->SetLayout);
+		}
+	}
+	
+	return ScriptSet->Num();
+}
+
+void UFScriptSetExporter::AddElements(FScriptSet* ScriptSet, FSetProperty* Property, const void* Elements, int Count)
+{
+	FScriptSetHelper Helper(Property, ScriptSet);
+	const int32 Stride = Property->ElementProp->GetSize();
+
+	const uint8* Element = static_cast<const uint8*>(Elements);
+	for (int32 i = 0; i < Count; ++i, Element += Stride)
+	{
+		Helper.AddElement(Element);
+	}
+}
+
+int UFScriptSetExporter::RemoveElements(FScriptSet* ScriptSet, FSetProperty* Property, const void* Elements, int Count)
+{
+	FScriptSetHelper Helper(Property, ScriptSet);
+	const int32 Stride = Property->ElementProp->GetSize();
+
+	int NumRemoved = 0;
+	const uint8* Element = static_cast<const uint8*>(Elements);
+	for (int32 i = 0; i < Count; ++i, Element += Stride)
+	{
+		if (Helper.RemoveElement(Element))
+		{
+			++NumRemoved;
+		}
+	}
+	
+	return NumRemoved;
+}
+
+void UFScriptSetExporter::GetSparseArrayLayout(FCSSparseArrayLayout* OutLayout)
+{
+	static const FCSSparseArrayLayout Layout = BuildSparseArrayLayout();
+	*OutLayout = Layout;
+}
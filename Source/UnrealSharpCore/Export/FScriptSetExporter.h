@@ -9,6 +9,18 @@ using FEqualityFn = bool(*)(const void*, const void*);
 using FConstructFn = void(*)(void*);
 using FDestructFn = void(*)(void*);
 
+// Offsets of the fields of a FScriptSet, so managed code can read counts and element pointers of sets and maps without a call.
+// bIsValid is zero when the running engine lays the sparse array out differently, managed code then keeps calling in.
+struct FCSSparseArrayLayout
+{
+	int32 DataOffset = 0;
+	int32 MaxIndexOffset = 0;
+	int32 NumFreeIndicesOffset = 0;
+	int32 InlineAllocationFlagsOffset = 0;
+	int32 SecondaryAllocationFlagsOffset = 0;
+	int32 bIsValid = 0;
+};
+
 UCLASS()
 class UNREALSHARPCORE_API UFScriptSetExporter : public UObject
 {
@@ -45,6 +57,25 @@ public:
 
 	UNREALSHARP_FUNCTION()
 	static int FindIndex(FScriptSet* ScriptSet, FSetProperty* Property, const void* Element, FGetKeyHash GetKeyHash, FEqualityFn EqualityFn);
+
+	// Finds Element by a hash computed by the caller, comparing elements natively instead of through managed callbacks.
+	UNREALSHARP_FUNCTION()
+	static int FindIndexWithHash(FScriptSet* ScriptSet, FSetProperty* Property, const void* Element, uint32 ElementHash);
+
+	// Writes the pointers of up to MaxElements valid elements into OutElements. Returns the number of elements in the set.
+	UNREALSHARP_FUNCTION()
+	static int GetElementPtrs(FScriptSet* ScriptSet, FSetProperty* Property, void** OutElements, int MaxElements);
+
+	// Elements is a packed array of Count initialized elements, strided by the size of the element property.
+	UNREALSHARP_FUNCTION()
+	static void AddElements(FScriptSet* ScriptSet, FSetProperty* Property, const void* Elements, int Count);
+
+	// Returns the number of elements that were found and removed.
+	UNREALSHARP_FUNCTION()
+	static int RemoveElements(FScriptSet* ScriptSet, FSetProperty* Property, const void* Elements, int Count);
+
+	UNREALSHARP_FUNCTION()
+	static void GetSparseArrayLayout(FCSSparseArrayLayout* OutLayout);
 	
 	
 };
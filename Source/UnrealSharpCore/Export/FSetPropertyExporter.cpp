@@ -4,3 +4,8 @@ void* UFSetPropertyExporter::GetElement(FSetProperty* Property)
 {
 	return Property->ElementProp;
 }
+
+int UFSetPropertyExporter::GetElementStride(FSetProperty* Property)
+{
+	return Property->SetLayout.SparseArrayLayout.Size;
+}
@@ -14,4 +14,8 @@ class UNREALSHARPCORE_API UFSetPropertyExporter : public UObject
 public:
 	UNREALSHARP_FUNCTION()
 	static void* GetElement(FSetProperty* Property);
+
+	// Distance between two elements of a set of this property, including the hash bookkeeping of the set.
+	UNREALSHARP_FUNCTION()
+	static int GetElementStride(FSetProperty* Property);
 };
@@ -1,13 +1,77 @@
 ﻿#include "FSoftObjectPtrExporter.h"
 #include "UnrealSharpCore/CSManager.h"
 
+#if UNREALSHARP_WARN_ON_BLOCKING_LOADS
+#include "Engine/Engine.h"
+#include "HAL/IConsoleManager.h"
+
+namespace
+{
+	bool bWarnOnBlockingLoads = true;
+
+	FAutoConsoleVariableRef CVarWarnOnBlockingLoads(
+		TEXT("UnrealSharp.WarnOnBlockingLoads"),
+		bWarnOnBlockingLoads,
+		TEXT("Logs the managed callstack the first time a soft object pointer is loaded synchronously during gameplay, in Debug builds of the managed assemblies."));
+
+	// Paths already warned about, so a load in a tick only shows up once.
+	TSet<FSoftObjectPath> WarnedPaths;
+
+	bool IsAnyGameWorldPlaying()
+	{
+		if (!GEngine)
+		{
+			return false;
+		}
+
+		for (const FWorldContext& WorldContext : GEngine->GetWorldContexts())
+		{
+			const UWorld* World = WorldContext.World();
+			if (World && World->IsGameWorld() && World->HasBegunPlay())
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+}
+#endif
+
 void* UFSoftObjectPtrExporter::LoadSynchronous(const TSoftObjectPtr<UObject>* SoftObjectPtr)
 {
 	if (SoftObjectPtr->IsNull())
 	{
 		return nullptr;
 	}
-	
-	UObject* LoadedObject = SoftObjectPtr->LoadSynchronous();
+
+	// Already resident objects skip the path resolve of LoadSynchronous.
+	UObject* LoadedObject = SoftObjectPtr->Get();
+	if (!LoadedObject)
+	{
+		LoadedObject = SoftObjectPtr->LoadSynchronous();
+	}
+
 	return UCSManager::Get().FindManagedObject(LoadedObject);
 }
+
+bool UFSoftObjectPtrExporter::ShouldWarnOnBlockingLoad(const TSoftObjectPtr<UObject>* SoftObjectPtr)
+{
+#if UNREALSHARP_WARN_ON_BLOCKING_LOADS
+	if (!bWarnOnBlockingLoads || !IsInGameThread() || SoftObjectPtr->IsNull() || SoftObjectPtr->IsValid())
+	{
+		return false;
+	}
+
+	if (!IsAnyGameWorldPlaying())
+	{
+		return false;
+	}
+
+	bool bAlreadyWarned = false;
+	WarnedPaths.Add(SoftObjectPtr->ToSoftObjectPath(), &bAlreadyWarned);
+	return !bAlreadyWarned;
+#else
+	return false;
+#endif
+}
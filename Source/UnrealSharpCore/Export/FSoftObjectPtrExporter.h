@@ -4,6 +4,11 @@
 #include "CSBindsManager.h"
 #include "FSoftObjectPtrExporter.generated.h"
 
+// Warns about soft object pointers loaded synchronously during gameplay. Compiled out of shipping builds unless asked for.
+#ifndef UNREALSHARP_WARN_ON_BLOCKING_LOADS
+#define UNREALSHARP_WARN_ON_BLOCKING_LOADS !UE_BUILD_SHIPPING
+#endif
+
 UCLASS()
 class UNREALSHARPCORE_API UFSoftObjectPtrExporter : public UObject
 {
@@ -13,5 +18,9 @@ public:
 
 	UNREALSHARP_FUNCTION()
 	static void* LoadSynchronous(const TSoftObjectPtr<UObject>* SoftObjectPtr);
+
+	// True the first time a path that is not loaded yet is about to be loaded synchronously on the game thread while a game world plays.
+	UNREALSHARP_FUNCTION()
+	static bool ShouldWarnOnBlockingLoad(const TSoftObjectPtr<UObject>* SoftObjectPtr);
 	
 };
@@ -1,6 +1,17 @@
 ﻿#include "FStringExporter.h"
+#include "CSInteropAllocationTracker.h"
 
 void UFStringExporter::MarshalToNativeString(FString* String, TCHAR* ManagedString)
 {
+	const int32 OldCapacity = String->GetCharArray().Max();
 	*String = ManagedString;
+	CS_TRACK_INTEROP_STRING_ALLOCATION("FStringExporter", "MarshalToNativeString", *String, OldCapacity);
+}
+
+void UFStringExporter::MarshalToNativeStringView(FString* String, const TCHAR* Data, int32 Length)
+{
+	const int32 OldCapacity = String->GetCharArray().Max();
+	String->Reset(Length);
+	String->AppendChars(Data, Length);
+	CS_TRACK_INTEROP_STRING_ALLOCATION("FStringExporter", "MarshalToNativeStringView", *String, OldCapacity);
 }
@@ -13,5 +13,9 @@ public:
 
 	UNREALSHARP_FUNCTION()
 	static void MarshalToNativeString(FString* String, TCHAR* ManagedString);
+
+	// Copies Length characters into the string, reusing its allocation when it is already large enough.
+	UNREALSHARP_FUNCTION()
+	static void MarshalToNativeStringView(FString* String, const TCHAR* Data, int32 Length);
 	
 };
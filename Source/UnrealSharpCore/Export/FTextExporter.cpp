@@ -1,4 +1,5 @@
 ﻿#include "FTextExporter.h"
+#include "CSInteropAllocationTracker.h"
 
 const TCHAR* UFTextExporter::ToString(FText* Text)
 {
@@ -10,6 +11,19 @@ const TCHAR* UFTextExporter::ToString(FText* Text)
 	return *Text->ToString();
 }
 
+const TCHAR* UFTextExporter::ToStringView(FText* Text, int32* OutLength)
+{
+	if (!Text)
+	{
+		*OutLength = 0;
+		return nullptr;
+	}
+
+	const FString& DisplayString = Text->ToString();
+	*OutLength = DisplayString.Len();
+	return *DisplayString;
+}
+
 void UFTextExporter::FromString(FText* Text, const char* String)
 {
 	if (!Text)
@@ -18,6 +32,18 @@ void UFTextExporter::FromString(FText* Text, const char* String)
 	}
 
 	*Text = Text->FromString(String);
+	CS_TRACK_INTEROP_ALLOCATION("FTextExporter", "FromString", Text->ToString().GetAllocatedSize());
+}
+
+void UFTextExporter::FromStringView(FText* Text, const TCHAR* Data, int32 Length)
+{
+	if (!Text)
+	{
+		return;
+	}
+
+	*Text = FText::FromString(FString(Length, Data));
+	CS_TRACK_INTEROP_ALLOCATION("FTextExporter", "FromStringView", Text->ToString().GetAllocatedSize());
 }
 
 void UFTextExporter::FromName(FText* Text, FName Name)
@@ -12,9 +12,16 @@ public:
 	UNREALSHARP_FUNCTION()
 	static const TCHAR* ToString(FText* Text);
 	
+	// Returns the display string of the text. Stays valid for as long as the text isn't modified.
+	UNREALSHARP_FUNCTION()
+	static const TCHAR* ToStringView(FText* Text, int32* OutLength);
+	
 	UNREALSHARP_FUNCTION()
 	static void FromString(FText* Text, const char* String);
 
+	UNREALSHARP_FUNCTION()
+	static void FromStringView(FText* Text, const TCHAR* Data, int32 Length);
+
 	UNREALSHARP_FUNCTION()
 	static void FromName(FText* Text, FName Name);
 	
@@ -0,0 +1,46 @@
+﻿#include "FTransformExporter.h"
+
+void UFTransformExporter::ComposeTransforms(const FTransform* A, const FTransform* B, FTransform* OutTransforms, int32 Count)
+{
+	for (int32 i = 0; i < Count; ++i)
+	{
+		FTransform::Multiply(&OutTransforms[i], &A[i], &B[i]);
+	}
+}
+
+void UFTransformExporter::TransformPositions(const FTransform& Transform, const FVector* Positions, FVector* OutPositions, int32 Count)
+{
+	// The transform is loaded into registers once for the whole batch.
+	const FQuat Rotation = Transform.GetRotation();
+	const FVector Translation = Transform.GetTranslation();
+	const FVector Scale = Transform.GetScale3D();
+
+	const VectorRegister4Double RotationRegister = VectorLoad(&Rotation.X);
+	const VectorRegister4Double TranslationRegister = VectorLoadFloat3_W0(&Translation);
+	const VectorRegister4Double ScaleRegister = VectorLoadFloat3_W0(&Scale);
+
+	for (int32 i = 0; i < Count; ++i)
+	{
+		const VectorRegister4Double Scaled = VectorMultiply(VectorLoadFloat3_W0(&Positions[i]), ScaleRegister);
+		const VectorRegister4Double Rotated = VectorQuaternionRotateVector(RotationRegister, Scaled);
+		VectorStoreFloat3(VectorAdd(Rotated, TranslationRegister), &OutPositions[i]);
+	}
+}
+
+void UFTransformExporter::InverseTransformPositions(const FTransform& Transform, const FVector* Positions, FVector* OutPositions, int32 Count)
+{
+	const FQuat Rotation = Transform.GetRotation();
+	const FVector Translation = Transform.GetTranslation();
+	const FVector SafeReciprocalScale = FTransform::GetSafeScaleReciprocal(Transform.GetScale3D());
+
+	const VectorRegister4Double RotationRegister = VectorLoad(&Rotation.X);
+	const VectorRegister4Double TranslationRegister = VectorLoadFloat3_W0(&Translation);
+	const VectorRegister4Double ReciprocalScaleRegister = VectorLoadFloat3_W0(&SafeReciprocalScale);
+
+	for (int32 i = 0; i < Count; ++i)
+	{
+		const VectorRegister4Double Translated = VectorSubtract(VectorLoadFloat3_W0(&Positions[i]), TranslationRegister);
+		const VectorRegister4Double Rotated = VectorQuaternionInverseRotateVector(RotationRegister, Translated);
+		VectorStoreFloat3(VectorMultiply(Rotated, ReciprocalScaleRegister), &OutPositions[i]);
+	}
+}
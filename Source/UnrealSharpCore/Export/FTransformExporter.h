@@ -0,0 +1,24 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "CSBindsManager.h"
+#include "FTransformExporter.generated.h"
+
+UCLASS()
+class UNREALSHARPCORE_API UFTransformExporter : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	// OutTransforms[i] = A[i] * B[i]. The output may alias either input.
+	UNREALSHARP_FUNCTION(AnyThread)
+	static void ComposeTransforms(const FTransform* A, const FTransform* B, FTransform* OutTransforms, int32 Count);
+
+	UNREALSHARP_FUNCTION(AnyThread)
+	static void TransformPositions(const FTransform& Transform, const FVector* Positions, FVector* OutPositions, int32 Count);
+
+	UNREALSHARP_FUNCTION(AnyThread)
+	static void InverseTransformPositions(const FTransform& Transform, const FVector* Positions, FVector* OutPositions, int32 Count);
+	
+};
@@ -4,3 +4,11 @@ FVector UFVectorExporter::FromRotator(const FRotator& Rotator)
 {
 	return Rotator.Vector();
 }
+
+void UFVectorExporter::FromRotators(const FRotator* Rotators, FVector* OutVectors, int32 Count)
+{
+	for (int32 i = 0; i < Count; ++i)
+	{
+		OutVectors[i] = Rotators[i].Vector();
+	}
+}
@@ -11,7 +11,10 @@ class UNREALSHARPCORE_API UFVectorExporter : public UObject
 
 public:
 
-	UNREALSHARP_FUNCTION()
+	UNREALSHARP_FUNCTION(AnyThread)
 	static FVector FromRotator(const FRotator& Rotator);
+
+	UNREALSHARP_FUNCTION(AnyThread)
+	static void FromRotators(const FRotator* Rotators, FVector* OutVectors, int32 Count);
 	
 };
@@ -1,5 +1,65 @@
 ﻿#include "FWeakObjectPtrExporter.h"
 #include "UnrealSharpCore/CSManager.h"
+#include "UObject/UObjectArray.h"
+#if ENGINE_MINOR_VERSION >= 4
+#include "UObject/GarbageCollection.h"
+#endif
+
+namespace
+{
+	FCSObjectArrayLayout MakeObjectArrayLayout()
+	{
+		FCSObjectArrayLayout Layout;
+
+		FChunkedFixedUObjectArray& ObjectArray = GUObjectArray.GetObjectItemArrayUnsafe();
+		FUObjectItem* FirstItem = ObjectArray.GetObjectPtr(0);
+
+		// The chunk table is the first member of the array, which the debugger visualizers rely on as well.
+		FUObjectItem** const* Chunks = reinterpret_cast<FUObjectItem** const*>(&ObjectArray);
+		if (!FirstItem || (*Chunks)[0] != FirstItem)
+		{
+			return Layout;
+		}
+
+		// The flags are not public in every engine version, find them through an item with only the garbage flag set.
+		FUObjectItem Probe;
+		Probe.SetFlags(EInternalObjectFlags::Garbage);
+
+		const uint8* ProbeBytes = reinterpret_cast<const uint8*>(&Probe);
+		int32 FlagsOffset = INDEX_NONE;
+		for (int32 Offset = 0; Offset + sizeof(int32) <= sizeof(FUObjectItem); Offset += sizeof(int32))
+		{
+			if (*reinterpret_cast<const int32*>(ProbeBytes + Offset) == int32(EInternalObjectFlags::Garbage))
+			{
+				FlagsOffset = Offset;
+				break;
+			}
+		}
+
+		if (FlagsOffset == INDEX_NONE || *reinterpret_cast<const int32*>(reinterpret_cast<const uint8*>(FirstItem) + FlagsOffset) != int32(FirstItem->GetFlags()))
+		{
+			return Layout;
+		}
+
+#if ENGINE_MINOR_VERSION >= 4
+		static_assert(sizeof(UE::GC::GUnreachableObjectFlag) == sizeof(int32));
+		Layout.UnreachableFlag = reinterpret_cast<const int32*>(&UE::GC::GUnreachableObjectFlag);
+#else
+		static const int32 UnreachableFlag = int32(EInternalObjectFlags::Unreachable);
+		Layout.UnreachableFlag = &UnreachableFlag;
+#endif
+
+		Layout.Chunks = Chunks;
+		Layout.NumElementsPerChunk = FChunkedFixedUObjectArray::NumElementsPerChunk;
+		Layout.MaxChunks = FMath::DivideAndRoundUp(ObjectArray.Capacity(), static_cast<int32>(FChunkedFixedUObjectArray::NumElementsPerChunk));
+		Layout.ItemSize = sizeof(FUObjectItem);
+		Layout.ObjectOffset = reinterpret_cast<const uint8*>(&Probe.Object) - ProbeBytes;
+		Layout.FlagsOffset = FlagsOffset;
+		Layout.SerialNumberOffset = reinterpret_cast<const uint8*>(&Probe.SerialNumber) - ProbeBytes;
+		Layout.GarbageFlag = int32(EInternalObjectFlags::Garbage);
+		return Layout;
+	}
+}
 
 void UFWeakObjectPtrExporter::SetObject(TWeakObjectPtr<UObject>& WeakObject, UObject* Object)
 {
@@ -32,4 +92,10 @@ bool UFWeakObjectPtrExporter::NativeEquals(TWeakObjectPtr<UObject> A, TWeakObjec
 	return A == B;
 }
 
+const FCSObjectArrayLayout* UFWeakObjectPtrExporter::GetObjectArrayLayout()
+{
+	static const FCSObjectArrayLayout Layout = MakeObjectArrayLayout();
+	return &Layout;
+}
+
 
@@ -4,6 +4,25 @@
 #include "CSBindsManager.h"
 #include "FWeakObjectPtrExporter.generated.h"
 
+/**
+ * Where the serial number and flags of an object live in GUObjectArray, so managed code can validate weak pointers
+ * without calling into native code. Mirrored by FObjectArrayLayout in C#.
+ */
+struct FCSObjectArrayLayout
+{
+	// Null when the layout of this engine version could not be verified, managed code then calls the exporters instead.
+	FUObjectItem** const* Chunks = nullptr;
+	int32 NumElementsPerChunk = 0;
+	int32 MaxChunks = 0;
+	int32 ItemSize = 0;
+	int32 ObjectOffset = 0;
+	int32 FlagsOffset = 0;
+	int32 SerialNumberOffset = 0;
+	int32 GarbageFlag = 0;
+	// The unreachable flag alternates between garbage collections since incremental reachability analysis.
+	const int32* UnreachableFlag = nullptr;
+};
+
 UCLASS()
 class UNREALSHARPCORE_API UFWeakObjectPtrExporter : public UObject
 {
@@ -25,5 +44,8 @@ public:
 
 	UNREALSHARP_FUNCTION()
 	static bool NativeEquals(TWeakObjectPtr<UObject> A, TWeakObjectPtr<UObject> B);
+
+	UNREALSHARP_FUNCTION()
+	static const FCSObjectArrayLayout* GetObjectArrayLayout();
 };
 
@@ -10,6 +10,6 @@ class UNREALSHARPCORE_API UGEditorExporter : public UObject
 	GENERATED_BODY()
 public:
 	
-	UNREALSHARP_FUNCTION()
+	UNREALSHARP_FUNCTION(EditorOnly)
 	static void* GetEditorSubsystem(UClass* SubsystemClass);
 };
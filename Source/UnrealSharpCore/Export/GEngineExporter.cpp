@@ -1,9 +1,12 @@
 ﻿#include "GEngineExporter.h"
 #include "Engine/Engine.h"
 #include "UnrealSharpCore/CSManager.h"
+#include "CSSubsystemHandleCache.h"
 
 void* UGEngineExporter::GetEngineSubsystem(UClass* SubsystemClass)
 {
-	UEngineSubsystem* EngineSubsystem = GEngine->GetEngineSubsystemBase(SubsystemClass);
-	return UCSManager::Get().FindManagedObject(EngineSubsystem);
+	return FCSSubsystemHandleCache::FindOrAdd(GEngine, SubsystemClass, [SubsystemClass]() -> USubsystem*
+	{
+		return GEngine ? GEngine->GetEngineSubsystemBase(SubsystemClass) : nullptr;
+	});
 }
@@ -2,6 +2,8 @@
 
 
 #include "TStrongObjectPtrExporter.h"
+#include "CSManagedRootSet.h"
+#include "UnrealSharpCore/CSManager.h"
 
 void UTStrongObjectPtrExporter::ConstructStrongObjectPtr(TStrongObjectPtr<UObject>* Ptr, UObject* Object)
 {
@@ -16,3 +18,20 @@ void UTStrongObjectPtrExporter::DestroyStrongObjectPtr(TStrongObjectPtr<UObject>
     check(Ptr != nullptr);
     std::destroy_at(Ptr);
 }
+
+int32 UTStrongObjectPtrExporter::AddRoot(UObject* Object)
+{
+    check(Object != nullptr);
+    return FCSManagedRootSet::Get().Add(Object);
+}
+
+void UTStrongObjectPtrExporter::RemoveRoot(int32 Index)
+{
+    FCSManagedRootSet::Get().Remove(Index);
+}
+
+void* UTStrongObjectPtrExporter::GetRootManagedObject(int32 Index)
+{
+    UObject* Object = FCSManagedRootSet::Get().GetObject(Index);
+    return Object ? UCSManager::Get().FindManagedObject(Object) : nullptr;
+}
@@ -21,4 +21,14 @@ public:
     
     UNREALSHARP_FUNCTION()
     static void DestroyStrongObjectPtr(TStrongObjectPtr<UObject>* Ptr);
+
+    // Keeps an object alive through FCSManagedRootSet, returns the slot to pass to RemoveRoot.
+    UNREALSHARP_FUNCTION()
+    static int32 AddRoot(UObject* Object);
+
+    UNREALSHARP_FUNCTION()
+    static void RemoveRoot(int32 Index);
+
+    UNREALSHARP_FUNCTION()
+    static void* GetRootManagedObject(int32 Index);
 };
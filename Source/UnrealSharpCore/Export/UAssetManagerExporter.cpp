@@ -1,9 +1,75 @@
 ﻿#include "UAssetManagerExporter.h"
 #include "CSManager.h"
 #include "Engine/AssetManager.h"
+#include "Hash/CityHash.h"
+
+namespace
+{
+	TMap<uint64, FPrimaryAssetId> PrimaryAssetIdTable;
+	uint64 PrimaryAssetIdTableFrame = MAX_uint64;
+}
 
 void* UUAssetManagerExporter::GetAssetManager()
 {
 	UAssetManager& AssetManager = UAssetManager::Get();
 	return UCSManager::Get().FindManagedObject(&AssetManager);
 }
+
+bool UUAssetManagerExporter::FindPrimaryAssetIdByHash(uint64 Hash, FName* OutPrimaryAssetType, FName* OutPrimaryAssetName)
+{
+	const FPrimaryAssetId* PrimaryAssetId = PrimaryAssetIdTable.Find(Hash);
+
+	// Assets added since the last rebuild aren't in the table yet. Rebuild at most once a frame so unknown hashes stay cheap.
+	if (!PrimaryAssetId && PrimaryAssetIdTableFrame != GFrameCounter)
+	{
+		RebuildPrimaryAssetIdTable();
+		PrimaryAssetId = PrimaryAssetIdTable.Find(Hash);
+	}
+
+	if (!PrimaryAssetId)
+	{
+		*OutPrimaryAssetType = NAME_None;
+		*OutPrimaryAssetName = NAME_None;
+		return false;
+	}
+
+	*OutPrimaryAssetType = PrimaryAssetId->PrimaryAssetType.GetName();
+	*OutPrimaryAssetName = PrimaryAssetId->PrimaryAssetName;
+	return true;
+}
+
+uint64 UUAssetManagerExporter::HashPrimaryAssetId(const FPrimaryAssetId& PrimaryAssetId)
+{
+	const FString Key = PrimaryAssetId.ToString().ToLower();
+	const FTCHARToUTF8 Utf8Key(*Key);
+	return CityHash64(Utf8Key.Get(), Utf8Key.Length());
+}
+
+void UUAssetManagerExporter::RebuildPrimaryAssetIdTable()
+{
+	PrimaryAssetIdTableFrame = GFrameCounter;
+
+	if (!UAssetManager::IsInitialized())
+	{
+		return;
+	}
+
+	UAssetManager& AssetManager = UAssetManager::Get();
+
+	TArray<FPrimaryAssetTypeInfo> PrimaryAssetTypes;
+	AssetManager.GetPrimaryAssetTypeInfoList(PrimaryAssetTypes);
+
+	TArray<FPrimaryAssetId> PrimaryAssetIds;
+	for (const FPrimaryAssetTypeInfo& PrimaryAssetType : PrimaryAssetTypes)
+	{
+		AssetManager.GetPrimaryAssetIdList(PrimaryAssetType.PrimaryAssetType, PrimaryAssetIds);
+	}
+
+	PrimaryAssetIdTable.Reset();
+	PrimaryAssetIdTable.Reserve(PrimaryAssetIds.Num());
+
+	for (const FPrimaryAssetId& PrimaryAssetId : PrimaryAssetIds)
+	{
+		PrimaryAssetIdTable.Add(HashPrimaryAssetId(PrimaryAssetId), PrimaryAssetId);
+	}
+}
@@ -15,5 +15,16 @@ public:
 
 	UNREALSHARP_FUNCTION()
 	static void* GetAssetManager();
+
+	// Resolve a hash generated into the AssetIds glue, rebuilding the lookup table when the hash is unknown
+	UNREALSHARP_FUNCTION()
+	static bool FindPrimaryAssetIdByHash(uint64 Hash, FName* OutPrimaryAssetType, FName* OutPrimaryAssetName);
+
+	// Case-insensitive hash of "Type:Name" shared by the glue generator and the lookup table, stable across platforms
+	static uint64 HashPrimaryAssetId(const FPrimaryAssetId& PrimaryAssetId);
+
+private:
+
+	static void RebuildPrimaryAssetIdTable();
 	
 };
@@ -3,9 +3,107 @@
 #include "UnrealSharpCore/TypeGenerator/Register/TypeInfo/CSClassInfo.h"
 #include "UnrealSharpCore/UnrealSharpCore.h"
 
+namespace
+{
+	// Functions found per class and name hash, so repeated lookups skip the FName conversion and the function map.
+	// Entries are checked against the name on every hit, a hash collision is just a miss.
+	FRWLock FunctionCacheLock;
+	TMap<TPair<TObjectKey<UClass>, uint32>, TWeakObjectPtr<UFunction>> FunctionCache;
+
+	uint32 HashFunctionName(const char* FunctionName)
+	{
+		uint32 Hash = 2166136261u;
+		for (const char* Character = FunctionName; *Character; ++Character)
+		{
+			Hash = (Hash ^ static_cast<uint8>(*Character)) * 16777619u;
+		}
+		return Hash;
+	}
+
+	bool IsFunctionNamed(const UFunction* Function, const char* FunctionName)
+	{
+		TStringBuilder<FName::StringBufferSize> Name;
+		Function->GetFName().AppendString(Name);
+
+		int32 Index = 0;
+		for (const TCHAR Character : Name.ToView())
+		{
+			if (static_cast<uint8>(FunctionName[Index]) != Character)
+			{
+				return false;
+			}
+			++Index;
+		}
+		return FunctionName[Index] == '\0';
+	}
+
+	struct FCSCachedDefaultObject
+	{
+		TWeakObjectPtr<UObject> DefaultObject;
+		void* ManagedHandle = nullptr;
+	};
+
+	// Default objects found by GetDefaultFromName, keyed by assembly, namespace and class name.
+	FRWLock DefaultObjectCacheLock;
+	TMap<FString, FCSCachedDefaultObject> DefaultObjectCache;
+
+	// Managed classes can be rebuilt with different functions under the same names, and get a new default object.
+	void FlushCaches()
+	{
+		{
+			FWriteScopeLock Lock(FunctionCacheLock);
+			FunctionCache.Reset();
+		}
+
+		FWriteScopeLock Lock(DefaultObjectCacheLock);
+		DefaultObjectCache.Reset();
+	}
+
+	void OnClassRebuilt(UCSClass*)
+	{
+		FlushCaches();
+	}
+
+	void BindCacheInvalidation()
+	{
+		static bool bBoundToClassRebuilds = false;
+		if (!bBoundToClassRebuilds && IsInGameThread())
+		{
+			UCSManager& Manager = UCSManager::Get();
+			Manager.OnNewClassEvent().AddStatic(&OnClassRebuilt);
+			Manager.OnAssembliesLoadedEvent().AddStatic(&FlushCaches);
+			bBoundToClassRebuilds = true;
+		}
+	}
+
+	UFunction* FindFunctionCached(const UClass* Class, const char* FunctionName)
+	{
+		const TPair<TObjectKey<UClass>, uint32> Key(Class, HashFunctionName(FunctionName));
+		{
+			FReadScopeLock Lock(FunctionCacheLock);
+			if (UFunction* Function = FunctionCache.FindRef(Key).Get(); Function && IsFunctionNamed(Function, FunctionName))
+			{
+				return Function;
+			}
+		}
+
+		UFunction* Function = Class->FindFunctionByName(FunctionName);
+		if (!Function)
+		{
+			return nullptr;
+		}
+
+		BindCacheInvalidation();
+
+		FWriteScopeLock Lock(FunctionCacheLock);
+		FunctionCache.Add(Key, Function);
+		return Function;
+	}
+}
+
 UFunction* UUClassExporter::GetNativeFunctionFromClassAndName(const UClass* Class, const char* FunctionName)
 {
-	UFunction* Function = Class->FindFunctionByName(FunctionName);
+	UFunction* Function = FindFunctionCached(Class, FunctionName);
 	
 	if (!Function)
 	{
@@ -16,6 +114,16 @@ UFunction* UUClassExporter::GetNativeFunctionFromClassAndName(const UClass* Clas
 	return Function;
 }
 
+void UUClassExporter::GetNativeFunctionsFromClassAndNames(const UClass* Class, const char* PackedFunctionNames, int32 NumFunctions, UFunction** OutFunctions)
+{
+	const char* FunctionName = PackedFunctionNames;
+	for (int32 i = 0; i < NumFunctions; ++i)
+	{
+		OutFunctions[i] = FindFunctionCached(Class, FunctionName);
+		FunctionName += FCStringAnsi::Strlen(FunctionName) + 1;
+	}
+}
+
 UFunction* UUClassExporter::GetNativeFunctionFromInstanceAndName(const UObject* NativeObject, const char* FunctionName)
 {
 	if (!IsValid(NativeObject))
@@ -24,11 +132,26 @@ UFunction* UUClassExporter::GetNativeFunctionFromInstanceAndName(const UObject*
 		return nullptr;
 	}
 	
-	return NativeObject->FindFunctionChecked(FunctionName);
+	UFunction* Function = FindFunctionCached(NativeObject->GetClass(), FunctionName);
+	if (!Function)
+	{
+		UE_LOG(LogUnrealSharp, Fatal, TEXT("Failed to find function %hs in %s"), FunctionName, *NativeObject->GetFullName());
+	}
+
+	return Function;
 }
 
 void* UUClassExporter::GetDefaultFromName(const char* AssemblyName, const char* Namespace, const char* ClassName)
 {
+	const FString CacheKey = FString::Printf(TEXT("%hs:%hs.%hs"), AssemblyName, Namespace, ClassName);
+	{
+		FReadScopeLock Lock(DefaultObjectCacheLock);
+		if (const FCSCachedDefaultObject* Cached = DefaultObjectCache.Find(CacheKey); Cached && Cached->DefaultObject.IsValid())
+		{
+			return Cached->ManagedHandle;
+		}
+	}
+
 	UCSAssembly* Assembly = UCSManager::Get().FindOrLoadAssembly(AssemblyName);
 	FCSFieldName FieldName(ClassName, Namespace);
 	
@@ -40,7 +163,18 @@ void* UUClassExporter::GetDefaultFromName(const char* AssemblyName, const char*
 		return nullptr;
 	}
 	
-	return UCSManager::Get().FindManagedObject(Class->GetDefaultObject());
+	UObject* DefaultObject = Class->GetDefaultObject();
+	void* ManagedHandle = UCSManager::Get().FindManagedObject(DefaultObject);
+	if (!ManagedHandle)
+	{
+		return nullptr;
+	}
+
+	BindCacheInvalidation();
+
+	FWriteScopeLock Lock(DefaultObjectCacheLock);
+	DefaultObjectCache.Add(CacheKey, { DefaultObject, ManagedHandle });
+	return ManagedHandle;
 }
 
 void* UUClassExporter::GetDefaultFromInstance(UObject* Object)
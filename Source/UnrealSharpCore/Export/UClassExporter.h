@@ -14,6 +14,11 @@ public:
 	UNREALSHARP_FUNCTION()
 	static UFunction* GetNativeFunctionFromClassAndName(const UClass* Class, const char* FunctionName);
 
+	// Resolves NumFunctions names, packed back to back and each terminated by a null character, in one call.
+	// Names the class doesn't have resolve to null without a warning, the caller decides whether that's an error.
+	UNREALSHARP_FUNCTION()
+	static void GetNativeFunctionsFromClassAndNames(const UClass* Class, const char* PackedFunctionNames, int32 NumFunctions, UFunction** OutFunctions);
+
 	UNREALSHARP_FUNCTION()
 	static UFunction* GetNativeFunctionFromInstanceAndName(const UObject* NativeObject, const char* FunctionName);
 
@@ -10,7 +10,7 @@ UClass* UUCoreUObjectExporter::GetNativeClassFromName(const char* InAssemblyName
 	FCSFieldName FieldName(InClassName, InNamespace);
 	
 	TSharedPtr<FCSClassInfo> ClassInfo = Assembly->FindOrAddTypeInfo<FCSClassInfo>(FieldName);
-	return ClassInfo->GetFieldChecked<UClass>();
+	return CastChecked<UClass>(ClassInfo->GetOrBuildField());
 }
 
 UClass* UUCoreUObjectExporter::GetNativeInterfaceFromName(const char* InAssemblyName, const char* InNamespace, const char* InInterfaceName)
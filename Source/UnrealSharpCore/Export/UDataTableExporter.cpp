@@ -1,4 +1,96 @@
 #include "UDataTableExporter.h"
+#include "Engine/DataTable.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace
+{
+	struct FCachedDataTableRows
+	{
+		TWeakObjectPtr<const UDataTable> DataTable;
+		TArray<FCSDataTableRowEntry> Rows;
+		TArray<int32> SortedIndices;
+		uint32 Version = 0;
+		bool bDirty = true;
+		FDelegateHandle OnChangedHandle;
+	};
+
+	TMap<TObjectKey<UDataTable>, TUniquePtr<FCachedDataTableRows>> CachedRows;
+	FDelegateHandle PostGarbageCollectHandle;
+
+	// Any change to the table can free row memory, bump the version right away so C# stops using the old snapshot.
+	uint32 NextVersion = 1;
+
+	void PruneDestroyedTables()
+	{
+		for (auto It = CachedRows.CreateIterator(); It; ++It)
+		{
+			if (!It.Value()->DataTable.IsValid())
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	FCachedDataTableRows& FindOrAddCachedRows(const UDataTable* DataTable)
+	{
+		if (!PostGarbageCollectHandle.IsValid())
+		{
+			PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddStatic(&PruneDestroyedTables);
+		}
+
+		TUniquePtr<FCachedDataTableRows>& Cached = CachedRows.FindOrAdd(DataTable);
+		if (!Cached.IsValid())
+		{
+			Cached = MakeUnique<FCachedDataTableRows>();
+			Cached->DataTable = DataTable;
+			Cached->Version = NextVersion++;
+
+			FCachedDataTableRows* CachedPtr = Cached.Get();
+			Cached->OnChangedHandle = const_cast<UDataTable*>(DataTable)->OnDataTableChanged().AddLambda([CachedPtr]()
+			{
+				CachedPtr->bDirty = true;
+				CachedPtr->Version = NextVersion++;
+			});
+		}
+
+		return *Cached;
+	}
+
+	void Rebuild(FCachedDataTableRows& Cached, const UDataTable* DataTable)
+	{
+		const TMap<FName, uint8*>& RowMap = DataTable->GetRowMap();
+
+		Cached.Rows.Reset(RowMap.Num());
+		for (const TPair<FName, uint8*>& Row : RowMap)
+		{
+			Cached.Rows.Add({ Row.Key, Row.Value });
+		}
+
+		Cached.SortedIndices.Reset(Cached.Rows.Num());
+		for (int32 i = 0; i < Cached.Rows.Num(); ++i)
+		{
+			Cached.SortedIndices.Add(i);
+		}
+
+		const TArray<FCSDataTableRowEntry>& Rows = Cached.Rows;
+		Cached.SortedIndices.Sort([&Rows](int32 A, int32 B)
+		{
+			const FName& NameA = Rows[A].RowName;
+			const FName& NameB = Rows[B].RowName;
+
+			const uint32 IndexA = NameA.GetComparisonIndex().ToUnstableInt();
+			const uint32 IndexB = NameB.GetComparisonIndex().ToUnstableInt();
+			if (IndexA != IndexB)
+			{
+				return IndexA < IndexB;
+			}
+
+			return static_cast<uint32>(NameA.GetNumber()) < static_cast<uint32>(NameB.GetNumber());
+		});
+
+		Cached.bDirty = false;
+	}
+}
 
 uint8* UUDataTableExporter::GetRow(const UDataTable* DataTable, FName RowName)
 {
@@ -9,3 +101,36 @@ uint8* UUDataTableExporter::GetRow(const UDataTable* DataTable, FName RowName)
 
 	return DataTable->FindRowUnchecked(RowName);
 }
+
+void UUDataTableExporter::GetRows(const UDataTable* DataTable, FCSDataTableRows* OutRows)
+{
+	*OutRows = FCSDataTableRows();
+
+	if (!IsValid(DataTable))
+	{
+		return;
+	}
+
+	FCachedDataTableRows& Cached = FindOrAddCachedRows(DataTable);
+	if (Cached.bDirty)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(UUDataTableExporter::GetRows);
+		Rebuild(Cached, DataTable);
+	}
+
+	OutRows->Rows = Cached.Rows.GetData();
+	OutRows->SortedIndices = Cached.SortedIndices.GetData();
+	OutRows->NumRows = Cached.Rows.Num();
+	OutRows->Version = Cached.Version;
+}
+
+uint32 UUDataTableExporter::GetRowsVersion(const UDataTable* DataTable)
+{
+	if (!IsValid(DataTable))
+	{
+		return 0;
+	}
+
+	const TUniquePtr<FCachedDataTableRows>* Cached = CachedRows.Find(DataTable);
+	return Cached ? (*Cached)->Version : 0;
+}
@@ -4,6 +4,25 @@
 #include "CSBindsManager.h"
 #include "UDataTableExporter.generated.h"
 
+// Layout must match DataTableRowEntry in UDataTableExporter.cs.
+struct FCSDataTableRowEntry
+{
+	FName RowName;
+	uint8* RowData;
+};
+
+// A snapshot of the rows of a data table, owned by the exporter. Stays valid until the table changes, which bumps Version.
+// Layout must match NativeDataTableRows in UDataTableExporter.cs.
+struct FCSDataTableRows
+{
+	// In the order of the table.
+	const FCSDataTableRowEntry* Rows;
+	// Indices into Rows, ordered by the comparison index and then the number of the row name, for binary searching.
+	const int32* SortedIndices;
+	int32 NumRows;
+	uint32 Version;
+};
+
 UCLASS()
 class UNREALSHARPCORE_API UUDataTableExporter : public UObject
 {
@@ -13,5 +32,13 @@ public:
 
 	UNREALSHARP_FUNCTION()
 	static uint8* GetRow(const UDataTable* DataTable, FName RowName);
+
+	// Every row in one call, without copying them. The arrays are built on first use and cached until the table changes.
+	UNREALSHARP_FUNCTION()
+	static void GetRows(const UDataTable* DataTable, FCSDataTableRows* OutRows);
+
+	// Changes whenever the cached rows of the table are rebuilt, so C# can tell when its snapshot went stale.
+	UNREALSHARP_FUNCTION()
+	static uint32 GetRowsVersion(const UDataTable* DataTable);
 	
 };
@@ -1,6 +1,62 @@
 ﻿#include "UEnhancedInputComponentExporter.h"
 #include "EnhancedInputComponent.h"
 
+namespace
+{
+	using FInputActionCallback = bool(*)(void* CallbackHandle, const FVector* AxisValue, uint8 ValueType, float ElapsedSeconds, float TriggeredSeconds);
+	using FReleaseInputActionCallback = void(*)(void* CallbackHandle);
+
+	// Owned by the binding, so the managed side is released together with it.
+	struct FCSInputActionCallback
+	{
+		FCSInputActionCallback(UObject* InObject, FName InFunctionName, FInputActionCallback InCallback, FReleaseInputActionCallback InReleaseCallback, void* InCallbackHandle)
+			: Object(InObject), FunctionName(InFunctionName), Callback(InCallback), ReleaseCallback(InReleaseCallback), CallbackHandle(InCallbackHandle)
+		{
+		}
+
+		~FCSInputActionCallback()
+		{
+			ReleaseCallback(CallbackHandle);
+		}
+
+		void Invoke(const FInputActionInstance& ActionInstance)
+		{
+			UObject* TargetObject = Object.Get();
+			if (!TargetObject)
+			{
+				return;
+			}
+
+			const FInputActionValue& Value = ActionInstance.GetValue();
+			if (bIsManagedCallbackAlive)
+			{
+				const FVector AxisValue = Value.Get<FVector>();
+				bIsManagedCallbackAlive = Callback(CallbackHandle, &AxisValue, static_cast<uint8>(Value.GetValueType()), ActionInstance.GetElapsedTime(), ActionInstance.GetTriggeredTime());
+
+				if (bIsManagedCallbackAlive)
+				{
+					return;
+				}
+			}
+
+			// The assembly of the callback was reloaded. The function is looked up again on every event, like a binding by name.
+			if (!FunctionName.IsNone())
+			{
+				FEnhancedInputActionHandlerDynamicSignature FunctionDelegate;
+				FunctionDelegate.BindUFunction(TargetObject, FunctionName);
+				FunctionDelegate.ExecuteIfBound(Value, ActionInstance.GetElapsedTime(), ActionInstance.GetTriggeredTime(), ActionInstance.GetSourceAction());
+			}
+		}
+
+		TWeakObjectPtr<UObject> Object;
+		FName FunctionName;
+		bool bIsManagedCallbackAlive = true;
+		FInputActionCallback Callback;
+		FReleaseInputActionCallback ReleaseCallback;
+		void* CallbackHandle;
+	};
+}
+
 bool UUEnhancedInputComponentExporter::BindAction(UEnhancedInputComponent* InputComponent, UInputAction* InputAction, ETriggerEvent TriggerEvent, UObject* Object, const FName FunctionName, uint32* OutHandle)
 {
 	if (!IsValid(InputComponent) || !IsValid(InputAction))
@@ -11,6 +67,23 @@ bool UUEnhancedInputComponentExporter::BindAction(UEnhancedInputComponent* Input
 	return true;
 }
 
+bool UUEnhancedInputComponentExporter::BindActionCallback(UEnhancedInputComponent* InputComponent, UInputAction* InputAction, ETriggerEvent TriggerEvent, UObject* Object, const FName FunctionName, void* Callback, void* ReleaseCallback, void* CallbackHandle, uint32* OutHandle)
+{
+	if (!IsValid(InputComponent) || !IsValid(InputAction))
+	{
+		return false;
+	}
+
+	TSharedRef<FCSInputActionCallback> InputActionCallback = MakeShared<FCSInputActionCallback>(Object, FunctionName,
+		reinterpret_cast<FInputActionCallback>(Callback), reinterpret_cast<FReleaseInputActionCallback>(ReleaseCallback), CallbackHandle);
+
+	*OutHandle = InputComponent->BindActionInstanceLambda(InputAction, TriggerEvent, [InputActionCallback](const FInputActionInstance& ActionInstance)
+	{
+		InputActionCallback->Invoke(ActionInstance);
+	}).GetHandle();
+	return true;
+}
+
 bool UUEnhancedInputComponentExporter::RemoveBindingByHandle(UEnhancedInputComponent* InputComponent, const uint32 Handle)
 {
 	if (!IsValid(InputComponent))
@@ -19,6 +19,14 @@ public:
 	UNREALSHARP_FUNCTION()
 	static bool BindAction(UEnhancedInputComponent* InputComponent, UInputAction* InputAction, ETriggerEvent TriggerEvent, UObject* Object, const FName FunctionName, uint32* OutHandle);
 
+	// Binds a managed callback without going through a UFunction. Every event calls
+	// Callback(CallbackHandle, &AxisValue, ValueType, ElapsedSeconds, TriggeredSeconds) directly, and ReleaseCallback(CallbackHandle)
+	// is called once the binding is removed. Events are skipped once Object is gone.
+	// Callback returns false once the managed binding is gone, which a hot reload does. When the callback is the UFunction
+	// FunctionName of Object, events then go to the function by name, as BindAction would, so the binding survives the reload.
+	UNREALSHARP_FUNCTION()
+	static bool BindActionCallback(UEnhancedInputComponent* InputComponent, UInputAction* InputAction, ETriggerEvent TriggerEvent, UObject* Object, const FName FunctionName, void* Callback, void* ReleaseCallback, void* CallbackHandle, uint32* OutHandle);
+
 	UNREALSHARP_FUNCTION()
 	static bool RemoveBindingByHandle(UEnhancedInputComponent* InputComponent, const uint32 Handle);
 	
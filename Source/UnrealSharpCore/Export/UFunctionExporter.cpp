@@ -1,7 +1,114 @@
 ﻿#include "UFunctionExporter.h"
 #include "UnrealSharpCore.h"
+#include "CSInteropAllocationTracker.h"
+#include "CSManager.h"
+#include "TypeGenerator/CSScriptStruct.h"
 #include "Utils/CSClassUtilities.h"
 
+namespace
+{
+	FRWLock NativeFunctionInvocationsLock;
+	TMap<TObjectKey<UFunction>, TUniquePtr<FCSNativeFunctionInvocation>> NativeFunctionInvocations;
+
+	// Invocations replaced because their function was relinked. Managed code may still hold them until its assembly unloads.
+	TArray<TUniquePtr<FCSNativeFunctionInvocation>> StaleNativeFunctionInvocations;
+
+	bool IsInvocationUpToDate(const FCSNativeFunctionInvocation& Invocation, const UFunction* NativeFunction)
+	{
+		return Invocation.PropertyLink == NativeFunction->PropertyLink && Invocation.ParmsSize == NativeFunction->ParmsSize;
+	}
+
+	struct FCSCustomStructSpecializationKey
+	{
+		TObjectKey<UFunction> NativeFunction;
+		TArray<TObjectKey<UScriptStruct>, TInlineAllocator<2>> CustomStructs;
+
+		bool operator==(const FCSCustomStructSpecializationKey& Other) const
+		{
+			return NativeFunction == Other.NativeFunction && CustomStructs == Other.CustomStructs;
+		}
+
+		friend uint32 GetTypeHash(const FCSCustomStructSpecializationKey& Key)
+		{
+			uint32 Hash = GetTypeHash(Key.NativeFunction);
+			for (const TObjectKey<UScriptStruct>& Struct : Key.CustomStructs)
+			{
+				Hash = HashCombineFast(Hash, GetTypeHash(Struct));
+			}
+			return Hash;
+		}
+	};
+
+	// Specializations are UFunctions linked into the class of the native function, so they live as long as the class does.
+	// Creating one per call would grow the UObject count without bound, reuse them per function and struct combination.
+	FCriticalSection CustomStructSpecializationsLock;
+	TMap<FCSCustomStructSpecializationKey, TWeakObjectPtr<UFunction>> CustomStructSpecializations;
+
+	EPropertyFlags GetCustomStructParamFlags(EPropertyFlags Flags, const UScriptStruct* Struct)
+	{
+		if (const UScriptStruct::ICppStructOps* CppStructOps = Struct->GetCppStructOps())
+		{
+			const UScriptStruct::ICppStructOps::FCapabilities Capabilities = CppStructOps->GetCapabilities();
+			if(Capabilities.HasZeroConstructor)
+			{
+				Flags |= CPF_ZeroConstructor;
+			}
+			else
+			{
+				Flags &= ~(CPF_ZeroConstructor);
+			}
+			if(Capabilities.IsPlainOldData)
+			{
+				Flags |= CPF_IsPlainOldData;
+			}
+			else
+			{
+				Flags &= ~(CPF_IsPlainOldData);
+			}
+		}
+		else
+		{
+			Flags &= ~(CPF_ZeroConstructor | CPF_IsPlainOldData);
+		}
+
+		return Flags;
+	}
+
+	// Managed structs are rebuilt in place on hot reload. Relink the specializations that use them instead of
+	// creating new ones, managed code keeps pointers to the specializations it has already looked up.
+	void OnCustomStructRebuilt(UCSScriptStruct* Struct)
+	{
+		const TObjectKey<UScriptStruct> StructKey(Struct);
+
+		FScopeLock Lock(&CustomStructSpecializationsLock);
+		for (auto It = CustomStructSpecializations.CreateIterator(); It; ++It)
+		{
+			if (!It.Key().CustomStructs.Contains(StructKey))
+			{
+				continue;
+			}
+
+			UFunction* Specialization = It.Value().Get();
+			if (!Specialization)
+			{
+				It.RemoveCurrent();
+				continue;
+			}
+
+			for (TFieldIterator<FStructProperty> PropIt(Specialization); PropIt; ++PropIt)
+			{
+				FStructProperty* StructProperty = *PropIt;
+				if (StructProperty->Struct == Struct)
+				{
+					StructProperty->PropertyFlags = GetCustomStructParamFlags(StructProperty->PropertyFlags, Struct);
+				}
+			}
+
+			Specialization->StaticLink(true);
+		}
+	}
+}
+
 uint16 UUFunctionExporter::GetNativeFunctionParamsSize(const UFunction* NativeFunction)
 {
 	check(NativeFunction);
@@ -11,8 +118,36 @@ uint16 UUFunctionExporter::GetNativeFunctionParamsSize(const UFunction* NativeFu
 UFunction* UUFunctionExporter::CreateNativeFunctionCustomStructSpecialization(UFunction* NativeFunction,
 	FProperty** CustomStructParams, UScriptStruct** CustomStructs)
 {
+	FCSCustomStructSpecializationKey Key;
+	Key.NativeFunction = NativeFunction;
+	{
+		FProperty** CustomStructParam = CustomStructParams;
+		for (TFieldIterator<FProperty> PropIt(NativeFunction); PropIt && PropIt->PropertyFlags & CPF_Parm; ++PropIt)
+		{
+			if (*PropIt == *CustomStructParam)
+			{
+				Key.CustomStructs.Add(CustomStructs[Key.CustomStructs.Num()]);
+				++CustomStructParam;
+			}
+		}
+	}
+
+	FScopeLock Lock(&CustomStructSpecializationsLock);
+	if (UFunction* ExistingSpecialization = CustomStructSpecializations.FindRef(Key).Get())
+	{
+		return ExistingSpecialization;
+	}
+
+	static bool bBoundToStructRebuilds = false;
+	if (!bBoundToStructRebuilds)
+	{
+		UCSManager::Get().OnNewStructEvent().AddStatic(&OnCustomStructRebuilt);
+		bBoundToStructRebuilds = true;
+	}
+
 	UClass* Outer = NativeFunction->GetOuterUClass();
 	UFunction* Specialization = NewObject<UFunction>(Outer, UFunction::StaticClass());
+	CS_TRACK_INTEROP_ALLOCATION("UFunctionExporter", "CreateNativeFunctionCustomStructSpecialization", sizeof(UFunction));
 	Specialization->FunctionFlags = NativeFunction->FunctionFlags;
 	Specialization->SetSuperStruct(NativeFunction);
 	Specialization->SetNativeFunc(NativeFunction->GetNativeFunc());
@@ -27,32 +162,7 @@ UFunction* UUFunctionExporter::CreateNativeFunctionCustomStructSpecialization(UF
 			FStructProperty* CustomStructParam = new FStructProperty(Specialization, Property->GetFName(), Property->GetFlags());
 			UScriptStruct* Struct = *CustomStructs++;
 			CustomStructParam->Struct = Struct;
-			EPropertyFlags Flags = Property->GetPropertyFlags() | CPF_BlueprintVisible | CPF_BlueprintReadOnly;
-			if (const auto CppStructOps = Struct->GetCppStructOps())
-			{
-				const auto Capabilities = CppStructOps->GetCapabilities();
-				if(Capabilities.HasZeroConstructor)
-				{
-					Flags |= CPF_ZeroConstructor;
-				}
-				else
-				{
-					Flags &= ~(CPF_ZeroConstructor);
-				}
-				if(Capabilities.IsPlainOldData)
-				{
-					Flags |= CPF_IsPlainOldData;
-				}
-				else
-				{
-					Flags &= ~(CPF_IsPlainOldData);
-				}
-			}
-			else
-			{
-				Flags &= ~(CPF_ZeroConstructor | CPF_IsPlainOldData);
-			}
-			CustomStructParam->PropertyFlags = Flags;
+			CustomStructParam->PropertyFlags = GetCustomStructParamFlags(Property->GetPropertyFlags() | CPF_BlueprintVisible | CPF_BlueprintReadOnly, Struct);
 			OutProperty = CastField<FProperty>(CustomStructParam);
 			CustomStructParams++;
 		}
@@ -77,6 +187,7 @@ UFunction* UUFunctionExporter::CreateNativeFunctionCustomStructSpecialization(UF
 
 	Specialization->StaticLink(true);
 
+	CustomStructSpecializations.Add(MoveTemp(Key), Specialization);
 	return Specialization;
 }
 
@@ -100,3 +211,66 @@ bool UUFunctionExporter::HasBlueprintEventBeenImplemented(const UFunction* Nativ
 	return !FCSClassUtilities::IsNativeClass(FunctionOwner);
 }
 
+
+const FCSNativeFunctionInvocation* UUFunctionExporter::GetNativeFunctionInvocation(UFunction* NativeFunction)
+{
+	check(NativeFunction);
+	TObjectKey<UFunction> FunctionKey(NativeFunction);
+
+	{
+		FReadScopeLock ReadLock(NativeFunctionInvocationsLock);
+		const TUniquePtr<FCSNativeFunctionInvocation>* Invocation = NativeFunctionInvocations.Find(FunctionKey);
+		if (Invocation && IsInvocationUpToDate(**Invocation, NativeFunction))
+		{
+			return Invocation->Get();
+		}
+	}
+
+	TUniquePtr<FCSNativeFunctionInvocation> NewInvocation = MakeUnique<FCSNativeFunctionInvocation>();
+	NewInvocation->Function = NativeFunction;
+	NewInvocation->NativeFunc = NativeFunction->GetNativeFunc();
+	NewInvocation->bIsNativeThunk = NativeFunction->HasAnyFunctionFlags(FUNC_Native);
+	NewInvocation->bCanCallDirectly = NewInvocation->bIsNativeThunk
+		&& !NativeFunction->HasAnyFunctionFlags(FUNC_Net)
+		&& FCSClassUtilities::IsNativeClass(NativeFunction->GetOwnerClass());
+	NewInvocation->PropertyLink = NativeFunction->PropertyLink;
+	NewInvocation->ParmsSize = NativeFunction->ParmsSize;
+
+	for (TFieldIterator<FProperty> PropIt(NativeFunction); PropIt && PropIt->HasAnyPropertyFlags(CPF_Parm); ++PropIt)
+	{
+		FProperty* Property = *PropIt;
+		if (Property->HasAllPropertyFlags(CPF_OutParm))
+		{
+			NewInvocation->OutParms.Emplace(Property, Property->GetOffset_ForUFunction());
+		}
+	}
+
+	FWriteScopeLock WriteLock(NativeFunctionInvocationsLock);
+	TUniquePtr<FCSNativeFunctionInvocation>& Invocation = NativeFunctionInvocations.FindOrAdd(FunctionKey);
+	if (!Invocation.IsValid())
+	{
+		Invocation = MoveTemp(NewInvocation);
+	}
+	else if (!IsInvocationUpToDate(*Invocation, NativeFunction))
+	{
+		StaleNativeFunctionInvocations.Add(MoveTemp(Invocation));
+		Invocation = MoveTemp(NewInvocation);
+	}
+
+	return Invocation.Get();
+}
+
+void UUFunctionExporter::FlushNativeFunctionInvocations()
+{
+	FWriteScopeLock WriteLock(NativeFunctionInvocationsLock);
+	for (auto It = NativeFunctionInvocations.CreateIterator(); It; ++It)
+	{
+		const UFunction* Function = It.Key().ResolveObjectPtr();
+		if (!Function || !FCSClassUtilities::IsNativeClass(Function->GetOwnerClass()))
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	StaleNativeFunctionInvocations.Empty();
+}
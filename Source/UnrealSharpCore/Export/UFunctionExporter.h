@@ -6,6 +6,28 @@
 #include "CSBindsManager.h"
 #include "UFunctionExporter.generated.h"
 
+// Everything InvokeNativeFunctionWithInvocation needs to know about a UFunction, computed once per function
+// so calls from C# don't have to walk the function properties every time.
+struct FCSNativeFunctionInvocation
+{
+	UFunction* Function = nullptr;
+	FNativeFuncPtr NativeFunc = nullptr;
+
+	// Out params (including the return value) in declaration order, paired with their offset in the params buffer.
+	TArray<TPair<FProperty*, int32>, TInlineAllocator<4>> OutParms;
+
+	// The function is backed by a C++ thunk rather than script bytecode.
+	bool bIsNativeThunk = false;
+
+	// The thunk can be called straight through NativeFunc. Only true for non-net functions declared on native classes,
+	// managed functions also carry FUNC_Native but can be rebuilt at runtime.
+	bool bCanCallDirectly = false;
+
+	// Link of the function the invocation was computed from. A rebuilt function gets new properties, which makes the invocation stale.
+	const FProperty* PropertyLink = nullptr;
+	int32 ParmsSize = 0;
+};
+
 UCLASS()
 class UNREALSHARPCORE_API UUFunctionExporter : public UObject
 {
@@ -25,4 +47,11 @@ public:
 	UNREALSHARP_FUNCTION()
 	static bool HasBlueprintEventBeenImplemented(const UFunction* NativeFunction);
 
+	UNREALSHARP_FUNCTION()
+	static const FCSNativeFunctionInvocation* GetNativeFunctionInvocation(UFunction* NativeFunction);
+
+	// Frees the invocations of destroyed functions and of functions declared on managed classes, which the code of an assembly
+	// that is being unloaded is the only one to hold. Invocations of native functions stay, the glue of native classes outlives hot reloads.
+	static void FlushNativeFunctionInvocations();
+
 };
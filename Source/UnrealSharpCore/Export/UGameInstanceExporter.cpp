@@ -1,5 +1,6 @@
 ﻿#include "UGameInstanceExporter.h"
 #include "UnrealSharpCore/CSManager.h"
+#include "CSSubsystemHandleCache.h"
 
 void* UUGameInstanceExporter::GetGameInstanceSubsystem(UClass* SubsystemClass, UObject* WorldContextObject)
 {
@@ -8,6 +9,10 @@ void* UUGameInstanceExporter::GetGameInstanceSubsystem(UClass* SubsystemClass, U
 		return nullptr;
 	}
 	
-	UGameInstanceSubsystem* GameInstanceSubsystem = WorldContextObject->GetWorld()->GetGameInstance()->GetSubsystemBase(SubsystemClass);
-	return UCSManager::Get().FindManagedObject(GameInstanceSubsystem);
+	const UWorld* World = WorldContextObject->GetWorld();
+	UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	return FCSSubsystemHandleCache::FindOrAdd(GameInstance, SubsystemClass, [GameInstance, SubsystemClass]() -> USubsystem*
+	{
+		return GameInstance ? GameInstance->GetSubsystemBase(SubsystemClass) : nullptr;
+	});
 }
@@ -1,5 +1,6 @@
 ﻿#include "ULocalPlayerExporter.h"
 #include "UnrealSharpCore/CSManager.h"
+#include "CSSubsystemHandleCache.h"
 
 void* UULocalPlayerExporter::GetLocalPlayerSubsystem(UClass* SubsystemClass, APlayerController* PlayerController)
 {
@@ -8,6 +9,9 @@ void* UULocalPlayerExporter::GetLocalPlayerSubsystem(UClass* SubsystemClass, APl
 		return nullptr;
 	}
 
-	ULocalPlayerSubsystem* LocalPlayerSubsystem = PlayerController->GetLocalPlayer()->GetSubsystemBase(SubsystemClass);
-	return UCSManager::Get().FindManagedObject(LocalPlayerSubsystem);
+	ULocalPlayer* LocalPlayer = PlayerController->GetLocalPlayer();
+	return FCSSubsystemHandleCache::FindOrAdd(LocalPlayer, SubsystemClass, [LocalPlayer, SubsystemClass]() -> USubsystem*
+	{
+		return LocalPlayer ? LocalPlayer->GetSubsystemBase(SubsystemClass) : nullptr;
+	});
 }
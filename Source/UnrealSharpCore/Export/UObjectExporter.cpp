@@ -1,5 +1,44 @@
 ﻿#include "UObjectExporter.h"
 #include "UnrealSharpCore/CSManager.h"
+#include "UFunctionExporter.h"
+#include "CSInteropFrameCounters.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Net/Core/PushModel/PushModel.h"
+
+namespace
+{
+	// Callspaces that don't depend on the connection can be decided without asking the object.
+	bool IsAlwaysLocalCall(UObject* NativeObject, const UFunction* NativeFunction)
+	{
+		if (NativeObject->HasAnyFlags(RF_ClassDefaultObject) || NativeFunction->HasAnyFunctionFlags(FUNC_Static | FUNC_NetRequest | FUNC_NetResponse))
+		{
+			return false;
+		}
+
+		const UWorld* World = NativeObject->GetWorld();
+		if (!World)
+		{
+			return false;
+		}
+
+		const ENetMode NetMode = World->GetNetMode();
+		if (NetMode != NM_Standalone && NetMode != NM_DedicatedServer)
+		{
+			return false;
+		}
+
+		if (!NativeFunction->HasAnyFunctionFlags(FUNC_NetServer))
+		{
+			// There's nobody to send client or multicast RPCs to in standalone, on a server they depend on the connections.
+			return NetMode == NM_Standalone;
+		}
+
+		// Server RPCs run locally wherever we have authority, the object absorbs them otherwise.
+		const AActor* Actor = NativeObject->IsA<AActor>() ? static_cast<const AActor*>(NativeObject) : NativeObject->GetTypedOuter<AActor>();
+		return Actor && Actor->HasAuthority();
+	}
+}
 
 void* UUObjectExporter::CreateNewObject(UObject* Outer, UClass* Class, UObject* Template)
 {
@@ -32,6 +71,7 @@ void UUObjectExporter::NativeGetName(UObject* Object, FName* OutName)
 void UUObjectExporter::InvokeNativeFunction(UObject* NativeObject, UFunction* NativeFunction, uint8* Params, uint8* ReturnValueAddress)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(UUObjectExporter::InvokeNativeFunction);
+	CS_COUNT_MANAGED_TO_NATIVE_CALL();
 	FFrame NewStack(NativeObject, NativeFunction, Params, nullptr, NativeFunction->ChildProperties);
 	NativeFunction->Invoke(NativeObject, NewStack, ReturnValueAddress);
 }
@@ -46,6 +86,7 @@ void UUObjectExporter::InvokeNativeStaticFunction(UClass* NativeClass, UFunction
 	}
 	else
 	{
+		CS_COUNT_MANAGED_TO_NATIVE_CALL();
 		FFrame NewStack(ClassDefaultObject, NativeFunction, Params, nullptr, NativeFunction->ChildProperties);
 		NativeFunction->GetNativeFunc()(ClassDefaultObject, NewStack, ReturnValueAddress);
 	}
@@ -54,18 +95,22 @@ void UUObjectExporter::InvokeNativeStaticFunction(UClass* NativeClass, UFunction
 void UUObjectExporter::InvokeNativeNetFunction(UObject* NativeObject, UFunction* NativeFunction, uint8* Params, uint8* ReturnValueAddress)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(UUObjectExporter::InvokeNativeNetFunction);
+	CS_COUNT_MANAGED_TO_NATIVE_CALL();
 	
-	int32 FunctionCallspace = NativeObject->GetFunctionCallspace(NativeFunction, nullptr);
-		
-	if (FunctionCallspace & FunctionCallspace::Remote)
+	if (!IsAlwaysLocalCall(NativeObject, NativeFunction))
 	{
-		NativeObject->CallRemoteFunction(NativeFunction, Params, nullptr, nullptr);
-		return;
-	}
+		int32 FunctionCallspace = NativeObject->GetFunctionCallspace(NativeFunction, nullptr);
 		
-	if (FunctionCallspace & FunctionCallspace::Absorbed)
-	{
-		return;
+		if (FunctionCallspace & FunctionCallspace::Remote)
+		{
+			NativeObject->CallRemoteFunction(NativeFunction, Params, nullptr, nullptr);
+			return;
+		}
+		
+		if (FunctionCallspace & FunctionCallspace::Absorbed)
+		{
+			return;
+		}
 	}
 
 	FFrame NewStack(NativeObject, NativeFunction, Params, nullptr, NativeFunction->ChildProperties);
@@ -75,6 +120,7 @@ void UUObjectExporter::InvokeNativeNetFunction(UObject* NativeObject, UFunction*
 void UUObjectExporter::InvokeNativeFunctionOutParms(UObject* NativeObject, UFunction* NativeFunction, uint8* Params, uint8* ReturnValueAddress)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(UUObjectExporter::InvokeNativeFunctionOutParms);
+	CS_COUNT_MANAGED_TO_NATIVE_CALL();
 	
 	FFrame NewStack(NativeObject, NativeFunction, Params, nullptr, NativeFunction->ChildProperties);
 	FOutParmRec** LastOut = &NewStack.OutParms;
@@ -112,6 +158,41 @@ void UUObjectExporter::InvokeNativeFunctionOutParms(UObject* NativeObject, UFunc
 	NativeFunction->Invoke(NativeObject, NewStack, ReturnValueAddress);
 }
 
+void UUObjectExporter::InvokeNativeFunctionWithInvocation(UObject* NativeObject, const FCSNativeFunctionInvocation* Invocation, uint8* Params, uint8* ReturnValueAddress)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UUObjectExporter::InvokeNativeFunctionWithInvocation);
+	CS_COUNT_MANAGED_TO_NATIVE_CALL();
+
+	UFunction* NativeFunction = Invocation->Function;
+	FFrame NewStack(NativeObject, NativeFunction, Params, nullptr, NativeFunction->ChildProperties);
+
+	const int32 NumOutParms = Invocation->OutParms.Num();
+	if (NumOutParms > 0)
+	{
+		FOutParmRec* OutParms = static_cast<FOutParmRec*>(UE_VSTACK_ALLOC(VirtualStackAllocator, sizeof(FOutParmRec) * NumOutParms));
+
+		for (int32 i = 0; i < NumOutParms; ++i)
+		{
+			const TPair<FProperty*, int32>& OutParm = Invocation->OutParms[i];
+			OutParms[i].Property = OutParm.Key;
+			OutParms[i].PropAddr = Params + OutParm.Value;
+			OutParms[i].NextOutParm = i + 1 < NumOutParms ? &OutParms[i + 1] : nullptr;
+		}
+
+		NewStack.OutParms = OutParms;
+	}
+
+	if (Invocation->bCanCallDirectly)
+	{
+		NewStack.CurrentNativeFunction = NativeFunction;
+		Invocation->NativeFunc(NativeObject, NewStack, ReturnValueAddress);
+	}
+	else
+	{
+		NativeFunction->Invoke(NativeObject, NewStack, ReturnValueAddress);
+	}
+}
+
 bool UUObjectExporter::NativeIsValid(UObject* Object)
 {
 	return IsValid(Object);
@@ -132,3 +213,15 @@ uint32 UUObjectExporter::GetUniqueID(UObject* Object)
 {
 	return Object->GetUniqueID();
 }
+
+void UUObjectExporter::MarkPropertyDirty(UObject* Object, FProperty* Property)
+{
+#if WITH_PUSH_MODEL
+	if (!IsValid(Object) || !Property || Object->HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
+	{
+		return;
+	}
+
+	MARK_PROPERTY_DIRTY(Object, Property);
+#endif
+}
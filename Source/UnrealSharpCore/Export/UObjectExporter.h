@@ -6,6 +6,8 @@
 #include "CSBindsManager.h"
 #include "UObjectExporter.generated.h"
 
+struct FCSNativeFunctionInvocation;
+
 UCLASS()
 class UNREALSHARPCORE_API UUObjectExporter : public UObject
 {
@@ -34,6 +36,9 @@ public:
 	UNREALSHARP_FUNCTION()
 	static void InvokeNativeFunctionOutParms(UObject* NativeObject, UFunction* NativeFunction, uint8* Params, uint8* ReturnValueAddress);
 
+	UNREALSHARP_FUNCTION()
+	static void InvokeNativeFunctionWithInvocation(UObject* NativeObject, const FCSNativeFunctionInvocation* Invocation, uint8* Params, uint8* ReturnValueAddress);
+
 	UNREALSHARP_FUNCTION()
 	static bool NativeIsValid(UObject* Object);
 
@@ -43,4 +48,8 @@ public:
 	UNREALSHARP_FUNCTION()
 	static uint32 GetUniqueID(UObject* Object);
 
+	// Called from the setters of replicated C# properties. Does nothing unless push model replication is enabled.
+	UNREALSHARP_FUNCTION()
+	static void MarkPropertyDirty(UObject* Object, FProperty* Property);
+
 };
@@ -0,0 +1,25 @@
+﻿#include "USceneComponentExporter.h"
+#include "Components/SceneComponent.h"
+
+namespace
+{
+	struct FK2_GetComponentLocationParms
+	{
+		FVector ReturnValue;
+	};
+
+	struct FK2_GetComponentToWorldParms
+	{
+		FTransform ReturnValue;
+	};
+}
+
+void UUSceneComponentExporter::K2_GetComponentLocation(const USceneComponent* Component, uint8* Params)
+{
+	reinterpret_cast<FK2_GetComponentLocationParms*>(Params)->ReturnValue = Component->K2_GetComponentLocation();
+}
+
+void UUSceneComponentExporter::K2_GetComponentToWorld(const USceneComponent* Component, uint8* Params)
+{
+	reinterpret_cast<FK2_GetComponentToWorldParms*>(Params)->ReturnValue = Component->K2_GetComponentToWorld();
+}
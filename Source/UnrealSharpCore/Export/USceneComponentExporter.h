@@ -0,0 +1,22 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CSBindsManager.h"
+#include "USceneComponentExporter.generated.h"
+
+// Direct-call trampolines for hot USceneComponent functions, see UAActorExporter.
+UCLASS()
+class UNREALSHARPCORE_API UUSceneComponentExporter : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	UNREALSHARP_FUNCTION()
+	static void K2_GetComponentLocation(const USceneComponent* Component, uint8* Params);
+
+	UNREALSHARP_FUNCTION()
+	static void K2_GetComponentToWorld(const USceneComponent* Component, uint8* Params);
+};
@@ -1,4 +1,5 @@
 ﻿#include "UScriptStructExporter.h"
+#include "CSNativeStructPool.h"
 
 int UUScriptStructExporter::GetNativeStructSize(const UScriptStruct* ScriptStruct)
 {
@@ -22,6 +23,13 @@ bool UUScriptStructExporter::NativeCopy(const UScriptStruct* ScriptStruct, void*
         FMemory::Memcpy(Dest, Src, CppStructOps->GetSize());
         return true;
     }
+
+	// Structs defined in C# have no struct ops, but plain old data ones can still be copied as is.
+	if (ScriptStruct->StructFlags & STRUCT_IsPlainOldData)
+	{
+		FMemory::Memcpy(Dest, Src, ScriptStruct->GetStructureSize());
+		return true;
+	}
 	
 	return false;
 }
@@ -37,6 +45,11 @@ bool UUScriptStructExporter::NativeDestroy(const UScriptStruct* ScriptStruct, vo
 
         return true;
 	}
+
+	if (ScriptStruct->StructFlags & STRUCT_NoDestructor)
+	{
+		return true;
+	}
 	
 	return false;
 }
@@ -49,8 +62,8 @@ void UUScriptStructExporter::AllocateNativeStruct(FNativeStructData& Data, const
     }
     else
     {
-        Data.LargeStorage = FMemory::Malloc(NativeSize);
-        ScriptStruct->InitializeStruct(Data.LargeStorage);       
+        Data.LargeStorage = FCSNativeStructPool::Allocate(NativeSize, ScriptStruct->GetMinAlignment());
+        ScriptStruct->InitializeStruct(Data.LargeStorage);
     }
 }
 
@@ -62,8 +75,8 @@ void UUScriptStructExporter::DeallocateNativeStruct(FNativeStructData& Data, con
     }
     else
     {
-        ScriptStruct->DestroyStruct(Data.LargeStorage);    
-        FMemory::Free(Data.LargeStorage);   
+        ScriptStruct->DestroyStruct(Data.LargeStorage);
+        FCSNativeStructPool::Free(Data.LargeStorage, NativeSize, ScriptStruct->GetMinAlignment());
     }
 }
 
@@ -77,3 +90,26 @@ void* UUScriptStructExporter::GetStructLocation(FNativeStructData& Data, const U
     return Data.LargeStorage;
 }
 
+void UUScriptStructExporter::InitializeStructArray(const UScriptStruct* ScriptStruct, void* Dest, int32 Count)
+{
+    if (Count > 0)
+    {
+        ScriptStruct->InitializeStruct(Dest, Count);
+    }
+}
+
+void UUScriptStructExporter::CopyStructArray(const UScriptStruct* ScriptStruct, void* Dest, const void* Src, int32 Count)
+{
+    if (Count > 0)
+    {
+        ScriptStruct->CopyScriptStruct(Dest, Src, Count);
+    }
+}
+
+void UUScriptStructExporter::DestroyStructArray(const UScriptStruct* ScriptStruct, void* Dest, int32 Count)
+{
+    if (Count > 0)
+    {
+        ScriptStruct->DestroyStruct(Dest, Count);
+    }
+}
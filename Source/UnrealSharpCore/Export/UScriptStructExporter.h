@@ -34,4 +34,14 @@ public:
 
     UNREALSHARP_FUNCTION()
     static void* GetStructLocation(FNativeStructData& Data, const UScriptStruct* ScriptStruct);
+
+    // Array forms of the above, so contiguous structs cost one transition instead of one per element.
+    UNREALSHARP_FUNCTION()
+    static void InitializeStructArray(const UScriptStruct* ScriptStruct, void* Dest, int32 Count);
+
+    UNREALSHARP_FUNCTION()
+    static void CopyStructArray(const UScriptStruct* ScriptStruct, void* Dest, const void* Src, int32 Count);
+
+    UNREALSHARP_FUNCTION()
+    static void DestroyStructArray(const UScriptStruct* ScriptStruct, void* Dest, int32 Count);
 };
@@ -1,5 +1,7 @@
 ﻿#include "UWorldExporter.h"
 #include "UnrealSharpCore/CSManager.h"
+#include "CSManagedTimers.h"
+#include "CSSubsystemHandleCache.h"
 #include "Kismet/KismetSystemLibrary.h"
 
 void UUWorldExporter::SetTimer(UObject* Object, FName FunctionName, float Rate, bool Loop, float InitialDelay, FTimerHandle* TimerHandle)
@@ -9,6 +11,11 @@ void UUWorldExporter::SetTimer(UObject* Object, FName FunctionName, float Rate,
 	*TimerHandle = UKismetSystemLibrary::K2_SetTimerDelegate(Delegate, Rate, Loop, false, InitialDelay);
 }
 
+void UUWorldExporter::SetManagedTimer(UObject* WorldContextObject, FGCHandleIntPtr DelegateHandle, float Rate, bool Loop, float InitialDelay, FTimerHandle* TimerHandle)
+{
+	*TimerHandle = FCSManagedTimers::SetTimer(WorldContextObject, DelegateHandle, Rate, Loop, InitialDelay);
+}
+
 void UUWorldExporter::InvalidateTimer(UObject* Object, FTimerHandle* TimerHandle)
 {
 	if (!IsValid(Object))
@@ -26,8 +33,11 @@ void* UUWorldExporter::GetWorldSubsystem(UClass* SubsystemClass, UObject* WorldC
 		return nullptr;
 	}
 	
-	UWorldSubsystem* WorldSubsystem = WorldContextObject->GetWorld()->GetSubsystemBase(SubsystemClass);
-	return UCSManager::Get().FindManagedObject(WorldSubsystem);
+	UWorld* World = WorldContextObject->GetWorld();
+	return FCSSubsystemHandleCache::FindOrAdd(World, SubsystemClass, [World, SubsystemClass]() -> USubsystem*
+	{
+		return World ? World->GetSubsystemBase(SubsystemClass) : nullptr;
+	});
 }
 
 void* UUWorldExporter::GetNetMode(UObject* WorldContextObject)
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "CSBindsManager.h"
+#include "CSManagedGCHandle.h"
 #include "UWorldExporter.generated.h"
 
 UCLASS()
@@ -16,6 +17,10 @@ public:
 	UNREALSHARP_FUNCTION()
 	static void SetTimer(UObject* Object, FName FunctionName, float Rate, bool Loop, float InitialDelay, FTimerHandle* TimerHandle);
 
+	// Calls the managed delegate directly on every fire, and frees its handle once the timer is done.
+	UNREALSHARP_FUNCTION()
+	static void SetManagedTimer(UObject* WorldContextObject, FGCHandleIntPtr DelegateHandle, float Rate, bool Loop, float InitialDelay, FTimerHandle* TimerHandle);
+
 	UNREALSHARP_FUNCTION()
 	static void InvalidateTimer(UObject* Object, FTimerHandle* TimerHandle);
 
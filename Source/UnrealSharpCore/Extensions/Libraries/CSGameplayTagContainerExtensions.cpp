@@ -1,6 +1,26 @@
 ﻿#include "CSGameplayTagContainerExtensions.h"
 #include "GameplayTagContainer.h"
 
+namespace
+{
+	template<typename PredicateType>
+	TArray<int64> BuildMask(int32 Num, PredicateType Predicate)
+	{
+		TArray<int64> Mask;
+		Mask.SetNumZeroed((Num + 63) / 64);
+
+		for (int32 i = 0; i < Num; ++i)
+		{
+			if (Predicate(i))
+			{
+				Mask[i / 64] |= int64(1) << (i % 64);
+			}
+		}
+
+		return Mask;
+	}
+}
+
 bool UCSGameplayTagContainerExtensions::HasTag(const FGameplayTagContainer& Container, const FGameplayTag& Tag)
 {
 	return Container.HasTag(Tag);
@@ -118,3 +138,27 @@ FString UCSGameplayTagContainerExtensions::ToString(const FGameplayTagContainer&
 {
 	return Container.ToString();
 }
+
+TArray<int64> UCSGameplayTagContainerExtensions::HasTagsMask(const FGameplayTagContainer& Container, const TArray<FGameplayTag>& Tags, bool bExactMatch)
+{
+	return BuildMask(Tags.Num(), [&](int32 Index)
+	{
+		return bExactMatch ? Container.HasTagExact(Tags[Index]) : Container.HasTag(Tags[Index]);
+	});
+}
+
+TArray<int64> UCSGameplayTagContainerExtensions::ContainersHaveTagMask(const TArray<FGameplayTagContainer>& Containers, const FGameplayTag& Tag, bool bExactMatch)
+{
+	return BuildMask(Containers.Num(), [&](int32 Index)
+	{
+		return bExactMatch ? Containers[Index].HasTagExact(Tag) : Containers[Index].HasTag(Tag);
+	});
+}
+
+TArray<int64> UCSGameplayTagContainerExtensions::ContainersMatchQueryMask(const TArray<FGameplayTagContainer>& Containers, const FGameplayTagQuery& Query)
+{
+	return BuildMask(Containers.Num(), [&](int32 Index)
+	{
+		return Containers[Index].MatchesQuery(Query);
+	});
+}
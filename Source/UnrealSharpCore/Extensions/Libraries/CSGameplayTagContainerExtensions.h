@@ -213,5 +213,33 @@ public:
 	 */
 	UFUNCTION(BlueprintCallable)
 	static FString ToString(const FGameplayTagContainer& Container);
+
+	/**
+	 * Checks the container against every tag in one call. Bit i of the result is set if the container has Tags[i].
+	 *
+	 * @param bExactMatch	Only allow exact matches, like HasTagExact
+	 * 
+	 * @return A bitmask of (Tags.Num() + 63) / 64 words
+	 */
+	UFUNCTION(meta=(ExtensionMethod, ScriptMethod))
+	static TArray<int64> HasTagsMask(const FGameplayTagContainer& Container, const TArray<FGameplayTag>& Tags, bool bExactMatch);
+
+	/**
+	 * Checks every container against the tag in one call. Bit i of the result is set if Containers[i] has the tag.
+	 *
+	 * @param bExactMatch	Only allow exact matches, like HasTagExact
+	 * 
+	 * @return A bitmask of (Containers.Num() + 63) / 64 words
+	 */
+	UFUNCTION()
+	static TArray<int64> ContainersHaveTagMask(const TArray<FGameplayTagContainer>& Containers, const FGameplayTag& Tag, bool bExactMatch);
+
+	/**
+	 * Checks every container against the query in one call. Bit i of the result is set if Containers[i] matches the query.
+	 * 
+	 * @return A bitmask of (Containers.Num() + 63) / 64 words
+	 */
+	UFUNCTION()
+	static TArray<int64> ContainersMatchQueryMask(const TArray<FGameplayTagContainer>& Containers, const FGameplayTagQuery& Query);
 	
 };
@@ -45,3 +45,25 @@ FGameplayTagContainer UCSGameplayTagExtensions::GetSingleTagContainer(const FGam
 {
     return Tag.GetSingleTagContainer();
 }
+
+void UCSGameplayTagExtensions::GetTagIndices(const FGameplayTag& Tag, TArray<int32>& OutIndices)
+{
+    static TMap<FGameplayTag, int32> TagIndices;
+
+    OutIndices.Reset();
+
+    if (!Tag.IsValid())
+    {
+        return;
+    }
+
+    const FGameplayTagContainer Parents = Tag.GetGameplayTagParents();
+    OutIndices.Reserve(Parents.Num());
+
+    // The tag itself comes first in the parents container.
+    for (const FGameplayTag& ParentTag : Parents)
+    {
+        int32& Index = TagIndices.FindOrAdd(ParentTag, TagIndices.Num());
+        OutIndices.Add(Index);
+    }
+}
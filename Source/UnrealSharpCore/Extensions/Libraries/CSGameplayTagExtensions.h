@@ -100,5 +100,15 @@ public:
      */
     UFUNCTION(meta=(ExtensionMethod, ScriptMethod))
     static FGameplayTagContainer GetSingleTagContainer(const FGameplayTag Tag);
+
+    /**
+     * Interns the tag and its parents into dense indices, used by C# to build tag bitsets.
+     * An index stays the same for the lifetime of the process, even if the tag tree is refreshed.
+     * 
+     * @param Tag The gameplay tag to call on
+     * @param OutIndices The index of the tag first, then the indices of its parents. Empty if the tag isn't valid.
+     */
+    UFUNCTION(meta=(ScriptMethod))
+    static void GetTagIndices(const FGameplayTag& Tag, TArray<int32>& OutIndices);
 	
 };
@@ -36,6 +36,40 @@ bool UCSMovementComponentExtensions::ResolvePenetrationRotator(UMovementComponen
 	return MovementComponent->ResolvePenetration(Adjustment, Hit, NewRotation);
 }
 
+TArray<int64> UCSMovementComponentExtensions::SafeMoveUpdatedComponentsBatch(const TArray<FCSMovementRequest>& Requests, TArray<FHitResult>& OutHits)
+{
+	TArray<int64> MovedMask;
+	MovedMask.SetNumZeroed((Requests.Num() + 63) / 64);
+
+	OutHits.Reset(Requests.Num());
+	OutHits.SetNum(Requests.Num());
+
+	for (int32 i = 0; i < Requests.Num(); ++i)
+	{
+		const FCSMovementRequest& Request = Requests[i];
+		UMovementComponent* MovementComponent = Request.MovementComponent;
+		if (!IsValid(MovementComponent) || !MovementComponent->UpdatedComponent)
+		{
+			continue;
+		}
+
+		FHitResult& Hit = OutHits[i];
+		bool bMoved = MovementComponent->SafeMoveUpdatedComponent(Request.Delta, Request.NewRotation, Request.bSweep, Hit, Request.Teleport);
+
+		if (Request.bSlideAlongSurface && Hit.IsValidBlockingHit() && !Hit.bStartPenetrating)
+		{
+			bMoved |= MovementComponent->SlideAlongSurface(Request.Delta, 1.f - Hit.Time, Hit.Normal, Hit, true) > 0.f;
+		}
+
+		if (bMoved)
+		{
+			MovedMask[i / 64] |= int64(1) << (i % 64);
+		}
+	}
+
+	return MovedMask;
+}
+
 void UCSMovementComponentExtensions::UpdateComponentVelocity(UMovementComponent* MovementComponent)
 {
 	MovementComponent->UpdateComponentVelocity();
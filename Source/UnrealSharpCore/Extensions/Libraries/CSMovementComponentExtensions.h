@@ -6,6 +6,31 @@
 
 class UMovementComponent;
 
+USTRUCT()
+struct FCSMovementRequest
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TObjectPtr<UMovementComponent> MovementComponent = nullptr;
+
+	UPROPERTY()
+	FVector Delta = FVector::ZeroVector;
+
+	UPROPERTY()
+	FQuat NewRotation = FQuat::Identity;
+
+	UPROPERTY()
+	bool bSweep = true;
+
+	// Slides along the surface that blocked the move, like the movement components do after SafeMoveUpdatedComponent.
+	UPROPERTY()
+	bool bSlideAlongSurface = false;
+
+	UPROPERTY()
+	ETeleportType Teleport = ETeleportType::None;
+};
+
 UCLASS(meta = (InternalType))
 class UCSMovementComponentExtensions : public UBlueprintFunctionLibrary
 {
@@ -88,6 +113,17 @@ public:
 	UFUNCTION(meta = (ExtensionMethod, ScriptMethod))
 	static bool ResolvePenetrationRotator(UMovementComponent* MovementComponent, const FVector& Adjustment, const FHitResult& Hit, const FRotator& NewRotation);
 
+	/**
+	 * SafeMoveUpdatedComponent for every request in one call, in order. Moves change the scene the next sweep runs against,
+	 * so they run on the game thread one after the other. Requests with an invalid movement component are skipped.
+	 *
+	 * @param OutHits	The hit of the last move of each request, lines up with Requests
+	 * 
+	 * @return A bitmask of (Requests.Num() + 63) / 64 words, bit i is set if the move of Requests[i] succeeded
+	 */
+	UFUNCTION()
+	static TArray<int64> SafeMoveUpdatedComponentsBatch(const TArray<FCSMovementRequest>& Requests, TArray<FHitResult>& OutHits);
+
 	/** Update ComponentVelocity of UpdatedComponent. This needs to be called by derived classes at the end of an update whenever Velocity has changed.	 */
 	UFUNCTION(meta = (ExtensionMethod, ScriptMethod))
 	static void UpdateComponentVelocity(UMovementComponent* MovementComponent);
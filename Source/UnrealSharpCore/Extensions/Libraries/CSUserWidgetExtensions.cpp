@@ -50,3 +50,13 @@ UUserWidget* UCSUserWidgetExtensions::CreateWidget(UObject* WorldContextObject,
 	UUserWidget* UserWidget = UWidgetBlueprintLibrary::Create(WorldContextObject, UserWidgetClass, OwningController);
 	return UserWidget;
 }
+
+void UCSUserWidgetExtensions::SynchronizeProperties(UWidget* Widget)
+{
+	if (!IsValid(Widget))
+	{
+		return;
+	}
+
+	Widget->SynchronizeProperties();
+}
@@ -25,4 +25,8 @@ public:
 
 	UFUNCTION(meta=(ScriptMethod, UserWidgetClass = "/Script/UMG.UserWidget", DeterminesOutputType = "UserWidgetClass"))
 	static UUserWidget* CreateWidget(UObject* WorldContextObject, const TSubclassOf<UUserWidget>& UserWidgetClass, APlayerController* OwningController);
+
+	// Pushes the properties of the widget to its Slate widget, after they were written directly.
+	UFUNCTION(meta=(ScriptMethod))
+	static void SynchronizeProperties(UWidget* Widget);
 };
@@ -2,6 +2,39 @@
 #include "UnrealSharpCore.h"
 #include "GameFramework/Actor.h"
 
+namespace
+{
+	UWorld* GetSpawnWorld(const UObject* WorldContextObject, const TSubclassOf<AActor>& Class)
+	{
+		if (!IsValid(WorldContextObject) || !IsValid(Class))
+		{
+			UE_LOG(LogUnrealSharp, Error, TEXT("Invalid world context object or class"));
+			return nullptr;
+		}
+
+		UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+
+		if (!IsValid(World))
+		{
+			UE_LOG(LogUnrealSharp, Error, TEXT("Failed to get world from context object"));
+			return nullptr;
+		}
+
+		return World;
+	}
+
+	FActorSpawnParameters MakeSpawnParameters(const FCSSpawnActorParameters& SpawnParameters, bool bDeferConstruction)
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.Instigator = SpawnParameters.Instigator;
+		SpawnParams.Owner = SpawnParameters.Owner;
+		SpawnParams.Template = SpawnParameters.Template;
+		SpawnParams.SpawnCollisionHandlingOverride = SpawnParameters.SpawnMethod;
+		SpawnParams.bDeferConstruction = bDeferConstruction;
+		return SpawnParams;
+	}
+}
+
 AActor* UCSWorldExtensions::SpawnActor(const UObject* WorldContextObject, const TSubclassOf<AActor>& Class, const FTransform& Transform, const FCSSpawnActorParameters& InSpawnParameters)
 {
 	return SpawnActor_Internal(WorldContextObject, Class, Transform, InSpawnParameters, false);
@@ -23,6 +56,44 @@ void UCSWorldExtensions::PostActorConstruction(AActor* Actor)
 	Actor->PostLoad();
 }
 
+TArray<AActor*> UCSWorldExtensions::SpawnActorsBatch(const UObject* WorldContextObject, const TSubclassOf<AActor>& Class, const TArray<FTransform>& Transforms, const FCSSpawnActorParameters& SpawnParameters)
+{
+	return SpawnActorsBatch_Internal(WorldContextObject, Class, Transforms, SpawnParameters, false);
+}
+
+TArray<AActor*> UCSWorldExtensions::SpawnActorsDeferredBatch(const UObject* WorldContextObject, const TSubclassOf<AActor>& Class, const TArray<FTransform>& Transforms, const FCSSpawnActorParameters& SpawnParameters)
+{
+	return SpawnActorsBatch_Internal(WorldContextObject, Class, Transforms, SpawnParameters, true);
+}
+
+void UCSWorldExtensions::ExecuteConstructionBatch(const TArray<AActor*>& Actors, const TArray<FTransform>& Transforms)
+{
+	if (Actors.Num() != Transforms.Num())
+	{
+		UE_LOG(LogUnrealSharp, Error, TEXT("ExecuteConstructionBatch: got %d actors but %d transforms"), Actors.Num(), Transforms.Num());
+		return;
+	}
+
+	for (int32 i = 0; i < Actors.Num(); ++i)
+	{
+		if (IsValid(Actors[i]))
+		{
+			ExecuteConstruction(Actors[i], Transforms[i]);
+		}
+	}
+}
+
+void UCSWorldExtensions::PostActorConstructionBatch(const TArray<AActor*>& Actors)
+{
+	for (AActor* Actor : Actors)
+	{
+		if (IsValid(Actor))
+		{
+			PostActorConstruction(Actor);
+		}
+	}
+}
+
 FURL UCSWorldExtensions::WorldURL(const UObject* WorldContextObject)
 {
 	if (!IsValid(WorldContextObject))
@@ -44,27 +115,35 @@ FURL UCSWorldExtensions::WorldURL(const UObject* WorldContextObject)
 
 AActor* UCSWorldExtensions::SpawnActor_Internal(const UObject* WorldContextObject, const TSubclassOf<AActor>& Class, const FTransform& Transform, const FCSSpawnActorParameters& SpawnParameters, bool bDeferConstruction)
 {
-	if (!IsValid(WorldContextObject) || !IsValid(Class))
+	UWorld* World = GetSpawnWorld(WorldContextObject, Class);
+
+	if (!World)
 	{
-		UE_LOG(LogUnrealSharp, Error, TEXT("Invalid world context object or class"));
 		return nullptr;
 	}
+	
+	return World->SpawnActor(Class, &Transform, MakeSpawnParameters(SpawnParameters, bDeferConstruction));
+}
 
-	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+TArray<AActor*> UCSWorldExtensions::SpawnActorsBatch_Internal(const UObject* WorldContextObject, const TSubclassOf<AActor>& Class, const TArray<FTransform>& Transforms, const FCSSpawnActorParameters& SpawnParameters, bool bDeferConstruction)
+{
+	TArray<AActor*> SpawnedActors;
+	UWorld* World = GetSpawnWorld(WorldContextObject, Class);
 
-	if (!IsValid(World))
+	if (!World)
 	{
-		UE_LOG(LogUnrealSharp, Error, TEXT("Failed to get world from context object"));
-		return nullptr;
+		return SpawnedActors;
 	}
 
-	FActorSpawnParameters SpawnParams;
-	SpawnParams.Instigator = SpawnParameters.Instigator;
-	SpawnParams.Owner = SpawnParameters.Owner;
-	SpawnParams.Template = SpawnParameters.Template;
-	SpawnParams.SpawnCollisionHandlingOverride = SpawnParameters.SpawnMethod;
-	SpawnParams.bDeferConstruction = bDeferConstruction;
-	
-	return World->SpawnActor(Class, &Transform, SpawnParams);
-}
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCSWorldExtensions::SpawnActorsBatch);
 
+	const FActorSpawnParameters SpawnParams = MakeSpawnParameters(SpawnParameters, bDeferConstruction);
+
+	SpawnedActors.Reserve(Transforms.Num());
+	for (const FTransform& Transform : Transforms)
+	{
+		SpawnedActors.Add(World->SpawnActor(Class, &Transform, SpawnParams));
+	}
+
+	return SpawnedActors;
+}
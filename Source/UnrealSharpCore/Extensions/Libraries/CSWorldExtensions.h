@@ -37,9 +37,25 @@ public:
 	UFUNCTION(meta = (ScriptMethod))
 	static void PostActorConstruction(AActor* Actor);
 
+	// Spawns one actor per transform, resolving the world and validating once for the whole batch.
+	// Actors that fail to spawn are left as nullptr, so the result lines up with Transforms.
+	UFUNCTION(meta = (ScriptMethod))
+	static TArray<AActor*> SpawnActorsBatch(const UObject* WorldContextObject, const TSubclassOf<AActor>& Class, const TArray<FTransform>& Transforms, const FCSSpawnActorParameters& SpawnParameters);
+
+	UFUNCTION(meta = (ScriptMethod))
+	static TArray<AActor*> SpawnActorsDeferredBatch(const UObject* WorldContextObject, const TSubclassOf<AActor>& Class, const TArray<FTransform>& Transforms, const FCSSpawnActorParameters& SpawnParameters);
+
+	// Batched ExecuteConstruction/PostActorConstruction for actors from SpawnActorsDeferredBatch. Null actors are skipped.
+	UFUNCTION(meta = (ScriptMethod))
+	static void ExecuteConstructionBatch(const TArray<AActor*>& Actors, const TArray<FTransform>& Transforms);
+
+	UFUNCTION(meta = (ScriptMethod))
+	static void PostActorConstructionBatch(const TArray<AActor*>& Actors);
+
 	UFUNCTION(meta = (ScriptMethod))
 	static FURL WorldURL(const UObject* WorldContextObject);
 private:
 	static AActor* SpawnActor_Internal(const UObject* WorldContextObject, const TSubclassOf<AActor>& Class, const FTransform& Transform, const FCSSpawnActorParameters& SpawnParameters, bool bDeferConstruction);
+	static TArray<AActor*> SpawnActorsBatch_Internal(const UObject* WorldContextObject, const TSubclassOf<AActor>& Class, const TArray<FTransform>& Transforms, const FCSSpawnActorParameters& SpawnParameters, bool bDeferConstruction);
 };
 
@@ -4,6 +4,11 @@
 #include "UObject/Package.h"
 #include "Engine/NetDriver.h"
 #include "Engine/Engine.h"
+#include "TypeGenerator/CSClass.h"
+
+#if UE_WITH_IRIS
+#include "Iris/ReplicationSystem/ReplicationFragmentUtil.h"
+#endif
 
 UWorld* UCSReplicatedObject::GetWorld() const
 {
@@ -28,7 +33,18 @@ void UCSReplicatedObject::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>&
 	{
 		BPCClass->GetLifetimeBlueprintReplicationList(OutLifetimeProps);
 	}
+
+	UCSClass::MarkPushBasedProperties(GetClass(), OutLifetimeProps);
+}
+
+#if UE_WITH_IRIS
+void UCSReplicatedObject::RegisterReplicationFragments(UE::Net::FFragmentRegistrationContext& Context, UE::Net::EFragmentRegistrationFlags RegistrationFlags)
+{
+	// Actors and components do this on their own, plain UObjects don't. The descriptors are built from the same
+	// lifetime properties as the legacy path, so replicated C# properties and push model work the same way.
+	UE::Net::FReplicationFragmentUtil::CreateAndRegisterFragmentsForObject(this, Context, RegistrationFlags);
 }
+#endif
 
 bool UCSReplicatedObject::IsSupportedForNetworking() const
 {
@@ -48,7 +64,7 @@ int32 UCSReplicatedObject::GetFunctionCallspace(UFunction* Function, FFrame* Sta
 bool UCSReplicatedObject::CallRemoteFunction(UFunction* Function, void* Parms, FOutParmRec* OutParms, FFrame* Stack)
 {
 	AActor* Owner = GetOwningActor();
-	UNetDriver* NetDriver = Owner->GetNetDriver();
+	UNetDriver* NetDriver = IsValid(Owner) ? Owner->GetNetDriver() : nullptr;
 	if (!IsValid(NetDriver))
 	{
 		return false;
@@ -58,9 +74,22 @@ bool UCSReplicatedObject::CallRemoteFunction(UFunction* Function, void* Parms, F
 	return true;
 }
 
+void UCSReplicatedObject::PostRename(UObject* OldOuter, const FName OldName)
+{
+	Super::PostRename(OldOuter, OldName);
+	CachedOwningActor.Reset();
+}
+
 AActor* UCSReplicatedObject::GetOwningActor() const
 {
-	return GetTypedOuter<AActor>();
+	if (AActor* Owner = CachedOwningActor.Get())
+	{
+		return Owner;
+	}
+
+	AActor* Owner = GetTypedOuter<AActor>();
+	CachedOwningActor = Owner;
+	return Owner;
 }
 
 void UCSReplicatedObject::DestroyObject()
@@ -29,6 +29,10 @@ public:
 	virtual bool IsSupportedForNetworking() const override;
 	virtual int32 GetFunctionCallspace(UFunction* Function, FFrame* Stack) override;
 	virtual bool CallRemoteFunction(UFunction* Function, void* Parms, struct FOutParmRec* OutParms, FFrame* Stack) override;
+	virtual void PostRename(UObject* OldOuter, const FName OldName) override;
+#if UE_WITH_IRIS
+	virtual void RegisterReplicationFragments(UE::Net::FFragmentRegistrationContext& Context, UE::Net::EFragmentRegistrationFlags RegistrationFlags) override;
+#endif
 	// End of implementation
 
 	// Will mark this UObject as garbage and will eventually get cleaned by the garbage collector.
@@ -45,4 +49,9 @@ public:
 	// Is this UObject replicated?
 	UPROPERTY(EditAnywhere)
 	TEnumAsByte<ECSReplicationState> ReplicationState = ECSReplicationState::Replicates;
+
+private:
+
+	// The outer chain only changes on rename, so RPCs don't have to walk it every call.
+	mutable TWeakObjectPtr<AActor> CachedOwningActor;
 };
\ No newline at end of file
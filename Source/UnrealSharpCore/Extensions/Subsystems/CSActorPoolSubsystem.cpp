@@ -0,0 +1,307 @@
+#include "CSActorPoolSubsystem.h"
+#include "CSManager.h"
+#include "Components/SceneComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/Pawn.h"
+#include "TimerManager.h"
+#include "UnrealSharpCore.h"
+#include "Utils/CSClassUtilities.h"
+
+namespace
+{
+	constexpr ERenameFlags PoolRenameFlags = REN_DontCreateRedirectors | REN_DoNotDirty | REN_NonTransactional;
+
+	void SetComponentsTickEnabled(AActor* Actor, bool bEnabled)
+	{
+		Actor->ForEachComponent(false, [bEnabled](UActorComponent* Component)
+		{
+			Component->SetComponentTickEnabled(bEnabled && Component->PrimaryComponentTick.bStartWithTickEnabled);
+		});
+	}
+}
+
+bool UCSActorPoolSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	const UWorld* World = Cast<UWorld>(Outer);
+	return World && World->IsGameWorld();
+}
+
+void UCSActorPoolSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	UCSManager& Manager = UCSManager::Get();
+	OnNewClassHandle = Manager.OnNewClassEvent().AddUObject(this, &UCSActorPoolSubsystem::OnClassRebuilt);
+	OnAssembliesLoadedHandle = Manager.OnAssembliesLoadedEvent().AddUObject(this, &UCSActorPoolSubsystem::Flush);
+}
+
+void UCSActorPoolSubsystem::Deinitialize()
+{
+	UCSManager& Manager = UCSManager::Get();
+	Manager.OnNewClassEvent().Remove(OnNewClassHandle);
+	Manager.OnAssembliesLoadedEvent().Remove(OnAssembliesLoadedHandle);
+
+	// The world is going away and takes the pooled actors with it.
+	PooledActors.Empty();
+	PooledComponents.Empty();
+
+	Super::Deinitialize();
+}
+
+AActor* UCSActorPoolSubsystem::AcquireActor(TSubclassOf<AActor> Class, const FTransform& Transform, const FCSSpawnActorParameters& SpawnParameters)
+{
+	if (FCSPooledActors* Pool = PooledActors.Find(Class))
+	{
+		while (!Pool->Actors.IsEmpty())
+		{
+			AActor* Actor = Pool->Actors.Pop();
+
+			// Something else may have destroyed it while it was pooled.
+			if (!IsValid(Actor))
+			{
+				continue;
+			}
+
+			Actor->SetActorTransform(Transform, false, nullptr, ETeleportType::ResetPhysics);
+			Actor->SetOwner(SpawnParameters.Owner);
+			Actor->SetInstigator(SpawnParameters.Instigator);
+			Actor->SetActorHiddenInGame(false);
+			Actor->SetActorEnableCollision(true);
+			Actor->SetActorTickEnabled(Actor->PrimaryActorTick.bStartWithTickEnabled);
+			SetComponentsTickEnabled(Actor, true);
+			return Actor;
+		}
+	}
+
+	return UCSWorldExtensions::SpawnActor(GetWorld(), Class, Transform, SpawnParameters);
+}
+
+bool UCSActorPoolSubsystem::ReleaseActor(AActor* Actor)
+{
+	if (!IsValid(Actor))
+	{
+		return false;
+	}
+
+	UClass* Class = Actor->GetClass();
+	if (!CanBePooled(Class) || Actor->GetWorld() != GetWorld())
+	{
+		Actor->Destroy();
+		return false;
+	}
+
+	FCSPooledActors& Pool = PooledActors.FindOrAdd(Class);
+	if (Pool.Actors.Num() >= MaxPooledPerClass)
+	{
+		Actor->Destroy();
+		return false;
+	}
+
+	if (Pool.Actors.Contains(Actor))
+	{
+		UE_LOG(LogUnrealSharp, Warning, TEXT("%s was released to the actor pool twice"), *Actor->GetName());
+		return true;
+	}
+
+	GetWorld()->GetTimerManager().ClearAllTimersForObject(Actor);
+	Actor->DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+	Actor->SetActorHiddenInGame(true);
+	Actor->SetActorEnableCollision(false);
+	Actor->SetActorTickEnabled(false);
+	SetComponentsTickEnabled(Actor, false);
+
+	Pool.Actors.Add(Actor);
+	return true;
+}
+
+UActorComponent* UCSActorPoolSubsystem::AcquireComponent(AActor* Owner, TSubclassOf<UActorComponent> Class)
+{
+	if (!IsValid(Owner) || !IsValid(Class))
+	{
+		UE_LOG(LogUnrealSharp, Error, TEXT("Invalid owner or class"));
+		return nullptr;
+	}
+
+	UActorComponent* Component = nullptr;
+	if (FCSPooledComponents* Pool = PooledComponents.Find(Class))
+	{
+		while (!Pool->Components.IsEmpty() && !Component)
+		{
+			Component = Pool->Components.Pop();
+			if (!IsValid(Component))
+			{
+				Component = nullptr;
+			}
+		}
+	}
+
+	if (Component)
+	{
+		Component->Rename(nullptr, Owner, PoolRenameFlags);
+	}
+	else
+	{
+		Component = NewObject<UActorComponent>(Owner, Class);
+	}
+
+	Owner->AddInstanceComponent(Component);
+	Component->RegisterComponent();
+	Component->SetComponentTickEnabled(Component->PrimaryComponentTick.bStartWithTickEnabled);
+	return Component;
+}
+
+bool UCSActorPoolSubsystem::ReleaseComponent(UActorComponent* Component)
+{
+	if (!IsValid(Component))
+	{
+		return false;
+	}
+
+	UClass* Class = Component->GetClass();
+	if (!CanBePooled(Class) || Component->GetWorld() != GetWorld())
+	{
+		Component->DestroyComponent();
+		return false;
+	}
+
+	FCSPooledComponents& Pool = PooledComponents.FindOrAdd(Class);
+	if (Pool.Components.Num() >= MaxPooledPerClass)
+	{
+		Component->DestroyComponent();
+		return false;
+	}
+
+	if (Pool.Components.Contains(Component))
+	{
+		UE_LOG(LogUnrealSharp, Warning, TEXT("%s was released to the actor pool twice"), *Component->GetName());
+		return true;
+	}
+
+	if (USceneComponent* SceneComponent = Cast<USceneComponent>(Component))
+	{
+		SceneComponent->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+	}
+
+	if (AActor* Owner = Component->GetOwner())
+	{
+		Owner->RemoveInstanceComponent(Component);
+	}
+
+	Component->SetComponentTickEnabled(false);
+	Component->UnregisterComponent();
+	Component->Rename(nullptr, this, PoolRenameFlags);
+
+	Pool.Components.Add(Component);
+	return true;
+}
+
+void UCSActorPoolSubsystem::Prewarm(TSubclassOf<AActor> Class, int32 Count)
+{
+	if (!IsValid(Class) || !CanBePooled(Class))
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCSActorPoolSubsystem::Prewarm);
+
+	const int32 NumToSpawn = FMath::Min(Count, MaxPooledPerClass) - GetNumPooledActors(Class);
+	for (int32 i = 0; i < NumToSpawn; ++i)
+	{
+		if (AActor* Actor = UCSWorldExtensions::SpawnActor(GetWorld(), Class, FTransform::Identity, FCSSpawnActorParameters()))
+		{
+			ReleaseActor(Actor);
+		}
+	}
+}
+
+int32 UCSActorPoolSubsystem::GetNumPooledActors(TSubclassOf<AActor> Class) const
+{
+	const FCSPooledActors* Pool = PooledActors.Find(Class);
+	return Pool ? Pool->Actors.Num() : 0;
+}
+
+void UCSActorPoolSubsystem::Flush()
+{
+	for (TPair<TObjectPtr<UClass>, FCSPooledActors>& Pool : PooledActors)
+	{
+		for (AActor* Actor : Pool.Value.Actors)
+		{
+			if (IsValid(Actor))
+			{
+				Actor->Destroy();
+			}
+		}
+	}
+
+	for (TPair<TObjectPtr<UClass>, FCSPooledComponents>& Pool : PooledComponents)
+	{
+		for (UActorComponent* Component : Pool.Value.Components)
+		{
+			if (IsValid(Component))
+			{
+				Component->DestroyComponent();
+			}
+		}
+	}
+
+	PooledActors.Empty();
+	PooledComponents.Empty();
+}
+
+bool UCSActorPoolSubsystem::CanBePooled(const UClass* Class)
+{
+	return FCSClassUtilities::GetFirstManagedClass(const_cast<UClass*>(Class)) != nullptr;
+}
+
+void UCSActorPoolSubsystem::OnClassRebuilt(UCSClass* Class)
+{
+	TArray<UClass*> ClassesToFlush;
+	for (const TPair<TObjectPtr<UClass>, FCSPooledActors>& Pool : PooledActors)
+	{
+		if (Pool.Key && Pool.Key->IsChildOf(Class))
+		{
+			ClassesToFlush.Add(Pool.Key);
+		}
+	}
+
+	for (const TPair<TObjectPtr<UClass>, FCSPooledComponents>& Pool : PooledComponents)
+	{
+		if (Pool.Key && Pool.Key->IsChildOf(Class))
+		{
+			ClassesToFlush.AddUnique(Pool.Key);
+		}
+	}
+
+	for (UClass* ClassToFlush : ClassesToFlush)
+	{
+		FlushClass(ClassToFlush);
+	}
+}
+
+void UCSActorPoolSubsystem::FlushClass(UClass* Class)
+{
+	FCSPooledActors Actors;
+	if (PooledActors.RemoveAndCopyValue(Class, Actors))
+	{
+		for (AActor* Actor : Actors.Actors)
+		{
+			if (IsValid(Actor))
+			{
+				Actor->Destroy();
+			}
+		}
+	}
+
+	FCSPooledComponents Components;
+	if (PooledComponents.RemoveAndCopyValue(Class, Components))
+	{
+		for (UActorComponent* Component : Components.Components)
+		{
+			if (IsValid(Component))
+			{
+				Component->DestroyComponent();
+			}
+		}
+	}
+}
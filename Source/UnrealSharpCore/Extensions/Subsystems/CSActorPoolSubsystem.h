@@ -0,0 +1,96 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Extensions/Libraries/CSWorldExtensions.h"
+#include "CSActorPoolSubsystem.generated.h"
+
+class UCSClass;
+
+USTRUCT()
+struct FCSPooledActors
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<TObjectPtr<AActor>> Actors;
+};
+
+USTRUCT()
+struct FCSPooledComponents
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<TObjectPtr<UActorComponent>> Components;
+};
+
+/**
+ * Keeps released instances of C# actors and components around for reuse, so spawning one doesn't go through
+ * the managed object constructor, property initialization and managed object creation again. The managed object
+ * stays attached to the native one while it's pooled, C# resets it in OnAcquire/OnRelease.
+ *
+ * Only classes with a UCSClass in their hierarchy are pooled. Pooled instances of a class are destroyed when the
+ * class is rebuilt or the assemblies reload, since their layout may no longer match.
+ * C# should go through Acquire/Release on the managed side, which run the hooks around these.
+ */
+UCLASS()
+class UCSActorPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	// UWorldSubsystem interface
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	// End of UWorldSubsystem interface
+
+	// Reuses a pooled actor of exactly this class when there is one, moved to Transform. Otherwise spawns a new one.
+	UFUNCTION()
+	AActor* AcquireActor(TSubclassOf<AActor> Class, const FTransform& Transform, const FCSSpawnActorParameters& SpawnParameters);
+
+	// Hides the actor and turns off its collision and ticking until it's acquired again.
+	// Returns false and destroys the actor when it can't be pooled, or the pool for its class is full.
+	UFUNCTION()
+	bool ReleaseActor(AActor* Actor);
+
+	// Reuses a pooled component of exactly this class when there is one, moved to Owner and registered. Otherwise creates a new one.
+	UFUNCTION()
+	UActorComponent* AcquireComponent(AActor* Owner, TSubclassOf<UActorComponent> Class);
+
+	// Unregisters the component and moves it to the pool. Returns false and destroys it when it can't be pooled.
+	UFUNCTION()
+	bool ReleaseComponent(UActorComponent* Component);
+
+	// Spawns actors until the pool for the class holds Count of them.
+	UFUNCTION()
+	void Prewarm(TSubclassOf<AActor> Class, int32 Count);
+
+	UFUNCTION()
+	int32 GetNumPooledActors(TSubclassOf<AActor> Class) const;
+
+	// Destroys everything in the pool.
+	UFUNCTION()
+	void Flush();
+
+	UPROPERTY()
+	int32 MaxPooledPerClass = 256;
+
+private:
+
+	static bool CanBePooled(const UClass* Class);
+
+	void OnClassRebuilt(UCSClass* Class);
+	void FlushClass(UClass* Class);
+
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<UClass>, FCSPooledActors> PooledActors;
+
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<UClass>, FCSPooledComponents> PooledComponents;
+
+	FDelegateHandle OnNewClassHandle;
+	FDelegateHandle OnAssembliesLoadedHandle;
+};
@@ -0,0 +1,237 @@
+#include "CSCollisionEventSubsystem.h"
+#include "Components/PrimitiveComponent.h"
+
+int32 UCSCollisionEventSubsystem::AddListener(FListenerEntryPoint EntryPoint, void* State)
+{
+	const int32 ListenerId = NextListenerId++;
+
+	FListener& Listener = Listeners.Add(ListenerId);
+	Listener.EntryPoint = EntryPoint;
+	Listener.State = State;
+
+	return ListenerId;
+}
+
+void UCSCollisionEventSubsystem::RemoveListener(int32 ListenerId)
+{
+	if (!Listeners.Remove(ListenerId))
+	{
+		return;
+	}
+
+	for (auto It = ComponentListeners.CreateIterator(); It; ++It)
+	{
+		It.Value().RemoveAll([ListenerId](const FComponentListener& ComponentListener) { return ComponentListener.ListenerId == ListenerId; });
+
+		if (It.Value().IsEmpty())
+		{
+			UnbindComponent(It.Key().ResolveObjectPtr());
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void UCSCollisionEventSubsystem::Listen(int32 ListenerId, UPrimitiveComponent* Component, ECSCollisionEventMask Events)
+{
+	if (!IsValid(Component) || !Listeners.Contains(ListenerId))
+	{
+		return;
+	}
+
+	TArray<FComponentListener, TInlineAllocator<2>>& ListenersOfComponent = ComponentListeners.FindOrAdd(Component);
+	if (ListenersOfComponent.IsEmpty())
+	{
+		BindComponent(Component);
+	}
+
+	if (FComponentListener* Existing = ListenersOfComponent.FindByPredicate([ListenerId](const FComponentListener& ComponentListener) { return ComponentListener.ListenerId == ListenerId; }))
+	{
+		Existing->Events = Events;
+		return;
+	}
+
+	ListenersOfComponent.Add({ ListenerId, Events });
+}
+
+void UCSCollisionEventSubsystem::StopListening(int32 ListenerId, UPrimitiveComponent* Component)
+{
+	TArray<FComponentListener, TInlineAllocator<2>>* ListenersOfComponent = ComponentListeners.Find(Component);
+	if (!ListenersOfComponent)
+	{
+		return;
+	}
+
+	ListenersOfComponent->RemoveAll([ListenerId](const FComponentListener& ComponentListener) { return ComponentListener.ListenerId == ListenerId; });
+
+	if (ListenersOfComponent->IsEmpty())
+	{
+		UnbindComponent(Component);
+		ComponentListeners.Remove(Component);
+	}
+}
+
+void UCSCollisionEventSubsystem::Deinitialize()
+{
+	for (const auto& Pair : ComponentListeners)
+	{
+		UnbindComponent(Pair.Key.ResolveObjectPtr());
+	}
+
+	ComponentListeners.Empty();
+	Listeners.Empty();
+
+	Super::Deinitialize();
+}
+
+void UCSCollisionEventSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCSCollisionEventSubsystem::Tick);
+
+	// Components destroyed while listened to are dropped, they never unbind themselves.
+	for (auto It = ComponentListeners.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().ResolveObjectPtr())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	// Listeners may come and go while others are called.
+	TArray<int32, TInlineAllocator<16>> ListenerIds;
+	for (const TPair<int32, FListener>& Pair : Listeners)
+	{
+		if (!Pair.Value.Events.IsEmpty())
+		{
+			ListenerIds.Add(Pair.Key);
+		}
+	}
+
+	for (int32 ListenerId : ListenerIds)
+	{
+		FListener* Listener = Listeners.Find(ListenerId);
+		if (!Listener)
+		{
+			continue;
+		}
+
+		// Events raised by the callback itself are delivered next frame.
+		TArray<FPendingEvent> Events = MoveTemp(Listener->Events);
+		const FListenerEntryPoint EntryPoint = Listener->EntryPoint;
+		void* State = Listener->State;
+
+		DeliveryBuffer.Reset(Events.Num());
+		for (const FPendingEvent& Event : Events)
+		{
+			FCSCollisionEvent& Delivered = DeliveryBuffer.AddUninitialized_GetRef();
+			Delivered.ImpactPoint = Event.ImpactPoint;
+			Delivered.ImpactNormal = Event.ImpactNormal;
+			Delivered.NormalImpulse = Event.NormalImpulse;
+			Delivered.Component = Event.Component.Get();
+			Delivered.OtherComponent = Event.OtherComponent.Get();
+			Delivered.OtherActor = Event.OtherActor.Get();
+			Delivered.OtherBodyIndex = Event.OtherBodyIndex;
+			Delivered.Type = Event.Type;
+			Delivered.bFromSweep = Event.bFromSweep;
+		}
+
+		EntryPoint(State, DeliveryBuffer.GetData(), DeliveryBuffer.Num());
+
+		// Hand the allocation back, so a listener that gets events every frame doesn't reallocate.
+		Listener = Listeners.Find(ListenerId);
+		if (Listener && Listener->Events.IsEmpty())
+		{
+			Events.Reset();
+			Listener->Events = MoveTemp(Events);
+		}
+	}
+}
+
+void UCSCollisionEventSubsystem::HandleHit(UPrimitiveComponent* HitComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, FVector NormalImpulse, const FHitResult& Hit)
+{
+	AddEvent(HitComponent, ECSCollisionEventMask::Hit,
+	{
+		Hit.ImpactPoint,
+		Hit.ImpactNormal,
+		NormalImpulse,
+		HitComponent,
+		OtherComp,
+		OtherActor,
+		Hit.Item,
+		ECSCollisionEventType::Hit,
+		false
+	});
+}
+
+void UCSCollisionEventSubsystem::HandleBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+{
+	AddEvent(OverlappedComponent, ECSCollisionEventMask::BeginOverlap,
+	{
+		bFromSweep ? FVector(SweepResult.ImpactPoint) : FVector::ZeroVector,
+		bFromSweep ? FVector(SweepResult.ImpactNormal) : FVector::ZeroVector,
+		FVector::ZeroVector,
+		OverlappedComponent,
+		OtherComp,
+		OtherActor,
+		OtherBodyIndex,
+		ECSCollisionEventType::BeginOverlap,
+		bFromSweep
+	});
+}
+
+void UCSCollisionEventSubsystem::HandleEndOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
+{
+	AddEvent(OverlappedComponent, ECSCollisionEventMask::EndOverlap,
+	{
+		FVector::ZeroVector,
+		FVector::ZeroVector,
+		FVector::ZeroVector,
+		OverlappedComponent,
+		OtherComp,
+		OtherActor,
+		OtherBodyIndex,
+		ECSCollisionEventType::EndOverlap,
+		false
+	});
+}
+
+void UCSCollisionEventSubsystem::AddEvent(UPrimitiveComponent* Component, ECSCollisionEventMask EventMask, const FPendingEvent& Event)
+{
+	const TArray<FComponentListener, TInlineAllocator<2>>* ListenersOfComponent = ComponentListeners.Find(Component);
+	if (!ListenersOfComponent)
+	{
+		return;
+	}
+
+	for (const FComponentListener& ComponentListener : *ListenersOfComponent)
+	{
+		if (!EnumHasAnyFlags(ComponentListener.Events, EventMask))
+		{
+			continue;
+		}
+
+		if (FListener* Listener = Listeners.Find(ComponentListener.ListenerId))
+		{
+			Listener->Events.Add(Event);
+		}
+	}
+}
+
+void UCSCollisionEventSubsystem::BindComponent(UPrimitiveComponent* Component)
+{
+	Component->OnComponentHit.AddUniqueDynamic(this, &UCSCollisionEventSubsystem::HandleHit);
+	Component->OnComponentBeginOverlap.AddUniqueDynamic(this, &UCSCollisionEventSubsystem::HandleBeginOverlap);
+	Component->OnComponentEndOverlap.AddUniqueDynamic(this, &UCSCollisionEventSubsystem::HandleEndOverlap);
+}
+
+void UCSCollisionEventSubsystem::UnbindComponent(UPrimitiveComponent* Component)
+{
+	if (!Component)
+	{
+		return;
+	}
+
+	Component->OnComponentHit.RemoveDynamic(this, &UCSCollisionEventSubsystem::HandleHit);
+	Component->OnComponentBeginOverlap.RemoveDynamic(this, &UCSCollisionEventSubsystem::HandleBeginOverlap);
+	Component->OnComponentEndOverlap.RemoveDynamic(this, &UCSCollisionEventSubsystem::HandleEndOverlap);
+}
@@ -0,0 +1,121 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "CSCollisionEventSubsystem.generated.h"
+
+class UPrimitiveComponent;
+
+enum class ECSCollisionEventType : uint8
+{
+	Hit,
+	BeginOverlap,
+	EndOverlap,
+};
+
+// Which events a listener wants from a component, mirrors CollisionEventMask in C#.
+enum class ECSCollisionEventMask : uint8
+{
+	None = 0,
+	Hit = 1 << 0,
+	BeginOverlap = 1 << 1,
+	EndOverlap = 1 << 2,
+};
+ENUM_CLASS_FLAGS(ECSCollisionEventMask);
+
+// Mirrors CollisionEvent in C#. The pointers are only valid during the callback the event is delivered in,
+// and are null if the object was destroyed since the event happened.
+struct FCSCollisionEvent
+{
+	FVector ImpactPoint;
+	FVector ImpactNormal;
+	FVector NormalImpulse;
+	UPrimitiveComponent* Component;
+	UPrimitiveComponent* OtherComponent;
+	AActor* OtherActor;
+	int32 OtherBodyIndex;
+	ECSCollisionEventType Type;
+	uint8 bFromSweep;
+};
+
+/**
+ * Collects the hit and overlap events of components for C# listeners, and hands each listener all of its events
+ * of the frame with a single call into C#, after the world has ticked. Instead of one delegate broadcast into C#
+ * per event, each with its FHitResult passed through a script frame.
+ * Hit events still need the component to have Simulation Generates Hit Events on.
+ */
+UCLASS()
+class UCSCollisionEventSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	using FListenerEntryPoint = void(*)(void* State, const FCSCollisionEvent* Events, int32 NumEvents);
+
+	// Returns the id of the listener. State is passed back to the entry point, and is the caller's to free after RemoveListener.
+	int32 AddListener(FListenerEntryPoint EntryPoint, void* State);
+	void RemoveListener(int32 ListenerId);
+
+	void Listen(int32 ListenerId, UPrimitiveComponent* Component, ECSCollisionEventMask Events);
+	void StopListening(int32 ListenerId, UPrimitiveComponent* Component);
+
+	// UTickableWorldSubsystem interface
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return !Listeners.IsEmpty(); }
+	virtual TStatId GetStatId() const override
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(UCSCollisionEventSubsystem, STATGROUP_Tickables);
+	}
+	// End of UTickableWorldSubsystem interface
+
+private:
+
+	UFUNCTION()
+	void HandleHit(UPrimitiveComponent* HitComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, FVector NormalImpulse, const FHitResult& Hit);
+
+	UFUNCTION()
+	void HandleBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
+
+	UFUNCTION()
+	void HandleEndOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex);
+
+	struct FPendingEvent
+	{
+		FVector ImpactPoint;
+		FVector ImpactNormal;
+		FVector NormalImpulse;
+		TWeakObjectPtr<UPrimitiveComponent> Component;
+		TWeakObjectPtr<UPrimitiveComponent> OtherComponent;
+		TWeakObjectPtr<AActor> OtherActor;
+		int32 OtherBodyIndex;
+		ECSCollisionEventType Type;
+		bool bFromSweep;
+	};
+
+	struct FListener
+	{
+		FListenerEntryPoint EntryPoint;
+		void* State;
+		TArray<FPendingEvent> Events;
+	};
+
+	struct FComponentListener
+	{
+		int32 ListenerId;
+		ECSCollisionEventMask Events;
+	};
+
+	void AddEvent(UPrimitiveComponent* Component, ECSCollisionEventMask EventMask, const FPendingEvent& Event);
+	void BindComponent(UPrimitiveComponent* Component);
+	void UnbindComponent(UPrimitiveComponent* Component);
+
+	TMap<int32, FListener> Listeners;
+	TMap<TObjectKey<UPrimitiveComponent>, TArray<FComponentListener, TInlineAllocator<2>>> ComponentListeners;
+	int32 NextListenerId = 1;
+
+	// Reused for every delivery, events are converted into it right before the call.
+	TArray<FCSCollisionEvent> DeliveryBuffer;
+};
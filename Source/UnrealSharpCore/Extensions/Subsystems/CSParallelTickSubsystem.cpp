@@ -0,0 +1,176 @@
+#include "CSParallelTickSubsystem.h"
+#include "CSHandleEpoch.h"
+#include "CSWorldSubsystem.h"
+#include "Tasks/Task.h"
+#include "TypeGenerator/CSClass.h"
+#include "TypeGenerator/Functions/CSFunction.h"
+#include "TypeGenerator/Register/MetaData/CSClassMetaData.h"
+
+namespace
+{
+	const FName ParallelTickFunctionName = TEXT("K2_ParallelTick");
+
+	TSharedPtr<FCSClassMetaData> FindParallelTickMetaData(UClass* Class)
+	{
+		for (const UCSClass* ManagedClass = Cast<UCSClass>(Class); ManagedClass; ManagedClass = Cast<UCSClass>(ManagedClass->GetSuperClass()))
+		{
+			if (!ManagedClass->HasTypeInfo())
+			{
+				continue;
+			}
+
+			TSharedPtr<FCSClassMetaData> ClassMetaData = ManagedClass->GetTypeMetaData<FCSClassMetaData>();
+			if (ClassMetaData->HasMetaData(TEXT("ParallelTick")))
+			{
+				return ClassMetaData;
+			}
+		}
+
+		return nullptr;
+	}
+
+	TArray<FName> ParseResources(const FCSClassMetaData& ClassMetaData, const TCHAR* Key)
+	{
+		TArray<FName> Resources;
+
+		const FString* Value = ClassMetaData.MetaData.Find(Key);
+		if (Value == nullptr)
+		{
+			return Resources;
+		}
+
+		TArray<FString> Names;
+		Value->ParseIntoArray(Names, TEXT(","));
+
+		for (const FString& Name : Names)
+		{
+			Resources.AddUnique(FName(Name.TrimStartAndEnd()));
+		}
+
+		return Resources;
+	}
+
+	bool WritesAny(const TArray<FName>& Writes, const TArray<FName>& Resources)
+	{
+		return Writes.ContainsByPredicate([&Resources](FName Write) { return Resources.Contains(Write); });
+	}
+}
+
+void UCSParallelTickSubsystem::Register(UCSWorldSubsystem* Subsystem)
+{
+	TSharedPtr<FCSClassMetaData> ClassMetaData = FindParallelTickMetaData(Subsystem->GetClass());
+	if (!ClassMetaData.IsValid())
+	{
+		return;
+	}
+
+	FEntry& Entry = Entries.AddDefaulted_GetRef();
+	Entry.Subsystem = Subsystem;
+	Entry.Phase = FCString::Atoi(*ClassMetaData->MetaData[TEXT("ParallelTick")]);
+	Entry.Reads = ParseResources(*ClassMetaData, TEXT("ParallelTickReads"));
+	Entry.Writes = ParseResources(*ClassMetaData, TEXT("ParallelTickWrites"));
+
+	bScheduleDirty = true;
+}
+
+void UCSParallelTickSubsystem::Unregister(UCSWorldSubsystem* Subsystem)
+{
+	if (Entries.RemoveAll([Subsystem](const FEntry& Entry) { return Entry.Subsystem == Subsystem; }) > 0)
+	{
+		bScheduleDirty = true;
+	}
+}
+
+bool UCSParallelTickSubsystem::IsParallelTickClass(UClass* Class)
+{
+	return FindParallelTickMetaData(Class).IsValid();
+}
+
+void UCSParallelTickSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCSParallelTickSubsystem::Tick);
+
+	if (bScheduleDirty)
+	{
+		BuildSchedule();
+	}
+
+	TArray<UE::Tasks::FTask, TInlineAllocator<64>> PhaseTasks;
+	int32 PhaseStart = 0;
+
+	while (PhaseStart < Entries.Num())
+	{
+		const int32 Phase = Entries[PhaseStart].Phase;
+		PhaseTasks.Reset();
+
+		int32 PhaseEnd = PhaseStart;
+		for (; PhaseEnd < Entries.Num() && Entries[PhaseEnd].Phase == Phase; ++PhaseEnd)
+		{
+			const FEntry& Entry = Entries[PhaseEnd];
+
+			TArray<UE::Tasks::FTask, TInlineAllocator<4>> Prerequisites;
+			for (int32 Prerequisite : Entry.Prerequisites)
+			{
+				Prerequisites.Add(PhaseTasks[Prerequisite - PhaseStart]);
+			}
+
+			// Resolved here, the function is replaced when the class is rebuilt.
+			UCSWorldSubsystem* Subsystem = Entry.Subsystem.Get();
+			UCSFunctionBase* TickFunction = Subsystem ? Cast<UCSFunctionBase>(Subsystem->FindFunction(ParallelTickFunctionName)) : nullptr;
+
+			PhaseTasks.Add(UE::Tasks::Launch(TEXT("UnrealSharp.ParallelTick"), [Subsystem, TickFunction, DeltaTime]()
+			{
+				RunEntry(Subsystem, TickFunction, DeltaTime);
+			}, UE::Tasks::Prerequisites(Prerequisites)));
+		}
+
+		UE::Tasks::Wait(PhaseTasks);
+		PhaseStart = PhaseEnd;
+	}
+}
+
+void UCSParallelTickSubsystem::BuildSchedule()
+{
+	Entries.StableSort([](const FEntry& A, const FEntry& B) { return A.Phase < B.Phase; });
+
+	for (int32 i = 0; i < Entries.Num(); ++i)
+	{
+		FEntry& Entry = Entries[i];
+		Entry.Prerequisites.Reset();
+
+		for (int32 j = i - 1; j >= 0 && Entries[j].Phase == Entry.Phase; --j)
+		{
+			const FEntry& Other = Entries[j];
+			if (WritesAny(Other.Writes, Entry.Reads) || WritesAny(Other.Writes, Entry.Writes) || WritesAny(Entry.Writes, Other.Reads))
+			{
+				Entry.Prerequisites.Add(j);
+			}
+		}
+	}
+
+	bScheduleDirty = false;
+}
+
+void UCSParallelTickSubsystem::RunEntry(UCSWorldSubsystem* Subsystem, UCSFunctionBase* TickFunction, float DeltaTime)
+{
+	// Subsystems that don't override ParallelTick have nothing to run.
+	if (Subsystem == nullptr || TickFunction == nullptr)
+	{
+		return;
+	}
+
+	const FFloatProperty* DeltaTimeProperty = CastField<FFloatProperty>(TickFunction->ChildProperties);
+	if (DeltaTimeProperty == nullptr)
+	{
+		return;
+	}
+
+	TArray<uint8, TInlineAllocator<16>> Params;
+	Params.SetNumZeroed(TickFunction->ParmsSize);
+	DeltaTimeProperty->SetPropertyValue_InContainer(Params.GetData(), DeltaTime);
+
+	UObject* Object = Subsystem;
+	FCSHandleEpoch::FReadScope HandleReadScope;
+	TickFunction->InvokeManagedMethodBatch(MakeArrayView(&Object, 1), Params.GetData());
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CSParallelTickSubsystem.generated.h"
+
+class UCSWorldSubsystem;
+class UCSFunctionBase;
+
+/**
+ * Ticks the [ParallelTick] C# world subsystems of a world on task graph workers, instead of each one ticking on its own.
+ * Phases run in ascending order. Within a phase, subsystems run concurrently unless one of them writes a resource
+ * the other reads or writes, then the one registered first runs first. Resources are the names given to
+ * [ParallelTickReads] and [ParallelTickWrites]. Every phase is done before the tick returns.
+ */
+UCLASS()
+class UCSParallelTickSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	void Register(UCSWorldSubsystem* Subsystem);
+	void Unregister(UCSWorldSubsystem* Subsystem);
+
+	// Whether the class of the subsystem, or a managed class it derives from, is marked [ParallelTick].
+	static bool IsParallelTickClass(UClass* Class);
+
+	// UTickableWorldSubsystem interface
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return !Entries.IsEmpty(); }
+	virtual TStatId GetStatId() const override
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(UCSParallelTickSubsystem, STATGROUP_Tickables);
+	}
+	// End of UTickableWorldSubsystem interface
+
+private:
+
+	struct FEntry
+	{
+		TWeakObjectPtr<UCSWorldSubsystem> Subsystem;
+		int32 Phase = 0;
+		TArray<FName> Reads;
+		TArray<FName> Writes;
+
+		// Indices of the entries of the same phase that have to finish before this one runs.
+		TArray<int32> Prerequisites;
+	};
+
+	void BuildSchedule();
+	static void RunEntry(UCSWorldSubsystem* Subsystem, UCSFunctionBase* TickFunction, float DeltaTime);
+
+	TArray<FEntry> Entries;
+	bool bScheduleDirty = false;
+};
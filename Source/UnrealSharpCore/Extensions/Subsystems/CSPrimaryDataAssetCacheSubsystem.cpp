@@ -0,0 +1,213 @@
+#include "CSPrimaryDataAssetCacheSubsystem.h"
+#include "CSUnrealSharpSettings.h"
+#include "Engine/AssetManager.h"
+#include "Engine/Engine.h"
+#include "HAL/IConsoleManager.h"
+
+namespace
+{
+	void DumpDataAssetCache(const TArray<FString>&, UWorld*, FOutputDevice& Ar)
+	{
+		if (const UCSPrimaryDataAssetCacheSubsystem* Cache = GEngine ? GEngine->GetEngineSubsystem<UCSPrimaryDataAssetCacheSubsystem>() : nullptr)
+		{
+			Cache->DumpStats(Ar);
+		}
+	}
+
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice DumpDataAssetCacheCommand(
+		TEXT("UnrealSharp.DataAssetCache"),
+		TEXT("Prints the residency of the primary data asset cache."),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateStatic(&DumpDataAssetCache));
+
+	constexpr int64 BytesPerMB = 1024 * 1024;
+}
+
+void UCSPrimaryDataAssetCacheSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+	BudgetBytes = GetDefault<UCSUnrealSharpSettings>()->PrimaryDataAssetCacheBudgetMB * BytesPerMB;
+	TrimTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UCSPrimaryDataAssetCacheSubsystem::OnTrimTick), 1.0f);
+}
+
+void UCSPrimaryDataAssetCacheSubsystem::Deinitialize()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TrimTickerHandle);
+
+	// The asset manager may already be gone, it unloads everything with it.
+	CachedDataAssets.Empty();
+	ResidentBytes = 0;
+
+	Super::Deinitialize();
+}
+
+void UCSPrimaryDataAssetCacheSubsystem::TrackPrimaryAssets(const TArray<FPrimaryAssetId>& AssetIds)
+{
+	const UAssetManager& AssetManager = UAssetManager::Get();
+	for (const FPrimaryAssetId& AssetId : AssetIds)
+	{
+		if (const UObject* Asset = AssetManager.GetPrimaryAssetObject(AssetId))
+		{
+			Track(AssetId, Asset);
+		}
+	}
+
+	Trim();
+}
+
+UObject* UCSPrimaryDataAssetCacheSubsystem::GetDataAsset(FPrimaryAssetId AssetId)
+{
+	UObject* Asset = UAssetManager::Get().GetPrimaryAssetObject(AssetId);
+	FCachedDataAsset* CachedDataAsset = CachedDataAssets.Find(AssetId);
+
+	if (!Asset)
+	{
+		if (CachedDataAsset)
+		{
+			// Unloaded behind our back.
+			ResidentBytes -= CachedDataAsset->SizeBytes;
+			CachedDataAssets.Remove(AssetId);
+		}
+
+		++NumMisses;
+		return nullptr;
+	}
+
+	++NumHits;
+
+	if (CachedDataAsset)
+	{
+		CachedDataAsset->LastUsedFrame = GFrameCounter;
+	}
+
+	return Asset;
+}
+
+void UCSPrimaryDataAssetCacheSubsystem::ReleaseDataAsset(FPrimaryAssetId AssetId)
+{
+	if (CachedDataAssets.Contains(AssetId))
+	{
+		Release(AssetId);
+	}
+}
+
+void UCSPrimaryDataAssetCacheSubsystem::ReleaseAll(FPrimaryAssetType AssetType)
+{
+	TArray<FPrimaryAssetId> AssetIds;
+	for (const TPair<FPrimaryAssetId, FCachedDataAsset>& CachedDataAsset : CachedDataAssets)
+	{
+		if (!AssetType.IsValid() || CachedDataAsset.Key.PrimaryAssetType == AssetType)
+		{
+			AssetIds.Add(CachedDataAsset.Key);
+		}
+	}
+
+	for (const FPrimaryAssetId& AssetId : AssetIds)
+	{
+		Release(AssetId);
+	}
+}
+
+void UCSPrimaryDataAssetCacheSubsystem::SetMemoryBudgetMB(int32 BudgetMB)
+{
+	BudgetBytes = FMath::Max(BudgetMB, 0) * BytesPerMB;
+	Trim();
+}
+
+void UCSPrimaryDataAssetCacheSubsystem::Trim()
+{
+	if (BudgetBytes <= 0 || ResidentBytes <= BudgetBytes)
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCSPrimaryDataAssetCacheSubsystem::Trim);
+
+	TArray<TPair<uint64, FPrimaryAssetId>> EvictionOrder;
+	EvictionOrder.Reserve(CachedDataAssets.Num());
+
+	for (const TPair<FPrimaryAssetId, FCachedDataAsset>& CachedDataAsset : CachedDataAssets)
+	{
+		if (CachedDataAsset.Value.LastUsedFrame < GFrameCounter)
+		{
+			EvictionOrder.Emplace(CachedDataAsset.Value.LastUsedFrame, CachedDataAsset.Key);
+		}
+	}
+
+	EvictionOrder.Sort([](const TPair<uint64, FPrimaryAssetId>& A, const TPair<uint64, FPrimaryAssetId>& B)
+	{
+		return A.Key < B.Key;
+	});
+
+	for (const TPair<uint64, FPrimaryAssetId>& Candidate : EvictionOrder)
+	{
+		if (ResidentBytes <= BudgetBytes)
+		{
+			break;
+		}
+
+		Release(Candidate.Value);
+		++NumEvicted;
+	}
+}
+
+bool UCSPrimaryDataAssetCacheSubsystem::OnTrimTick(float DeltaTime)
+{
+	// Picks up what was tracked and used in the same frame, which Trim had to leave alone.
+	Trim();
+	return true;
+}
+
+FCSPrimaryDataAssetCacheStats UCSPrimaryDataAssetCacheSubsystem::GetStats() const
+{
+	FCSPrimaryDataAssetCacheStats Stats;
+	Stats.NumResident = CachedDataAssets.Num();
+	Stats.ResidentBytes = ResidentBytes;
+	Stats.BudgetBytes = BudgetBytes;
+	Stats.NumHits = NumHits;
+	Stats.NumMisses = NumMisses;
+	Stats.NumEvicted = NumEvicted;
+	return Stats;
+}
+
+void UCSPrimaryDataAssetCacheSubsystem::DumpStats(FOutputDevice& Ar) const
+{
+	Ar.Logf(TEXT("%d data assets resident, %.1f MB of %s"), CachedDataAssets.Num(), ResidentBytes / static_cast<double>(BytesPerMB),
+		BudgetBytes > 0 ? *FString::Printf(TEXT("%.1f MB"), BudgetBytes / static_cast<double>(BytesPerMB)) : TEXT("no budget"));
+	Ar.Logf(TEXT("%d hits, %d misses, %d evicted"), NumHits, NumMisses, NumEvicted);
+
+	TMap<FPrimaryAssetType, TPair<int32, int64>> PerType;
+	for (const TPair<FPrimaryAssetId, FCachedDataAsset>& CachedDataAsset : CachedDataAssets)
+	{
+		TPair<int32, int64>& TypeStats = PerType.FindOrAdd(CachedDataAsset.Key.PrimaryAssetType);
+		++TypeStats.Key;
+		TypeStats.Value += CachedDataAsset.Value.SizeBytes;
+	}
+
+	for (const TPair<FPrimaryAssetType, TPair<int32, int64>>& TypeStats : PerType)
+	{
+		Ar.Logf(TEXT("  %-40s %7d assets %10.1f KB"), *TypeStats.Key.ToString(), TypeStats.Value.Key, TypeStats.Value.Value / 1024.0);
+	}
+}
+
+void UCSPrimaryDataAssetCacheSubsystem::Track(const FPrimaryAssetId& AssetId, const UObject* Asset)
+{
+	FCachedDataAsset& CachedDataAsset = CachedDataAssets.FindOrAdd(AssetId);
+	if (CachedDataAsset.SizeBytes == 0)
+	{
+		CachedDataAsset.SizeBytes = FMath::Max<int64>(Asset->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal), 1);
+		ResidentBytes += CachedDataAsset.SizeBytes;
+	}
+
+	CachedDataAsset.LastUsedFrame = GFrameCounter;
+}
+
+void UCSPrimaryDataAssetCacheSubsystem::Release(const FPrimaryAssetId& AssetId)
+{
+	FCachedDataAsset CachedDataAsset;
+	if (CachedDataAssets.RemoveAndCopyValue(AssetId, CachedDataAsset))
+	{
+		ResidentBytes -= CachedDataAsset.SizeBytes;
+	}
+
+	UAssetManager::Get().UnloadPrimaryAsset(AssetId);
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "CSPrimaryDataAssetCacheSubsystem.generated.h"
+
+USTRUCT()
+struct FCSPrimaryDataAssetCacheStats
+{
+	GENERATED_BODY()
+
+	// Data assets the cache keeps loaded.
+	UPROPERTY()
+	int32 NumResident = 0;
+
+	// Estimated size of the resident data assets and their subobjects. Assets loaded for their bundles aren't counted.
+	UPROPERTY()
+	int64 ResidentBytes = 0;
+
+	// 0 when there is no budget.
+	UPROPERTY()
+	int64 BudgetBytes = 0;
+
+	// Lookups through GetDataAsset that found the data asset loaded, and ones that didn't.
+	UPROPERTY()
+	int32 NumHits = 0;
+
+	UPROPERTY()
+	int32 NumMisses = 0;
+
+	// Data assets unloaded to stay within the budget.
+	UPROPERTY()
+	int32 NumEvicted = 0;
+};
+
+/**
+ * Keeps primary data assets loaded through the asset manager within a memory budget. Data assets that were preloaded
+ * or tracked are unloaded least recently used first once the budget is exceeded, lookups through GetDataAsset mark
+ * them as used. Data assets used in the current frame are never evicted, the budget is enforced again once per second.
+ * C# should preload through PreloadAsync on the managed side, which loads with the asset manager and tracks the result.
+ */
+UCLASS()
+class UNREALSHARPCORE_API UCSPrimaryDataAssetCacheSubsystem : public UEngineSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	// UEngineSubsystem interface
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	// End of UEngineSubsystem interface
+
+	// Starts tracking loaded primary assets, and evicts others if they went over the budget. Assets that aren't loaded are ignored.
+	UFUNCTION()
+	void TrackPrimaryAssets(const TArray<FPrimaryAssetId>& AssetIds);
+
+	// The data asset if it's loaded, marking it as used if it's tracked.
+	UFUNCTION()
+	UObject* GetDataAsset(FPrimaryAssetId AssetId);
+
+	// Unloads a tracked data asset right away.
+	UFUNCTION()
+	void ReleaseDataAsset(FPrimaryAssetId AssetId);
+
+	// Unloads every tracked data asset of the type, or all of them when the type is invalid.
+	UFUNCTION()
+	void ReleaseAll(FPrimaryAssetType AssetType);
+
+	// Overrides PrimaryDataAssetCacheBudgetMB of the settings. 0 removes the budget.
+	UFUNCTION()
+	void SetMemoryBudgetMB(int32 BudgetMB);
+
+	// Evicts least recently used data assets until the cache is within its budget.
+	UFUNCTION()
+	void Trim();
+
+	UFUNCTION()
+	FCSPrimaryDataAssetCacheStats GetStats() const;
+
+	void DumpStats(FOutputDevice& Ar) const;
+
+private:
+
+	struct FCachedDataAsset
+	{
+		int64 SizeBytes = 0;
+		uint64 LastUsedFrame = 0;
+	};
+
+	bool OnTrimTick(float DeltaTime);
+
+	void Track(const FPrimaryAssetId& AssetId, const UObject* Asset);
+	void Release(const FPrimaryAssetId& AssetId);
+
+	TMap<FPrimaryAssetId, FCachedDataAsset> CachedDataAssets;
+	int64 ResidentBytes = 0;
+	int64 BudgetBytes = 0;
+
+	FTSTicker::FDelegateHandle TrimTickerHandle;
+
+	int32 NumHits = 0;
+	int32 NumMisses = 0;
+	int32 NumEvicted = 0;
+};
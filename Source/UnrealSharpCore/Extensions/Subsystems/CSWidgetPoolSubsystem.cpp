@@ -0,0 +1,122 @@
+#include "CSWidgetPoolSubsystem.h"
+#include "CSManager.h"
+#include "Blueprint/UserWidget.h"
+#include "Blueprint/WidgetBlueprintLibrary.h"
+#include "Engine/World.h"
+#include "UnrealSharpCore.h"
+
+bool UCSWidgetPoolSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	const UWorld* World = Cast<UWorld>(Outer);
+	return World && World->IsGameWorld();
+}
+
+void UCSWidgetPoolSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	UCSManager& Manager = UCSManager::Get();
+	OnNewClassHandle = Manager.OnNewClassEvent().AddUObject(this, &UCSWidgetPoolSubsystem::OnClassRebuilt);
+	OnAssembliesLoadedHandle = Manager.OnAssembliesLoadedEvent().AddUObject(this, &UCSWidgetPoolSubsystem::Flush);
+}
+
+void UCSWidgetPoolSubsystem::Deinitialize()
+{
+	UCSManager& Manager = UCSManager::Get();
+	Manager.OnNewClassEvent().Remove(OnNewClassHandle);
+	Manager.OnAssembliesLoadedEvent().Remove(OnAssembliesLoadedHandle);
+
+	PooledWidgets.Empty();
+
+	Super::Deinitialize();
+}
+
+UUserWidget* UCSWidgetPoolSubsystem::AcquireWidget(TSubclassOf<UUserWidget> Class, APlayerController* OwningController)
+{
+	if (FCSPooledWidgets* Pool = PooledWidgets.Find(Class))
+	{
+		while (!Pool->Widgets.IsEmpty())
+		{
+			UUserWidget* Widget = Pool->Widgets.Pop();
+			if (!IsValid(Widget))
+			{
+				continue;
+			}
+
+			if (OwningController)
+			{
+				Widget->SetOwningPlayer(OwningController);
+			}
+
+			return Widget;
+		}
+	}
+
+	return UWidgetBlueprintLibrary::Create(GetWorld(), Class, OwningController);
+}
+
+bool UCSWidgetPoolSubsystem::ReleaseWidget(UUserWidget* Widget)
+{
+	if (!IsValid(Widget))
+	{
+		return false;
+	}
+
+	Widget->RemoveFromParent();
+
+	FCSPooledWidgets& Pool = PooledWidgets.FindOrAdd(Widget->GetClass());
+	if (Pool.Widgets.Num() >= MaxPooledPerClass)
+	{
+		return false;
+	}
+
+	if (Pool.Widgets.Contains(Widget))
+	{
+		UE_LOG(LogUnrealSharp, Warning, TEXT("%s was released to the widget pool twice"), *Widget->GetName());
+		return true;
+	}
+
+	Pool.Widgets.Add(Widget);
+	return true;
+}
+
+void UCSWidgetPoolSubsystem::Prewarm(TSubclassOf<UUserWidget> Class, APlayerController* OwningController, int32 Count)
+{
+	if (!IsValid(Class))
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCSWidgetPoolSubsystem::Prewarm);
+
+	const int32 NumToCreate = FMath::Min(Count, MaxPooledPerClass) - GetNumPooledWidgets(Class);
+	for (int32 i = 0; i < NumToCreate; ++i)
+	{
+		if (UUserWidget* Widget = UWidgetBlueprintLibrary::Create(GetWorld(), Class, OwningController))
+		{
+			ReleaseWidget(Widget);
+		}
+	}
+}
+
+int32 UCSWidgetPoolSubsystem::GetNumPooledWidgets(TSubclassOf<UUserWidget> Class) const
+{
+	const FCSPooledWidgets* Pool = PooledWidgets.Find(Class);
+	return Pool ? Pool->Widgets.Num() : 0;
+}
+
+void UCSWidgetPoolSubsystem::Flush()
+{
+	PooledWidgets.Empty();
+}
+
+void UCSWidgetPoolSubsystem::OnClassRebuilt(UCSClass* Class)
+{
+	for (auto It = PooledWidgets.CreateIterator(); It; ++It)
+	{
+		if (!It->Key || It->Key->IsChildOf(Class))
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CSWidgetPoolSubsystem.generated.h"
+
+class UCSClass;
+class UUserWidget;
+
+USTRUCT()
+struct FCSPooledWidgets
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<TObjectPtr<UUserWidget>> Widgets;
+};
+
+/**
+ * Keeps released user widgets around for reuse, so list entries and damage numbers don't construct a new widget
+ * tree and Slate widget for every use. Widgets are pooled per class, C# resets them in OnAcquire/OnRelease.
+ * Pooled widgets of a class are dropped when the class is rebuilt or the assemblies reload.
+ * C# should go through Acquire/Release on the managed side, which run the hooks around these.
+ */
+UCLASS()
+class UCSWidgetPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	// UWorldSubsystem interface
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	// End of UWorldSubsystem interface
+
+	// Reuses a pooled widget of exactly this class when there is one, otherwise creates a new one.
+	UFUNCTION()
+	UUserWidget* AcquireWidget(TSubclassOf<UUserWidget> Class, APlayerController* OwningController);
+
+	// Removes the widget from its parent and keeps it until it's acquired again.
+	// Returns false when the pool for its class is full, the widget is then left to the garbage collector.
+	UFUNCTION()
+	bool ReleaseWidget(UUserWidget* Widget);
+
+	// Creates widgets until the pool for the class holds Count of them.
+	UFUNCTION()
+	void Prewarm(TSubclassOf<UUserWidget> Class, APlayerController* OwningController, int32 Count);
+
+	UFUNCTION()
+	int32 GetNumPooledWidgets(TSubclassOf<UUserWidget> Class) const;
+
+	// Drops everything in the pool.
+	UFUNCTION()
+	void Flush();
+
+	UPROPERTY()
+	int32 MaxPooledPerClass = 128;
+
+private:
+
+	void OnClassRebuilt(UCSClass* Class);
+
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<UClass>, FCSPooledWidgets> PooledWidgets;
+
+	FDelegateHandle OnNewClassHandle;
+	FDelegateHandle OnAssembliesLoadedHandle;
+};
@@ -1,4 +1,5 @@
 #include "CSWorldSubsystem.h"
+#include "CSParallelTickSubsystem.h"
 #include "SubsystemUtils.h"
 
 bool UCSWorldSubsystem::K2_ShouldCreateSubsystem_Implementation() const
@@ -31,3 +32,26 @@ bool UCSWorldSubsystem::K2_DoesSupportWorldType_Implementation(const ECSWorldTyp
 {
     return true;
 }
+
+void UCSWorldSubsystem::RegisterParallelTick(FSubsystemCollectionBase& Collection)
+{
+	if (!UCSParallelTickSubsystem::IsParallelTickClass(GetClass()))
+	{
+		return;
+	}
+
+	ParallelTickSubsystem = Collection.InitializeDependency<UCSParallelTickSubsystem>();
+	if (ParallelTickSubsystem)
+	{
+		ParallelTickSubsystem->Register(this);
+	}
+}
+
+void UCSWorldSubsystem::UnregisterParallelTick()
+{
+	if (ParallelTickSubsystem)
+	{
+		ParallelTickSubsystem->Unregister(this);
+		ParallelTickSubsystem = nullptr;
+	}
+}
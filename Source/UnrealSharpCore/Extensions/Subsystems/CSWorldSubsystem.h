@@ -8,6 +8,8 @@
 #include "Subsystems/WorldSubsystem.h"
 #include "CSWorldSubsystem.generated.h"
 
+class UCSParallelTickSubsystem;
+
 UENUM(BlueprintType)
 enum class ECSWorldType : uint8
 {
@@ -50,6 +52,7 @@ class UCSWorldSubsystem : public UTickableWorldSubsystem
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override
 	{
 		Super::Initialize(Collection);
+		RegisterParallelTick(Collection);
 		K2_Initialize(Collection);
 	}
 
@@ -57,6 +60,7 @@ class UCSWorldSubsystem : public UTickableWorldSubsystem
 	{
 		if (IsInitialized())
 		{
+			UnregisterParallelTick();
 			Super::Deinitialize();
 			K2_Deinitialize();
 		}
@@ -126,7 +130,12 @@ class UCSWorldSubsystem : public UTickableWorldSubsystem
 	virtual void Tick(float DeltaTime) override
 	{
 		Super::Tick(DeltaTime);
-		K2_Tick(DeltaTime);
+
+		// [ParallelTick] subsystems are ticked by UCSParallelTickSubsystem instead.
+		if (!ParallelTickSubsystem)
+		{
+			K2_Tick(DeltaTime);
+		}
 	}
 
 	// End
@@ -143,6 +152,10 @@ protected:
 	UFUNCTION(BlueprintImplementableEvent, meta = (ScriptName = "Tick"), Category = "Managed Subsystems")
 	void K2_Tick(float DeltaTime);
 
+	// Called on a task graph worker instead of Tick when the subsystem is marked [ParallelTick].
+	UFUNCTION(BlueprintImplementableEvent, meta = (ScriptName = "ParallelTick"), Category = "Managed Subsystems")
+	void K2_ParallelTick(float DeltaTime);
+
 	UFUNCTION(BlueprintImplementableEvent, meta = (ScriptName = "OnWorldBeginPlay"), Category = "Managed Subsystems")
 	void K2_OnWorldBeginPlay();
 
@@ -164,4 +177,12 @@ protected:
 	UFUNCTION(BlueprintImplementableEvent, meta = (ScriptName = "Deinitialize"), Category = "Managed Subsystems")
 	void K2_Deinitialize();
 
+private:
+
+	void RegisterParallelTick(FSubsystemCollectionBase& Collection);
+	void UnregisterParallelTick();
+
+	UPROPERTY(Transient)
+	TObjectPtr<UCSParallelTickSubsystem> ParallelTickSubsystem;
+
 };
@@ -142,7 +142,7 @@ FGCHandle FCSGCOptimizationManager::CreateOptimizedGCHandle(const UObject* Objec
         {
             UE_LOG(LogTemp, VeryVerbose, TEXT("CSGCOptimizationManager: Created optimized handle for %s (Handle Type: %s, Time: %.4fms)"), 
                    Object ? *Object->GetClass()->GetName() : TEXT("NULL"),
-                   *UCSObjectManager::GetHandleTypeName(OptimizedHandle.Type),
+                   *UCSObjectManager::GetHandleTypeName(OptimizedHandle.GetType()),
                    TimeSaved * 1000.0);
         }
 
@@ -1,8 +1,83 @@
 ﻿#include "CSGCPressureMonitor.h"
+#include "CSManagedCallbacksCache.h"
+#include "CSSharedBufferSlab.h"
 #include "Engine/Engine.h"
 #include "HAL/PlatformMemory.h"
+#include "ProfilingDebugging/CsvProfiler.h"
 #include "Stats/Stats.h"
 
+#if UNREALSHARP_WITH_DIAGNOSTICS
+CSV_DEFINE_CATEGORY(UnrealSharpGC, true);
+
+DECLARE_STATS_GROUP(TEXT("UnrealSharp GC"), STATGROUP_UnrealSharpGC, STATCAT_Advanced);
+DECLARE_MEMORY_STAT(TEXT("Managed Heap Size"), STAT_ManagedHeapSize, STATGROUP_UnrealSharpGC);
+DECLARE_MEMORY_STAT(TEXT("Managed Fragmented"), STAT_ManagedFragmented, STATGROUP_UnrealSharpGC);
+DECLARE_MEMORY_STAT(TEXT("Managed Committed"), STAT_ManagedCommitted, STATGROUP_UnrealSharpGC);
+DECLARE_MEMORY_STAT(TEXT("Managed Gen0"), STAT_ManagedGen0, STATGROUP_UnrealSharpGC);
+DECLARE_MEMORY_STAT(TEXT("Managed Gen1"), STAT_ManagedGen1, STATGROUP_UnrealSharpGC);
+DECLARE_MEMORY_STAT(TEXT("Managed Gen2"), STAT_ManagedGen2, STATGROUP_UnrealSharpGC);
+DECLARE_MEMORY_STAT(TEXT("Managed Large Object Heap"), STAT_ManagedLOH, STATGROUP_UnrealSharpGC);
+DECLARE_MEMORY_STAT(TEXT("Managed Pinned Object Heap"), STAT_ManagedPOH, STATGROUP_UnrealSharpGC);
+DECLARE_MEMORY_STAT(TEXT("Shared Buffers"), STAT_SharedBufferMemory, STATGROUP_UnrealSharpGC);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Shared Buffer Count"), STAT_SharedBufferCount, STATGROUP_UnrealSharpGC);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Managed Allocation Rate (MB/s)"), STAT_ManagedAllocationRate, STATGROUP_UnrealSharpGC);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Managed GC Pause This Frame (ms)"), STAT_ManagedFramePause, STATGROUP_UnrealSharpGC);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Managed GC Pause Time %"), STAT_ManagedPauseTimePercentage, STATGROUP_UnrealSharpGC);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Managed Gen0 Collections"), STAT_ManagedGen0Collections, STATGROUP_UnrealSharpGC);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Managed Gen1 Collections"), STAT_ManagedGen1Collections, STATGROUP_UnrealSharpGC);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Managed Gen2 Collections"), STAT_ManagedGen2Collections, STATGROUP_UnrealSharpGC);
+#endif
+
+// 静态成员初始化
+std::atomic<int32> FCSGCPressureMonitor::TotalManagedObjects{0};
+std::atomic<int32> FCSGCPressureMonitor::StrongHandles{0};
+std::atomic<int32> FCSGCPressureMonitor::WeakHandles{0};
+std::atomic<int32> FCSGCPressureMonitor::PinnedHandles{0};
+std::atomic<int32> FCSGCPressureMonitor::OrphanedHandles{0};
+std::atomic<int32> FCSGCPressureMonitor::SharedBuffers{0};
+std::atomic<int64> FCSGCPressureMonitor::SharedBufferBytes{0};
+
+FDateTime FCSGCPressureMonitor::LastMonitoringTime = FDateTime::UtcNow();
+FDateTime FCSGCPressureMonitor::LastCleanupTime = FDateTime::UtcNow();
+FCriticalSection FCSGCPressureMonitor::CountersMutex;
+TArray<FCSGCPressureMonitor::FGCStats> FCSGCPressureMonitor::StatsHistory;
+FCSManagedGCMemoryInfo FCSGCPressureMonitor::LastManagedMemoryInfo;
+double FCSGCPressureMonitor::LastManagedSampleTime = 0.0;
+double FCSGCPressureMonitor::ManagedAllocationRateMBPerSecond = 0.0;
+
+#if UNREALSHARP_WITH_DIAGNOSTICS
+namespace
+{
+    // 所有线程的计数分片。分片只在线程首次计数时注册，线程退出时把计数并入RetiredCounters后注销
+    FCriticalSection ShardRegistryLock;
+    TArray<FCSGCPressureMonitor::FTypeCounterShard*> TypeCounterShards;
+    TMap<TObjectKey<UClass>, int32> RetiredCounters;
+
+    struct FRegisteredShard
+    {
+        FCSGCPressureMonitor::FTypeCounterShard Shard;
+
+        FRegisteredShard()
+        {
+            FScopeLock RegistryLock(&ShardRegistryLock);
+            TypeCounterShards.Add(&Shard);
+        }
+
+        ~FRegisteredShard()
+        {
+            FScopeLock RegistryLock(&ShardRegistryLock);
+            TypeCounterShards.RemoveSingleSwap(&Shard);
+
+            FScopeLock Lock(&Shard.Lock);
+            for (const TPair<TObjectKey<UClass>, int32>& Pair : Shard.Counters)
+            {
+                RetiredCounters.FindOrAdd(Pair.Key) += Pair.Value;
+            }
+        }
+    };
+}
+#endif
+
 void FCSGCPressureMonitor::Initialize()
 {
     UE_LOG(LogTemp, Log, TEXT("CSGCPressureMonitor: Initializing GC pressure monitoring system"));
@@ -15,9 +90,9 @@ void FCSGCPressureMonitor::Initialize()
     OrphanedHandles.store(0);
     
     // 清理历史数据
+    ResetTypeCounters();
     {
         FScopeLock Lock(&CountersMutex);
-        ObjectTypeCounters.Empty();
         StatsHistory.Empty();
     }
     
@@ -36,14 +111,51 @@ void FCSGCPressureMonitor::Shutdown()
     UE_LOG(LogTemp, Log, TEXT("CSGCPressureMonitor: Final Report:\n%s"), *FinalReport);
     
     // 清理资源
+    ResetTypeCounters();
     {
         FScopeLock Lock(&CountersMutex);
-        ObjectTypeCounters.Empty();
         StatsHistory.Empty();
     }
 }
 
-void FCSGCPressureMonitor::IncrementManagedObject(const FString& ObjectType, GCHandleType HandleType)
+#if UNREALSHARP_WITH_DIAGNOSTICS
+FCSGCPressureMonitor::FTypeCounterShard& FCSGCPressureMonitor::GetThreadTypeCounterShard()
+{
+    static thread_local FRegisteredShard ThreadShard;
+    return ThreadShard.Shard;
+}
+#endif
+
+void FCSGCPressureMonitor::AddToTypeCounter(const UClass* Class, int32 Delta)
+{
+#if UNREALSHARP_WITH_DIAGNOSTICS
+    if (!Class)
+    {
+        return;
+    }
+
+    // 只有汇总时才会有其他线程获取这把锁，平时总是无争用的
+    FTypeCounterShard& Shard = GetThreadTypeCounterShard();
+    FScopeLock Lock(&Shard.Lock);
+    Shard.Counters.FindOrAdd(TObjectKey<UClass>(Class)) += Delta;
+#endif
+}
+
+void FCSGCPressureMonitor::ResetTypeCounters()
+{
+#if UNREALSHARP_WITH_DIAGNOSTICS
+    FScopeLock RegistryLock(&ShardRegistryLock);
+    RetiredCounters.Empty();
+
+    for (FTypeCounterShard* Shard : TypeCounterShards)
+    {
+        FScopeLock Lock(&Shard->Lock);
+        Shard->Counters.Empty();
+    }
+#endif
+}
+
+void FCSGCPressureMonitor::IncrementManagedObject(const UClass* ObjectClass, GCHandleType HandleType)
 {
     TotalManagedObjects.fetch_add(1, std::memory_order_relaxed);
     
@@ -63,16 +175,13 @@ void FCSGCPressureMonitor::IncrementManagedObject(const FString& ObjectType, GCH
     }
     
     // 更新对象类型计数
-    {
-        FScopeLock Lock(&CountersMutex);
-        ObjectTypeCounters.FindOrAdd(ObjectType)++;
-    }
+    AddToTypeCounter(ObjectClass, 1);
     
     UE_LOG(LogTemp, VeryVerbose, TEXT("CSGCPressureMonitor: Object created - Type: %s, Handle: %d, Total: %d"), 
-           *ObjectType, (int32)HandleType, TotalManagedObjects.load());
+           *GetNameSafe(ObjectClass), (int32)HandleType, TotalManagedObjects.load());
 }
 
-void FCSGCPressureMonitor::DecrementManagedObject(const FString& ObjectType, GCHandleType HandleType)
+void FCSGCPressureMonitor::DecrementManagedObject(const UClass* ObjectClass, GCHandleType HandleType)
 {
     TotalManagedObjects.fetch_sub(1, std::memory_order_relaxed);
     
@@ -91,21 +200,90 @@ void FCSGCPressureMonitor::DecrementManagedObject(const FString& ObjectType, GCH
             break;
     }
     
-    // 更新对象类型计数
-    {
-        FScopeLock Lock(&CountersMutex);
-        if (int32* Count = ObjectTypeCounters.Find(ObjectType))
-        {
-            (*Count)--;
-            if (*Count <= 0)
-            {
-                ObjectTypeCounters.Remove(ObjectType);
-            }
-        }
-    }
+    // 更新对象类型计数。对象可能在另一个线程上创建，该分片的计数会为负，汇总时抵消
+    AddToTypeCounter(ObjectClass, -1);
     
     UE_LOG(LogTemp, VeryVerbose, TEXT("CSGCPressureMonitor: Object destroyed - Type: %s, Handle: %d, Total: %d"), 
-           *ObjectType, (int32)HandleType, TotalManagedObjects.load());
+           *GetNameSafe(ObjectClass), (int32)HandleType, TotalManagedObjects.load());
+}
+
+void FCSGCPressureMonitor::TrackSharedBuffer(int64 CapacityBytes)
+{
+    SharedBuffers.fetch_add(1, std::memory_order_relaxed);
+    SharedBufferBytes.fetch_add(CapacityBytes, std::memory_order_relaxed);
+}
+
+void FCSGCPressureMonitor::UntrackSharedBuffer(int64 CapacityBytes)
+{
+    SharedBuffers.fetch_sub(1, std::memory_order_relaxed);
+    SharedBufferBytes.fetch_sub(CapacityBytes, std::memory_order_relaxed);
+}
+
+void FCSGCPressureMonitor::SampleManagedMemory()
+{
+    // 托管堆采样只用于统计和诊断报告，压力等级只取决于句柄计数
+#if UNREALSHARP_WITH_DIAGNOSTICS
+    SET_MEMORY_STAT(STAT_SharedBufferMemory, SharedBufferBytes.load(std::memory_order_relaxed));
+    SET_DWORD_STAT(STAT_SharedBufferCount, SharedBuffers.load(std::memory_order_relaxed));
+
+    // 托管运行时初始化之前回调为空
+    if (!FCSManagedCallbacks::ManagedCallbacks.GetGCMemoryInfo)
+    {
+        return;
+    }
+
+    check(IsInGameThread());
+
+    FCSManagedGCMemoryInfo Info;
+    FCSManagedCallbacks::ManagedCallbacks.GetGCMemoryInfo(&Info);
+
+    const double Now = FPlatformTime::Seconds();
+    const bool bHasPreviousSample = LastManagedSampleTime > 0.0;
+    const double DeltaSeconds = Now - LastManagedSampleTime;
+
+    // 本帧内的分配量、暂停时间和回收次数
+    const int64 FrameAllocatedBytes = bHasPreviousSample ? Info.TotalAllocatedBytes - LastManagedMemoryInfo.TotalAllocatedBytes : 0;
+    const double FramePauseMs = bHasPreviousSample ? Info.TotalPauseMilliseconds - LastManagedMemoryInfo.TotalPauseMilliseconds : 0.0;
+    const int32 FrameGen0Collections = bHasPreviousSample ? Info.Gen0Collections - LastManagedMemoryInfo.Gen0Collections : 0;
+    const int32 FrameGen2Collections = bHasPreviousSample ? Info.Gen2Collections - LastManagedMemoryInfo.Gen2Collections : 0;
+
+    if (bHasPreviousSample && DeltaSeconds > 0.0)
+    {
+        ManagedAllocationRateMBPerSecond = FrameAllocatedBytes / (1024.0 * 1024.0) / DeltaSeconds;
+    }
+
+    LastManagedMemoryInfo = Info;
+    LastManagedSampleTime = Now;
+
+    constexpr double BytesToMB = 1.0 / (1024.0 * 1024.0);
+    CSV_CUSTOM_STAT(UnrealSharpGC, HeapSizeMB, Info.HeapSizeBytes * BytesToMB, ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(UnrealSharpGC, FragmentedMB, Info.FragmentedBytes * BytesToMB, ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(UnrealSharpGC, CommittedMB, Info.CommittedBytes * BytesToMB, ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(UnrealSharpGC, Gen0MB, Info.Gen0SizeBytes * BytesToMB, ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(UnrealSharpGC, Gen1MB, Info.Gen1SizeBytes * BytesToMB, ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(UnrealSharpGC, Gen2MB, Info.Gen2SizeBytes * BytesToMB, ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(UnrealSharpGC, LOHMB, Info.LargeObjectHeapSizeBytes * BytesToMB, ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(UnrealSharpGC, POHMB, Info.PinnedObjectHeapSizeBytes * BytesToMB, ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(UnrealSharpGC, AllocatedMB, FrameAllocatedBytes * BytesToMB, ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(UnrealSharpGC, PauseMs, FramePauseMs, ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(UnrealSharpGC, Gen0Collections, FrameGen0Collections, ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(UnrealSharpGC, Gen2Collections, FrameGen2Collections, ECsvCustomStatOp::Set);
+
+    SET_MEMORY_STAT(STAT_ManagedHeapSize, Info.HeapSizeBytes);
+    SET_MEMORY_STAT(STAT_ManagedFragmented, Info.FragmentedBytes);
+    SET_MEMORY_STAT(STAT_ManagedCommitted, Info.CommittedBytes);
+    SET_MEMORY_STAT(STAT_ManagedGen0, Info.Gen0SizeBytes);
+    SET_MEMORY_STAT(STAT_ManagedGen1, Info.Gen1SizeBytes);
+    SET_MEMORY_STAT(STAT_ManagedGen2, Info.Gen2SizeBytes);
+    SET_MEMORY_STAT(STAT_ManagedLOH, Info.LargeObjectHeapSizeBytes);
+    SET_MEMORY_STAT(STAT_ManagedPOH, Info.PinnedObjectHeapSizeBytes);
+    SET_FLOAT_STAT(STAT_ManagedAllocationRate, ManagedAllocationRateMBPerSecond);
+    SET_FLOAT_STAT(STAT_ManagedFramePause, FramePauseMs);
+    SET_FLOAT_STAT(STAT_ManagedPauseTimePercentage, Info.PauseTimePercentage);
+    SET_DWORD_STAT(STAT_ManagedGen0Collections, Info.Gen0Collections);
+    SET_DWORD_STAT(STAT_ManagedGen1Collections, Info.Gen1Collections);
+    SET_DWORD_STAT(STAT_ManagedGen2Collections, Info.Gen2Collections);
+#endif
 }
 
 void FCSGCPressureMonitor::MarkOrphanedHandle()
@@ -147,6 +325,25 @@ FCSGCPressureMonitor::FGCStats FCSGCPressureMonitor::GetCurrentGCStatistics()
     // 计算内存压力
     FPlatformMemoryStats MemStats = FPlatformMemory::GetStats();
     Stats.MemoryPressureMB = (MemStats.UsedPhysical - MemStats.AvailablePhysical) / (1024.0 * 1024.0);
+
+    // 托管堆数据
+    constexpr double BytesToMB = 1.0 / (1024.0 * 1024.0);
+    const FCSManagedGCMemoryInfo& ManagedInfo = LastManagedMemoryInfo;
+    Stats.ManagedHeapSizeMB = ManagedInfo.HeapSizeBytes * BytesToMB;
+    Stats.ManagedFragmentedMB = ManagedInfo.FragmentedBytes * BytesToMB;
+    Stats.ManagedGen0SizeMB = ManagedInfo.Gen0SizeBytes * BytesToMB;
+    Stats.ManagedGen1SizeMB = ManagedInfo.Gen1SizeBytes * BytesToMB;
+    Stats.ManagedGen2SizeMB = ManagedInfo.Gen2SizeBytes * BytesToMB;
+    Stats.ManagedLargeObjectHeapSizeMB = ManagedInfo.LargeObjectHeapSizeBytes * BytesToMB;
+    Stats.ManagedPinnedObjectHeapSizeMB = ManagedInfo.PinnedObjectHeapSizeBytes * BytesToMB;
+    Stats.ManagedAllocationRateMBPerSecond = ManagedAllocationRateMBPerSecond;
+    Stats.ManagedLastPauseMs = ManagedInfo.LastPauseMilliseconds;
+    Stats.ManagedPauseTimePercentage = ManagedInfo.PauseTimePercentage;
+    Stats.ManagedGen0Collections = ManagedInfo.Gen0Collections;
+    Stats.ManagedGen1Collections = ManagedInfo.Gen1Collections;
+    Stats.ManagedGen2Collections = ManagedInfo.Gen2Collections;
+    Stats.SharedBufferCount = SharedBuffers.load(std::memory_order_relaxed);
+    Stats.SharedBufferMB = SharedBufferBytes.load(std::memory_order_relaxed) * BytesToMB;
     
     // 计算平均对象生命周期（简化版）
     int32 TotalObjects = Stats.StrongHandleCount + Stats.WeakHandleCount + Stats.PinnedHandleCount;
@@ -276,14 +473,22 @@ FString FCSGCPressureMonitor::ExportDiagnosticsReport()
     Report += FString::Printf(TEXT("Orphaned Handles: %d\n"), CurrentStats.OrphanedHandleCount);
     Report += FString::Printf(TEXT("Memory Pressure: %.2f MB\n"), CurrentStats.MemoryPressureMB);
     Report += FString::Printf(TEXT("Pressure Level: %s\n"), *GetPressureLevelDescription(CurrentStats.PressureLevel));
+
+    Report += TEXT("\n--- Managed Heap ---\n");
+    Report += FString::Printf(TEXT("Heap Size: %.2f MB (Fragmented: %.2f MB)\n"), CurrentStats.ManagedHeapSizeMB, CurrentStats.ManagedFragmentedMB);
+    Report += FString::Printf(TEXT("Gen0: %.2f MB, Gen1: %.2f MB, Gen2: %.2f MB, LOH: %.2f MB, POH: %.2f MB\n"),
+        CurrentStats.ManagedGen0SizeMB, CurrentStats.ManagedGen1SizeMB, CurrentStats.ManagedGen2SizeMB,
+        CurrentStats.ManagedLargeObjectHeapSizeMB, CurrentStats.ManagedPinnedObjectHeapSizeMB);
+    Report += FString::Printf(TEXT("Allocation Rate: %.2f MB/s\n"), CurrentStats.ManagedAllocationRateMBPerSecond);
+    Report += FString::Printf(TEXT("Last Pause: %.2f ms, Pause Time: %.2f%%\n"), CurrentStats.ManagedLastPauseMs, CurrentStats.ManagedPauseTimePercentage);
+    Report += FString::Printf(TEXT("Collections: Gen0 %d, Gen1 %d, Gen2 %d\n"),
+        CurrentStats.ManagedGen0Collections, CurrentStats.ManagedGen1Collections, CurrentStats.ManagedGen2Collections);
+    Report += FString::Printf(TEXT("Shared Buffers: %d (%.2f MB)\n"), CurrentStats.SharedBufferCount, CurrentStats.SharedBufferMB);
     
     Report += TEXT("\n--- Object Type Distribution ---\n");
+    for (const auto& Pair : GetObjectTypeDistribution())
     {
-        FScopeLock Lock(&CountersMutex);
-        for (const auto& Pair : ObjectTypeCounters)
-        {
-            Report += FString::Printf(TEXT("%s: %d\n"), *Pair.Key, Pair.Value);
-        }
+        Report += FString::Printf(TEXT("%s: %d\n"), *Pair.Key, Pair.Value);
     }
     
     Report += TEXT("\n--- Recommended Actions ---\n");
@@ -305,8 +510,37 @@ FString FCSGCPressureMonitor::ExportDiagnosticsReport()
 
 TMap<FString, int32> FCSGCPressureMonitor::GetObjectTypeDistribution()
 {
-    FScopeLock Lock(&CountersMutex);
-    return ObjectTypeCounters;
+    TMap<FString, int32> Distribution;
+
+#if UNREALSHARP_WITH_DIAGNOSTICS
+    TMap<TObjectKey<UClass>, int32> ClassCounters;
+    {
+        FScopeLock RegistryLock(&ShardRegistryLock);
+        ClassCounters = RetiredCounters;
+
+        for (FTypeCounterShard* Shard : TypeCounterShards)
+        {
+            FScopeLock Lock(&Shard->Lock);
+            for (const TPair<TObjectKey<UClass>, int32>& Pair : Shard->Counters)
+            {
+                ClassCounters.FindOrAdd(Pair.Key) += Pair.Value;
+            }
+        }
+    }
+
+    for (const TPair<TObjectKey<UClass>, int32>& Pair : ClassCounters)
+    {
+        const UClass* Class = Pair.Key.ResolveObjectPtr();
+        if (Pair.Value <= 0 || !Class)
+        {
+            continue;
+        }
+
+        Distribution.FindOrAdd(Class->GetName()) += Pair.Value;
+    }
+#endif
+
+    return Distribution;
 }
 
 void FCSGCPressureMonitor::ValidateHandleIntegrity()
@@ -353,14 +587,11 @@ TArray<FString> FCSGCPressureMonitor::ReportSuspiciousPatterns()
     }
     
     // 检查对象类型分布异常
+    for (const auto& Pair : GetObjectTypeDistribution())
     {
-        FScopeLock Lock(&CountersMutex);
-        for (const auto& Pair : ObjectTypeCounters)
+        if (Pair.Value > 1000) // 单一类型对象过多
         {
-            if (Pair.Value > 1000) // 单一类型对象过多
-            {
-                Patterns.Add(FString::Printf(TEXT("High count for object type '%s': %d"), *Pair.Key, Pair.Value));
-            }
+            Patterns.Add(FString::Printf(TEXT("High count for object type '%s': %d"), *Pair.Key, Pair.Value));
         }
     }
     
@@ -410,6 +641,7 @@ FCSGCPressureMonitor::EGCPressureLevel FCSGCPressureMonitor::CalculatePressureLe
 
 void FCSGCPressureMonitor::UpdateStatsHistory(const FGCStats& NewStats)
 {
+#if UNREALSHARP_WITH_DIAGNOSTICS
     FScopeLock Lock(&CountersMutex);
     
     StatsHistory.Add(NewStats);
@@ -418,6 +650,7 @@ void FCSGCPressureMonitor::UpdateStatsHistory(const FGCStats& NewStats)
     {
         StatsHistory.RemoveAt(0);
     }
+#endif
 }
 
 void FCSGCPressureMonitor::PerformCleanupOperations(EGCPressureLevel PressureLevel)
@@ -432,6 +665,7 @@ void FCSGCPressureMonitor::PerformCleanupOperations(EGCPressureLevel PressureLev
         case EGCPressureLevel::Critical:
             // 执行紧急清理
             CleanupOrphanedHandles();
+            FCSSharedBufferSlab::Trim();
             ForceGarbageCollection();
             break;
             
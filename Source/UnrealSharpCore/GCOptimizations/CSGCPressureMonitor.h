@@ -4,8 +4,40 @@
 #include "HAL/Platform.h"
 #include "Containers/Map.h"
 #include "Misc/DateTime.h"
+#include "UObject/ObjectKey.h"
+#include "../CSManagedGCHandle.h"
 #include <atomic>
 
+// 由UnrealSharpCore.Build.cs定义，为0时句柄计数和压力等级照常工作，按类计数、统计历史和托管堆采样被编译移除
+#ifndef UNREALSHARP_WITH_DIAGNOSTICS
+#define UNREALSHARP_WITH_DIAGNOSTICS !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+#endif
+
+/**
+ * .NET托管堆快照，与托管端的ManagedGCMemoryInfo布局一致
+ * 各代大小为最近一次回收后的值
+ */
+struct FCSManagedGCMemoryInfo
+{
+    int64 HeapSizeBytes = 0;
+    int64 FragmentedBytes = 0;
+    int64 CommittedBytes = 0;
+    int64 Gen0SizeBytes = 0;
+    int64 Gen1SizeBytes = 0;
+    int64 Gen2SizeBytes = 0;
+    int64 LargeObjectHeapSizeBytes = 0;
+    int64 PinnedObjectHeapSizeBytes = 0;
+
+    int64 TotalAllocatedBytes = 0;
+    double LastPauseMilliseconds = 0.0;
+    double TotalPauseMilliseconds = 0.0;
+    double PauseTimePercentage = 0.0;
+
+    int32 Gen0Collections = 0;
+    int32 Gen1Collections = 0;
+    int32 Gen2Collections = 0;
+};
+
 /**
  * GC压力监控系统
  * 主动监控和管理内存压力，防止GC性能问题
@@ -33,6 +65,32 @@ public:
         double MemoryPressureMB = 0.0;
         EGCPressureLevel PressureLevel = EGCPressureLevel::Low;
         FDateTime LastUpdateTime = FDateTime::UtcNow();
+
+        // 托管堆的实际数据，来自GC.GetGCMemoryInfo
+        double ManagedHeapSizeMB = 0.0;
+        double ManagedFragmentedMB = 0.0;
+        double ManagedGen0SizeMB = 0.0;
+        double ManagedGen1SizeMB = 0.0;
+        double ManagedGen2SizeMB = 0.0;
+        double ManagedLargeObjectHeapSizeMB = 0.0;
+        double ManagedPinnedObjectHeapSizeMB = 0.0;
+        double ManagedAllocationRateMBPerSecond = 0.0;
+        double ManagedLastPauseMs = 0.0;
+        double ManagedPauseTimePercentage = 0.0;
+        int32 ManagedGen0Collections = 0;
+        int32 ManagedGen1Collections = 0;
+        int32 ManagedGen2Collections = 0;
+
+        // 跨边界共享的原生缓冲区（FCSSharedBufferSlab）
+        int32 SharedBufferCount = 0;
+        double SharedBufferMB = 0.0;
+    };
+
+    // 每个线程独立的按类计数分片，只在统计时汇总，避免创建对象时跨线程争用同一把锁
+    struct FTypeCounterShard
+    {
+        TMap<TObjectKey<UClass>, int32> Counters;
+        FCriticalSection Lock;
     };
 
 private:
@@ -51,12 +109,22 @@ private:
     static std::atomic<int32> WeakHandles;
     static std::atomic<int32> PinnedHandles;
     static std::atomic<int32> OrphanedHandles;
+    static std::atomic<int32> SharedBuffers;
+    static std::atomic<int64> SharedBufferBytes;
     
     static FDateTime LastMonitoringTime;
     static FDateTime LastCleanupTime;
-    static TMap<FString, int32> ObjectTypeCounters;
     static FCriticalSection CountersMutex;
 
+    static FTypeCounterShard& GetThreadTypeCounterShard();
+    static void AddToTypeCounter(const UClass* Class, int32 Delta);
+    static void ResetTypeCounters();
+
+    // 最近一次托管堆采样
+    static FCSManagedGCMemoryInfo LastManagedMemoryInfo;
+    static double LastManagedSampleTime;
+    static double ManagedAllocationRateMBPerSecond;
+
     // 历史统计
     static TArray<FGCStats> StatsHistory;
     static constexpr int32 MAX_HISTORY_SIZE = 100;
@@ -75,18 +143,34 @@ public:
     /**
      * 增加托管对象计数
      */
-    static void IncrementManagedObject(const FString& ObjectType, GCHandleType HandleType);
+    static void IncrementManagedObject(const UClass* ObjectClass, GCHandleType HandleType);
 
     /**
      * 减少托管对象计数
      */
-    static void DecrementManagedObject(const FString& ObjectType, GCHandleType HandleType);
+    static void DecrementManagedObject(const UClass* ObjectClass, GCHandleType HandleType);
 
     /**
      * 标记孤立句柄
      */
     static void MarkOrphanedHandle();
 
+    /**
+     * 记录共享缓冲区的获取与释放，由FCSSharedBufferSlab调用
+     */
+    static void TrackSharedBuffer(int64 CapacityBytes);
+    static void UntrackSharedBuffer(int64 CapacityBytes);
+
+    /**
+     * 采样托管堆，并写入UE统计和CSV Profiler。应在游戏线程每帧调用
+     */
+    static void SampleManagedMemory();
+
+    /**
+     * 获取最近一次托管堆采样
+     */
+    static const FCSManagedGCMemoryInfo& GetManagedMemoryInfo() { return LastManagedMemoryInfo; }
+
     /**
      * 执行定期监控检查
      * @return 当前压力等级
@@ -134,7 +218,7 @@ public:
     static const TArray<FGCStats>& GetStatsHistory() { return StatsHistory; }
 
     /**
-     * 获取对象类型分布
+     * 获取对象类型分布，汇总所有线程的计数分片
      */
     static TMap<FString, int32> GetObjectTypeDistribution();
 
@@ -174,16 +258,3 @@ private:
      */
     static void LogPerformanceMetrics(const FGCStats& Stats);
 };
-
-// 静态成员初始化
-std::atomic<int32> FCSGCPressureMonitor::TotalManagedObjects{0};
-std::atomic<int32> FCSGCPressureMonitor::StrongHandles{0};
-std::atomic<int32> FCSGCPressureMonitor::WeakHandles{0};
-std::atomic<int32> FCSGCPressureMonitor::PinnedHandles{0};
-std::atomic<int32> FCSGCPressureMonitor::OrphanedHandles{0};
-
-FDateTime FCSGCPressureMonitor::LastMonitoringTime = FDateTime::UtcNow();
-FDateTime FCSGCPressureMonitor::LastCleanupTime = FDateTime::UtcNow();
-TMap<FString, int32> FCSGCPressureMonitor::ObjectTypeCounters;
-FCriticalSection FCSGCPressureMonitor::CountersMutex;
-TArray<FCSGCPressureMonitor::FGCStats> FCSGCPressureMonitor::StatsHistory;
\ No newline at end of file
@@ -6,6 +6,12 @@
 #include "HAL/PlatformMemory.h"
 #include "Stats/Stats.h"
 
+#if UNREALSHARP_WITH_DIAGNOSTICS
+
+// 静态成员初始化
+TArray<FCSGCSafetyDiagnostics::FDiagnosticItem> FCSGCSafetyDiagnostics::DiagnosticHistory;
+FCriticalSection FCSGCSafetyDiagnostics::DiagnosticMutex;
+
 void FCSGCSafetyDiagnostics::Initialize()
 {
     UE_LOG(LogTemp, Log, TEXT("CSGCSafetyDiagnostics: Initializing comprehensive GC safety diagnostics"));
@@ -552,4 +558,6 @@ TArray<FCSGCSafetyDiagnostics::FDiagnosticItem> FCSGCSafetyDiagnostics::Validate
         TEXT("Configuration Validation"), TEXT("All configurations appear valid")));
     
     return Items;
-}
\ No newline at end of file
+}
+
+#endif // UNREALSHARP_WITH_DIAGNOSTICS
@@ -8,6 +8,11 @@
 #include "Containers/Map.h"
 #include "Misc/DateTime.h"
 
+// 由UnrealSharpCore.Build.cs定义，Shipping和Test构建中为0，此时诊断系统只剩空的内联实现
+#ifndef UNREALSHARP_WITH_DIAGNOSTICS
+#define UNREALSHARP_WITH_DIAGNOSTICS !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+#endif
+
 /**
  * 全面的GC安全性诊断系统
  * 整合所有GC优化组件，提供统一的诊断和报告接口
@@ -58,6 +63,7 @@ public:
         double GenerationTimeMs = 0.0;
     };
 
+#if UNREALSHARP_WITH_DIAGNOSTICS
 private:
     static TArray<FDiagnosticItem> DiagnosticHistory;
     static FCriticalSection DiagnosticMutex;
@@ -212,8 +218,44 @@ private:
      * 计算诊断分数
      */
     static int32 CalculateDiagnosticScore(const TArray<FDiagnosticItem>& Items);
-};
 
-// 静态成员初始化
-TArray<FCSGCSafetyDiagnostics::FDiagnosticItem> FCSGCSafetyDiagnostics::DiagnosticHistory;
-FCriticalSection FCSGCSafetyDiagnostics::DiagnosticMutex;
\ No newline at end of file
+#else
+public:
+    // 诊断系统已编译移除：只保留压力监控的初始化和关闭，其余接口都是空操作
+    static void Initialize() { FCSGCPressureMonitor::Initialize(); }
+    static void Shutdown() { FCSGCPressureMonitor::Shutdown(); }
+
+    static FDiagnosticReport PerformComprehensiveDiagnostic(EDiagnosticReportType ReportType = EDiagnosticReportType::Detailed)
+    {
+        FDiagnosticReport Report;
+        Report.ReportType = ReportType;
+        Report.Summary = TEXT("GC safety diagnostics compiled out (UNREALSHARP_WITH_DIAGNOSTICS=0)");
+        return Report;
+    }
+
+    static TArray<FDiagnosticItem> ValidateHandleIntegrity() { return TArray<FDiagnosticItem>(); }
+    static TArray<FDiagnosticItem> DetectSuspiciousPatterns() { return TArray<FDiagnosticItem>(); }
+    static TArray<FDiagnosticItem> AnalyzePerformanceBottlenecks() { return TArray<FDiagnosticItem>(); }
+    static TArray<FDiagnosticItem> ValidateHotReloadSafety() { return TArray<FDiagnosticItem>(); }
+    static TArray<FDiagnosticItem> ValidateObjectLifecycleManagement() { return TArray<FDiagnosticItem>(); }
+    static TArray<FDiagnosticItem> GenerateOptimizationSuggestions(const FCSGCPressureMonitor::FGCStats& CurrentStats) { return TArray<FDiagnosticItem>(); }
+    static void AddDiagnosticItem(const FDiagnosticItem& Item) {}
+    static TArray<FDiagnosticItem> GetDiagnosticHistory(EDiagnosticLevel MinLevel = EDiagnosticLevel::Info) { return TArray<FDiagnosticItem>(); }
+    static FString ExportReportAsText(const FDiagnosticReport& Report) { return Report.Summary; }
+    static FString ExportReportAsJSON(const FDiagnosticReport& Report) { return TEXT("{}"); }
+    static bool SaveReportToFile(const FDiagnosticReport& Report, const FString& FilePath, bool bAsJSON = false) { return false; }
+    static TMap<FString, FString> GetSystemInformation() { return TMap<FString, FString>(); }
+    static FString GetDiagnosticLevelString(EDiagnosticLevel Level) { return FString(); }
+    static FColor GetDiagnosticLevelColor(EDiagnosticLevel Level) { return FColor::White; }
+    static void PerformAutomaticDiagnostic() {}
+    static FString GetDiagnosticSummary() { return FString(); }
+    static void ClearDiagnosticHistory() {}
+
+    static TArray<FDiagnosticItem> FilterDiagnosticItems(const TArray<FDiagnosticItem>& Items,
+                                                         EDiagnosticLevel MinLevel = EDiagnosticLevel::Info,
+                                                         const FString& CategoryFilter = TEXT(""))
+    {
+        return TArray<FDiagnosticItem>();
+    }
+#endif
+};
\ No newline at end of file
@@ -0,0 +1,160 @@
+#include "CSHotReloadSafetyLock.h"
+
+// 静态成员初始化
+std::atomic<bool> FHotReloadSafetyLock::bIsHotReloading{false};
+std::mutex FHotReloadSafetyLock::HotReloadMutex;
+std::atomic<int32> FHotReloadSafetyLock::WaitingThreads{0};
+std::atomic<uint32> FHotReloadSafetyLock::HotReloadThreadId{0};
+FHotReloadSafetyLock::FReaderShard FHotReloadSafetyLock::ReaderShards[NumReaderShards];
+
+FHotReloadSafetyLock::FReaderShard& FHotReloadSafetyLock::GetThreadReaderShard()
+{
+    static std::atomic<uint32> NextShard{0};
+    thread_local const uint32 ShardIndex = NextShard.fetch_add(1, std::memory_order_relaxed) % NumReaderShards;
+    return ReaderShards[ShardIndex];
+}
+
+int32 FHotReloadSafetyLock::GetActiveReaderCount()
+{
+    int32 ActiveReaders = 0;
+    for (const FReaderShard& Shard : ReaderShards)
+    {
+        ActiveReaders += Shard.ActiveReaders.load(std::memory_order_seq_cst);
+    }
+    return ActiveReaders;
+}
+
+FEvent* FHotReloadSafetyLock::GetHotReloadFinishedEvent()
+{
+    static FEventRef Event(EEventMode::ManualReset);
+    return Event.Get();
+}
+
+FEvent* FHotReloadSafetyLock::GetReadersDrainedEvent()
+{
+    static FEventRef Event(EEventMode::ManualReset);
+    return Event.Get();
+}
+
+void FHotReloadSafetyLock::BeginHotReload(int32 DrainTimeoutMs)
+{
+    GetHotReloadFinishedEvent()->Reset();
+    HotReloadThreadId.store(FPlatformTLS::GetCurrentThreadId(), std::memory_order_relaxed);
+    bIsHotReloading.store(true, std::memory_order_seq_cst);
+
+    // 先重置事件再检查计数，检查之后退出的访问会再次触发事件，不会丢失唤醒
+    const double EndTime = FPlatformTime::Seconds() + DrainTimeoutMs / 1000.0;
+    while (true)
+    {
+        FEvent* DrainedEvent = GetReadersDrainedEvent();
+        DrainedEvent->Reset();
+
+        if (GetActiveReaderCount() == 0)
+        {
+            break;
+        }
+
+        const int32 RemainingMs = FMath::CeilToInt32((EndTime - FPlatformTime::Seconds()) * 1000.0);
+        if (RemainingMs <= 0)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("HotReloadSafetyLock: %d managed accesses still active after %d ms, continuing hot reload"), 
+                   GetActiveReaderCount(), DrainTimeoutMs);
+            break;
+        }
+
+        DrainedEvent->Wait(RemainingMs);
+    }
+}
+
+void FHotReloadSafetyLock::EndHotReload()
+{
+    bIsHotReloading.store(false, std::memory_order_seq_cst);
+    HotReloadThreadId.store(0, std::memory_order_relaxed);
+    
+    // 唤醒所有等待的线程
+    if (GetWaitingThreadCount() > 0)
+    {
+        UE_LOG(LogTemp, Log, TEXT("HotReloadSafetyLock: Notifying %d waiting threads"), GetWaitingThreadCount());
+    }
+    GetHotReloadFinishedEvent()->Trigger();
+}
+
+bool FHotReloadSafetyLock::WaitForHotReloadCompletion(int32 TimeoutMs)
+{
+    if (!IsHotReloading())
+    {
+        return true;
+    }
+
+    WaitingThreads.fetch_add(1, std::memory_order_relaxed);
+
+    const double EndTime = FPlatformTime::Seconds() + TimeoutMs / 1000.0;
+    while (IsHotReloading())
+    {
+        const int32 RemainingMs = FMath::CeilToInt32((EndTime - FPlatformTime::Seconds()) * 1000.0);
+        if (RemainingMs <= 0)
+        {
+            break;
+        }
+
+        GetHotReloadFinishedEvent()->Wait(RemainingMs);
+    }
+
+    WaitingThreads.fetch_sub(1, std::memory_order_relaxed);
+
+    if (IsHotReloading())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("HotReloadSafetyLock: Timeout waiting for hot reload completion"));
+        return false;
+    }
+
+    return true;
+}
+
+FHotReloadSafetyLock::FScopedManagedAccess::FScopedManagedAccess(int32 TimeoutMs)
+{
+    // 热重载线程自身的托管调用直接放行
+    if (bIsHotReloading.load(std::memory_order_relaxed) && HotReloadThreadId.load(std::memory_order_relaxed) == FPlatformTLS::GetCurrentThreadId())
+    {
+        bEntered = true;
+        return;
+    }
+
+    FReaderShard& ThreadShard = GetThreadReaderShard();
+    const double EndTime = FPlatformTime::Seconds() + TimeoutMs / 1000.0;
+
+    while (true)
+    {
+        // 与BeginHotReload构成Dekker式握手：先登记再检查标志，双方都用seq_cst
+        ThreadShard.ActiveReaders.fetch_add(1, std::memory_order_seq_cst);
+        if (!bIsHotReloading.load(std::memory_order_seq_cst))
+        {
+            Shard = &ThreadShard;
+            bEntered = true;
+            return;
+        }
+
+        ThreadShard.ActiveReaders.fetch_sub(1, std::memory_order_seq_cst);
+        GetReadersDrainedEvent()->Trigger();
+
+        const int32 RemainingMs = FMath::CeilToInt32((EndTime - FPlatformTime::Seconds()) * 1000.0);
+        if (RemainingMs <= 0 || !WaitForHotReloadCompletion(RemainingMs))
+        {
+            return;
+        }
+    }
+}
+
+FHotReloadSafetyLock::FScopedManagedAccess::~FScopedManagedAccess()
+{
+    if (!Shard)
+    {
+        return;
+    }
+
+    Shard->ActiveReaders.fetch_sub(1, std::memory_order_seq_cst);
+    if (bIsHotReloading.load(std::memory_order_seq_cst))
+    {
+        GetReadersDrainedEvent()->Trigger();
+    }
+}
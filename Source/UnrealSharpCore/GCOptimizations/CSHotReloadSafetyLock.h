@@ -1,12 +1,16 @@
 ﻿#pragma once
 
 #include "CoreMinimal.h"
+#include "HAL/Event.h"
 #include <atomic>
 #include <mutex>
 
 /**
  * 热重载安全锁系统
  * 防止热重载期间的并发访问问题，确保托管对象访问的线程安全性
+ *
+ * 读写锁语义：托管访问为共享方，只在按线程分散的计数分片上加一，互不争用同一缓存行；
+ * 热重载为独占方，置位标志后等待所有分片归零。等待双方都阻塞在FEvent上，不再轮询休眠。
  */
 class UNREALSHARPCORE_API FHotReloadSafetyLock
 {
@@ -20,6 +24,29 @@ private:
     // 等待热重载完成的线程计数
     static std::atomic<int32> WaitingThreads;
 
+    // 持有独占锁的线程，该线程上的托管访问直接放行，避免自身死锁
+    static std::atomic<uint32> HotReloadThreadId;
+
+    // 活跃托管访问计数分片，每个分片独占一条缓存行
+    static constexpr int32 NumReaderShards = 16;
+    struct alignas(PLATFORM_CACHE_LINE_SIZE) FReaderShard
+    {
+        std::atomic<int32> ActiveReaders{0};
+    };
+    static FReaderShard ReaderShards[NumReaderShards];
+
+    static FReaderShard& GetThreadReaderShard();
+    static int32 GetActiveReaderCount();
+
+    // 热重载结束时触发（手动重置）
+    static FEvent* GetHotReloadFinishedEvent();
+
+    // 最后一个托管访问在热重载等待期间退出时触发
+    static FEvent* GetReadersDrainedEvent();
+
+    static void BeginHotReload(int32 DrainTimeoutMs);
+    static void EndHotReload();
+
 public:
     /**
      * 检查当前是否可以安全访问托管对象
@@ -39,37 +66,11 @@ public:
     }
 
     /**
-     * 等待热重载完成（带超时）
+     * 等待热重载完成（带超时），阻塞在事件上直到热重载结束
      * @param TimeoutMs 超时时间（毫秒）
      * @return true如果热重载完成，false如果超时
      */
-    static bool WaitForHotReloadCompletion(int32 TimeoutMs = 5000)
-    {
-        if (!IsHotReloading())
-        {
-            return true;
-        }
-
-        WaitingThreads.fetch_add(1, std::memory_order_relaxed);
-
-        const auto StartTime = FDateTime::UtcNow();
-        const auto TimeoutTime = StartTime + FTimespan::FromMilliseconds(TimeoutMs);
-
-        while (IsHotReloading() && FDateTime::UtcNow() < TimeoutTime)
-        {
-            FPlatformProcess::Sleep(0.01f); // 10ms休眠
-        }
-
-        WaitingThreads.fetch_sub(1, std::memory_order_relaxed);
-
-        if (IsHotReloading())
-        {
-            UE_LOG(LogTemp, Warning, TEXT("HotReloadSafetyLock: Timeout waiting for hot reload completion"));
-            return false;
-        }
-
-        return true;
-    }
+    static bool WaitForHotReloadCompletion(int32 TimeoutMs = 5000);
 
     /**
      * 获取等待线程数量
@@ -80,8 +81,28 @@ public:
     }
 
     /**
-     * RAII风格的热重载锁
-     * 构造时启用热重载锁，析构时自动释放
+     * 托管访问的共享锁
+     * 未在热重载时只在本线程的分片上计数；正在热重载时等待其结束，超时则IsValid()为false
+     */
+    class FScopedManagedAccess
+    {
+    private:
+        FReaderShard* Shard = nullptr;
+        bool bEntered = false;
+
+    public:
+        explicit FScopedManagedAccess(int32 TimeoutMs = 1000);
+        ~FScopedManagedAccess();
+
+        bool IsValid() const { return bEntered; }
+
+        FScopedManagedAccess(const FScopedManagedAccess&) = delete;
+        FScopedManagedAccess& operator=(const FScopedManagedAccess&) = delete;
+    };
+
+    /**
+     * RAII风格的热重载锁（独占方）
+     * 构造时阻止新的托管访问并等待已有访问结束，析构时释放并唤醒等待的线程
      */
     class FScopedHotReloadLock
     {
@@ -89,7 +110,7 @@ public:
         bool bWasAlreadyLocked;
 
     public:
-        FScopedHotReloadLock()
+        explicit FScopedHotReloadLock(int32 DrainTimeoutMs = 5000)
         {
             std::lock_guard<std::mutex> Lock(HotReloadMutex);
             
@@ -97,11 +118,8 @@ public:
             
             if (!bWasAlreadyLocked)
             {
-                bIsHotReloading.store(true, std::memory_order_release);
+                BeginHotReload(DrainTimeoutMs);
                 UE_LOG(LogTemp, Log, TEXT("HotReloadSafetyLock: Hot reload lock acquired"));
-                
-                // 等待所有等待线程得到通知
-                FPlatformProcess::Sleep(0.001f); // 给其他线程一个机会检查状态
             }
             else
             {
@@ -114,16 +132,9 @@ public:
             if (!bWasAlreadyLocked)
             {
                 std::lock_guard<std::mutex> Lock(HotReloadMutex);
-                bIsHotReloading.store(false, std::memory_order_release);
+                EndHotReload();
                 
                 UE_LOG(LogTemp, Log, TEXT("HotReloadSafetyLock: Hot reload lock released"));
-                
-                // 通知等待的线程
-                if (GetWaitingThreadCount() > 0)
-                {
-                    UE_LOG(LogTemp, Log, TEXT("HotReloadSafetyLock: Notifying %d waiting threads"), 
-                           GetWaitingThreadCount());
-                }
             }
         }
 
@@ -136,24 +147,18 @@ public:
 
     /**
      * 安全的托管对象访问包装器
-     * 确保只在非热重载期间执行操作
+     * 确保只在非热重载期间执行操作，热重载不会在访问进行中开始
      */
     template<typename FunctionType>
     static bool SafeManagedObjectAccess(FunctionType&& AccessFunction, int32 TimeoutMs = 1000)
     {
-        if (!WaitForHotReloadCompletion(TimeoutMs))
+        FScopedManagedAccess Access(TimeoutMs);
+        if (!Access.IsValid())
         {
             UE_LOG(LogTemp, Error, TEXT("HotReloadSafetyLock: Failed to acquire safe access within timeout"));
             return false;
         }
 
-        // 双重检查以防竞态条件
-        if (IsHotReloading())
-        {
-            UE_LOG(LogTemp, Warning, TEXT("HotReloadSafetyLock: Hot reload started during access attempt"));
-            return false;
-        }
-
         try
         {
             AccessFunction();
@@ -175,7 +180,7 @@ public:
         if (bIsHotReloading.load())
         {
             UE_LOG(LogTemp, Warning, TEXT("HotReloadSafetyLock: Force releasing hot reload lock"));
-            bIsHotReloading.store(false, std::memory_order_release);
+            EndHotReload();
         }
     }
 
@@ -184,13 +189,8 @@ public:
      */
     static FString GetLockStatusDescription()
     {
-        return FString::Printf(TEXT("HotReload: %s, Waiting Threads: %d"), 
+        return FString::Printf(TEXT("HotReload: %s, Waiting Threads: %d, Active Accesses: %d"), 
                              IsHotReloading() ? TEXT("Active") : TEXT("Inactive"),
-                             GetWaitingThreadCount());
+                             GetWaitingThreadCount(), GetActiveReaderCount());
     }
 };
-
-// 静态成员初始化
-std::atomic<bool> FHotReloadSafetyLock::bIsHotReloading{false};
-std::mutex FHotReloadSafetyLock::HotReloadMutex;
-std::atomic<int32> FHotReloadSafetyLock::WaitingThreads{0};
\ No newline at end of file
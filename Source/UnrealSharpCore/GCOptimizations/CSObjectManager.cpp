@@ -0,0 +1,50 @@
+#include "CSObjectManager.h"
+#include "Engine/Engine.h"
+#include "UObject/ObjectKey.h"
+
+namespace
+{
+    // 按类缓存的句柄类型。TObjectKey带序列号，类被卸载或热重载重建后旧条目不会被误用
+    TMap<TObjectKey<UClass>, GCHandleType> ClassHandleTypes;
+    FRWLock ClassHandleTypesLock;
+
+    GCHandleType ComputeClassHandleType(const UClass* Class)
+    {
+        // 系统关键对象 -> StrongHandle (需要保证生命周期)
+        if (Class->IsChildOf<UWorld>() ||
+            Class->IsChildOf<UGameInstance>() ||
+            Class->IsChildOf<UEngine>())
+        {
+            UE_LOG(LogTemp, Verbose, TEXT("CSObjectManager: Using StrongHandle for system class: %s"), *Class->GetName());
+            return GCHandleType::StrongHandle;
+        }
+
+        // 游戏逻辑对象、组件、资产及其他对象 -> WeakHandle (避免阻止GC, 生命周期由Owner或资产管理器控制)
+        UE_LOG(LogTemp, VeryVerbose, TEXT("CSObjectManager: Using WeakHandle for class: %s"), *Class->GetName());
+        return GCHandleType::WeakHandle;
+    }
+}
+
+GCHandleType UCSObjectManager::GetClassHandleType(const UClass* Class)
+{
+    if (!Class)
+    {
+        return GCHandleType::Null;
+    }
+
+    const TObjectKey<UClass> ClassKey(Class);
+
+    {
+        FReadScopeLock ReadLock(ClassHandleTypesLock);
+        if (const GCHandleType* CachedType = ClassHandleTypes.Find(ClassKey))
+        {
+            return *CachedType;
+        }
+    }
+
+    const GCHandleType HandleType = ComputeClassHandleType(Class);
+
+    FWriteScopeLock WriteLock(ClassHandleTypesLock);
+    ClassHandleTypes.Add(ClassKey, HandleType);
+    return HandleType;
+}
@@ -18,6 +18,7 @@ class UNREALSHARPCORE_API UCSObjectManager
 public:
     /**
      * 根据UObject类型智能确定最优的GCHandle类型
+     * 只有根集检查依赖对象本身，其余结果按UClass缓存，见GetClassHandleType
      * @param Object 要分析的UObject
      * @return 推荐的GCHandleType
      */
@@ -28,56 +29,23 @@ public:
             return GCHandleType::Null;
         }
 
-        // 系统关键对象 -> StrongHandle (需要保证生命周期)
-        if (Object->IsA<UWorld>() || 
-            Object->IsA<UGameInstance>() ||
-            Object->IsA<UEngine>())
-        {
-            UE_LOG(LogTemp, Verbose, TEXT("CSObjectManager: Using StrongHandle for system object: %s"), 
-                   *Object->GetClass()->GetName());
-            return GCHandleType::StrongHandle;
-        }
-
         // 静态/持久化对象 -> StrongHandle
-        if (Object->HasAnyFlags(RF_MarkAsRootSet) ||
-            Object->IsRooted())
+        if (Object->HasAnyFlags(RF_MarkAsRootSet) || Object->IsRooted())
         {
-            UE_LOG(LogTemp, Verbose, TEXT("CSObjectManager: Using StrongHandle for rooted object: %s"), 
-                   *Object->GetClass()->GetName());
             return GCHandleType::StrongHandle;
         }
 
-        // 游戏逻辑对象 -> WeakHandle (避免阻止GC)
-        if (Object->IsA<APawn>() || 
-            Object->IsA<AController>() ||
-            Object->IsA<AActor>())
-        {
-            UE_LOG(LogTemp, VeryVerbose, TEXT("CSObjectManager: Using WeakHandle for game object: %s"), 
-                   *Object->GetClass()->GetName());
-            return GCHandleType::WeakHandle;
-        }
-
-        // 组件对象 -> WeakHandle (生命周期由Owner管理)
-        if (Object->IsA<UActorComponent>())
-        {
-            UE_LOG(LogTemp, VeryVerbose, TEXT("CSObjectManager: Using WeakHandle for component: %s"), 
-                   *Object->GetClass()->GetName());
-            return GCHandleType::WeakHandle;
-        }
-
-        // 资产对象 -> 根据是否在内存中决定
-        if (Object->IsA<UObject>() && Object->IsAsset())
-        {
-            // 已加载的资产使用弱引用，让资产管理器控制生命周期
-            return GCHandleType::WeakHandle;
-        }
-
-        // 默认弱引用 - 更安全的选择
-        UE_LOG(LogTemp, VeryVerbose, TEXT("CSObjectManager: Using default WeakHandle for object: %s"), 
-               *Object->GetClass()->GetName());
-        return GCHandleType::WeakHandle;
+        return GetClassHandleType(Object->GetClass());
     }
 
+    /**
+     * 确定某个类的实例默认使用的GCHandle类型，首次查询后缓存
+     * 系统关键对象(UWorld、UGameInstance、UEngine) -> StrongHandle，其余(Actor、组件、资产等) -> WeakHandle
+     * @param Class 对象的UClass
+     * @return 该类推荐的GCHandleType
+     */
+    static GCHandleType GetClassHandleType(const UClass* Class);
+
     /**
      * 创建智能GC句柄
      * @param Object 源UObject
@@ -102,9 +70,9 @@ public:
         if (!NewHandle.IsNull())
         {
             // 设置优化的句柄类型
-            NewHandle.Type = OptimalType;
+            NewHandle.SetType(OptimalType);
             
-            UE_LOG(LogTemp, Verbose, TEXT("CSObjectManager: Created %s handle for %s"), 
+            UE_LOG(LogTemp, VeryVerbose, TEXT("CSObjectManager: Created %s handle for %s"), 
                    OptimalType == GCHandleType::StrongHandle ? TEXT("Strong") : TEXT("Weak"),
                    *Object->GetClass()->GetName());
         }
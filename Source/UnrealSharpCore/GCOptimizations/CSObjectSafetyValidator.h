@@ -4,6 +4,11 @@
 #include "UObject/UObjectGlobals.h"
 #include "UObject/Object.h"
 
+// 是否编译完整的托管访问安全检查。Shipping构建中默认关闭，只保留单个标志检查。
+#ifndef UNREALSHARP_FULL_OBJECT_VALIDATION
+#define UNREALSHARP_FULL_OBJECT_VALIDATION !UE_BUILD_SHIPPING
+#endif
+
 /**
  * 增强的对象安全性验证器
  * 提供比标准IsValid()更严格的安全检查
@@ -252,4 +257,26 @@ public:
                                  *FString::Join(Issues, TEXT(", ")));
         }
     }
-};
\ No newline at end of file
+};
+
+/**
+ * 完整验证策略 - 执行FCSObjectSafetyValidator的全部检查
+ */
+struct FCSFullObjectValidationPolicy
+{
+    static bool IsObjectSafe(const UObject* Object)
+    {
+        return FCSObjectSafetyValidator::IsObjectSafeForManagedAccess(Object);
+    }
+};
+
+/**
+ * 最小验证策略 - 只检查空指针和Garbage标志，不输出日志
+ */
+struct FCSMinimalObjectValidationPolicy
+{
+    static FORCEINLINE bool IsObjectSafe(const UObject* Object)
+    {
+        return IsValid(Object);
+    }
+};
@@ -0,0 +1,313 @@
+#include "Android/UnrealSharp_Android_JITWarmUp.h"
+
+#if WITH_MONO_RUNTIME && PLATFORM_ANDROID
+
+#include "CSUnrealSharpSettings.h"
+#include "Containers/Ticker.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Tasks/Task.h"
+
+#include "mono/jit/jit.h"
+#include "mono/metadata/assembly.h"
+#include "mono/metadata/attrdefs.h"
+#include "mono/metadata/class.h"
+#include "mono/metadata/image.h"
+#include "mono/metadata/object.h"
+#include "mono/metadata/profiler.h"
+#include "mono/metadata/threads.h"
+#include "mono/metadata/tokentype.h"
+
+namespace UnrealSharp::Android::JITWarmUp
+{
+    // Android JIT warm-up state
+    struct FJITWarmUpState
+    {
+        MonoProfilerHandle Profiler = nullptr;
+
+        // Methods compiled while recording, resolved to names when the profile is saved. Filled from any thread.
+        FCriticalSection RecordedMethodsLock;
+        TSet<TPair<MonoImage*, uint32>> RecordedMethods;
+        bool bIsRecording = false;
+
+        FTSTicker::FDelegateHandle StopRecordingHandle;
+
+        UE::Tasks::FTask WarmUpTask;
+    };
+
+    static FJITWarmUpState JITWarmUpState;
+
+    /**
+     * Profiler callback, called by the JIT on the thread that compiled the method
+     */
+    static void OnJITDone(MonoProfiler* Profiler, MonoMethod* Method, MonoJitInfo* JitInfo)
+    {
+        // Generic instances and wrappers don't have a method definition token of their own
+        uint32 Token = mono_method_get_token(Method);
+        if ((Token & 0xFF000000) != MONO_TOKEN_METHOD_DEF)
+        {
+            return;
+        }
+
+        MonoImage* Image = mono_class_get_image(mono_method_get_class(Method));
+
+        FScopeLock Lock(&JITWarmUpState.RecordedMethodsLock);
+        JITWarmUpState.RecordedMethods.Add(TPair<MonoImage*, uint32>(Image, Token));
+    }
+
+    static MonoImage* FindLoadedImage(const FString& AssemblyName)
+    {
+        MonoAssemblyName* Name = mono_assembly_name_new(TCHAR_TO_UTF8(*AssemblyName));
+        if (!Name)
+        {
+            return nullptr;
+        }
+
+        MonoAssembly* Assembly = mono_assembly_loaded(Name);
+        mono_assembly_name_free(Name);
+
+        return Assembly ? mono_assembly_get_image(Assembly) : nullptr;
+    }
+
+    void OnUserAssembliesLoaded()
+    {
+        const int32 RecordSeconds = GetDefault<UCSUnrealSharpSettings>()->AndroidJITWarmUpRecordSeconds;
+        if (RecordSeconds <= 0)
+        {
+            return;
+        }
+
+        TArray<FJITWarmUpEntry> Entries;
+        LoadProfile(GetProfilePath(), Entries);
+
+        // Entries of rebuilt or removed assemblies are skipped, and a new profile is recorded in their place
+        int32 NumValidEntries = 0;
+        TMap<FString, FString> ModuleVersionIds;
+        for (const FJITWarmUpEntry& Entry : Entries)
+        {
+            FString* ModuleVersionId = ModuleVersionIds.Find(Entry.AssemblyName);
+            if (!ModuleVersionId)
+            {
+                MonoImage* Image = FindLoadedImage(Entry.AssemblyName);
+                ModuleVersionId = &ModuleVersionIds.Add(Entry.AssemblyName, Image ? FString(UTF8_TO_TCHAR(mono_image_get_guid(Image))) : FString());
+            }
+
+            if (*ModuleVersionId == Entry.ModuleVersionId)
+            {
+                NumValidEntries++;
+            }
+        }
+
+        if (NumValidEntries > 0)
+        {
+            StartWarmUp(Entries);
+        }
+
+        if (NumValidEntries < Entries.Num() || Entries.IsEmpty())
+        {
+            StartRecording(RecordSeconds);
+        }
+    }
+
+    void StartRecording(double DurationSeconds)
+    {
+        if (JITWarmUpState.bIsRecording)
+        {
+            return;
+        }
+
+        // Profilers can't be destroyed, the same one is reused for every recording
+        if (!JITWarmUpState.Profiler)
+        {
+            JITWarmUpState.Profiler = mono_profiler_create(nullptr);
+        }
+
+        {
+            FScopeLock Lock(&JITWarmUpState.RecordedMethodsLock);
+            JITWarmUpState.RecordedMethods.Reset();
+        }
+
+        mono_profiler_set_jit_done_callback(JITWarmUpState.Profiler, &OnJITDone);
+        JITWarmUpState.bIsRecording = true;
+
+        JITWarmUpState.StopRecordingHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([](float)
+        {
+            JITWarmUpState.StopRecordingHandle.Reset();
+            StopRecording();
+            return false;
+        }), DurationSeconds);
+
+        UE_LOG(LogTemp, Log, TEXT("UnrealSharp Android: Recording JIT warm-up profile for %.0f seconds"), DurationSeconds);
+    }
+
+    void StopRecording()
+    {
+        if (!JITWarmUpState.bIsRecording)
+        {
+            return;
+        }
+
+        mono_profiler_set_jit_done_callback(JITWarmUpState.Profiler, nullptr);
+        JITWarmUpState.bIsRecording = false;
+
+        if (JITWarmUpState.StopRecordingHandle.IsValid())
+        {
+            FTSTicker::GetCoreTicker().RemoveTicker(JITWarmUpState.StopRecordingHandle);
+            JITWarmUpState.StopRecordingHandle.Reset();
+        }
+
+        TSet<TPair<MonoImage*, uint32>> RecordedMethods;
+        {
+            FScopeLock Lock(&JITWarmUpState.RecordedMethodsLock);
+            RecordedMethods = MoveTemp(JITWarmUpState.RecordedMethods);
+        }
+
+        TArray<FJITWarmUpEntry> Entries;
+        Entries.Reserve(RecordedMethods.Num());
+
+        for (const TPair<MonoImage*, uint32>& Method : RecordedMethods)
+        {
+            FJITWarmUpEntry& Entry = Entries.AddDefaulted_GetRef();
+            Entry.AssemblyName = UTF8_TO_TCHAR(mono_image_get_name(Method.Key));
+            Entry.ModuleVersionId = UTF8_TO_TCHAR(mono_image_get_guid(Method.Key));
+            Entry.MethodToken = Method.Value;
+        }
+
+        SaveProfile(GetProfilePath(), Entries);
+        UE_LOG(LogTemp, Log, TEXT("UnrealSharp Android: Saved JIT warm-up profile with %d methods"), Entries.Num());
+    }
+
+    bool IsRecording()
+    {
+        return JITWarmUpState.bIsRecording;
+    }
+
+    bool StartWarmUp(const TArray<FJITWarmUpEntry>& Entries)
+    {
+        // Resolve the entries up front, only methods of loaded assemblies with the recorded module version id are compiled
+        TArray<TPair<MonoImage*, uint32>> Methods;
+        Methods.Reserve(Entries.Num());
+
+        TMap<FString, MonoImage*> Images;
+        for (const FJITWarmUpEntry& Entry : Entries)
+        {
+            MonoImage** Image = Images.Find(Entry.AssemblyName);
+            if (!Image)
+            {
+                Image = &Images.Add(Entry.AssemblyName, FindLoadedImage(Entry.AssemblyName));
+            }
+
+            if (*Image && Entry.ModuleVersionId == UTF8_TO_TCHAR(mono_image_get_guid(*Image)))
+            {
+                Methods.Emplace(*Image, Entry.MethodToken);
+            }
+        }
+
+        if (Methods.IsEmpty())
+        {
+            return false;
+        }
+
+        WaitForWarmUp(-1.0);
+
+        JITWarmUpState.WarmUpTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [Methods = MoveTemp(Methods)]()
+        {
+            double StartTime = FPlatformTime::Seconds();
+            MonoThread* Thread = mono_thread_attach(mono_get_root_domain());
+
+            int32 NumCompiled = 0;
+            for (const TPair<MonoImage*, uint32>& Method : Methods)
+            {
+                MonoMethod* CompiledMethod = mono_get_method(Method.Key, Method.Value, nullptr);
+                if (!CompiledMethod)
+                {
+                    continue;
+                }
+
+                // Abstract methods have no body, and generic definitions have to be instantiated first
+                MonoClass* Class = mono_method_get_class(CompiledMethod);
+                if ((mono_method_get_flags(CompiledMethod, nullptr) & MONO_METHOD_ATTR_ABSTRACT) || mono_class_is_generic(Class))
+                {
+                    continue;
+                }
+
+                if (mono_compile_method(CompiledMethod))
+                {
+                    NumCompiled++;
+                }
+            }
+
+            mono_thread_detach(Thread);
+
+            UE_LOG(LogTemp, Log, TEXT("UnrealSharp Android: JIT warm-up compiled %d of %d methods in %.3f seconds"),
+                   NumCompiled, Methods.Num(), FPlatformTime::Seconds() - StartTime);
+        }, UE::Tasks::ETaskPriority::BackgroundNormal);
+
+        return true;
+    }
+
+    bool WaitForWarmUp(double TimeoutSeconds)
+    {
+        if (!JITWarmUpState.WarmUpTask.IsValid())
+        {
+            return true;
+        }
+
+        if (TimeoutSeconds < 0.0)
+        {
+            JITWarmUpState.WarmUpTask.Wait();
+            return true;
+        }
+
+        return JITWarmUpState.WarmUpTask.Wait(FTimespan::FromSeconds(TimeoutSeconds));
+    }
+
+    FString GetProfilePath()
+    {
+        return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("UnrealSharp"), TEXT("JITWarmUp.profile"));
+    }
+
+    bool SaveProfile(const FString& Path, const TArray<FJITWarmUpEntry>& Entries)
+    {
+        TArray<FString> Lines;
+        Lines.Reserve(Entries.Num());
+
+        for (const FJITWarmUpEntry& Entry : Entries)
+        {
+            Lines.Add(FString::Printf(TEXT("%s|%s|%08X"), *Entry.AssemblyName, *Entry.ModuleVersionId, Entry.MethodToken));
+        }
+
+        return FFileHelper::SaveStringArrayToFile(Lines, *Path);
+    }
+
+    bool LoadProfile(const FString& Path, TArray<FJITWarmUpEntry>& OutEntries)
+    {
+        OutEntries.Reset();
+
+        TArray<FString> Lines;
+        if (!FFileHelper::LoadFileToStringArray(Lines, *Path))
+        {
+            return false;
+        }
+
+        OutEntries.Reserve(Lines.Num());
+        for (const FString& Line : Lines)
+        {
+            TArray<FString> Parts;
+            if (Line.ParseIntoArray(Parts, TEXT("|"), false) != 3)
+            {
+                continue;
+            }
+
+            FJITWarmUpEntry& Entry = OutEntries.AddDefaulted_GetRef();
+            Entry.AssemblyName = MoveTemp(Parts[0]);
+            Entry.ModuleVersionId = MoveTemp(Parts[1]);
+            Entry.MethodToken = FParse::HexNumber(*Parts[2]);
+        }
+
+        return true;
+    }
+}
+
+#endif // WITH_MONO_RUNTIME && PLATFORM_ANDROID
@@ -1,4 +1,5 @@
 #include "Android/UnrealSharp_Android_HotReload.h"
+#include "Android/UnrealSharp_Android_JITWarmUp.h"
 
 #if WITH_MONO_RUNTIME && PLATFORM_ANDROID
 
@@ -6,6 +7,8 @@
 #include "Misc/AutomationTest.h"
 #include "HAL/PlatformFilemanager.h"
 #include "Misc/DateTime.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
 
 /**
  * Performance tests for Android JIT Hot Reload functionality
@@ -190,4 +193,37 @@ bool FAndroidJITCompatibilityTest::RunTest(const FString& Parameters)
     return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAndroidJITWarmUpProfileTest, "UnrealSharp.Android.JIT.WarmUpProfile",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAndroidJITWarmUpProfileTest::RunTest(const FString& Parameters)
+{
+    using namespace UnrealSharp::Android::JITWarmUp;
+
+    TArray<FJITWarmUpEntry> Entries;
+    Entries.Add({ TEXT("WarmUpTestAssembly"), TEXT("2B6F0C64-5D3A-4C1E-9F2B-7A1D3E5C8B90"), 0x06000001 });
+    Entries.Add({ TEXT("WarmUpTestAssembly"), TEXT("2B6F0C64-5D3A-4C1E-9F2B-7A1D3E5C8B90"), 0x0600ABCD });
+    Entries.Add({ TEXT("WarmUpTestAssembly2"), TEXT("0F1E2D3C-4B5A-6978-8796-A5B4C3D2E1F0"), 0x06000042 });
+
+    // Test 1: A saved profile loads back unchanged
+    const FString ProfilePath = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("JITWarmUpTest.profile"));
+    TestTrue(TEXT("Warm-up profile should be saved"), SaveProfile(ProfilePath, Entries));
+
+    TArray<FJITWarmUpEntry> LoadedEntries;
+    TestTrue(TEXT("Warm-up profile should be loaded"), LoadProfile(ProfilePath, LoadedEntries));
+    TestEqual(TEXT("Warm-up profile should keep every entry"), LoadedEntries.Num(), Entries.Num());
+
+    for (int32 i = 0; i < FMath::Min(Entries.Num(), LoadedEntries.Num()); i++)
+    {
+        TestTrue(TEXT("Warm-up profile entries should round-trip"), LoadedEntries[i] == Entries[i]);
+    }
+
+    // Test 2: Entries of assemblies that aren't loaded are never compiled
+    TestFalse(TEXT("Warm-up should skip entries of unloaded assemblies"), StartWarmUp(Entries));
+    TestTrue(TEXT("Waiting without a warm-up should return immediately"), WaitForWarmUp(0.0));
+
+    IFileManager::Get().Delete(*ProfilePath);
+    return true;
+}
+
 #endif // WITH_MONO_RUNTIME && PLATFORM_ANDROID
\ No newline at end of file
@@ -0,0 +1,514 @@
+#include "HotReload/UnrealSharp_UnifiedHotReload.h"
+
+#if WITH_MONO_RUNTIME
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UnrealSharp_BenchmarkOutput.h"
+#include "UnrealSharpProcHelper/CSProcHelper.h"
+
+#include "mono/jit/jit.h"
+#include "mono/metadata/appdomain.h"
+#include "mono/metadata/assembly.h"
+#include "mono/metadata/class.h"
+#include "mono/metadata/image.h"
+#include "mono/metadata/loader.h"
+#include "mono/metadata/metadata.h"
+#include "mono/metadata/object.h"
+#include "mono/metadata/tokentype.h"
+
+#if PLATFORM_IOS
+#include "iOS/UnrealSharp_iOS_RuntimeHotReload.h"
+#endif
+
+#if PLATFORM_ANDROID
+#include "Android/UnrealSharp_Android_HotReload.h"
+#endif
+
+#if PLATFORM_WINDOWS
+#include "Windows/UnrealSharp_Windows_HotReload.h"
+#endif
+
+/**
+ * Hot reload benchmark suite
+ *
+ * Runs the same phases on synthetic C# projects of 100, 1k and 10k types on whatever backend the platform uses:
+ * - ColdStart: create a domain and load the assembly into it
+ * - MetadataParse: resolve every type and method of the assembly
+ * - TypeBuild: create and initialize the vtable of every type
+ * - FullReload: replace the whole assembly with the backend's assembly reload
+ * - MethodBodyReload: replace only the changed method bodies, on backends that support it
+ *
+ * The projects are generated and built in the editor, under Saved/UnrealSharp/Benchmarks/Assemblies.
+ * Devices can't build C#, stage that directory with the app to run the suite there.
+ * Every run appends to Saved/UnrealSharp/Benchmarks/HotReloadBenchmarks.csv and writes a JSON file of its own.
+ */
+
+namespace UnrealSharp::HotReload::Benchmark
+{
+    // Each phase runs this many times in a fresh domain, the median is reported
+    constexpr int32 NumIterations = 3;
+
+    // Types per generated source file
+    constexpr int32 TypesPerFile = 500;
+
+    struct FBenchmarkResult
+    {
+        int32 TypeCount = 0;
+        FString Phase;
+        double Milliseconds = 0.0;
+    };
+
+    using UnrealSharp::Benchmark::GetBenchmarkDirectory;
+
+    static FString GetAssemblyName(int32 TypeCount)
+    {
+        return FString::Printf(TEXT("UnrealSharpBenchmark%d"), TypeCount);
+    }
+
+    static FString GetAssemblyPath(int32 TypeCount, const TCHAR* Variant)
+    {
+        return GetBenchmarkDirectory() / TEXT("Assemblies") / FString::FromInt(TypeCount) / Variant / (GetAssemblyName(TypeCount) + TEXT(".dll"));
+    }
+
+#if WITH_EDITOR
+    /**
+     * Write a synthetic project. The modified variant has the same types and methods, only the method bodies differ,
+     * so every metadata token matches between both variants.
+     */
+    static bool GenerateProject(int32 TypeCount, const FString& ProjectDirectory, bool bModified)
+    {
+        IFileManager::Get().DeleteDirectory(*ProjectDirectory, false, true);
+
+        const FString ProjectFile = FString::Printf(TEXT(
+            "<Project Sdk=\"Microsoft.NET.Sdk\">\n"
+            "  <PropertyGroup>\n"
+            "    <TargetFramework>net9.0</TargetFramework>\n"
+            "    <AssemblyName>%s</AssemblyName>\n"
+            "    <ImplicitUsings>disable</ImplicitUsings>\n"
+            "    <Nullable>disable</Nullable>\n"
+            "    <Deterministic>true</Deterministic>\n"
+            "  </PropertyGroup>\n"
+            "</Project>\n"), *GetAssemblyName(TypeCount));
+
+        if (!FFileHelper::SaveStringToFile(ProjectFile, *(ProjectDirectory / GetAssemblyName(TypeCount) + TEXT(".csproj"))))
+        {
+            return false;
+        }
+
+        const int32 Multiplier = bModified ? 3 : 2;
+
+        for (int32 FirstType = 0; FirstType < TypeCount; FirstType += TypesPerFile)
+        {
+            FString Source = TEXT("namespace UnrealSharpBenchmark\n{\n");
+
+            const int32 LastType = FMath::Min(FirstType + TypesPerFile, TypeCount);
+            for (int32 TypeIndex = FirstType; TypeIndex < LastType; ++TypeIndex)
+            {
+                // Types derive from each other in chains of ten, so type build has hierarchies to walk
+                const FString BaseClause = TypeIndex % 10 != 0 ? FString::Printf(TEXT(" : BenchmarkType%d"), TypeIndex - 1) : FString();
+
+                Source += FString::Printf(TEXT(
+                    "    public class BenchmarkType%d%s\n"
+                    "    {\n"
+                    "        public static int Counter%d;\n"
+                    "        public int Value%d;\n"
+                    "        public string Name%d;\n"
+                    "        public int Compute%d(int Input) { return Input * %d + %d; }\n"
+                    "        public string Describe%d() { return Name%d + Value%d; }\n"
+                    "    }\n"),
+                    TypeIndex, *BaseClause, TypeIndex, TypeIndex, TypeIndex, TypeIndex, Multiplier, TypeIndex, TypeIndex, TypeIndex, TypeIndex);
+            }
+
+            Source += TEXT("}\n");
+
+            const FString SourcePath = ProjectDirectory / FString::Printf(TEXT("BenchmarkTypes%d.cs"), FirstType / TypesPerFile);
+            if (!FFileHelper::SaveStringToFile(Source, *SourcePath))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    static bool BuildProject(const FString& ProjectDirectory, const FString& OutputDirectory, FString& OutError)
+    {
+        const FString Arguments = FString::Printf(TEXT("build \"%s\" -c Release -o \"%s\" --nologo"), *ProjectDirectory, *OutputDirectory);
+
+        int32 ReturnCode = 0;
+        FString Output;
+        if (!FCSProcHelper::InvokeCommand(FCSProcHelper::GetDotNetExecutablePath(), Arguments, ReturnCode, Output, &ProjectDirectory) || ReturnCode != 0)
+        {
+            OutError = Output;
+            return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * Generate and build both variants of a synthetic project, unless they are already built
+     */
+    static bool EnsureSyntheticAssemblies(int32 TypeCount, FString& OutError)
+    {
+        const TCHAR* Variants[] = { TEXT("Base"), TEXT("Modified") };
+
+        for (const TCHAR* Variant : Variants)
+        {
+            if (FPaths::FileExists(GetAssemblyPath(TypeCount, Variant)))
+            {
+                continue;
+            }
+
+            const FString ProjectDirectory = FPaths::ConvertRelativePathToFull(GetBenchmarkDirectory() / TEXT("Projects") / FString::FromInt(TypeCount) / Variant);
+            const FString OutputDirectory = FPaths::ConvertRelativePathToFull(FPaths::GetPath(GetAssemblyPath(TypeCount, Variant)));
+
+            if (!GenerateProject(TypeCount, ProjectDirectory, FCString::Strcmp(Variant, TEXT("Modified")) == 0))
+            {
+                OutError = FString::Printf(TEXT("Failed to write the synthetic project to %s"), *ProjectDirectory);
+                return false;
+            }
+
+            if (!BuildProject(ProjectDirectory, OutputDirectory, OutError))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+#else
+    static bool EnsureSyntheticAssemblies(int32 TypeCount, FString& OutError)
+    {
+        if (FPaths::FileExists(GetAssemblyPath(TypeCount, TEXT("Base"))) && FPaths::FileExists(GetAssemblyPath(TypeCount, TEXT("Modified"))))
+        {
+            return true;
+        }
+
+        OutError = FString::Printf(TEXT("No synthetic assemblies in %s, run the benchmark in the editor and stage them with the app"), *GetBenchmarkDirectory());
+        return false;
+    }
+#endif
+
+    static MonoAssembly* LoadAssemblyFromData(const FString& AssemblyName, const TArray<uint8>& AssemblyData)
+    {
+        MonoImageOpenStatus Status;
+        MonoImage* Image = mono_image_open_from_data_with_name(reinterpret_cast<char*>(const_cast<uint8*>(AssemblyData.GetData())),
+            AssemblyData.Num(), true, &Status, false, TCHAR_TO_ANSI(*AssemblyName));
+
+        if (!Image || Status != MONO_IMAGE_OK)
+        {
+            return nullptr;
+        }
+
+        MonoAssembly* Assembly = mono_assembly_load_from_full(Image, TCHAR_TO_ANSI(*AssemblyName), &Status, false);
+        mono_image_close(Image);
+
+        return Status == MONO_IMAGE_OK ? Assembly : nullptr;
+    }
+
+    static void GetTypes(MonoImage* Image, TArray<MonoClass*>& OutTypes)
+    {
+        // Row 1 is the <Module> pseudo type
+        const int32 NumTypes = mono_image_get_table_rows(Image, MONO_TABLE_TYPEDEF);
+        OutTypes.Reset(NumTypes);
+
+        for (int32 Row = 2; Row <= NumTypes; ++Row)
+        {
+            if (MonoClass* Class = mono_class_get(Image, MONO_TOKEN_TYPE_DEF | Row))
+            {
+                OutTypes.Add(Class);
+            }
+        }
+    }
+
+#if PLATFORM_IOS
+    /**
+     * The iOS runtime backend takes the changed IL bodies, not the assembly
+     * Delta format: [MethodToken:4][BytecodeSize:4][Bytecode:BytecodeSize]...
+     */
+    static void CreateMethodBodyDelta(MonoImage* ModifiedImage, TArray<uint8>& OutDelta)
+    {
+        TArray<MonoClass*> Types;
+        GetTypes(ModifiedImage, Types);
+
+        for (MonoClass* Class : Types)
+        {
+            void* Iterator = nullptr;
+            while (MonoMethod* Method = mono_class_get_methods(Class, &Iterator))
+            {
+                MonoMethodHeader* Header = mono_method_get_header(Method);
+                if (!Header)
+                {
+                    continue;
+                }
+
+                uint32 CodeSize = 0;
+                uint32 MaxStack = 0;
+                const unsigned char* Code = mono_method_header_get_code(Header, &CodeSize, &MaxStack);
+
+                const uint32 Token = mono_method_get_token(Method);
+                OutDelta.Append(reinterpret_cast<const uint8*>(&Token), sizeof(Token));
+                OutDelta.Append(reinterpret_cast<const uint8*>(&CodeSize), sizeof(CodeSize));
+                OutDelta.Append(Code, CodeSize);
+
+                mono_metadata_free_mh(Header);
+            }
+        }
+    }
+#endif
+
+    /**
+     * Get what the backend of this platform takes to replace method bodies
+     * Building it is the editor's work, so it isn't part of the measured time.
+     * @return false if the backend of this platform can't replace method bodies
+     */
+    static bool GetMethodBodyReloadData(const FString& AssemblyName, const TArray<uint8>& ModifiedData, TArray<uint8>& OutReloadData)
+    {
+#if PLATFORM_IOS
+        // The modified variant has the same identity as the base, load it in a domain of its own
+        MonoDomain* OriginalDomain = mono_domain_get();
+        MonoDomain* DeltaDomain = mono_domain_create_appdomain(TCHAR_TO_ANSI(*(AssemblyName + TEXT("_Delta"))), nullptr);
+        mono_domain_set(DeltaDomain, false);
+
+        if (MonoAssembly* ModifiedAssembly = LoadAssemblyFromData(AssemblyName, ModifiedData))
+        {
+            CreateMethodBodyDelta(mono_assembly_get_image(ModifiedAssembly), OutReloadData);
+        }
+
+        mono_domain_set(OriginalDomain, false);
+        mono_domain_unload(DeltaDomain);
+        return true;
+#elif PLATFORM_ANDROID
+        OutReloadData = ModifiedData;
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * Replace the method bodies of a loaded assembly with the ones of the modified variant
+     */
+    static bool RunMethodBodyReload(const FString& AssemblyName, MonoAssembly* Assembly, const TArray<uint8>& ReloadData)
+    {
+#if PLATFORM_IOS
+        UnrealSharp::iOS::RuntimeHotReload::InitializeRuntimeHotReload();
+        UnrealSharp::iOS::RuntimeHotReload::RegisterAssemblyForHotReload(Assembly);
+
+        return UnrealSharp::iOS::RuntimeHotReload::HotReloadAssemblyRuntime(AssemblyName, ReloadData);
+#elif PLATFORM_ANDROID
+        UnrealSharp::Android::HotReload::InitializeAndroidHotReload();
+        UnrealSharp::Android::HotReload::RegisterAssemblyForAndroidHotReload(Assembly);
+
+        return UnrealSharp::Android::HotReload::HotReloadAssemblyAndroid(AssemblyName, ReloadData);
+#else
+        return false;
+#endif
+    }
+
+    static double GetMedian(TArray<double>& Samples)
+    {
+        Samples.Sort();
+        return Samples.IsEmpty() ? 0.0 : Samples[Samples.Num() / 2];
+    }
+
+    static void WriteResults(const TArray<FBenchmarkResult>& Results)
+    {
+        const FString Backend = GetCurrentStrategyName();
+        const FString ReportPrefix = FString::Printf(TEXT("HotReloadBenchmark_%s"), FPlatformProperties::IniPlatformName());
+
+        UnrealSharp::Benchmark::WriteResults<FBenchmarkResult>(Results, TEXT("HotReloadBenchmarks.csv"),
+            TEXT("Backend,TypeCount,Phase,Milliseconds"), ReportPrefix,
+            [&Backend](const FBenchmarkResult& Result)
+            {
+                return FString::Printf(TEXT("%s,%d,%s,%.3f"), *Backend, Result.TypeCount, *Result.Phase, Result.Milliseconds);
+            },
+            [&Results, &Backend](FJsonObject& Report)
+            {
+                Report.SetStringField(TEXT("Backend"), Backend);
+                Report.SetNumberField(TEXT("Iterations"), NumIterations);
+
+                TArray<TSharedPtr<FJsonValue>> ResultValues;
+                ResultValues.Reserve(Results.Num());
+
+                for (const FBenchmarkResult& Result : Results)
+                {
+                    TSharedRef<FJsonObject> ResultObject = MakeShared<FJsonObject>();
+                    ResultObject->SetNumberField(TEXT("TypeCount"), Result.TypeCount);
+                    ResultObject->SetStringField(TEXT("Phase"), Result.Phase);
+                    ResultObject->SetNumberField(TEXT("Milliseconds"), Result.Milliseconds);
+                    ResultValues.Add(MakeShared<FJsonValueObject>(ResultObject));
+                }
+
+                Report.SetArrayField(TEXT("Results"), ResultValues);
+            });
+    }
+}
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FHotReloadBenchmarkTest, "UnrealSharp.HotReload.Benchmark",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+void FHotReloadBenchmarkTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+    const int32 TypeCounts[] = { 100, 1000, 10000 };
+
+    for (int32 TypeCount : TypeCounts)
+    {
+        OutBeautifiedNames.Add(FString::Printf(TEXT("%d Types"), TypeCount));
+        OutTestCommands.Add(FString::FromInt(TypeCount));
+    }
+}
+
+bool FHotReloadBenchmarkTest::RunTest(const FString& Parameters)
+{
+    using namespace UnrealSharp::HotReload::Benchmark;
+
+    const int32 TypeCount = FCString::Atoi(*Parameters);
+    const FString AssemblyName = GetAssemblyName(TypeCount);
+
+    FString Error;
+    if (!EnsureSyntheticAssemblies(TypeCount, Error))
+    {
+        AddError(Error);
+        return false;
+    }
+
+    TArray<uint8> BaseData;
+    TArray<uint8> ModifiedData;
+    if (!TestTrue(TEXT("Synthetic assemblies should load"), FFileHelper::LoadFileToArray(BaseData, *GetAssemblyPath(TypeCount, TEXT("Base")))
+        && FFileHelper::LoadFileToArray(ModifiedData, *GetAssemblyPath(TypeCount, TEXT("Modified")))))
+    {
+        return false;
+    }
+
+#if PLATFORM_WINDOWS
+    UnrealSharp::Windows::HotReload::InitializeWindowsHotReload();
+#endif
+
+    TArray<uint8> MethodBodyReloadData;
+    const bool bSupportsMethodBodyReload = GetMethodBodyReloadData(AssemblyName, ModifiedData, MethodBodyReloadData);
+
+    TArray<double> ColdStartSamples;
+    TArray<double> MetadataParseSamples;
+    TArray<double> TypeBuildSamples;
+    TArray<double> FullReloadSamples;
+    TArray<double> MethodBodyReloadSamples;
+
+    MonoDomain* OriginalDomain = mono_domain_get();
+
+    for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+    {
+        // Cold start
+        double StartTime = FPlatformTime::Seconds();
+
+        MonoDomain* BenchmarkDomain = mono_domain_create_appdomain(TCHAR_TO_ANSI(*FString::Printf(TEXT("%s_%d"), *AssemblyName, Iteration)), nullptr);
+        if (!TestNotNull(TEXT("Benchmark domain should be created"), BenchmarkDomain))
+        {
+            return false;
+        }
+
+        mono_domain_set(BenchmarkDomain, false);
+        MonoAssembly* Assembly = LoadAssemblyFromData(AssemblyName, BaseData);
+
+        ColdStartSamples.Add((FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+        if (!TestNotNull(TEXT("Synthetic assembly should load in the benchmark domain"), Assembly))
+        {
+            mono_domain_set(OriginalDomain, false);
+            mono_domain_unload(BenchmarkDomain);
+            return false;
+        }
+
+        MonoImage* Image = mono_assembly_get_image(Assembly);
+
+        // Metadata parse
+        StartTime = FPlatformTime::Seconds();
+
+        TArray<MonoClass*> Types;
+        GetTypes(Image, Types);
+
+        int32 NumMethods = 0;
+        for (MonoClass* Class : Types)
+        {
+            void* Iterator = nullptr;
+            while (mono_class_get_methods(Class, &Iterator))
+            {
+                NumMethods++;
+            }
+        }
+
+        MetadataParseSamples.Add((FPlatformTime::Seconds() - StartTime) * 1000.0);
+        TestEqual(TEXT("Every synthetic type should resolve"), Types.Num(), TypeCount);
+
+        // Type build
+        StartTime = FPlatformTime::Seconds();
+
+        for (MonoClass* Class : Types)
+        {
+            if (MonoVTable* VTable = mono_class_vtable(BenchmarkDomain, Class))
+            {
+                mono_runtime_class_init(VTable);
+            }
+        }
+
+        TypeBuildSamples.Add((FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+        // Method body reload, before the full reload retires the assembly
+        if (bSupportsMethodBodyReload)
+        {
+            StartTime = FPlatformTime::Seconds();
+            const bool bMethodBodyReloadSucceeded = RunMethodBodyReload(AssemblyName, Assembly, MethodBodyReloadData);
+            MethodBodyReloadSamples.Add((FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+            TestTrue(TEXT("Method body reload should succeed"), bMethodBodyReloadSucceeded);
+        }
+
+        // Full reload, the backend switches to a domain of its own
+        StartTime = FPlatformTime::Seconds();
+        const bool bFullReloadSucceeded = UnrealSharp::HotReload::HotReloadAssemblyMonoAppDomain(AssemblyName, ModifiedData);
+        FullReloadSamples.Add((FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+        TestTrue(TEXT("Full reload should succeed"), bFullReloadSucceeded);
+
+        MonoDomain* ReloadDomain = mono_domain_get();
+        mono_domain_set(OriginalDomain, false);
+
+        // The Windows backend keeps its domain and retires it on its next reload
+#if !PLATFORM_WINDOWS
+        if (ReloadDomain != BenchmarkDomain && ReloadDomain != OriginalDomain)
+        {
+            mono_domain_unload(ReloadDomain);
+        }
+#endif
+
+        mono_domain_unload(BenchmarkDomain);
+
+        UE_LOG(LogTemp, Verbose, TEXT("UnrealSharp: Benchmark iteration %d on %d types and %d methods done"), Iteration, Types.Num(), NumMethods);
+    }
+
+    TArray<FBenchmarkResult> Results;
+    Results.Add({ TypeCount, TEXT("ColdStart"), GetMedian(ColdStartSamples) });
+    Results.Add({ TypeCount, TEXT("MetadataParse"), GetMedian(MetadataParseSamples) });
+    Results.Add({ TypeCount, TEXT("TypeBuild"), GetMedian(TypeBuildSamples) });
+    Results.Add({ TypeCount, TEXT("FullReload"), GetMedian(FullReloadSamples) });
+
+    if (!MethodBodyReloadSamples.IsEmpty())
+    {
+        Results.Add({ TypeCount, TEXT("MethodBodyReload"), GetMedian(MethodBodyReloadSamples) });
+    }
+
+    for (const FBenchmarkResult& Result : Results)
+    {
+        AddInfo(FString::Printf(TEXT("%d types, %s: %.3f ms"), Result.TypeCount, *Result.Phase, Result.Milliseconds));
+    }
+
+    WriteResults(Results);
+    return true;
+}
+
+#endif // WITH_MONO_RUNTIME
@@ -0,0 +1,792 @@
+#include "HotReload/UnrealSharp_HotReloadTransport.h"
+#include "HotReload/UnrealSharp_UnifiedHotReload.h"
+#include "Utils/CSChunkedCompression.h"
+#include "Async/Async.h"
+#include "Common/TcpSocketBuilder.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "Interfaces/IPv4/IPv4Address.h"
+#include "Interfaces/IPv4/IPv4Endpoint.h"
+#include "Misc/SecureHash.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+#include <atomic>
+
+namespace UnrealSharp::HotReload::Transport
+{
+    namespace
+    {
+        constexpr uint32 DeltaMagic = 0x44535355; // "USSD"
+
+        // Size of the base blocks a delta can copy from. Smaller blocks find more matches but make the block index bigger.
+        constexpr int32 DeltaBlockSize = 64;
+
+        // Limit for a single message once the editor is authenticated, well above a compressed user assembly
+        constexpr uint32 MaxFrameSize = 32 * 1024 * 1024;
+
+        // Limit for the handshake messages, anything bigger isn't an editor
+        constexpr uint32 MaxHandshakeFrameSize = 64;
+
+        // Time the editor has to answer the challenge before the device drops the connection
+        constexpr double HandshakeTimeoutSeconds = 5.0;
+
+        constexpr int32 ChallengeSize = sizeof(FGuid);
+
+        enum class EDeltaOp : uint8
+        {
+            Copy,
+            Literal,
+        };
+
+        enum class EMessageType : uint8
+        {
+            QueryVersion,   // Editor -> device: assembly name
+            Version,        // Device -> editor: content hash of the running version, empty if there is none
+            FullAssembly,   // Editor -> device: assembly name, content hash, compressed assembly
+            DeltaAssembly,  // Editor -> device: assembly name, base hash, content hash, compressed delta
+            Result,         // Device -> editor: whether the assembly was reloaded
+        };
+
+        /**
+         * Adler-style rolling checksum over one block, so the block index can be probed at every byte offset
+         */
+        struct FRollingChecksum
+        {
+            uint32 A = 0;
+            uint32 B = 0;
+
+            void Reset(const uint8* Data, int32 Size)
+            {
+                A = 0;
+                B = 0;
+                for (int32 i = 0; i < Size; ++i)
+                {
+                    A += Data[i];
+                    B += (Size - i) * Data[i];
+                }
+            }
+
+            void Roll(uint8 Out, uint8 In, int32 Size)
+            {
+                A = A - Out + In;
+                B = B - Size * Out + A;
+            }
+
+            uint32 Get() const { return (A & 0xFFFF) | (B << 16); }
+        };
+
+        void WriteLiteral(FMemoryWriter& Writer, const uint8* Data, int32 Size)
+        {
+            if (Size <= 0)
+            {
+                return;
+            }
+
+            EDeltaOp Op = EDeltaOp::Literal;
+            Writer << Op;
+            Writer << Size;
+            Writer.Serialize(const_cast<uint8*>(Data), Size);
+        }
+
+        bool SendAll(FSocket* Socket, const uint8* Data, int32 Size)
+        {
+            while (Size > 0)
+            {
+                int32 BytesSent = 0;
+                if (!Socket->Send(Data, Size, BytesSent) || BytesSent <= 0)
+                {
+                    return false;
+                }
+
+                Data += BytesSent;
+                Size -= BytesSent;
+            }
+
+            return true;
+        }
+
+        // Receives exactly Size bytes. Gives up when the connection closes, when bStop is set while waiting, or once the deadline passed.
+        bool ReceiveAll(FSocket* Socket, uint8* Data, int32 Size, const std::atomic<bool>* bStop, double Deadline)
+        {
+            while (Size > 0)
+            {
+                if (bStop && !Socket->Wait(ESocketWaitConditions::WaitForRead, FTimespan::FromMilliseconds(100)))
+                {
+                    if (*bStop || Socket->GetConnectionState() != SCS_Connected || (Deadline > 0.0 && FPlatformTime::Seconds() > Deadline))
+                    {
+                        return false;
+                    }
+
+                    continue;
+                }
+
+                int32 BytesRead = 0;
+                if (!Socket->Recv(Data, Size, BytesRead) || BytesRead <= 0)
+                {
+                    return false;
+                }
+
+                Data += BytesRead;
+                Size -= BytesRead;
+            }
+
+            return true;
+        }
+
+        bool SendFrame(FSocket* Socket, const TArray<uint8>& Payload)
+        {
+            uint32 Size = Payload.Num();
+            return SendAll(Socket, reinterpret_cast<const uint8*>(&Size), sizeof(Size)) && SendAll(Socket, Payload.GetData(), Payload.Num());
+        }
+
+        bool ReceiveFrame(FSocket* Socket, TArray<uint8>& OutPayload, const std::atomic<bool>* bStop = nullptr,
+                          uint32 MaxSize = MaxFrameSize, double Deadline = 0.0)
+        {
+            uint32 Size = 0;
+            if (!ReceiveAll(Socket, reinterpret_cast<uint8*>(&Size), sizeof(Size), bStop, Deadline) || Size > MaxSize)
+            {
+                return false;
+            }
+
+            OutPayload.SetNumUninitialized(Size);
+            return ReceiveAll(Socket, OutPayload.GetData(), Size, bStop, Deadline);
+        }
+
+        // Proof that the editor knows the shared secret, without sending the secret itself
+        TArray<uint8> SignChallenge(const FString& SharedSecret, const TArray<uint8>& Challenge)
+        {
+            const FTCHARToUTF8 Secret(*SharedSecret);
+
+            TArray<uint8> Signature;
+            Signature.SetNumUninitialized(FSHA1::DigestSize);
+            FSHA1::HMACBuffer(Secret.Get(), Secret.Length(), Challenge.GetData(), Challenge.Num(), Signature.GetData());
+            return Signature;
+        }
+
+        // Takes the same time no matter where the first difference is
+        bool ConstantTimeEquals(const TArray<uint8>& A, const TArray<uint8>& B)
+        {
+            if (A.Num() != B.Num())
+            {
+                return false;
+            }
+
+            uint8 Difference = 0;
+            for (int32 i = 0; i < A.Num(); ++i)
+            {
+                Difference |= A[i] ^ B[i];
+            }
+
+            return Difference == 0;
+        }
+
+        void DestroySocket(FSocket*& Socket)
+        {
+            if (Socket)
+            {
+                Socket->Close();
+                ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Socket);
+                Socket = nullptr;
+            }
+        }
+    }
+
+    FString CalculateContentHash(const TArray<uint8>& AssemblyData)
+    {
+        return FMD5::HashBytes(AssemblyData.GetData(), AssemblyData.Num());
+    }
+
+    void CreateAssemblyDelta(const TArray<uint8>& BaseData, const TArray<uint8>& NewData, TArray<uint8>& OutDelta)
+    {
+        TRACE_CPUPROFILER_EVENT_SCOPE(UnrealSharp::HotReload::Transport::CreateAssemblyDelta);
+
+        OutDelta.Reset();
+        FMemoryWriter Writer(OutDelta);
+
+        uint32 Magic = DeltaMagic;
+        int32 NewSize = NewData.Num();
+        Writer << Magic;
+        Writer << NewSize;
+
+        // Index every whole block of the base by its checksum
+        const int32 NumBaseBlocks = BaseData.Num() / DeltaBlockSize;
+        TMultiMap<uint32, int32> BaseBlocks;
+        BaseBlocks.Reserve(NumBaseBlocks);
+
+        FRollingChecksum Checksum;
+        for (int32 Block = 0; Block < NumBaseBlocks; ++Block)
+        {
+            Checksum.Reset(BaseData.GetData() + Block * DeltaBlockSize, DeltaBlockSize);
+            BaseBlocks.Add(Checksum.Get(), Block * DeltaBlockSize);
+        }
+
+        const uint8* New = NewData.GetData();
+        const uint8* Base = BaseData.GetData();
+
+        int32 LiteralStart = 0;
+        int32 Offset = 0;
+        bool bChecksumValid = false;
+
+        TArray<int32, TInlineAllocator<8>> Candidates;
+
+        while (Offset + DeltaBlockSize <= NewSize)
+        {
+            if (!bChecksumValid)
+            {
+                Checksum.Reset(New + Offset, DeltaBlockSize);
+                bChecksumValid = true;
+            }
+
+            Candidates.Reset();
+            BaseBlocks.MultiFind(Checksum.Get(), Candidates);
+
+            int32 MatchOffset = INDEX_NONE;
+            for (int32 Candidate : Candidates)
+            {
+                if (FMemory::Memcmp(Base + Candidate, New + Offset, DeltaBlockSize) == 0)
+                {
+                    MatchOffset = Candidate;
+                    break;
+                }
+            }
+
+            if (MatchOffset == INDEX_NONE)
+            {
+                if (Offset + DeltaBlockSize < NewSize)
+                {
+                    Checksum.Roll(New[Offset], New[Offset + DeltaBlockSize], DeltaBlockSize);
+                }
+
+                ++Offset;
+                continue;
+            }
+
+            // Extend the match past the block, an unchanged region is usually much longer than one block
+            int32 MatchLength = DeltaBlockSize;
+            while (Offset + MatchLength < NewSize && MatchOffset + MatchLength < BaseData.Num()
+                && New[Offset + MatchLength] == Base[MatchOffset + MatchLength])
+            {
+                ++MatchLength;
+            }
+
+            WriteLiteral(Writer, New + LiteralStart, Offset - LiteralStart);
+
+            EDeltaOp Op = EDeltaOp::Copy;
+            Writer << Op;
+            Writer << MatchOffset;
+            Writer << MatchLength;
+
+            Offset += MatchLength;
+            LiteralStart = Offset;
+            bChecksumValid = false;
+        }
+
+        WriteLiteral(Writer, New + LiteralStart, NewSize - LiteralStart);
+    }
+
+    bool ApplyAssemblyDelta(const TArray<uint8>& BaseData, const TArray<uint8>& Delta, TArray<uint8>& OutNewData)
+    {
+        TRACE_CPUPROFILER_EVENT_SCOPE(UnrealSharp::HotReload::Transport::ApplyAssemblyDelta);
+
+        FMemoryReader Reader(Delta);
+
+        uint32 Magic = 0;
+        int32 NewSize = 0;
+        Reader << Magic;
+        Reader << NewSize;
+
+        if (Reader.IsError() || Magic != DeltaMagic || NewSize < 0)
+        {
+            return false;
+        }
+
+        OutNewData.Reset(NewSize);
+
+        while (!Reader.AtEnd())
+        {
+            EDeltaOp Op;
+            Reader << Op;
+
+            if (Op == EDeltaOp::Copy)
+            {
+                int32 CopyOffset = 0;
+                int32 CopyLength = 0;
+                Reader << CopyOffset;
+                Reader << CopyLength;
+
+                if (Reader.IsError() || CopyOffset < 0 || CopyLength < 0 || CopyOffset > BaseData.Num() - CopyLength)
+                {
+                    return false;
+                }
+
+                OutNewData.Append(BaseData.GetData() + CopyOffset, CopyLength);
+            }
+            else if (Op == EDeltaOp::Literal)
+            {
+                int32 LiteralLength = 0;
+                Reader << LiteralLength;
+
+                if (Reader.IsError() || LiteralLength < 0 || LiteralLength > Reader.TotalSize() - Reader.Tell())
+                {
+                    return false;
+                }
+
+                const int32 Start = OutNewData.AddUninitialized(LiteralLength);
+                Reader.Serialize(OutNewData.GetData() + Start, LiteralLength);
+            }
+            else
+            {
+                return false;
+            }
+
+            if (Reader.IsError() || OutNewData.Num() > NewSize)
+            {
+                return false;
+            }
+        }
+
+        return OutNewData.Num() == NewSize;
+    }
+
+    /**
+     * Device side server, serves one editor connection at a time on its own thread.
+     * Every connection has to sign a random challenge with the shared secret before anything else is accepted.
+     */
+    class FTransportServer : public FRunnable
+    {
+    public:
+        FTransportServer(FSocket* InListenSocket, const FString& InSharedSecret)
+            : ListenSocket(InListenSocket)
+            , SharedSecret(InSharedSecret)
+        {
+        }
+
+        virtual ~FTransportServer() override
+        {
+            DestroySocket(ListenSocket);
+        }
+
+        virtual uint32 Run() override
+        {
+            while (!bStopping)
+            {
+                bool bHasPendingConnection = false;
+                if (!ListenSocket->WaitForPendingConnection(bHasPendingConnection, FTimespan::FromMilliseconds(250)) || !bHasPendingConnection)
+                {
+                    continue;
+                }
+
+                FSocket* Connection = ListenSocket->Accept(TEXT("UnrealSharp Hot Reload Connection"));
+                if (!Connection)
+                {
+                    continue;
+                }
+
+                if (Authenticate(Connection))
+                {
+                    UE_LOG(LogTemp, Log, TEXT("UnrealSharp Hot Reload Transport: Editor connected"));
+                    ServeConnection(Connection);
+                    UE_LOG(LogTemp, Log, TEXT("UnrealSharp Hot Reload Transport: Editor disconnected"));
+                }
+                else
+                {
+                    UE_LOG(LogTemp, Warning, TEXT("UnrealSharp Hot Reload Transport: Rejected a connection that failed the handshake"));
+                }
+
+                DestroySocket(Connection);
+            }
+
+            return 0;
+        }
+
+        virtual void Stop() override
+        {
+            bStopping = true;
+        }
+
+    private:
+        bool Authenticate(FSocket* Connection)
+        {
+            const FGuid Nonce = FGuid::NewGuid();
+            TArray<uint8> Challenge(reinterpret_cast<const uint8*>(&Nonce), ChallengeSize);
+
+            TArray<uint8> Signature;
+            const double Deadline = FPlatformTime::Seconds() + HandshakeTimeoutSeconds;
+            if (!SendFrame(Connection, Challenge) || !ReceiveFrame(Connection, Signature, &bStopping, MaxHandshakeFrameSize, Deadline))
+            {
+                return false;
+            }
+
+            bool bAccepted = ConstantTimeEquals(Signature, SignChallenge(SharedSecret, Challenge));
+
+            TArray<uint8> Response;
+            FMemoryWriter Writer(Response);
+            Writer << bAccepted;
+            return SendFrame(Connection, Response) && bAccepted;
+        }
+
+        void ServeConnection(FSocket* Connection)
+        {
+            TArray<uint8> Request;
+            while (!bStopping && ReceiveFrame(Connection, Request, &bStopping))
+            {
+                TArray<uint8> Response;
+                if (!HandleRequest(Request, Response) || !SendFrame(Connection, Response))
+                {
+                    return;
+                }
+            }
+        }
+
+        bool HandleRequest(const TArray<uint8>& Request, TArray<uint8>& OutResponse)
+        {
+            FMemoryReader Reader(Request);
+            FMemoryWriter Writer(OutResponse);
+
+            EMessageType Type;
+            FString AssemblyName;
+            Reader << Type;
+            Reader << AssemblyName;
+
+            if (Reader.IsError())
+            {
+                return false;
+            }
+
+            if (Type == EMessageType::QueryVersion)
+            {
+                const FAssemblyVersion* Current = CurrentAssemblies.Find(AssemblyName);
+                FString ContentHash = Current ? Current->ContentHash : FString();
+
+                EMessageType ResponseType = EMessageType::Version;
+                Writer << ResponseType;
+                Writer << ContentHash;
+                return true;
+            }
+
+            if (Type != EMessageType::FullAssembly && Type != EMessageType::DeltaAssembly)
+            {
+                return false;
+            }
+
+            FString BaseHash;
+            if (Type == EMessageType::DeltaAssembly)
+            {
+                Reader << BaseHash;
+            }
+
+            FString ContentHash;
+            TArray<uint8> Compressed;
+            Reader << ContentHash;
+            Reader << Compressed;
+
+            bool bSuccess = !Reader.IsError() && ReceiveAssembly(AssemblyName, Type, BaseHash, ContentHash, Compressed);
+
+            EMessageType ResponseType = EMessageType::Result;
+            Writer << ResponseType;
+            Writer << bSuccess;
+            return true;
+        }
+
+        bool ReceiveAssembly(const FString& AssemblyName, EMessageType Type, const FString& BaseHash, const FString& ContentHash, const TArray<uint8>& Compressed)
+        {
+            TArray<uint8> Payload;
+            if (!FCSChunkedCompression::Decompress(Compressed, Payload))
+            {
+                UE_LOG(LogTemp, Error, TEXT("UnrealSharp Hot Reload Transport: Failed to decompress '%s'"), *AssemblyName);
+                return false;
+            }
+
+            TArray<uint8> AssemblyData;
+            if (Type == EMessageType::DeltaAssembly)
+            {
+                const FAssemblyVersion* Current = CurrentAssemblies.Find(AssemblyName);
+                if (!Current || Current->ContentHash != BaseHash || !ApplyAssemblyDelta(Current->Data, Payload, AssemblyData))
+                {
+                    UE_LOG(LogTemp, Error, TEXT("UnrealSharp Hot Reload Transport: Failed to apply delta to '%s'"), *AssemblyName);
+                    return false;
+                }
+            }
+            else
+            {
+                AssemblyData = MoveTemp(Payload);
+            }
+
+            if (CalculateContentHash(AssemblyData) != ContentHash)
+            {
+                UE_LOG(LogTemp, Error, TEXT("UnrealSharp Hot Reload Transport: Content hash mismatch for '%s'"), *AssemblyName);
+                return false;
+            }
+
+            UE_LOG(LogTemp, Log, TEXT("UnrealSharp Hot Reload Transport: Received '%s' (%d bytes over the wire, %d bytes assembly)"),
+                   *AssemblyName, Compressed.Num(), AssemblyData.Num());
+
+            // Hot reload has to happen on the game thread, this thread only waits for it
+            TSharedRef<TPromise<bool>> Promise = MakeShared<TPromise<bool>>();
+            TFuture<bool> Future = Promise->GetFuture();
+            TSharedRef<const TArray<uint8>> SharedData = MakeShared<const TArray<uint8>>(AssemblyData);
+
+            AsyncTask(ENamedThreads::GameThread, [Promise, SharedData, AssemblyName]()
+            {
+                Promise->SetValue(UnrealSharp::HotReload::HotReloadAssembly(AssemblyName, *SharedData));
+            });
+
+            while (!Future.WaitFor(FTimespan::FromMilliseconds(250)))
+            {
+                if (bStopping)
+                {
+                    return false;
+                }
+            }
+
+            if (!Future.Get())
+            {
+                return false;
+            }
+
+            CurrentAssemblies.Add(AssemblyName, FAssemblyVersion{ MoveTemp(AssemblyData), ContentHash });
+            return true;
+        }
+
+        struct FAssemblyVersion
+        {
+            TArray<uint8> Data;
+            FString ContentHash;
+        };
+
+        FSocket* ListenSocket;
+        FString SharedSecret;
+        std::atomic<bool> bStopping{false};
+
+        // Running version of every assembly received, the base of the next delta. Only used on the server thread.
+        TMap<FString, FAssemblyVersion> CurrentAssemblies;
+    };
+
+    static TUniquePtr<FTransportServer> TransportServer;
+    static TUniquePtr<FRunnableThread> TransportServerThread;
+
+    bool StartTransportServer(const FString& SharedSecret, int32 Port, bool bListenOnAllInterfaces)
+    {
+        if (TransportServer.IsValid())
+        {
+            return true;
+        }
+
+        if (SharedSecret.Len() < MinSharedSecretLength)
+        {
+            UE_LOG(LogTemp, Error, TEXT("UnrealSharp Hot Reload Transport: Not listening, the shared secret needs at least %d characters"), MinSharedSecretLength);
+            return false;
+        }
+
+        const FIPv4Endpoint Endpoint(bListenOnAllInterfaces ? FIPv4Address::Any : FIPv4Address::InternalLoopback, Port);
+        FSocket* ListenSocket = FTcpSocketBuilder(TEXT("UnrealSharp Hot Reload Transport"))
+            .AsReusable()
+            .BoundToEndpoint(Endpoint)
+            .Listening(1);
+
+        if (!ListenSocket)
+        {
+            UE_LOG(LogTemp, Error, TEXT("UnrealSharp Hot Reload Transport: Failed to listen on %s"), *Endpoint.ToString());
+            return false;
+        }
+
+        TransportServer = MakeUnique<FTransportServer>(ListenSocket, SharedSecret);
+        TransportServerThread.Reset(FRunnableThread::Create(TransportServer.Get(), TEXT("UnrealSharpHotReloadTransport")));
+
+        UE_LOG(LogTemp, Log, TEXT("UnrealSharp Hot Reload Transport: Listening on %s"), *Endpoint.ToString());
+        return true;
+    }
+
+    void StopTransportServer()
+    {
+        if (!TransportServer.IsValid())
+        {
+            return;
+        }
+
+        // Kill stops the runnable and waits for the thread
+        if (TransportServerThread.IsValid())
+        {
+            TransportServerThread->Kill(true);
+            TransportServerThread.Reset();
+        }
+
+        TransportServer.Reset();
+    }
+
+    bool IsTransportServerRunning()
+    {
+        return TransportServer.IsValid();
+    }
+
+    FHotReloadTransportClient::~FHotReloadTransportClient()
+    {
+        Disconnect();
+    }
+
+    bool FHotReloadTransportClient::Connect(const FString& DeviceAddress, const FString& SharedSecret, int32 Port)
+    {
+        Disconnect();
+
+        FIPv4Address Address;
+        if (!FIPv4Address::Parse(DeviceAddress, Address))
+        {
+            UE_LOG(LogTemp, Error, TEXT("UnrealSharp Hot Reload Transport: Invalid device address '%s'"), *DeviceAddress);
+            return false;
+        }
+
+        ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+        TSharedRef<FInternetAddr> Endpoint = SocketSubsystem->CreateInternetAddr();
+        Endpoint->SetIp(Address.Value);
+        Endpoint->SetPort(Port);
+
+        Socket = FTcpSocketBuilder(TEXT("UnrealSharp Hot Reload Client")).AsBlocking();
+        if (!Socket || !Socket->Connect(*Endpoint))
+        {
+            UE_LOG(LogTemp, Error, TEXT("UnrealSharp Hot Reload Transport: Failed to connect to %s:%d"), *DeviceAddress, Port);
+            DestroySocket(Socket);
+            return false;
+        }
+
+        TArray<uint8> Challenge;
+        TArray<uint8> Response;
+        bool bAccepted = false;
+
+        if (ReceiveFrame(Socket, Challenge, nullptr, MaxHandshakeFrameSize) && SendFrame(Socket, SignChallenge(SharedSecret, Challenge))
+            && ReceiveFrame(Socket, Response, nullptr, MaxHandshakeFrameSize))
+        {
+            FMemoryReader Reader(Response);
+            Reader << bAccepted;
+            bAccepted = bAccepted && !Reader.IsError();
+        }
+
+        if (!bAccepted)
+        {
+            UE_LOG(LogTemp, Error, TEXT("UnrealSharp Hot Reload Transport: %s:%d rejected the handshake, check that both use the same shared secret"), *DeviceAddress, Port);
+            DestroySocket(Socket);
+            return false;
+        }
+
+        // The device keeps its versions across connections, but we can't know which ones it still has
+        SentAssemblies.Empty();
+        return true;
+    }
+
+    void FHotReloadTransportClient::Disconnect()
+    {
+        DestroySocket(Socket);
+    }
+
+    bool FHotReloadTransportClient::SendAssembly(const FString& AssemblyName, const TArray<uint8>& AssemblyData)
+    {
+        TRACE_CPUPROFILER_EVENT_SCOPE(FHotReloadTransportClient::SendAssembly);
+
+        if (!Socket)
+        {
+            return false;
+        }
+
+        // Ask the device which version it is running
+        {
+            TArray<uint8> Query;
+            FMemoryWriter Writer(Query);
+            EMessageType Type = EMessageType::QueryVersion;
+            FString Name = AssemblyName;
+            Writer << Type;
+            Writer << Name;
+
+            if (!SendFrame(Socket, Query))
+            {
+                Disconnect();
+                return false;
+            }
+        }
+
+        FString DeviceHash;
+        {
+            TArray<uint8> Response;
+            if (!ReceiveFrame(Socket, Response))
+            {
+                Disconnect();
+                return false;
+            }
+
+            FMemoryReader Reader(Response);
+            EMessageType Type;
+            Reader << Type;
+            Reader << DeviceHash;
+
+            if (Reader.IsError() || Type != EMessageType::Version)
+            {
+                Disconnect();
+                return false;
+            }
+        }
+
+        const TArray<uint8>* BaseData = SentAssemblies.Find(AssemblyName);
+        const bool bSendDelta = BaseData && !DeviceHash.IsEmpty() && CalculateContentHash(*BaseData) == DeviceHash;
+
+        TArray<uint8> Payload;
+        if (bSendDelta)
+        {
+            CreateAssemblyDelta(*BaseData, AssemblyData, Payload);
+        }
+
+        TArray<uint8> Compressed;
+        if (!FCSChunkedCompression::Compress(bSendDelta ? TConstArrayView64<uint8>(Payload) : TConstArrayView64<uint8>(AssemblyData), FCSChunkedCompressionSettings(), Compressed))
+        {
+            return false;
+        }
+
+        {
+            TArray<uint8> Message;
+            FMemoryWriter Writer(Message);
+            EMessageType Type = bSendDelta ? EMessageType::DeltaAssembly : EMessageType::FullAssembly;
+            FString Name = AssemblyName;
+            FString ContentHash = CalculateContentHash(AssemblyData);
+            Writer << Type;
+            Writer << Name;
+            if (bSendDelta)
+            {
+                Writer << DeviceHash;
+            }
+            Writer << ContentHash;
+            Writer << Compressed;
+
+            if (!SendFrame(Socket, Message))
+            {
+                Disconnect();
+                return false;
+            }
+        }
+
+        bool bSuccess = false;
+        {
+            TArray<uint8> Response;
+            if (!ReceiveFrame(Socket, Response))
+            {
+                Disconnect();
+                return false;
+            }
+
+            FMemoryReader Reader(Response);
+            EMessageType Type;
+            Reader << Type;
+            Reader << bSuccess;
+            bSuccess = bSuccess && !Reader.IsError() && Type == EMessageType::Result;
+        }
+
+        UE_LOG(LogTemp, Log, TEXT("UnrealSharp Hot Reload Transport: Sent '%s' as %s (%d bytes, assembly is %d bytes), %s"),
+               *AssemblyName, bSendDelta ? TEXT("delta") : TEXT("full assembly"), Compressed.Num(), AssemblyData.Num(),
+               bSuccess ? TEXT("reloaded") : TEXT("reload failed"));
+
+        if (bSuccess)
+        {
+            SentAssemblies.Add(AssemblyName, AssemblyData);
+        }
+
+        return bSuccess;
+    }
+}
@@ -1,20 +1,34 @@
 #include "CoreMinimal.h"
 #include "UnrealSharp_PlatformInit.h"
 #include "HotReload/UnrealSharp_UnifiedHotReload.h"
+#include "HotReload/UnrealSharp_HotReloadTransport.h"
 
 #if WITH_MONO_RUNTIME
 #include "mono/jit/jit.h"
 #include "mono/metadata/assembly.h"
 #include "mono/metadata/appdomain.h"
+#include "mono/metadata/attrdefs.h"
 #include "mono/metadata/class.h"
+#include "mono/metadata/debug-helpers.h"
+#include "mono/metadata/image.h"
+#include "mono/metadata/loader.h"
+#include "mono/metadata/metadata.h"
 #include "mono/metadata/object.h"
+#include "mono/metadata/threads.h"
+#include "mono/metadata/tokentype.h"
 #endif
 
+#include <atomic>
+
 #include "HAL/FileManager.h"
 #include "Misc/FileHelper.h"
 #include "Misc/DateTime.h"
+#include "Async/ParallelFor.h"
 #include "Engine/Engine.h"
 #include "CSManager.h"
+#include "CSAssembly.h"
+#include "CSUnrealSharpSettings.h"
+#include "GCOptimizations/CSHotReloadSafetyLock.h"
 
 // Platform-specific hot reload includes
 #if PLATFORM_IOS
@@ -45,28 +59,101 @@
 
 namespace UnrealSharp::HotReload
 {
-    // Hot reload implementation strategy
-    enum class EHotReloadStrategy
+    /**
+     * Everything a strategy does, resolved once when the system is initialized
+     * Only the strategies the target can use are compiled in, see UNREALSHARP_HOTRELOAD_WITH_*
+     */
+    struct FHotReloadStrategyTable
     {
-        DotNetNative,        // Use .NET 9 native hot reload
-        MonoAppDomain,       // Use Mono AppDomain switching
-        MonoMethodReplacement, // Use Mono method body replacement
-        Disabled             // Hot reload not available
+        EHotReloadStrategy Strategy;
+        const TCHAR* Name;
+        const TCHAR* Description;
+        bool (*Initialize)();
+        bool (*HotReload)(const FString& AssemblyName, const TArray<uint8>& AssemblyData);
+        void (*Shutdown)();
+        bool bSupportsMethodBodyReplacement;
+        bool bSupportsAssemblyReplacement;
+        bool bSupportsNewTypeAddition;
+        bool bRequiresRestart;
     };
 
-    // Current runtime information
-    struct FRuntimeInfo
+// Mobile targets only use AppDomain reloads directly, never as their strategy
+#if UNREALSHARP_HOTRELOAD_WITH_APPDOMAIN && !UNREALSHARP_HOTRELOAD_WITH_METHOD_REPLACEMENT
+    static void ShutdownMonoAppDomainHotReload()
     {
-        bool bIsMonoRuntime;
-        bool bIsDotNetNative;
-        bool bIsDesktop;
-        bool bIsMobile;
-        EHotReloadStrategy PreferredStrategy;
-        FString RuntimeVersion;
+#if PLATFORM_WINDOWS
+        UnrealSharp::Windows::HotReload::ShutdownWindowsHotReload();
+#endif
+    }
+
+    static const FHotReloadStrategyTable MonoAppDomainStrategy =
+    {
+        EHotReloadStrategy::MonoAppDomain, TEXT("Mono AppDomain"), TEXT("Mono AppDomain (No Restart)"),
+        &InitializeMonoAppDomainHotReload, &HotReloadAssemblyMonoAppDomain, &ShutdownMonoAppDomainHotReload,
+        true, true, true, false
     };
+#endif
+
+#if UNREALSHARP_HOTRELOAD_WITH_METHOD_REPLACEMENT
+    static void ShutdownMonoMethodReplacementHotReload()
+    {
+#if PLATFORM_IOS
+        UnrealSharp::iOS::RuntimeHotReload::ShutdownRuntimeHotReload();
+#elif PLATFORM_ANDROID
+        UnrealSharp::Android::HotReload::ShutdownAndroidHotReload();
+#endif
+    }
+
+    static const FHotReloadStrategyTable MonoMethodReplacementStrategy =
+    {
+        EHotReloadStrategy::MonoMethodReplacement, TEXT("Mono Method Replacement"), TEXT("Mono Method Replacement (No Restart)"),
+        &InitializeMonoMethodReplacementHotReload, &HotReloadAssemblyMonoMethodReplacement, &ShutdownMonoMethodReplacementHotReload,
+        true, true, false, false
+    };
+#endif
+
+#if UNREALSHARP_HOTRELOAD_WITH_DOTNET
+    // New types are limited in the current .NET hot reload
+    static const FHotReloadStrategyTable DotNetStrategy =
+    {
+        EHotReloadStrategy::DotNetNative, TEXT(".NET Native"), TEXT(".NET Native Hot Reload (No Restart)"),
+        &InitializeDotNetHotReload, &HotReloadAssemblyDotNet, nullptr,
+        true, true, false, false
+    };
+#endif
+
+    static const FHotReloadStrategyTable DisabledStrategy =
+    {
+        EHotReloadStrategy::Disabled, TEXT("Disabled"), TEXT("Disabled"),
+        nullptr, nullptr, nullptr,
+        false, false, false, true
+    };
+
+    /**
+     * Pick the strategy of this target. Everything but the desktop Mono choice is known at compile time.
+     */
+    static const FHotReloadStrategyTable& ResolveStrategy()
+    {
+#if UNREALSHARP_HOTRELOAD_WITH_METHOD_REPLACEMENT
+        return MonoMethodReplacementStrategy;
+#elif WITH_MONO_RUNTIME
+        // Desktop Mono can opt into the .NET runtime's hot reload
+        if (FPlatformMisc::GetEnvironmentVariable(TEXT("UNREAL_SHARP_USE_DOTNET_RUNTIME")) == TEXT("true"))
+        {
+            return DotNetStrategy;
+        }
+
+        return MonoAppDomainStrategy;
+#elif UNREALSHARP_HOTRELOAD_WITH_DOTNET
+        return DotNetStrategy;
+#else
+        return DisabledStrategy;
+#endif
+    }
 
     // Global runtime state
     static FRuntimeInfo CurrentRuntime;
+    static const FHotReloadStrategyTable* ActiveStrategy = &DisabledStrategy;
     static bool bHotReloadSystemInitialized = false;
     static TMap<FString, int32> AssemblyVersions;
     
@@ -95,35 +182,13 @@ namespace UnrealSharp::HotReload
         Runtime.bIsMonoRuntime = true;
         Runtime.bIsDotNetNative = false;
         Runtime.RuntimeVersion = TEXT("Mono 8.0.5");
-        
-        // Choose strategy based on platform with enhanced no-restart support
-        if (Runtime.bIsMobile)
-        {
-            Runtime.PreferredStrategy = EHotReloadStrategy::MonoMethodReplacement;
-            UE_LOG(LogTemp, Log, TEXT("UnrealSharp: Using Mono Method Replacement for mobile (no restart required)"));
-        }
-        else
-        {
-            // Check if user prefers .NET native on desktop
-            FString RuntimePreference = FPlatformMisc::GetEnvironmentVariable(TEXT("UNREAL_SHARP_USE_DOTNET_RUNTIME"));
-            if (RuntimePreference == TEXT("true"))
-            {
-                Runtime.PreferredStrategy = EHotReloadStrategy::DotNetNative;
-                UE_LOG(LogTemp, Log, TEXT("UnrealSharp: Using .NET Native runtime (no restart required)"));
-            }
-            else
-            {
-                Runtime.PreferredStrategy = EHotReloadStrategy::MonoAppDomain;
-                UE_LOG(LogTemp, Log, TEXT("UnrealSharp: Using Mono AppDomain for desktop (no restart required)"));
-            }
-        }
 #else
         Runtime.bIsMonoRuntime = false;
         Runtime.bIsDotNetNative = true;
         Runtime.RuntimeVersion = TEXT(".NET 9.0");
-        Runtime.PreferredStrategy = EHotReloadStrategy::DotNetNative;
 #endif
 
+        Runtime.PreferredStrategy = ResolveStrategy().Strategy;
         return Runtime;
     }
 
@@ -134,45 +199,32 @@ namespace UnrealSharp::HotReload
     {
         UE_LOG(LogTemp, Log, TEXT("UnrealSharp: Initializing Unified Hot Reload System"));
 
-        // Detect current runtime
+        // Detect current runtime, the strategy is resolved once here and used for every reload
         CurrentRuntime = DetectRuntime();
+        ActiveStrategy = &ResolveStrategy();
 
         UE_LOG(LogTemp, Log, TEXT("UnrealSharp: Runtime detected - %s on %s"), 
                *CurrentRuntime.RuntimeVersion, 
                CurrentRuntime.bIsDesktop ? TEXT("Desktop") : TEXT("Mobile"));
 
-        bool bInitSuccess = false;
-
-        // Initialize appropriate hot reload subsystem
-        switch (CurrentRuntime.PreferredStrategy)
+        if (!ActiveStrategy->Initialize)
         {
-            case EHotReloadStrategy::DotNetNative:
-                bInitSuccess = InitializeDotNetHotReload();
-                break;
-                
-            case EHotReloadStrategy::MonoAppDomain:
-                bInitSuccess = InitializeMonoAppDomainHotReload();
-                break;
-                
-            case EHotReloadStrategy::MonoMethodReplacement:
-                bInitSuccess = InitializeMonoMethodReplacementHotReload();
-                break;
-                
-            default:
-                UE_LOG(LogTemp, Warning, TEXT("UnrealSharp: Hot reload disabled or not supported"));
-                return false;
+            UE_LOG(LogTemp, Warning, TEXT("UnrealSharp: Hot reload disabled or not supported"));
+            return false;
         }
 
+        const bool bInitSuccess = ActiveStrategy->Initialize();
+
         if (bInitSuccess)
         {
             bHotReloadSystemInitialized = true;
-            UE_LOG(LogTemp, Log, TEXT("UnrealSharp: Unified Hot Reload System ready with strategy: %s"), 
-                   GetStrategyName(CurrentRuntime.PreferredStrategy));
+            UE_LOG(LogTemp, Log, TEXT("UnrealSharp: Unified Hot Reload System ready with strategy: %s"), ActiveStrategy->Name);
         }
 
         return bInitSuccess;
     }
 
+#if UNREALSHARP_HOTRELOAD_WITH_DOTNET
     /**
      * Initialize .NET native hot reload (for .NET 9 runtime)
      */
@@ -192,7 +244,9 @@ namespace UnrealSharp::HotReload
         UE_LOG(LogTemp, Warning, TEXT("UnrealSharp: .NET native hot reload not yet implemented, falling back to file watching"));
         return InitializeFileWatchingHotReload();
     }
+#endif
 
+#if UNREALSHARP_HOTRELOAD_WITH_APPDOMAIN
     /**
      * Initialize Mono AppDomain hot reload (desktop Mono)
      */
@@ -200,7 +254,6 @@ namespace UnrealSharp::HotReload
     {
         UE_LOG(LogTemp, Log, TEXT("UnrealSharp: Initializing Mono AppDomain Hot Reload"));
 
-#if WITH_MONO_RUNTIME
         // Use platform-specific implementations for optimal performance
 #if PLATFORM_WINDOWS
         // Use Windows-optimized AppDomain hot reload
@@ -227,13 +280,11 @@ namespace UnrealSharp::HotReload
 #else
         UE_LOG(LogTemp, Error, TEXT("UnrealSharp: Unsupported desktop platform for AppDomain hot reload"));
         return false;
-#endif
-#else
-        UE_LOG(LogTemp, Error, TEXT("UnrealSharp: Mono runtime not available for AppDomain hot reload"));
-        return false;
 #endif
     }
+#endif
 
+#if UNREALSHARP_HOTRELOAD_WITH_METHOD_REPLACEMENT
     /**
      * Initialize Mono method replacement hot reload (mobile Mono)
      */
@@ -241,22 +292,16 @@ namespace UnrealSharp::HotReload
     {
         UE_LOG(LogTemp, Log, TEXT("UnrealSharp: Initializing Mono Method Replacement Hot Reload"));
 
-#if WITH_MONO_RUNTIME && (PLATFORM_IOS || PLATFORM_ANDROID)
         // Use our advanced iOS/Android hot reload system
-        #if PLATFORM_IOS
+#if PLATFORM_IOS
         return UnrealSharp::iOS::RuntimeHotReload::InitializeRuntimeHotReload();
-        #elif PLATFORM_ANDROID
-        return UnrealSharp::Android::HotReload::InitializeAndroidHotReload();
-        #else
-        UE_LOG(LogTemp, Warning, TEXT("UnrealSharp: Method replacement hot reload not implemented for this mobile platform"));
-        return false;
-        #endif
 #else
-        UE_LOG(LogTemp, Error, TEXT("UnrealSharp: Method replacement hot reload only available on mobile Mono"));
-        return false;
+        return UnrealSharp::Android::HotReload::InitializeAndroidHotReload();
 #endif
     }
+#endif
 
+#if UNREALSHARP_HOTRELOAD_WITH_DOTNET
     /**
      * Fallback file watching hot reload (simple approach)
      */
@@ -275,6 +320,129 @@ namespace UnrealSharp::HotReload
         UE_LOG(LogTemp, Log, TEXT("UnrealSharp: File watching hot reload initialized"));
         return true;
     }
+#endif
+
+#if WITH_MONO_RUNTIME
+    // IL hashes of the last version of each reloaded assembly, by method signature
+    static TMap<FString, TMap<FString, uint32>> MethodBodyHashesByAssembly;
+
+    /**
+     * Compile the methods of a reloaded Mono assembly whose IL changed since its last version, on worker threads
+     */
+    static int32 PrecompileChangedMonoMethods(const FString& AssemblyName)
+    {
+        MonoAssemblyName* Name = mono_assembly_name_new(TCHAR_TO_UTF8(*AssemblyName));
+        if (!Name)
+        {
+            return 0;
+        }
+
+        // The backends leave the domain the reloaded assembly lives in as the current one
+        MonoAssembly* Assembly = mono_assembly_loaded(Name);
+        mono_assembly_name_free(Name);
+
+        if (!Assembly)
+        {
+            return 0;
+        }
+
+        MonoDomain* Domain = mono_domain_get();
+        MonoImage* Image = mono_assembly_get_image(Assembly);
+
+        const TMap<FString, uint32>* PreviousHashes = MethodBodyHashesByAssembly.Find(AssemblyName);
+        TMap<FString, uint32> MethodBodyHashes;
+        TArray<MonoMethod*> ChangedMethods;
+
+        // Row 1 is the <Module> pseudo type
+        const int32 NumTypes = mono_image_get_table_rows(Image, MONO_TABLE_TYPEDEF);
+        for (int32 Row = 2; Row <= NumTypes; ++Row)
+        {
+            // Open generic code can only be compiled once it's instantiated
+            MonoClass* Class = mono_class_get(Image, MONO_TOKEN_TYPE_DEF | Row);
+            if (!Class || mono_class_is_generic(Class))
+            {
+                continue;
+            }
+
+            void* Iterator = nullptr;
+            while (MonoMethod* Method = mono_class_get_methods(Class, &Iterator))
+            {
+                if ((mono_method_get_flags(Method, nullptr) & MONO_METHOD_ATTR_ABSTRACT) || mono_signature_is_generic(mono_method_signature(Method)))
+                {
+                    continue;
+                }
+
+                MonoMethodHeader* Header = mono_method_get_header(Method);
+                if (!Header)
+                {
+                    continue;
+                }
+
+                uint32 CodeSize = 0;
+                uint32 MaxStack = 0;
+                const unsigned char* Code = mono_method_header_get_code(Header, &CodeSize, &MaxStack);
+                const uint32 BodyHash = FCrc::MemCrc32(Code, CodeSize);
+                mono_metadata_free_mh(Header);
+
+                char* FullName = mono_method_full_name(Method, true);
+                FString Signature = UTF8_TO_TCHAR(FullName);
+                mono_free(FullName);
+
+                // Without a previous version everything counts as changed
+                const uint32* PreviousHash = PreviousHashes ? PreviousHashes->Find(Signature) : nullptr;
+                if (!PreviousHash || *PreviousHash != BodyHash)
+                {
+                    ChangedMethods.Add(Method);
+                }
+
+                MethodBodyHashes.Add(MoveTemp(Signature), BodyHash);
+            }
+        }
+
+        MethodBodyHashesByAssembly.Add(AssemblyName, MoveTemp(MethodBodyHashes));
+
+        std::atomic<int32> NumCompiled{0};
+        ParallelFor(ChangedMethods.Num(), [&ChangedMethods, &NumCompiled, Domain](int32 Index)
+        {
+            // Workers stay attached to the runtime, attaching again only switches them to the domain of this reload
+            mono_thread_attach(Domain);
+
+            if (mono_compile_method(ChangedMethods[Index]))
+            {
+                NumCompiled.fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+
+        return NumCompiled.load();
+    }
+#endif
+
+    /**
+     * Compile the methods that changed in a reload before the reloaded assembly is used,
+     * instead of on the game thread the first time each of them is called
+     */
+    static void PrecompileReloadedMethods(const FString& AssemblyName)
+    {
+        if (!GetDefault<UCSUnrealSharpSettings>()->bPrecompileReloadedMethods)
+        {
+            return;
+        }
+
+        const double StartTime = FPlatformTime::Seconds();
+        int32 NumCompiled = 0;
+
+#if WITH_MONO_RUNTIME
+        NumCompiled = PrecompileChangedMonoMethods(AssemblyName);
+#else
+        if (UCSAssembly* Assembly = UCSManager::Get().FindAssembly(*AssemblyName))
+        {
+            NumCompiled = Assembly->PrepareChangedMethods();
+        }
+#endif
+
+        UE_LOG(LogTemp, Log, TEXT("UnrealSharp: Precompiled %d changed methods of '%s' in %.3f seconds"),
+               NumCompiled, *AssemblyName, FPlatformTime::Seconds() - StartTime);
+    }
 
     /**
      * Unified hot reload interface - automatically chooses best method
@@ -287,29 +455,26 @@ namespace UnrealSharp::HotReload
             return false;
         }
 
-        UE_LOG(LogTemp, Log, TEXT("UnrealSharp: Hot reloading assembly '%s' using %s strategy"), 
-               *AssemblyName, GetStrategyName(CurrentRuntime.PreferredStrategy));
+        if (!ActiveStrategy->HotReload)
+        {
+            UE_LOG(LogTemp, Error, TEXT("UnrealSharp: Unsupported hot reload strategy"));
+            return false;
+        }
+
+        UE_LOG(LogTemp, Log, TEXT("UnrealSharp: Hot reloading assembly '%s' using %s strategy"), *AssemblyName, ActiveStrategy->Name);
 
         bool bSuccess = false;
 
-        // Route to appropriate hot reload implementation
-        switch (CurrentRuntime.PreferredStrategy)
+        // Managed accesses from other threads finish before the swap and wait until it's done
         {
-            case EHotReloadStrategy::DotNetNative:
-                bSuccess = HotReloadAssemblyDotNet(AssemblyName, AssemblyData);
-                break;
-                
-            case EHotReloadStrategy::MonoAppDomain:
-                bSuccess = HotReloadAssemblyMonoAppDomain(AssemblyName, AssemblyData);
-                break;
-                
-            case EHotReloadStrategy::MonoMethodReplacement:
-                bSuccess = HotReloadAssemblyMonoMethodReplacement(AssemblyName, AssemblyData);
-                break;
-                
-            default:
-                UE_LOG(LogTemp, Error, TEXT("UnrealSharp: Unsupported hot reload strategy"));
-                return false;
+            FHotReloadSafetyLock::FScopedHotReloadLock HotReloadLock;
+            bSuccess = ActiveStrategy->HotReload(AssemblyName, AssemblyData);
+
+            // Before anything calls into the new version
+            if (bSuccess)
+            {
+                PrecompileReloadedMethods(AssemblyName);
+            }
         }
 
         if (bSuccess)
@@ -339,6 +504,7 @@ namespace UnrealSharp::HotReload
         return bSuccess;
     }
 
+#if UNREALSHARP_HOTRELOAD_WITH_DOTNET
     /**
      * .NET native hot reload implementation
      */
@@ -346,9 +512,6 @@ namespace UnrealSharp::HotReload
     {
         UE_LOG(LogTemp, Log, TEXT("UnrealSharp: Performing .NET native hot reload for '%s'"), *AssemblyName);
 
-        // TODO: Implement .NET native hot reload using MetadataUpdateHandler
-        // For now, use a simple assembly replacement approach
-        
         // Save new assembly data to temporary location
         FString TempPath = FPaths::ConvertRelativePathToFull(FPaths::ProjectTempDir()) / TEXT("HotReload");
         FString AssemblyPath = TempPath / (AssemblyName + TEXT(".dll"));
@@ -363,7 +526,9 @@ namespace UnrealSharp::HotReload
 
         return false;
     }
+#endif
 
+#if UNREALSHARP_HOTRELOAD_WITH_APPDOMAIN
     /**
      * Mono AppDomain hot reload implementation
      */
@@ -371,7 +536,6 @@ namespace UnrealSharp::HotReload
     {
         UE_LOG(LogTemp, Log, TEXT("UnrealSharp: Performing enhanced Mono AppDomain hot reload for '%s' (no restart)"), *AssemblyName);
 
-#if WITH_MONO_RUNTIME
         // Use platform-optimized implementations
 #if PLATFORM_WINDOWS
         // Use Windows-optimized AppDomain hot reload
@@ -427,11 +591,10 @@ namespace UnrealSharp::HotReload
 
         UE_LOG(LogTemp, Log, TEXT("UnrealSharp: Mono AppDomain hot reload completed"));
         return true;
-#else
-        return false;
-#endif
     }
+#endif
 
+#if UNREALSHARP_HOTRELOAD_WITH_METHOD_REPLACEMENT
     /**
      * Mono method replacement hot reload implementation
      */
@@ -439,21 +602,14 @@ namespace UnrealSharp::HotReload
     {
         UE_LOG(LogTemp, Log, TEXT("UnrealSharp: Performing Mono method replacement hot reload for '%s'"), *AssemblyName);
 
-#if WITH_MONO_RUNTIME && (PLATFORM_IOS || PLATFORM_ANDROID)
         // Use our advanced iOS/Android hot reload system
-        #if PLATFORM_IOS
+#if PLATFORM_IOS
         return UnrealSharp::iOS::RuntimeHotReload::HotReloadAssemblyRuntime(AssemblyName, AssemblyData);
-        #elif PLATFORM_ANDROID
-        return UnrealSharp::Android::HotReload::HotReloadAssemblyAndroid(AssemblyName, AssemblyData);
-        #else
-        UE_LOG(LogTemp, Warning, TEXT("UnrealSharp: Method replacement hot reload not implemented for this mobile platform"));
-        return false;
-        #endif
 #else
-        UE_LOG(LogTemp, Warning, TEXT("UnrealSharp: Method replacement hot reload not available on this platform"));
-        return false;
+        return UnrealSharp::Android::HotReload::HotReloadAssemblyAndroid(AssemblyName, AssemblyData);
 #endif
     }
+#endif
 
     /**
      * Get strategy name for logging
@@ -472,54 +628,14 @@ namespace UnrealSharp::HotReload
     /**
      * Get current hot reload capabilities
      */
-    struct FHotReloadCapabilities
-    {
-        bool bSupportsMethodBodyReplacement;
-        bool bSupportsAssemblyReplacement;
-        bool bSupportsNewTypeAddition;
-        bool bRequiresRestart;
-        FString StrategyName;
-    };
-
     FHotReloadCapabilities GetHotReloadCapabilities()
     {
         FHotReloadCapabilities Caps;
-        Caps.StrategyName = GetStrategyName(CurrentRuntime.PreferredStrategy);
-
-        switch (CurrentRuntime.PreferredStrategy)
-        {
-            case EHotReloadStrategy::DotNetNative:
-                Caps.bSupportsMethodBodyReplacement = true;
-                Caps.bSupportsAssemblyReplacement = true;
-                Caps.bSupportsNewTypeAddition = false; // Limited in current .NET hot reload
-                Caps.bRequiresRestart = false; // Enhanced .NET 9 hot reload - no restart
-                Caps.StrategyName = TEXT(".NET Native Hot Reload (No Restart)");
-                break;
-
-            case EHotReloadStrategy::MonoAppDomain:
-                Caps.bSupportsMethodBodyReplacement = true;
-                Caps.bSupportsAssemblyReplacement = true;
-                Caps.bSupportsNewTypeAddition = true;
-                Caps.bRequiresRestart = false; // Enhanced AppDomain switching - no restart
-                Caps.StrategyName = TEXT("Mono AppDomain (No Restart)");
-                break;
-
-            case EHotReloadStrategy::MonoMethodReplacement:
-                Caps.bSupportsMethodBodyReplacement = true;
-                Caps.bSupportsAssemblyReplacement = true; // Enhanced mobile support
-                Caps.bSupportsNewTypeAddition = false;
-                Caps.bRequiresRestart = false; // Enhanced runtime replacement - no restart
-                Caps.StrategyName = TEXT("Mono Method Replacement (No Restart)");
-                break;
-
-            default:
-                Caps.bSupportsMethodBodyReplacement = false;
-                Caps.bSupportsAssemblyReplacement = false;
-                Caps.bSupportsNewTypeAddition = false;
-                Caps.bRequiresRestart = true;
-                break;
-        }
-
+        Caps.bSupportsMethodBodyReplacement = ActiveStrategy->bSupportsMethodBodyReplacement;
+        Caps.bSupportsAssemblyReplacement = ActiveStrategy->bSupportsAssemblyReplacement;
+        Caps.bSupportsNewTypeAddition = ActiveStrategy->bSupportsNewTypeAddition;
+        Caps.bRequiresRestart = ActiveStrategy->bRequiresRestart;
+        Caps.StrategyName = ActiveStrategy->Description;
         return Caps;
     }
 
@@ -531,23 +647,9 @@ namespace UnrealSharp::HotReload
         UE_LOG(LogTemp, Log, TEXT("UnrealSharp: Shutting down Unified Hot Reload System"));
 
         // Cleanup strategy-specific resources
-        switch (CurrentRuntime.PreferredStrategy)
+        if (ActiveStrategy->Shutdown)
         {
-            case EHotReloadStrategy::MonoMethodReplacement:
-#if WITH_MONO_RUNTIME && PLATFORM_IOS
-                UnrealSharp::iOS::RuntimeHotReload::ShutdownRuntimeHotReload();
-#elif WITH_MONO_RUNTIME && PLATFORM_ANDROID
-                UnrealSharp::Android::HotReload::ShutdownAndroidHotReload();
-#endif
-                break;
-                
-            case EHotReloadStrategy::MonoAppDomain:
-#if WITH_MONO_RUNTIME && PLATFORM_WINDOWS
-                UnrealSharp::Windows::HotReload::ShutdownWindowsHotReload();
-#endif
-                break;
-            
-            // TODO: Add cleanup for other strategies
+            ActiveStrategy->Shutdown();
         }
 
         AssemblyVersions.Empty();
@@ -569,9 +671,9 @@ namespace UnrealSharp::HotReload
         return bHotReloadSystemInitialized && CurrentRuntime.PreferredStrategy != EHotReloadStrategy::Disabled;
     }
 
-    FString GetCurrentStrategyName()
+    const TCHAR* GetCurrentStrategyName()
     {
-        return FString(GetStrategyName(CurrentRuntime.PreferredStrategy));
+        return ActiveStrategy->Name;
     }
 
     FOnUnifiedHotReloadCompleted& OnHotReloadCompleted()
@@ -593,10 +695,20 @@ namespace UnrealSharp::Platform
     void InitializeHotReloadSystem()
     {
         HotReload::InitializeUnifiedHotReload();
+
+#if (PLATFORM_IOS || PLATFORM_ANDROID) && !UE_BUILD_SHIPPING
+        // Devices receive hot reloaded assemblies from the editor, when the project opted in
+        const UCSUnrealSharpSettings* Settings = GetDefault<UCSUnrealSharpSettings>();
+        if (Settings->bEnableDeviceHotReload)
+        {
+            HotReload::Transport::StartTransportServer(Settings->DeviceHotReloadSecret, Settings->DeviceHotReloadPort, Settings->bDeviceHotReloadOnAllInterfaces);
+        }
+#endif
     }
 
     void ShutdownHotReloadSystem()
     {
+        HotReload::Transport::StopTransportServer();
         HotReload::ShutdownUnifiedHotReload();
     }
 }
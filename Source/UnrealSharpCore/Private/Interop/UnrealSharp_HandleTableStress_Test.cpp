@@ -0,0 +1,404 @@
+#include "Interop/UnrealSharp_InteropBenchmarkFixture.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Async/Async.h"
+#include "Math/RandomStream.h"
+#include "UObject/StrongObjectPtr.h"
+#include "CSManagedObjectHandleTable.h"
+#include "CSManager.h"
+#include "UnrealSharp_BenchmarkOutput.h"
+#include <atomic>
+
+/**
+ * Handle table stress test
+ *
+ * Pushes NumObjects objects through the table of C# counterparts, in batches, while reader threads look objects up the whole time:
+ * - Table: worker threads register and remove handles of their share of a batch on a table of their own, so writers
+ *   contend for the write lock the way deletions on several threads would. Measures writes and lookups per second,
+ *   how often and how long writers waited for the lock, and the latency of Remove.
+ * - GarbageCollection: the objects get real C# counterparts through UCSManager::FindManagedObject and are purged by
+ *   the garbage collector. Half of every batch is handed to NotifyUObjectDeleted directly to time it, the rest is left
+ *   to the purge. Readers look up a set of rooted objects through FindManagedObjectHandle meanwhile.
+ *
+ * Both fail if a lookup ever returns a handle that wasn't registered for the object, or if the table doesn't end up
+ * back where it started. Every run appends to Saved/UnrealSharp/Benchmarks/HandleTableStress.csv and writes a JSON file of its own.
+ */
+
+namespace UnrealSharp::Interop::HandleTableStress
+{
+    constexpr int32 NumObjects = 1000000;
+    constexpr int32 BatchSize = 50000;
+
+    // Times every object of a batch is registered and removed again in the Table case
+    constexpr int32 NumTableRounds = 4;
+
+    // Rooted objects the readers of the GarbageCollection case look up
+    constexpr int32 NumStableObjects = 1024;
+
+    struct FStressResult
+    {
+        FString Case;
+        FString Metric;
+        double Value = 0.0;
+    };
+
+    static int32 GetNumThreads()
+    {
+        return FMath::Clamp(FPlatformMisc::NumberOfCoresIncludingHyperthreads() / 2, 2, 8);
+    }
+
+    /**
+     * Threads that call Body with a random stream of their own until stopped
+     */
+    class FReaderThreads
+    {
+    public:
+        explicit FReaderThreads(TFunction<void(FRandomStream&)> Body)
+        {
+            for (int32 ThreadIndex = 0; ThreadIndex < GetNumThreads(); ++ThreadIndex)
+            {
+                Readers.Add(Async(EAsyncExecution::Thread, [this, Body, ThreadIndex]
+                {
+                    FRandomStream Random(ThreadIndex + 1);
+                    int64 NumCalls = 0;
+
+                    while (!bStop.load(std::memory_order_relaxed))
+                    {
+                        Body(Random);
+                        ++NumCalls;
+                    }
+
+                    return NumCalls;
+                }));
+            }
+        }
+
+        // Returns the number of calls all threads made
+        int64 Stop()
+        {
+            bStop.store(true, std::memory_order_relaxed);
+
+            int64 NumCalls = 0;
+            for (TFuture<int64>& Reader : Readers)
+            {
+                NumCalls += Reader.Get();
+            }
+
+            Readers.Reset();
+            return NumCalls;
+        }
+
+        ~FReaderThreads()
+        {
+            Stop();
+        }
+
+    private:
+        TArray<TFuture<int64>> Readers;
+        std::atomic<bool> bStop { false };
+    };
+
+    static void CreateBatch(TArray<UObject*>& OutObjects, TArray<int32>& OutObjectIndices)
+    {
+        OutObjects.Reset(BatchSize);
+        OutObjectIndices.Reset(BatchSize);
+
+        for (int32 Index = 0; Index < BatchSize; ++Index)
+        {
+            UObject* Object = NewObject<UCSInteropBenchmarkFixture>(GetTransientPackage());
+            OutObjects.Add(Object);
+            OutObjectIndices.Add(GUObjectArray.ObjectToIndex(Object));
+        }
+    }
+
+    static void AddLatencyResults(const TCHAR* Case, const TCHAR* Name, TArray<uint64>& Cycles, TArray<FStressResult>& Results)
+    {
+        if (Cycles.IsEmpty())
+        {
+            return;
+        }
+
+        Cycles.Sort();
+
+        auto AddPercentile = [&](const TCHAR* Suffix, double Percentile)
+        {
+            const int32 Index = FMath::Min(FMath::FloorToInt32(Cycles.Num() * Percentile), Cycles.Num() - 1);
+            Results.Add({ Case, FString::Printf(TEXT("%s%sNs"), Name, Suffix), FPlatformTime::ToMilliseconds64(Cycles[Index]) * 1.0e6 });
+        };
+
+        AddPercentile(TEXT("P50"), 0.5);
+        AddPercentile(TEXT("P99"), 0.99);
+        AddPercentile(TEXT("P999"), 0.999);
+        AddPercentile(TEXT("Max"), 1.0);
+    }
+
+    static void AddWriteLockResults(const TCHAR* Case, const FCSManagedObjectHandleTable::FWriteLockStats& Before,
+        const FCSManagedObjectHandleTable::FWriteLockStats& After, TArray<FStressResult>& Results)
+    {
+        const int64 NumWrites = After.NumWrites - Before.NumWrites;
+        const int64 NumContendedWrites = After.NumContendedWrites - Before.NumContendedWrites;
+
+        Results.Add({ Case, TEXT("LockedWrites"), static_cast<double>(NumWrites) });
+        Results.Add({ Case, TEXT("ContendedWritesPercent"), NumWrites > 0 ? NumContendedWrites * 100.0 / NumWrites : 0.0 });
+        Results.Add({ Case, TEXT("WriteLockWaitMs"), FPlatformTime::ToMilliseconds64(After.WaitCycles - Before.WaitCycles) });
+    }
+
+    static void RunTable(FAutomationTestBase& Test, TArray<FStressResult>& Results)
+    {
+        FCSManagedObjectHandleTable Table;
+        const FCSManagedObjectHandleTable::FWriteLockStats LockStatsBefore = Table.GetWriteLockStats();
+
+        // The table never looks at the handles, it only needs an address per object
+        TArray<FGCHandle> Handles;
+        Handles.SetNum(BatchSize);
+
+        TArray<UObject*> Objects;
+        TArray<int32> ObjectIndices;
+
+        const int32 NumWriters = GetNumThreads();
+        const int32 NumPerWriter = FMath::DivideAndRoundUp(BatchSize, NumWriters);
+
+        std::atomic<int64> NumMismatches { 0 };
+        TArray<uint64> RemoveCycles;
+        int64 NumLookups = 0;
+        double WriteSeconds = 0.0;
+
+        for (int32 FirstObject = 0; FirstObject < NumObjects; FirstObject += BatchSize)
+        {
+            CreateBatch(Objects, ObjectIndices);
+
+            FReaderThreads Readers([&](FRandomStream& Random)
+            {
+                // Either lookup may miss while a writer is at the slot, but never return another handle
+                const int32 Index = Random.RandHelper(BatchSize);
+                for (FGCHandle* Handle : { Table.FindByIndex(ObjectIndices[Index]), Table.Find(Objects[Index]) })
+                {
+                    if (Handle && Handle != &Handles[Index])
+                    {
+                        NumMismatches.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+            });
+
+            TArray<TFuture<TArray<uint64>>> Writers;
+            const double StartTime = FPlatformTime::Seconds();
+
+            for (int32 WriterIndex = 0; WriterIndex < NumWriters; ++WriterIndex)
+            {
+                const int32 Begin = WriterIndex * NumPerWriter;
+                const int32 End = FMath::Min(Begin + NumPerWriter, BatchSize);
+
+                Writers.Add(Async(EAsyncExecution::Thread, [&, Begin, End]
+                {
+                    TArray<uint64> Cycles;
+                    Cycles.Reserve((End - Begin) * NumTableRounds);
+
+                    for (int32 Round = 0; Round < NumTableRounds; ++Round)
+                    {
+                        for (int32 Index = Begin; Index < End; ++Index)
+                        {
+                            Table.Add(Objects[Index], &Handles[Index]);
+                        }
+
+                        for (int32 Index = Begin; Index < End; ++Index)
+                        {
+                            const uint64 StartCycles = FPlatformTime::Cycles64();
+                            Table.Remove(ObjectIndices[Index]);
+                            Cycles.Add(FPlatformTime::Cycles64() - StartCycles);
+                        }
+                    }
+
+                    return Cycles;
+                }));
+            }
+
+            for (TFuture<TArray<uint64>>& Writer : Writers)
+            {
+                RemoveCycles.Append(Writer.Get());
+            }
+
+            WriteSeconds += FPlatformTime::Seconds() - StartTime;
+            NumLookups += 2 * Readers.Stop();
+
+            for (UObject* Object : Objects)
+            {
+                Object->MarkAsGarbage();
+            }
+        }
+
+        CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+        const double NumWrites = 2.0 * NumObjects * NumTableRounds;
+        Results.Add({ TEXT("Table"), TEXT("WritesPerSecond"), WriteSeconds > 0.0 ? NumWrites / WriteSeconds : 0.0 });
+        Results.Add({ TEXT("Table"), TEXT("LookupsPerSecond"), WriteSeconds > 0.0 ? NumLookups / WriteSeconds : 0.0 });
+        AddWriteLockResults(TEXT("Table"), LockStatsBefore, Table.GetWriteLockStats(), Results);
+        AddLatencyResults(TEXT("Table"), TEXT("Remove"), RemoveCycles, Results);
+
+        Test.TestEqual(TEXT("Lookups that returned the handle of another object"), NumMismatches.load(), static_cast<int64>(0));
+        Test.TestEqual(TEXT("Handles left in the table"), Table.Num(), 0);
+    }
+
+    static void RunGarbageCollection(FAutomationTestBase& Test, TArray<FStressResult>& Results)
+    {
+        UCSManager& Manager = UCSManager::Get();
+        const FCSManagedObjectHandleTable& Table = Manager.GetManagedObjectHandles();
+
+        // The override is private, the engine calls it through the listener interface as well
+        FUObjectArray::FUObjectDeleteListener& DeleteListener = Manager;
+
+        TArray<TStrongObjectPtr<UObject>> StableObjects;
+        TArray<FGCHandle*> StableHandles;
+
+        for (int32 Index = 0; Index < NumStableObjects; ++Index)
+        {
+            UObject* Object = NewObject<UCSInteropBenchmarkFixture>(GetTransientPackage());
+            Manager.FindManagedObject(Object);
+
+            StableObjects.Emplace(Object);
+            StableHandles.Add(Manager.FindManagedObjectHandle(Object));
+        }
+
+        if (StableHandles.Contains(nullptr))
+        {
+            Test.AddError(TEXT("FindManagedObject didn't create a C# counterpart, is the managed runtime loaded?"));
+            return;
+        }
+
+        const int32 NumHandlesBefore = Table.Num();
+        const FCSManagedObjectHandleTable::FWriteLockStats LockStatsBefore = Table.GetWriteLockStats();
+
+        std::atomic<int64> NumMismatches { 0 };
+        FReaderThreads Readers([&](FRandomStream& Random)
+        {
+            const int32 Index = Random.RandHelper(NumStableObjects);
+            if (Manager.FindManagedObjectHandle(StableObjects[Index].Get()) != StableHandles[Index])
+            {
+                NumMismatches.fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+
+        TArray<UObject*> Objects;
+        TArray<int32> ObjectIndices;
+        TArray<uint64> NotifyCycles;
+        NotifyCycles.Reserve(NumObjects / 2);
+
+        double WrapSeconds = 0.0;
+        double PurgeSeconds = 0.0;
+        int32 NumBatches = 0;
+        const double StartTime = FPlatformTime::Seconds();
+
+        for (int32 FirstObject = 0; FirstObject < NumObjects; FirstObject += BatchSize)
+        {
+            CreateBatch(Objects, ObjectIndices);
+
+            const double WrapStartTime = FPlatformTime::Seconds();
+            for (UObject* Object : Objects)
+            {
+                Manager.FindManagedObject(Object);
+            }
+            WrapSeconds += FPlatformTime::Seconds() - WrapStartTime;
+
+            for (int32 Index = 0; Index < BatchSize; Index += 2)
+            {
+                const uint64 StartCycles = FPlatformTime::Cycles64();
+                DeleteListener.NotifyUObjectDeleted(Objects[Index], ObjectIndices[Index]);
+                NotifyCycles.Add(FPlatformTime::Cycles64() - StartCycles);
+            }
+
+            for (UObject* Object : Objects)
+            {
+                Object->MarkAsGarbage();
+            }
+
+            const double PurgeStartTime = FPlatformTime::Seconds();
+            CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+            PurgeSeconds += FPlatformTime::Seconds() - PurgeStartTime;
+            ++NumBatches;
+        }
+
+        const double TotalSeconds = FPlatformTime::Seconds() - StartTime;
+        const int64 NumLookups = Readers.Stop();
+
+        Results.Add({ TEXT("GarbageCollection"), TEXT("WrapsPerSecond"), WrapSeconds > 0.0 ? NumObjects / WrapSeconds : 0.0 });
+        Results.Add({ TEXT("GarbageCollection"), TEXT("LookupsPerSecond"), TotalSeconds > 0.0 ? NumLookups / TotalSeconds : 0.0 });
+        Results.Add({ TEXT("GarbageCollection"), TEXT("GarbageCollectionMsPerBatch"), NumBatches > 0 ? PurgeSeconds * 1000.0 / NumBatches : 0.0 });
+        AddWriteLockResults(TEXT("GarbageCollection"), LockStatsBefore, Table.GetWriteLockStats(), Results);
+        AddLatencyResults(TEXT("GarbageCollection"), TEXT("NotifyUObjectDeleted"), NotifyCycles, Results);
+
+        Test.TestEqual(TEXT("Lookups of rooted objects that returned another handle"), NumMismatches.load(), static_cast<int64>(0));
+        Test.TestEqual(TEXT("Handles in the table after the purge"), Table.Num(), NumHandlesBefore);
+    }
+
+    static void WriteResults(const TArray<FStressResult>& Results)
+    {
+        const FString Case = Results.IsEmpty() ? FString() : Results[0].Case;
+        const FString ReportPrefix = FString::Printf(TEXT("HandleTableStress_%s_%s"), *Case, FPlatformProperties::IniPlatformName());
+
+        UnrealSharp::Benchmark::WriteResults<FStressResult>(Results, TEXT("HandleTableStress.csv"),
+            TEXT("Threads,Objects,Case,Metric,Value"), ReportPrefix,
+            [](const FStressResult& Result)
+            {
+                return FString::Printf(TEXT("%d,%d,%s,%s,%.2f"), GetNumThreads(), NumObjects, *Result.Case, *Result.Metric, Result.Value);
+            },
+            [&Results](FJsonObject& Report)
+            {
+                Report.SetNumberField(TEXT("Threads"), GetNumThreads());
+                Report.SetNumberField(TEXT("Objects"), NumObjects);
+
+                TSharedRef<FJsonObject> Metrics = MakeShared<FJsonObject>();
+                for (const FStressResult& Result : Results)
+                {
+                    Metrics->SetNumberField(Result.Metric, Result.Value);
+                }
+
+                Report.SetObjectField(TEXT("Metrics"), Metrics);
+            });
+    }
+}
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FHandleTableStressTest, "UnrealSharp.Interop.HandleTableStress",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::StressFilter)
+
+void FHandleTableStressTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+    const TCHAR* Cases[] = { TEXT("Table"), TEXT("GarbageCollection") };
+
+    for (const TCHAR* Case : Cases)
+    {
+        OutBeautifiedNames.Add(Case);
+        OutTestCommands.Add(Case);
+    }
+}
+
+bool FHandleTableStressTest::RunTest(const FString& Parameters)
+{
+    using namespace UnrealSharp::Interop::HandleTableStress;
+
+    TArray<FStressResult> Results;
+
+    if (Parameters == TEXT("Table"))
+    {
+        RunTable(*this, Results);
+    }
+    else if (Parameters == TEXT("GarbageCollection"))
+    {
+        RunGarbageCollection(*this, Results);
+    }
+
+    for (const FStressResult& Result : Results)
+    {
+        AddInfo(FString::Printf(TEXT("%s, %s: %.2f"), *Result.Case, *Result.Metric, Result.Value));
+    }
+
+    if (!Results.IsEmpty())
+    {
+        WriteResults(Results);
+    }
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "UnrealSharp_InteropBenchmarkFixture.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FCSInteropBenchmarkDelegate, int32, Value);
+
+/**
+ * Native side of the interop benchmark suite, see UnrealSharp_InteropBenchmark_Test.cpp
+ * Gives the exporters reflected containers, a delegate and native functions of known shapes to work on.
+ */
+UCLASS(Transient, NotBlueprintable)
+class UCSInteropBenchmarkFixture : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	UPROPERTY()
+	TArray<int32> Array;
+
+	UPROPERTY()
+	TMap<int32, int32> Map;
+
+	UPROPERTY()
+	TSet<int32> Set;
+
+	UPROPERTY()
+	FCSInteropBenchmarkDelegate Delegate;
+
+	int32 Counter = 0;
+
+	UFUNCTION()
+	void NativeFunction0() { ++Counter; }
+
+	UFUNCTION()
+	void NativeFunction4(int32 A, int32 B, int32 C, int32 D) { Counter += A + B + C + D; }
+
+	UFUNCTION()
+	void NativeFunction16(int32 A, int32 B, int32 C, int32 D, int32 E, int32 F, int32 G, int32 H,
+		int32 I, int32 J, int32 K, int32 L, int32 M, int32 N, int32 O, int32 P)
+	{
+		Counter += A + B + C + D + E + F + G + H + I + J + K + L + M + N + O + P;
+	}
+
+	UFUNCTION()
+	void OnDelegate(int32 Value) { Counter += Value; }
+};
@@ -0,0 +1,444 @@
+#include "Interop/UnrealSharp_InteropBenchmarkFixture.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "UnrealSharp_BenchmarkOutput.h"
+#include "UObject/StrongObjectPtr.h"
+#include "UObject/UObjectIterator.h"
+#include "CSManager.h"
+#include "Export/FMulticastDelegatePropertyExporter.h"
+#include "Export/FScriptArrayExporter.h"
+#include "Export/FScriptMapHelperExporter.h"
+#include "Export/FScriptSetExporter.h"
+#include "Export/FStringExporter.h"
+#include "Export/UObjectExporter.h"
+#include "TypeGenerator/CSClass.h"
+#include "TypeGenerator/Functions/CSFunction.h"
+
+/**
+ * Interop benchmark suite
+ *
+ * Measures the cost of one call through every category of exporter, from the native side of the boundary:
+ * - ManagedInvoke: UFunctions implemented in C# with 0, 4 and 16 parameters, through InvokeManagedMethod
+ * - NativeInvoke: native UFunctions with 0, 4 and 16 parameters, through InvokeNativeFunction
+ * - ObjectLookup: FindManagedObject of an object that has a managed counterpart, of one that can't have one,
+ *   and of a new object, which creates its counterpart
+ * - String: UFStringExporter marshalling of a short string
+ * - Containers: the array, map and set helpers
+ * - Delegate: broadcast of a multicast delegate through UFMulticastDelegatePropertyExporter
+ *
+ * ManagedInvoke needs BlueprintPure functions of the loaded C# classes with a matching parameter count to call,
+ * parameter counts none of them have are reported as skipped.
+ * Every run appends to Saved/UnrealSharp/Benchmarks/InteropBenchmarks.csv and writes a JSON file of its own.
+ */
+
+namespace UnrealSharp::Interop::Benchmark
+{
+    // Each case runs this many times after a warm-up, the median is reported
+    constexpr int32 NumIterations = 5;
+
+    // Calls per iteration, object creation is a lot slower than the rest so it makes fewer
+    constexpr int32 NumCalls = 100000;
+    constexpr int32 NumCreateCalls = 2000;
+
+    struct FBenchmarkResult
+    {
+        FString Category;
+        FString Case;
+        double NanosecondsPerCall = 0.0;
+        double CallsPerSecond = 0.0;
+    };
+
+    // Keeps the compiler from removing the measured calls
+    static volatile uint64 Sink = 0;
+
+    static double GetMedian(TArray<double>& Samples)
+    {
+        Samples.Sort();
+        return Samples.IsEmpty() ? 0.0 : Samples[Samples.Num() / 2];
+    }
+
+    /**
+     * Time Calls calls of Body, which gets the index of the call
+     * Setup runs before every iteration and isn't part of the measured time.
+     */
+    static FBenchmarkResult Measure(const TCHAR* Category, const TCHAR* Case, int32 Calls, TFunctionRef<void(int32)> Body,
+        TFunctionRef<void()> Setup = [] {})
+    {
+        Setup();
+        for (int32 Index = 0; Index < Calls / 10; ++Index)
+        {
+            Body(Index);
+        }
+
+        TArray<double> Samples;
+        Samples.Reserve(NumIterations);
+
+        for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+        {
+            Setup();
+
+            const double StartTime = FPlatformTime::Seconds();
+            for (int32 Index = 0; Index < Calls; ++Index)
+            {
+                Body(Index);
+            }
+
+            Samples.Add((FPlatformTime::Seconds() - StartTime) * 1.0e9 / Calls);
+        }
+
+        FBenchmarkResult Result;
+        Result.Category = Category;
+        Result.Case = Case;
+        Result.NanosecondsPerCall = GetMedian(Samples);
+        Result.CallsPerSecond = Result.NanosecondsPerCall > 0.0 ? 1.0e9 / Result.NanosecondsPerCall : 0.0;
+        return Result;
+    }
+
+    /**
+     * Parameter buffer of a UFunction, initialized and destroyed like ProcessEvent's callers do
+     */
+    struct FFunctionParams
+    {
+        explicit FFunctionParams(UFunction* InFunction) : Function(InFunction)
+        {
+            Buffer.SetNumZeroed(FMath::Max<int32>(Function->ParmsSize, 1));
+            Function->InitializeStruct(Buffer.GetData());
+        }
+
+        ~FFunctionParams()
+        {
+            Function->DestroyStruct(Buffer.GetData());
+        }
+
+        uint8* GetReturnValue()
+        {
+            const FProperty* ReturnProperty = Function->GetReturnProperty();
+            return ReturnProperty ? Buffer.GetData() + ReturnProperty->GetOffset_ForUFunction() : nullptr;
+        }
+
+        UFunction* Function;
+        TArray<uint8> Buffer;
+    };
+
+    static int32 GetNumInputParams(const UFunction* Function)
+    {
+        return Function->NumParms - (Function->GetReturnProperty() ? 1 : 0);
+    }
+
+    /**
+     * Find a side effect free C# function with NumParams parameters
+     */
+    static UFunction* FindManagedFunction(int32 NumParams)
+    {
+        for (TObjectIterator<UCSClass> It; It; ++It)
+        {
+            if (It->HasAnyClassFlags(CLASS_Abstract | CLASS_NewerVersionExists))
+            {
+                continue;
+            }
+
+            for (TFieldIterator<UFunction> FunctionIt(*It, EFieldIteratorFlags::ExcludeSuper); FunctionIt; ++FunctionIt)
+            {
+                UFunction* Function = *FunctionIt;
+                if (Function->IsA<UCSFunctionBase>() && Function->HasAnyFunctionFlags(FUNC_BlueprintPure) && GetNumInputParams(Function) == NumParams)
+                {
+                    return Function;
+                }
+            }
+        }
+
+        return nullptr;
+    }
+
+    static void RunManagedInvoke(FAutomationTestBase& Test, TArray<FBenchmarkResult>& Results)
+    {
+        const int32 ParamCounts[] = { 0, 4, 16 };
+
+        for (int32 NumParams : ParamCounts)
+        {
+            const FString Case = FString::Printf(TEXT("InvokeManagedMethod%d"), NumParams);
+
+            UFunction* Function = FindManagedFunction(NumParams);
+            if (!Function)
+            {
+                Test.AddInfo(FString::Printf(TEXT("%s skipped, no BlueprintPure C# function with %d parameters is loaded"), *Case, NumParams));
+                continue;
+            }
+
+            UObject* Object = Function->GetOuterUClass()->GetDefaultObject();
+            FFunctionParams Params(Function);
+
+            Results.Add(Measure(TEXT("ManagedInvoke"), *Case, NumCalls, [&](int32)
+            {
+                Object->ProcessEvent(Function, Params.Buffer.GetData());
+            }));
+        }
+    }
+
+    static void RunNativeInvoke(UCSInteropBenchmarkFixture* Fixture, TArray<FBenchmarkResult>& Results)
+    {
+        const TPair<const TCHAR*, FName> Functions[] =
+        {
+            { TEXT("InvokeNativeFunction0"), GET_FUNCTION_NAME_CHECKED(UCSInteropBenchmarkFixture, NativeFunction0) },
+            { TEXT("InvokeNativeFunction4"), GET_FUNCTION_NAME_CHECKED(UCSInteropBenchmarkFixture, NativeFunction4) },
+            { TEXT("InvokeNativeFunction16"), GET_FUNCTION_NAME_CHECKED(UCSInteropBenchmarkFixture, NativeFunction16) },
+        };
+
+        for (const TPair<const TCHAR*, FName>& Function : Functions)
+        {
+            UFunction* NativeFunction = Fixture->FindFunctionChecked(Function.Value);
+            FFunctionParams Params(NativeFunction);
+
+            Results.Add(Measure(TEXT("NativeInvoke"), Function.Key, NumCalls, [&](int32)
+            {
+                UUObjectExporter::InvokeNativeFunction(Fixture, NativeFunction, Params.Buffer.GetData(), Params.GetReturnValue());
+            }));
+        }
+
+        Sink += Fixture->Counter;
+    }
+
+    static void RunObjectLookup(UCSInteropBenchmarkFixture* Fixture, TArray<FBenchmarkResult>& Results)
+    {
+        UCSManager& Manager = UCSManager::Get();
+
+        // The first lookup creates the managed counterpart, every lookup after it is a hit
+        Manager.FindManagedObject(Fixture);
+        Results.Add(Measure(TEXT("ObjectLookup"), TEXT("FindManagedObjectHit"), NumCalls, [&](int32)
+        {
+            Sink += reinterpret_cast<UPTRINT>(Manager.FindManagedObject(Fixture).GetPointer());
+        }));
+
+        // Objects that fail validation are turned away before the handle map is looked at
+        Results.Add(Measure(TEXT("ObjectLookup"), TEXT("FindManagedObjectMiss"), NumCalls, [&](int32)
+        {
+            Sink += reinterpret_cast<UPTRINT>(Manager.FindManagedObject(nullptr).GetPointer());
+        }));
+
+        TArray<UObject*> Objects;
+        Results.Add(Measure(TEXT("ObjectLookup"), TEXT("CreateManagedObject"), NumCreateCalls, [&](int32 Index)
+        {
+            Sink += reinterpret_cast<UPTRINT>(Manager.FindManagedObject(Objects[Index]).GetPointer());
+        },
+        [&]
+        {
+            Objects.Reset(NumCreateCalls);
+            for (int32 Index = 0; Index < NumCreateCalls; ++Index)
+            {
+                Objects.Add(NewObject<UCSInteropBenchmarkFixture>(GetTransientPackage()));
+            }
+        }));
+
+        for (UObject* Object : Objects)
+        {
+            Object->MarkAsGarbage();
+        }
+    }
+
+    static void RunString(TArray<FBenchmarkResult>& Results)
+    {
+        TCHAR ManagedString[] = TEXT("UnrealSharp interop benchmark string");
+        const int32 Length = FCString::Strlen(ManagedString);
+        FString NativeString;
+
+        Results.Add(Measure(TEXT("String"), TEXT("MarshalToNativeString"), NumCalls, [&](int32)
+        {
+            UFStringExporter::MarshalToNativeString(&NativeString, ManagedString);
+        }));
+
+        Results.Add(Measure(TEXT("String"), TEXT("MarshalToNativeStringView"), NumCalls, [&](int32)
+        {
+            UFStringExporter::MarshalToNativeStringView(&NativeString, ManagedString, Length);
+        }));
+
+        Sink += NativeString.Len();
+    }
+
+    static uint32 GetIntHash(const void* Element)
+    {
+        return GetTypeHash(*static_cast<const int32*>(Element));
+    }
+
+    static bool AreIntsEqual(const void* A, const void* B)
+    {
+        return *static_cast<const int32*>(A) == *static_cast<const int32*>(B);
+    }
+
+    static void ConstructInt(void* Element)
+    {
+        *static_cast<int32*>(Element) = 0;
+    }
+
+    static void RunContainers(UCSInteropBenchmarkFixture* Fixture, TArray<FBenchmarkResult>& Results)
+    {
+        // Lookups go through a container of this many elements
+        constexpr int32 NumElements = 1024;
+
+        UClass* FixtureClass = UCSInteropBenchmarkFixture::StaticClass();
+        FMapProperty* MapProperty = CastFieldChecked<FMapProperty>(FixtureClass->FindPropertyByName(GET_MEMBER_NAME_CHECKED(UCSInteropBenchmarkFixture, Map)));
+        FSetProperty* SetProperty = CastFieldChecked<FSetProperty>(FixtureClass->FindPropertyByName(GET_MEMBER_NAME_CHECKED(UCSInteropBenchmarkFixture, Set)));
+
+        for (int32 Index = 0; Index < NumElements; ++Index)
+        {
+            Fixture->Array.Add(Index);
+            Fixture->Map.Add(Index, Index);
+            Fixture->Set.Add(Index);
+        }
+
+        FScriptArray* ScriptArray = reinterpret_cast<FScriptArray*>(&Fixture->Array);
+        Results.Add(Measure(TEXT("Containers"), TEXT("ArrayNum"), NumCalls, [&](int32)
+        {
+            Sink += UFScriptArrayExporter::Num(ScriptArray);
+        }));
+
+        Results.Add(Measure(TEXT("Containers"), TEXT("ArrayGetData"), NumCalls, [&](int32 Index)
+        {
+            Sink += static_cast<const int32*>(UFScriptArrayExporter::GetData(ScriptArray))[Index % NumElements];
+        }));
+
+        Results.Add(Measure(TEXT("Containers"), TEXT("MapNum"), NumCalls, [&](int32)
+        {
+            Sink += UFScriptMapHelperExporter::Num(MapProperty, &Fixture->Map);
+        }));
+
+        Results.Add(Measure(TEXT("Containers"), TEXT("MapFindOrAdd"), NumCalls, [&](int32 Index)
+        {
+            const int32 Key = Index % NumElements;
+            Sink += *static_cast<const int32*>(UFScriptMapHelperExporter::FindOrAdd(MapProperty, &Fixture->Map, &Key));
+        }));
+
+        FScriptSet* ScriptSet = reinterpret_cast<FScriptSet*>(&Fixture->Set);
+        Results.Add(Measure(TEXT("Containers"), TEXT("SetNum"), NumCalls, [&](int32)
+        {
+            Sink += UFScriptSetExporter::Num(ScriptSet);
+        }));
+
+        Results.Add(Measure(TEXT("Containers"), TEXT("SetFindIndex"), NumCalls, [&](int32 Index)
+        {
+            const int32 Element = Index % NumElements;
+            Sink += UFScriptSetExporter::FindIndex(ScriptSet, SetProperty, &Element, &GetIntHash, &AreIntsEqual);
+        }));
+
+        Results.Add(Measure(TEXT("Containers"), TEXT("SetFindOrAdd"), NumCalls, [&](int32 Index)
+        {
+            const int32 Element = Index % NumElements;
+            Sink += UFScriptSetExporter::FindOrAdd(ScriptSet, SetProperty, &Element, &GetIntHash, &AreIntsEqual, &ConstructInt);
+        }));
+    }
+
+    static void RunDelegate(UCSInteropBenchmarkFixture* Fixture, TArray<FBenchmarkResult>& Results)
+    {
+        FMulticastDelegateProperty* DelegateProperty = CastFieldChecked<FMulticastDelegateProperty>(
+            UCSInteropBenchmarkFixture::StaticClass()->FindPropertyByName(GET_MEMBER_NAME_CHECKED(UCSInteropBenchmarkFixture, Delegate)));
+
+        FMulticastScriptDelegate* Delegate = reinterpret_cast<FMulticastScriptDelegate*>(&Fixture->Delegate);
+        UFMulticastDelegatePropertyExporter::AddDelegate(DelegateProperty, Delegate, Fixture, "OnDelegate");
+
+        int32 Value = 1;
+        Results.Add(Measure(TEXT("Delegate"), TEXT("BroadcastDelegate"), NumCalls, [&](int32)
+        {
+            UFMulticastDelegatePropertyExporter::BroadcastDelegate(DelegateProperty, Delegate, &Value);
+        }));
+
+        Sink += Fixture->Counter;
+    }
+
+    static void WriteResults(const TArray<FBenchmarkResult>& Results)
+    {
+        const FString Category = Results.IsEmpty() ? FString() : Results[0].Category;
+        const FString ReportPrefix = FString::Printf(TEXT("InteropBenchmark_%s_%s"), *Category, FPlatformProperties::IniPlatformName());
+
+        UnrealSharp::Benchmark::WriteResults<FBenchmarkResult>(Results, TEXT("InteropBenchmarks.csv"),
+            TEXT("Category,Case,NanosecondsPerCall,CallsPerSecond"), ReportPrefix,
+            [](const FBenchmarkResult& Result)
+            {
+                return FString::Printf(TEXT("%s,%s,%.2f,%.0f"), *Result.Category, *Result.Case, Result.NanosecondsPerCall, Result.CallsPerSecond);
+            },
+            [&Results](FJsonObject& Report)
+            {
+                Report.SetNumberField(TEXT("Iterations"), NumIterations);
+
+                TArray<TSharedPtr<FJsonValue>> ResultValues;
+                ResultValues.Reserve(Results.Num());
+
+                for (const FBenchmarkResult& Result : Results)
+                {
+                    TSharedRef<FJsonObject> ResultObject = MakeShared<FJsonObject>();
+                    ResultObject->SetStringField(TEXT("Category"), Result.Category);
+                    ResultObject->SetStringField(TEXT("Case"), Result.Case);
+                    ResultObject->SetNumberField(TEXT("NanosecondsPerCall"), Result.NanosecondsPerCall);
+                    ResultObject->SetNumberField(TEXT("CallsPerSecond"), Result.CallsPerSecond);
+                    ResultValues.Add(MakeShared<FJsonValueObject>(ResultObject));
+                }
+
+                Report.SetArrayField(TEXT("Results"), ResultValues);
+            });
+    }
+}
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FInteropBenchmarkTest, "UnrealSharp.Interop.Benchmark",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+void FInteropBenchmarkTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+    const TCHAR* Categories[] = { TEXT("ManagedInvoke"), TEXT("NativeInvoke"), TEXT("ObjectLookup"), TEXT("String"), TEXT("Containers"), TEXT("Delegate") };
+
+    for (const TCHAR* Category : Categories)
+    {
+        OutBeautifiedNames.Add(Category);
+        OutTestCommands.Add(Category);
+    }
+}
+
+bool FInteropBenchmarkTest::RunTest(const FString& Parameters)
+{
+    using namespace UnrealSharp::Interop::Benchmark;
+
+    UCSInteropBenchmarkFixture* Fixture = NewObject<UCSInteropBenchmarkFixture>(GetTransientPackage());
+    TStrongObjectPtr<UCSInteropBenchmarkFixture> FixtureReference(Fixture);
+
+    TArray<FBenchmarkResult> Results;
+
+    if (Parameters == TEXT("ManagedInvoke"))
+    {
+        RunManagedInvoke(*this, Results);
+    }
+    else if (Parameters == TEXT("NativeInvoke"))
+    {
+        RunNativeInvoke(Fixture, Results);
+    }
+    else if (Parameters == TEXT("ObjectLookup"))
+    {
+        RunObjectLookup(Fixture, Results);
+    }
+    else if (Parameters == TEXT("String"))
+    {
+        RunString(Results);
+    }
+    else if (Parameters == TEXT("Containers"))
+    {
+        RunContainers(Fixture, Results);
+    }
+    else if (Parameters == TEXT("Delegate"))
+    {
+        RunDelegate(Fixture, Results);
+    }
+
+    for (const FBenchmarkResult& Result : Results)
+    {
+        AddInfo(FString::Printf(TEXT("%s, %s: %.2f ns per call, %.0f calls per second"), *Result.Category, *Result.Case,
+            Result.NanosecondsPerCall, Result.CallsPerSecond));
+    }
+
+    if (!Results.IsEmpty())
+    {
+        WriteResults(Results);
+    }
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
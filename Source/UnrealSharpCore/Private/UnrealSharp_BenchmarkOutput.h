@@ -0,0 +1,59 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+
+/**
+ * Output of the benchmark and stress tests, all of them write to Saved/UnrealSharp/Benchmarks.
+ * Every run appends its rows to a CSV shared by all runs, for trend tracking in CI, and writes a JSON report of its own.
+ */
+namespace UnrealSharp::Benchmark
+{
+    inline FString GetBenchmarkDirectory()
+    {
+        return FPaths::ProjectSavedDir() / TEXT("UnrealSharp") / TEXT("Benchmarks");
+    }
+
+    /**
+     * Appends one row per result to CSVName and writes the report to ReportPrefix_<Time>.json.
+     * Rows and the report start with the timestamp and platform of the run, FormatRow and FillReport add the rest.
+     */
+    template<typename ResultType>
+    void WriteResults(const TArray<ResultType>& Results, const TCHAR* CSVName, const TCHAR* CSVHeader, const FString& ReportPrefix,
+        TFunctionRef<FString(const ResultType&)> FormatRow, TFunctionRef<void(FJsonObject&)> FillReport)
+    {
+        const FString Platform = FPlatformProperties::IniPlatformName();
+        const FString Timestamp = FDateTime::UtcNow().ToIso8601();
+
+        const FString CSVPath = GetBenchmarkDirectory() / CSVName;
+
+        FString CSV;
+        if (!FPaths::FileExists(CSVPath))
+        {
+            CSV += FString::Printf(TEXT("Timestamp,Platform,%s\n"), CSVHeader);
+        }
+
+        for (const ResultType& Result : Results)
+        {
+            CSV += FString::Printf(TEXT("%s,%s,%s\n"), *Timestamp, *Platform, *FormatRow(Result));
+        }
+
+        FFileHelper::SaveStringToFile(CSV, *CSVPath, FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), FILEWRITE_Append);
+
+        TSharedRef<FJsonObject> Report = MakeShared<FJsonObject>();
+        Report->SetStringField(TEXT("Timestamp"), Timestamp);
+        Report->SetStringField(TEXT("Platform"), Platform);
+        FillReport(*Report);
+
+        FString ReportString;
+        FJsonSerializer::Serialize(Report, TJsonWriterFactory<>::Create(&ReportString));
+
+        const FString ReportPath = GetBenchmarkDirectory() / FString::Printf(TEXT("%s_%s.json"), *ReportPrefix, *FDateTime::UtcNow().ToString());
+        FFileHelper::SaveStringToFile(ReportString, *ReportPath);
+    }
+}
@@ -1,4 +1,331 @@
-#include "CoreMinimal.h"
+#include "UnrealSharp_DiagnosticsSystem.h"
+#include "Containers/Queue.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/DateTime.h"
+#include "Misc/Paths.h"
+#include <atomic>
+
+namespace UnrealSharp::Diagnostics
+{
+    // Fast path state
+    struct FDiagnosticEventDesc
+    {
+        const TCHAR* Code = nullptr;
+        const TCHAR* Format = nullptr;
+        int32 Severity = 0;
+        std::atomic<int64> Count { 0 };
+    };
+
+    struct FDiagnosticRecord
+    {
+        FDateTime Timestamp;
+        FDiagnosticEventId EventId = 0;
+        uint8 NumArgs = 0;
+        FDiagnosticArg Args[MaxDiagnosticArgs];
+    };
+
+    /**
+     * Single producer, single consumer ring of one thread's records. The owning thread writes, the writer thread reads.
+     */
+    struct FDiagnosticThreadBuffer
+    {
+        static constexpr uint32 Capacity = 1024;
+
+        FDiagnosticRecord Records[Capacity];
+        std::atomic<uint32> Head { 0 };
+        std::atomic<uint32> Tail { 0 };
+        std::atomic<int64> NumDropped { 0 };
+    };
+
+    // Event ids are indices into this table. Entries are never removed, so the writer can read them without a lock.
+    constexpr int32 MaxDiagnosticEvents = 4096;
+    static FDiagnosticEventDesc DiagnosticEvents[MaxDiagnosticEvents];
+    static std::atomic<int32> NumDiagnosticEvents { 0 };
+
+    static FCriticalSection ThreadBuffersLock;
+
+    // Buffers outlive their threads, a thread that exits leaves its last records to be written
+    static TArray<TUniquePtr<FDiagnosticThreadBuffer>> ThreadBuffers;
+
+    static FString GetDiagnosticsLogPath()
+    {
+        return FPaths::Combine(FPaths::ProjectLogDir(), TEXT("UnrealSharp"), TEXT("UnrealSharp_Diagnostics.log"));
+    }
+
+    /**
+     * Background writer, the only thread that touches the diagnostics log
+     */
+    class FDiagnosticsWriter : public FRunnable
+    {
+    public:
+        static FDiagnosticsWriter& Get()
+        {
+            static FDiagnosticsWriter Writer;
+            return Writer;
+        }
+
+        void EnsureStarted()
+        {
+            if (bStarted.load(std::memory_order_acquire))
+            {
+                return;
+            }
+
+            FScopeLock Lock(&StartLock);
+            if (!bStarted.load(std::memory_order_relaxed))
+            {
+                WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+                Thread = FRunnableThread::Create(this, TEXT("UnrealSharpDiagnosticsWriter"), 0, TPri_BelowNormal);
+                bStarted.store(true, std::memory_order_release);
+            }
+        }
+
+        // Text of the slow path, already formatted
+        void EnqueueText(FString&& Text)
+        {
+            PendingText.Enqueue(MoveTemp(Text));
+            EnsureStarted();
+        }
+
+        void RequestTruncate()
+        {
+            bTruncateRequested.store(true, std::memory_order_relaxed);
+            EnsureStarted();
+            WakeEvent->Trigger();
+        }
+
+        void Flush()
+        {
+            if (!bStarted.load(std::memory_order_acquire))
+            {
+                return;
+            }
+
+            const int64 Target = FlushRequests.fetch_add(1, std::memory_order_relaxed) + 1;
+            WakeEvent->Trigger();
+
+            while (FlushesDone.load(std::memory_order_acquire) < Target)
+            {
+                FPlatformProcess::Sleep(0.001f);
+            }
+        }
+
+        void Shutdown()
+        {
+            if (!bStarted.load(std::memory_order_acquire))
+            {
+                return;
+            }
+
+            bStopping.store(true, std::memory_order_relaxed);
+            WakeEvent->Trigger();
+            Thread->WaitForCompletion();
+            delete Thread;
+            Thread = nullptr;
+
+            FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+            WakeEvent = nullptr;
+            bStopping.store(false, std::memory_order_relaxed);
+            bStarted.store(false, std::memory_order_release);
+        }
+
+        virtual uint32 Run() override
+        {
+            while (!bStopping.load(std::memory_order_relaxed))
+            {
+                WakeEvent->Wait(FTimespan::FromMilliseconds(100));
+
+                const int64 Requested = FlushRequests.load(std::memory_order_relaxed);
+                WriteBatch();
+                FlushesDone.store(Requested, std::memory_order_release);
+            }
+
+            WriteBatch();
+            FlushesDone.store(FlushRequests.load(std::memory_order_relaxed), std::memory_order_release);
+
+            delete FileHandle;
+            FileHandle = nullptr;
+            return 0;
+        }
+
+    private:
+        void WriteBatch()
+        {
+            Batch.Reset();
+
+            FString Text;
+            while (PendingText.Dequeue(Text))
+            {
+                Batch += Text;
+            }
+
+            DrainThreadBuffers();
+
+            if (bTruncateRequested.exchange(false, std::memory_order_relaxed))
+            {
+                delete FileHandle;
+                FileHandle = nullptr;
+                OpenFile(false);
+            }
+
+            if (Batch.IsEmpty() || !OpenFile(true))
+            {
+                return;
+            }
+
+            const FTCHARToUTF8 UTF8Batch(*Batch, Batch.Len());
+            FileHandle->Write(reinterpret_cast<const uint8*>(UTF8Batch.Get()), UTF8Batch.Length());
+            FileHandle->Flush();
+        }
+
+        void DrainThreadBuffers()
+        {
+            FScopeLock Lock(&ThreadBuffersLock);
+            for (const TUniquePtr<FDiagnosticThreadBuffer>& Buffer : ThreadBuffers)
+            {
+                const uint32 Head = Buffer->Head.load(std::memory_order_acquire);
+                uint32 Tail = Buffer->Tail.load(std::memory_order_relaxed);
+
+                for (; Tail != Head; ++Tail)
+                {
+                    FormatRecord(Buffer->Records[Tail % FDiagnosticThreadBuffer::Capacity]);
+                }
+
+                Buffer->Tail.store(Tail, std::memory_order_release);
+
+                if (const int64 NumDropped = Buffer->NumDropped.exchange(0, std::memory_order_relaxed))
+                {
+                    Batch += FString::Printf(TEXT("[%s] [US_DIAG_001|Diagnostics|3] Dropped %lld records, a thread recorded faster than they could be written\n---\n"),
+                        *FDateTime::Now().ToString(), NumDropped);
+                }
+            }
+        }
+
+        void FormatRecord(const FDiagnosticRecord& Record)
+        {
+            const FDiagnosticEventDesc& Event = DiagnosticEvents[Record.EventId];
+
+            // Replace {N} with the arguments, everything else is copied as it is
+            FString Message;
+            for (const TCHAR* Char = Event.Format; *Char; ++Char)
+            {
+                if (Char[0] == TEXT('{') && FChar::IsDigit(Char[1]) && Char[2] == TEXT('}') && Char[1] - TEXT('0') < Record.NumArgs)
+                {
+                    const FDiagnosticArg& Arg = Record.Args[Char[1] - TEXT('0')];
+                    switch (Arg.Type)
+                    {
+                    case FDiagnosticArg::EType::Int: Message.Appendf(TEXT("%lld"), Arg.Int); break;
+                    case FDiagnosticArg::EType::UInt: Message.Appendf(TEXT("%llu"), Arg.UInt); break;
+                    case FDiagnosticArg::EType::Double: Message.Appendf(TEXT("%.3f"), Arg.Double); break;
+                    }
+
+                    Char += 2;
+                    continue;
+                }
+
+                Message.AppendChar(*Char);
+            }
+
+            Batch += FString::Printf(TEXT("[%s] [%s|%d] %s\n---\n"), *Record.Timestamp.ToString(), Event.Code, Event.Severity, *Message);
+
+            if (Event.Severity >= 5)
+            {
+                UE_LOG(LogTemp, Error, TEXT("UnrealSharp [%s]: %s"), Event.Code, *Message);
+            }
+            else if (Event.Severity == 4)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("UnrealSharp [%s]: %s"), Event.Code, *Message);
+            }
+        }
+
+        bool OpenFile(bool bAppend)
+        {
+            if (FileHandle)
+            {
+                return true;
+            }
+
+            const FString LogPath = GetDiagnosticsLogPath();
+            IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+            PlatformFile.CreateDirectoryTree(*FPaths::GetPath(LogPath));
+
+            FileHandle = PlatformFile.OpenWrite(*LogPath, bAppend, true);
+            return FileHandle != nullptr;
+        }
+
+        FCriticalSection StartLock;
+        std::atomic<bool> bStarted { false };
+        std::atomic<bool> bStopping { false };
+        std::atomic<bool> bTruncateRequested { false };
+        std::atomic<int64> FlushRequests { 0 };
+        std::atomic<int64> FlushesDone { 0 };
+
+        FRunnableThread* Thread = nullptr;
+        FEvent* WakeEvent = nullptr;
+        TQueue<FString, EQueueMode::Mpsc> PendingText;
+
+        // Only touched on the writer thread
+        IFileHandle* FileHandle = nullptr;
+        FString Batch;
+    };
+
+    static FDiagnosticThreadBuffer& GetThreadBuffer()
+    {
+        thread_local FDiagnosticThreadBuffer* ThreadBuffer = nullptr;
+        if (!ThreadBuffer)
+        {
+            TUniquePtr<FDiagnosticThreadBuffer> NewBuffer = MakeUnique<FDiagnosticThreadBuffer>();
+            ThreadBuffer = NewBuffer.Get();
+
+            FScopeLock Lock(&ThreadBuffersLock);
+            ThreadBuffers.Add(MoveTemp(NewBuffer));
+        }
+
+        return *ThreadBuffer;
+    }
+
+    FDiagnosticEventId RegisterDiagnosticEvent(const TCHAR* Code, const TCHAR* Format, int32 Severity)
+    {
+        const int32 EventId = NumDiagnosticEvents.fetch_add(1, std::memory_order_relaxed);
+        check(EventId < MaxDiagnosticEvents);
+
+        FDiagnosticEventDesc& Event = DiagnosticEvents[EventId];
+        Event.Code = Code;
+        Event.Format = Format;
+        Event.Severity = FMath::Clamp(Severity, 1, 5);
+
+        FDiagnosticsWriter::Get().EnsureStarted();
+        return static_cast<FDiagnosticEventId>(EventId);
+    }
+
+    void EnqueueDiagnosticRecord(FDiagnosticEventId EventId, const FDiagnosticArg* Args, int32 NumArgs)
+    {
+        DiagnosticEvents[EventId].Count.fetch_add(1, std::memory_order_relaxed);
+
+        FDiagnosticThreadBuffer& Buffer = GetThreadBuffer();
+        const uint32 Head = Buffer.Head.load(std::memory_order_relaxed);
+        if (Head - Buffer.Tail.load(std::memory_order_acquire) >= FDiagnosticThreadBuffer::Capacity)
+        {
+            Buffer.NumDropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        FDiagnosticRecord& Record = Buffer.Records[Head % FDiagnosticThreadBuffer::Capacity];
+        Record.Timestamp = FDateTime::Now();
+        Record.EventId = EventId;
+        Record.NumArgs = static_cast<uint8>(NumArgs);
+        FMemory::Memcpy(Record.Args, Args, NumArgs * sizeof(FDiagnosticArg));
+
+        Buffer.Head.store(Head + 1, std::memory_order_release);
+    }
+
+    void FlushDiagnostics()
+    {
+        FDiagnosticsWriter::Get().Flush();
+    }
+}
 
 #if WITH_MONO_RUNTIME
 
@@ -8,7 +335,6 @@
 #include "mono/metadata/debug-helpers.h"
 #include "HAL/FileManager.h"
 #include "Misc/FileHelper.h"
-#include "Misc/DateTime.h"
 #include "Engine/Engine.h"
 #include "Framework/Notifications/NotificationManager.h"
 #include "Widgets/Notifications/SNotificationList.h"
@@ -132,7 +458,7 @@ namespace UnrealSharp::Diagnostics
         IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
         PlatformFile.CreateDirectoryTree(*LogDir);
         
-        DiagnosticsState.LogFilePath = FPaths::Combine(LogDir, TEXT("UnrealSharp_Diagnostics.log"));
+        DiagnosticsState.LogFilePath = GetDiagnosticsLogPath();
 
         // Load existing diagnostics history
         LoadDiagnosticsHistory();
@@ -348,9 +674,7 @@ namespace UnrealSharp::Diagnostics
 
         LogLine += TEXT("---\n");
 
-        FFileHelper::SaveStringToFile(LogLine, *DiagnosticsState.LogFilePath, 
-                                     FFileHelper::EEncodingOptions::AutoDetect, 
-                                     &IFileManager::Get(), FILEWRITE_Append);
+        FDiagnosticsWriter::Get().EnqueueText(MoveTemp(LogLine));
     }
 
     /**
@@ -485,7 +809,7 @@ namespace UnrealSharp::Diagnostics
         DiagnosticsState.CategoryCounts.Empty();
 
         // Clear log file
-        FFileHelper::SaveStringToFile(TEXT(""), *DiagnosticsState.LogFilePath);
+        FDiagnosticsWriter::Get().RequestTruncate();
 
         LogDiagnosticEvent(TEXT("US_ADMIN_001"), TEXT("Diagnostics history cleared"), 1);
     }
@@ -556,6 +880,7 @@ namespace UnrealSharp::Diagnostics
 
         // Save final state to file
         WriteDiagnosticToFile(FDiagnosticEntry{}); // Empty entry as separator
+        FDiagnosticsWriter::Get().Shutdown();
 
         DiagnosticsState.bIsInitialized = false;
     }
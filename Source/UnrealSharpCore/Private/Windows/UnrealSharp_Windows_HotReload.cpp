@@ -7,7 +7,7 @@
 #include "Misc/FileHelper.h"
 #include "Misc/DateTime.h"
 #include "Engine/Engine.h"
-#include "Async/TaskGraphInterfaces.h"
+#include "Tasks/Task.h"
 
 // Mono includes for Windows hot reload
 #include "mono/metadata/mono-config.h"
@@ -18,6 +18,9 @@
 
 namespace UnrealSharp::Windows::HotReload
 {
+    // Hot reload domains are used in turns, so there are never more than two of them
+    constexpr int32 NumHotReloadDomainSlots = 2;
+
     // Windows-specific hot reload state
     struct FWindowsHotReloadState
     {
@@ -29,10 +32,17 @@ namespace UnrealSharp::Windows::HotReload
         bool bIsInitialized;
         FWindowsHotReloadStats Stats;
 
+        // One slot holds the current domain, the other the retired one while it is unloaded in the background
+        MonoDomain* DomainSlots[NumHotReloadDomainSlots];
+        UE::Tasks::FTask DomainUnloadTasks[NumHotReloadDomainSlots];
+        int32 CurrentDomainSlot;
+
         FWindowsHotReloadState()
             : MainDomain(nullptr)
             , CurrentHotReloadDomain(nullptr)
             , bIsInitialized(false)
+            , DomainSlots{}
+            , CurrentDomainSlot(INDEX_NONE)
         {}
     };
 
@@ -67,13 +77,59 @@ namespace UnrealSharp::Windows::HotReload
         UE_LOG(LogTemp, Log, TEXT("UnrealSharp Windows: Configured enhanced Mono hot reload with Windows optimizations"));
     }
 
+    /**
+     * Unload the domain of a slot on a background thread, the slot can be used again once the task is done
+     */
+    static void RetireDomainSlot(int32 Slot)
+    {
+        MonoDomain* RetiredDomain = WindowsHotReloadState.DomainSlots[Slot];
+        if (!RetiredDomain)
+        {
+            return;
+        }
+
+        WindowsHotReloadState.DomainSlots[Slot] = nullptr;
+
+        // Assemblies loaded in the retired domain go away with it
+        for (auto It = WindowsHotReloadState.AssemblyDomains.CreateIterator(); It; ++It)
+        {
+            if (It->Value == RetiredDomain)
+            {
+                WindowsHotReloadState.RegisteredAssemblies.Remove(It->Key);
+                It.RemoveCurrent();
+            }
+        }
+
+        WindowsHotReloadState.DomainUnloadTasks[Slot] = UE::Tasks::Launch(UE_SOURCE_LOCATION, [RetiredDomain]()
+        {
+            double StartTime = FPlatformTime::Seconds();
+            MonoThread* Thread = mono_thread_attach(mono_get_root_domain());
+
+            mono_domain_unload(RetiredDomain);
+
+            mono_thread_detach(Thread);
+            UE_LOG(LogTemp, VeryVerbose, TEXT("UnrealSharp Windows: Unloaded retired hot reload domain in %.3f seconds"), FPlatformTime::Seconds() - StartTime);
+        }, UE::Tasks::ETaskPriority::BackgroundNormal);
+    }
+
     /**
      * Enhanced AppDomain switching for Windows with no restart
+     * Domains are used in turns: the new one goes in the free slot, and the previous one is retired in the background,
+     * so the game thread only pays for creating the domain and switching to it.
      */
     bool SwitchToHotReloadDomainWindows(const FString& AssemblyName)
     {
-        // Create new domain if needed
-        FString DomainName = FString::Printf(TEXT("HotReloadDomain_%s_%lld"), *AssemblyName, FDateTime::Now().GetTicks());
+        const int32 NextSlot = (WindowsHotReloadState.CurrentDomainSlot + 1) % NumHotReloadDomainSlots;
+
+        // Only blocks when reloads come in faster than a domain unloads
+        UE::Tasks::FTask& PendingUnload = WindowsHotReloadState.DomainUnloadTasks[NextSlot];
+        if (PendingUnload.IsValid())
+        {
+            PendingUnload.Wait();
+            PendingUnload = UE::Tasks::FTask();
+        }
+
+        FString DomainName = FString::Printf(TEXT("UnrealSharpHotReloadDomain_%d"), NextSlot);
         
         MonoDomain* NewDomain = mono_domain_create_appdomain(TCHAR_TO_ANSI(*DomainName), nullptr);
         if (!NewDomain)
@@ -82,9 +138,6 @@ namespace UnrealSharp::Windows::HotReload
             return false;
         }
 
-        // Store previous domain
-        MonoDomain* PreviousDomain = WindowsHotReloadState.CurrentHotReloadDomain;
-        
         // Switch to new domain
         if (!mono_domain_set(NewDomain, false))
         {
@@ -93,20 +146,19 @@ namespace UnrealSharp::Windows::HotReload
             return false;
         }
 
+        const int32 PreviousSlot = WindowsHotReloadState.CurrentDomainSlot;
+
+        WindowsHotReloadState.DomainSlots[NextSlot] = NewDomain;
+        WindowsHotReloadState.CurrentDomainSlot = NextSlot;
         WindowsHotReloadState.CurrentHotReloadDomain = NewDomain;
-        WindowsHotReloadState.AssemblyDomains.Add(AssemblyName, NewDomain);
 
-        // Schedule cleanup of previous domain
-        if (PreviousDomain && PreviousDomain != WindowsHotReloadState.MainDomain)
+        if (PreviousSlot != INDEX_NONE)
         {
-            // Unload previous domain asynchronously to avoid blocking
-            FFunctionGraphTask::CreateAndDispatchWhenReady([PreviousDomain]()
-            {
-                mono_domain_unload(PreviousDomain);
-                UE_LOG(LogTemp, VeryVerbose, TEXT("UnrealSharp Windows: Cleaned up previous hot reload domain"));
-            }, TStatId(), nullptr, ENamedThreads::AnyBackgroundThreadNormalTask);
+            RetireDomainSlot(PreviousSlot);
         }
 
+        WindowsHotReloadState.AssemblyDomains.Add(AssemblyName, NewDomain);
+
         UE_LOG(LogTemp, Log, TEXT("UnrealSharp Windows: Switched to enhanced hot reload domain for %s (no restart)"), *AssemblyName);
         return true;
     }
@@ -304,21 +356,30 @@ namespace UnrealSharp::Windows::HotReload
 
         UE_LOG(LogTemp, Log, TEXT("UnrealSharp Windows: Shutting down enhanced hot reload system"));
 
+        // Switch back to main domain, the current domain can't be unloaded while it is set
+        if (WindowsHotReloadState.MainDomain)
+        {
+            mono_domain_set(WindowsHotReloadState.MainDomain, false);
+        }
+
         // Clean up hot reload domains
-        for (auto& DomainPair : WindowsHotReloadState.AssemblyDomains)
+        for (int32 Slot = 0; Slot < NumHotReloadDomainSlots; ++Slot)
         {
-            MonoDomain* Domain = DomainPair.Value;
-            if (Domain && Domain != WindowsHotReloadState.MainDomain)
+            if (WindowsHotReloadState.DomainUnloadTasks[Slot].IsValid())
+            {
+                WindowsHotReloadState.DomainUnloadTasks[Slot].Wait();
+                WindowsHotReloadState.DomainUnloadTasks[Slot] = UE::Tasks::FTask();
+            }
+
+            if (MonoDomain* Domain = WindowsHotReloadState.DomainSlots[Slot])
             {
                 mono_domain_unload(Domain);
+                WindowsHotReloadState.DomainSlots[Slot] = nullptr;
             }
         }
 
-        // Switch back to main domain
-        if (WindowsHotReloadState.MainDomain)
-        {
-            mono_domain_set(WindowsHotReloadState.MainDomain, false);
-        }
+        WindowsHotReloadState.CurrentDomainSlot = INDEX_NONE;
+        WindowsHotReloadState.CurrentHotReloadDomain = nullptr;
 
         // Clear state
         WindowsHotReloadState.RegisteredAssemblies.Empty();
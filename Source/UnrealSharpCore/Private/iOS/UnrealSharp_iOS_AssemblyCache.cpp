@@ -10,8 +10,10 @@
 #include "Misc/Paths.h"
 #include "Misc/DateTime.h"
 #include "Misc/SecureHash.h"
+#include "Containers/List.h"
 #include "HAL/PlatformFilemanager.h"
 #include "GenericPlatform/GenericPlatformFile.h"
+#include "Utils/CSChunkedCompression.h"
 
 /**
  * Advanced iOS Assembly Caching System
@@ -31,25 +33,39 @@ namespace UnrealSharp::iOS::AssemblyCache
     {
         FString AssemblyName;
         FString ContentHash;
-        TArray<uint8> AssemblyData;
+        // Shared with every other entry holding the same content
+        TSharedPtr<const TArray<uint8>> AssemblyData;
         FDateTime CacheTime;
         FDateTime LastAccessTime;
         uint32 AccessCount;
         bool bIsCompressed;
         uint32 OriginalSize;
+        TDoubleLinkedList<FString>::TDoubleLinkedListNode* LRUNode;
         
         FCacheEntry()
             : AccessCount(0)
             , bIsCompressed(false)
             , OriginalSize(0)
+            , LRUNode(nullptr)
         {}
     };
 
+    // Assembly data stored by the content hash of the original data, so identical versions share one buffer across reloads
+    struct FCacheBlob
+    {
+        TSharedRef<const TArray<uint8>> Data;
+        bool bIsCompressed;
+        uint32 OriginalSize;
+        int32 NumEntries;
+    };
+
     // Cache state management
     struct FiOSAssemblyCacheState
     {
         // Multi-tier cache storage
         TMap<FString, FCacheEntry> MemoryCache;           // L1 cache - in memory
+        TMap<FString, FCacheBlob> BlobsByHash;            // L1 cache data, shared between entries
+        TDoubleLinkedList<FString> LRUList;               // Most recently used memory cache entry first
         TMap<FString, FString> PersistentCacheIndex;      // L2 cache - on disk index
         TMap<FString, MonoAssembly*> CompiledAssemblies;  // L3 cache - compiled assemblies
         
@@ -58,6 +74,7 @@ namespace UnrealSharp::iOS::AssemblyCache
         int32 MaxPersistentCacheSize;  // Maximum persistent cache size in MB
         int32 CacheExpiryDays;         // Cache expiry in days
         bool bEnableCompression;       // Enable assembly compression
+        FCSChunkedCompressionSettings CompressionSettings;
         
         // Cache paths
         FString PersistentCachePath;
@@ -86,6 +103,69 @@ namespace UnrealSharp::iOS::AssemblyCache
 
     static FiOSAssemblyCacheState iOSCacheState;
 
+    /**
+     * Remove a memory cache entry, and its blob once nothing else uses it
+     */
+    void RemoveFromMemoryCache(const FString& AssemblyName)
+    {
+        FCacheEntry Entry;
+        if (!iOSCacheState.MemoryCache.RemoveAndCopyValue(AssemblyName, Entry))
+        {
+            return;
+        }
+
+        iOSCacheState.LRUList.RemoveNode(Entry.LRUNode);
+
+        FCacheBlob& Blob = iOSCacheState.BlobsByHash.FindChecked(Entry.ContentHash);
+        if (--Blob.NumEntries == 0)
+        {
+            iOSCacheState.BlobsByHash.Remove(Entry.ContentHash);
+        }
+    }
+
+    /**
+     * Add or replace a memory cache entry, sharing the blob of its content when there already is one
+     */
+    void AddToMemoryCache(const FString& AssemblyName, FCacheEntry&& Entry)
+    {
+        RemoveFromMemoryCache(AssemblyName);
+
+        if (FCacheBlob* Blob = iOSCacheState.BlobsByHash.Find(Entry.ContentHash))
+        {
+            Entry.AssemblyData = Blob->Data;
+            Entry.bIsCompressed = Blob->bIsCompressed;
+            Entry.OriginalSize = Blob->OriginalSize;
+            Blob->NumEntries++;
+        }
+        else
+        {
+            iOSCacheState.BlobsByHash.Add(Entry.ContentHash, FCacheBlob{ Entry.AssemblyData.ToSharedRef(), Entry.bIsCompressed, Entry.OriginalSize, 1 });
+        }
+
+        iOSCacheState.LRUList.AddHead(AssemblyName);
+        Entry.LRUNode = iOSCacheState.LRUList.GetHead();
+        iOSCacheState.MemoryCache.Add(AssemblyName, MoveTemp(Entry));
+    }
+
+    /**
+     * Mark a memory cache entry as the most recently used one
+     */
+    void TouchMemoryCacheEntry(FCacheEntry& Entry)
+    {
+        Entry.LastAccessTime = FDateTime::Now();
+        Entry.AccessCount++;
+
+        iOSCacheState.LRUList.RemoveNode(Entry.LRUNode, false);
+        iOSCacheState.LRUList.AddHead(Entry.LRUNode);
+    }
+
+    void EmptyMemoryCache()
+    {
+        iOSCacheState.MemoryCache.Empty();
+        iOSCacheState.BlobsByHash.Empty();
+        iOSCacheState.LRUList.Empty();
+    }
+
     /**
      * Calculate content hash for cache validation
      */
@@ -105,26 +185,13 @@ namespace UnrealSharp::iOS::AssemblyCache
             return false;
         }
 
-        // Use built-in compression
-        int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Zlib, OriginalData.Num());
-        CompressedData.SetNumUninitialized(CompressedSize);
-
-        bool bSuccess = FCompression::CompressMemory(
-            NAME_Zlib,
-            CompressedData.GetData(),
-            CompressedSize,
-            OriginalData.GetData(),
-            OriginalData.Num()
-        );
-
-        if (bSuccess)
+        if (FCSChunkedCompression::Compress(OriginalData, iOSCacheState.CompressionSettings, CompressedData))
         {
-            CompressedData.SetNum(CompressedSize);
-            int32 Savings = OriginalData.Num() - CompressedSize;
+            int32 Savings = OriginalData.Num() - CompressedData.Num();
             iOSCacheState.CompressionSavings += Savings;
             
             UE_LOG(LogTemp, Log, TEXT("UnrealSharp iOS Cache: Compressed assembly data %d -> %d bytes (%.1f%% saved)"), 
-                   OriginalData.Num(), CompressedSize, (float)Savings / OriginalData.Num() * 100.0f);
+                   OriginalData.Num(), CompressedData.Num(), (float)Savings / OriginalData.Num() * 100.0f);
             return true;
         }
         else
@@ -137,23 +204,10 @@ namespace UnrealSharp::iOS::AssemblyCache
     /**
      * Decompress assembly data for use
      */
-    bool DecompressAssemblyData(const TArray<uint8>& CompressedData, TArray<uint8>& DecompressedData, uint32 OriginalSize)
+    bool DecompressAssemblyData(const TArray<uint8>& CompressedData, TArray<uint8>& DecompressedData)
     {
-        if (OriginalSize == 0)
-        {
-            DecompressedData = CompressedData;
-            return false;
-        }
-
-        DecompressedData.SetNumUninitialized(OriginalSize);
-
-        bool bSuccess = FCompression::UncompressMemory(
-            NAME_Zlib,
-            DecompressedData.GetData(),
-            OriginalSize,
-            CompressedData.GetData(),
-            CompressedData.Num()
-        );
+        // The chunked header records the original size, so nothing has to be guessed
+        bool bSuccess = FCSChunkedCompression::Decompress(CompressedData, DecompressedData);
 
         if (!bSuccess)
         {
@@ -256,14 +310,20 @@ namespace UnrealSharp::iOS::AssemblyCache
         FTimespan ExpirySpan = FTimespan::FromDays(iOSCacheState.CacheExpiryDays);
         
         // Clean memory cache
-        for (auto It = iOSCacheState.MemoryCache.CreateIterator(); It; ++It)
+        TArray<FString> ExpiredEntries;
+        for (const auto& Entry : iOSCacheState.MemoryCache)
         {
-            if (CurrentTime - It->Value.CacheTime > ExpirySpan)
+            if (CurrentTime - Entry.Value.CacheTime > ExpirySpan)
             {
-                UE_LOG(LogTemp, Log, TEXT("UnrealSharp iOS Cache: Removing expired memory cache entry '%s'"), *It->Key);
-                It.RemoveCurrent();
+                ExpiredEntries.Add(Entry.Key);
             }
         }
+
+        for (const FString& AssemblyName : ExpiredEntries)
+        {
+            UE_LOG(LogTemp, Log, TEXT("UnrealSharp iOS Cache: Removing expired memory cache entry '%s'"), *AssemblyName);
+            RemoveFromMemoryCache(AssemblyName);
+        }
         
         // Clean persistent cache files
         IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
@@ -310,8 +370,7 @@ namespace UnrealSharp::iOS::AssemblyCache
         {
             if (ExistingEntry->ContentHash == ContentHash)
             {
-                ExistingEntry->LastAccessTime = FDateTime::Now();
-                ExistingEntry->AccessCount++;
+                TouchMemoryCacheEntry(*ExistingEntry);
                 return true; // Already cached with same content
             }
         }
@@ -325,19 +384,30 @@ namespace UnrealSharp::iOS::AssemblyCache
         CacheEntry.AccessCount = 1;
         CacheEntry.OriginalSize = AssemblyData.Num();
 
-        // Compress assembly data
-        TArray<uint8> DataToStore;
-        CacheEntry.bIsCompressed = CompressAssemblyData(AssemblyData, DataToStore);
-        CacheEntry.AssemblyData = DataToStore;
+        // Compress assembly data, unless another entry already holds the same content
+        if (const FCacheBlob* Blob = iOSCacheState.BlobsByHash.Find(ContentHash))
+        {
+            CacheEntry.AssemblyData = Blob->Data;
+            CacheEntry.bIsCompressed = Blob->bIsCompressed;
+        }
+        else
+        {
+            TArray<uint8> CompressedData;
+            CacheEntry.bIsCompressed = CompressAssemblyData(AssemblyData, CompressedData);
+            CacheEntry.AssemblyData = MakeShared<TArray<uint8>>(MoveTemp(CompressedData));
+        }
+
+        const bool bIsCompressed = CacheEntry.bIsCompressed;
+        TSharedPtr<const TArray<uint8>> DataToStore = CacheEntry.AssemblyData;
 
         // Store in memory cache (L1)
-        iOSCacheState.MemoryCache.Add(AssemblyName, CacheEntry);
+        AddToMemoryCache(AssemblyName, MoveTemp(CacheEntry));
 
         // Store in persistent cache (L2)
         FString CacheFileName = FString::Printf(TEXT("%s_%s.cache"), *AssemblyName, *ContentHash);
         FString CacheFilePath = FPaths::Combine(iOSCacheState.PersistentCachePath, CacheFileName);
         
-        if (FFileHelper::SaveArrayToFile(DataToStore, *CacheFilePath))
+        if (FFileHelper::SaveArrayToFile(*DataToStore, *CacheFilePath))
         {
             iOSCacheState.PersistentCacheIndex.Add(AssemblyName, CacheFileName);
             SavePersistentCacheIndex();
@@ -348,7 +418,7 @@ namespace UnrealSharp::iOS::AssemblyCache
             UE_LOG(LogTemp, Log, TEXT("UnrealSharp iOS Cache: Cached assembly '%s' (%.1f KB, compressed: %s) in %.3f seconds"), 
                    *AssemblyName, 
                    AssemblyData.Num() / 1024.0f,
-                   CacheEntry.bIsCompressed ? TEXT("Yes") : TEXT("No"),
+                   bIsCompressed ? TEXT("Yes") : TEXT("No"),
                    ElapsedTime);
             
             return true;
@@ -356,7 +426,7 @@ namespace UnrealSharp::iOS::AssemblyCache
         else
         {
             // Remove from memory cache if persistent storage failed
-            iOSCacheState.MemoryCache.Remove(AssemblyName);
+            RemoveFromMemoryCache(AssemblyName);
             return false;
         }
     }
@@ -376,17 +446,16 @@ namespace UnrealSharp::iOS::AssemblyCache
         // Check memory cache first (L1)
         if (FCacheEntry* CacheEntry = iOSCacheState.MemoryCache.Find(AssemblyName))
         {
-            CacheEntry->LastAccessTime = FDateTime::Now();
-            CacheEntry->AccessCount++;
+            TouchMemoryCacheEntry(*CacheEntry);
             
             // Decompress if needed
             if (CacheEntry->bIsCompressed)
             {
-                DecompressAssemblyData(CacheEntry->AssemblyData, OutAssemblyData, CacheEntry->OriginalSize);
+                DecompressAssemblyData(*CacheEntry->AssemblyData, OutAssemblyData);
             }
             else
             {
-                OutAssemblyData = CacheEntry->AssemblyData;
+                OutAssemblyData = *CacheEntry->AssemblyData;
             }
             
             iOSCacheState.CacheHits++;
@@ -403,38 +472,23 @@ namespace UnrealSharp::iOS::AssemblyCache
         {
             FString CacheFilePath = FPaths::Combine(iOSCacheState.PersistentCachePath, *CacheFileName);
             
-            TArray<uint8> CachedData;
-            if (FFileHelper::LoadFileToArray(CachedData, *CacheFilePath))
+            // Chunks are decompressed on workers while the rest of the file is still being read
+            if (FCSChunkedCompression::LoadFile(CacheFilePath, OutAssemblyData))
             {
-                // Create memory cache entry for faster future access
+                // Create memory cache entry for faster future access. The assembly is in use now, so it's
+                // kept decompressed rather than paying for decompression again on every retrieval.
                 FCacheEntry MemoryCacheEntry;
                 MemoryCacheEntry.AssemblyName = AssemblyName;
-                MemoryCacheEntry.AssemblyData = CachedData;
                 MemoryCacheEntry.CacheTime = FDateTime::Now();
                 MemoryCacheEntry.LastAccessTime = MemoryCacheEntry.CacheTime;
                 MemoryCacheEntry.AccessCount = 1;
+                MemoryCacheEntry.bIsCompressed = false;
+                MemoryCacheEntry.OriginalSize = OutAssemblyData.Num();
                 
-                // Determine if compressed by checking if decompression is needed
-                // (simplified - in real implementation, store this metadata)
-                MemoryCacheEntry.bIsCompressed = true; // Assume compressed for now
-                MemoryCacheEntry.OriginalSize = CachedData.Num() * 2; // Estimate
-                
-                // Try decompression
-                TArray<uint8> DecompressedData;
-                if (DecompressAssemblyData(CachedData, DecompressedData, MemoryCacheEntry.OriginalSize))
-                {
-                    OutAssemblyData = DecompressedData;
-                    MemoryCacheEntry.OriginalSize = DecompressedData.Num();
-                }
-                else
-                {
-                    OutAssemblyData = CachedData;
-                    MemoryCacheEntry.bIsCompressed = false;
-                    MemoryCacheEntry.OriginalSize = CachedData.Num();
-                }
-                
-                // Add to memory cache for future fast access
-                iOSCacheState.MemoryCache.Add(AssemblyName, MemoryCacheEntry);
+                // Add to memory cache for future fast access, keyed by the original data like CacheAssembly does
+                MemoryCacheEntry.ContentHash = CalculateContentHash(OutAssemblyData);
+                MemoryCacheEntry.AssemblyData = MakeShared<TArray<uint8>>(OutAssemblyData);
+                AddToMemoryCache(AssemblyName, MoveTemp(MemoryCacheEntry));
                 
                 iOSCacheState.CacheHits++;
                 
@@ -470,6 +524,7 @@ namespace UnrealSharp::iOS::AssemblyCache
         FString Stats;
         Stats += FString::Printf(TEXT("iOS Assembly Cache Statistics:\n"));
         Stats += FString::Printf(TEXT("Memory Cache Entries: %d\n"), iOSCacheState.MemoryCache.Num());
+        Stats += FString::Printf(TEXT("Memory Cache Blobs: %d\n"), iOSCacheState.BlobsByHash.Num());
         Stats += FString::Printf(TEXT("Persistent Cache Entries: %d\n"), iOSCacheState.PersistentCacheIndex.Num());
         Stats += FString::Printf(TEXT("Compiled Assemblies: %d\n"), iOSCacheState.CompiledAssemblies.Num());
         Stats += FString::Printf(TEXT("Cache Hits: %d\n"), iOSCacheState.CacheHits);
@@ -495,7 +550,7 @@ namespace UnrealSharp::iOS::AssemblyCache
         UE_LOG(LogTemp, Log, TEXT("UnrealSharp iOS Cache: Clearing all cache data"));
 
         // Clear memory cache
-        iOSCacheState.MemoryCache.Empty();
+        EmptyMemoryCache();
         iOSCacheState.CompiledAssemblies.Empty();
 
         // Clear persistent cache files
@@ -529,24 +584,13 @@ namespace UnrealSharp::iOS::AssemblyCache
         // Remove least recently used entries if memory cache is too large
         if (iOSCacheState.MemoryCache.Num() > 50) // Arbitrary limit
         {
-            TArray<TPair<FString, FDateTime>> AccessTimes;
-            
-            for (const auto& Entry : iOSCacheState.MemoryCache)
-            {
-                AccessTimes.Add(TPair<FString, FDateTime>(Entry.Key, Entry.Value.LastAccessTime));
-            }
-            
-            // Sort by access time (oldest first)
-            AccessTimes.Sort([](const TPair<FString, FDateTime>& A, const TPair<FString, FDateTime>& B) {
-                return A.Value < B.Value;
-            });
-            
-            // Remove oldest 20%
-            int32 RemoveCount = FMath::Max(1, AccessTimes.Num() / 5);
+            // Remove the oldest 20%, from the tail of the LRU list
+            int32 RemoveCount = FMath::Max(1, iOSCacheState.MemoryCache.Num() / 5);
             for (int32 i = 0; i < RemoveCount; i++)
             {
-                iOSCacheState.MemoryCache.Remove(AccessTimes[i].Key);
-                UE_LOG(LogTemp, VeryVerbose, TEXT("UnrealSharp iOS Cache: Removed LRU entry '%s'"), *AccessTimes[i].Key);
+                const FString AssemblyName = iOSCacheState.LRUList.GetTail()->GetValue();
+                RemoveFromMemoryCache(AssemblyName);
+                UE_LOG(LogTemp, VeryVerbose, TEXT("UnrealSharp iOS Cache: Removed LRU entry '%s'"), *AssemblyName);
             }
         }
 
@@ -572,7 +616,7 @@ namespace UnrealSharp::iOS::AssemblyCache
         UE_LOG(LogTemp, Log, TEXT("%s"), *GetCacheStatistics());
 
         // Clear memory structures
-        iOSCacheState.MemoryCache.Empty();
+        EmptyMemoryCache();
         iOSCacheState.PersistentCacheIndex.Empty();
         iOSCacheState.CompiledAssemblies.Empty();
 
@@ -10,6 +10,7 @@
 #include "mono/metadata/reflection.h"
 #include "mono/metadata/loader.h"
 #include "HAL/FileManager.h"
+#include "iOS/UnrealSharp_iOS_HotReload.h"
 #include "Misc/FileHelper.h"
 
 /**
@@ -93,14 +94,8 @@ namespace UnrealSharp::iOS::AssemblyContext
             return TEXT("");
         }
 
-        // Configure domain for interpreter mode (required for hot reload)
-        MonoDomain* OriginalDomain = mono_domain_get();
-        mono_domain_set(NewDomain, false);
-        
-        // Set interpreter mode for this domain
-        mono_jit_set_aot_mode(MONO_AOT_MODE_INTERP);
-        
-        mono_domain_set(OriginalDomain, false);
+        // The execution mode is per assembly and process wide, hot reloadable assemblies are interpreted in every domain
+        UnrealSharp::iOS::HotReload::ConfigureMixedExecutionMode();
 
         // Create context
         FAssemblyLoadContext NewContext;
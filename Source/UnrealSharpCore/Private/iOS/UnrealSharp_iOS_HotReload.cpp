@@ -10,14 +10,16 @@
 #include "HAL/FileManager.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
+#include "UnrealSharpProcHelper/CSProcHelper.h"
+#include <dlfcn.h>
 
 /**
  * iOS Hot Reload Implementation for UnrealSharp
  * 
  * Strategy:
  * 1. Use Mono's AOT+Interpreter hybrid mode (MONO_AOT_MODE_INTERP)
- * 2. Core assemblies are AOT-compiled and included in the app bundle
- * 3. Game logic assemblies can be interpreted for hot reload
+ * 2. Core assemblies and glue are AOT-compiled and included in the app bundle
+ * 3. Game logic assemblies are interpreted for hot reload, see GetAssemblyExecutionMode
  * 4. Assembly replacement through bytecode/IL replacement
  * 5. Use Assembly.Load with byte arrays for dynamic loading
  */
@@ -26,6 +28,69 @@ namespace UnrealSharp::iOS::HotReload
 {
     static TMap<FString, MonoAssembly*> LoadedAssemblies;
     static TMap<FString, TArray<uint8>> AssemblyBytecodeCache;
+    static bool bMixedExecutionModeConfigured = false;
+    
+    /**
+     * Register the AOT module of an assembly that was precompiled into the app bundle
+     * The AOT compiler names the module symbol after the assembly, with every character that isn't valid in a symbol replaced by '_'
+     */
+    static bool RegisterAOTModule(const FString& AssemblyName)
+    {
+        FString SymbolName = TEXT("mono_aot_module_");
+        for (TCHAR Char : AssemblyName)
+        {
+            SymbolName.AppendChar(FChar::IsAlnum(Char) ? Char : TEXT('_'));
+        }
+        SymbolName += TEXT("_info");
+        
+        void** ModuleInfo = static_cast<void**>(dlsym(RTLD_DEFAULT, TCHAR_TO_ANSI(*SymbolName)));
+        if (!ModuleInfo)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("UnrealSharp: No AOT module for '%s', it will be interpreted"), *AssemblyName);
+            return false;
+        }
+        
+        mono_aot_register_module(ModuleInfo);
+        return true;
+    }
+    
+    void ConfigureMixedExecutionMode()
+    {
+        if (bMixedExecutionModeConfigured)
+        {
+            return;
+        }
+        
+        bMixedExecutionModeConfigured = true;
+        
+        // AOT code is used for every method that has it, the interpreter only runs what is left
+        mono_jit_set_aot_mode(MONO_AOT_MODE_INTERP);
+        
+        TArray<FString> AOTAssemblies = { TEXT("System.Private.CoreLib"), TEXT("UnrealSharp"), TEXT("UnrealSharp.Core"), TEXT("UnrealSharp.Binds") };
+        
+        TArray<FString> ProjectNames;
+        FCSProcHelper::GetProjectNamesByLoadOrder(ProjectNames, true);
+        for (const FString& ProjectName : ProjectNames)
+        {
+            if (GetAssemblyExecutionMode(ProjectName) == EAssemblyExecutionMode::FullAOT)
+            {
+                AOTAssemblies.AddUnique(ProjectName);
+            }
+        }
+        
+        int32 NumRegistered = 0;
+        for (const FString& AssemblyName : AOTAssemblies)
+        {
+            NumRegistered += RegisterAOTModule(AssemblyName) ? 1 : 0;
+        }
+        
+        UE_LOG(LogTemp, Log, TEXT("UnrealSharp: Mixed execution mode, %d of %d engine assemblies run AOT code"), NumRegistered, AOTAssemblies.Num());
+    }
+    
+    EAssemblyExecutionMode GetAssemblyExecutionMode(const FString& AssemblyName)
+    {
+        return CanAssemblyBeHotReloaded(AssemblyName) ? EAssemblyExecutionMode::Interpreter : EAssemblyExecutionMode::FullAOT;
+    }
     
     /**
      * Initialize iOS Hot Reload system
@@ -35,15 +100,8 @@ namespace UnrealSharp::iOS::HotReload
     {
         UE_LOG(LogTemp, Log, TEXT("UnrealSharp: Initializing iOS Hot Reload system"));
         
-        // Set hybrid AOT+Interpreter mode for iOS
-        mono_jit_set_aot_mode(MONO_AOT_MODE_INTERP);
-        
-        // Register core AOT modules that are pre-compiled
-        // These cannot be hot-reloaded but provide base functionality
-        #ifdef MONO_AOT_MODULE_SYSTEM_PRIVATE_CORELIB
-        extern void* mono_aot_module_System_Private_CoreLib_info;
-        mono_aot_register_module(static_cast<void**>(mono_aot_module_System_Private_CoreLib_info));
-        #endif
+        // Set hybrid AOT+Interpreter mode for iOS, only hot reloadable assemblies are interpreted
+        ConfigureMixedExecutionMode();
         
         // Configure native library mappings for iOS
         mono_dllmap_insert(nullptr, "System.Native", nullptr, "__Internal", nullptr);
@@ -194,21 +252,27 @@ namespace UnrealSharp::iOS::HotReload
      */
     bool CanAssemblyBeHotReloaded(const FString& AssemblyName)
     {
-        // Core system assemblies that are AOT-compiled cannot be hot reloaded
-        static const TArray<FString> NonHotReloadableAssemblies = {
-            TEXT("System.Private.CoreLib"),
-            TEXT("System.Runtime"),
-            TEXT("System.Collections"),
-            TEXT("UnrealSharp.Core"), // Our core runtime bindings
-            TEXT("UnrealSharp.Binds")  // Engine bindings
+        // Framework assemblies, our runtime and engine bindings are AOT-compiled and cannot be hot reloaded
+        static const TSet<FString> NonHotReloadableAssemblies = {
+            TEXT("mscorlib"),
+            TEXT("netstandard"),
+            TEXT("UnrealSharp"),
+            TEXT("UnrealSharp.Core"),  // Our core runtime bindings
+            TEXT("UnrealSharp.Binds"), // Engine bindings
+            TEXT("UnrealSharp.Log"),
+            TEXT("UnrealSharp.Plugins"),
+            TEXT("UnrealSharp.StaticVars")
         };
         
-        for (const FString& NonReloadable : NonHotReloadableAssemblies)
+        if (NonHotReloadableAssemblies.Contains(AssemblyName))
         {
-            if (AssemblyName.Contains(NonReloadable))
-            {
-                return false;
-            }
+            return false;
+        }
+        
+        // Glue is generated from the engine, it only changes with a native rebuild
+        if (AssemblyName.StartsWith(TEXT("System.")) || AssemblyName.StartsWith(TEXT("Microsoft.")) || AssemblyName.EndsWith(TEXT("Glue")))
+        {
+            return false;
         }
         
         return true;
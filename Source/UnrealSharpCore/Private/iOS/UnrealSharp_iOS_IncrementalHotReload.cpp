@@ -10,6 +10,7 @@
 #include "mono/metadata/debug-helpers.h"
 #include "mono/metadata/tokentype.h"
 #include "HAL/FileManager.h"
+#include "iOS/UnrealSharp_iOS_HotReload.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
 #include "Async/TaskGraphInterfaces.h"
@@ -28,13 +29,31 @@
 
 namespace UnrealSharp::iOS::IncrementalHotReload
 {
+    // A replaced baseline method, and the body it had before its first replacement
+    struct FReplacedMethod
+    {
+        MonoMethod* Method;
+        void* OriginalBody;
+    };
+
+    // Methods of a baseline assembly image, built once and kept across hot reloads
+    struct FMethodIndex
+    {
+        MonoImage* Image = nullptr;
+        
+        // Full name with signature -> method definition token, so overloads and methods of different classes don't collide
+        TMap<FString, uint32> TokensBySignature;
+        
+        // Method definition token -> replacement
+        TMap<uint32, FReplacedMethod> Replacements;
+    };
+
     // iOS incremental hot reload state
     struct FiOSIncrementalHotReloadState
     {
         TMap<FString, MonoAssembly*> BaselineAssemblies;
         TMap<FString, MonoAssembly*> HotReloadAssemblies;
-        TMap<FString, TArray<MonoMethod*>> ReplacedMethods;
-        TMap<FString, TArray<void*>> OriginalMethodBodies;
+        TMap<FString, FMethodIndex> MethodIndices;
         TMap<FString, FDateTime> AssemblyTimestamps;
         MonoDomain* IncrementalDomain;
         bool bIsInitialized;
@@ -75,8 +94,8 @@ namespace UnrealSharp::iOS::IncrementalHotReload
             return false;
         }
 
-        // Configure interpreter for method replacement
-        mono_jit_set_aot_mode(MONO_AOT_MODE_INTERP);
+        // Interpret hot reloadable assemblies for method replacement, the rest keeps running AOT code
+        UnrealSharp::iOS::HotReload::ConfigureMixedExecutionMode();
         
         // Enable advanced debugging for method tracking
         mono_debug_init(MONO_DEBUG_FORMAT_MONO);
@@ -88,52 +107,75 @@ namespace UnrealSharp::iOS::IncrementalHotReload
     }
 
     /**
-     * Advanced method replacement using iOS-compatible technique
+     * Get a method's full name including its class and parameter types
+     */
+    FString GetMethodSignature(MonoMethod* Method)
+    {
+        char* FullName = mono_method_full_name(Method, true);
+        FString Signature(FullName);
+        mono_free(FullName);
+        return Signature;
+    }
+
+    /**
+     * Get the method index of a baseline assembly, building it on first use
      */
-    bool ReplaceMethodBodyiOS(MonoMethod* OriginalMethod, MonoMethod* NewMethod)
+    FMethodIndex& GetMethodIndex(const FString& AssemblyName, MonoImage* BaseImage)
     {
-        if (!OriginalMethod || !NewMethod)
+        FMethodIndex& Index = iOSIncrementalState.MethodIndices.FindOrAdd(AssemblyName);
+        if (Index.Image == BaseImage)
         {
-            return false;
+            return Index;
         }
 
-        try
+        // A new baseline image invalidates the tokens of the old one
+        Index = FMethodIndex();
+        Index.Image = BaseImage;
+
+        int32 MethodCount = mono_image_get_table_rows(BaseImage, MONO_TABLE_METHOD);
+        Index.TokensBySignature.Reserve(MethodCount);
+        
+        for (int32 MethodIndex = 1; MethodIndex <= MethodCount; ++MethodIndex)
         {
-            // Get method information
-            const char* MethodName = mono_method_get_name(OriginalMethod);
-            FString MethodNameStr = FString(MethodName);
-            
-            // Store original method body for rollback
-            void* OriginalBody = mono_method_get_unmanaged_thunk(OriginalMethod);
-            if (!iOSIncrementalState.OriginalMethodBodies.Contains(MethodNameStr))
+            uint32 Token = MONO_TOKEN_METHOD_DEF | MethodIndex;
+            if (MonoMethod* Method = mono_get_method(BaseImage, Token, nullptr))
             {
-                iOSIncrementalState.OriginalMethodBodies.Add(MethodNameStr, TArray<void*>());
+                Index.TokensBySignature.Add(GetMethodSignature(Method), Token);
             }
-            iOSIncrementalState.OriginalMethodBodies[MethodNameStr].Add(OriginalBody);
+        }
 
-            // Use interpreter injection for iOS compatibility
-            void* NewBody = mono_method_get_unmanaged_thunk(NewMethod);
-            
-            // Replace method implementation
-            mono_method_set_unmanaged_thunk(OriginalMethod, NewBody);
+        UE_LOG(LogTemp, Log, TEXT("UnrealSharp iOS: Built method index for '%s' (%d methods)"), *AssemblyName, Index.TokensBySignature.Num());
+        return Index;
+    }
 
-            // Track replaced method
-            if (!iOSIncrementalState.ReplacedMethods.Contains(MethodNameStr))
+    /**
+     * Replace the bodies of all changed methods of an assembly in one pass, using iOS-compatible interpreter injection
+     */
+    int32 ReplaceMethodBodiesiOS(FMethodIndex& Index, const TArray<TPair<uint32, MonoMethod*>>& ChangedMethods)
+    {
+        Index.Replacements.Reserve(Index.Replacements.Num() + ChangedMethods.Num());
+        
+        int32 ReplacedCount = 0;
+        for (const TPair<uint32, MonoMethod*>& Change : ChangedMethods)
+        {
+            MonoMethod* OriginalMethod = mono_get_method(Index.Image, Change.Key, nullptr);
+            if (!OriginalMethod)
             {
-                iOSIncrementalState.ReplacedMethods.Add(MethodNameStr, TArray<MonoMethod*>());
+                continue;
             }
-            iOSIncrementalState.ReplacedMethods[MethodNameStr].Add(OriginalMethod);
 
-            iOSIncrementalState.TotalMethodsReplaced++;
-            
-            UE_LOG(LogTemp, Log, TEXT("UnrealSharp iOS: Successfully replaced method '%s'"), *MethodNameStr);
-            return true;
-        }
-        catch (...)
-        {
-            UE_LOG(LogTemp, Error, TEXT("UnrealSharp iOS: Exception during incremental method replacement"));
-            return false;
+            // Only the body from before the first replacement is kept, so a rollback restores the baseline
+            if (!Index.Replacements.Contains(Change.Key))
+            {
+                Index.Replacements.Add(Change.Key, FReplacedMethod{ OriginalMethod, mono_method_get_unmanaged_thunk(OriginalMethod) });
+            }
+
+            mono_method_set_unmanaged_thunk(OriginalMethod, mono_method_get_unmanaged_thunk(Change.Value));
+            ReplacedCount++;
         }
+
+        iOSIncrementalState.TotalMethodsReplaced += ReplacedCount;
+        return ReplacedCount;
     }
 
     /**
@@ -184,7 +226,7 @@ namespace UnrealSharp::iOS::IncrementalHotReload
     /**
      * Compare assemblies and perform incremental method updates
      */
-    bool PerformIncrementalUpdate(MonoAssembly* BaseAssembly, MonoAssembly* NewAssembly)
+    bool PerformIncrementalUpdate(const FString& AssemblyName, MonoAssembly* BaseAssembly, MonoAssembly* NewAssembly)
     {
         if (!BaseAssembly || !NewAssembly)
         {
@@ -199,60 +241,47 @@ namespace UnrealSharp::iOS::IncrementalHotReload
             return false;
         }
 
-        int32 UpdatedMethods = 0;
+        FMethodIndex& Index = GetMethodIndex(AssemblyName, BaseImage);
+        
+        // Collect every changed method first, then replace them all in one pass
+        TArray<TPair<uint32, MonoMethod*>> ChangedMethods;
         
-        // Iterate through types in the new assembly
-        int32 TypeCount = mono_image_get_table_rows(NewImage, MONO_TABLE_TYPEDEF);
+        int32 MethodCount = mono_image_get_table_rows(NewImage, MONO_TABLE_METHOD);
         
-        for (int32 TypeIndex = 1; TypeIndex <= TypeCount; ++TypeIndex)
+        for (int32 MethodIndex = 1; MethodIndex <= MethodCount; ++MethodIndex)
         {
-            MonoClass* NewClass = mono_class_get(NewImage, MONO_TOKEN_TYPE_DEF | TypeIndex);
-            if (!NewClass) continue;
+            MonoMethod* NewMethod = mono_get_method(NewImage, MONO_TOKEN_METHOD_DEF | MethodIndex, nullptr);
+            if (!NewMethod) continue;
 
-            const char* ClassName = mono_class_get_name(NewClass);
-            const char* Namespace = mono_class_get_namespace(NewClass);
+            // Find corresponding method in base assembly
+            const uint32* BaseToken = Index.TokensBySignature.Find(GetMethodSignature(NewMethod));
+            if (!BaseToken) continue;
 
-            // Find corresponding class in base assembly
-            MonoClass* BaseClass = mono_class_from_name(BaseImage, Namespace, ClassName);
-            if (!BaseClass) continue;
+            MonoMethod* BaseMethod = mono_get_method(BaseImage, *BaseToken, nullptr);
+            if (!BaseMethod) continue;
 
-            // Compare and update methods
-            void* MethodIter = nullptr;
-            MonoMethod* NewMethod;
+            // Check if method has changed (simplified check)
+            MonoMethodHeader* BaseHeader = mono_method_get_header(BaseMethod);
+            MonoMethodHeader* NewHeader = mono_method_get_header(NewMethod);
+            
+            if (!BaseHeader || !NewHeader) continue;
+
+            // Compare method IL code size as a simple change detection
+            uint32 BaseCodeSize = mono_method_header_get_code_size(BaseHeader);
+            uint32 NewCodeSize = mono_method_header_get_code_size(NewHeader);
+
+            mono_method_header_free(BaseHeader);
+            mono_method_header_free(NewHeader);
 
-            while ((NewMethod = mono_class_get_methods(NewClass, &MethodIter)))
+            // If sizes differ, assume method changed
+            if (BaseCodeSize != NewCodeSize)
             {
-                const char* MethodName = mono_method_get_name(NewMethod);
-                MonoMethodSignature* NewSignature = mono_method_signature(NewMethod);
-                
-                // Find corresponding method in base class
-                MonoMethod* BaseMethod = mono_class_get_method_from_name(BaseClass, MethodName, mono_signature_get_param_count(NewSignature));
-                if (!BaseMethod) continue;
-
-                // Check if method has changed (simplified check)
-                MonoMethodHeader* BaseHeader = mono_method_get_header(BaseMethod);
-                MonoMethodHeader* NewHeader = mono_method_get_header(NewMethod);
-                
-                if (!BaseHeader || !NewHeader) continue;
-
-                // Compare method IL code size as a simple change detection
-                uint32 BaseCodeSize = mono_method_header_get_code_size(BaseHeader);
-                uint32 NewCodeSize = mono_method_header_get_code_size(NewHeader);
-
-                mono_method_header_free(BaseHeader);
-                mono_method_header_free(NewHeader);
-
-                // If sizes differ, assume method changed
-                if (BaseCodeSize != NewCodeSize)
-                {
-                    if (ReplaceMethodBodyiOS(BaseMethod, NewMethod))
-                    {
-                        UpdatedMethods++;
-                    }
-                }
+                ChangedMethods.Emplace(*BaseToken, NewMethod);
             }
         }
 
+        int32 UpdatedMethods = ReplaceMethodBodiesiOS(Index, ChangedMethods);
+
         UE_LOG(LogTemp, Log, TEXT("UnrealSharp iOS: Incremental update completed, %d methods updated"), UpdatedMethods);
         return UpdatedMethods > 0;
     }
@@ -290,7 +319,7 @@ namespace UnrealSharp::iOS::IncrementalHotReload
         }
 
         // Perform incremental update
-        bool bSuccess = PerformIncrementalUpdate(BaseAssembly, NewAssembly);
+        bool bSuccess = PerformIncrementalUpdate(AssemblyName, BaseAssembly, NewAssembly);
 
         if (bSuccess)
         {
@@ -325,28 +354,22 @@ namespace UnrealSharp::iOS::IncrementalHotReload
      */
     bool RollbackIncrementalChanges(const FString& AssemblyName)
     {
-        TArray<MonoMethod*>* ReplacedMethodsPtr = iOSIncrementalState.ReplacedMethods.Find(AssemblyName);
-        TArray<void*>* OriginalBodiesPtr = iOSIncrementalState.OriginalMethodBodies.Find(AssemblyName);
+        FMethodIndex* Index = iOSIncrementalState.MethodIndices.Find(AssemblyName);
 
-        if (!ReplacedMethodsPtr || !OriginalBodiesPtr || 
-            ReplacedMethodsPtr->Num() != OriginalBodiesPtr->Num())
+        if (!Index || Index->Replacements.IsEmpty())
         {
             UE_LOG(LogTemp, Error, TEXT("UnrealSharp iOS: Cannot rollback incremental changes for '%s'"), *AssemblyName);
             return false;
         }
 
         // Restore original method bodies
-        for (int32 i = 0; i < ReplacedMethodsPtr->Num(); i++)
+        for (const TPair<uint32, FReplacedMethod>& Replacement : Index->Replacements)
         {
-            MonoMethod* Method = (*ReplacedMethodsPtr)[i];
-            void* OriginalBody = (*OriginalBodiesPtr)[i];
-            
-            mono_method_set_unmanaged_thunk(Method, OriginalBody);
+            mono_method_set_unmanaged_thunk(Replacement.Value.Method, Replacement.Value.OriginalBody);
         }
 
-        // Clean up tracking data
-        iOSIncrementalState.ReplacedMethods.Remove(AssemblyName);
-        iOSIncrementalState.OriginalMethodBodies.Remove(AssemblyName);
+        // Clean up tracking data, the index itself stays valid for the baseline
+        Index->Replacements.Empty();
         iOSIncrementalState.HotReloadAssemblies.Remove(AssemblyName);
 
         UE_LOG(LogTemp, Log, TEXT("UnrealSharp iOS: Rolled back incremental changes for '%s'"), *AssemblyName);
@@ -373,6 +396,7 @@ namespace UnrealSharp::iOS::IncrementalHotReload
         FString AssemblyName = FString(AssemblyNameCStr);
 
         iOSIncrementalState.BaselineAssemblies.Add(AssemblyName, Assembly);
+        GetMethodIndex(AssemblyName, Image);
         
         UE_LOG(LogTemp, Log, TEXT("UnrealSharp iOS: Registered baseline assembly '%s'"), *AssemblyName);
         return true;
@@ -416,8 +440,7 @@ namespace UnrealSharp::iOS::IncrementalHotReload
         // Clear tracking data
         iOSIncrementalState.BaselineAssemblies.Empty();
         iOSIncrementalState.HotReloadAssemblies.Empty();
-        iOSIncrementalState.ReplacedMethods.Empty();
-        iOSIncrementalState.OriginalMethodBodies.Empty();
+        iOSIncrementalState.MethodIndices.Empty();
         iOSIncrementalState.AssemblyTimestamps.Empty();
 
         iOSIncrementalState.bIsInitialized = false;
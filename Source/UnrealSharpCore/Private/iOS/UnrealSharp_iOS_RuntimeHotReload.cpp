@@ -13,6 +13,7 @@
 #include "mono/metadata/debug-helpers.h"
 #include "mono/utils/mono-compiler.h"
 #include "HAL/FileManager.h"
+#include "iOS/UnrealSharp_iOS_HotReload.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
 #include "Engine/Engine.h"
@@ -61,8 +62,8 @@ namespace UnrealSharp::iOS::RuntimeHotReload
     {
         UE_LOG(LogTemp, Log, TEXT("UnrealSharp: Initializing iOS Runtime Hot Reload (No Restart Required)"));
         
-        // Enable Mono interpreter for new code execution
-        mono_jit_set_aot_mode(MONO_AOT_MODE_INTERP);
+        // Interpret new code of hot reloadable assemblies, the rest keeps running AOT code
+        UnrealSharp::iOS::HotReload::ConfigureMixedExecutionMode();
         
         // Create separate domain for interpreter-based hot reload
         InterpreterDomain = mono_domain_create_appdomain("UnrealSharpHotReload", NULL);
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_MONO_RUNTIME && PLATFORM_ANDROID
+
+/**
+ * UnrealSharp Android JIT Warm-Up
+ *
+ * Avoids JIT hitches in the first minutes of play on Android:
+ * - Records every managed method the JIT compiles during the first seconds after the user assemblies are loaded
+ * - Persists the list as a warm-up profile in the saved directory
+ * - On the next launch, compiles the methods of the profile on a background thread before gameplay needs them
+ *
+ * Methods are identified by assembly name, module version id and metadata token, so entries of a rebuilt assembly are
+ * skipped and the profile is recorded again.
+ */
+
+namespace UnrealSharp::Android::JITWarmUp
+{
+    struct FJITWarmUpEntry
+    {
+        FString AssemblyName;
+        FString ModuleVersionId;
+        uint32 MethodToken = 0;
+
+        bool operator==(const FJITWarmUpEntry& Other) const
+        {
+            return MethodToken == Other.MethodToken && AssemblyName == Other.AssemblyName && ModuleVersionId == Other.ModuleVersionId;
+        }
+
+        friend uint32 GetTypeHash(const FJITWarmUpEntry& Entry)
+        {
+            return HashCombine(GetTypeHash(Entry.AssemblyName), ::GetTypeHash(Entry.MethodToken));
+        }
+    };
+
+    /**
+     * Called once the user assemblies are loaded. Starts warming up from the profile of the last launch,
+     * and records a new profile when there is none or it is out of date.
+     */
+    UNREALSHARPCORE_API void OnUserAssembliesLoaded();
+
+    /**
+     * Record methods as they are compiled by the JIT, and save the profile after DurationSeconds
+     */
+    UNREALSHARPCORE_API void StartRecording(double DurationSeconds);
+
+    /**
+     * Stop recording and save what has been recorded so far
+     */
+    UNREALSHARPCORE_API void StopRecording();
+
+    UNREALSHARPCORE_API bool IsRecording();
+
+    /**
+     * Compile the methods of a profile on a background thread
+     * @return false if none of the entries belong to a loaded assembly
+     */
+    UNREALSHARPCORE_API bool StartWarmUp(const TArray<FJITWarmUpEntry>& Entries);
+
+    /**
+     * Wait for the background warm-up, for example behind a loading screen
+     * @return true if the warm-up finished in time, or wasn't running
+     */
+    UNREALSHARPCORE_API bool WaitForWarmUp(double TimeoutSeconds);
+
+    UNREALSHARPCORE_API FString GetProfilePath();
+    UNREALSHARPCORE_API bool SaveProfile(const FString& Path, const TArray<FJITWarmUpEntry>& Entries);
+    UNREALSHARPCORE_API bool LoadProfile(const FString& Path, TArray<FJITWarmUpEntry>& OutEntries);
+}
+
+#endif // WITH_MONO_RUNTIME && PLATFORM_ANDROID
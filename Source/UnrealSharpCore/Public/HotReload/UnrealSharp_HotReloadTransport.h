@@ -0,0 +1,75 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FSocket;
+
+/**
+ * UnrealSharp Hot Reload Transport
+ *
+ * Sends hot reloaded assemblies from the editor to a device over one persistent TCP connection:
+ * - The device reports the content hash of the version it is running
+ * - The editor sends a binary delta against that version when it still has it, and the whole assembly otherwise
+ * - Both are compressed, and the device verifies the content hash of the result before reloading it
+ * - Nothing is accepted before the editor signed a challenge of the device with the shared secret of the project
+ */
+
+namespace UnrealSharp::HotReload::Transport
+{
+    // Port the device listens on when no other port is given
+    constexpr int32 DefaultTransportPort = 41873;
+
+    // The server refuses to start with a shorter shared secret
+    constexpr int32 MinSharedSecretLength = 16;
+
+    /**
+     * Binary deltas
+     */
+
+    // Content hash used to match the versions on both ends, same as the assembly caches
+    UNREALSHARPCORE_API FString CalculateContentHash(const TArray<uint8>& AssemblyData);
+
+    // Create a delta that turns BaseData into NewData. Unchanged blocks are copied from the base, the rest is sent as it is.
+    UNREALSHARPCORE_API void CreateAssemblyDelta(const TArray<uint8>& BaseData, const TArray<uint8>& NewData, TArray<uint8>& OutDelta);
+
+    // Apply a delta created by CreateAssemblyDelta to the same base
+    UNREALSHARPCORE_API bool ApplyAssemblyDelta(const TArray<uint8>& BaseData, const TArray<uint8>& Delta, TArray<uint8>& OutNewData);
+
+    /**
+     * Device side
+     */
+
+    // Start listening for the editor. Received assemblies are hot reloaded on the game thread.
+    // Only editors that prove they know SharedSecret are served. Listens on loopback unless asked otherwise, reach it through a forwarded port.
+    UNREALSHARPCORE_API bool StartTransportServer(const FString& SharedSecret, int32 Port = DefaultTransportPort, bool bListenOnAllInterfaces = false);
+
+    UNREALSHARPCORE_API void StopTransportServer();
+
+    UNREALSHARPCORE_API bool IsTransportServerRunning();
+
+    /**
+     * Editor side
+     */
+    class UNREALSHARPCORE_API FHotReloadTransportClient
+    {
+    public:
+        FHotReloadTransportClient() = default;
+        ~FHotReloadTransportClient();
+
+        UE_NONCOPYABLE(FHotReloadTransportClient);
+
+        // Connects and answers the challenge of the device with SharedSecret
+        bool Connect(const FString& DeviceAddress, const FString& SharedSecret, int32 Port = DefaultTransportPort);
+        void Disconnect();
+        bool IsConnected() const { return Socket != nullptr; }
+
+        // Send an assembly to the device and wait until it has been reloaded
+        bool SendAssembly(const FString& AssemblyName, const TArray<uint8>& AssemblyData);
+
+    private:
+        FSocket* Socket = nullptr;
+
+        // Last version sent of each assembly, the base of the next delta
+        TMap<FString, TArray<uint8>> SentAssemblies;
+    };
+}
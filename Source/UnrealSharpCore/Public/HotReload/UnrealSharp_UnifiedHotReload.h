@@ -18,6 +18,11 @@
  * should be used directly.
  */
 
+// Strategies this target can use, the others are stripped from the build
+#define UNREALSHARP_HOTRELOAD_WITH_METHOD_REPLACEMENT (WITH_MONO_RUNTIME && (PLATFORM_IOS || PLATFORM_ANDROID))
+#define UNREALSHARP_HOTRELOAD_WITH_APPDOMAIN (WITH_MONO_RUNTIME)
+#define UNREALSHARP_HOTRELOAD_WITH_DOTNET (!UNREALSHARP_HOTRELOAD_WITH_METHOD_REPLACEMENT)
+
 DECLARE_MULTICAST_DELEGATE_TwoParams(FOnUnifiedHotReloadCompleted, const FString& /*AssemblyName*/, bool /*bSuccess*/);
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnHotReloadStrategyChanged, const FString& /*NewStrategy*/);
 
@@ -91,7 +96,7 @@ namespace UnrealSharp::HotReload
     UNREALSHARPCORE_API bool IsHotReloadSupported();
 
     // Get human-readable name of current strategy
-    UNREALSHARPCORE_API FString GetCurrentStrategyName();
+    UNREALSHARPCORE_API const TCHAR* GetCurrentStrategyName();
 
     // Events
     UNREALSHARPCORE_API FOnUnifiedHotReloadCompleted& OnHotReloadCompleted();
@@ -100,14 +105,21 @@ namespace UnrealSharp::HotReload
     /**
      * Strategy-specific implementations (internal)
      */
+#if UNREALSHARP_HOTRELOAD_WITH_DOTNET
     bool InitializeDotNetHotReload();
-    bool InitializeMonoAppDomainHotReload();
-    bool InitializeMonoMethodReplacementHotReload();
     bool InitializeFileWatchingHotReload();
-
     bool HotReloadAssemblyDotNet(const FString& AssemblyName, const TArray<uint8>& AssemblyData);
+#endif
+
+#if UNREALSHARP_HOTRELOAD_WITH_APPDOMAIN
+    bool InitializeMonoAppDomainHotReload();
     bool HotReloadAssemblyMonoAppDomain(const FString& AssemblyName, const TArray<uint8>& AssemblyData);
+#endif
+
+#if UNREALSHARP_HOTRELOAD_WITH_METHOD_REPLACEMENT
+    bool InitializeMonoMethodReplacementHotReload();
     bool HotReloadAssemblyMonoMethodReplacement(const FString& AssemblyName, const TArray<uint8>& AssemblyData);
+#endif
 
     const TCHAR* GetStrategyName(EHotReloadStrategy Strategy);
 
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include <type_traits>
+
+/**
+ * UnrealSharp Diagnostics fast path
+ *
+ * Cheap enough for hot paths:
+ * - Events are registered once per call site, with a code, a severity and a format string literal
+ * - Recording one copies the event id and up to four numeric arguments into a lock-free buffer of the calling thread
+ * - A background writer thread formats the records and appends them to the diagnostics log in batches
+ *
+ * Format strings use {0} to {3} for the arguments, for example:
+ * UNREALSHARP_DIAGNOSTIC("US_RUNTIME_010", 2, "Rebound {0} function bodies in {1} ms", NumFunctions, Milliseconds);
+ */
+
+namespace UnrealSharp::Diagnostics
+{
+    using FDiagnosticEventId = uint16;
+
+    constexpr int32 MaxDiagnosticArgs = 4;
+
+    struct FDiagnosticArg
+    {
+        enum class EType : uint8
+        {
+            Int,
+            UInt,
+            Double,
+        };
+
+        EType Type = EType::Int;
+        union
+        {
+            int64 Int;
+            uint64 UInt;
+            double Double;
+        };
+
+        FDiagnosticArg() : Int(0) {}
+
+        template<typename T>
+        FDiagnosticArg(T Value)
+        {
+            if constexpr (std::is_floating_point_v<T>)
+            {
+                Type = EType::Double;
+                Double = Value;
+            }
+            else if constexpr (std::is_pointer_v<T>)
+            {
+                Type = EType::UInt;
+                UInt = reinterpret_cast<UPTRINT>(Value);
+            }
+            else if constexpr (std::is_enum_v<T>)
+            {
+                Type = EType::Int;
+                Int = static_cast<int64>(Value);
+            }
+            else if constexpr (std::is_signed_v<T>)
+            {
+                Type = EType::Int;
+                Int = Value;
+            }
+            else
+            {
+                static_assert(std::is_integral_v<T>, "Diagnostic arguments must be numbers, enums or pointers");
+                Type = EType::UInt;
+                UInt = Value;
+            }
+        }
+    };
+
+    /**
+     * Register an event, once per call site. Code and Format must outlive the process, string literals do.
+     */
+    UNREALSHARPCORE_API FDiagnosticEventId RegisterDiagnosticEvent(const TCHAR* Code, const TCHAR* Format, int32 Severity);
+
+    /**
+     * Queue a record of a registered event for the writer thread. Never blocks, records are dropped and counted
+     * when the buffer of the calling thread is full.
+     */
+    UNREALSHARPCORE_API void EnqueueDiagnosticRecord(FDiagnosticEventId EventId, const FDiagnosticArg* Args, int32 NumArgs);
+
+    template<typename... ArgTypes>
+    void RecordDiagnosticEvent(FDiagnosticEventId EventId, ArgTypes... Args)
+    {
+        static_assert(sizeof...(ArgTypes) <= MaxDiagnosticArgs, "Diagnostic events take at most four arguments");
+
+        const FDiagnosticArg PackedArgs[sizeof...(ArgTypes) + 1] = { FDiagnosticArg(Args)... };
+        EnqueueDiagnosticRecord(EventId, PackedArgs, sizeof...(ArgTypes));
+    }
+
+    /**
+     * Block until the writer thread has written everything queued so far
+     */
+    UNREALSHARPCORE_API void FlushDiagnostics();
+}
+
+#define UNREALSHARP_DIAGNOSTIC(Code, Severity, Format, ...) \
+    do \
+    { \
+        static const ::UnrealSharp::Diagnostics::FDiagnosticEventId PREPROCESSOR_JOIN(DiagnosticEventId, __LINE__) = \
+            ::UnrealSharp::Diagnostics::RegisterDiagnosticEvent(TEXT(Code), TEXT(Format), Severity); \
+        ::UnrealSharp::Diagnostics::RecordDiagnosticEvent(PREPROCESSOR_JOIN(DiagnosticEventId, __LINE__), ##__VA_ARGS__); \
+    } while (0)
@@ -24,6 +24,27 @@
 
 namespace UnrealSharp::iOS::HotReload
 {
+    /**
+     * How the code of an assembly is executed on iOS
+     */
+    enum class EAssemblyExecutionMode : uint8
+    {
+        FullAOT,     // Precompiled into the app bundle, runs at native speed, can't be hot reloaded
+        Interpreter, // Interpreted, can be hot reloaded
+    };
+
+    /**
+     * Put the runtime in mixed mode, once for the whole process: assemblies with AOT code run it, the rest is interpreted.
+     * Registers the AOT modules of every assembly whose execution mode is FullAOT.
+     * Must be called before the Mono JIT is initialized.
+     */
+    UNREALSHARPCORE_API void ConfigureMixedExecutionMode();
+
+    /**
+     * Get the execution mode of an assembly, driven by CanAssemblyBeHotReloaded
+     */
+    UNREALSHARPCORE_API EAssemblyExecutionMode GetAssemblyExecutionMode(const FString& AssemblyName);
+
     /**
      * Initialize the iOS Hot Reload system
      * Must be called during Mono domain initialization
@@ -1,9 +1,23 @@
 ﻿#include "CSAtomicHotReloadState.h"
 #include "Engine/Engine.h"
+#include "Dom/JsonObject.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
 
 // 全局实例
 static FCSAtomicHotReloadState GlobalAtomicHotReloadState;
 
+static FAutoConsoleCommandWithOutputDevice PrintHotReloadTimingsCommand(
+    TEXT("UnrealSharp.HotReloadTimings"),
+    TEXT("Prints the phase timings of the last hot reload."),
+    FConsoleCommandWithOutputDeviceDelegate::CreateLambda([](FOutputDevice& Ar)
+    {
+        const FCSAtomicHotReloadState::FHotReloadTimingBreakdown Breakdown = GetGlobalAtomicHotReloadState().GetLastTimingBreakdown();
+        Ar.Log(Breakdown.IsValid() ? FCSAtomicHotReloadState::FormatTimingBreakdown(Breakdown) : TEXT("No hot reload yet"));
+    }));
+
 FCSAtomicHotReloadState& GetGlobalAtomicHotReloadState()
 {
     return GlobalAtomicHotReloadState;
@@ -186,7 +200,7 @@ bool FCSAtomicHotReloadState::AtomicCancelHotReload(uint64 HotReloadId)
     CurrentState.store(EHotReloadState::Cancelled, std::memory_order_release);
     
     // 更新统计
-    Stats.CancelledHotReloads.fetch_add(1, std::memory_order_relaxed);
+    Stats.RecordCancelledHotReload();
     
     // 减少活跃计数
     if (ActiveHotReloads.load(std::memory_order_relaxed) > 0)
@@ -313,6 +327,12 @@ FString FCSAtomicHotReloadState::ExportDiagnosticsReport() const
     Report += FString::Printf(TEXT("  Average Time: %.2f ms\n"), Stats.AverageHotReloadTime.load());
     Report += FString::Printf(TEXT("  Max Time: %.2f ms\n"), Stats.MaxHotReloadTime.load());
     
+    for (int32 PhaseIndex = 0; PhaseIndex < (int32)EHotReloadPhase::Num; ++PhaseIndex)
+    {
+        Report += FString::Printf(TEXT("  %s: %.2f ms average, %.2f ms max\n"), *GetPhaseDescription((EHotReloadPhase)PhaseIndex),
+            Stats.AveragePhaseTime[PhaseIndex].load(), Stats.MaxPhaseTime[PhaseIndex].load());
+    }
+    
     {
         FScopeLock Lock(&AssemblyMutex);
         Report += FString::Printf(TEXT("  Registered Assemblies: %d\n"), RegisteredAssemblies.Num());
@@ -327,6 +347,142 @@ FString FCSAtomicHotReloadState::ExportDiagnosticsReport() const
     return Report;
 }
 
+void FCSAtomicHotReloadState::BeginTimingBreakdown()
+{
+    std::lock_guard<std::mutex> Lock(TimingsMutex);
+    
+    CurrentTimings = FHotReloadTimingBreakdown{};
+    CurrentTimings.Timestamp = FDateTime::Now();
+    bRecordingTimings.store(true, std::memory_order_release);
+}
+
+void FCSAtomicHotReloadState::RecordPhaseTime(EHotReloadPhase Phase, double TimeMs, FName AssemblyName)
+{
+    if (!IsRecordingTimings() || Phase >= EHotReloadPhase::Num)
+    {
+        return;
+    }
+    
+    std::lock_guard<std::mutex> Lock(TimingsMutex);
+    
+    CurrentTimings.PhaseTimeMs[(int32)Phase] += TimeMs;
+    CurrentTimings.Timings.Add({ Phase, AssemblyName, TimeMs });
+}
+
+void FCSAtomicHotReloadState::EndTimingBreakdown(bool bSuccess, double TotalTimeMs)
+{
+    if (!bRecordingTimings.exchange(false, std::memory_order_acq_rel))
+    {
+        return;
+    }
+    
+    FHotReloadTimingBreakdown Breakdown;
+    {
+        std::lock_guard<std::mutex> Lock(TimingsMutex);
+        
+        CurrentTimings.bSuccess = bSuccess;
+        CurrentTimings.TotalTimeMs = TotalTimeMs;
+        Breakdown = MoveTemp(CurrentTimings);
+        CurrentTimings = FHotReloadTimingBreakdown{};
+        
+        if (TimingHistory.Num() >= MaxTimingHistory)
+        {
+            TimingHistory.RemoveAt(0);
+        }
+        TimingHistory.Add(Breakdown);
+    }
+    
+    Stats.RecordHotReload(bSuccess, TotalTimeMs);
+    Stats.RecordPhaseTimes(Breakdown);
+    
+    UE_LOG(LogTemp, Log, TEXT("CSAtomicHotReloadState: %s"), *FormatTimingBreakdown(Breakdown));
+    
+    // 每次热重载后导出，方便离线比较
+    const FString ReportPath = FPaths::ProjectSavedDir() / TEXT("UnrealSharp") / TEXT("HotReloadTimings.json");
+    FFileHelper::SaveStringToFile(ExportTimingBreakdownJson(), *ReportPath);
+}
+
+FCSAtomicHotReloadState::FHotReloadTimingBreakdown FCSAtomicHotReloadState::GetLastTimingBreakdown() const
+{
+    std::lock_guard<std::mutex> Lock(TimingsMutex);
+    return TimingHistory.IsEmpty() ? FHotReloadTimingBreakdown{} : TimingHistory.Last();
+}
+
+FString FCSAtomicHotReloadState::ExportTimingBreakdownJson() const
+{
+    TArray<TSharedPtr<FJsonValue>> HotReloadValues;
+    {
+        std::lock_guard<std::mutex> Lock(TimingsMutex);
+        HotReloadValues.Reserve(TimingHistory.Num());
+        
+        for (const FHotReloadTimingBreakdown& Breakdown : TimingHistory)
+        {
+            TSharedRef<FJsonObject> HotReloadObject = MakeShared<FJsonObject>();
+            HotReloadObject->SetStringField(TEXT("Timestamp"), Breakdown.Timestamp.ToIso8601());
+            HotReloadObject->SetBoolField(TEXT("Success"), Breakdown.bSuccess);
+            HotReloadObject->SetNumberField(TEXT("TotalMs"), Breakdown.TotalTimeMs);
+            
+            TSharedRef<FJsonObject> PhasesObject = MakeShared<FJsonObject>();
+            for (int32 PhaseIndex = 0; PhaseIndex < (int32)EHotReloadPhase::Num; ++PhaseIndex)
+            {
+                PhasesObject->SetNumberField(GetPhaseDescription((EHotReloadPhase)PhaseIndex), Breakdown.PhaseTimeMs[PhaseIndex]);
+            }
+            HotReloadObject->SetObjectField(TEXT("PhasesMs"), PhasesObject);
+            
+            TArray<TSharedPtr<FJsonValue>> TimingValues;
+            TimingValues.Reserve(Breakdown.Timings.Num());
+            for (const FHotReloadPhaseTiming& Timing : Breakdown.Timings)
+            {
+                TSharedRef<FJsonObject> TimingObject = MakeShared<FJsonObject>();
+                TimingObject->SetStringField(TEXT("Phase"), GetPhaseDescription(Timing.Phase));
+                if (!Timing.AssemblyName.IsNone())
+                {
+                    TimingObject->SetStringField(TEXT("Assembly"), Timing.AssemblyName.ToString());
+                }
+                TimingObject->SetNumberField(TEXT("DurationMs"), Timing.TimeMs);
+                TimingValues.Add(MakeShared<FJsonValueObject>(TimingObject));
+            }
+            HotReloadObject->SetArrayField(TEXT("Timings"), TimingValues);
+            
+            HotReloadValues.Add(MakeShared<FJsonValueObject>(HotReloadObject));
+        }
+    }
+    
+    TSharedRef<FJsonObject> Report = MakeShared<FJsonObject>();
+    Report->SetArrayField(TEXT("HotReloads"), HotReloadValues);
+    
+    FString ReportString;
+    FJsonSerializer::Serialize(Report, TJsonWriterFactory<>::Create(&ReportString));
+    return ReportString;
+}
+
+FString FCSAtomicHotReloadState::FormatTimingBreakdown(const FHotReloadTimingBreakdown& Breakdown)
+{
+    FString Result = FString::Printf(TEXT("Hot reload %s in %.0f ms"), Breakdown.bSuccess ? TEXT("finished") : TEXT("failed"), Breakdown.TotalTimeMs);
+    
+    for (int32 PhaseIndex = 0; PhaseIndex < (int32)EHotReloadPhase::Num; ++PhaseIndex)
+    {
+        const EHotReloadPhase Phase = (EHotReloadPhase)PhaseIndex;
+        if (Breakdown.PhaseTimeMs[PhaseIndex] <= 0.0)
+        {
+            continue;
+        }
+        
+        Result += FString::Printf(TEXT("\n  %s: %.0f ms"), *GetPhaseDescription(Phase), Breakdown.PhaseTimeMs[PhaseIndex]);
+        
+        // 按程序集进行的阶段列出每个程序集
+        for (const FHotReloadPhaseTiming& Timing : Breakdown.Timings)
+        {
+            if (Timing.Phase == Phase && !Timing.AssemblyName.IsNone())
+            {
+                Result += FString::Printf(TEXT("\n    %s: %.0f ms"), *Timing.AssemblyName.ToString(), Timing.TimeMs);
+            }
+        }
+    }
+    
+    return Result;
+}
+
 void FCSAtomicHotReloadState::EmergencyStopAllHotReloads()
 {
     UE_LOG(LogTemp, Warning, TEXT("CSAtomicHotReloadState: Emergency stop triggered"));
@@ -435,6 +591,21 @@ FString FCSAtomicHotReloadState::GetPlatformStateDescription(EPlatformHotReloadS
     }
 }
 
+FString FCSAtomicHotReloadState::GetPhaseDescription(EHotReloadPhase Phase)
+{
+    switch (Phase)
+    {
+        case EHotReloadPhase::Build: return TEXT("Build");
+        case EHotReloadPhase::Unload: return TEXT("Unload");
+        case EHotReloadPhase::Load: return TEXT("Load");
+        case EHotReloadPhase::ParseMetadata: return TEXT("Parse Metadata");
+        case EHotReloadPhase::BuildTypes: return TEXT("Build Types");
+        case EHotReloadPhase::RefreshBlueprints: return TEXT("Refresh Blueprints");
+        case EHotReloadPhase::Reinstance: return TEXT("Reinstance");
+        default: return TEXT("Unknown");
+    }
+}
+
 bool FCSAtomicHotReloadState::ValidateStateTransition(EHotReloadState FromState, EHotReloadState ToState) const
 {
     // 定义有效的状态转换
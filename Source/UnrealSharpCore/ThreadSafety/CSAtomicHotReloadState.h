@@ -6,6 +6,13 @@
 #include <mutex>
 #include <unordered_set>
 
+struct MonoAssembly;
+
+// 由UnrealSharpCore.Build.cs定义，为0时统计信息的记录被编译移除，统计值保持为0
+#ifndef UNREALSHARP_WITH_DIAGNOSTICS
+#define UNREALSHARP_WITH_DIAGNOSTICS !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+#endif
+
 /**
  * 原子化的热重载状态管理系统
  * 确保所有热重载状态变更的原子性和线程安全
@@ -42,6 +49,39 @@ public:
         MethodReplacing     // 方法替换中
     };
 
+    // 热重载的阶段，用于耗时分解。Load包含了在其中发生的ParseMetadata、BuildTypes和Reinstance
+    enum class EHotReloadPhase : uint8
+    {
+        Build,              // 编译C#项目
+        Unload,             // 卸载程序集
+        Load,               // 加载程序集
+        ParseMetadata,      // 解析类型元数据
+        BuildTypes,         // 重建类型
+        RefreshBlueprints,  // 刷新受影响的蓝图
+        Reinstance,         // 重新编译蓝图并重新实例化
+        Num
+    };
+
+    // 一个阶段的一次计时，按程序集进行的阶段带有程序集名称
+    struct FHotReloadPhaseTiming
+    {
+        EHotReloadPhase Phase = EHotReloadPhase::Build;
+        FName AssemblyName;
+        double TimeMs = 0.0;
+    };
+
+    // 一次热重载的耗时分解
+    struct FHotReloadTimingBreakdown
+    {
+        FDateTime Timestamp;
+        bool bSuccess = false;
+        double TotalTimeMs = 0.0;
+        double PhaseTimeMs[(int32)EHotReloadPhase::Num] = {};
+        TArray<FHotReloadPhaseTiming> Timings;
+
+        bool IsValid() const { return Timestamp.GetTicks() != 0; }
+    };
+
     // 热重载统计信息
     struct FHotReloadStats
     {
@@ -53,9 +93,12 @@ public:
         std::atomic<double> MaxHotReloadTime{0.0};
         std::atomic<int32> ConcurrentHotReloadAttempts{0};
         std::atomic<int32> QueuedHotReloads{0};
+        std::atomic<double> AveragePhaseTime[(int32)EHotReloadPhase::Num]{};
+        std::atomic<double> MaxPhaseTime[(int32)EHotReloadPhase::Num]{};
         
         void RecordHotReload(bool bSuccess, double TimeMs)
         {
+#if UNREALSHARP_WITH_DIAGNOSTICS
             TotalHotReloads.fetch_add(1, std::memory_order_relaxed);
             
             if (bSuccess)
@@ -78,6 +121,35 @@ public:
             {
                 FailedHotReloads.fetch_add(1, std::memory_order_relaxed);
             }
+#endif
+        }
+
+        void RecordPhaseTimes(const FHotReloadTimingBreakdown& Breakdown)
+        {
+#if UNREALSHARP_WITH_DIAGNOSTICS
+            // 第一次热重载之前平均值为0，直接使用本次的耗时
+            const bool bFirstSample = TotalHotReloads.load(std::memory_order_relaxed) <= 1;
+            
+            for (int32 PhaseIndex = 0; PhaseIndex < (int32)EHotReloadPhase::Num; ++PhaseIndex)
+            {
+                const double TimeMs = Breakdown.PhaseTimeMs[PhaseIndex];
+                
+                double CurrentAvg = AveragePhaseTime[PhaseIndex].load(std::memory_order_relaxed);
+                AveragePhaseTime[PhaseIndex].store(bFirstSample ? TimeMs : (CurrentAvg * 0.9) + (TimeMs * 0.1), std::memory_order_relaxed);
+                
+                if (TimeMs > MaxPhaseTime[PhaseIndex].load(std::memory_order_relaxed))
+                {
+                    MaxPhaseTime[PhaseIndex].store(TimeMs, std::memory_order_relaxed);
+                }
+            }
+#endif
+        }
+
+        void RecordCancelledHotReload()
+        {
+#if UNREALSHARP_WITH_DIAGNOSTICS
+            CancelledHotReloads.fetch_add(1, std::memory_order_relaxed);
+#endif
         }
         
         double GetSuccessRate() const
@@ -110,6 +182,13 @@ private:
     // 统计信息
     FHotReloadStats Stats;
     
+    // 耗时分解，CurrentTimings只在记录期间有效，TimingHistory保留最近的热重载
+    FHotReloadTimingBreakdown CurrentTimings;
+    TArray<FHotReloadTimingBreakdown> TimingHistory;
+    std::atomic<bool> bRecordingTimings{false};
+    mutable std::mutex TimingsMutex;
+    static constexpr int32 MaxTimingHistory = 20;
+    
     // 平台特定状态映射
     TMap<FString, MonoAssembly*> RegisteredAssemblies;
     TMap<FString, TArray<void*>> MethodReplacementMap;
@@ -269,6 +348,50 @@ public:
      */
     FString ExportDiagnosticsReport() const;
 
+    /**
+     * 开始记录一次热重载的耗时分解
+     */
+    void BeginTimingBreakdown();
+
+    /**
+     * 记录一个阶段的耗时，只在BeginTimingBreakdown和EndTimingBreakdown之间生效
+     * @param Phase 阶段
+     * @param TimeMs 耗时
+     * @param AssemblyName 按程序集进行的阶段所属的程序集
+     */
+    void RecordPhaseTime(EHotReloadPhase Phase, double TimeMs, FName AssemblyName = NAME_None);
+
+    /**
+     * 结束记录，更新统计信息并把历史写入Saved/UnrealSharp/HotReloadTimings.json
+     * 编辑器的热重载不经过AtomicBeginHotReload，所以总耗时也在这里记录
+     * @param bSuccess 是否成功
+     * @param TotalTimeMs 总耗时
+     */
+    void EndTimingBreakdown(bool bSuccess, double TotalTimeMs);
+
+    /**
+     * 是否正在记录耗时分解
+     */
+    bool IsRecordingTimings() const
+    {
+        return bRecordingTimings.load(std::memory_order_acquire);
+    }
+
+    /**
+     * 获取最近一次热重载的耗时分解，还没有热重载时IsValid()返回false
+     */
+    FHotReloadTimingBreakdown GetLastTimingBreakdown() const;
+
+    /**
+     * 以JSON导出最近的热重载耗时分解
+     */
+    FString ExportTimingBreakdownJson() const;
+
+    /**
+     * 以文本格式输出一次热重载的耗时分解
+     */
+    static FString FormatTimingBreakdown(const FHotReloadTimingBreakdown& Breakdown);
+
     /**
      * 紧急停止所有热重载操作
      */
@@ -286,6 +409,7 @@ public:
     static FString GetStateDescription(EHotReloadState State);
     static FString GetTypeDescription(EHotReloadType Type);
     static FString GetPlatformStateDescription(EPlatformHotReloadState State);
+    static FString GetPhaseDescription(EHotReloadPhase Phase);
 
 private:
     /**
@@ -365,6 +489,33 @@ private:
  */
 UNREALSHARPCORE_API FCSAtomicHotReloadState& GetGlobalAtomicHotReloadState();
 
+/**
+ * 为热重载的一个阶段计时，只在全局状态正在记录耗时分解时计时
+ */
+class FCSScopedHotReloadPhase
+{
+    FCSAtomicHotReloadState::EHotReloadPhase Phase;
+    FName AssemblyName;
+    double StartTime;
+
+public:
+    explicit FCSScopedHotReloadPhase(FCSAtomicHotReloadState::EHotReloadPhase InPhase, FName InAssemblyName = NAME_None)
+        : Phase(InPhase), AssemblyName(InAssemblyName)
+        , StartTime(GetGlobalAtomicHotReloadState().IsRecordingTimings() ? FPlatformTime::Seconds() : 0.0)
+    {
+    }
+
+    ~FCSScopedHotReloadPhase()
+    {
+        if (StartTime > 0.0)
+        {
+            GetGlobalAtomicHotReloadState().RecordPhaseTime(Phase, (FPlatformTime::Seconds() - StartTime) * 1000.0, AssemblyName);
+        }
+    }
+
+    UE_NONCOPYABLE(FCSScopedHotReloadPhase);
+};
+
 /**
  * 热重载操作助手宏
  */
@@ -0,0 +1,141 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+/**
+ * 无锁有界多生产者多消费者队列
+ * 每个槽位带序号，入队与出队各自只在一个位置计数上做CAS，满或空时立即失败而不阻塞
+ *
+ * 容量向上取整为2的幂。Reset不是线程安全的，只能在没有任何生产者和消费者时调用
+ */
+template<typename ElementType>
+class TCSBoundedMPMCQueue
+{
+public:
+    TCSBoundedMPMCQueue() = default;
+
+    explicit TCSBoundedMPMCQueue(uint32 InCapacity)
+    {
+        Reset(InCapacity);
+    }
+
+    ~TCSBoundedMPMCQueue()
+    {
+        delete[] Cells;
+    }
+
+    TCSBoundedMPMCQueue(const TCSBoundedMPMCQueue&) = delete;
+    TCSBoundedMPMCQueue& operator=(const TCSBoundedMPMCQueue&) = delete;
+
+    void Reset(uint32 InCapacity)
+    {
+        delete[] Cells;
+
+        const uint32 Capacity = FMath::RoundUpToPowerOfTwo(FMath::Max<uint32>(InCapacity, 2));
+        Cells = new FCell[Capacity];
+        Mask = Capacity - 1;
+
+        for (uint32 i = 0; i < Capacity; ++i)
+        {
+            Cells[i].Sequence.store(i, std::memory_order_relaxed);
+        }
+
+        EnqueuePos.store(0, std::memory_order_relaxed);
+        DequeuePos.store(0, std::memory_order_relaxed);
+    }
+
+    bool TryEnqueue(ElementType Item)
+    {
+        if (!Cells)
+        {
+            return false;
+        }
+
+        uint64 Pos = EnqueuePos.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            FCell& Cell = Cells[Pos & Mask];
+            const uint64 Sequence = Cell.Sequence.load(std::memory_order_acquire);
+            const int64 Diff = (int64)Sequence - (int64)Pos;
+
+            if (Diff == 0)
+            {
+                if (EnqueuePos.compare_exchange_weak(Pos, Pos + 1, std::memory_order_relaxed))
+                {
+                    Cell.Data = MoveTemp(Item);
+                    Cell.Sequence.store(Pos + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (Diff < 0)
+            {
+                // 槽位还没被上一轮的消费者取走，队列已满
+                return false;
+            }
+            else
+            {
+                Pos = EnqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool TryDequeue(ElementType& OutItem)
+    {
+        if (!Cells)
+        {
+            return false;
+        }
+
+        uint64 Pos = DequeuePos.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            FCell& Cell = Cells[Pos & Mask];
+            const uint64 Sequence = Cell.Sequence.load(std::memory_order_acquire);
+            const int64 Diff = (int64)Sequence - (int64)(Pos + 1);
+
+            if (Diff == 0)
+            {
+                if (DequeuePos.compare_exchange_weak(Pos, Pos + 1, std::memory_order_relaxed))
+                {
+                    OutItem = MoveTemp(Cell.Data);
+                    Cell.Sequence.store(Pos + Mask + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (Diff < 0)
+            {
+                // 生产者还没写入这个槽位，队列为空
+                return false;
+            }
+            else
+            {
+                Pos = DequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /** 近似元素数量，仅用于统计 */
+    int32 GetApproximateNum() const
+    {
+        const uint64 Enqueued = EnqueuePos.load(std::memory_order_relaxed);
+        const uint64 Dequeued = DequeuePos.load(std::memory_order_relaxed);
+        return Enqueued > Dequeued ? (int32)(Enqueued - Dequeued) : 0;
+    }
+
+    int32 GetCapacity() const { return Cells ? (int32)(Mask + 1) : 0; }
+
+private:
+    struct FCell
+    {
+        std::atomic<uint64> Sequence{0};
+        ElementType Data{};
+    };
+
+    FCell* Cells = nullptr;
+    uint64 Mask = 0;
+
+    // 入队与出队位置分处不同缓存行，生产者和消费者互不伪共享
+    alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint64> EnqueuePos{0};
+    alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint64> DequeuePos{0};
+};
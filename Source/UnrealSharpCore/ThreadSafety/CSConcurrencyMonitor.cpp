@@ -14,6 +14,8 @@ FCSConcurrencyMonitor& GetGlobalConcurrencyMonitor()
     return GlobalConcurrencyMonitor;
 }
 
+#if UNREALSHARP_WITH_CONCURRENCY_MONITOR
+
 bool FCSConcurrencyMonitor::Initialize(const FMonitoringConfig& InConfig)
 {
     if (bIsInitialized.load(std::memory_order_relaxed))
@@ -131,63 +133,163 @@ void FCSConcurrencyMonitor::Shutdown()
     bIsInitialized.store(false, std::memory_order_release);
 }
 
-void FCSConcurrencyMonitor::RecordResourceAccess(void* Resource, const FString& ResourceName, EAccessPattern AccessPattern)
+void FCSConcurrencyMonitor::RecordResourceAccess(void* Resource, uint32 ResourceId, EAccessPattern AccessPattern)
 {
     if (!bIsMonitoring.load(std::memory_order_relaxed) || !Resource)
     {
         return;
     }
     
-    uint32 CurrentThreadId = FPlatformTLS::GetCurrentThreadId();
-    auto Now = std::chrono::high_resolution_clock::now();
+    FResourceAccessEvent Event;
+    Event.ResourceAddress = Resource;
+    Event.Cycles = FPlatformTime::Cycles64();
+    Event.ResourceId = ResourceId;
+    Event.ThreadId = FPlatformTLS::GetCurrentThreadId();
+    Event.AccessPattern = AccessPattern;
     
-    std::lock_guard<std::mutex> Lock(ResourcesMutex);
+    // 缓冲区已满说明监控线程跟不上，丢弃事件而不是阻塞访问线程
+    if (!GetThreadEventRing().TryPush(Event))
+    {
+        Stats.DroppedAccessEvents.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void FCSConcurrencyMonitor::RecordResourceAccess(void* Resource, const FString& ResourceName, EAccessPattern AccessPattern)
+{
+    if (!bIsMonitoring.load(std::memory_order_relaxed) || !Resource)
+    {
+        return;
+    }
     
-    // 创建访问记录
-    FResourceAccess Access;
-    Access.ResourceName = ResourceName;
-    Access.ThreadId = CurrentThreadId;
-    Access.AccessPattern = AccessPattern;
-    Access.Timestamp = Now;
-    Access.ResourceAddress = Resource;
-    Access.CallStack = Config.bEnableCallStackCapture ? GetCurrentCallStack() : TEXT("");
-    
-    // 检查是否已有该资源的记录
-    auto& AccessHistory = ResourceAccessHistory[Resource];
-    
-    // 检查最近的访问记录，如果是同一线程的连续访问，更新计数
-    if (!AccessHistory.empty())
-    {
-        auto& LastAccess = AccessHistory.back();
-        if (LastAccess.ThreadId == CurrentThreadId && 
-            LastAccess.AccessPattern == AccessPattern &&
-            std::chrono::duration_cast<std::chrono::milliseconds>(Now - LastAccess.Timestamp).count() < 100)
+    RecordResourceAccess(Resource, InternResourceName(ResourceName), AccessPattern);
+}
+
+uint32 FCSConcurrencyMonitor::InternResourceName(const FString& ResourceName)
+{
+    {
+        FReadScopeLock ReadLock(ResourceNamesLock);
+        if (const uint32* ExistingId = ResourceNameIds.Find(ResourceName))
         {
-            LastAccess.AccessCount++;
-            LastAccess.Timestamp = Now;
-            return;
+            return *ExistingId;
         }
     }
     
-    // 添加新的访问记录
-    AccessHistory.push_back(Access);
+    FWriteScopeLock WriteLock(ResourceNamesLock);
+    if (const uint32* ExistingId = ResourceNameIds.Find(ResourceName))
+    {
+        return *ExistingId;
+    }
+    
+    const uint32 NewId = ResourceNames.Add(ResourceName);
+    ResourceNameIds.Add(ResourceName, NewId);
+    return NewId;
+}
+
+FString FCSConcurrencyMonitor::GetResourceName(uint32 ResourceId) const
+{
+    FReadScopeLock ReadLock(ResourceNamesLock);
+    return ResourceNames.IsValidIndex(ResourceId) ? ResourceNames[ResourceId] : FString();
+}
+
+FCSConcurrencyMonitor::FAccessEventRing& FCSConcurrencyMonitor::GetThreadEventRing()
+{
+    struct FThreadRing
+    {
+        const FCSConcurrencyMonitor* Owner = nullptr;
+        FAccessEventRing* Ring = nullptr;
+    };
+    
+    thread_local FThreadRing ThreadRing;
+    if (ThreadRing.Owner != this)
+    {
+        TUniquePtr<FAccessEventRing> NewRing = MakeUnique<FAccessEventRing>();
+        ThreadRing.Ring = NewRing.Get();
+        ThreadRing.Owner = this;
+        
+        FScopeLock Lock(&EventRingsMutex);
+        EventRings.Add(MoveTemp(NewRing));
+    }
+    
+    return *ThreadRing.Ring;
+}
+
+void FCSConcurrencyMonitor::DrainAccessEvents()
+{
+    DrainedEvents.Reset();
     
-    // 更新资源线程映射
-    ResourceThreadMap[ResourceName].insert(CurrentThreadId);
+    {
+        FScopeLock Lock(&EventRingsMutex);
+        for (const TUniquePtr<FAccessEventRing>& Ring : EventRings)
+        {
+            const uint32 Read = Ring->ReadIndex.load(std::memory_order_relaxed);
+            const uint32 Write = Ring->WriteIndex.load(std::memory_order_acquire);
+            
+            for (uint32 Index = Read; Index != Write; ++Index)
+            {
+                DrainedEvents.Add(Ring->Events[Index & (FAccessEventRing::Capacity - 1)]);
+            }
+            
+            Ring->ReadIndex.store(Write, std::memory_order_release);
+        }
+    }
     
-    // 限制历史记录大小
-    if (AccessHistory.size() > (size_t)Config.MaxResourceHistorySize / 10)
+    if (DrainedEvents.IsEmpty())
     {
-        AccessHistory.erase(AccessHistory.begin(), AccessHistory.begin() + AccessHistory.size() / 2);
+        return;
     }
     
-    // 实时检测竞态条件
-    if (Config.bEnableRaceConditionDetection && AccessHistory.size() >= 2)
+    // 各线程的事件各自有序，合并后按时间排序，访问历史才能反映真实的交错顺序
+    DrainedEvents.Sort([](const FResourceAccessEvent& A, const FResourceAccessEvent& B)
     {
-        AnalyzeResourceAccessPatterns(Resource, AccessHistory);
+        return A.Cycles < B.Cycles;
+    });
+    
+    const double CoalesceWindowMs = 100.0;
+    
+    std::lock_guard<std::mutex> Lock(ResourcesMutex);
+    
+    for (const FResourceAccessEvent& Event : DrainedEvents)
+    {
+        auto& AccessHistory = ResourceAccessHistory[Event.ResourceAddress];
+        
+        // 同一线程短时间内的连续同类访问合并为一条记录
+        if (!AccessHistory.empty())
+        {
+            auto& LastAccess = AccessHistory.back();
+            if (LastAccess.ThreadId == Event.ThreadId && 
+                LastAccess.AccessPattern == Event.AccessPattern &&
+                CyclesToMilliseconds(LastAccess.Timestamp, Event.Cycles) < CoalesceWindowMs)
+            {
+                LastAccess.AccessCount++;
+                LastAccess.Timestamp = Event.Cycles;
+                continue;
+            }
+        }
+        
+        FResourceAccess Access;
+        Access.ResourceId = Event.ResourceId;
+        Access.ThreadId = Event.ThreadId;
+        Access.AccessPattern = Event.AccessPattern;
+        Access.Timestamp = Event.Cycles;
+        Access.ResourceAddress = Event.ResourceAddress;
+        AccessHistory.push_back(Access);
+        
+        // 更新资源线程映射
+        ResourceThreadMap[Event.ResourceId].insert(Event.ThreadId);
+        
+        // 限制历史记录大小
+        if (AccessHistory.size() > (size_t)Config.MaxResourceHistorySize / 10)
+        {
+            AccessHistory.erase(AccessHistory.begin(), AccessHistory.begin() + AccessHistory.size() / 2);
+        }
     }
 }
 
+double FCSConcurrencyMonitor::CyclesToMilliseconds(uint64 StartCycles, uint64 EndCycles)
+{
+    return EndCycles > StartCycles ? FPlatformTime::ToMilliseconds64(EndCycles - StartCycles) : 0.0;
+}
+
 void FCSConcurrencyMonitor::RecordLockAcquisition(void* LockObject, const FString& LockName)
 {
     if (!bIsMonitoring.load(std::memory_order_relaxed) || !LockObject)
@@ -375,7 +477,7 @@ bool FCSConcurrencyMonitor::DetectResourceLeaks()
     
     auto StartTime = std::chrono::high_resolution_clock::now();
     bool FoundLeaks = false;
-    auto Now = std::chrono::high_resolution_clock::now();
+    const uint64 NowCycles = FPlatformTime::Cycles64();
     
     std::lock_guard<std::mutex> ResourceLock(ResourcesMutex);
     
@@ -386,7 +488,7 @@ bool FCSConcurrencyMonitor::DetectResourceLeaks()
         if (!AccessHistory.empty())
         {
             const auto& LastAccess = AccessHistory.back();
-            auto TimeSinceLastAccess = std::chrono::duration<double>(Now - LastAccess.Timestamp).count();
+            const double TimeSinceLastAccess = CyclesToMilliseconds(LastAccess.Timestamp, NowCycles) / 1000.0;
             
             // 如果资源很久没有被访问，可能是泄露
             if (TimeSinceLastAccess > Config.ResourceAccessTimeoutSeconds)
@@ -395,8 +497,8 @@ bool FCSConcurrencyMonitor::DetectResourceLeaks()
                 Report.Type = EViolationType::ResourceLeak;
                 Report.Severity = ESeverity::Warning;
                 Report.Description = FString::Printf(TEXT("Potential resource leak: %s has not been accessed for %.2f seconds"), 
-                                                   *LastAccess.ResourceName, TimeSinceLastAccess);
-                Report.ResourceName = LastAccess.ResourceName;
+                                                   *GetResourceName(LastAccess.ResourceId), TimeSinceLastAccess);
+                Report.ResourceName = GetResourceName(LastAccess.ResourceId);
                 
                 ReportViolation(Report);
                 FoundLeaks = true;
@@ -462,6 +564,7 @@ FString FCSConcurrencyMonitor::ExportDiagnosticsReport() const
     Report += FString::Printf(TEXT("  Resource Leaks: %d\n"), Stats.ResourceLeakViolations.load());
     Report += FString::Printf(TEXT("  Average Detection Time: %.2f ms\n"), Stats.AverageDetectionTimeMs.load());
     Report += FString::Printf(TEXT("  Max Detection Time: %.2f ms\n"), Stats.MaxDetectionTimeMs.load());
+    Report += FString::Printf(TEXT("  Dropped Access Events: %lld\n"), Stats.DroppedAccessEvents.load());
     
     {
         std::lock_guard<std::mutex> ResourceLock(ResourcesMutex);
@@ -583,15 +686,22 @@ void FCSConcurrencyMonitor::MonitoringThreadLoop()
 {
     UE_LOG(LogTemp, Log, TEXT("CSConcurrencyMonitor: Monitoring thread started"));
     
+    // 环形缓冲区容量有限，汇总要比检测频繁得多
+    constexpr int32 DrainIntervalMs = 10;
+    double LastDetectionTime = FPlatformTime::Seconds();
+    
     while (!bShouldStop.load(std::memory_order_relaxed))
     {
-        RunDetectionCycle();
+        DrainAccessEvents();
         
-        // 等待下一个检测周期
-        double SleepTime = Config.DetectionIntervalSeconds;
-        int32 SleepMs = (int32)(SleepTime * 1000);
+        const double Now = FPlatformTime::Seconds();
+        if (Now - LastDetectionTime >= Config.DetectionIntervalSeconds)
+        {
+            RunDetectionCycle();
+            LastDetectionTime = Now;
+        }
         
-        std::this_thread::sleep_for(std::chrono::milliseconds(SleepMs));
+        std::this_thread::sleep_for(std::chrono::milliseconds(DrainIntervalMs));
     }
     
     UE_LOG(LogTemp, Log, TEXT("CSConcurrencyMonitor: Monitoring thread stopped"));
@@ -638,7 +748,6 @@ bool FCSConcurrencyMonitor::AnalyzeResourceAccessPatterns(void* Resource, const
     }
     
     bool FoundViolation = false;
-    auto Now = std::chrono::high_resolution_clock::now();
     
     // 检查最近的访问模式
     const int32 RecentAccessWindow = FMath::Min((int32)AccessHistory.size(), 10);
@@ -653,7 +762,7 @@ bool FCSConcurrencyMonitor::AnalyzeResourceAccessPatterns(void* Resource, const
             (Access1.AccessPattern == EAccessPattern::Write || Access1.AccessPattern == EAccessPattern::ReadWrite) &&
             (Access2.AccessPattern == EAccessPattern::Write || Access2.AccessPattern == EAccessPattern::ReadWrite))
         {
-            auto TimeDiff = std::chrono::duration<double, std::milli>(Access2.Timestamp - Access1.Timestamp).count();
+            const double TimeDiff = CyclesToMilliseconds(Access1.Timestamp, Access2.Timestamp);
             
             // 如果两次写入时间很接近，可能存在竞态条件
             if (TimeDiff < 50.0) // 50ms以内
@@ -662,8 +771,8 @@ bool FCSConcurrencyMonitor::AnalyzeResourceAccessPatterns(void* Resource, const
                 Report.Type = EViolationType::RaceCondition;
                 Report.Severity = ESeverity::Error;
                 Report.Description = FString::Printf(TEXT("Potential race condition: Concurrent write access to resource %s by threads %d and %d within %.2fms"), 
-                                                   *Access1.ResourceName, Access1.ThreadId, Access2.ThreadId, TimeDiff);
-                Report.ResourceName = Access1.ResourceName;
+                                                   *GetResourceName(Access1.ResourceId), Access1.ThreadId, Access2.ThreadId, TimeDiff);
+                Report.ResourceName = GetResourceName(Access1.ResourceId);
                 Report.InvolvedThreads.Add(Access1.ThreadId);
                 Report.InvolvedThreads.Add(Access2.ThreadId);
                 
@@ -680,7 +789,7 @@ bool FCSConcurrencyMonitor::AnalyzeResourceAccessPatterns(void* Resource, const
             
             if (IsConflict)
             {
-                auto TimeDiff = std::chrono::duration<double, std::milli>(Access2.Timestamp - Access1.Timestamp).count();
+                const double TimeDiff = CyclesToMilliseconds(Access1.Timestamp, Access2.Timestamp);
                 
                 if (TimeDiff < 100.0) // 100ms以内
                 {
@@ -688,8 +797,8 @@ bool FCSConcurrencyMonitor::AnalyzeResourceAccessPatterns(void* Resource, const
                     Report.Type = EViolationType::UnsafeConcurrentAccess;
                     Report.Severity = ESeverity::Warning;
                     Report.Description = FString::Printf(TEXT("Unsafe concurrent access: Read-Write conflict on resource %s between threads %d and %d within %.2fms"), 
-                                                       *Access1.ResourceName, Access1.ThreadId, Access2.ThreadId, TimeDiff);
-                    Report.ResourceName = Access1.ResourceName;
+                                                       *GetResourceName(Access1.ResourceId), Access1.ThreadId, Access2.ThreadId, TimeDiff);
+                    Report.ResourceName = GetResourceName(Access1.ResourceId);
                     Report.InvolvedThreads.Add(Access1.ThreadId);
                     Report.InvolvedThreads.Add(Access2.ThreadId);
                     
@@ -758,6 +867,7 @@ void FCSConcurrencyMonitor::LogViolation(const FViolationReport& Report)
 void FCSConcurrencyMonitor::CleanupExpiredData()
 {
     auto Now = std::chrono::high_resolution_clock::now();
+    const uint64 NowCycles = FPlatformTime::Cycles64();
     
     // 清理过期的资源访问记录
     {
@@ -770,8 +880,8 @@ void FCSConcurrencyMonitor::CleanupExpiredData()
             // 移除超过一定时间的访问记录
             AccessHistory.erase(
                 std::remove_if(AccessHistory.begin(), AccessHistory.end(),
-                    [Now](const FResourceAccess& Access) {
-                        auto Age = std::chrono::duration<double>(Now - Access.Timestamp).count();
+                    [NowCycles](const FResourceAccess& Access) {
+                        const double Age = CyclesToMilliseconds(Access.Timestamp, NowCycles) / 1000.0;
                         return Age > 300.0; // 5分钟
                     }),
                 AccessHistory.end()
@@ -879,4 +989,6 @@ FString FCSConcurrencyMonitor::GetSeverityDescription(ESeverity Severity)
         case ESeverity::Critical: return TEXT("CRITICAL");
         default: return TEXT("UNKNOWN");
     }
-}
\ No newline at end of file
+}
+
+#endif // UNREALSHARP_WITH_CONCURRENCY_MONITOR
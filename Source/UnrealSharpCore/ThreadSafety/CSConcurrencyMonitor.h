@@ -11,6 +11,11 @@
 #include <chrono>
 #include <thread>
 
+// 由UnrealSharpCore.Build.cs定义，Shipping和Test构建中为0，此时监控器只剩空的内联实现
+#ifndef UNREALSHARP_WITH_CONCURRENCY_MONITOR
+#define UNREALSHARP_WITH_CONCURRENCY_MONITOR !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+#endif
+
 /**
  * 并发监控系统
  * 实时检测和报告线程安全违规行为
@@ -49,21 +54,31 @@ public:
         Critical = 3            // 严重
     };
 
-    // 资源访问记录
+    // 资源访问事件，由访问线程写入自己的环形缓冲区，必须保持POD
+    struct FResourceAccessEvent
+    {
+        void* ResourceAddress;              // 资源地址
+        uint64 Cycles;                      // 时间戳（FPlatformTime::Cycles64）
+        uint32 ResourceId;                  // 资源名称ID，见InternResourceName
+        uint32 ThreadId;                    // 线程ID
+        EAccessPattern AccessPattern;       // 访问模式
+    };
+
+    // 资源访问记录，由监控线程从事件汇总而来
     struct FResourceAccess
     {
-        FString ResourceName;               // 资源名称
+        uint32 ResourceId;                  // 资源名称ID
         uint32 ThreadId;                    // 线程ID
         EAccessPattern AccessPattern;       // 访问模式
-        std::chrono::high_resolution_clock::time_point Timestamp; // 时间戳
-        FString CallStack;                  // 调用栈
+        uint64 Timestamp;                   // 时间戳（FPlatformTime::Cycles64）
         void* ResourceAddress;              // 资源地址
         int32 AccessCount;                  // 访问计数
         
         FResourceAccess()
-            : ThreadId(0)
+            : ResourceId(0)
+            , ThreadId(0)
             , AccessPattern(EAccessPattern::Read)
-            , Timestamp(std::chrono::high_resolution_clock::now())
+            , Timestamp(FPlatformTime::Cycles64())
             , ResourceAddress(nullptr)
             , AccessCount(1)
         {}
@@ -119,6 +134,7 @@ public:
         std::atomic<int32> ResourceLeakViolations{0};          // 资源泄露违规数
         std::atomic<int32> ActiveResourceTracking{0};          // 活跃资源跟踪数
         std::atomic<int32> MonitoredThreads{0};                // 监控线程数
+        std::atomic<int64> DroppedAccessEvents{0};             // 环形缓冲区已满时丢弃的访问事件数
         std::atomic<double> AverageDetectionTimeMs{0.0};       // 平均检测时间
         std::atomic<double> MaxDetectionTimeMs{0.0};           // 最大检测时间
         
@@ -158,19 +174,56 @@ public:
     };
 
 private:
+    // 配置和统计
+    FMonitoringConfig Config;
+    FMonitoringStats Stats;
+
+#if UNREALSHARP_WITH_CONCURRENCY_MONITOR
     // 监控状态
     std::atomic<bool> bIsMonitoring{false};
     std::atomic<bool> bIsInitialized{false};
     std::atomic<bool> bShouldStop{false};
     
-    // 配置和统计
-    FMonitoringConfig Config;
-    FMonitoringStats Stats;
-    
-    // 资源跟踪
+    /**
+     * 单生产者单消费者的访问事件环形缓冲区
+     * 每个线程只写自己的缓冲区，监控线程负责读取，记录访问时不需要加锁
+     */
+    struct FAccessEventRing
+    {
+        static constexpr uint32 Capacity = 4096;   // 必须是2的幂
+
+        FResourceAccessEvent Events[Capacity];
+        alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint32> WriteIndex{0};
+        alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint32> ReadIndex{0};
+
+        bool TryPush(const FResourceAccessEvent& Event)
+        {
+            const uint32 Write = WriteIndex.load(std::memory_order_relaxed);
+            if (Write - ReadIndex.load(std::memory_order_acquire) >= Capacity)
+            {
+                return false;
+            }
+
+            Events[Write & (Capacity - 1)] = Event;
+            WriteIndex.store(Write + 1, std::memory_order_release);
+            return true;
+        }
+    };
+
+    // 所有线程的环形缓冲区，生命周期与监控器相同，线程退出后仍保留以免监控线程读到已释放的内存
+    mutable FCriticalSection EventRingsMutex;
+    TArray<TUniquePtr<FAccessEventRing>> EventRings;
+
+    // 资源名称驻留表，名称只在首次出现时加锁转换为ID
+    mutable FRWLock ResourceNamesLock;
+    TMap<FString, uint32> ResourceNameIds;
+    TArray<FString> ResourceNames;
+
+    // 资源跟踪，只由监控线程写入
     mutable std::mutex ResourcesMutex;
     std::unordered_map<void*, std::vector<FResourceAccess>> ResourceAccessHistory;
-    std::unordered_map<FString, std::unordered_set<uint32>> ResourceThreadMap;
+    std::unordered_map<uint32, std::unordered_set<uint32>> ResourceThreadMap;
+    TArray<FResourceAccessEvent> DrainedEvents;
     
     // 线程跟踪
     mutable std::mutex ThreadsMutex;
@@ -211,10 +264,21 @@ public:
     void Shutdown();
 
     /**
-     * 记录资源访问
+     * 记录资源访问，只写入当前线程的环形缓冲区，由监控线程汇总
      */
+    void RecordResourceAccess(void* Resource, uint32 ResourceId, EAccessPattern AccessPattern);
     void RecordResourceAccess(void* Resource, const FString& ResourceName, EAccessPattern AccessPattern);
 
+    /**
+     * 将资源名称转换为ID，同一名称总是得到同一ID
+     */
+    uint32 InternResourceName(const FString& ResourceName);
+
+    /**
+     * 获取资源ID对应的名称
+     */
+    FString GetResourceName(uint32 ResourceId) const;
+
     /**
      * 记录锁获取
      */
@@ -311,6 +375,21 @@ private:
      */
     void RunDetectionCycle();
 
+    /**
+     * 读取所有线程的环形缓冲区，按时间顺序合并到访问历史
+     */
+    void DrainAccessEvents();
+
+    /**
+     * 获取当前线程的环形缓冲区，首次调用时创建并注册
+     */
+    FAccessEventRing& GetThreadEventRing();
+
+    /**
+     * 将Cycles64时间差转换为毫秒
+     */
+    static double CyclesToMilliseconds(uint64 StartCycles, uint64 EndCycles);
+
     /**
      * 分析资源访问模式
      */
@@ -351,23 +430,48 @@ private:
      */
     static FString GetSeverityDescription(ESeverity Severity);
 
+#else
+public:
+    // 监控器已编译移除：所有接口都是空操作，IsMonitoring恒为false，调用点的检查会被编译器消除
+    bool Initialize(const FMonitoringConfig& InConfig = FMonitoringConfig()) { Config = InConfig; return true; }
+    bool StartMonitoring() { return false; }
+    void StopMonitoring() {}
+    void Shutdown() {}
+    void RecordResourceAccess(void* Resource, uint32 ResourceId, EAccessPattern AccessPattern) {}
+    void RecordResourceAccess(void* Resource, const FString& ResourceName, EAccessPattern AccessPattern) {}
+    uint32 InternResourceName(const FString& ResourceName) { return 0; }
+    FString GetResourceName(uint32 ResourceId) const { return FString(); }
+    void RecordLockAcquisition(void* LockObject, const FString& LockName) {}
+    void RecordLockRelease(void* LockObject, const FString& LockName) {}
+    void RegisterThread(uint32 ThreadId, const FString& ThreadName) {}
+    void UnregisterThread(uint32 ThreadId) {}
+    bool DetectRaceConditions() { return true; }
+    bool DetectDeadlockPotential() { return true; }
+    bool ValidateLockOrder() { return true; }
+    bool DetectResourceLeaks() { return true; }
+    const FMonitoringStats& GetMonitoringStatistics() const { return Stats; }
+    const FMonitoringConfig& GetConfiguration() const { return Config; }
+    void UpdateConfiguration(const FMonitoringConfig& NewConfig) { Config = NewConfig; }
+    TArray<FViolationReport> GetViolationReports(ESeverity MinSeverity = ESeverity::Warning) const { return TArray<FViolationReport>(); }
+    void ClearViolationReports() {}
+    FString ExportDiagnosticsReport() const { return TEXT("Concurrency monitor compiled out (UNREALSHARP_WITH_CONCURRENCY_MONITOR=0)\n"); }
+    FString ExportViolationReport() const { return FString(); }
+    bool IsSystemHealthy() const { return true; }
+    bool IsMonitoring() const { return false; }
+#endif
+
     /**
      * RAII资源访问追踪器
      */
+public:
     class FScopedResourceTracker
     {
-        FCSConcurrencyMonitor& Monitor;
-        void* Resource;
-        FString ResourceName;
-        EAccessPattern AccessPattern;
-
     public:
-        FScopedResourceTracker(FCSConcurrencyMonitor& InMonitor, void* InResource, const FString& InResourceName, EAccessPattern InAccessPattern)
-            : Monitor(InMonitor), Resource(InResource), ResourceName(InResourceName), AccessPattern(InAccessPattern)
+        FScopedResourceTracker(FCSConcurrencyMonitor& Monitor, void* Resource, uint32 ResourceId, EAccessPattern AccessPattern)
         {
             if (Monitor.IsMonitoring())
             {
-                Monitor.RecordResourceAccess(Resource, ResourceName, AccessPattern);
+                Monitor.RecordResourceAccess(Resource, ResourceId, AccessPattern);
             }
         }
 
@@ -385,9 +489,12 @@ UNREALSHARPCORE_API FCSConcurrencyMonitor& GetGlobalConcurrencyMonitor();
 
 /**
  * 监控助手宏
+ * 名称在每个调用点只驻留一次，同一调用点必须始终使用同一名称
  */
+#if UNREALSHARP_WITH_CONCURRENCY_MONITOR
 #define MONITOR_RESOURCE_ACCESS(Resource, Name, Pattern) \
-    FCSConcurrencyMonitor::FScopedResourceTracker ANONYMOUS_VARIABLE(ResourceTracker)(GetGlobalConcurrencyMonitor(), Resource, Name, Pattern)
+    static const uint32 PREPROCESSOR_JOIN(ResourceTrackerId, __LINE__) = GetGlobalConcurrencyMonitor().InternResourceName(Name); \
+    FCSConcurrencyMonitor::FScopedResourceTracker ANONYMOUS_VARIABLE(ResourceTracker)(GetGlobalConcurrencyMonitor(), Resource, PREPROCESSOR_JOIN(ResourceTrackerId, __LINE__), Pattern)
 
 #define MONITOR_LOCK_ACQUISITION(LockObject, LockName) \
     do { \
@@ -404,6 +511,11 @@ UNREALSHARPCORE_API FCSConcurrencyMonitor& GetGlobalConcurrencyMonitor();
             GetGlobalConcurrencyMonitor().RecordLockRelease(LockObject, LockName); \
         } \
     } while(0)
+#else
+#define MONITOR_RESOURCE_ACCESS(Resource, Name, Pattern)
+#define MONITOR_LOCK_ACQUISITION(LockObject, LockName) do { } while(0)
+#define MONITOR_LOCK_RELEASE(LockObject, LockName) do { } while(0)
+#endif
 
 /**
  * 线程安全监控包装器模板
@@ -413,19 +525,22 @@ class TMonitoredResource
 {
 private:
     mutable T Resource;
-    FString ResourceName;
+    uint32 ResourceId;
     mutable FCSConcurrencyMonitor* Monitor;
 
 public:
     TMonitoredResource(const T& InResource, const FString& InName)
-        : Resource(InResource), ResourceName(InName), Monitor(&GetGlobalConcurrencyMonitor()) {}
+        : Resource(InResource), Monitor(&GetGlobalConcurrencyMonitor())
+    {
+        ResourceId = Monitor->InternResourceName(InName);
+    }
 
     // 读取访问
     const T& Get() const
     {
         if (Monitor->IsMonitoring())
         {
-            Monitor->RecordResourceAccess((void*)&Resource, ResourceName, FCSConcurrencyMonitor::EAccessPattern::Read);
+            Monitor->RecordResourceAccess((void*)&Resource, ResourceId, FCSConcurrencyMonitor::EAccessPattern::Read);
         }
         return Resource;
     }
@@ -435,7 +550,7 @@ public:
     {
         if (Monitor->IsMonitoring())
         {
-            Monitor->RecordResourceAccess((void*)&Resource, ResourceName, FCSConcurrencyMonitor::EAccessPattern::Write);
+            Monitor->RecordResourceAccess((void*)&Resource, ResourceId, FCSConcurrencyMonitor::EAccessPattern::Write);
         }
         return Resource;
     }
@@ -445,7 +560,7 @@ public:
     {
         if (Monitor->IsMonitoring())
         {
-            Monitor->RecordResourceAccess((void*)&Resource, ResourceName, FCSConcurrencyMonitor::EAccessPattern::ReadWrite);
+            Monitor->RecordResourceAccess((void*)&Resource, ResourceId, FCSConcurrencyMonitor::EAccessPattern::ReadWrite);
         }
         return Resource;
     }
@@ -455,7 +570,7 @@ public:
     {
         if (Monitor->IsMonitoring())
         {
-            Monitor->RecordResourceAccess((void*)&Resource, ResourceName, FCSConcurrencyMonitor::EAccessPattern::Write);
+            Monitor->RecordResourceAccess((void*)&Resource, ResourceId, FCSConcurrencyMonitor::EAccessPattern::Write);
         }
         Resource = Other;
         return *this;
@@ -466,7 +581,7 @@ public:
     {
         if (Monitor->IsMonitoring())
         {
-            Monitor->RecordResourceAccess((void*)&Resource, ResourceName, FCSConcurrencyMonitor::EAccessPattern::Read);
+            Monitor->RecordResourceAccess((void*)&Resource, ResourceId, FCSConcurrencyMonitor::EAccessPattern::Read);
         }
         return Resource == Other;
     }
@@ -1,5 +1,52 @@
 ﻿#include "CSThreadSafeManagedCallbacks.h"
 #include "Engine/Engine.h"
+#include "Containers/LockFreeList.h"
+#include "HAL/Event.h"
+
+// 等待回调槽位的调用方记录
+// 等待者和等待队列各持有一个引用，最后放手的一方把记录放回池中；记录与事件在进程内常驻复用
+struct FCSCallbackWaiter
+{
+    enum EState : int32
+    {
+        Waiting,
+        Granted,
+        Abandoned,
+        Cancelled
+    };
+
+    FEvent* Event = FPlatformProcess::GetSynchEventFromPool(false);
+    std::atomic<int32> State{Waiting};
+    std::atomic<int32> RefCount{0};
+};
+
+namespace
+{
+    TLockFreePointerListUnordered<FCSCallbackWaiter, PLATFORM_CACHE_LINE_SIZE> WaiterPool;
+
+    FCSCallbackWaiter* AllocateWaiter()
+    {
+        FCSCallbackWaiter* Waiter = WaiterPool.Pop();
+        if (!Waiter)
+        {
+            Waiter = new FCSCallbackWaiter();
+        }
+
+        // 上一次使用时可能留下未被消耗的信号
+        Waiter->Event->Reset();
+        Waiter->State.store(FCSCallbackWaiter::Waiting, std::memory_order_relaxed);
+        Waiter->RefCount.store(2, std::memory_order_relaxed);
+        return Waiter;
+    }
+
+    void ReleaseWaiter(FCSCallbackWaiter* Waiter)
+    {
+        if (Waiter->RefCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            WaiterPool.Push(Waiter);
+        }
+    }
+}
 
 // 全局实例
 static FCSThreadSafeManagedCallbacks GlobalThreadSafeManagedCallbacks;
@@ -11,7 +58,7 @@ FCSThreadSafeManagedCallbacks& GetGlobalThreadSafeManagedCallbacks()
 
 bool FCSThreadSafeManagedCallbacks::Initialize(const FConcurrencyConfig& InConfig)
 {
-    std::unique_lock<std::mutex> Lock(CallbackMutex);
+    FScopeLock Lock(&ConfigMutex);
     
     if (bIsInitialized.load(std::memory_order_relaxed))
     {
@@ -29,6 +76,10 @@ bool FCSThreadSafeManagedCallbacks::Initialize(const FConcurrencyConfig& InConfi
         FScopeLock ActiveLock(&ActiveCallbacksMutex);
         ActiveCallbackIds.Empty();
     }
+
+    // 此时还没有任何调用方能拿到槽位，可以安全地重建等待队列
+    AvailableSlots.store(FMath::Max(Config.MaxConcurrentCallbacks, 1), std::memory_order_relaxed);
+    WaitQueue.Reset(FMath::Max(Config.CallbackQueueSize, 1));
     
     bIsShuttingDown.store(false, std::memory_order_release);
     bIsInitialized.store(true, std::memory_order_release);
@@ -42,7 +93,7 @@ bool FCSThreadSafeManagedCallbacks::Initialize(const FConcurrencyConfig& InConfi
 void FCSThreadSafeManagedCallbacks::Shutdown()
 {
     {
-        std::unique_lock<std::mutex> Lock(CallbackMutex);
+        FScopeLock Lock(&ConfigMutex);
         
         if (!bIsInitialized.load(std::memory_order_relaxed))
         {
@@ -53,6 +104,9 @@ void FCSThreadSafeManagedCallbacks::Shutdown()
     }
     
     UE_LOG(LogTemp, Log, TEXT("CSThreadSafeManagedCallbacks: Shutting down callback system"));
+
+    // 排队中的调用方不会再拿到槽位
+    CancelAllWaiters();
     
     // 等待所有活跃回调完成（最多等待10秒）
     double StartTime = FPlatformTime::Seconds();
@@ -81,12 +135,12 @@ void FCSThreadSafeManagedCallbacks::Shutdown()
 
 FCSThreadSafeManagedCallbacks::ECallbackResult FCSThreadSafeManagedCallbacks::SafeCreateNewManagedObject(const void* Object, void* TypeHandle, TCHAR** Error, FGCHandleIntPtr& OutResult)
 {
-    if (!CanAcceptNewCallback())
+    FScopedCallbackTracker Tracker(*this);
+    if (!Tracker.HasSlot())
     {
-        return ECallbackResult::TooManyConcurrentCalls;
+        return Tracker.GetAdmissionResult();
     }
 
-    FScopedCallbackTracker Tracker(*this);
     double StartTime = FPlatformTime::Seconds();
 
     try
@@ -111,12 +165,12 @@ FCSThreadSafeManagedCallbacks::ECallbackResult FCSThreadSafeManagedCallbacks::Sa
 
 FCSThreadSafeManagedCallbacks::ECallbackResult FCSThreadSafeManagedCallbacks::SafeCreateNewManagedObjectWrapper(void* Object, void* TypeHandle, FGCHandleIntPtr& OutResult)
 {
-    if (!CanAcceptNewCallback())
+    FScopedCallbackTracker Tracker(*this);
+    if (!Tracker.HasSlot())
     {
-        return ECallbackResult::TooManyConcurrentCalls;
+        return Tracker.GetAdmissionResult();
     }
 
-    FScopedCallbackTracker Tracker(*this);
     double StartTime = FPlatformTime::Seconds();
 
     try
@@ -141,17 +195,17 @@ FCSThreadSafeManagedCallbacks::ECallbackResult FCSThreadSafeManagedCallbacks::Sa
 
 FCSThreadSafeManagedCallbacks::ECallbackResult FCSThreadSafeManagedCallbacks::SafeInvokeManagedEvent(void* EventPtr, void* Params, void* Result, void* Exception, void* World, int& OutResult)
 {
-    if (!CanAcceptNewCallback())
+    FScopedCallbackTracker Tracker(*this);
+    if (!Tracker.HasSlot())
     {
-        return ECallbackResult::TooManyConcurrentCalls;
+        return Tracker.GetAdmissionResult();
     }
 
-    FScopedCallbackTracker Tracker(*this);
     double StartTime = FPlatformTime::Seconds();
 
     try
     {
-        OutResult = FCSManagedCallbacks::ManagedCallbacks.InvokeManagedMethod(EventPtr, Params, Result, Exception, World);
+        OutResult = FCSManagedCallbacks::ManagedCallbacks.InvokeManagedMethod(EventPtr, Params, Result, Exception);
         
         double ElapsedTime = (FPlatformTime::Seconds() - StartTime) * 1000.0;
         
@@ -179,12 +233,12 @@ FCSThreadSafeManagedCallbacks::ECallbackResult FCSThreadSafeManagedCallbacks::Sa
 
 FCSThreadSafeManagedCallbacks::ECallbackResult FCSThreadSafeManagedCallbacks::SafeInvokeDelegate(FGCHandleIntPtr DelegateHandle, int& OutResult)
 {
-    if (!CanAcceptNewCallback())
+    FScopedCallbackTracker Tracker(*this);
+    if (!Tracker.HasSlot())
     {
-        return ECallbackResult::TooManyConcurrentCalls;
+        return Tracker.GetAdmissionResult();
     }
 
-    FScopedCallbackTracker Tracker(*this);
     double StartTime = FPlatformTime::Seconds();
 
     try
@@ -217,12 +271,12 @@ FCSThreadSafeManagedCallbacks::ECallbackResult FCSThreadSafeManagedCallbacks::Sa
 
 FCSThreadSafeManagedCallbacks::ECallbackResult FCSThreadSafeManagedCallbacks::SafeLookupMethod(void* Assembly, const TCHAR* MethodName, uint8*& OutResult)
 {
-    if (!CanAcceptNewCallback())
+    FScopedCallbackTracker Tracker(*this);
+    if (!Tracker.HasSlot())
     {
-        return ECallbackResult::TooManyConcurrentCalls;
+        return Tracker.GetAdmissionResult();
     }
 
-    FScopedCallbackTracker Tracker(*this);
     double StartTime = FPlatformTime::Seconds();
 
     try
@@ -247,12 +301,12 @@ FCSThreadSafeManagedCallbacks::ECallbackResult FCSThreadSafeManagedCallbacks::Sa
 
 FCSThreadSafeManagedCallbacks::ECallbackResult FCSThreadSafeManagedCallbacks::SafeLookupType(uint8* Assembly, const TCHAR* TypeName, uint8*& OutResult)
 {
-    if (!CanAcceptNewCallback())
+    FScopedCallbackTracker Tracker(*this);
+    if (!Tracker.HasSlot())
     {
-        return ECallbackResult::TooManyConcurrentCalls;
+        return Tracker.GetAdmissionResult();
     }
 
-    FScopedCallbackTracker Tracker(*this);
     double StartTime = FPlatformTime::Seconds();
 
     try
@@ -277,12 +331,12 @@ FCSThreadSafeManagedCallbacks::ECallbackResult FCSThreadSafeManagedCallbacks::Sa
 
 FCSThreadSafeManagedCallbacks::ECallbackResult FCSThreadSafeManagedCallbacks::SafeDispose(FGCHandleIntPtr Handle, FGCHandleIntPtr AssemblyHandle)
 {
-    if (!CanAcceptNewCallback())
+    FScopedCallbackTracker Tracker(*this);
+    if (!Tracker.HasSlot())
     {
-        return ECallbackResult::TooManyConcurrentCalls;
+        return Tracker.GetAdmissionResult();
     }
 
-    FScopedCallbackTracker Tracker(*this);
     double StartTime = FPlatformTime::Seconds();
 
     try
@@ -305,12 +359,12 @@ FCSThreadSafeManagedCallbacks::ECallbackResult FCSThreadSafeManagedCallbacks::Sa
 
 FCSThreadSafeManagedCallbacks::ECallbackResult FCSThreadSafeManagedCallbacks::SafeFreeHandle(FGCHandleIntPtr Handle)
 {
-    if (!CanAcceptNewCallback())
+    FScopedCallbackTracker Tracker(*this);
+    if (!Tracker.HasSlot())
     {
-        return ECallbackResult::TooManyConcurrentCalls;
+        return Tracker.GetAdmissionResult();
     }
 
-    FScopedCallbackTracker Tracker(*this);
     double StartTime = FPlatformTime::Seconds();
 
     try
@@ -333,8 +387,29 @@ FCSThreadSafeManagedCallbacks::ECallbackResult FCSThreadSafeManagedCallbacks::Sa
 
 void FCSThreadSafeManagedCallbacks::UpdateConfiguration(const FConcurrencyConfig& NewConfig)
 {
-    std::lock_guard<std::mutex> Lock(CallbackMutex);
+    FScopeLock Lock(&ConfigMutex);
+
+    const int32 OldMaxCallbacks = FMath::Max(Config.MaxConcurrentCallbacks, 1);
+    const int32 OldQueueSize = Config.CallbackQueueSize;
     Config = NewConfig;
+
+    // 等待队列可能正被使用，容量只在Initialize时调整
+    Config.CallbackQueueSize = OldQueueSize;
+
+    if (bIsInitialized.load(std::memory_order_acquire))
+    {
+        const int32 Delta = FMath::Max(Config.MaxConcurrentCallbacks, 1) - OldMaxCallbacks;
+        if (Delta < 0)
+        {
+            // 计数可能变为负数，正在执行的回调归还槽位时先偿还这部分
+            AvailableSlots.fetch_sub(-Delta, std::memory_order_relaxed);
+        }
+
+        for (int32 i = 0; i < Delta; ++i)
+        {
+            ReleaseCallbackSlot();
+        }
+    }
     
     UE_LOG(LogTemp, Log, TEXT("CSThreadSafeManagedCallbacks: Configuration updated"));
 }
@@ -358,6 +433,8 @@ FString FCSThreadSafeManagedCallbacks::ExportDiagnosticsReport()
     Report += FString::Printf(TEXT("Rejected Callbacks: %d\n"), Stats.RejectedCallbacks.load());
     Report += FString::Printf(TEXT("Success Rate: %.2f%%\n"), Stats.GetSuccessRate() * 100.0);
     Report += FString::Printf(TEXT("Current Active Calls: %d\n"), Stats.CurrentActiveCalls.load());
+    Report += FString::Printf(TEXT("Current Queued Calls: %d\n"), Stats.CurrentQueuedCalls.load());
+    Report += FString::Printf(TEXT("Available Slots: %d\n"), AvailableSlots.load(std::memory_order_relaxed));
     Report += FString::Printf(TEXT("Max Concurrent Calls: %d\n"), Stats.MaxConcurrentCalls.load());
     Report += FString::Printf(TEXT("Average Execution Time: %.2f ms\n"), Stats.AverageExecutionTime.load());
     Report += FString::Printf(TEXT("Max Execution Time: %.2f ms\n"), Stats.MaxExecutionTime.load());
@@ -365,11 +442,13 @@ FString FCSThreadSafeManagedCallbacks::ExportDiagnosticsReport()
     Report += TEXT("\nConfiguration:\n");
     Report += FString::Printf(TEXT("  Max Concurrent Callbacks: %d\n"), Config.MaxConcurrentCallbacks);
     Report += FString::Printf(TEXT("  Callback Timeout: %.2f seconds\n"), Config.CallbackTimeoutSeconds);
-    Report += FString::Printf(TEXT("  Queue Size: %d\n"), Config.CallbackQueueSize);
+    Report += FString::Printf(TEXT("  Queue Size: %d (capacity %d)\n"), Config.CallbackQueueSize, WaitQueue.GetCapacity());
+    Report += FString::Printf(TEXT("  Queue Wait Timeout: %.2f seconds\n"), Config.QueueWaitTimeoutSeconds);
     Report += FString::Printf(TEXT("  Statistics Enabled: %s\n"), Config.bEnableStatistics ? TEXT("Yes") : TEXT("No"));
     Report += FString::Printf(TEXT("  Timeout Enabled: %s\n"), Config.bEnableTimeout ? TEXT("Yes") : TEXT("No"));
     Report += FString::Printf(TEXT("  Slow Callback Threshold: %.2f ms\n"), Config.SlowCallbackThresholdMs);
     
+    if (Config.bTrackActiveCallbackIds)
     {
         FScopeLock ActiveLock(&ActiveCallbacksMutex);
         Report += FString::Printf(TEXT("  Active Callback IDs Count: %d\n"), ActiveCallbackIds.Num());
@@ -428,18 +507,175 @@ void FCSThreadSafeManagedCallbacks::ForceTerminateAllCallbacks()
     Stats.CurrentActiveCalls.store(0, std::memory_order_release);
 }
 
-bool FCSThreadSafeManagedCallbacks::WaitForCallbackSlot(double TimeoutSeconds)
+FCSThreadSafeManagedCallbacks::ECallbackResult FCSThreadSafeManagedCallbacks::AcquireCallbackSlot()
 {
-    std::unique_lock<std::mutex> Lock(CallbackMutex);
-    
-    auto StartTime = std::chrono::steady_clock::now();
-    auto TimeoutTime = StartTime + std::chrono::duration<double>(TimeoutSeconds);
-    
-    return CallbackCondition.wait_until(Lock, TimeoutTime, [this]()
+    if (!bIsInitialized.load(std::memory_order_acquire) || bIsShuttingDown.load(std::memory_order_acquire))
+    {
+        return ECallbackResult::SystemNotReady;
+    }
+
+    if (TryAcquireCallbackSlot())
+    {
+        return ECallbackResult::Success;
+    }
+
+    if (Config.QueueWaitTimeoutSeconds <= 0.0)
+    {
+        return ECallbackResult::TooManyConcurrentCalls;
+    }
+
+    return WaitForCallbackSlot(Config.QueueWaitTimeoutSeconds);
+}
+
+bool FCSThreadSafeManagedCallbacks::TryAcquireCallbackSlot()
+{
+    int32 Slots = AvailableSlots.load(std::memory_order_relaxed);
+    while (Slots > 0)
+    {
+        if (AvailableSlots.compare_exchange_weak(Slots, Slots - 1, std::memory_order_acquire, std::memory_order_relaxed))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+FCSThreadSafeManagedCallbacks::ECallbackResult FCSThreadSafeManagedCallbacks::WaitForCallbackSlot(double TimeoutSeconds)
+{
+    FCSCallbackWaiter* Waiter = AllocateWaiter();
+    if (!WaitQueue.TryEnqueue(Waiter))
+    {
+        // 等待队列已满，两个引用都由自己放掉
+        ReleaseWaiter(Waiter);
+        ReleaseWaiter(Waiter);
+        return ECallbackResult::TooManyConcurrentCalls;
+    }
+
+#if UNREALSHARP_WITH_DIAGNOSTICS
+    Stats.CurrentQueuedCalls.fetch_add(1, std::memory_order_relaxed);
+#endif
+
+    // 入队后再看一次槽位：释放方可能在我们入队之前看到了空队列，把槽位还给了计数
+    // 与ReleaseCallbackSlot中的栅栏配对，两边至少有一方能看到对方
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    ECallbackResult Result;
+    if (TryAcquireCallbackSlot())
+    {
+        int32 Expected = FCSCallbackWaiter::Waiting;
+        if (Waiter->State.compare_exchange_strong(Expected, FCSCallbackWaiter::Abandoned, std::memory_order_acq_rel))
+        {
+            Result = ECallbackResult::Success;
+        }
+        else
+        {
+            // 同时又被移交或取消了一个槽位，多出来的还回去
+            ReleaseCallbackSlot();
+            Result = Expected == FCSCallbackWaiter::Granted ? ECallbackResult::Success : ECallbackResult::SystemNotReady;
+        }
+    }
+    else
+    {
+        const double Deadline = FPlatformTime::Seconds() + TimeoutSeconds;
+        while (Waiter->State.load(std::memory_order_acquire) == FCSCallbackWaiter::Waiting)
+        {
+            const double RemainingSeconds = Deadline - FPlatformTime::Seconds();
+            if (RemainingSeconds <= 0.0)
+            {
+                break;
+            }
+
+            Waiter->Event->Wait(FMath::Max<uint32>(1, (uint32)(RemainingSeconds * 1000.0)));
+        }
+
+        int32 Expected = FCSCallbackWaiter::Waiting;
+        if (Waiter->State.compare_exchange_strong(Expected, FCSCallbackWaiter::Abandoned, std::memory_order_acq_rel))
+        {
+            // 放弃等待，记录留在队列里由之后的释放方丢弃
+            Result = ECallbackResult::Timeout;
+        }
+        else
+        {
+            Result = Expected == FCSCallbackWaiter::Granted ? ECallbackResult::Success : ECallbackResult::SystemNotReady;
+        }
+    }
+
+#if UNREALSHARP_WITH_DIAGNOSTICS
+    Stats.CurrentQueuedCalls.fetch_sub(1, std::memory_order_relaxed);
+#endif
+    ReleaseWaiter(Waiter);
+    return Result;
+}
+
+void FCSThreadSafeManagedCallbacks::ReleaseCallbackSlot()
+{
+    // 配置下调留下的超额槽位先偿还，不移交
+    int32 Slots = AvailableSlots.load(std::memory_order_relaxed);
+    while (Slots < 0)
+    {
+        if (AvailableSlots.compare_exchange_weak(Slots, Slots + 1, std::memory_order_release, std::memory_order_relaxed))
+        {
+            return;
+        }
+    }
+
+    for (;;)
+    {
+        FCSCallbackWaiter* Waiter = nullptr;
+        while (WaitQueue.TryDequeue(Waiter))
+        {
+            int32 Expected = FCSCallbackWaiter::Waiting;
+            const bool bGranted = Waiter->State.compare_exchange_strong(Expected, FCSCallbackWaiter::Granted, std::memory_order_acq_rel);
+            if (bGranted)
+            {
+                Waiter->Event->Trigger();
+            }
+
+            ReleaseWaiter(Waiter);
+
+            if (bGranted)
+            {
+                return;
+            }
+        }
+
+        AvailableSlots.fetch_add(1, std::memory_order_release);
+
+        // 归还后再看一次队列：等待者可能在我们看到空队列之后才入队，这时把槽位重新拿回来移交给它
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (WaitQueue.GetApproximateNum() == 0 || !TryAcquireCallbackSlot())
+        {
+            return;
+        }
+    }
+}
+
+void FCSThreadSafeManagedCallbacks::CancelAllWaiters()
+{
+    FCSCallbackWaiter* Waiter = nullptr;
+    while (WaitQueue.TryDequeue(Waiter))
     {
-        return Stats.CurrentActiveCalls.load(std::memory_order_relaxed) < Config.MaxConcurrentCallbacks ||
-               bIsShuttingDown.load(std::memory_order_relaxed);
-    });
+        int32 Expected = FCSCallbackWaiter::Waiting;
+        if (Waiter->State.compare_exchange_strong(Expected, FCSCallbackWaiter::Cancelled, std::memory_order_acq_rel))
+        {
+            Waiter->Event->Trigger();
+        }
+
+        ReleaseWaiter(Waiter);
+    }
+}
+
+uint64 FCSThreadSafeManagedCallbacks::GenerateCallbackId()
+{
+    static std::atomic<uint32> NextThreadIndex{1};
+
+    constexpr uint64 LocalCounterBits = 40;
+    thread_local const uint64 ThreadBits = (uint64)NextThreadIndex.fetch_add(1, std::memory_order_relaxed) << LocalCounterBits;
+    thread_local uint64 LocalCounter = 0;
+
+    LocalCounter = (LocalCounter + 1) & ((1ull << LocalCounterBits) - 1);
+    return ThreadBits | LocalCounter;
 }
 
 bool FCSThreadSafeManagedCallbacks::CanAcceptNewCallback() const
@@ -449,7 +685,7 @@ bool FCSThreadSafeManagedCallbacks::CanAcceptNewCallback() const
         return false;
     }
     
-    return Stats.CurrentActiveCalls.load(std::memory_order_relaxed) < Config.MaxConcurrentCallbacks;
+    return AvailableSlots.load(std::memory_order_relaxed) > 0 || WaitQueue.GetApproximateNum() < WaitQueue.GetCapacity();
 }
 
 void FCSThreadSafeManagedCallbacks::RecordCallbackResult(ECallbackResult Result, double ExecutionTimeMs)
@@ -458,10 +694,14 @@ void FCSThreadSafeManagedCallbacks::RecordCallbackResult(ECallbackResult Result,
     {
         Stats.RecordExecution(Result, ExecutionTimeMs);
     }
-    
-    // 唤醒等待的线程
-    if (Result != ECallbackResult::TooManyConcurrentCalls)
+}
+
+void FCSThreadSafeManagedCallbacks::RecordRejectedCallback(ECallbackResult Result)
+{
+#if UNREALSHARP_WITH_DIAGNOSTICS
+    if (Config.bEnableStatistics && Result != ECallbackResult::SystemNotReady)
     {
-        CallbackCondition.notify_one();
+        Stats.RejectedCallbacks.fetch_add(1, std::memory_order_relaxed);
     }
+#endif
 }
\ No newline at end of file
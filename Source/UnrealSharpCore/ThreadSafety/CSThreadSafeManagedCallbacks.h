@@ -3,15 +3,23 @@
 #include "CoreMinimal.h"
 #include "../CSManagedCallbacksCache.h"
 #include "HAL/CriticalSection.h"
+#include "CSBoundedMPMCQueue.h"
 #include <atomic>
-#include <mutex>
-#include <condition_variable>
-#include <chrono>
+
+// 由UnrealSharpCore.Build.cs定义，为0时统计信息的记录被编译移除，统计值保持为0
+#ifndef UNREALSHARP_WITH_DIAGNOSTICS
+#define UNREALSHARP_WITH_DIAGNOSTICS !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+#endif
 
 /**
  * 线程安全的托管回调管理系统
  * 提供并发控制、超时机制和回调统计功能
+ *
+ * 并发上限由一个信号量式的原子槽位计数控制，快速路径只有一次CAS。
+ * 槽位耗尽时调用方进入无锁有界等待队列，由释放槽位的线程直接把槽位移交给队首等待者并唤醒它。
  */
+struct FCSCallbackWaiter;
+
 class UNREALSHARPCORE_API FCSThreadSafeManagedCallbacks
 {
 public:
@@ -34,12 +42,14 @@ public:
         std::atomic<int32> TimeoutCallbacks{0};
         std::atomic<int32> RejectedCallbacks{0};
         std::atomic<int32> CurrentActiveCalls{0};
+        std::atomic<int32> CurrentQueuedCalls{0};
         std::atomic<int32> MaxConcurrentCalls{0};
         std::atomic<double> AverageExecutionTime{0.0};
         std::atomic<double> MaxExecutionTime{0.0};
         
         void RecordExecution(ECallbackResult Result, double ExecutionTimeMs)
         {
+#if UNREALSHARP_WITH_DIAGNOSTICS
             TotalCallbacksExecuted.fetch_add(1, std::memory_order_relaxed);
             
             switch (Result)
@@ -73,15 +83,18 @@ public:
                     MaxExecutionTime.store(ExecutionTimeMs, std::memory_order_relaxed);
                 }
             }
+#endif
         }
         
         void RecordConcurrentCall(int32 ActiveCalls)
         {
+#if UNREALSHARP_WITH_DIAGNOSTICS
             int32 CurrentMax = MaxConcurrentCalls.load(std::memory_order_relaxed);
             if (ActiveCalls > CurrentMax)
             {
                 MaxConcurrentCalls.store(ActiveCalls, std::memory_order_relaxed);
             }
+#endif
         }
         
         double GetSuccessRate() const
@@ -97,17 +110,18 @@ public:
     {
         int32 MaxConcurrentCallbacks = 64;     // 最大并发回调数量
         double CallbackTimeoutSeconds = 30.0;  // 回调超时时间
-        int32 CallbackQueueSize = 256;         // 等待队列大小
+        int32 CallbackQueueSize = 256;         // 等待队列大小，仅在Initialize时生效
         bool bEnableStatistics = true;         // 启用统计功能
         bool bEnableTimeout = true;             // 启用超时检测
+        double QueueWaitTimeoutSeconds = 1.0;  // 槽位耗尽时排队等待的最长时间，0表示直接拒绝
         bool bLogSlowCallbacks = true;          // 记录慢回调
         double SlowCallbackThresholdMs = 100.0; // 慢回调阈值
+        bool bTrackActiveCallbackIds = false;   // 调试用：记录活跃回调ID，每次回调多两次加锁
     };
 
 private:
     // 回调控制状态
-    mutable std::mutex CallbackMutex;
-    mutable std::condition_variable CallbackCondition;
+    mutable FCriticalSection ConfigMutex;
     std::atomic<bool> bIsInitialized{false};
     std::atomic<bool> bIsShuttingDown{false};
     
@@ -115,10 +129,15 @@ private:
     FCallbackStats Stats;
     FConcurrencyConfig Config;
     
-    // 活跃回调跟踪
+    // 剩余可用的回调槽位，为负表示配置下调后尚未归还的超额槽位
+    alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<int32> AvailableSlots{0};
+
+    // 等待槽位的调用方，按先来先服务移交槽位
+    TCSBoundedMPMCQueue<FCSCallbackWaiter*> WaitQueue;
+
+    // 活跃回调跟踪（仅在bTrackActiveCallbackIds开启时使用）
     TSet<uint64> ActiveCallbackIds;
     mutable FCriticalSection ActiveCallbacksMutex;
-    std::atomic<uint64> NextCallbackId{1};
 
 public:
     /**
@@ -218,32 +237,52 @@ private:
     class FScopedCallbackTracker
     {
         FCSThreadSafeManagedCallbacks& Manager;
-        uint64 CallbackId;
-        double StartTime;
+        uint64 CallbackId = 0;
+        double StartTime = 0.0;
+        ECallbackResult AdmissionResult;
+        bool bTrackedId = false;
 
     public:
         FScopedCallbackTracker(FCSThreadSafeManagedCallbacks& InManager)
             : Manager(InManager)
-            , CallbackId(InManager.NextCallbackId.fetch_add(1, std::memory_order_relaxed))
-            , StartTime(FPlatformTime::Seconds())
+            , AdmissionResult(InManager.AcquireCallbackSlot())
         {
+            if (AdmissionResult != ECallbackResult::Success)
+            {
+                Manager.RecordRejectedCallback(AdmissionResult);
+                return;
+            }
+
+            CallbackId = GenerateCallbackId();
+            StartTime = FPlatformTime::Seconds();
+
             int32 ActiveCount = Manager.Stats.CurrentActiveCalls.fetch_add(1, std::memory_order_relaxed) + 1;
             Manager.Stats.RecordConcurrentCall(ActiveCount);
             
+            if (Manager.Config.bTrackActiveCallbackIds)
             {
                 FScopeLock Lock(&Manager.ActiveCallbacksMutex);
                 Manager.ActiveCallbackIds.Add(CallbackId);
+                bTrackedId = true;
             }
         }
 
         ~FScopedCallbackTracker()
         {
+            if (!HasSlot())
+            {
+                return;
+            }
+
             Manager.Stats.CurrentActiveCalls.fetch_sub(1, std::memory_order_relaxed);
             
+            if (bTrackedId)
             {
                 FScopeLock Lock(&Manager.ActiveCallbacksMutex);
                 Manager.ActiveCallbackIds.Remove(CallbackId);
             }
+
+            Manager.ReleaseCallbackSlot();
             
             double ElapsedTime = (FPlatformTime::Seconds() - StartTime) * 1000.0;
             if (Manager.Config.bLogSlowCallbacks && ElapsedTime > Manager.Config.SlowCallbackThresholdMs)
@@ -259,12 +298,45 @@ private:
         }
 
         uint64 GetCallbackId() const { return CallbackId; }
+
+        bool HasSlot() const { return AdmissionResult == ECallbackResult::Success; }
+        ECallbackResult GetAdmissionResult() const { return AdmissionResult; }
     };
 
     /**
-     * 等待回调槽位可用
+     * 获取一个回调槽位，槽位耗尽时按配置排队等待
+     */
+    ECallbackResult AcquireCallbackSlot();
+
+    /**
+     * 无等待地尝试占用一个槽位
+     */
+    bool TryAcquireCallbackSlot();
+
+    /**
+     * 排队等待槽位移交
+     */
+    ECallbackResult WaitForCallbackSlot(double TimeoutSeconds);
+
+    /**
+     * 归还槽位，有等待者时直接移交给队首等待者
+     */
+    void ReleaseCallbackSlot();
+
+    /**
+     * 唤醒所有等待者并让它们放弃等待
+     */
+    void CancelAllWaiters();
+
+    /**
+     * 生成回调ID：高位为线程序号，低位为线程内计数，无跨线程争用
+     */
+    static uint64 GenerateCallbackId();
+
+    /**
+     * 记录被拒绝的回调
      */
-    bool WaitForCallbackSlot(double TimeoutSeconds);
+    void RecordRejectedCallback(ECallbackResult Result);
 
     /**
      * 执行带超时的回调操作
@@ -5,7 +5,6 @@
 #include "HAL/FileManager.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
-#include "Misc/Compression.h"
 #include "Misc/SecureHash.h"
 #include "Engine/Engine.h"
 
@@ -49,7 +48,7 @@ namespace UnrealSharp::iOS::ThreadSafeAssemblyCache
         // 初始化缓存映射
         {
             FScopeLock CacheLock(&CacheMutex);
-            MemoryCache.Empty();
+            EmptyMemoryCache();
             PersistentCacheIndex.Empty();
             CompiledAssemblies.Empty();
         }
@@ -83,7 +82,7 @@ namespace UnrealSharp::iOS::ThreadSafeAssemblyCache
         // 清空所有缓存
         {
             FScopeLock CacheLock(&CacheMutex);
-            MemoryCache.Empty();
+            EmptyMemoryCache();
             PersistentCacheIndex.Empty();
             CompiledAssemblies.Empty();
         }
@@ -104,13 +103,15 @@ namespace UnrealSharp::iOS::ThreadSafeAssemblyCache
         {
             FScopeLock CacheLock(&CacheMutex);
             
-            if (FCacheEntry* Found = MemoryCache.Find(AssemblyName))
+            if (FMemoryCacheSlot* Found = MemoryCache.Find(AssemblyName))
             {
-                // 更新访问统计
-                Found->LastAccessTime = FDateTime::UtcNow();
-                Found->AccessCount++;
+                // 更新访问统计，并移动到LRU链表头部
+                Found->Entry.LastAccessTime = FDateTime::UtcNow();
+                Found->Entry.AccessCount++;
+                LRUList.RemoveNode(Found->LRUNode, false);
+                LRUList.AddHead(Found->LRUNode);
                 
-                OutEntry = *Found;
+                OutEntry = Found->Entry;
                 Stats.RecordHit();
                 
                 double ElapsedTime = (FPlatformTime::Seconds() - StartTime) * 1000.0;
@@ -135,22 +136,24 @@ namespace UnrealSharp::iOS::ThreadSafeAssemblyCache
 
         if (!PersistentFilePath.IsEmpty())
         {
+            // 读取文件的同时在工作线程上解压已读取的数据块
             TArray<uint8> FileData;
-            if (FFileHelper::LoadFileToArray(FileData, *PersistentFilePath))
+            if (FCSChunkedCompression::LoadFile(PersistentFilePath, FileData))
             {
                 FCacheEntry NewEntry;
-                NewEntry.AssemblyData = FileData;
                 NewEntry.ContentHash = CalculateContentHash(FileData);
+                NewEntry.AssemblyData = MakeShared<TArray<uint8>>(MoveTemp(FileData));
                 NewEntry.LastAccessTime = FDateTime::UtcNow();
                 NewEntry.AccessCount = 1;
+                OutEntry = NewEntry;
                 
                 // 提升到L1缓存
                 {
                     FScopeLock CacheLock(&CacheMutex);
-                    MemoryCache.Add(AssemblyName, NewEntry);
+                    AddToMemoryCache(AssemblyName, MoveTemp(NewEntry));
+                    PerformLRUCleanup();
                 }
-                
-                OutEntry = NewEntry;
+
                 Stats.RecordHit();
                 
                 UE_LOG(LogTemp, VeryVerbose, TEXT("ThreadSafeiOSAssemblyCache: L2 cache hit for %s"), *AssemblyName);
@@ -173,54 +176,60 @@ namespace UnrealSharp::iOS::ThreadSafeAssemblyCache
         FScopedOperationCounter OpCounter(*this);
 
         FCacheEntry NewEntry;
-        
+        NewEntry.ContentHash = CalculateContentHash(AssemblyData);
+
+        // 相同内容已在缓存中时直接共享其数据块，无需再次压缩
+        {
+            FScopeLock CacheLock(&CacheMutex);
+            if (const FCacheBlob* Blob = BlobsByHash.Find(NewEntry.ContentHash))
+            {
+                NewEntry.AssemblyData = Blob->Data;
+                NewEntry.bIsCompressed = Blob->bIsCompressed;
+            }
+        }
+
         // 压缩数据（如果启用）
-        if (Config.bEnableCompression || bForceCompress)
+        if (!NewEntry.AssemblyData.IsValid())
         {
-            if (CompressAssemblyDataInternal(AssemblyData, NewEntry.AssemblyData))
+            TArray<uint8> CompressedData;
+            if ((Config.bEnableCompression || bForceCompress) && CompressAssemblyDataInternal(AssemblyData, CompressedData))
             {
                 NewEntry.bIsCompressed = true;
-                int32 Savings = AssemblyData.Num() - NewEntry.AssemblyData.Num();
+                int32 Savings = AssemblyData.Num() - CompressedData.Num();
                 Stats.CompressionSavings.fetch_add(Savings, std::memory_order_relaxed);
                 
                 UE_LOG(LogTemp, VeryVerbose, TEXT("ThreadSafeiOSAssemblyCache: Compressed %s: %d -> %d bytes (%.1f%% saved)"), 
-                       *AssemblyName, AssemblyData.Num(), NewEntry.AssemblyData.Num(), 
+                       *AssemblyName, AssemblyData.Num(), CompressedData.Num(), 
                        (float)Savings / AssemblyData.Num() * 100.0f);
+
+                NewEntry.AssemblyData = MakeShared<TArray<uint8>>(MoveTemp(CompressedData));
             }
             else
             {
-                NewEntry.AssemblyData = AssemblyData;
+                NewEntry.AssemblyData = MakeShared<TArray<uint8>>(AssemblyData);
                 NewEntry.bIsCompressed = false;
             }
         }
-        else
-        {
-            NewEntry.AssemblyData = AssemblyData;
-            NewEntry.bIsCompressed = false;
-        }
 
-        NewEntry.ContentHash = CalculateContentHash(AssemblyData);
         NewEntry.CreatedTime = FDateTime::UtcNow();
         NewEntry.LastAccessTime = FDateTime::UtcNow();
         NewEntry.AccessCount = 0;
 
-        // 存储到L1缓存
+        const bool bIsCompressed = NewEntry.bIsCompressed;
+        TSharedPtr<const TArray<uint8>> StoredData = NewEntry.AssemblyData;
+
+        // 存储到L1缓存，超出内存上限时进行LRU清理
         {
             FScopeLock CacheLock(&CacheMutex);
-            MemoryCache.Add(AssemblyName, NewEntry);
-            
-            // 检查是否需要LRU清理
-            if (GetCacheSizeMB() > Config.MaxMemoryCacheSize)
-            {
-                PerformLRUCleanup();
-            }
+            AddToMemoryCache(AssemblyName, MoveTemp(NewEntry));
+            PerformLRUCleanup();
         }
 
-        // 异步保存到持久化缓存
+        // 异步保存到持久化缓存，与内存缓存共享同一份数据
         FString PersistentFilePath = PersistentCachePath / (AssemblyName + TEXT(".cache"));
-        AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [PersistentFilePath, NewEntry, AssemblyName, this]()
+        AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [PersistentFilePath, StoredData, AssemblyName, this]()
         {
-            if (FFileHelper::SaveArrayToFile(NewEntry.AssemblyData, *PersistentFilePath))
+            if (FFileHelper::SaveArrayToFile(*StoredData, *PersistentFilePath))
             {
                 FScopeLock CacheLock(&CacheMutex);
                 PersistentCacheIndex.Add(AssemblyName, PersistentFilePath);
@@ -230,8 +239,8 @@ namespace UnrealSharp::iOS::ThreadSafeAssemblyCache
         });
 
         UE_LOG(LogTemp, VeryVerbose, TEXT("ThreadSafeiOSAssemblyCache: Stored %s in cache (%s, %d bytes)"), 
-               *AssemblyName, NewEntry.bIsCompressed ? TEXT("compressed") : TEXT("uncompressed"), 
-               NewEntry.AssemblyData.Num());
+               *AssemblyName, bIsCompressed ? TEXT("compressed") : TEXT("uncompressed"), 
+               StoredData->Num());
 
         return true;
     }
@@ -286,19 +295,17 @@ namespace UnrealSharp::iOS::ThreadSafeAssemblyCache
         {
             FScopeLock CacheLock(&CacheMutex);
             
-            // 清理内存缓存中过期的条目
-            TArray<FString> ExpiredKeys;
-            for (const auto& [Key, Entry] : MemoryCache)
+            // 清理内存缓存中过期的条目，LRU链表按访问时间排序，过期条目都在尾部
+            while (TDoubleLinkedList<FString>::TDoubleLinkedListNode* Tail = LRUList.GetTail())
             {
-                if (Entry.CreatedTime < ExpiryTime && Entry.LastAccessTime < ExpiryTime)
+                const FCacheEntry& Entry = MemoryCache.FindChecked(Tail->GetValue()).Entry;
+                if (Entry.CreatedTime >= ExpiryTime || Entry.LastAccessTime >= ExpiryTime)
                 {
-                    ExpiredKeys.Add(Key);
+                    break;
                 }
-            }
 
-            for (const FString& Key : ExpiredKeys)
-            {
-                MemoryCache.Remove(Key);
+                const FString Key = Tail->GetValue();
+                RemoveFromMemoryCache(Key);
                 CleanedCount++;
             }
         }
@@ -323,7 +330,7 @@ namespace UnrealSharp::iOS::ThreadSafeAssemblyCache
         
         {
             FScopeLock CacheLock(&CacheMutex);
-            MemoryCache.Empty();
+            EmptyMemoryCache();
             PersistentCacheIndex.Empty();
             CompiledAssemblies.Empty();
         }
@@ -337,14 +344,7 @@ namespace UnrealSharp::iOS::ThreadSafeAssemblyCache
     double FThreadSafeiOSAssemblyCache::GetCacheSizeMB() const
     {
         FScopeLock CacheLock(&CacheMutex);
-        
-        double TotalSize = 0;
-        for (const auto& [Key, Entry] : MemoryCache)
-        {
-            TotalSize += Entry.AssemblyData.Num();
-        }
-        
-        return TotalSize / (1024.0 * 1024.0);
+        return MemoryCacheBytes / (1024.0 * 1024.0);
     }
 
     FString FThreadSafeiOSAssemblyCache::ExportDiagnosticsReport()
@@ -364,6 +364,7 @@ namespace UnrealSharp::iOS::ThreadSafeAssemblyCache
         {
             FScopeLock CacheLock(&CacheMutex);
             Report += FString::Printf(TEXT("Memory Cache Entries: %d\n"), MemoryCache.Num());
+            Report += FString::Printf(TEXT("Memory Cache Blobs: %d\n"), BlobsByHash.Num());
             Report += FString::Printf(TEXT("Persistent Cache Entries: %d\n"), PersistentCacheIndex.Num());
             Report += FString::Printf(TEXT("Compiled Assemblies: %d\n"), CompiledAssemblies.Num());
         }
@@ -373,6 +374,8 @@ namespace UnrealSharp::iOS::ThreadSafeAssemblyCache
         Report += FString::Printf(TEXT("  Max Persistent Cache: %d MB\n"), Config.MaxPersistentCacheSize);
         Report += FString::Printf(TEXT("  Cache Expiry: %d days\n"), Config.CacheExpiryDays);
         Report += FString::Printf(TEXT("  Compression Enabled: %s\n"), Config.bEnableCompression ? TEXT("Yes") : TEXT("No"));
+        Report += FString::Printf(TEXT("  Compression Codec: %d\n"), (int32)Config.CompressionSettings.Codec);
+        Report += FString::Printf(TEXT("  Compression Chunk Size: %d KB\n"), Config.CompressionSettings.ChunkSize / 1024);
         
         return Report;
     }
@@ -384,71 +387,82 @@ namespace UnrealSharp::iOS::ThreadSafeAssemblyCache
 
     bool FThreadSafeiOSAssemblyCache::CompressAssemblyDataInternal(const TArray<uint8>& OriginalData, TArray<uint8>& CompressedData)
     {
-        int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Zlib, OriginalData.Num());
-        CompressedData.SetNumUninitialized(CompressedSize);
+        return FCSChunkedCompression::Compress(OriginalData, Config.CompressionSettings, CompressedData);
+    }
 
-        bool bSuccess = FCompression::CompressMemory(
-            NAME_Zlib,
-            CompressedData.GetData(),
-            CompressedSize,
-            OriginalData.GetData(),
-            OriginalData.Num()
-        );
+    bool FThreadSafeiOSAssemblyCache::DecompressAssemblyDataInternal(const TArray<uint8>& CompressedData, TArray<uint8>& DecompressedData)
+    {
+        // 分块压缩头记录了原始大小，无需预估
+        return FCSChunkedCompression::Decompress(CompressedData, DecompressedData);
+    }
 
-        if (bSuccess)
+    void FThreadSafeiOSAssemblyCache::PerformLRUCleanup()
+    {
+        const int64 MaxBytes = (int64)Config.MaxMemoryCacheSize * 1024 * 1024;
+        
+        // 从尾部淘汰最久未访问的条目，最近存入的条目始终保留
+        int32 Removed = 0;
+        while (MemoryCacheBytes > MaxBytes && LRUList.Num() > 1)
         {
-            CompressedData.SetNum(CompressedSize);
+            const FString Key = LRUList.GetTail()->GetValue();
+            RemoveFromMemoryCache(Key);
+            ++Removed;
+        }
+        
+        if (Removed > 0)
+        {
+            UE_LOG(LogTemp, Log, TEXT("ThreadSafeiOSAssemblyCache: LRU cleanup removed %d entries"), Removed);
         }
-
-        return bSuccess;
     }
 
-    bool FThreadSafeiOSAssemblyCache::DecompressAssemblyDataInternal(const TArray<uint8>& CompressedData, TArray<uint8>& DecompressedData)
+    void FThreadSafeiOSAssemblyCache::AddToMemoryCache(const FString& AssemblyName, FCacheEntry&& Entry)
     {
-        // 预估解压缩大小（压缩数据的3-5倍通常是安全的）
-        int32 EstimatedSize = CompressedData.Num() * 4;
-        DecompressedData.SetNumUninitialized(EstimatedSize);
+        RemoveFromMemoryCache(AssemblyName);
 
-        bool bSuccess = FCompression::UncompressMemory(
-            NAME_Zlib,
-            DecompressedData.GetData(),
-            EstimatedSize,
-            CompressedData.GetData(),
-            CompressedData.Num()
-        );
-
-        if (bSuccess)
+        if (FCacheBlob* Blob = BlobsByHash.Find(Entry.ContentHash))
+        {
+            // 其他线程可能已存入相同内容
+            Entry.AssemblyData = Blob->Data;
+            Entry.bIsCompressed = Blob->bIsCompressed;
+            Blob->NumEntries++;
+        }
+        else
         {
-            DecompressedData.SetNum(EstimatedSize);
+            MemoryCacheBytes += Entry.AssemblyData->Num();
+            BlobsByHash.Add(Entry.ContentHash, FCacheBlob{ Entry.AssemblyData.ToSharedRef(), Entry.bIsCompressed, 1 });
         }
 
-        return bSuccess;
+        LRUList.AddHead(AssemblyName);
+
+        FMemoryCacheSlot& Slot = MemoryCache.Add(AssemblyName);
+        Slot.Entry = MoveTemp(Entry);
+        Slot.LRUNode = LRUList.GetHead();
     }
 
-    void FThreadSafeiOSAssemblyCache::PerformLRUCleanup()
+    void FThreadSafeiOSAssemblyCache::RemoveFromMemoryCache(const FString& AssemblyName)
     {
-        // LRU清理逻辑 - 删除最少访问和最旧的条目
-        TArray<TPair<FString, FDateTime>> AccessTimes;
-        
-        for (const auto& [Key, Entry] : MemoryCache)
+        FMemoryCacheSlot Slot;
+        if (!MemoryCache.RemoveAndCopyValue(AssemblyName, Slot))
         {
-            AccessTimes.Emplace(Key, Entry.LastAccessTime);
+            return;
         }
-        
-        // 按访问时间排序
-        AccessTimes.Sort([](const TPair<FString, FDateTime>& A, const TPair<FString, FDateTime>& B)
-        {
-            return A.Value < B.Value;
-        });
-        
-        // 删除最旧的25%条目
-        int32 ToRemove = FMath::Max(1, AccessTimes.Num() / 4);
-        for (int32 i = 0; i < ToRemove; ++i)
+
+        LRUList.RemoveNode(Slot.LRUNode);
+
+        FCacheBlob& Blob = BlobsByHash.FindChecked(Slot.Entry.ContentHash);
+        if (--Blob.NumEntries == 0)
         {
-            MemoryCache.Remove(AccessTimes[i].Key);
+            MemoryCacheBytes -= Blob.Data->Num();
+            BlobsByHash.Remove(Slot.Entry.ContentHash);
         }
-        
-        UE_LOG(LogTemp, Log, TEXT("ThreadSafeiOSAssemblyCache: LRU cleanup removed %d entries"), ToRemove);
+    }
+
+    void FThreadSafeiOSAssemblyCache::EmptyMemoryCache()
+    {
+        MemoryCache.Empty();
+        BlobsByHash.Empty();
+        LRUList.Empty();
+        MemoryCacheBytes = 0;
     }
 
     int32 FThreadSafeiOSAssemblyCache::ValidateCacheIntegrity()
@@ -458,16 +472,20 @@ namespace UnrealSharp::iOS::ThreadSafeAssemblyCache
         
         FScopeLock CacheLock(&CacheMutex);
         
-        // 验证内存缓存完整性
-        for (const auto& [Key, Entry] : MemoryCache)
+        // 检查数据块哈希值，共享的数据块只校验一次。压缩数据块以原始数据的哈希为键，无法直接校验
+        for (const auto& [Hash, Blob] : BlobsByHash)
         {
-            // 检查哈希值
-            FString CalculatedHash = CalculateContentHash(Entry.AssemblyData);
-            if (CalculatedHash != Entry.ContentHash)
+            if (!Blob.bIsCompressed && CalculateContentHash(*Blob.Data) != Hash)
             {
-                UE_LOG(LogTemp, Error, TEXT("ThreadSafeiOSAssemblyCache: Hash mismatch for %s"), *Key);
+                UE_LOG(LogTemp, Error, TEXT("ThreadSafeiOSAssemblyCache: Hash mismatch for blob %s"), *Hash);
                 Issues++;
             }
+        }
+        
+        // 验证内存缓存完整性
+        for (const auto& [Key, Slot] : MemoryCache)
+        {
+            const FCacheEntry& Entry = Slot.Entry;
             
             // 检查时间戳
             if (Entry.CreatedTime > Entry.LastAccessTime)
@@ -2,6 +2,8 @@
 
 #include "CoreMinimal.h"
 #include "HAL/CriticalSection.h"
+#include "Containers/List.h"
+#include "Utils/CSChunkedCompression.h"
 #include <atomic>
 #include <mutex>
 
@@ -16,7 +18,8 @@ namespace UnrealSharp::iOS::ThreadSafeAssemblyCache
     // 缓存条目结构
     struct FCacheEntry
     {
-        TArray<uint8> AssemblyData;
+        // 相同内容的条目共享同一份数据
+        TSharedPtr<const TArray<uint8>> AssemblyData;
         FString ContentHash;
         FDateTime CreatedTime;
         FDateTime LastAccessTime;
@@ -72,6 +75,8 @@ namespace UnrealSharp::iOS::ThreadSafeAssemblyCache
         int32 MaxPersistentCacheSize = 256; // MB
         int32 CacheExpiryDays = 7;
         bool bEnableCompression = true;
+        // 分块压缩的编解码器、压缩级别和块大小
+        FCSChunkedCompressionSettings CompressionSettings;
         int32 MaxConcurrentOperations = 32;
         double OperationTimeoutSeconds = 30.0;
     };
@@ -82,8 +87,28 @@ namespace UnrealSharp::iOS::ThreadSafeAssemblyCache
     class UNREALSHARPCORE_API FThreadSafeiOSAssemblyCache
     {
     private:
+        // 按内容哈希存储的数据块，同一版本的程序集在多次重载之间共享同一份缓冲区
+        struct FCacheBlob
+        {
+            TSharedRef<const TArray<uint8>> Data;
+            bool bIsCompressed;
+            int32 NumEntries;
+        };
+
+        // 内存缓存槽位，LRUNode 指向 LRUList 中的节点
+        struct FMemoryCacheSlot
+        {
+            FCacheEntry Entry;
+            TDoubleLinkedList<FString>::TDoubleLinkedListNode* LRUNode = nullptr;
+        };
+
         // 缓存数据 - 受锁保护
-        TMap<FString, FCacheEntry> MemoryCache;
+        TMap<FString, FMemoryCacheSlot> MemoryCache;
+        TMap<FString, FCacheBlob> BlobsByHash;
+        // 头部为最近访问的条目，尾部为下一个被淘汰的条目
+        TDoubleLinkedList<FString> LRUList;
+        // 内存缓存中所有数据块的总字节数，共享的数据块只计算一次
+        int64 MemoryCacheBytes = 0;
         TMap<FString, FString> PersistentCacheIndex;
         TMap<FString, MonoAssembly*> CompiledAssemblies;
         
@@ -208,10 +233,25 @@ namespace UnrealSharp::iOS::ThreadSafeAssemblyCache
         FString CalculateContentHash(const TArray<uint8>& AssemblyData);
 
         /**
-         * LRU清理策略
+         * LRU清理策略，从链表尾部淘汰条目直到低于内存上限（需要持有 CacheMutex）
          */
         void PerformLRUCleanup();
 
+        /**
+         * 添加或替换内存缓存条目，并引用对应的数据块（需要持有 CacheMutex）
+         */
+        void AddToMemoryCache(const FString& AssemblyName, FCacheEntry&& Entry);
+
+        /**
+         * 移除内存缓存条目，数据块不再被引用时释放（需要持有 CacheMutex）
+         */
+        void RemoveFromMemoryCache(const FString& AssemblyName);
+
+        /**
+         * 清空内存缓存、数据块和LRU链表（需要持有 CacheMutex）
+         */
+        void EmptyMemoryCache();
+
         /**
          * 并发操作计数器
          */
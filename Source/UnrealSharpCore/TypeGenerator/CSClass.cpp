@@ -1,6 +1,15 @@
 ﻿#include "CSClass.h"
 #include "UnrealSharpCore.h"
 #include "Register/TypeInfo/CSClassInfo.h"
+#include "Utils/CSClassUtilities.h"
+#include "Register/MetaData/CSClassMetaData.h"
+#include "UObject/CoreNet.h"
+
+static FName GetManagedHandlePropertyName()
+{
+	static FName ManagedHandlePropertyName(TEXT("__ManagedHandle"));
+	return ManagedHandlePropertyName;
+}
 
 #if WITH_EDITOR
 void UCSClass::PostDuplicate(bool bDuplicateForPIE)
@@ -23,3 +32,102 @@ void UCSClass::PostDuplicate(bool bDuplicateForPIE)
 	SetTypeInfo(ManagedClass->GetManagedTypeInfo<FCSClassInfo>());
 }
 #endif
+
+void UCSClass::TryAddManagedHandleProperty(UClass* Class)
+{
+	static_assert(sizeof(FGCHandle*) == sizeof(uint64), "The cached handle is stored in a uint64 property.");
+
+	UClass* SuperClass = Class->GetSuperClass();
+	if (IsValid(SuperClass) && SuperClass->FindPropertyByName(GetManagedHandlePropertyName()))
+	{
+		return;
+	}
+
+	// Not serialized, duplicated or copied from archetypes. It's repopulated when the handle is first looked up,
+	// and cleared by UCSManager::ClearCachedManagedHandles before the store the handle lives in is released.
+	FUInt64Property* HandleProperty = new FUInt64Property(Class, GetManagedHandlePropertyName(), RF_Public);
+	HandleProperty->SetPropertyFlags(CPF_Transient | CPF_DuplicateTransient | CPF_NonPIEDuplicateTransient | CPF_SkipSerialization | CPF_TextExportTransient);
+	Class->AddCppProperty(HandleProperty);
+}
+
+void UCSClass::UpdateManagedHandleOffset()
+{
+	const FProperty* HandleProperty = FindPropertyByName(GetManagedHandlePropertyName());
+	ManagedHandleOffset = HandleProperty ? HandleProperty->GetOffset_ForInternal() : INDEX_NONE;
+}
+
+void UCSClass::MarkPushBasedProperties(const UClass* Class, TArray<FLifetimeProperty>& LifetimeProperties)
+{
+#if WITH_PUSH_MODEL
+	for (FLifetimeProperty& LifetimeProperty : LifetimeProperties)
+	{
+		if (LifetimeProperty.bIsPushBased || !Class->ClassReps.IsValidIndex(LifetimeProperty.RepIndex))
+		{
+			continue;
+		}
+
+		const FProperty* Property = Class->ClassReps[LifetimeProperty.RepIndex].Property;
+		const UCSClass* OwnerClass = Cast<UCSClass>(Property->GetOwnerClass());
+		if (!OwnerClass || !OwnerClass->HasTypeInfo())
+		{
+			continue;
+		}
+
+		const FName PropertyName = Property->GetFName();
+		LifetimeProperty.bIsPushBased = OwnerClass->GetTypeMetaData<FCSClassMetaData>()->Properties.ContainsByPredicate([PropertyName](const FCSPropertyMetaData& PropertyMetaData)
+		{
+			return PropertyMetaData.bIsPushBased && PropertyMetaData.Name == PropertyName;
+		});
+	}
+#endif
+}
+
+void UCSClass::UpdateNonZeroInitializedProperties()
+{
+	NonZeroInitializedProperties.Reset();
+
+	for (TFieldIterator<FProperty> PropertyIt(this); PropertyIt; ++PropertyIt)
+	{
+		const FProperty* Property = *PropertyIt;
+
+		if (!FCSClassUtilities::IsManagedClass(Property->GetOwnerClass()))
+		{
+			// Properties of native classes are initialized by the native constructor
+			break;
+		}
+
+		if (Property->HasAnyPropertyFlags(CPF_ZeroConstructor))
+		{
+			continue;
+		}
+
+		NonZeroInitializedProperties.Add({ Property, Property->GetOffset_ForInternal() });
+	}
+
+	NonZeroInitializedProperties.Shrink();
+}
+
+void UCSClass::UpdateCanCreateManagedObjectLazily()
+{
+	bCanCreateManagedObjectLazily = true;
+
+	for (const UCSClass* ManagedClass = this; ManagedClass; ManagedClass = Cast<UCSClass>(ManagedClass->GetSuperClass()))
+	{
+		if (!ManagedClass->HasTypeInfo() || !ManagedClass->GetTypeMetaData<FCSClassMetaData>()->bHasTrivialConstructor)
+		{
+			bCanCreateManagedObjectLazily = false;
+			return;
+		}
+	}
+}
+
+void UCSClass::CacheManagedHandle(UObject* Object, FGCHandle* Handle) const
+{
+	// Archetypes are copied into new instances, they must never point at their own counterpart.
+	if (ManagedHandleOffset == INDEX_NONE || Object->HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
+	{
+		return;
+	}
+
+	*reinterpret_cast<FGCHandle**>(reinterpret_cast<uint8*>(Object) + ManagedHandleOffset) = Handle;
+}
@@ -5,6 +5,17 @@
 #include "Engine/BlueprintGeneratedClass.h"
 #include "CSClass.generated.h"
 
+struct FGCHandle;
+struct FCSDefaultComponentMetaData;
+class UCSFunctionBase;
+
+// A property of a managed class that must be initialized in place on construction, because it isn't zero constructed.
+struct FCSNonZeroInitializedProperty
+{
+	const FProperty* Property;
+	int32 Offset;
+};
+
 UCLASS()
 class UNREALSHARPCORE_API UCSClass : public UBlueprintGeneratedClass, public ICSManagedTypeInterface
 {
@@ -15,4 +26,72 @@ public:
 	virtual void PostDuplicate(bool bDuplicateForPIE) override;
 	// End of UObject interface
 #endif
-};
\ No newline at end of file
+
+	// Adds the hidden property that caches the C# counterpart on each instance, unless a super class already has one.
+	static void TryAddManagedHandleProperty(UClass* Class);
+
+	// Resolves where the cached handle lives in the instances. Call after the class has been linked.
+	void UpdateManagedHandleOffset();
+
+	FGCHandle* GetCachedManagedHandle(const UObject* Object) const
+	{
+		if (ManagedHandleOffset == INDEX_NONE)
+		{
+			return nullptr;
+		}
+
+		return *reinterpret_cast<FGCHandle* const*>(reinterpret_cast<const uint8*>(Object) + ManagedHandleOffset);
+	}
+
+	void CacheManagedHandle(UObject* Object, FGCHandle* Handle) const;
+
+	// Registers the replicated properties declared as push based in C# with bIsPushBased. Native classes that C# classes
+	// derive from can call this at the end of their GetLifetimeReplicatedProps to get push model for the managed properties.
+	static void MarkPushBasedProperties(const UClass* Class, TArray<FLifetimeProperty>& LifetimeProperties);
+
+	// Collects the properties ManagedObjectConstructor has to initialize. Call after the class has been linked.
+	void UpdateNonZeroInitializedProperties();
+
+	// Initializes the properties of this class and its managed super classes that aren't zero constructed, such as FText.
+	void InitializeNonZeroInitializedProperties(UObject* Object) const
+	{
+		for (const FCSNonZeroInitializedProperty& NonZeroInitializedProperty : NonZeroInitializedProperties)
+		{
+			NonZeroInitializedProperty.Property->InitializeValue(reinterpret_cast<uint8*>(Object) + NonZeroInitializedProperty.Offset);
+		}
+	}
+
+	// Caches whether the C# default constructors of this class and its managed super classes leave the native object alone. Call after the class has been linked.
+	void UpdateCanCreateManagedObjectLazily();
+
+	// Whether the C# counterpart of an instance can wait until it's first used, without changing the state of the native object.
+	bool CanCreateManagedObjectLazily() const { return bCanCreateManagedObjectLazily; }
+
+	// The ReceiveTick override that FCSBatchedTick calls for instances of a [BatchedTick] class. Null for classes that tick normally.
+	UCSFunctionBase* GetBatchedTickFunction() const { return BatchedTickFunction; }
+	ETickingGroup GetBatchedTickGroup() const { return BatchedTickGroup; }
+
+	void SetBatchedTick(UCSFunctionBase* InBatchedTickFunction, ETickingGroup InBatchedTickGroup)
+	{
+		BatchedTickFunction = InBatchedTickFunction;
+		BatchedTickGroup = InBatchedTickGroup;
+	}
+
+	// The default component metadata the construction script was last built from, by component name.
+	TMap<FName, TSharedPtr<FCSDefaultComponentMetaData>>& GetBuiltDefaultComponents() { return BuiltDefaultComponents; }
+
+private:
+	// Empty for classes where every managed property is zero constructed, which is most of them.
+	TArray<FCSNonZeroInitializedProperty> NonZeroInitializedProperties;
+
+	// Offset of the cached handle in instances of this class. INDEX_NONE if the class wasn't built with one.
+	int32 ManagedHandleOffset = INDEX_NONE;
+
+	bool bCanCreateManagedObjectLazily = false;
+
+	// Owned by this class or a managed super class, which outlives it.
+	UCSFunctionBase* BatchedTickFunction = nullptr;
+	ETickingGroup BatchedTickGroup = TG_PrePhysics;
+
+	TMap<FName, TSharedPtr<FCSDefaultComponentMetaData>> BuiltDefaultComponents;
+};
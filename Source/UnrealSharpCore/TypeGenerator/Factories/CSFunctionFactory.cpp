@@ -5,8 +5,10 @@
 #include "UnrealSharpCore/TypeGenerator/Register/CSMetaDataUtils.h"
 #include "TypeGenerator/Functions/CSFunction_Params.h"
 #include "UnrealSharpUtilities/UnrealSharpUtils.h"
+#include "TypeGenerator/CSClass.h"
+#include "TypeGenerator/Register/TypeInfo/CSClassInfo.h"
 
-UCSFunctionBase* FCSFunctionFactory::CreateFunction(UClass* Outer, const FName& Name, const FCSFunctionMetaData& FunctionMetaData, EFunctionFlags FunctionFlags, UStruct* ParentFunction)
+UCSFunctionBase* FCSFunctionFactory::CreateFunction(UClass* Outer, const FName& Name, const FCSFunctionMetaData& FunctionMetaData, EFunctionFlags FunctionFlags, UStruct* ParentFunction, const FMethodHandles* MethodHandles)
 {
 	UCSFunctionBase* NewFunction = NewObject<UCSFunctionBase>(Outer, UCSFunctionBase::StaticClass(), Name, RF_Public);
 	NewFunction->FunctionFlags = FunctionMetaData.FunctionFlags | FunctionFlags;
@@ -17,6 +19,11 @@ UCSFunctionBase* FCSFunctionFactory::CreateFunction(UClass* Outer, const FName&
 	}
 	
 	NewFunction->SetSuperStruct(ParentFunction);
+
+	if (MethodHandles)
+	{
+		NewFunction->SetMethodHandle(MethodHandles->FindRef(Name));
+	}
 	
 	if (!NewFunction->TryUpdateMethodHandle())
 	{
@@ -61,9 +68,9 @@ void FCSFunctionFactory::CreateParameters(UFunction* Function, const FCSFunction
 	}
 }
 
-UCSFunctionBase* FCSFunctionFactory::CreateFunctionFromMetaData(UClass* Outer, const FCSFunctionMetaData& FunctionMetaData)
+UCSFunctionBase* FCSFunctionFactory::CreateFunctionFromMetaData(UClass* Outer, const FCSFunctionMetaData& FunctionMetaData, const FMethodHandles* MethodHandles)
 {
-	UCSFunctionBase* NewFunction = CreateFunction(Outer, FunctionMetaData.Name, FunctionMetaData);
+	UCSFunctionBase* NewFunction = CreateFunction(Outer, FunctionMetaData.Name, FunctionMetaData, FUNC_None, nullptr, MethodHandles);
 
 	if (!NewFunction)
 	{
@@ -75,10 +82,10 @@ UCSFunctionBase* FCSFunctionFactory::CreateFunctionFromMetaData(UClass* Outer, c
 	return NewFunction;
 }
 
-UCSFunctionBase* FCSFunctionFactory::CreateOverriddenFunction(UClass* Outer, UFunction* ParentFunction)
+UCSFunctionBase* FCSFunctionFactory::CreateOverriddenFunction(UClass* Outer, UFunction* ParentFunction, const FMethodHandles* MethodHandles)
 {
 	const EFunctionFlags FunctionFlags = ParentFunction->FunctionFlags & (FUNC_FuncInherit | FUNC_Public | FUNC_Protected | FUNC_Private | FUNC_BlueprintPure | FUNC_HasOutParms);
-	UCSFunctionBase* NewFunction = CreateFunction(Outer, ParentFunction->GetFName(), FCSFunctionMetaData(), FunctionFlags, ParentFunction);
+	UCSFunctionBase* NewFunction = CreateFunction(Outer, ParentFunction->GetFName(), FCSFunctionMetaData(), FunctionFlags, ParentFunction, MethodHandles);
 	
 	TArray<FProperty*> FunctionProperties;
 	for (TFieldIterator<FProperty> PropIt(ParentFunction); PropIt && PropIt->PropertyFlags & CPF_Parm; ++PropIt)
@@ -121,16 +128,11 @@ void FCSFunctionFactory::FinalizeFunctionSetup(UClass* Outer, UCSFunctionBase* F
 	Function->FunctionFlags |= FUNC_Native;
 	Function->StaticLink(true);
 	
-	if (Function->NumParms == 0)
-	{
-		Outer->AddNativeFunction(*Function->GetName(), &UCSFunctionBase::InvokeManagedMethod);
-	}
-	else
-	{
-		Outer->AddNativeFunction(*Function->GetName(), &UCSFunction_Params::InvokeManagedMethod_Params);
-	}
-	
-	Function->Bind();
+	const FNativeFuncPtr NativeFunc = Function->NumParms == 0 ? &UCSFunctionBase::InvokeManagedMethod : &UCSFunction_Params::InvokeManagedMethod_Params;
+	Outer->AddNativeFunction(*Function->GetName(), NativeFunc);
+
+	// We know the pointer we just registered, no need for Bind to search the lookup table for it.
+	Function->SetNativeFunc(NativeFunc);
 	Outer->AddFunctionToFunctionMap(Function, Function->GetFName());
 }
 
@@ -190,22 +192,55 @@ void FCSFunctionFactory::GetOverriddenFunctions(const UClass* Outer, const TShar
 	}
 }
 
-void FCSFunctionFactory::GenerateVirtualFunctions(UClass* Outer, const TSharedPtr<const FCSClassMetaData>& ClassMetaData)
+void FCSFunctionFactory::GenerateVirtualFunctions(UClass* Outer, const TSharedPtr<const FCSClassMetaData>& ClassMetaData, const FMethodHandles* MethodHandles)
 {
 	TArray<UFunction*> VirtualFunctions;
 	GetOverriddenFunctions(Outer, ClassMetaData, VirtualFunctions);
 	
 	for (UFunction* VirtualFunction : VirtualFunctions)
 	{
-		CreateOverriddenFunction(Outer, VirtualFunction);
+		CreateOverriddenFunction(Outer, VirtualFunction, MethodHandles);
 	}
 }
 
-void FCSFunctionFactory::GenerateFunctions(UClass* Outer, const TArray<FCSFunctionMetaData>& FunctionsMetaData)
+void FCSFunctionFactory::GenerateFunctions(UClass* Outer, const TArray<FCSFunctionMetaData>& FunctionsMetaData, const FMethodHandles* MethodHandles)
 {
 	for (const FCSFunctionMetaData& FunctionMetaData : FunctionsMetaData)
 	{
-		CreateFunctionFromMetaData(Outer, FunctionMetaData);
+		CreateFunctionFromMetaData(Outer, FunctionMetaData, MethodHandles);
+	}
+}
+
+void FCSFunctionFactory::ResolveMethodHandles(UCSClass* Outer, const TSharedPtr<const FCSClassMetaData>& ClassMetaData, FMethodHandles& OutMethodHandles)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FCSFunctionFactory::ResolveMethodHandles);
+	
+	TArray<FName> FunctionNames;
+	FunctionNames.Reserve(ClassMetaData->VirtualFunctions.Num() + ClassMetaData->Functions.Num());
+	FunctionNames.Append(ClassMetaData->VirtualFunctions);
+	
+	for (const FCSFunctionMetaData& FunctionMetaData : ClassMetaData->Functions)
+	{
+		FunctionNames.Add(FunctionMetaData.Name);
+	}
+
+	if (FunctionNames.IsEmpty())
+	{
+		return;
+	}
+
+	TSharedPtr<FCSClassInfo> ClassInfo = Outer->GetManagedTypeInfo<FCSClassInfo>();
+	
+	TArray<FGCHandle*> MethodHandles;
+	Outer->GetOwningAssembly()->GetManagedMethods(ClassInfo->GetManagedTypeHandle(), FunctionNames, MethodHandles);
+
+	OutMethodHandles.Reserve(FunctionNames.Num());
+	for (int32 i = 0; i < FunctionNames.Num(); ++i)
+	{
+		if (MethodHandles[i])
+		{
+			OutMethodHandles.Add(FunctionNames[i], MethodHandles[i]);
+		}
 	}
 }
 
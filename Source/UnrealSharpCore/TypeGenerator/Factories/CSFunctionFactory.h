@@ -4,18 +4,26 @@
 #include "TypeGenerator/Register/MetaData/CSClassMetaData.h"
 
 class UCSBlueprint;
+class UCSClass;
 class UClass;
 
 class UNREALSHARPCORE_API FCSFunctionFactory
 {
 public:
 	
-	static UCSFunctionBase* CreateFunctionFromMetaData(UClass* Outer, const FCSFunctionMetaData& FunctionMetaData);
-	static UCSFunctionBase* CreateOverriddenFunction(UClass* Outer, UFunction* ParentFunction);
+	// Method handles resolved up front by ResolveMethodHandles, keyed by function name.
+	// Functions missing from it look up their method on their own.
+	using FMethodHandles = TMap<FName, FGCHandle*>;
+	
+	static UCSFunctionBase* CreateFunctionFromMetaData(UClass* Outer, const FCSFunctionMetaData& FunctionMetaData, const FMethodHandles* MethodHandles = nullptr);
+	static UCSFunctionBase* CreateOverriddenFunction(UClass* Outer, UFunction* ParentFunction, const FMethodHandles* MethodHandles = nullptr);
 	
 	static void GetOverriddenFunctions(const UClass* Outer, const TSharedPtr<const FCSClassMetaData>& ClassMetaData, TArray<UFunction*>& VirtualFunctions);
-	static void GenerateVirtualFunctions(UClass* Outer, const TSharedPtr<const FCSClassMetaData>& ClassMetaData);
-	static void GenerateFunctions(UClass* Outer, const TArray<FCSFunctionMetaData>& FunctionsMetaData);
+	static void GenerateVirtualFunctions(UClass* Outer, const TSharedPtr<const FCSClassMetaData>& ClassMetaData, const FMethodHandles* MethodHandles = nullptr);
+	static void GenerateFunctions(UClass* Outer, const TArray<FCSFunctionMetaData>& FunctionsMetaData, const FMethodHandles* MethodHandles = nullptr);
+
+	// Looks up the C# methods of all functions and overrides of the class in a single call into C#.
+	static void ResolveMethodHandles(UCSClass* Outer, const TSharedPtr<const FCSClassMetaData>& ClassMetaData, FMethodHandles& OutMethodHandles);
 
 	static void AddFunctionToOuter(UClass* Outer, UCSFunctionBase* Function);
 
@@ -24,7 +32,8 @@ public:
 		const FName& Name,
 		const FCSFunctionMetaData& FunctionMetaData,
 		EFunctionFlags FunctionFlags = FUNC_None,
-		UStruct* ParentFunction = nullptr);
+		UStruct* ParentFunction = nullptr,
+		const FMethodHandles* MethodHandles = nullptr);
 
 	static void FinalizeFunctionSetup(UClass* Outer, UCSFunctionBase* Function);
 	
@@ -9,6 +9,7 @@
 #include "UnrealSharpUtilities/UnrealSharpUtils.h"
 
 TArray<TObjectPtr<UCSPropertyGenerator>> FCSPropertyFactory::PropertyGenerators;
+UCSPropertyGenerator* FCSPropertyFactory::PropertyGeneratorsByType[NumPropertyTypes] = {};
 
 void FCSPropertyFactory::Initialize()
 {
@@ -26,6 +27,21 @@ void FCSPropertyFactory::Initialize()
 	{
 		PropertyGenerators.Add(PropertyGenerator);
 	}
+
+	for (int32 TypeIndex = 0; TypeIndex < NumPropertyTypes; ++TypeIndex)
+	{
+		const ECSPropertyType PropertyType = static_cast<ECSPropertyType>(TypeIndex);
+
+		// The first generator that supports a type wins, same as when they were asked one by one.
+		for (UCSPropertyGenerator* PropertyGenerator : PropertyGenerators)
+		{
+			if (PropertyGenerator->SupportsPropertyType(PropertyType))
+			{
+				PropertyGeneratorsByType[TypeIndex] = PropertyGenerator;
+				break;
+			}
+		}
+	}
 }
 
 FProperty* FCSPropertyFactory::CreateProperty(UField* Outer, const FCSPropertyMetaData& PropertyMetaData)
@@ -37,21 +53,21 @@ FProperty* FCSPropertyFactory::CreateProperty(UField* Outer, const FCSPropertyMe
 	NewProperty->SetBlueprintReplicationCondition(PropertyMetaData.LifetimeCondition);
 
 #if WITH_EDITOR
-	if (!PropertyMetaData.BlueprintSetter.IsEmpty())
+	if (!PropertyMetaData.BlueprintSetter.IsNone())
 	{
-		NewProperty->SetMetaData("BlueprintSetter", *PropertyMetaData.BlueprintSetter);
+		NewProperty->SetMetaData("BlueprintSetter", *PropertyMetaData.BlueprintSetter.ToString());
 
-		if (UFunction* BlueprintSetterFunction = CastChecked<UClass>(Outer)->FindFunctionByName(*PropertyMetaData.BlueprintSetter))
+		if (UFunction* BlueprintSetterFunction = CastChecked<UClass>(Outer)->FindFunctionByName(PropertyMetaData.BlueprintSetter))
 		{
 			BlueprintSetterFunction->SetMetaData("BlueprintInternalUseOnly", TEXT("true"));
 		}
 	}
 
-	if (!PropertyMetaData.BlueprintGetter.IsEmpty())
+	if (!PropertyMetaData.BlueprintGetter.IsNone())
 	{
-		NewProperty->SetMetaData("BlueprintGetter", *PropertyMetaData.BlueprintGetter);
+		NewProperty->SetMetaData("BlueprintGetter", *PropertyMetaData.BlueprintGetter.ToString());
 			
-		if (UFunction* BlueprintGetterFunction = CastChecked<UClass>(Outer)->FindFunctionByName(*PropertyMetaData.BlueprintGetter))
+		if (UFunction* BlueprintGetterFunction = CastChecked<UClass>(Outer)->FindFunctionByName(PropertyMetaData.BlueprintGetter))
 		{
 			BlueprintGetterFunction->SetMetaData("BlueprintInternalUseOnly", TEXT("true"));
 		}
@@ -100,10 +116,10 @@ void FCSPropertyFactory::CreateAndAssignProperties(UField* Outer, const TArray<F
 	}
 }
 
-TSharedPtr<FCSUnrealType> FCSPropertyFactory::CreateTypeMetaData(const TSharedPtr<FJsonObject>& PropertyMetaData)
+TSharedPtr<FCSUnrealType> FCSPropertyFactory::CreateTypeMetaData(const FCSMetaDataView& PropertyMetaData)
 {
-	const TSharedPtr<FJsonObject>& PropertyTypeObject = PropertyMetaData->GetObjectField(TEXT("PropertyDataType"));
-	ECSPropertyType PropertyType = static_cast<ECSPropertyType>(PropertyTypeObject->GetIntegerField(TEXT("PropertyType")));
+	const FCSMetaDataView PropertyTypeObject = PropertyMetaData.GetObjectField(TEXT("PropertyDataType"));
+	ECSPropertyType PropertyType = static_cast<ECSPropertyType>(PropertyTypeObject.GetIntegerField(TEXT("PropertyType")));
 	
 	UCSPropertyGenerator* PropertyGenerator = FindPropertyGenerator(PropertyType);
 	TSharedPtr<FCSUnrealType> PropertiesMetaData = PropertyGenerator->CreateTypeMetaData(PropertyType);
@@ -114,17 +130,7 @@ TSharedPtr<FCSUnrealType> FCSPropertyFactory::CreateTypeMetaData(const TSharedPt
 
 UCSPropertyGenerator* FCSPropertyFactory::FindPropertyGenerator(ECSPropertyType PropertyType)
 {
-	for (TObjectPtr<UCSPropertyGenerator>& PropertyGenerator : PropertyGenerators)
-	{
-		if (!PropertyGenerator->SupportsPropertyType(PropertyType))
-		{
-			continue;
-		}
-
-		return PropertyGenerator;
-	}
-	
-	return nullptr;
+	return PropertyGeneratorsByType[static_cast<uint8>(PropertyType)];
 }
 
 void FCSPropertyFactory::TryAddPropertyAsFieldNotify(const FCSPropertyMetaData& PropertyMetaData, UBlueprintGeneratedClass* Class)
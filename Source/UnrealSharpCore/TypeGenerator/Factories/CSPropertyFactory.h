@@ -18,10 +18,14 @@ public:
 	static FProperty* CreateAndAssignProperty(UField* Outer, const FCSPropertyMetaData& PropertyMetaData);
 	static void CreateAndAssignProperties(UField* Outer, const TArray<FCSPropertyMetaData>& PropertyMetaData, const TFunction<void(FProperty*)>& OnPropertyCreated = nullptr);
 	
-	static TSharedPtr<FCSUnrealType> CreateTypeMetaData(const TSharedPtr<FJsonObject>& PropertyMetaData);
+	static TSharedPtr<FCSUnrealType> CreateTypeMetaData(const FCSMetaDataView& PropertyMetaData);
 
 	static void TryAddPropertyAsFieldNotify(const FCSPropertyMetaData& PropertyMetaData, UBlueprintGeneratedClass* Class);
 
 private:
 	static TArray<TObjectPtr<UCSPropertyGenerator>> PropertyGenerators;
+
+	// Resolved once in Initialize, so finding the generator of a property doesn't ask every generator again.
+	static constexpr int32 NumPropertyTypes = TNumericLimits<std::underlying_type_t<ECSPropertyType>>::Max() + 1;
+	static UCSPropertyGenerator* PropertyGeneratorsByType[NumPropertyTypes];
 };
@@ -1,14 +1,50 @@
 #include "CSStructPropertyGenerator.h"
 
+#include "UnrealSharpCore.h"
+#include "Engine/NetSerialization.h"
 #include "TypeGenerator/CSScriptStruct.h"
 #include "TypeGenerator/Register/MetaData/CSStructPropertyMetaData.h"
 
+// The NetQuantize structs derive from FVector without adding members, so swapping them in keeps the layout C# marshals
+// with and only changes how the property replicates.
+static UScriptStruct* GetNetQuantizedStruct(UScriptStruct* Struct, const FCSPropertyMetaData& PropertyMetaData)
+{
+	if (Struct != TBaseStructure<FVector>::Get())
+	{
+		return Struct;
+	}
+
+	if (PropertyMetaData.HasMetaData(TEXT("NetQuantizeNormal")))
+	{
+		return FVector_NetQuantizeNormal::StaticStruct();
+	}
+
+	const FString* Precision = PropertyMetaData.MetaData.Find(TEXT("NetQuantize"));
+	if (Precision == nullptr)
+	{
+		return Struct;
+	}
+
+	switch (FCString::Atoi(**Precision))
+	{
+	case 1:
+		return FVector_NetQuantize::StaticStruct();
+	case 10:
+		return FVector_NetQuantize10::StaticStruct();
+	case 100:
+		return FVector_NetQuantize100::StaticStruct();
+	default:
+		UE_LOG(LogUnrealSharp, Warning, TEXT("NetQuantize precision %s of %s isn't 1, 10 or 100, it replicates at full precision."), **Precision, *PropertyMetaData.Name.ToString());
+		return Struct;
+	}
+}
+
 FProperty* UCSStructPropertyGenerator::CreateProperty(UField* Outer, const FCSPropertyMetaData& PropertyMetaData)
 {
 	FStructProperty* StructProperty = static_cast<FStructProperty*>(Super::CreateProperty(Outer, PropertyMetaData));
 	TSharedPtr<FCSStructPropertyMetaData> StructPropertyMetaData = PropertyMetaData.GetTypeMetaData<FCSStructPropertyMetaData>();
 	
-	StructProperty->Struct = StructPropertyMetaData->TypeRef.GetOwningStruct();
+	StructProperty->Struct = GetNetQuantizedStruct(StructPropertyMetaData->TypeRef.GetOwningStruct(), PropertyMetaData);
 
 #if WITH_EDITOR
 	if (UCSScriptStruct* ManagedStruct = Cast<UCSScriptStruct>(StructProperty->Struct))
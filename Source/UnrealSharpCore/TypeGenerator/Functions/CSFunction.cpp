@@ -1,7 +1,11 @@
 #include "CSFunction.h"
 #include "CSManagedGCHandle.h"
 #include "CSManager.h"
-#include "CSUnrealSharpSettings.h"
+#include "CSManagedCallProfiler.h"
+#include "CSAssemblyBudgets.h"
+#include "CSInteropFrameCounters.h"
+#include "CSManagedCallbacksCache.h"
+#include "HAL/IConsoleManager.h"
 #include "TypeGenerator/CSClass.h"
 #include "TypeGenerator/CSSkeletonClass.h"
 #include "TypeGenerator/Register/TypeInfo/CSClassInfo.h"
@@ -10,6 +14,16 @@
 #include "Blueprint/BlueprintExceptionInfo.h"
 #endif
 
+namespace
+{
+	float ExceptionReportInterval = 1.0f;
+
+	FAutoConsoleVariableRef CVarExceptionReportInterval(
+		TEXT("UnrealSharp.ExceptionReportInterval"),
+		ExceptionReportInterval,
+		TEXT("Seconds during which further exceptions of a managed UFunction are only counted after one was reported. 0 reports every exception."));
+}
+
 void UCSFunctionBase::Bind()
 {
 	UClass* ClassToFindFunction = GetOwnerClass();
@@ -23,11 +37,14 @@ void UCSFunctionBase::Bind()
 	}
 #endif
 
-	for (FNativeFunctionLookup& Function : ClassToFindFunction->NativeFunctionLookupTable)
+	// Rebuilt classes can have stale entries for the same name, the last one added is the current one.
+	const TArray<FNativeFunctionLookup>& LookupTable = ClassToFindFunction->NativeFunctionLookupTable;
+	for (int32 i = LookupTable.Num() - 1; i >= 0; --i)
 	{
-		if (Function.Name == GetFName())
+		if (LookupTable[i].Name == GetFName())
 		{
-			SetNativeFunc(Function.Pointer);
+			SetNativeFunc(LookupTable[i].Pointer);
+			break;
 		}
 	}
 }
@@ -46,10 +63,10 @@ bool UCSFunctionBase::TryUpdateMethodHandle()
 	
 	const FString InvokeMethodName = FString::Printf(TEXT("Invoke_%s"), *GetName());
 	TSharedPtr<FCSClassInfo> ClassInfo = ManagedClass->GetManagedTypeInfo<FCSClassInfo>();
-	TSharedPtr<FGCHandle> TypeHandle = ClassInfo->GetManagedTypeHandle();
+	FGCHandle* TypeHandle = ClassInfo->GetManagedTypeHandle();
 	
 	MethodHandle = Assembly->GetManagedMethod(TypeHandle, InvokeMethodName);
-	return MethodHandle.IsValid();
+	return MethodHandle != nullptr;
 }
 
 bool UCSFunctionBase::IsOwnedByManagedClass() const
@@ -61,13 +78,38 @@ bool UCSFunctionBase::IsOwnedByManagedClass() const
 #endif
 }
 
+FGCHandle UCSFunctionBase::FindManagedObjectForInvoke(UObject* Object)
+{
+	UCSClass* ManagedClass = FCSClassUtilities::GetFirstManagedClass(Object->GetClass());
+	if (!ManagedClass)
+	{
+		return UCSManager::Get().FindManagedObject(Object);
+	}
+
+	// Managed instances cache their counterpart, so we can skip the lookup entirely.
+	if (const FGCHandle* CachedHandle = ManagedClass->GetCachedManagedHandle(Object))
+	{
+		if (!CachedHandle->IsNull())
+		{
+			return *CachedHandle;
+		}
+	}
+
+	UCSManager& Manager = UCSManager::Get();
+	FGCHandle ManagedObjectHandle = Manager.FindManagedObject(Object);
+	ManagedClass->CacheManagedHandle(Object, Manager.FindManagedObjectHandle(Object));
+	return ManagedObjectHandle;
+}
+
 void UCSFunctionBase::InvokeManagedMethod(UObject* ObjectToInvokeOn, FFrame& Stack, RESULT_DECL)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(UCSFunctionBase::InvokeManagedMethod);
 	
 	Stack.Code += !!Stack.Code;
-	UCSManager::Get().SetCurrentWorldContext(Stack.Object);
 	UCSFunctionBase* ManagedFunction = static_cast<UCSFunctionBase*>(Stack.CurrentNativeFunction);
+	FCSScopedManagedCallProfile ProfileScope(ManagedFunction);
+	FCSScopedAssemblyUsage AssemblyUsageScope(ManagedFunction);
+	FCSScopedInvokeWorldContext ScopedWorldContext(Stack.Object);
 	
 #if WITH_EDITOR
 	// Full reload causes the method pointers to become invalid, lazy rebind them, if needed.
@@ -77,21 +119,128 @@ void UCSFunctionBase::InvokeManagedMethod(UObject* ObjectToInvokeOn, FFrame& Sta
 	}
 #endif
 
-	FGCHandle ManagedObjectHandle = UCSManager::Get().FindManagedObject(ObjectToInvokeOn);
+	FGCHandle ManagedObjectHandle = FindManagedObjectForInvoke(ObjectToInvokeOn);
 	
-	FString ExceptionMessage;
-	if (!FCSManagedCallbacks::ManagedCallbacks.InvokeManagedMethod(ManagedObjectHandle.GetPointer(),
-		ManagedFunction->MethodHandle->GetPointer(),
-		Stack.Locals,
-		RESULT_PARAM,
-		&ExceptionMessage))
+	bool bThrew;
 	{
-		return;
+		CS_SCOPED_MANAGED_INVOKE(Method);
+		ProfileScope.BeginManagedCall();
+		bThrew = FCSManagedCallbacks::ManagedCallbacks.InvokeManagedMethod(ManagedObjectHandle.GetPointer(),
+			ManagedFunction->MethodHandle->GetPointer(),
+			Stack.Locals,
+			RESULT_PARAM);
+		ProfileScope.EndManagedCall();
+	}
+
+	if (bThrew)
+	{
+		ManagedFunction->ReportManagedException(ObjectToInvokeOn, Stack);
 	}
+}
+
+void UCSFunctionBase::ReportManagedException(UObject* ObjectToInvokeOn, FFrame& Stack)
+{
+	const bool bFatal = UCSManager::Get().ShouldCrashOnException();
 	
-	const UCSUnrealSharpSettings* Settings = GetDefault<UCSUnrealSharpSettings>();
-	EBlueprintExceptionType::Type ExceptionType = Settings->bCrashOnException ? EBlueprintExceptionType::FatalError : EBlueprintExceptionType::NonFatalError;
+	if (!bFatal && IsInGameThread())
+	{
+		const double Now = FPlatformTime::Seconds();
+		if (Now - LastExceptionReportTime < ExceptionReportInterval)
+		{
+			// Drop the exception without formatting it, a method that throws every tick would otherwise cost a message per call.
+			++NumSuppressedExceptions;
+			FCSManagedCallbacks::ManagedCallbacks.GetLastManagedException(nullptr);
+			return;
+		}
+
+		if (NumSuppressedExceptions > 0)
+		{
+			UE_LOGFMT(LogUnrealSharp, Warning, "{0} threw {1} more times since its last reported exception", *GetName(), NumSuppressedExceptions);
+			NumSuppressedExceptions = 0;
+		}
 		
-	const FBlueprintExceptionInfo ExceptionInfo(ExceptionType, FText::FromString(ExceptionMessage));
+		LastExceptionReportTime = Now;
+	}
+
+	FString ExceptionMessage;
+	FCSManagedCallbacks::ManagedCallbacks.GetLastManagedException(&ExceptionMessage);
+	UE_LOGFMT(LogUnrealSharp, Error, "Exception in {0}: {1}", *GetName(), *ExceptionMessage);
+	
+	const EBlueprintExceptionType::Type ExceptionType = bFatal ? EBlueprintExceptionType::FatalError : EBlueprintExceptionType::NonFatalError;
+	const FBlueprintExceptionInfo ExceptionInfo(ExceptionType, FText::FromString(MoveTemp(ExceptionMessage)));
 	FBlueprintCoreDelegates::ThrowScriptException(ObjectToInvokeOn, Stack, ExceptionInfo);
 }
+
+FCSManagedCallStats* UCSFunctionBase::GetProfilerStats()
+{
+#if UNREALSHARP_PROFILE_MANAGED_CALLS
+	if (!ProfilerStats)
+	{
+		ProfilerStats = FCSManagedCallProfiler::FindOrAddStats(this);
+	}
+#endif
+	return ProfilerStats;
+}
+
+FCSAssemblyUsage* UCSFunctionBase::GetAssemblyUsage()
+{
+	if (!AssemblyUsage)
+	{
+		AssemblyUsage = FCSAssemblyBudgets::FindOrAddUsage(this);
+	}
+
+	return AssemblyUsage;
+}
+
+bool UCSFunctionBase::InvokeManagedMethodBatch(TConstArrayView<UObject*> Objects, uint8* ParamsBlock, int32 Stride)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCSFunctionBase::InvokeManagedMethodBatch);
+	check(!GetReturnProperty());
+	check(ParamsBlock || ParmsSize == 0);
+	check(Stride >= ParmsSize || Stride == 0);
+
+	if (Objects.IsEmpty())
+	{
+		return true;
+	}
+
+	if (!HasValidMethodHandle() && !TryUpdateMethodHandle())
+	{
+		return false;
+	}
+
+	UClass* OwnerClass = GetOwnerClass();
+	TArray<void*, TInlineAllocator<256>> ManagedObjectHandles;
+	ManagedObjectHandles.Reserve(Objects.Num());
+
+	for (UObject* Object : Objects)
+	{
+		if (!IsValid(Object) || !Object->IsA(OwnerClass))
+		{
+			ManagedObjectHandles.Add(nullptr);
+			continue;
+		}
+
+		ManagedObjectHandles.Add(FindManagedObjectForInvoke(Object).GetPointer());
+	}
+
+	FCSScopedInvokeWorldContext ScopedWorldContext(Objects[0]);
+	FCSScopedAssemblyUsage AssemblyUsageScope(this, Objects.Num());
+
+	const int32 NumFailed = FCSManagedCallbacks::ManagedCallbacks.InvokeManagedMethodBatch(MethodHandle->GetPointer(),
+		ManagedObjectHandles.GetData(),
+		ParamsBlock,
+		Stride,
+		ManagedObjectHandles.Num());
+
+	if (NumFailed == 0)
+	{
+		return true;
+	}
+
+	FString ExceptionMessage;
+	FCSManagedCallbacks::ManagedCallbacks.GetLastManagedException(&ExceptionMessage);
+
+	UE_LOGFMT(LogUnrealSharp, Error, "{0} of {1} batched invocations of {2} threw. First exception:\n{3}", NumFailed, Objects.Num(), *GetName(), *ExceptionMessage);
+	return false;
+}
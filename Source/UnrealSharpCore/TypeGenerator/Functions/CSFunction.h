@@ -5,6 +5,8 @@
 #include "CSFunction.generated.h"
 
 struct FGCHandle;
+struct FCSManagedCallStats;
+struct FCSAssemblyUsage;
 class UCSClass;
 
 UCLASS()
@@ -18,15 +20,43 @@ public:
 
 	// Tries to update the method handle to the function pointer in C#.
 	bool TryUpdateMethodHandle();
+
+	// Assigns a method handle that was looked up in bulk for the whole class.
+	void SetMethodHandle(FGCHandle* InMethodHandle) { MethodHandle = InMethodHandle; }
 	
 	bool IsOwnedByManagedClass() const;
 
 	bool HasValidMethodHandle() const
 	{
-		return MethodHandle.IsValid() && !MethodHandle->IsNull();
+		return MethodHandle && !MethodHandle->IsNull();
 	}
 
 	static void InvokeManagedMethod(UObject* ObjectToInvokeOn, FFrame& Stack, RESULT_DECL);
+
+	// Invokes the managed implementation on all objects with a single transition into C#.
+	// The parameters of each call are laid out back to back in ParamsBlock, Stride bytes apart. A stride of 0 passes the same parameters to every call.
+	// Functions with a return value are not supported. Returns false if any of the invocations threw.
+	UNREALSHARPCORE_API bool InvokeManagedMethodBatch(TConstArrayView<UObject*> Objects, uint8* ParamsBlock = nullptr, int32 Stride = 0);
+
+	// Stats of this function for FCSManagedCallProfiler, looked up on the first profiled call.
+	FCSManagedCallStats* GetProfilerStats();
+
+	// Usage of the owning assembly for FCSAssemblyBudgets, looked up on the first accounted call.
+	FCSAssemblyUsage* GetAssemblyUsage();
 private:
-	TSharedPtr<FGCHandle> MethodHandle = nullptr;
+	static FGCHandle FindManagedObjectForInvoke(UObject* Object);
+
+	// Fetches the exception the last invocation threw and throws it as a script exception.
+	// Repeats within UnrealSharp.ExceptionReportInterval are only counted, unless exceptions crash.
+	void ReportManagedException(UObject* ObjectToInvokeOn, FFrame& Stack);
+
+	FGCHandle* MethodHandle = nullptr;
+
+	// Benign race, every thread that looks the stats up gets the same pointer.
+	FCSManagedCallStats* ProfilerStats = nullptr;
+	FCSAssemblyUsage* AssemblyUsage = nullptr;
+
+	// Game thread only, exceptions on other threads are always reported.
+	double LastExceptionReportTime = -DBL_MAX;
+	int32 NumSuppressedExceptions = 0;
 };
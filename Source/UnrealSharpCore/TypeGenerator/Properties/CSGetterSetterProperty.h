@@ -13,7 +13,8 @@ concept ValidProperty = std::derived_from<T, FProperty>
 	};
 
 /**
- * 
+ * A property whose C# accessors have a body. Only the accessors that are UFunctions go through C#,
+ * reads and writes for a trivial accessor copy the property memory directly.
  */
 template <ValidProperty PropertyBaseClass>
 class  TCSGetterSetterProperty : public PropertyBaseClass {
@@ -38,33 +39,46 @@ public:
 
     virtual void CallSetter(void* Container, const void* InValue) const override
     {
+        void* ValuePtr = this->template ContainerPtrToValuePtr<void>(Container);
+        if (!SetterFunc)
+        {
+            // Trivial setter, the backing field lives in the property memory.
+            this->CopyCompleteValue(ValuePtr, InValue);
+            return;
+        }
+
         CallSetterInternal(Container, InValue);
 
         // After setting the value we make a call to the getter with the output destination being the native memory
-        void* OutObj = this->template ContainerPtrToValuePtr<uint8>(static_cast<UObject*>(Container));
-        if (GetterFunc != nullptr)
-        {
-            CallGetterInternal(Container, OutObj);
-        }
-        else
+        if (IsMirrored())
         {
-            static_cast<const FProperty*>(this)->GetValue_InContainer(Container, OutObj);
+            CallGetterInternal(Container, ValuePtr);
         }
-	    
     }
 
     virtual void CallGetter(const void* Container, void* OutValue) const override
     {
+        const void* ValuePtr = this->template ContainerPtrToValuePtr<void>(Container);
+        if (!GetterFunc)
+        {
+            // Trivial getter, the backing field lives in the property memory.
+            this->CopyCompleteValue(OutValue, ValuePtr);
+            return;
+        }
+
         CallGetterInternal(Container, OutValue);
 
-        // After get invocation we want to write the result into the native buffer as well
-        static_cast<const FProperty*>(this)->SetValue_InContainer(const_cast<void*>(Container), OutValue);
+        // After get invocation we want to write the result into the native buffer as well, without going through the setter
+        if (IsMirrored() && OutValue != ValuePtr)
+        {
+            this->CopyCompleteValue(const_cast<void*>(ValuePtr), OutValue);
+        }
     }
 
     virtual void ExportText_Internal(FString& ValueStr, const void* PropertyValueOrContainer, EPropertyPointerType PointerType, const void* DefaultValue, UObject* Parent, int32 PortFlags, UObject* ExportRootScope) const override
     {
         // In the case of direct access we want to call C# to write to the native buffer before we proceed
-        if (PointerType == EPropertyPointerType::Direct)
+        if (PointerType == EPropertyPointerType::Direct && IsMirrored())
         {
             const uint8* ObjectPointer = static_cast<const uint8*>(PropertyValueOrContainer) - this->GetOffset_ForInternal();
             CallGetterInternal(const_cast<uint8*>(ObjectPointer), const_cast<void*>(PropertyValueOrContainer));
@@ -80,7 +94,7 @@ public:
         const TCHAR* Result = PropertyBaseClass::ImportText_Internal(Buffer, ContainerOrPropertyPtr, PointerType, OwnerObject, PortFlags, ErrorText);
 
         // After setting the native memory from text we want to write the value into managed memory
-        if (PointerType == EPropertyPointerType::Direct)
+        if (PointerType == EPropertyPointerType::Direct && SetterFunc)
         {
             uint8* ObjectPointer = static_cast<uint8*>(ContainerOrPropertyPtr) - this->GetOffset_ForInternal();
             CallSetterInternal(ObjectPointer, ContainerOrPropertyPtr);
@@ -93,14 +107,17 @@ public:
     {
         // We need to call the setter to initialize the backing field from the serialized memory to ensure it gets initialized correctly
         const EConvertFromTypeResult Result = PropertyBaseClass::ConvertFromType(Tag, Slot, Data, DefaultsStruct, Defaults);
-        CallSetterInternal(Data, Data + this->GetOffset_ForInternal());
+        if (SetterFunc)
+        {
+            CallSetterInternal(Data, Data + this->GetOffset_ForInternal());
+        }
         return Result;
     }
 
     virtual void SerializeItem(FStructuredArchive::FSlot Slot, void* Value, void const* Defaults) const
     {
         const FArchive &UnderlyingArchive = Slot.GetUnderlyingArchive();
-        if (UnderlyingArchive.IsSaving())
+        if (UnderlyingArchive.IsSaving() && IsMirrored())
         {
             // When saving we want to get the most up-to-date value of the property
             CallGetterInternal(static_cast<uint8*>(Value) - this->GetOffset_ForInternal(), Value);
@@ -108,7 +125,7 @@ public:
 
         PropertyBaseClass::SerializeItem(Slot, Value, Defaults);
         
-        if (UnderlyingArchive.IsLoading())
+        if (UnderlyingArchive.IsLoading() && SetterFunc)
         {
             // When loading we want to update the property with what we pulled out of the archive
             CallSetterInternal(static_cast<uint8*>(Value) - this->GetOffset_ForInternal(), Value);
@@ -117,7 +134,7 @@ public:
     
     virtual bool NetSerializeItem(FArchive& Ar, UPackageMap* Map, void* Data, TArray<uint8> * MetaData) const
     {
-        if (Ar.IsSaving())
+        if (Ar.IsSaving() && IsMirrored())
         {
             // When saving we want to get the most up-to-date value of the property
             CallGetterInternal(static_cast<uint8*>(Data) - this->GetOffset_ForInternal(), Data);
@@ -125,7 +142,7 @@ public:
         
         const bool Result = PropertyBaseClass::NetSerializeItem(Ar, Map, Data, MetaData);
 
-        if (Ar.IsLoading())
+        if (Ar.IsLoading() && SetterFunc)
         {
             // When loading we want to update the property with what we pulled out of the archive
             CallSetterInternal(static_cast<uint8*>(Data) - this->GetOffset_ForInternal(), Data);
@@ -135,6 +152,13 @@ public:
     }
 
 private:
+    // When both accessors are UFunctions the value lives in C#, and the property memory mirrors it.
+    // When only one of them is, the other one was trivial, and the weaver moved the backing field into the property memory.
+    bool IsMirrored() const
+    {
+        return SetterFunc && GetterFunc;
+    }
+
     void CallSetterInternal(void* Container, const void* InValue) const
     {
         checkf(SetterFunc, TEXT("Calling a setter on %s but the property has no setter defined."), *PropertyBaseClass::GetFullName());
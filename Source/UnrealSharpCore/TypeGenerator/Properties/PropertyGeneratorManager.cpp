@@ -16,8 +16,8 @@ static TTuple<UFunction*, UFunction*> GetGetterAndSetterMethods(UField* Outer, c
 
 	return
 	{
-		Class->FindFunctionByName(*PropertyMetaData.BlueprintGetter),
-		Class->FindFunctionByName(*PropertyMetaData.BlueprintSetter)
+		Class->FindFunctionByName(PropertyMetaData.BlueprintGetter),
+		Class->FindFunctionByName(PropertyMetaData.BlueprintSetter)
 	};
 }
 
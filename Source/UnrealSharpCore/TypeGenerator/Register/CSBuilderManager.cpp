@@ -27,6 +27,13 @@ void UCSTypeBuilderManager::Initialize()
 
 		UCSGeneratedTypeBuilder* NewBuilder = NewObject<UCSGeneratedTypeBuilder>(this, Builder->GetClass(), NAME_None, RF_Transient | RF_Public);
 		TypeBuilders.Add(NewBuilder);
+
+		// Keep the first builder for a field class, same as the linear search did.
+		const UClass* FieldClass = NewBuilder->GetFieldType();
+		if (!TypeBuildersByFieldClass.Contains(FieldClass))
+		{
+			TypeBuildersByFieldClass.Add(FieldClass, NewBuilder);
+		}
 	}
 }
 
@@ -40,14 +47,9 @@ const UCSGeneratedTypeBuilder* UCSTypeBuilderManager::BorrowTypeBuilder(const TS
 		return nullptr;
 	}
 	
-	for (UCSGeneratedTypeBuilder* Builder : TypeBuilders)
+	if (UCSGeneratedTypeBuilder* const* Builder = TypeBuildersByFieldClass.Find(TypeClass))
 	{
-		if (Builder->GetFieldType() != TypeClass)
-		{
-			continue;
-		}
-
-		return Builder;
+		return *Builder;
 	}
 
 	UE_LOG(LogUnrealSharp, Warning, TEXT("No type builder found for class: %s"), *TypeClass->GetName());
@@ -20,4 +20,7 @@ public:
 private:
 	UPROPERTY(Transient)
 	TArray<TObjectPtr<UCSGeneratedTypeBuilder>> TypeBuilders;
+
+	// Builders by the field class they build, filled in Initialize. TypeBuilders keeps them alive.
+	TMap<const UClass*, UCSGeneratedTypeBuilder*> TypeBuildersByFieldClass;
 };
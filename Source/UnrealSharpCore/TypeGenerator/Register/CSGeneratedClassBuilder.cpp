@@ -15,6 +15,25 @@
 #include "UnrealSharpCore/TypeGenerator/Factories/CSPropertyFactory.h"
 #include "UnrealSharpUtilities/UnrealSharpUtils.h"
 #include "Utils/CSClassUtilities.h"
+#include "CSBatchedTick.h"
+#include "CSDeferredManagedObjects.h"
+#include "TypeGenerator/Functions/CSFunction.h"
+
+namespace
+{
+	bool IsBatchedTickClass(const UClass* Class)
+	{
+		for (const UCSClass* ManagedClass = Cast<UCSClass>(Class); ManagedClass; ManagedClass = Cast<UCSClass>(ManagedClass->GetSuperClass()))
+		{
+			if (ManagedClass->HasTypeInfo() && ManagedClass->GetTypeMetaData<FCSClassMetaData>()->HasMetaData(TEXT("BatchedTick")))
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+}
 
 UCSGeneratedClassBuilder::UCSGeneratedClassBuilder()
 {
@@ -39,6 +58,7 @@ void UCSGeneratedClassBuilder::RebuildType(UField* TypeToBuild, const TSharedPtr
 	}
 	
 	Field->SetSuperStruct(CurrentSuperClass);
+	FCSClassHierarchyTable::Invalidate();
     FCSMetaDataUtils::ApplyMetaData(TypeMetaData->MetaData, Field);
 
 	// Reset for each rebuild of the class, so it doesn't accumulate properties from previous builds.
@@ -100,14 +120,17 @@ void UCSGeneratedClassBuilder::CreateClass(TSharedPtr<FCSClassMetaData> TypeMeta
 	ImplementInterfaces(Field, TypeMetaData->Interfaces);
 
 	// Generate properties for this class
+	UCSClass::TryAddManagedHandleProperty(Field);
 	FCSPropertyFactory::CreateAndAssignProperties(Field, TypeMetaData->Properties);
 
 	// Build the construction script that will spawn the components
 	FCSSimpleConstructionScriptBuilder::BuildSimpleConstructionScript(Field, &Field->SimpleConstructionScript, TypeMetaData->Properties);
 
-	// Generate functions for this class
-	FCSFunctionFactory::GenerateVirtualFunctions(Field, TypeMetaData);
-	FCSFunctionFactory::GenerateFunctions(Field, TypeMetaData->Functions);
+	// Generate functions for this class. Their C# methods are looked up in one go instead of one call per function.
+	FCSFunctionFactory::FMethodHandles MethodHandles;
+	FCSFunctionFactory::ResolveMethodHandles(Field, TypeMetaData, MethodHandles);
+	FCSFunctionFactory::GenerateVirtualFunctions(Field, TypeMetaData, &MethodHandles);
+	FCSFunctionFactory::GenerateFunctions(Field, TypeMetaData->Functions, &MethodHandles);
 
 	//Finalize class
 	Field->ClassConstructor = &UCSGeneratedClassBuilder::ManagedObjectConstructor;
@@ -115,6 +138,9 @@ void UCSGeneratedClassBuilder::CreateClass(TSharedPtr<FCSClassMetaData> TypeMeta
 	Field->Bind();
 	Field->StaticLink(true);
 	Field->AssembleReferenceTokenStream();
+	Field->UpdateManagedHandleOffset();
+	Field->UpdateNonZeroInitializedProperties();
+	Field->UpdateCanCreateManagedObjectLazily();
 
 	//Create the default object for this class
 	UObject* DefaultObject = Field->GetDefaultObject();
@@ -148,27 +174,27 @@ void UCSGeneratedClassBuilder::ManagedObjectConstructor(const FObjectInitializer
 	//Execute the native class' constructor first.
 	FirstNativeClass->ClassConstructor(ObjectInitializer);
 
-	// Initialize managed properties that are not zero initialized such as FText.
-	for (TFieldIterator<FProperty> PropertyIt(FirstManagedClass); PropertyIt; ++PropertyIt)
-	{
-		FProperty* Property = *PropertyIt;
+	// Initialize managed properties that are not zero initialized such as FText. The list is built with the class.
+	FirstManagedClass->InitializeNonZeroInitializedProperties(ObjectInitializer.GetObj());
 
-		if (!FCSClassUtilities::IsManagedClass(Property->GetOwnerClass()))
+	// Objects created lazily get their counterpart from FindManagedObject, the first time they're used from C# or call into it.
+	if (!UCSManager::Get().ShouldCreateManagedObjectLazily(FirstManagedClass, ObjectInitializer.GetObj()))
+	{
+		if (FCSDeferredManagedObjects::ShouldDefer())
 		{
-			// We don't want to initialize properties that are not from a managed class
-			break;
+			FCSDeferredManagedObjects::Enqueue(ObjectInitializer.GetObj());
 		}
-		
-		if (Property->HasAnyPropertyFlags(CPF_ZeroConstructor))
+		else
 		{
-			continue;
+			UCSAssembly* Assembly = FirstManagedClass->GetManagedTypeInfo<FCSClassInfo>()->GetOwningAssembly();
+			Assembly->CreateManagedObject(ObjectInitializer.GetObj());
 		}
-
-		Property->InitializeValue_InContainer(ObjectInitializer.GetObj());
 	}
 
-	UCSAssembly* Assembly = FirstManagedClass->GetManagedTypeInfo<FCSClassInfo>()->GetOwningAssembly();
-	Assembly->CreateManagedObject(ObjectInitializer.GetObj());
+	if (FirstManagedClass->GetBatchedTickFunction() && !ObjectInitializer.GetObj()->HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
+	{
+		FCSBatchedTick::Register(ObjectInitializer.GetObj());
+	}
 }
 
 void UCSGeneratedClassBuilder::SetupDefaultTickSettings(UObject* DefaultObject, const UClass* Class)
@@ -190,8 +216,16 @@ void UCSGeneratedClassBuilder::SetupDefaultTickSettings(UObject* DefaultObject,
 		return;
 	}
 	
+	UCSClass* ManagedClass = const_cast<UCSClass*>(Cast<UCSClass>(Class));
+	if (ManagedClass)
+	{
+		ManagedClass->SetBatchedTick(nullptr, TickFunction->TickGroup);
+	}
+
+	const bool bBatchedTick = ManagedClass && IsBatchedTickClass(ManagedClass);
+
 	TickFunction->bCanEverTick = ParentTickFunction->bCanEverTick;
-	if (TickFunction->bCanEverTick)
+	if (TickFunction->bCanEverTick && !bBatchedTick)
 	{
 		return;
 	}
@@ -207,6 +241,25 @@ void UCSGeneratedClassBuilder::SetupDefaultTickSettings(UObject* DefaultObject,
 
 		Class = Class->GetSuperClass();
 	}
+
+	if (bBatchedTick)
+	{
+		if (UCSFunctionBase* ManagedTick = Cast<UCSFunctionBase>(FoundTick))
+		{
+			// FCSBatchedTick ticks the instances, they don't get a tick function of their own.
+			ManagedClass->SetBatchedTick(ManagedTick, TickFunction->TickGroup);
+			TickFunction->bCanEverTick = false;
+			TickFunction->bStartWithTickEnabled = false;
+			return;
+		}
+
+		UE_LOG(LogUnrealSharp, Warning, TEXT("%s is marked BatchedTick but doesn't override ReceiveTick"), *ManagedClass->GetName());
+
+		if (TickFunction->bCanEverTick)
+		{
+			return;
+		}
+	}
 	
 	bool bCanTick = FoundTick != nullptr;
 	TickFunction->bCanEverTick = bCanTick;
@@ -4,6 +4,7 @@
 #include "MetaData/CSInterfaceMetaData.h"
 #include "TypeGenerator/CSInterface.h"
 #include "UnrealSharpCore/TypeGenerator/Factories/CSFunctionFactory.h"
+#include "Utils/CSClassHierarchyTable.h"
 
 void UCSGeneratedInterfaceBuilder::RebuildType(UField* TypeToBuild, const TSharedPtr<FCSManagedTypeInfo>& ManagedTypeInfo) const
 {
@@ -19,6 +20,7 @@ void UCSGeneratedInterfaceBuilder::RebuildType(UField* TypeToBuild, const TShare
 	}
 	
 	Field->SetSuperStruct(ParentInterface);
+	FCSClassHierarchyTable::Invalidate();
 	
 	Field->ClassFlags |= CLASS_Interface;
     FCSMetaDataUtils::ApplyMetaData(TypeMetaData->MetaData, Field);
@@ -1,5 +1,7 @@
 ﻿#include "CSGeneratedStructBuilder.h"
 #include "CSManager.h"
+#include "UnrealSharpCore.h"
+#include "Algo/StableSort.h"
 #include "MetaData/CSStructMetaData.h"
 #include "UnrealSharpCore/TypeGenerator/CSScriptStruct.h"
 #include "UnrealSharpCore/TypeGenerator/Factories/CSPropertyFactory.h"
@@ -27,8 +29,18 @@ void UCSGeneratedStructBuilder::RebuildType(UField* TypeToBuild, const TSharedPt
 	
 	Field->Bind();
 	Field->StaticLink(true);
+
+	if (TypeMetaData->MetaData.Contains(TEXT("OptimizeLayout")))
+	{
+		if (const int32 BytesSaved = OptimizePropertyLayout(Field))
+		{
+			UE_LOG(LogUnrealSharp, Log, TEXT("Reordered the properties of %s, saving %d of %d bytes"), *Field->GetName(), BytesSaved, Field->GetStructureSize() + BytesSaved);
+		}
+	}
+	
 	Field->RecreateDefaults();
 	Field->UpdateStructFlags();
+	UpdatePlainOldDataFlags(Field);
 	
 	RegisterFieldToLoader(TypeToBuild, ENotifyRegistrationType::NRT_Struct);
 
@@ -42,6 +54,112 @@ UClass* UCSGeneratedStructBuilder::GetFieldType() const
 	return UCSScriptStruct::StaticClass();
 }
 
+int32 UCSGeneratedStructBuilder::OptimizePropertyLayout(UCSScriptStruct* Field)
+{
+	TArray<FProperty*> DeclaredOrder;
+	TArray<FProperty*> FixedProperties;
+	TArray<FProperty*> MovableProperties;
+
+	for (FProperty* Property = CastField<FProperty>(Field->ChildProperties); Property; Property = CastField<FProperty>(Property->Next))
+	{
+		DeclaredOrder.Add(Property);
+		
+		// Blueprint pins and the details panel follow the property order, and so does replication.
+		const bool bIsFixed = Property->HasAnyPropertyFlags(CPF_BlueprintVisible | CPF_Edit | CPF_Net);
+		(bIsFixed ? FixedProperties : MovableProperties).Add(Property);
+	}
+
+	if (MovableProperties.IsEmpty())
+	{
+		return 0;
+	}
+
+	// Largest alignment and size first, so padding is only needed in front of the first movable property.
+	Algo::StableSort(MovableProperties, [](const FProperty* A, const FProperty* B)
+	{
+		if (A->GetMinAlignment() != B->GetMinAlignment())
+		{
+			return A->GetMinAlignment() > B->GetMinAlignment();
+		}
+
+		return A->GetSize() > B->GetSize();
+	});
+
+	auto RelinkProperties = [Field](TConstArrayView<FProperty*> Properties)
+	{
+		for (int32 i = 0; i < Properties.Num(); ++i)
+		{
+			Properties[i]->Next = i + 1 < Properties.Num() ? Properties[i + 1] : nullptr;
+		}
+
+		Field->ChildProperties = Properties[0];
+		Field->StaticLink(true);
+	};
+
+	const int32 DeclaredSize = Field->GetStructureSize();
+	
+	TArray<FProperty*> OptimizedOrder = MoveTemp(FixedProperties);
+	OptimizedOrder.Append(MovableProperties);
+	RelinkProperties(OptimizedOrder);
+
+	const int32 BytesSaved = DeclaredSize - Field->GetStructureSize();
+	if (BytesSaved <= 0)
+	{
+		RelinkProperties(DeclaredOrder);
+		return 0;
+	}
+
+	return BytesSaved;
+}
+
+void UCSGeneratedStructBuilder::UpdatePlainOldDataFlags(UCSScriptStruct* Field)
+{
+	bool bIsPlainOldData = true;
+	bool bHasNoDestructor = true;
+	bool bIsZeroConstructed = true;
+
+	for (TFieldIterator<FProperty> It(Field); It; ++It)
+	{
+		bIsPlainOldData &= It->HasAllPropertyFlags(CPF_IsPlainOldData);
+		bHasNoDestructor &= It->HasAnyPropertyFlags(CPF_IsPlainOldData | CPF_NoDestructor);
+		bIsZeroConstructed &= It->HasAllPropertyFlags(CPF_ZeroConstructor);
+	}
+
+	// Default values set in C# make the defaults non-zero, even when every property is.
+	if (bIsZeroConstructed)
+	{
+		const uint8* DefaultInstance = Field->GetDefaultInstance();
+		const int32 StructureSize = Field->GetStructureSize();
+		
+		for (int32 i = 0; DefaultInstance && i < StructureSize; ++i)
+		{
+			if (DefaultInstance[i] != 0)
+			{
+				bIsZeroConstructed = false;
+				break;
+			}
+		}
+	}
+
+	// Rebuilt structs may have lost these since the last build.
+	Field->StructFlags = EStructFlags(Field->StructFlags & ~(STRUCT_IsPlainOldData | STRUCT_NoDestructor | STRUCT_ZeroConstructor));
+
+	if (bIsPlainOldData)
+	{
+		Field->StructFlags = EStructFlags(Field->StructFlags | STRUCT_IsPlainOldData);
+	}
+	
+	if (bHasNoDestructor)
+	{
+		Field->StructFlags = EStructFlags(Field->StructFlags | STRUCT_NoDestructor);
+	}
+
+	if (bIsZeroConstructed)
+	{
+		Field->StructFlags = EStructFlags(Field->StructFlags | STRUCT_ZeroConstructor);
+	}
+}
+
 void UCSGeneratedStructBuilder::PurgeStruct(UCSScriptStruct* Field)
 {
 	FCSUnrealSharpUtils::PurgeStruct(Field);
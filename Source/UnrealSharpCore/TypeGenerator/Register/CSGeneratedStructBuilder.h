@@ -16,4 +16,12 @@ public:
 	// End of implementation
 private:
 	static void PurgeStruct(UCSScriptStruct* Field);
+
+	// Moves the properties that aren't visible to Blueprint or the editor behind the others, largest alignment first, and links the struct again.
+	// Keeps the declaration order if that doesn't make the struct smaller. Returns the number of bytes saved.
+	static int32 OptimizePropertyLayout(UCSScriptStruct* Field);
+
+	// Flags the struct as plain old data, zero constructed and without destructor when all of its properties are,
+	// so containers of it are copied, initialized and destroyed in bulk instead of property by property.
+	static void UpdatePlainOldDataFlags(UCSScriptStruct* Field);
 };
@@ -25,6 +25,7 @@ UField* UCSGeneratedTypeBuilder::CreateType(const TSharedPtr<FCSManagedTypeInfo>
 		}
 		
 		FieldToBuild = NewObject<UField>(Package, FieldType, *FieldName, RF_Public | RF_Standalone);
+		UCSManager::Get().RegisterManagedField(FieldToBuild);
 	}
 
 	if (ICSManagedTypeInterface* ManagedTypeInterface = Cast<ICSManagedTypeInterface>(FieldToBuild))
@@ -2,35 +2,34 @@
 
 #include "CSFieldName.h"
 #include "CSUnrealSharpSettings.h"
-#include "Dom/JsonObject.h"
 #include "TypeGenerator/Factories/CSPropertyFactory.h"
 #include "UObject/UnrealType.h"
 
-void FCSMetaDataUtils::SerializeFunctions(const TArray<TSharedPtr<FJsonValue>>& FunctionsInfo, TArray<FCSFunctionMetaData>& FunctionMetaData)
+void FCSMetaDataUtils::SerializeFunctions(const FCSMetaDataArrayView& FunctionsInfo, TArray<FCSFunctionMetaData>& FunctionMetaData)
 {
 	FunctionMetaData.Reserve(FunctionsInfo.Num());
 	
-	for (const TSharedPtr<FJsonValue>& FunctionInfo : FunctionsInfo)
+	for (int32 i = 0; i < FunctionsInfo.Num(); ++i)
 	{
 		FCSFunctionMetaData NewFunctionMetaData;
-		NewFunctionMetaData.SerializeFromJson(FunctionInfo->AsObject());
+		NewFunctionMetaData.SerializeFromJson(FunctionsInfo.GetObject(i));
 		FunctionMetaData.Emplace(MoveTemp(NewFunctionMetaData));
 	}
 }
 
-void FCSMetaDataUtils::SerializeProperties(const TArray<TSharedPtr<FJsonValue>>& PropertiesInfo, TArray<FCSPropertyMetaData>& PropertiesMetaData, EPropertyFlags DefaultFlags)
+void FCSMetaDataUtils::SerializeProperties(const FCSMetaDataArrayView& PropertiesInfo, TArray<FCSPropertyMetaData>& PropertiesMetaData, EPropertyFlags DefaultFlags)
 {
 	PropertiesMetaData.Reserve(PropertiesInfo.Num());
 	
-	for (const TSharedPtr<FJsonValue>& Property : PropertiesInfo)
+	for (int32 i = 0; i < PropertiesInfo.Num(); ++i)
 	{
 		FCSPropertyMetaData NewPropertyMetaData;
-		SerializeProperty(Property->AsObject(), NewPropertyMetaData, DefaultFlags);
+		SerializeProperty(PropertiesInfo.GetObject(i), NewPropertyMetaData, DefaultFlags);
 		PropertiesMetaData.Emplace(MoveTemp(NewPropertyMetaData));
 	}
 }
 
-void FCSMetaDataUtils::SerializeProperty(const TSharedPtr<FJsonObject>& PropertyMetaData, FCSPropertyMetaData& PropertiesMetaData, EPropertyFlags DefaultFlags)
+void FCSMetaDataUtils::SerializeProperty(const FCSMetaDataView& PropertyMetaData, FCSPropertyMetaData& PropertiesMetaData, EPropertyFlags DefaultFlags)
 {
 	PropertiesMetaData.Type = FCSPropertyFactory::CreateTypeMetaData(PropertyMetaData);
 	PropertiesMetaData.SerializeFromJson(PropertyMetaData);
@@ -54,21 +53,29 @@ FString FCSMetaDataUtils::GetAdjustedFieldName(const FCSFieldName& FieldName)
 	return *Name;
 }
 
-void FCSMetaDataUtils::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject, TMap<FString, FString>& MetaDataMap)
+bool FCSMetaDataUtils::IsRuntimeMetaData(const FString& Key)
 {
-	const TSharedPtr<FJsonObject>* MetaDataObjectPtr;
-	if (JsonObject->TryGetObjectField(TEXT("MetaData"), MetaDataObjectPtr))
+	static const TSet<FString> RuntimeKeys = { TEXT("FieldNotify"), TEXT("OptimizeLayout"), TEXT("BatchedTick"), TEXT("NetQuantize"), TEXT("NetQuantizeNormal"),
+		TEXT("ParallelTick"), TEXT("ParallelTickReads"), TEXT("ParallelTickWrites") };
+	return RuntimeKeys.Contains(Key);
+}
+
+void FCSMetaDataUtils::SerializeFromJson(const FCSMetaDataView& JsonObject, TMap<FString, FString>& MetaDataMap)
+{
+	FCSMetaDataView MetaDataObject;
+	if (JsonObject.TryGetObjectField(TEXT("MetaData"), MetaDataObject))
 	{
-		TSharedPtr<FJsonObject> MetaDataObject = *MetaDataObjectPtr;
-		for (const auto& Pair : MetaDataObject->Values)
+		MetaDataObject.ForEachStringField([&MetaDataMap](const FString& Key, const FString& Value)
 		{
-			FString Key = Pair.Key;
-			FString Value;
-			
-			MetaDataObject->TryGetStringField(Key, Value);
-
+#if !WITH_EDITOR
+			// Metadata is only applied to fields in the editor, the rest would just stay in memory for the life of the process.
+			if (!IsRuntimeMetaData(Key))
+			{
+				return;
+			}
+#endif
 			MetaDataMap.Add(Key, Value);
-		}
+		});
 	}
 }
 
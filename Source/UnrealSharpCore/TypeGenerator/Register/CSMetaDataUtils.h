@@ -1,7 +1,7 @@
 ﻿#pragma once
 
 #include "CoreMinimal.h"
-#include "Dom/JsonObject.h"
+#include "CSMetaDataView.h"
 #include "MetaData/CSFunctionMetaData.h"
 #include "UObject/ObjectMacros.h"
 
@@ -9,15 +9,15 @@ struct FCSFieldName;
 
 namespace FCSMetaDataUtils
 {
-	void SerializeFunctions(const TArray<TSharedPtr<FJsonValue>>& FunctionsInfo, TArray<FCSFunctionMetaData>& FunctionMetaData);
-	void SerializeProperties(const TArray<TSharedPtr<FJsonValue>>& PropertiesInfo, TArray<FCSPropertyMetaData>& PropertiesMetaData, EPropertyFlags DefaultFlags = CPF_None);
-	void SerializeProperty(const TSharedPtr<FJsonObject>& PropertyMetaData, FCSPropertyMetaData& PropertiesMetaData, EPropertyFlags DefaultFlags = CPF_None);
+	void SerializeFunctions(const FCSMetaDataArrayView& FunctionsInfo, TArray<FCSFunctionMetaData>& FunctionMetaData);
+	void SerializeProperties(const FCSMetaDataArrayView& PropertiesInfo, TArray<FCSPropertyMetaData>& PropertiesMetaData, EPropertyFlags DefaultFlags = CPF_None);
+	void SerializeProperty(const FCSMetaDataView& PropertyMetaData, FCSPropertyMetaData& PropertiesMetaData, EPropertyFlags DefaultFlags = CPF_None);
 
 	template<typename FlagType>
-	FlagType GetFlags(const TSharedPtr<FJsonObject>& PropertyInfo, const FString& StringField)
+	FlagType GetFlags(const FCSMetaDataView& PropertyInfo, const FString& StringField)
 	{
 		FString FoundStringField;
-		PropertyInfo->TryGetStringField(StringField, FoundStringField);
+		PropertyInfo.TryGetStringField(*StringField, FoundStringField);
 
 		if (FoundStringField.IsEmpty())
 		{
@@ -29,7 +29,11 @@ namespace FCSMetaDataUtils
 		return static_cast<FlagType>(FunctionFlagsInt);
 	};
 	
-	void SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject, TMap<FString, FString>& MetaDataMap);
+	// Outside the editor only these keys are kept when metadata is parsed. Anything read from FCSMemberMetaData or
+	// FCSTypeReferenceMetaData at runtime has to be listed here.
+	bool IsRuntimeMetaData(const FString& Key);
+	
+	void SerializeFromJson(const FCSMetaDataView& JsonObject, TMap<FString, FString>& MetaDataMap);
 	UNREALSHARPCORE_API void ApplyMetaData(const TMap<FString, FString>& MetaDataMap, UField* Field);
 	UNREALSHARPCORE_API void ApplyMetaData(const TMap<FString, FString>& MetaDataMap, FField* Field);
 
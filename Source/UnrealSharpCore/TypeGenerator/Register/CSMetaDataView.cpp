@@ -0,0 +1,465 @@
+﻿#include "CSMetaDataView.h"
+
+bool FCSBinaryMetaData::Open(const FString& Path)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FCSBinaryMetaData::Open);
+
+	if (!File.Open(Path) || File.GetData().Num() > MAX_int32)
+	{
+		return false;
+	}
+	
+	Data = TConstArrayView<uint8>(File.GetData().GetData(), static_cast<int32>(File.GetData().Num()));
+
+	uint32 FileMagic, FileVersion;
+	if (!ReadUInt32(0, FileMagic) || !ReadUInt32(4, FileVersion) || !ReadUInt32(8, StringTableOffset) || !ReadUInt32(12, RootOffset))
+	{
+		return false;
+	}
+
+	if (FileMagic != Magic || FileVersion != Version || !ReadUInt32(StringTableOffset, NumStrings))
+	{
+		return false;
+	}
+
+	ENodeTag RootTag;
+	return IsInBounds(StringTableOffset + sizeof(uint32), NumStrings * 2 * sizeof(uint32)) && ReadTag(RootOffset, RootTag) && RootTag == ENodeTag::Object;
+}
+
+bool FCSBinaryMetaData::ReadTag(uint32 Offset, ENodeTag& OutTag) const
+{
+	if (!IsInBounds(Offset, sizeof(uint8)))
+	{
+		return false;
+	}
+
+	OutTag = static_cast<ENodeTag>(Data[Offset]);
+	return true;
+}
+
+bool FCSBinaryMetaData::ReadUInt32(uint32 Offset, uint32& OutValue) const
+{
+	if (!IsInBounds(Offset, sizeof(uint32)))
+	{
+		return false;
+	}
+
+	FMemory::Memcpy(&OutValue, Data.GetData() + Offset, sizeof(uint32));
+	return true;
+}
+
+bool FCSBinaryMetaData::ReadDouble(uint32 Offset, double& OutValue) const
+{
+	if (!IsInBounds(Offset, sizeof(double)))
+	{
+		return false;
+	}
+
+	FMemory::Memcpy(&OutValue, Data.GetData() + Offset, sizeof(double));
+	return true;
+}
+
+bool FCSBinaryMetaData::GetStringBytes(uint32 StringIndex, const UTF8CHAR*& OutBytes, uint32& OutLength) const
+{
+	if (StringIndex >= NumStrings)
+	{
+		return false;
+	}
+
+	const uint32 EntryOffset = StringTableOffset + sizeof(uint32) + StringIndex * 2 * sizeof(uint32);
+	uint32 BytesOffset;
+	if (!ReadUInt32(EntryOffset, BytesOffset) || !ReadUInt32(EntryOffset + sizeof(uint32), OutLength) || !IsInBounds(BytesOffset, OutLength))
+	{
+		return false;
+	}
+
+	OutBytes = reinterpret_cast<const UTF8CHAR*>(Data.GetData() + BytesOffset);
+	return true;
+}
+
+FString FCSBinaryMetaData::GetString(uint32 StringIndex) const
+{
+	const UTF8CHAR* Bytes;
+	uint32 Length;
+	if (!GetStringBytes(StringIndex, Bytes, Length) || Length == 0)
+	{
+		return FString();
+	}
+
+	FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Bytes), Length);
+	return FString(Converted.Length(), Converted.Get());
+}
+
+FName FCSBinaryMetaData::GetName(uint32 StringIndex) const
+{
+	const UTF8CHAR* Bytes;
+	uint32 Length;
+	if (!GetStringBytes(StringIndex, Bytes, Length) || Length == 0)
+	{
+		return NAME_None;
+	}
+
+	return FName(static_cast<int32>(Length), Bytes);
+}
+
+bool FCSBinaryMetaData::StringEquals(uint32 StringIndex, const TCHAR* Other) const
+{
+	const UTF8CHAR* Bytes;
+	uint32 Length;
+	if (!GetStringBytes(StringIndex, Bytes, Length))
+	{
+		return false;
+	}
+
+	// Field names are plain ASCII, so compare byte by byte instead of converting.
+	for (uint32 i = 0; i < Length; ++i)
+	{
+		if (Other[i] == TEXT('\0') || static_cast<TCHAR>(Bytes[i]) != Other[i])
+		{
+			return false;
+		}
+	}
+
+	return Other[Length] == TEXT('\0');
+}
+
+bool FCSBinaryMetaData::FindField(uint32 ObjectOffset, const TCHAR* FieldName, uint32& OutValueOffset) const
+{
+	ENodeTag Tag;
+	uint32 NumFields;
+	if (!ReadTag(ObjectOffset, Tag) || Tag != ENodeTag::Object || !ReadUInt32(ObjectOffset + 1, NumFields))
+	{
+		return false;
+	}
+
+	uint32 FieldOffset = ObjectOffset + 1 + sizeof(uint32);
+	for (uint32 i = 0; i < NumFields; ++i, FieldOffset += 2 * sizeof(uint32))
+	{
+		uint32 KeyIndex;
+		if (!ReadUInt32(FieldOffset, KeyIndex))
+		{
+			return false;
+		}
+
+		if (StringEquals(KeyIndex, FieldName))
+		{
+			return ReadUInt32(FieldOffset + sizeof(uint32), OutValueOffset);
+		}
+	}
+
+	return false;
+}
+
+namespace
+{
+	bool TryGetBinaryString(const FCSBinaryMetaData& BinaryMetaData, uint32 ValueOffset, FString& OutString)
+	{
+		using ENodeTag = FCSBinaryMetaData::ENodeTag;
+
+		ENodeTag Tag;
+		if (!BinaryMetaData.ReadTag(ValueOffset, Tag))
+		{
+			return false;
+		}
+
+		switch (Tag)
+		{
+		case ENodeTag::String:
+			{
+				uint32 StringIndex;
+				if (!BinaryMetaData.ReadUInt32(ValueOffset + 1, StringIndex))
+				{
+					return false;
+				}
+
+				OutString = BinaryMetaData.GetString(StringIndex);
+				return true;
+			}
+		case ENodeTag::Number:
+			{
+				double Number;
+				if (!BinaryMetaData.ReadDouble(ValueOffset + 1, Number))
+				{
+					return false;
+				}
+
+				OutString = FString::SanitizeFloat(Number, 0);
+				return true;
+			}
+		case ENodeTag::True:
+			OutString = TEXT("true");
+			return true;
+		case ENodeTag::False:
+			OutString = TEXT("false");
+			return true;
+		default:
+			return false;
+		}
+	}
+}
+
+FString FCSMetaDataView::GetStringField(const TCHAR* FieldName) const
+{
+	FString String;
+	TryGetStringField(FieldName, String);
+	return String;
+}
+
+bool FCSMetaDataView::TryGetStringField(const TCHAR* FieldName, FString& OutString) const
+{
+	if (JsonObject)
+	{
+		return JsonObject->TryGetStringField(FieldName, OutString);
+	}
+
+	uint32 ValueOffset;
+	return BinaryMetaData && BinaryMetaData->FindField(Offset, FieldName, ValueOffset) && TryGetBinaryString(*BinaryMetaData, ValueOffset, OutString);
+}
+
+FName FCSMetaDataView::GetNameField(const TCHAR* FieldName) const
+{
+	FName Name;
+	TryGetNameField(FieldName, Name);
+	return Name;
+}
+
+bool FCSMetaDataView::TryGetNameField(const TCHAR* FieldName, FName& OutName) const
+{
+	if (JsonObject)
+	{
+		FString String;
+		if (!JsonObject->TryGetStringField(FieldName, String))
+		{
+			return false;
+		}
+
+		OutName = *String;
+		return true;
+	}
+
+	uint32 ValueOffset;
+	FCSBinaryMetaData::ENodeTag Tag;
+	if (!BinaryMetaData || !BinaryMetaData->FindField(Offset, FieldName, ValueOffset) || !BinaryMetaData->ReadTag(ValueOffset, Tag))
+	{
+		return false;
+	}
+
+	// Names are always written as strings, anything else goes through the string conversion.
+	if (Tag != FCSBinaryMetaData::ENodeTag::String)
+	{
+		FString String;
+		if (!TryGetBinaryString(*BinaryMetaData, ValueOffset, String))
+		{
+			return false;
+		}
+
+		OutName = *String;
+		return true;
+	}
+
+	uint32 StringIndex;
+	if (!BinaryMetaData->ReadUInt32(ValueOffset + 1, StringIndex))
+	{
+		return false;
+	}
+
+	OutName = BinaryMetaData->GetName(StringIndex);
+	return true;
+}
+
+int32 FCSMetaDataView::GetIntegerField(const TCHAR* FieldName) const
+{
+	if (JsonObject)
+	{
+		return JsonObject->GetIntegerField(FieldName);
+	}
+
+	uint32 ValueOffset;
+	FCSBinaryMetaData::ENodeTag Tag;
+	double Number = 0.0;
+
+	if (BinaryMetaData && BinaryMetaData->FindField(Offset, FieldName, ValueOffset)
+		&& BinaryMetaData->ReadTag(ValueOffset, Tag) && Tag == FCSBinaryMetaData::ENodeTag::Number)
+	{
+		BinaryMetaData->ReadDouble(ValueOffset + 1, Number);
+	}
+
+	return static_cast<int32>(Number);
+}
+
+bool FCSMetaDataView::TryGetBoolField(const TCHAR* FieldName, bool& OutBool) const
+{
+	if (JsonObject)
+	{
+		return JsonObject->TryGetBoolField(FieldName, OutBool);
+	}
+
+	uint32 ValueOffset;
+	FCSBinaryMetaData::ENodeTag Tag;
+	if (!BinaryMetaData || !BinaryMetaData->FindField(Offset, FieldName, ValueOffset) || !BinaryMetaData->ReadTag(ValueOffset, Tag))
+	{
+		return false;
+	}
+
+	if (Tag != FCSBinaryMetaData::ENodeTag::True && Tag != FCSBinaryMetaData::ENodeTag::False)
+	{
+		return false;
+	}
+
+	OutBool = Tag == FCSBinaryMetaData::ENodeTag::True;
+	return true;
+}
+
+FCSMetaDataView FCSMetaDataView::GetObjectField(const TCHAR* FieldName) const
+{
+	FCSMetaDataView Object;
+	TryGetObjectField(FieldName, Object);
+	return Object;
+}
+
+bool FCSMetaDataView::TryGetObjectField(const TCHAR* FieldName, FCSMetaDataView& OutObject) const
+{
+	if (JsonObject)
+	{
+		const TSharedPtr<FJsonObject>* FoundObject;
+		if (!JsonObject->TryGetObjectField(FieldName, FoundObject))
+		{
+			return false;
+		}
+
+		OutObject = FCSMetaDataView(*FoundObject);
+		return true;
+	}
+
+	uint32 ValueOffset;
+	FCSBinaryMetaData::ENodeTag Tag;
+	if (!BinaryMetaData || !BinaryMetaData->FindField(Offset, FieldName, ValueOffset)
+		|| !BinaryMetaData->ReadTag(ValueOffset, Tag) || Tag != FCSBinaryMetaData::ENodeTag::Object)
+	{
+		return false;
+	}
+
+	OutObject = FCSMetaDataView(BinaryMetaData, ValueOffset);
+	return true;
+}
+
+FCSMetaDataArrayView FCSMetaDataView::GetArrayField(const TCHAR* FieldName) const
+{
+	FCSMetaDataArrayView Array;
+	TryGetArrayField(FieldName, Array);
+	return Array;
+}
+
+bool FCSMetaDataView::TryGetArrayField(const TCHAR* FieldName, FCSMetaDataArrayView& OutArray) const
+{
+	if (JsonObject)
+	{
+		const TArray<TSharedPtr<FJsonValue>>* FoundArray;
+		if (!JsonObject->TryGetArrayField(FieldName, FoundArray))
+		{
+			return false;
+		}
+
+		OutArray = FCSMetaDataArrayView(FoundArray);
+		return true;
+	}
+
+	uint32 ValueOffset;
+	FCSBinaryMetaData::ENodeTag Tag;
+	if (!BinaryMetaData || !BinaryMetaData->FindField(Offset, FieldName, ValueOffset)
+		|| !BinaryMetaData->ReadTag(ValueOffset, Tag) || Tag != FCSBinaryMetaData::ENodeTag::Array)
+	{
+		return false;
+	}
+
+	OutArray = FCSMetaDataArrayView(BinaryMetaData, ValueOffset);
+	return true;
+}
+
+void FCSMetaDataView::ForEachStringField(TFunctionRef<void(const FString& Key, const FString& Value)> Callback) const
+{
+	if (JsonObject)
+	{
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : JsonObject->Values)
+		{
+			FString Value;
+			JsonObject->TryGetStringField(Pair.Key, Value);
+			Callback(Pair.Key, Value);
+		}
+		
+		return;
+	}
+
+	FCSBinaryMetaData::ENodeTag Tag;
+	uint32 NumFields;
+	if (!BinaryMetaData || !BinaryMetaData->ReadTag(Offset, Tag) || Tag != FCSBinaryMetaData::ENodeTag::Object || !BinaryMetaData->ReadUInt32(Offset + 1, NumFields))
+	{
+		return;
+	}
+
+	uint32 FieldOffset = Offset + 1 + sizeof(uint32);
+	for (uint32 i = 0; i < NumFields; ++i, FieldOffset += 2 * sizeof(uint32))
+	{
+		uint32 KeyIndex, ValueOffset;
+		if (!BinaryMetaData->ReadUInt32(FieldOffset, KeyIndex) || !BinaryMetaData->ReadUInt32(FieldOffset + sizeof(uint32), ValueOffset))
+		{
+			return;
+		}
+
+		FString Value;
+		TryGetBinaryString(*BinaryMetaData, ValueOffset, Value);
+		Callback(BinaryMetaData->GetString(KeyIndex), Value);
+	}
+}
+
+FCSMetaDataArrayView::FCSMetaDataArrayView(const FCSBinaryMetaData* InBinaryMetaData, uint32 InOffset)
+	: BinaryMetaData(InBinaryMetaData)
+	, Offset(InOffset)
+{
+	uint32 Count;
+	if (BinaryMetaData->ReadUInt32(Offset + 1, Count))
+	{
+		NumElements = static_cast<int32>(Count);
+	}
+}
+
+uint32 FCSMetaDataArrayView::GetElementOffset(int32 Index) const
+{
+	uint32 ElementOffset = 0;
+	BinaryMetaData->ReadUInt32(Offset + 1 + sizeof(uint32) * (1 + Index), ElementOffset);
+	return ElementOffset;
+}
+
+FCSMetaDataView FCSMetaDataArrayView::GetObject(int32 Index) const
+{
+	check(Index >= 0 && Index < NumElements);
+
+	if (JsonArray)
+	{
+		const TSharedPtr<FJsonObject>* Object;
+		return (*JsonArray)[Index]->TryGetObject(Object) ? FCSMetaDataView(*Object) : FCSMetaDataView();
+	}
+
+	const uint32 ElementOffset = GetElementOffset(Index);
+	FCSBinaryMetaData::ENodeTag Tag;
+	if (!BinaryMetaData->ReadTag(ElementOffset, Tag) || Tag != FCSBinaryMetaData::ENodeTag::Object)
+	{
+		return FCSMetaDataView();
+	}
+
+	return FCSMetaDataView(BinaryMetaData, ElementOffset);
+}
+
+FString FCSMetaDataArrayView::GetString(int32 Index) const
+{
+	check(Index >= 0 && Index < NumElements);
+
+	if (JsonArray)
+	{
+		return (*JsonArray)[Index]->AsString();
+	}
+
+	FString String;
+	TryGetBinaryString(*BinaryMetaData, GetElementOffset(Index), String);
+	return String;
+}
@@ -0,0 +1,126 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "Utils/CSMappedFile.h"
+
+struct FCSMetaDataArrayView;
+
+/**
+ * The type metadata the weaver writes next to each assembly, in its compact binary form (<assembly>.metadata.bin).
+ * It's the same value tree as the JSON file, but laid out so it can be memory-mapped and read in place.
+ *
+ * Layout, little-endian, all offsets are from the start of the file:
+ *   Header:       uint32 Magic, uint32 Version, uint32 StringTableOffset, uint32 RootOffset
+ *   String table: uint32 Count, then Count x (uint32 Offset, uint32 Length) pointing at UTF-8 bytes
+ *   Node:         uint8 Tag, followed by
+ *                   Number: double
+ *                   String: uint32 StringIndex
+ *                   Array:  uint32 Count, Count x uint32 ElementOffset
+ *                   Object: uint32 Count, Count x (uint32 KeyStringIndex, uint32 ValueOffset)
+ *
+ * Must match BinaryMetaDataWriter.cs in the weaver.
+ */
+class UNREALSHARPCORE_API FCSBinaryMetaData
+{
+public:
+	static constexpr uint32 Magic = 0x444D5355; // "USMD"
+	static constexpr uint32 Version = 1;
+
+	enum class ENodeTag : uint8
+	{
+		Null,
+		False,
+		True,
+		Number,
+		String,
+		Array,
+		Object,
+	};
+
+	// Maps the file and validates the header. Returns false if the file is missing, corrupt or from another version.
+	bool Open(const FString& Path);
+
+	uint32 GetRootOffset() const { return RootOffset; }
+
+	bool ReadTag(uint32 Offset, ENodeTag& OutTag) const;
+	bool ReadUInt32(uint32 Offset, uint32& OutValue) const;
+	bool ReadDouble(uint32 Offset, double& OutValue) const;
+
+	FString GetString(uint32 StringIndex) const;
+	
+	// Makes the name straight from the UTF-8 bytes in the file, without going through an FString.
+	FName GetName(uint32 StringIndex) const;
+	bool StringEquals(uint32 StringIndex, const TCHAR* Other) const;
+
+	// Finds the value node of a field in the object node at ObjectOffset.
+	bool FindField(uint32 ObjectOffset, const TCHAR* FieldName, uint32& OutValueOffset) const;
+
+private:
+	bool GetStringBytes(uint32 StringIndex, const UTF8CHAR*& OutBytes, uint32& OutLength) const;
+	bool IsInBounds(uint32 Offset, uint32 Size) const { return Offset <= static_cast<uint32>(Data.Num()) && Size <= static_cast<uint32>(Data.Num()) - Offset; }
+
+	FCSMappedFile File;
+	TConstArrayView<uint8> Data;
+	uint32 StringTableOffset = 0;
+	uint32 NumStrings = 0;
+	uint32 RootOffset = 0;
+};
+
+/**
+ * Read-only view of one object in the type metadata. Backed either by the JSON DOM or by FCSBinaryMetaData,
+ * so the metadata types can be serialized from both without building a DOM for the binary file.
+ * A view doesn't own anything, the JSON object or binary file must outlive it.
+ */
+struct UNREALSHARPCORE_API FCSMetaDataView
+{
+	FCSMetaDataView() = default;
+	FCSMetaDataView(const TSharedPtr<FJsonObject>& InJsonObject) : JsonObject(InJsonObject.Get()) {}
+	FCSMetaDataView(const FCSBinaryMetaData* InBinaryMetaData, uint32 InOffset) : BinaryMetaData(InBinaryMetaData), Offset(InOffset) {}
+
+	bool IsValid() const { return JsonObject || BinaryMetaData; }
+
+	FString GetStringField(const TCHAR* FieldName) const;
+	bool TryGetStringField(const TCHAR* FieldName, FString& OutString) const;
+	
+	// Most strings in the metadata end up as names, these skip the temporary FString for the binary metadata.
+	FName GetNameField(const TCHAR* FieldName) const;
+	bool TryGetNameField(const TCHAR* FieldName, FName& OutName) const;
+	int32 GetIntegerField(const TCHAR* FieldName) const;
+	bool TryGetBoolField(const TCHAR* FieldName, bool& OutBool) const;
+
+	FCSMetaDataView GetObjectField(const TCHAR* FieldName) const;
+	bool TryGetObjectField(const TCHAR* FieldName, FCSMetaDataView& OutObject) const;
+
+	FCSMetaDataArrayView GetArrayField(const TCHAR* FieldName) const;
+	bool TryGetArrayField(const TCHAR* FieldName, FCSMetaDataArrayView& OutArray) const;
+
+	// Calls the callback for every field, with the value converted to a string like FJsonValue::TryGetString does.
+	void ForEachStringField(TFunctionRef<void(const FString& Key, const FString& Value)> Callback) const;
+
+private:
+	const FJsonObject* JsonObject = nullptr;
+	const FCSBinaryMetaData* BinaryMetaData = nullptr;
+	uint32 Offset = 0;
+};
+
+// Read-only view of an array in the type metadata, see FCSMetaDataView.
+struct UNREALSHARPCORE_API FCSMetaDataArrayView
+{
+	FCSMetaDataArrayView() = default;
+	FCSMetaDataArrayView(const TArray<TSharedPtr<FJsonValue>>* InJsonArray) : JsonArray(InJsonArray), NumElements(InJsonArray->Num()) {}
+	FCSMetaDataArrayView(const FCSBinaryMetaData* InBinaryMetaData, uint32 InOffset);
+
+	int32 Num() const { return NumElements; }
+
+	FCSMetaDataView GetObject(int32 Index) const;
+	FString GetString(int32 Index) const;
+
+private:
+	uint32 GetElementOffset(int32 Index) const;
+
+	const TArray<TSharedPtr<FJsonValue>>* JsonArray = nullptr;
+	const FCSBinaryMetaData* BinaryMetaData = nullptr;
+	uint32 Offset = 0;
+	int32 NumElements = 0;
+};
@@ -5,6 +5,7 @@
 #include "Engine/InheritableComponentHandler.h"
 #include "Engine/SCS_Node.h"
 #include "Engine/SimpleConstructionScript.h"
+#include "TypeGenerator/CSClass.h"
 #include "TypeGenerator/Factories/PropertyGenerators/CSPropertyGenerator.h"
 #include "TypeGenerator/Register/MetaData/CSDefaultComponentMetaData.h"
 #include "TypeGenerator/Register/MetaData/CSObjectMetaData.h"
@@ -21,6 +22,34 @@ void FCSSimpleConstructionScriptBuilder::BuildSimpleConstructionScript(UClass* O
 	
 	USimpleConstructionScript* CurrentSCS = SimpleConstructionScript->Get();
 	TArray<FCSAttachmentNode> AttachmentNodes;
+
+	// Components whose metadata didn't change since the last build keep their node as is, unless they attach to a component
+	// of another class, which may have changed on its own.
+	UCSClass* ManagedClass = Cast<UCSClass>(Outer);
+	TMap<FName, TSharedPtr<FCSDefaultComponentMetaData>> BuiltComponents;
+	bool bCanSkipUnchanged = ManagedClass != nullptr;
+
+	if (IsValid(CurrentSCS))
+	{
+		TSet<FName> ComponentNames;
+		for (const FCSPropertyMetaData& PropertyMetaData : PropertyMetaDatas)
+		{
+			if (PropertyMetaData.Type->PropertyType == ECSPropertyType::DefaultComponent)
+			{
+				ComponentNames.Add(PropertyMetaData.Name);
+			}
+		}
+
+		// Components removed in C# take their node with them. Their children need their attachment resolved again.
+		for (USCS_Node* Node : CurrentSCS->GetAllNodes())
+		{
+			if (!ComponentNames.Contains(Node->GetVariableName()))
+			{
+				CurrentSCS->RemoveNodeAndPromoteChildren(Node);
+				bCanSkipUnchanged = false;
+			}
+		}
+	}
 	
 	for (const FCSPropertyMetaData& PropertyMetaData : PropertyMetaDatas)
 	{
@@ -37,6 +66,7 @@ void FCSSimpleConstructionScriptBuilder::BuildSimpleConstructionScript(UClass* O
 	
 		TSharedPtr<FCSDefaultComponentMetaData> ObjectMetaData = PropertyMetaData.GetTypeMetaData<FCSDefaultComponentMetaData>();
 		UClass* Class = ObjectMetaData->InnerType.GetOwningClass();
+		BuiltComponents.Add(PropertyMetaData.Name, ObjectMetaData);
 
 		USCS_Node* Node = CurrentSCS->FindSCSNode(PropertyMetaData.Name);
 	
@@ -54,6 +84,14 @@ void FCSSimpleConstructionScriptBuilder::BuildSimpleConstructionScript(UClass* O
 			UpdateChildren(Outer, Node);
 			UpdateTemplateComponent(Node, Outer, Class, PropertyMetaData.Name);
 		}
+		else if (bCanSkipUnchanged && !Node->bIsParentComponentNative && Node->ParentComponentOrVariableName.IsNone())
+		{
+			const TSharedPtr<FCSDefaultComponentMetaData> PreviousMetaData = ManagedClass->GetBuiltDefaultComponents().FindRef(PropertyMetaData.Name);
+			if (PreviousMetaData.IsValid() && ObjectMetaData->IsEqual(PreviousMetaData))
+			{
+				continue;
+			}
+		}
 		
 		if (Node->IsRootNode())
 		{
@@ -145,6 +183,11 @@ void FCSSimpleConstructionScriptBuilder::BuildSimpleConstructionScript(UClass* O
 			}
 		}
 	}
+
+	if (ManagedClass)
+	{
+		ManagedClass->GetBuiltDefaultComponents() = MoveTemp(BuiltComponents);
+	}
 }
 
 USCS_Node* FCSSimpleConstructionScriptBuilder::CreateNode(USimpleConstructionScript* SimpleConstructionScript, UObject* GeneratedClass, UClass* NewComponentClass, FName NewComponentVariableName)
@@ -2,48 +2,45 @@
 
 #include "TypeGenerator/Register/CSMetaDataUtils.h"
 
-void FCSClassMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
+void FCSClassMetaData::SerializeFromJson(const FCSMetaDataView& JsonObject)
 {
 	FCSTypeReferenceMetaData::SerializeFromJson(JsonObject);
 
 	ClassFlags = FCSMetaDataUtils::GetFlags<EClassFlags>(JsonObject,"ClassFlags");
 	
-	ParentClass.SerializeFromJson(JsonObject->GetObjectField(TEXT("ParentClass")));
+	ParentClass.SerializeFromJson(JsonObject.GetObjectField(TEXT("ParentClass")));
 
-	FString ClassConfigNameStr;
-	if (JsonObject->TryGetStringField(TEXT("ConfigCategory"), ClassConfigNameStr))
-	{
-		ClassConfigName = *ClassConfigNameStr;
-	}
+	JsonObject.TryGetNameField(TEXT("ConfigCategory"), ClassConfigName);
+	JsonObject.TryGetBoolField(TEXT("HasTrivialConstructor"), bHasTrivialConstructor);
 
-	const TArray<TSharedPtr<FJsonValue>>* FoundInterfaces;
-	if (JsonObject->TryGetArrayField(TEXT("Interfaces"), FoundInterfaces))
+	FCSMetaDataArrayView FoundInterfaces;
+	if (JsonObject.TryGetArrayField(TEXT("Interfaces"), FoundInterfaces))
 	{
-		for (const TSharedPtr<FJsonValue>& Interface : *FoundInterfaces)
+		for (int32 i = 0; i < FoundInterfaces.Num(); ++i)
 		{
 			FCSTypeReferenceMetaData& InterfaceMetaData = Interfaces.AddDefaulted_GetRef();
-			InterfaceMetaData.SerializeFromJson(Interface->AsObject());
+			InterfaceMetaData.SerializeFromJson(FoundInterfaces.GetObject(i));
 		}
 	}
 
-	const TArray<TSharedPtr<FJsonValue>>* FoundFunctions;
-	if (JsonObject->TryGetArrayField(TEXT("Functions"), FoundFunctions))
+	FCSMetaDataArrayView FoundFunctions;
+	if (JsonObject.TryGetArrayField(TEXT("Functions"), FoundFunctions))
 	{
-		FCSMetaDataUtils::SerializeFunctions(*FoundFunctions, Functions);
+		FCSMetaDataUtils::SerializeFunctions(FoundFunctions, Functions);
 	}
 	
-	const TArray<TSharedPtr<FJsonValue>>* FoundVirtualFunctions;
-	if (JsonObject->TryGetArrayField(TEXT("VirtualFunctions"), FoundVirtualFunctions))
+	FCSMetaDataArrayView FoundVirtualFunctions;
+	if (JsonObject.TryGetArrayField(TEXT("VirtualFunctions"), FoundVirtualFunctions))
 	{
-		for (const TSharedPtr<FJsonValue>& VirtualFunction : *FoundVirtualFunctions)
+		for (int32 i = 0; i < FoundVirtualFunctions.Num(); ++i)
 		{
-			VirtualFunctions.Add(*VirtualFunction->AsObject()->GetStringField(TEXT("Name")));
+			VirtualFunctions.Add(FoundVirtualFunctions.GetObject(i).GetNameField(TEXT("Name")));
 		}
 	}
 
-	const TArray<TSharedPtr<FJsonValue>>* FoundProperties;
-	if (JsonObject->TryGetArrayField(TEXT("Properties"), FoundProperties))
+	FCSMetaDataArrayView FoundProperties;
+	if (JsonObject.TryGetArrayField(TEXT("Properties"), FoundProperties))
 	{
-		FCSMetaDataUtils::SerializeProperties(*FoundProperties, Properties);
+		FCSMetaDataUtils::SerializeProperties(FoundProperties, Properties);
 	}
 }
@@ -21,14 +21,47 @@ struct FCSClassMetaData : public FCSTypeReferenceMetaData
 	bool bCanTick = false;
 	bool bOverrideInput = false;
 
+	// The C# default constructor doesn't write to the native object, see ECSManagedObjectCreation.
+	bool bHasTrivialConstructor = false;
+
 	EClassFlags ClassFlags;
 
 	FName ClassConfigName;
 
 	// FTypeReferenceMetaData interface implementation
-	virtual void SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject) override;
+	virtual void SerializeFromJson(const FCSMetaDataView& JsonObject) override;
 	// End of implementation
 	
+	// True if a class built from Old can be patched into this one without changing its layout: same parent, properties,
+	// interfaces and flags, and none of the functions or overrides of Old were removed or changed.
+	bool CanPatchInPlace(const FCSClassMetaData& Old) const
+	{
+		if (ParentClass != Old.ParentClass || Properties != Old.Properties || Interfaces != Old.Interfaces
+			|| ClassFlags != Old.ClassFlags || ClassConfigName != Old.ClassConfigName
+			|| bCanTick != Old.bCanTick || bOverrideInput != Old.bOverrideInput || bHasTrivialConstructor != Old.bHasTrivialConstructor)
+		{
+			return false;
+		}
+
+		for (const FCSFunctionMetaData& OldFunction : Old.Functions)
+		{
+			if (!Functions.Contains(OldFunction))
+			{
+				return false;
+			}
+		}
+
+		for (const FName& OldVirtualFunction : Old.VirtualFunctions)
+		{
+			if (!VirtualFunctions.Contains(OldVirtualFunction))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+	
 	bool operator==(const FCSClassMetaData& Other) const
 	{
 		if (!FCSTypeReferenceMetaData::operator==(Other))
@@ -43,6 +76,7 @@ struct FCSClassMetaData : public FCSTypeReferenceMetaData
 				Interfaces == Other.Interfaces &&
 				bCanTick == Other.bCanTick &&
 				bOverrideInput == Other.bOverrideInput &&
+				bHasTrivialConstructor == Other.bHasTrivialConstructor &&
 				ClassFlags == Other.ClassFlags &&
 				ClassConfigName == Other.ClassConfigName;
 	}
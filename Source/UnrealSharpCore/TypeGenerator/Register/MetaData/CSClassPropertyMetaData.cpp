@@ -1,9 +1,9 @@
 ﻿#include "CSClassPropertyMetaData.h"
 
-void FCSClassPropertyMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
+void FCSClassPropertyMetaData::SerializeFromJson(const FCSMetaDataView& JsonObject)
 {
 	FCSUnrealType::SerializeFromJson(JsonObject);
-	TypeRef.SerializeFromJson(JsonObject->GetObjectField(TEXT("InnerType")));
+	TypeRef.SerializeFromJson(JsonObject.GetObjectField(TEXT("InnerType")));
 }
 
 bool FCSClassPropertyMetaData::IsEqual(TSharedPtr<FCSUnrealType> Other) const
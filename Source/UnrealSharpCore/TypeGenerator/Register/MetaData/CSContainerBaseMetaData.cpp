@@ -1,10 +1,10 @@
 ﻿#include "CSContainerBaseMetaData.h"
 #include "TypeGenerator/Register/CSMetaDataUtils.h"
 
-void FCSContainerBaseMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
+void FCSContainerBaseMetaData::SerializeFromJson(const FCSMetaDataView& JsonObject)
 {
 	FCSUnrealType::SerializeFromJson(JsonObject);
-	FCSMetaDataUtils::SerializeProperty(JsonObject->GetObjectField(TEXT("InnerProperty")), InnerProperty);
+	FCSMetaDataUtils::SerializeProperty(JsonObject.GetObjectField(TEXT("InnerProperty")), InnerProperty);
 }
 
 bool FCSContainerBaseMetaData::IsEqual(TSharedPtr<FCSUnrealType> Other) const
@@ -7,13 +7,13 @@ bool FCSDefaultComponentMetaData::HasValidAttachment() const
 	return AttachmentComponent != NAME_None;
 }
 
-void FCSDefaultComponentMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
+void FCSDefaultComponentMetaData::SerializeFromJson(const FCSMetaDataView& JsonObject)
 {
 	FCSObjectMetaData::SerializeFromJson(JsonObject);
-	JsonObject->TryGetBoolField(TEXT("IsRootComponent"), IsRootComponent);
+	JsonObject.TryGetBoolField(TEXT("IsRootComponent"), IsRootComponent);
 
 	FString AttachmentComponentStr;
-	if (JsonObject->TryGetStringField(TEXT("AttachmentComponent"), AttachmentComponentStr))
+	if (JsonObject.TryGetStringField(TEXT("AttachmentComponent"), AttachmentComponentStr))
 	{
 		if (!AttachmentComponentStr.IsEmpty())
 		{
@@ -29,7 +29,7 @@ void FCSDefaultComponentMetaData::SerializeFromJson(const TSharedPtr<FJsonObject
 	}
 
 	FString AttachmentSocketStr;
-	if (JsonObject->TryGetStringField(TEXT("AttachmentSocket"), AttachmentSocketStr))
+	if (JsonObject.TryGetStringField(TEXT("AttachmentSocket"), AttachmentSocketStr))
 	{
 		if (!AttachmentSocketStr.IsEmpty())
 		{
@@ -12,7 +12,7 @@ struct FCSDefaultComponentMetaData : public FCSObjectMetaData
 	bool HasValidAttachment() const;
 
 	//FUnrealType interface implementation
-	virtual void SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject) override;
+	virtual void SerializeFromJson(const FCSMetaDataView& JsonObject) override;
 	virtual bool IsEqual(TSharedPtr<FCSUnrealType> Other) const override;
 	//End of implementation
 };
@@ -1,8 +1,8 @@
 ﻿#include "CSDelegateMetaData.h"
 
-void FCSDelegateMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
+void FCSDelegateMetaData::SerializeFromJson(const FCSMetaDataView& JsonObject)
 {
 	FCSTypeReferenceMetaData::SerializeFromJson(JsonObject);
-	TSharedPtr<FJsonObject> SignatureFunctionArray = JsonObject->GetObjectField(TEXT("Signature"));
+	FCSMetaDataView SignatureFunctionArray = JsonObject.GetObjectField(TEXT("Signature"));
 	SignatureFunction.SerializeFromJson(SignatureFunctionArray);
 }
@@ -10,7 +10,7 @@ struct FCSDelegateMetaData : public FCSTypeReferenceMetaData
 	FCSFunctionMetaData SignatureFunction;
 
 	//FTypeMetaData interface implementation
-	virtual void SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject) override;
+	virtual void SerializeFromJson(const FCSMetaDataView& JsonObject) override;
 	//End of implementation
 
 	bool operator ==(const FCSDelegateMetaData& Other) const
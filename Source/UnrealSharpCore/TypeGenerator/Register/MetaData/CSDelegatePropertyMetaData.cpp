@@ -1,10 +1,10 @@
 ﻿#include "CSDelegatePropertyMetaData.h"
 
-void FCSDelegatePropertyMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
+void FCSDelegatePropertyMetaData::SerializeFromJson(const FCSMetaDataView& JsonObject)
 {
 	FCSUnrealType::SerializeFromJson(JsonObject);
 
-	TSharedPtr<FJsonObject> DelegateObject = JsonObject->GetObjectField(TEXT("UnrealDelegateType"));
+	FCSMetaDataView DelegateObject = JsonObject.GetObjectField(TEXT("UnrealDelegateType"));
 	Delegate.SerializeFromJson(DelegateObject);
 }
 
@@ -1,15 +1,16 @@
 ﻿#include "CSEnumMetaData.h"
 
-void FCSEnumMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
+void FCSEnumMetaData::SerializeFromJson(const FCSMetaDataView& JsonObject)
 {
 	FCSTypeReferenceMetaData::SerializeFromJson(JsonObject);
 
-	const TArray<TSharedPtr<FJsonValue>>* EnumValues;
-	if (JsonObject->TryGetArrayField(TEXT("Items"), EnumValues))
+	FCSMetaDataArrayView EnumValues;
+	if (JsonObject.TryGetArrayField(TEXT("Items"), EnumValues))
 	{
-		for (const TSharedPtr<FJsonValue>& Item : *EnumValues)
+		Items.Reserve(EnumValues.Num());
+		for (int32 i = 0; i < EnumValues.Num(); ++i)
 		{
-			Items.Add(*Item->AsString());
+			Items.Add(*EnumValues.GetString(i));
 		}
 	}
 }
\ No newline at end of file
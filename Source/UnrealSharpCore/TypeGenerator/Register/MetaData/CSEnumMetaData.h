@@ -9,7 +9,7 @@ struct FCSEnumMetaData : public FCSTypeReferenceMetaData
 	TArray<FName> Items;
 
 	//FTypeMetaData interface implementation
-	virtual void SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject) override;
+	virtual void SerializeFromJson(const FCSMetaDataView& JsonObject) override;
 	//End of implementation
 
 	bool operator ==(const FCSEnumMetaData& Other) const
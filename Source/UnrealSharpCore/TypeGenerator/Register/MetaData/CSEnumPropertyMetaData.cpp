@@ -1,9 +1,9 @@
 ﻿#include "CSEnumPropertyMetaData.h"
 
-void FCSEnumPropertyMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
+void FCSEnumPropertyMetaData::SerializeFromJson(const FCSMetaDataView& JsonObject)
 {
 	FCSUnrealType::SerializeFromJson(JsonObject);
-	InnerProperty.SerializeFromJson(JsonObject->GetObjectField(TEXT("InnerProperty")));
+	InnerProperty.SerializeFromJson(JsonObject.GetObjectField(TEXT("InnerProperty")));
 }
 
 bool FCSEnumPropertyMetaData::IsEqual(TSharedPtr<FCSUnrealType> Other) const
@@ -2,25 +2,25 @@
 
 #include "TypeGenerator/Register/CSMetaDataUtils.h"
 
-void FCSFunctionMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
+void FCSFunctionMetaData::SerializeFromJson(const FCSMetaDataView& JsonObject)
 {
 	FCSMemberMetaData::SerializeFromJson(JsonObject);
 
-	const TArray<TSharedPtr<FJsonValue>>* ParametersArrayField;
-	if (JsonObject->TryGetArrayField(TEXT("Parameters"), ParametersArrayField))
+	FCSMetaDataArrayView ParametersArrayField;
+	if (JsonObject.TryGetArrayField(TEXT("Parameters"), ParametersArrayField))
 	{
-		FCSMetaDataUtils::SerializeProperties(*ParametersArrayField, Parameters);
+		FCSMetaDataUtils::SerializeProperties(ParametersArrayField, Parameters);
 	}
 
-	const TSharedPtr<FJsonObject>* ReturnValueObject;
-	if (JsonObject->TryGetObjectField(TEXT("ReturnValue"), ReturnValueObject))
+	FCSMetaDataView ReturnValueObject;
+	if (JsonObject.TryGetObjectField(TEXT("ReturnValue"), ReturnValueObject))
 	{
-		FCSMetaDataUtils::SerializeProperty(*ReturnValueObject, ReturnValue);
+		FCSMetaDataUtils::SerializeProperty(ReturnValueObject, ReturnValue);
 		
 		//Since the return value has no name in the C# reflection. Just assign "ReturnValue" to it.
 		ReturnValue.Name = "ReturnValue";
 	}
 
-	JsonObject->TryGetBoolField(TEXT("IsVirtual"), IsVirtual);
+	JsonObject.TryGetBoolField(TEXT("IsVirtual"), IsVirtual);
 	FunctionFlags = FCSMetaDataUtils::GetFlags<EFunctionFlags>(JsonObject,"FunctionFlags");
 }
@@ -13,7 +13,7 @@ struct FCSFunctionMetaData : FCSMemberMetaData
 	EFunctionFlags FunctionFlags;
 
 	//FTypeMetaData interface implementation
-	virtual void SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject) override;
+	virtual void SerializeFromJson(const FCSMetaDataView& JsonObject) override;
 	//End of implementation
 
 	bool HasReturnValue() const { return ReturnValue.Type != nullptr; }
@@ -2,9 +2,9 @@
 
 #include "TypeGenerator/Register/CSMetaDataUtils.h"
 
-void FCSInterfaceMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
+void FCSInterfaceMetaData::SerializeFromJson(const FCSMetaDataView& JsonObject)
 {
 	FCSTypeReferenceMetaData::SerializeFromJson(JsonObject);
-	FCSMetaDataUtils::SerializeFunctions(JsonObject->GetArrayField(TEXT("Functions")), Functions);
-	ParentInterface.SerializeFromJson(JsonObject->GetObjectField(TEXT("ParentInterface")));
+	FCSMetaDataUtils::SerializeFunctions(JsonObject.GetArrayField(TEXT("Functions")), Functions);
+	ParentInterface.SerializeFromJson(JsonObject.GetObjectField(TEXT("ParentInterface")));
 }
@@ -11,7 +11,7 @@ struct FCSInterfaceMetaData : FCSTypeReferenceMetaData
 	TArray<FCSFunctionMetaData> Functions;
 	
 	//FTypeMetaData interface implementation
-	virtual void SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject) override;
+	virtual void SerializeFromJson(const FCSMetaDataView& JsonObject) override;
 	//End of implementation
 
 	bool operator ==(const FCSInterfaceMetaData& Other) const
@@ -2,10 +2,10 @@
 
 #include "TypeGenerator/Register/CSMetaDataUtils.h"
 
-void FCSMapPropertyMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
+void FCSMapPropertyMetaData::SerializeFromJson(const FCSMetaDataView& JsonObject)
 {
 	FCSContainerBaseMetaData::SerializeFromJson(JsonObject);
-	FCSMetaDataUtils::SerializeProperty(JsonObject->GetObjectField(TEXT("ValueProperty")), ValueType);
+	FCSMetaDataUtils::SerializeProperty(JsonObject.GetObjectField(TEXT("ValueProperty")), ValueType);
 }
 
 bool FCSMapPropertyMetaData::IsEqual(TSharedPtr<FCSUnrealType> Other) const
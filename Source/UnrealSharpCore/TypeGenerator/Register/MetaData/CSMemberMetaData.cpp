@@ -1,8 +1,8 @@
 ﻿#include "CSMemberMetaData.h"
 #include "TypeGenerator/Register/CSMetaDataUtils.h"
 
-void FCSMemberMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
+void FCSMemberMetaData::SerializeFromJson(const FCSMetaDataView& JsonObject)
 {
-	Name = *JsonObject->GetStringField(TEXT("Name"));
+	Name = JsonObject.GetNameField(TEXT("Name"));
 	FCSMetaDataUtils::SerializeFromJson(JsonObject, MetaData);
 }
@@ -1,9 +1,9 @@
 ﻿#include "CSObjectMetaData.h"
 
-void FCSObjectMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
+void FCSObjectMetaData::SerializeFromJson(const FCSMetaDataView& JsonObject)
 {
 	FCSUnrealType::SerializeFromJson(JsonObject);
-	InnerType.SerializeFromJson(JsonObject->GetObjectField(TEXT("InnerType")));
+	InnerType.SerializeFromJson(JsonObject.GetObjectField(TEXT("InnerType")));
 }
 
 bool FCSObjectMetaData::IsEqual(TSharedPtr<FCSUnrealType> Other) const
@@ -1,19 +1,15 @@
 ﻿#include "CSPropertyMetaData.h"
 #include "TypeGenerator/Register/CSMetaDataUtils.h"
 
-void FCSPropertyMetaData:: SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
+void FCSPropertyMetaData:: SerializeFromJson(const FCSMetaDataView& JsonObject)
 {
 	FCSMemberMetaData::SerializeFromJson(JsonObject);
 	
 	PropertyFlags = FCSMetaDataUtils::GetFlags<EPropertyFlags>(JsonObject,"PropertyFlags");
 	LifetimeCondition = FCSMetaDataUtils::GetFlags<ELifetimeCondition>(JsonObject,"LifetimeCondition");
+	JsonObject.TryGetBoolField(TEXT("IsPushBased"), bIsPushBased);
 	
-	JsonObject->TryGetStringField(TEXT("BlueprintGetter"), BlueprintGetter);
-	JsonObject->TryGetStringField(TEXT("BlueprintSetter"), BlueprintSetter);
-
-	FString RepNotifyFunctionNameStr;
-	if (JsonObject->TryGetStringField(TEXT("RepNotifyFunctionName"), RepNotifyFunctionNameStr))
-	{
-		RepNotifyFunctionName = *RepNotifyFunctionNameStr;
-	}
+	JsonObject.TryGetNameField(TEXT("BlueprintGetter"), BlueprintGetter);
+	JsonObject.TryGetNameField(TEXT("BlueprintSetter"), BlueprintSetter);
+	JsonObject.TryGetNameField(TEXT("RepNotifyFunctionName"), RepNotifyFunctionName);
 }
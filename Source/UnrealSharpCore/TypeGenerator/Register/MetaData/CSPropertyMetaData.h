@@ -11,12 +11,14 @@ struct UNREALSHARPCORE_API FCSPropertyMetaData : FCSMemberMetaData
 	int32 ArrayDim = 0;
 	EPropertyFlags PropertyFlags;
 	ELifetimeCondition LifetimeCondition;
+	bool bIsPushBased = false;
 
-	FString BlueprintSetter;
-	FString BlueprintGetter;
+	// Names only, so they're interned instead of each property keeping its own copy.
+	FName BlueprintSetter;
+	FName BlueprintGetter;
 
 	//FTypeMetaData interface implementation
-	virtual void SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject) override;
+	virtual void SerializeFromJson(const FCSMetaDataView& JsonObject) override;
 	//End of implementation
 
 	template<typename T>
@@ -37,6 +39,7 @@ struct UNREALSHARPCORE_API FCSPropertyMetaData : FCSMemberMetaData
 				ArrayDim == Other.ArrayDim &&
 				PropertyFlags == Other.PropertyFlags &&
 				LifetimeCondition == Other.LifetimeCondition &&
+				bIsPushBased == Other.bIsPushBased &&
 				BlueprintSetter == Other.BlueprintSetter &&
 				BlueprintGetter == Other.BlueprintGetter;
 	}
@@ -1,11 +1,11 @@
 ﻿#include "CSStructMetaData.h"
 
-void FCSStructMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
+void FCSStructMetaData::SerializeFromJson(const FCSMetaDataView& JsonObject)
 {
 	FCSTypeReferenceMetaData::SerializeFromJson(JsonObject);
-	const TArray<TSharedPtr<FJsonValue>>* FoundProperties;
-	if (JsonObject->TryGetArrayField(TEXT("Fields"), FoundProperties))
+	FCSMetaDataArrayView FoundProperties;
+	if (JsonObject.TryGetArrayField(TEXT("Fields"), FoundProperties))
 	{
-		FCSMetaDataUtils::SerializeProperties(*FoundProperties, Properties);
+		FCSMetaDataUtils::SerializeProperties(FoundProperties, Properties);
 	}
 }
\ No newline at end of file
@@ -1,9 +1,9 @@
 ﻿#include "CSStructPropertyMetaData.h"
 
-void FCSStructPropertyMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
+void FCSStructPropertyMetaData::SerializeFromJson(const FCSMetaDataView& JsonObject)
 {
 	FCSUnrealType::SerializeFromJson(JsonObject);
-	TypeRef.SerializeFromJson(JsonObject->GetObjectField(TEXT("InnerType")));
+	TypeRef.SerializeFromJson(JsonObject.GetObjectField(TEXT("InnerType")));
 }
 
 bool FCSStructPropertyMetaData::IsEqual(TSharedPtr<FCSUnrealType> Other) const
@@ -10,7 +10,7 @@ struct FCSStructPropertyMetaData : FCSUnrealType
 	FCSTypeReferenceMetaData TypeRef;
 
 	// FUnrealType interface implementation
-	virtual void SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject) override;
+	virtual void SerializeFromJson(const FCSMetaDataView& JsonObject) override;
 	virtual bool IsEqual(TSharedPtr<FCSUnrealType> Other) const override;
 	// End of implementation
 };
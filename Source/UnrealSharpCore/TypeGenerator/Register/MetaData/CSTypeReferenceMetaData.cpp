@@ -43,17 +43,10 @@ UPackage* FCSTypeReferenceMetaData::GetOwningPackage() const
 	return UCSManager::Get().GetPackage(FieldName.GetNamespace());
 }
 
-void FCSTypeReferenceMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
+void FCSTypeReferenceMetaData::SerializeFromJson(const FCSMetaDataView& JsonObject)
 {
-	FString TypeName = JsonObject->GetStringField(TEXT("Name"));
-	FString Namespace = JsonObject->GetStringField(TEXT("Namespace"));
-	FieldName = FCSFieldName(*TypeName, *Namespace);
-
-	FString AssemblyNameStr;
-	if (JsonObject->TryGetStringField(TEXT("AssemblyName"), AssemblyNameStr))
-	{
-		AssemblyName = *AssemblyNameStr;
-	}
+	FieldName = FCSFieldName(JsonObject.GetNameField(TEXT("Name")), JsonObject.GetNameField(TEXT("Namespace")));
+	JsonObject.TryGetNameField(TEXT("AssemblyName"), AssemblyName);
 	
 	FCSMetaDataUtils::SerializeFromJson(JsonObject, MetaData);
 }
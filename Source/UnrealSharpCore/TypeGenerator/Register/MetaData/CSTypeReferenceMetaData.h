@@ -1,6 +1,7 @@
 ﻿#pragma once
 
 #include "CSFieldName.h"
+#include "TypeGenerator/Register/CSMetaDataView.h"
 
 class UCSAssembly;
 
@@ -24,7 +25,7 @@ struct FCSTypeReferenceMetaData
 
 	TMap<FString, FString> MetaData;
 	
-	virtual void SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject);
+	virtual void SerializeFromJson(const FCSMetaDataView& JsonObject);
 
 	bool operator==(const FCSTypeReferenceMetaData& Other) const
 	{
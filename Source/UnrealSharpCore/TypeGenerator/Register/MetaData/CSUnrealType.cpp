@@ -1,8 +1,8 @@
 ﻿#include "CSUnrealType.h"
 
-void FCSUnrealType::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
+void FCSUnrealType::SerializeFromJson(const FCSMetaDataView& JsonObject)
 {
-	PropertyType = static_cast<ECSPropertyType>(JsonObject->GetIntegerField(TEXT("PropertyType")));
+	PropertyType = static_cast<ECSPropertyType>(JsonObject.GetIntegerField(TEXT("PropertyType")));
 }
 
 bool FCSUnrealType::IsEqual(const TSharedPtr<FCSUnrealType> Other) const
@@ -1,6 +1,7 @@
 ﻿#pragma once
 
 #include "CSPropertyType.h"
+#include "TypeGenerator/Register/CSMetaDataView.h"
 
 struct FCSUnrealType
 {
@@ -9,7 +10,7 @@ struct FCSUnrealType
 	ECSPropertyType PropertyType = ECSPropertyType::Unknown;
 
 	// Begin FCSUnrealType
-	virtual void SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject);
+	virtual void SerializeFromJson(const FCSMetaDataView& JsonObject);
 	virtual bool IsEqual(TSharedPtr<FCSUnrealType> Other) const;
 	// End FCSUnrealType
 
@@ -1,5 +1,9 @@
 #include "CSClassInfo.h"
 #include "CSAssembly.h"
+#include "TypeGenerator/CSClass.h"
+#include "TypeGenerator/Factories/CSFunctionFactory.h"
+#include "TypeGenerator/Functions/CSFunction.h"
+#include "TypeGenerator/Register/CSMetaDataUtils.h"
 #include "TypeGenerator/Register/MetaData/CSClassMetaData.h"
 
 UField* FCSClassInfo::StartBuildingManagedType()
@@ -18,3 +22,64 @@ UField* FCSClassInfo::StartBuildingManagedType()
 
 	return FCSManagedTypeInfo::StartBuildingManagedType();
 }
+
+void FCSClassInfo::RebindFunctionBodies()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FCSClassInfo::RebindFunctionBodies);
+	
+	UCSClass* ManagedClass = GetFieldChecked<UCSClass>();
+
+	// Same functions as before, so resolve all of them in one go instead of one by one on their first call.
+	FCSFunctionFactory::FMethodHandles MethodHandles;
+	FCSFunctionFactory::ResolveMethodHandles(ManagedClass, GetTypeMetaData<FCSClassMetaData>(), MethodHandles);
+
+	for (TFieldIterator<UCSFunctionBase> It(ManagedClass, EFieldIteratorFlags::ExcludeSuper); It; ++It)
+	{
+		if (FGCHandle* MethodHandle = MethodHandles.FindRef(It->GetFName()))
+		{
+			It->SetMethodHandle(MethodHandle);
+		}
+	}
+}
+
+void FCSClassInfo::PatchFunctions()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FCSClassInfo::PatchFunctions);
+
+	UCSClass* ManagedClass = GetFieldChecked<UCSClass>();
+	TSharedPtr<const FCSClassMetaData> ClassMetaData = GetTypeMetaData<FCSClassMetaData>();
+
+	FCSMetaDataUtils::ApplyMetaData(ClassMetaData->MetaData, ManagedClass);
+
+	FCSFunctionFactory::FMethodHandles MethodHandles;
+	FCSFunctionFactory::ResolveMethodHandles(ManagedClass, ClassMetaData, MethodHandles);
+
+	// The existing functions are kept, so anything that calls them keeps working. Only their methods are swapped.
+	for (TFieldIterator<UCSFunctionBase> It(ManagedClass, EFieldIteratorFlags::ExcludeSuper); It; ++It)
+	{
+		if (FGCHandle* MethodHandle = MethodHandles.FindRef(It->GetFName()))
+		{
+			It->SetMethodHandle(MethodHandle);
+		}
+	}
+
+	// The new ones are added to the class and its native function lookup table.
+	for (const FCSFunctionMetaData& FunctionMetaData : ClassMetaData->Functions)
+	{
+		if (!ManagedClass->FindFunctionByName(FunctionMetaData.Name, EIncludeSuperFlag::ExcludeSuper))
+		{
+			FCSFunctionFactory::CreateFunctionFromMetaData(ManagedClass, FunctionMetaData, &MethodHandles);
+		}
+	}
+
+	TArray<UFunction*> VirtualFunctions;
+	FCSFunctionFactory::GetOverriddenFunctions(ManagedClass, ClassMetaData, VirtualFunctions);
+
+	for (UFunction* VirtualFunction : VirtualFunctions)
+	{
+		if (!ManagedClass->FindFunctionByName(VirtualFunction->GetFName(), EIncludeSuperFlag::ExcludeSuper))
+		{
+			FCSFunctionFactory::CreateOverriddenFunction(ManagedClass, VirtualFunction, &MethodHandles);
+		}
+	}
+}
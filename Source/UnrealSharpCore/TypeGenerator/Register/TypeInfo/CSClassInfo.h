@@ -16,5 +16,7 @@ struct UNREALSHARPCORE_API FCSClassInfo final : FCSManagedTypeInfo
 
 	// FCSManagedTypeInfo interface implementation
 	virtual UField* StartBuildingManagedType() override;
+	virtual void RebindFunctionBodies() override;
+	virtual void PatchFunctions() override;
 	// End of implementation
 };
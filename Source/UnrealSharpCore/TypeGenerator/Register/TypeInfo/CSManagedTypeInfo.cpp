@@ -1,5 +1,7 @@
 ﻿#include "CSManagedTypeInfo.h"
 #include "CSManager.h"
+#include "CSStartupReport.h"
+#include "CSTypeBuildProfiler.h"
 #include "TypeGenerator/Register/CSBuilderManager.h"
 #include "TypeGenerator/Register/CSGeneratedTypeBuilder.h"
 #include "TypeGenerator/Register/MetaData/CSTypeReferenceMetaData.h"
@@ -26,6 +28,11 @@ UField* FCSManagedTypeInfo::StartBuildingManagedType()
 {
 	if (StructureState == HasChangedStructure)
 	{
+#if UNREALSHARP_PROFILE_TYPE_BUILDS
+		const int32 NumObjectsToReinstance = FCSTypeBuildProfiler::IsEnabled() ? FCSTypeBuildProfiler::CountObjectsToReinstance(Field.Get()) : 0;
+#endif
+		const double StartTime = FPlatformTime::Seconds();
+		
 		UCSTypeBuilderManager* BuilderManager = UCSManager::Get().GetTypeBuilderManager();
 		TSharedPtr<FCSManagedTypeInfo> ThisTypeInfo = SharedThis(this);
 		
@@ -34,20 +41,41 @@ UField* FCSManagedTypeInfo::StartBuildingManagedType()
 		Field = TStrongObjectPtr(TypeBuilder->CreateType(ThisTypeInfo));
 		TypeBuilder->RebuildType(Field.Get(), ThisTypeInfo);
 		StructureState = UpToDate;
+
+		const double BuildSeconds = FPlatformTime::Seconds() - StartTime;
+		FCSStartupReport& StartupReport = FCSStartupReport::Get();
+		if (StartupReport.IsRecording())
+		{
+			StartupReport.AddTypeBuildTime(Field->GetName(), BuildSeconds);
+		}
+
+#if UNREALSHARP_PROFILE_TYPE_BUILDS
+		FCSTypeBuildProfiler::RecordTypeBuild(*this, Field.Get(), NumObjectsToReinstance, BuildSeconds);
+#endif
+	}
+	else if (StructureState == HasChangedFunctionBodies)
+	{
+		RebindFunctionBodies();
+		StructureState = UpToDate;
+	}
+	else if (StructureState == HasAddedFunctions)
+	{
+		PatchFunctions();
+		StructureState = UpToDate;
 	}
 	
 	ensureMsgf(Field.IsValid(), TEXT("Field is not valid for type: %s. This should never happen."), *GetFieldClass()->GetName());
 	return Field.Get();
 }
 
-TSharedPtr<FGCHandle> FCSManagedTypeInfo::FindTypeHandle() const
+FGCHandle* FCSManagedTypeInfo::FindTypeHandle() const
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(FCSManagedTypeInfo::FindTypeHandle);
 	
 	FCSFieldName FieldName = IsNativeType() ? FCSFieldName(Field.Get()) : TypeMetaData->FieldName;
-	TSharedPtr<FGCHandle> TypeHandle = OwningAssembly->TryFindTypeHandle(FieldName);
+	FGCHandle* TypeHandle = OwningAssembly->TryFindTypeHandle(FieldName);
 
-	if (!TypeHandle.IsValid() || TypeHandle->IsNull())
+	if (!TypeHandle || TypeHandle->IsNull())
 	{
 		UE_LOGFMT(LogUnrealSharp, Error, "Failed to find type handle for class: {0}", *FieldName.GetFullName().ToString());
 		return nullptr;
@@ -9,6 +9,10 @@ enum ECSStructureState : uint8
 {
 	UpToDate,
 	HasChangedStructure,
+	// Only the method bodies changed. The field is kept as is, only its method handles are resolved again.
+	HasChangedFunctionBodies,
+	// Only functions were added, or metadata and method bodies changed. The field is patched in place, its layout stays the same.
+	HasAddedFunctions,
 };
 
 struct UNREALSHARPCORE_API FCSManagedTypeInfo : TSharedFromThis<FCSManagedTypeInfo>
@@ -18,10 +22,10 @@ struct UNREALSHARPCORE_API FCSManagedTypeInfo : TSharedFromThis<FCSManagedTypeIn
 	FCSManagedTypeInfo(const TSharedPtr<FCSTypeReferenceMetaData>& MetaData, UCSAssembly* InOwningAssembly, UClass* InTypeClass);
 	FCSManagedTypeInfo(UField* NativeField, UCSAssembly* InOwningAssembly);
 	
-	TSharedPtr<FGCHandle> GetManagedTypeHandle()
+	FGCHandle* GetManagedTypeHandle()
 	{
 #if WITH_EDITOR
-		if (!ManagedTypeHandle.IsValid() || ManagedTypeHandle->IsNull())
+		if (!ManagedTypeHandle || ManagedTypeHandle->IsNull())
 		{
 			// Lazy load the type handle in editor if it is not already set.
 			ManagedTypeHandle = FindTypeHandle();
@@ -50,16 +54,34 @@ struct UNREALSHARPCORE_API FCSManagedTypeInfo : TSharedFromThis<FCSManagedTypeIn
 
 	void SetTypeMetaData(const TSharedPtr<FCSTypeReferenceMetaData>& InTypeMetaData) { TypeMetaData = InTypeMetaData; }
 
+	// Content hashes emitted by the weaver. Empty when the metadata was written by an older weaver.
+	void SetContentHashes(const FString& InStructureHash, const FString& InFunctionBodiesHash)
+	{
+		StructureHash = InStructureHash;
+		FunctionBodiesHash = InFunctionBodiesHash;
+	}
+	
+	const FString& GetStructureHash() const { return StructureHash; }
+	const FString& GetFunctionBodiesHash() const { return FunctionBodiesHash; }
+
 	UClass* GetFieldClass() const { return FieldClass.Get(); }
 
 	bool IsNativeType() const { return !TypeMetaData.IsValid(); }
 
+	// False until the field has been built for the first time. Types can stay unbuilt when lazy type building is enabled.
+	bool IsBuilt() const { return Field.IsValid(); }
+
+	// Returns the field of this type, building it first if nothing has needed it yet.
+	UField* GetOrBuildField() { return Field.IsValid() ? Field.Get() : StartBuildingManagedType(); }
+
 protected:
 
 	friend UCSAssembly;
 
 	// FCSManagedTypeInfo interface
 	virtual UField* StartBuildingManagedType();
+	virtual void RebindFunctionBodies() {}
+	virtual void PatchFunctions() {}
 	// End
 
 	// Pointer to the native field of this type.
@@ -75,9 +97,13 @@ protected:
 	// Current state of the structure of this type. This changes when new UProperties/UFunctions/metadata are added or removed.
 	ECSStructureState StructureState = HasChangedStructure;
 
-	// Handle to the managed type in the C# assembly.
-	TSharedPtr<FGCHandle> ManagedTypeHandle;
+	// Handle to the managed type in the C# assembly. Owned by the handle store of the assembly.
+	FGCHandle* ManagedTypeHandle = nullptr;
+
+	// Hash of the metadata of this type, and of the IL of its methods. Used to skip unchanged types on hot reload.
+	FString StructureHash;
+	FString FunctionBodiesHash;
 
 private:
-	TSharedPtr<FGCHandle> FindTypeHandle() const;
+	FGCHandle* FindTypeHandle() const;
 };
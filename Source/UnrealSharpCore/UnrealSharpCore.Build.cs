@@ -25,6 +25,19 @@ public class UnrealSharpCore : ModuleRules
 		PublicDefinitions.Add("PLUGIN_PATH=" + PluginDirectory.Replace("\\","/"));
 		PublicDefinitions.Add("BUILDING_EDITOR=" + (Target.bBuildEditor ? "1" : "0"));
 		
+		// GC and thread safety diagnostics compile down to no-op stubs in Shipping and Test.
+		// Can be overridden by environment variables UNREAL_SHARP_WITH_DIAGNOSTICS and UNREAL_SHARP_WITH_CONCURRENCY_MONITOR
+		bool isReleaseConfiguration = Target.Configuration == UnrealTargetConfiguration.Shipping || Target.Configuration == UnrealTargetConfiguration.Test;
+		bool withDiagnostics = GetBuildFlag("UNREAL_SHARP_WITH_DIAGNOSTICS", !isReleaseConfiguration);
+		bool withConcurrencyMonitor = GetBuildFlag("UNREAL_SHARP_WITH_CONCURRENCY_MONITOR", !isReleaseConfiguration);
+		PublicDefinitions.Add("UNREALSHARP_WITH_DIAGNOSTICS=" + (withDiagnostics ? "1" : "0"));
+		PublicDefinitions.Add("UNREALSHARP_WITH_CONCURRENCY_MONITOR=" + (withConcurrencyMonitor ? "1" : "0"));
+		
+		// Shipping builds can load the managed layer compiled ahead of time instead of hosting CoreCLR, there's no hot reload there.
+		// Opt in with UNREAL_SHARP_NATIVE_AOT=true, the managed side is published with -p:UnrealSharpNativeAot=true.
+		bool withNativeAot = Target.Configuration == UnrealTargetConfiguration.Shipping && !Target.bBuildEditor && GetBuildFlag("UNREAL_SHARP_NATIVE_AOT", false);
+		PublicDefinitions.Add("UNREALSHARP_NATIVE_AOT=" + (withNativeAot ? "1" : "0"));
+		
 		// Enhanced cross-platform build system
 		var platformInfo = UnrealSharpCrossPlatformBuild.DetectPlatformCapabilities(Target);
 		var buildConfig = UnrealSharpCrossPlatformBuild.GenerateOptimalBuildConfiguration(Target, platformInfo);
@@ -77,9 +90,15 @@ public class UnrealSharpCore : ModuleRules
 				"UnrealSharpBinds",
 				"FieldNotification",
 				"InputCore",
+				"NetCore",
+				"Sockets",
+				"Networking",
 			}
 			);
 
+		// Replicated UObjects have to register their own fragments with Iris.
+		SetupIrisSupport(Target);
+
 		// Add Mono runtime support when using Mono
 		if (useMonoRuntime)
 		{
@@ -208,6 +227,18 @@ public class UnrealSharpCore : ModuleRules
 		return false;
 	}
 
+	private static bool GetBuildFlag(string environmentVariable, bool defaultValue)
+	{
+		string envValue = Environment.GetEnvironmentVariable(environmentVariable);
+		if (!string.IsNullOrEmpty(envValue) && bool.TryParse(envValue, out bool envPreference))
+		{
+			Console.WriteLine($"UnrealSharp: {environmentVariable}={envPreference} from environment variable");
+			return envPreference;
+		}
+
+		return defaultValue;
+	}
+
 	void PublishSolution(string projectRootDirectory)
 	{
 		if (!Directory.Exists(projectRootDirectory))
@@ -13,6 +13,7 @@
 #include "Modules/ModuleManager.h"
 #include "TypeGenerator/Properties/PropertyGeneratorManager.h"
 #include "HotReload/UnrealSharp_UnifiedHotReload.h"
+#include "Export/AActorExporter.h"
 
 #define LOCTEXT_NAMESPACE "FUnrealSharpCoreModule"
 
@@ -21,6 +22,9 @@ DEFINE_LOG_CATEGORY(LogUnrealSharp);
 void FUnrealSharpCoreModule::StartupModule()
 {
 	FPropertyGeneratorManager::Init();
+
+	// The direct-call trampolines write into params buffers laid out by the engine.
+	UAActorExporter::ValidateParmsLayouts();
 	
 	// Initialize the C# runtime
 	UCSManager& CSManager = UCSManager::GetOrCreate();
@@ -0,0 +1,326 @@
+#include "CSChunkedCompression.h"
+#include "UnrealSharpCore.h"
+#include "Async/ParallelFor.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/Compression.h"
+#include "Misc/FileHelper.h"
+#include "Tasks/Task.h"
+
+namespace
+{
+	constexpr uint32 ChunkedMagic = 0x43435355; // "USCC"
+	constexpr uint8 ChunkedVersion = 1;
+
+	// Set in the size table for chunks that are stored uncompressed.
+	constexpr uint32 StoredChunkFlag = 1u << 31;
+
+	struct FChunkedHeader
+	{
+		uint32 Magic;
+		uint8 Version;
+		ECSCompressionCodec Codec;
+		uint16 Padding;
+		uint32 ChunkSize;
+		uint32 NumChunks;
+		uint64 UncompressedSize;
+	};
+	static_assert(sizeof(FChunkedHeader) == 24, "The chunked compression header is part of the file format");
+
+	bool IsValidHeader(const FChunkedHeader& Header)
+	{
+		if (Header.Magic != ChunkedMagic || Header.Version != ChunkedVersion || Header.Codec > ECSCompressionCodec::LZ4)
+		{
+			return false;
+		}
+
+		if (Header.ChunkSize == 0 || Header.UncompressedSize > MAX_int32)
+		{
+			return false;
+		}
+
+		return Header.NumChunks == FMath::DivideAndRoundUp<uint64>(Header.UncompressedSize, Header.ChunkSize);
+	}
+
+	int64 GetChunkRawSize(const FChunkedHeader& Header, int32 ChunkIndex)
+	{
+		const int64 Offset = (int64)ChunkIndex * Header.ChunkSize;
+		return FMath::Min<int64>(Header.ChunkSize, Header.UncompressedSize - Offset);
+	}
+
+	FName GetCompressionFormat(ECSCompressionCodec Codec)
+	{
+		return Codec == ECSCompressionCodec::LZ4 ? NAME_LZ4 : NAME_Zlib;
+	}
+
+	// Returns the compressed size, or 0 when the chunk should be stored as it is.
+	int64 CompressChunk(const uint8* Raw, int64 RawSize, const FCSChunkedCompressionSettings& Settings, TArray<uint8>& OutChunk)
+	{
+		switch (Settings.Codec)
+		{
+		case ECSCompressionCodec::Oodle:
+			{
+				OutChunk.SetNumUninitialized((int32)FOodleDataCompression::CompressedBufferSizeNeeded(RawSize));
+				return FOodleDataCompression::Compress(OutChunk.GetData(), OutChunk.Num(), Raw, RawSize, Settings.OodleCompressor, Settings.OodleLevel);
+			}
+		case ECSCompressionCodec::Zlib:
+		case ECSCompressionCodec::LZ4:
+			{
+				const FName Format = GetCompressionFormat(Settings.Codec);
+				int32 CompressedSize = FCompression::CompressMemoryBound(Format, (int32)RawSize);
+				OutChunk.SetNumUninitialized(CompressedSize);
+				return FCompression::CompressMemory(Format, OutChunk.GetData(), CompressedSize, Raw, (int32)RawSize) ? CompressedSize : 0;
+			}
+		default:
+			return 0;
+		}
+	}
+
+	bool DecompressChunk(ECSCompressionCodec Codec, uint32 SizeEntry, const uint8* Compressed, uint8* OutRaw, int64 RawSize)
+	{
+		const int64 CompressedSize = SizeEntry & ~StoredChunkFlag;
+
+		if (SizeEntry & StoredChunkFlag)
+		{
+			if (CompressedSize != RawSize)
+			{
+				return false;
+			}
+
+			FMemory::Memcpy(OutRaw, Compressed, RawSize);
+			return true;
+		}
+
+		switch (Codec)
+		{
+		case ECSCompressionCodec::Oodle:
+			return FOodleDataCompression::Decompress(OutRaw, RawSize, Compressed, CompressedSize);
+		case ECSCompressionCodec::Zlib:
+		case ECSCompressionCodec::LZ4:
+			return FCompression::UncompressMemory(GetCompressionFormat(Codec), OutRaw, (int32)RawSize, Compressed, (int32)CompressedSize);
+		default:
+			return false;
+		}
+	}
+}
+
+bool FCSChunkedCompression::Compress(TConstArrayView64<uint8> Data, const FCSChunkedCompressionSettings& Settings, TArray<uint8>& OutCompressed)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FCSChunkedCompression::Compress);
+
+	if (Settings.ChunkSize <= 0 || Data.Num() > MAX_int32)
+	{
+		return false;
+	}
+
+	FChunkedHeader Header;
+	Header.Magic = ChunkedMagic;
+	Header.Version = ChunkedVersion;
+	Header.Codec = Settings.Codec;
+	Header.Padding = 0;
+	Header.ChunkSize = Settings.ChunkSize;
+	Header.NumChunks = FMath::DivideAndRoundUp<int64>(Data.Num(), Settings.ChunkSize);
+	Header.UncompressedSize = Data.Num();
+
+	TArray<TArray<uint8>> Chunks;
+	Chunks.SetNum(Header.NumChunks);
+
+	TArray<uint32> ChunkSizes;
+	ChunkSizes.SetNumUninitialized(Header.NumChunks);
+
+	ParallelFor(Header.NumChunks, [&](int32 ChunkIndex)
+	{
+		const uint8* Raw = Data.GetData() + (int64)ChunkIndex * Header.ChunkSize;
+		const int64 RawSize = GetChunkRawSize(Header, ChunkIndex);
+
+		TArray<uint8>& Chunk = Chunks[ChunkIndex];
+		const int64 CompressedSize = CompressChunk(Raw, RawSize, Settings, Chunk);
+
+		if (CompressedSize > 0 && CompressedSize < RawSize)
+		{
+			Chunk.SetNum((int32)CompressedSize);
+			ChunkSizes[ChunkIndex] = CompressedSize;
+		}
+		else
+		{
+			Chunk = TArray<uint8>(Raw, (int32)RawSize);
+			ChunkSizes[ChunkIndex] = RawSize | StoredChunkFlag;
+		}
+	}, Header.NumChunks < 2 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::Unbalanced);
+
+	int64 TotalSize = sizeof(FChunkedHeader) + ChunkSizes.NumBytes();
+	for (const TArray<uint8>& Chunk : Chunks)
+	{
+		TotalSize += Chunk.Num();
+	}
+
+	if (TotalSize > MAX_int32)
+	{
+		return false;
+	}
+
+	OutCompressed.Reset(TotalSize);
+	OutCompressed.Append((const uint8*)&Header, sizeof(FChunkedHeader));
+	OutCompressed.Append((const uint8*)ChunkSizes.GetData(), ChunkSizes.NumBytes());
+	for (const TArray<uint8>& Chunk : Chunks)
+	{
+		OutCompressed.Append(Chunk);
+	}
+
+	return true;
+}
+
+bool FCSChunkedCompression::IsChunked(TConstArrayView64<uint8> Data)
+{
+	if (Data.Num() < sizeof(FChunkedHeader))
+	{
+		return false;
+	}
+
+	FChunkedHeader Header;
+	FMemory::Memcpy(&Header, Data.GetData(), sizeof(FChunkedHeader));
+	return IsValidHeader(Header);
+}
+
+bool FCSChunkedCompression::Decompress(TConstArrayView64<uint8> Compressed, TArray<uint8>& OutData)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FCSChunkedCompression::Decompress);
+
+	if (!IsChunked(Compressed))
+	{
+		return false;
+	}
+
+	FChunkedHeader Header;
+	FMemory::Memcpy(&Header, Compressed.GetData(), sizeof(FChunkedHeader));
+
+	const int64 TableSize = (int64)Header.NumChunks * sizeof(uint32);
+	if (Compressed.Num() < sizeof(FChunkedHeader) + TableSize)
+	{
+		return false;
+	}
+
+	TArray<uint32> ChunkSizes;
+	ChunkSizes.SetNumUninitialized(Header.NumChunks);
+	FMemory::Memcpy(ChunkSizes.GetData(), Compressed.GetData() + sizeof(FChunkedHeader), TableSize);
+
+	// Chunks are stored back to back, so the table gives every chunk's offset up front.
+	TArray<int64> ChunkOffsets;
+	ChunkOffsets.SetNumUninitialized(Header.NumChunks);
+
+	int64 Offset = sizeof(FChunkedHeader) + TableSize;
+	for (uint32 ChunkIndex = 0; ChunkIndex < Header.NumChunks; ++ChunkIndex)
+	{
+		ChunkOffsets[ChunkIndex] = Offset;
+		Offset += ChunkSizes[ChunkIndex] & ~StoredChunkFlag;
+	}
+
+	if (Offset != Compressed.Num())
+	{
+		return false;
+	}
+
+	OutData.SetNumUninitialized((int32)Header.UncompressedSize);
+
+	std::atomic<bool> bFailed = false;
+	ParallelFor(Header.NumChunks, [&](int32 ChunkIndex)
+	{
+		uint8* Raw = OutData.GetData() + (int64)ChunkIndex * Header.ChunkSize;
+		if (!DecompressChunk(Header.Codec, ChunkSizes[ChunkIndex], Compressed.GetData() + ChunkOffsets[ChunkIndex], Raw, GetChunkRawSize(Header, ChunkIndex)))
+		{
+			bFailed = true;
+		}
+	}, Header.NumChunks < 2 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::Unbalanced);
+
+	if (bFailed)
+	{
+		OutData.Reset();
+		return false;
+	}
+
+	return true;
+}
+
+bool FCSChunkedCompression::LoadFile(const FString& Path, TArray<uint8>& OutData)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FCSChunkedCompression::LoadFile);
+
+	TUniquePtr<IFileHandle> File(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*Path));
+	if (!File.IsValid())
+	{
+		return false;
+	}
+
+	const int64 FileSize = File->Size();
+
+	FChunkedHeader Header;
+	if (FileSize < sizeof(FChunkedHeader) || !File->Read((uint8*)&Header, sizeof(FChunkedHeader)) || !IsValidHeader(Header))
+	{
+		File.Reset();
+		return FFileHelper::LoadFileToArray(OutData, *Path, FILEREAD_Silent);
+	}
+
+	TArray<uint32> ChunkSizes;
+	ChunkSizes.SetNumUninitialized(Header.NumChunks);
+	if (!File->Read((uint8*)ChunkSizes.GetData(), ChunkSizes.NumBytes()))
+	{
+		return false;
+	}
+
+	int64 ExpectedSize = sizeof(FChunkedHeader) + ChunkSizes.NumBytes();
+	for (uint32 ChunkSize : ChunkSizes)
+	{
+		ExpectedSize += ChunkSize & ~StoredChunkFlag;
+	}
+
+	if (ExpectedSize != FileSize)
+	{
+		UE_LOG(LogUnrealSharp, Warning, TEXT("Chunked compressed file %s is truncated or corrupt"), *Path);
+		return false;
+	}
+
+	OutData.SetNumUninitialized((int32)Header.UncompressedSize);
+
+	TArray<TArray<uint8>> Chunks;
+	Chunks.SetNum(Header.NumChunks);
+
+	TArray<UE::Tasks::FTask> DecompressTasks;
+	DecompressTasks.Reserve(Header.NumChunks);
+
+	std::atomic<bool> bFailed = false;
+	bool bReadFailed = false;
+
+	for (uint32 ChunkIndex = 0; ChunkIndex < Header.NumChunks; ++ChunkIndex)
+	{
+		TArray<uint8>& Chunk = Chunks[ChunkIndex];
+		Chunk.SetNumUninitialized(ChunkSizes[ChunkIndex] & ~StoredChunkFlag);
+
+		if (!File->Read(Chunk.GetData(), Chunk.Num()))
+		{
+			bReadFailed = true;
+			break;
+		}
+
+		// The chunk is decompressed on a worker while the next one is being read.
+		DecompressTasks.Add(UE::Tasks::Launch(UE_SOURCE_LOCATION, [&Header, &Chunk, &OutData, &bFailed, SizeEntry = ChunkSizes[ChunkIndex], ChunkIndex]()
+		{
+			uint8* Raw = OutData.GetData() + (int64)ChunkIndex * Header.ChunkSize;
+			if (!DecompressChunk(Header.Codec, SizeEntry, Chunk.GetData(), Raw, GetChunkRawSize(Header, ChunkIndex)))
+			{
+				bFailed = true;
+			}
+
+			Chunk.Empty();
+		}));
+	}
+
+	UE::Tasks::Wait(DecompressTasks);
+
+	if (bReadFailed || bFailed)
+	{
+		UE_LOG(LogUnrealSharp, Warning, TEXT("Failed to decompress %s"), *Path);
+		OutData.Reset();
+		return false;
+	}
+
+	return true;
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Compression/OodleDataCompression.h"
+
+enum class ECSCompressionCodec : uint8
+{
+	// Chunks are stored as they are.
+	None,
+	Oodle,
+	Zlib,
+	LZ4,
+};
+
+struct FCSChunkedCompressionSettings
+{
+	ECSCompressionCodec Codec = ECSCompressionCodec::Oodle;
+
+	// Only used by Oodle. The level only affects how long compressing takes, decompression is as fast at every level.
+	FOodleDataCompression::ECompressor OodleCompressor = FOodleDataCompression::ECompressor::Kraken;
+	FOodleDataCompression::ECompressionLevel OodleLevel = GetDefaultOodleLevel();
+
+	// Chunks are compressed and decompressed independently, and in parallel.
+	int32 ChunkSize = 256 * 1024;
+
+	// Devices compress their own caches at runtime, so they trade some ratio for compression time.
+	static constexpr FOodleDataCompression::ECompressionLevel GetDefaultOodleLevel()
+	{
+#if PLATFORM_IOS || PLATFORM_ANDROID
+		return FOodleDataCompression::ECompressionLevel::Fast;
+#else
+		return FOodleDataCompression::ECompressionLevel::Optimal1;
+#endif
+	}
+};
+
+/**
+ * Compresses data into a sequence of independently compressed chunks, behind a header that records the codec, the
+ * uncompressed size and the compressed size of every chunk. Decompressing doesn't have to guess the output size,
+ * and can start on the first chunk before the rest of the file has been read.
+ * Chunks that don't get smaller are stored uncompressed.
+ */
+class UNREALSHARPCORE_API FCSChunkedCompression
+{
+public:
+	static bool Compress(TConstArrayView64<uint8> Data, const FCSChunkedCompressionSettings& Settings, TArray<uint8>& OutCompressed);
+
+	// Whether the data starts with a chunked compression header.
+	static bool IsChunked(TConstArrayView64<uint8> Data);
+
+	// Decompresses every chunk in parallel. Works straight off a mapped file.
+	static bool Decompress(TConstArrayView64<uint8> Compressed, TArray<uint8>& OutData);
+
+	// Reads the file chunk by chunk and decompresses each chunk on a worker while the next one is read.
+	// Files without a chunked compression header are loaded as they are.
+	static bool LoadFile(const FString& Path, TArray<uint8>& OutData);
+};
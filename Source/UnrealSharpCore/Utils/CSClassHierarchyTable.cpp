@@ -0,0 +1,128 @@
+#include "CSClassHierarchyTable.h"
+#include "CSClassUtilities.h"
+#include "UObject/UObjectArray.h"
+
+std::atomic<uint32> FCSClassHierarchyTable::Generation { 1 };
+
+namespace
+{
+	bool CanCache(const UClass* Class)
+	{
+#if WITH_EDITOR
+		// Same split as FCSClassUtilities::WalkFirstNonBlueprintClass, anything but native and managed classes is a Blueprint.
+		return Class->GetClass() == UClass::StaticClass() || Class->GetClass() == UCSClass::StaticClass();
+#else
+		return true;
+#endif
+	}
+
+	uint64 MakeKey(uint32 Generation, int32 SerialNumber)
+	{
+		return (static_cast<uint64>(Generation) << 32) | static_cast<uint32>(SerialNumber);
+	}
+}
+
+FCSClassHierarchyTable::FCSClassHierarchyTable()
+{
+	NumChunks = FMath::DivideAndRoundUp(FMath::Max(GUObjectArray.GetObjectArrayCapacity(), 1), NumSlotsPerChunk);
+	Chunks = new std::atomic<FSlot*>[NumChunks];
+
+	for (int32 i = 0; i < NumChunks; ++i)
+	{
+		Chunks[i].store(nullptr, std::memory_order_relaxed);
+	}
+}
+
+FCSClassHierarchyTable::~FCSClassHierarchyTable()
+{
+	for (int32 i = 0; i < NumChunks; ++i)
+	{
+		delete[] Chunks[i].load(std::memory_order_relaxed);
+	}
+
+	delete[] Chunks;
+}
+
+FCSClassHierarchyTable& FCSClassHierarchyTable::Get()
+{
+	static FCSClassHierarchyTable Instance;
+	return Instance;
+}
+
+bool FCSClassHierarchyTable::Find(UClass* Class, FCSClassHierarchy& OutHierarchy)
+{
+	if (!CanCache(Class))
+	{
+		return false;
+	}
+
+	FCSClassHierarchyTable& Table = Get();
+	const int32 ClassIndex = GUObjectArray.ObjectToIndex(Class);
+	const uint32 CurrentGeneration = Generation.load(std::memory_order_acquire);
+
+	if (const FSlot* Slot = Table.FindSlot(ClassIndex))
+	{
+		// Slots are only filled in after the class got a serial number, so a class without one never matches.
+		const int32 SerialNumber = GUObjectArray.IndexToObject(ClassIndex)->GetSerialNumber();
+		if (Slot->Key.load(std::memory_order_acquire) == MakeKey(CurrentGeneration, SerialNumber))
+		{
+			OutHierarchy.FirstNativeClass = Slot->FirstNativeClass.load(std::memory_order_relaxed);
+			OutHierarchy.FirstNonBlueprintClass = Slot->FirstNonBlueprintClass.load(std::memory_order_relaxed);
+			OutHierarchy.FirstManagedClass = Slot->FirstManagedClass.load(std::memory_order_relaxed);
+			OutHierarchy.ManagedType = Slot->ManagedType.load(std::memory_order_relaxed);
+			return true;
+		}
+	}
+
+	OutHierarchy.FirstNativeClass = FCSClassUtilities::WalkFirstNativeClass(Class);
+	OutHierarchy.FirstNonBlueprintClass = FCSClassUtilities::WalkFirstNonBlueprintClass(Class);
+	OutHierarchy.FirstManagedClass = FCSClassUtilities::WalkFirstManagedClass(Class);
+	OutHierarchy.ManagedType = FCSClassUtilities::WalkManagedType(Class);
+
+	// Resolved under the generation read before the walk, so a rebuild that happened meanwhile leaves the slot stale.
+	const int32 SerialNumber = GUObjectArray.AllocateSerialNumber(ClassIndex);
+
+	FScopeLock Lock(&Table.WriteLock);
+	FSlot& Slot = Table.GetOrAllocateSlot(ClassIndex);
+
+	// Readers check the key first, so clear it while the hierarchy is out of sync.
+	Slot.Key.store(0, std::memory_order_relaxed);
+	Slot.FirstNativeClass.store(OutHierarchy.FirstNativeClass, std::memory_order_relaxed);
+	Slot.FirstNonBlueprintClass.store(OutHierarchy.FirstNonBlueprintClass, std::memory_order_relaxed);
+	Slot.FirstManagedClass.store(OutHierarchy.FirstManagedClass, std::memory_order_relaxed);
+	Slot.ManagedType.store(OutHierarchy.ManagedType, std::memory_order_relaxed);
+	Slot.Key.store(MakeKey(CurrentGeneration, SerialNumber), std::memory_order_release);
+	return true;
+}
+
+void FCSClassHierarchyTable::Invalidate()
+{
+	Generation.fetch_add(1, std::memory_order_acq_rel);
+}
+
+const FCSClassHierarchyTable::FSlot* FCSClassHierarchyTable::FindSlot(int32 ClassIndex) const
+{
+	const int32 ChunkIndex = ClassIndex / NumSlotsPerChunk;
+	if (ClassIndex < 0 || ChunkIndex >= NumChunks)
+	{
+		return nullptr;
+	}
+
+	const FSlot* Chunk = Chunks[ChunkIndex].load(std::memory_order_acquire);
+	return Chunk ? &Chunk[ClassIndex % NumSlotsPerChunk] : nullptr;
+}
+
+FCSClassHierarchyTable::FSlot& FCSClassHierarchyTable::GetOrAllocateSlot(int32 ClassIndex)
+{
+	const int32 ChunkIndex = ClassIndex / NumSlotsPerChunk;
+	check(ClassIndex >= 0 && ChunkIndex < NumChunks);
+
+	FSlot* Chunk = Chunks[ChunkIndex].load(std::memory_order_relaxed);
+	if (!Chunk)
+	{
+		Chunk = new FSlot[NumSlotsPerChunk];
+		Chunks[ChunkIndex].store(Chunk, std::memory_order_release);
+	}
+
+	return Chunk[ClassIndex % NumSlotsPerChunk];
+}
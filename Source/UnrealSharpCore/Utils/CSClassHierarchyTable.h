@@ -0,0 +1,67 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+class UCSClass;
+class ICSManagedTypeInterface;
+
+// The super classes FCSClassUtilities looks for, resolved once per class.
+struct FCSClassHierarchy
+{
+	UClass* FirstNativeClass = nullptr;
+	UClass* FirstNonBlueprintClass = nullptr;
+	UCSClass* FirstManagedClass = nullptr;
+	ICSManagedTypeInterface* ManagedType = nullptr;
+};
+
+/**
+ * Side table of FCSClassHierarchy, addressed by the GUObjectArray index of the class, so the lookups of
+ * FCSClassUtilities are one indexed load instead of a walk up the super classes.
+ * Lookups are lock-free. Slots remember the serial number of their class, so a recycled index never hands out the
+ * hierarchy of a deleted class, and the generation they were resolved in, which moves on whenever a managed class
+ * is built or rebuilt.
+ * Blueprint classes aren't cached in the editor, recompiling them can reparent them in place.
+ */
+class UNREALSHARPCORE_API FCSClassHierarchyTable
+{
+public:
+
+	// Returns false when the class can't be cached, the caller walks the super classes itself then.
+	static bool Find(UClass* Class, FCSClassHierarchy& OutHierarchy);
+
+	// Drops every cached hierarchy. Called whenever a managed class gets its super class set.
+	static void Invalidate();
+
+private:
+
+	struct FSlot
+	{
+		// Generation in the upper half, serial number of the class in the lower half. Zero while the slot is empty.
+		std::atomic<uint64> Key { 0 };
+		std::atomic<UClass*> FirstNativeClass { nullptr };
+		std::atomic<UClass*> FirstNonBlueprintClass { nullptr };
+		std::atomic<UCSClass*> FirstManagedClass { nullptr };
+		std::atomic<ICSManagedTypeInterface*> ManagedType { nullptr };
+	};
+
+	static constexpr int32 NumSlotsPerChunk = 1024;
+
+	FCSClassHierarchyTable();
+	~FCSClassHierarchyTable();
+
+	static FCSClassHierarchyTable& Get();
+
+	const FSlot* FindSlot(int32 ClassIndex) const;
+
+	// Only called with WriteLock held.
+	FSlot& GetOrAllocateSlot(int32 ClassIndex);
+
+	// Chunk pointers are published once and never move, sized for the capacity of GUObjectArray up front.
+	std::atomic<FSlot*>* Chunks = nullptr;
+	int32 NumChunks = 0;
+
+	FCriticalSection WriteLock;
+
+	static std::atomic<uint32> Generation;
+};
@@ -1,5 +1,6 @@
 ﻿#pragma once
 
+#include "CSClassHierarchyTable.h"
 #include "TypeGenerator/CSClass.h"
 #include "TypeGenerator/CSInterface.h"
 #include "TypeGenerator/CSSkeletonClass.h"
@@ -12,7 +13,53 @@ public:
 	static bool IsSkeletonType(const UClass* Class) { return Class->GetClass() == UCSSkeletonClass::StaticClass(); }
 	static bool IsNativeClass(UClass* Class){ return Class->GetClass() == UClass::StaticClass(); }
 
+	// The lookups below are cached per class in FCSClassHierarchyTable, the Walk variants resolve them from scratch.
+
 	static UCSClass* GetFirstManagedClass(UClass* Class)
+	{
+		FCSClassHierarchy Hierarchy;
+		if (Class && FCSClassHierarchyTable::Find(Class, Hierarchy))
+		{
+			return Hierarchy.FirstManagedClass;
+		}
+
+		return WalkFirstManagedClass(Class);
+	}
+	
+	static ICSManagedTypeInterface* GetManagedType(UClass* Class)
+	{
+		FCSClassHierarchy Hierarchy;
+		if (Class && FCSClassHierarchyTable::Find(Class, Hierarchy))
+		{
+			return Hierarchy.ManagedType;
+		}
+
+		return WalkManagedType(Class);
+	}
+	
+	static UClass* GetFirstNativeClass(UClass* Class)
+	{
+		FCSClassHierarchy Hierarchy;
+		if (FCSClassHierarchyTable::Find(Class, Hierarchy))
+		{
+			return Hierarchy.FirstNativeClass;
+		}
+
+		return WalkFirstNativeClass(Class);
+	}
+
+	static UClass* GetFirstNonBlueprintClass(UClass* Class)
+	{
+		FCSClassHierarchy Hierarchy;
+		if (FCSClassHierarchyTable::Find(Class, Hierarchy))
+		{
+			return Hierarchy.FirstNonBlueprintClass;
+		}
+
+		return WalkFirstNonBlueprintClass(Class);
+	}
+
+	static UCSClass* WalkFirstManagedClass(UClass* Class)
 	{
 		while (Class && !IsManagedClass(Class))
 		{
@@ -28,7 +75,7 @@ public:
 		return (UCSClass*) Class;
 	}
 	
-	static ICSManagedTypeInterface* GetManagedType(UClass* Class)
+	static ICSManagedTypeInterface* WalkManagedType(UClass* Class)
 	{
 		for (UClass* It = Class; It; It = It->GetSuperClass())
 		{
@@ -46,8 +93,7 @@ public:
 		return nullptr;
 	}
 
-	
-	static UClass* GetFirstNativeClass(UClass* Class)
+	static UClass* WalkFirstNativeClass(UClass* Class)
 	{
 		while (!IsNativeClass(Class))
 		{
@@ -57,7 +103,7 @@ public:
 		return Class;
 	}
 
-	static UClass* GetFirstNonBlueprintClass(UClass* Class)
+	static UClass* WalkFirstNonBlueprintClass(UClass* Class)
 	{
 		while (Class->GetClass() != UClass::StaticClass() && Class->GetClass() != UCSClass::StaticClass())
 		{
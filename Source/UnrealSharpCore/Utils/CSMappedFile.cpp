@@ -0,0 +1,45 @@
+#include "CSMappedFile.h"
+#include "HAL/PlatformFileManager.h"
+#include "Async/MappedFileHandle.h"
+#include "Misc/FileHelper.h"
+
+FCSMappedFile::~FCSMappedFile()
+{
+	Close();
+}
+
+bool FCSMappedFile::Open(const FString& Path)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FCSMappedFile::Open);
+	
+	Close();
+
+	MappedFile.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*Path));
+	if (MappedFile.IsValid())
+	{
+		MappedRegion.Reset(MappedFile->MapRegion());
+	}
+
+	if (MappedRegion.IsValid())
+	{
+		Data = TConstArrayView64<uint8>(MappedRegion->GetMappedPtr(), MappedRegion->GetMappedSize());
+		return true;
+	}
+	
+	if (FFileHelper::LoadFileToArray(LoadedFile, *Path, FILEREAD_Silent))
+	{
+		Data = LoadedFile;
+		return true;
+	}
+
+	return false;
+}
+
+void FCSMappedFile::Close()
+{
+	// The region has to go before the file it's mapped from.
+	MappedRegion.Reset();
+	MappedFile.Reset();
+	LoadedFile.Empty();
+	Data = TConstArrayView64<uint8>();
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/**
+ * Read-only view of a whole file. The file is memory-mapped where the platform file allows it,
+ * which includes uncompressed files in paks, and read into memory otherwise.
+ */
+class UNREALSHARPCORE_API FCSMappedFile
+{
+public:
+	FCSMappedFile() = default;
+	~FCSMappedFile();
+
+	UE_NONCOPYABLE(FCSMappedFile);
+
+	bool Open(const FString& Path);
+	void Close();
+
+	TConstArrayView64<uint8> GetData() const { return Data; }
+	bool IsMapped() const { return MappedRegion.IsValid(); }
+
+private:
+	TUniquePtr<IMappedFileHandle> MappedFile;
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+
+	// Used when the platform can't map the file.
+	TArray64<uint8> LoadedFile;
+
+	TConstArrayView64<uint8> Data;
+};
@@ -21,5 +21,6 @@ public:
 	TSharedPtr<FUICommandInfo> ReportBug;
 	TSharedPtr<FUICommandInfo> RefreshRuntimeGlue;
 	TSharedPtr<FUICommandInfo> RepairComponents;
+	TSharedPtr<FUICommandInfo> OpenMemoryDashboard;
 };
 
@@ -64,11 +64,48 @@ public:
 	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Hot Reload")
 	TEnumAsByte<ECSLoggerVerbosity> LogVerbosity = ECSLoggerVerbosity::Normal;
 
+	// Only reload the assemblies whose build output changed, and the assemblies that depend on them.
+	// When disabled, every assembly is reloaded on each Hot Reload.
+	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Hot Reload")
+	bool bIncrementalHotReload = true;
+
+	// Build the C# projects on a background thread instead of blocking the editor, also while playing in editor.
+	// Only swapping the assemblies blocks the editor, and during PIE that's postponed until PIE ends.
+	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Hot Reload")
+	bool bBuildInBackground = true;
+
+	// Address of a device running a development build with device hot reload enabled in the UnrealSharp settings.
+	// Every hot reloaded assembly is sent to it as well. Use 127.0.0.1 with a forwarded port, leave empty to not send anything.
+	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Hot Reload")
+	FString DeviceHotReloadAddress;
+
+	// How long no C# files have to change before a Hot Reload starts, in seconds.
+	// Saving many files at once then only triggers a single reload.
+	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Hot Reload", meta = (ClampMin = "0.0", UIMin = "0.0", UIMax = "5.0"))
+	float FileChangeQuietTime = 0.5f;
+
 	// Should we suffix generated types' DisplayName with "TypeName (C#)"?
 	// Needs restart to take effect.
 	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Type Generation")
 	bool bSuffixGeneratedTypes = false;
 
+	// Precompile the managed assemblies when packaging, so the packaged game doesn't have to JIT them on first use.
+	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Packaging")
+	bool bPackageReadyToRun = true;
+
+	// Compile the project assemblies into a single composite image. Can generate better code, but takes longer.
+	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Packaging", meta = (EditCondition = "bPackageReadyToRun"))
+	bool bPackageCompositeImage = false;
+
+	// Feed the profiles recorded with -RecordManagedProfile to the ReadyToRun compiler, so the methods used in those sessions are precompiled and laid out together.
+	// Profiles are read from Saved/UnrealSharp/StartupProfiles. Traces (.nettrace) are converted with dotnet-pgo, which has to be installed as a dotnet tool.
+	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Packaging", meta = (EditCondition = "bPackageReadyToRun"))
+	bool bUseStartupProfiles = true;
+
+	// Trim the unused parts of the .NET framework from the packaged game. The bindings and the project assemblies are always kept whole.
+	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Packaging")
+	bool bPackageTrimmed = false;
+
 	FString GetBuildConfigurationString() const;
 
 	FString GetLogVerbosityString() const;
@@ -0,0 +1,286 @@
+#include "CSMemoryDashboard.h"
+
+#include "Framework/Docking/TabManager.h"
+#include "Widgets/Docking/SDockTab.h"
+#include "Widgets/Layout/SScrollBox.h"
+#include "Widgets/Text/STextBlock.h"
+#include "Widgets/Views/SHeaderRow.h"
+
+#define LOCTEXT_NAMESPACE "UnrealSharpEditor"
+
+const FName SCSMemoryDashboard::TabName(TEXT("UnrealSharpMemory"));
+
+namespace CSMemoryDashboardColumns
+{
+	static const FName Name(TEXT("Name"));
+	static const FName Handles(TEXT("Handles"));
+	static const FName Strong(TEXT("Strong"));
+	static const FName Weak(TEXT("Weak"));
+	static const FName Pinned(TEXT("Pinned"));
+	static const FName HandleKB(TEXT("HandleKB"));
+	static const FName Types(TEXT("Types"));
+	static const FName TypeTableKB(TEXT("TypeTableKB"));
+	static const FName Objects(TEXT("Objects"));
+}
+
+namespace
+{
+	FText AsKB(SIZE_T Bytes)
+	{
+		return FText::AsNumber(static_cast<int64>(Bytes / 1024));
+	}
+
+	class SCSAssemblyMemoryRow : public SMultiColumnTableRow<TSharedPtr<FCSAssemblyMemoryStats>>
+	{
+	public:
+		SLATE_BEGIN_ARGS(SCSAssemblyMemoryRow) {}
+		SLATE_END_ARGS()
+
+		void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& OwnerTable, TSharedPtr<FCSAssemblyMemoryStats> InAssembly)
+		{
+			Assembly = InAssembly;
+			SMultiColumnTableRow::Construct(FSuperRowType::FArguments(), OwnerTable);
+		}
+
+		virtual TSharedRef<SWidget> GenerateWidgetForColumn(const FName& ColumnName) override
+		{
+			using namespace CSMemoryDashboardColumns;
+
+			FText Text;
+			if (ColumnName == Name)
+			{
+				Text = FText::FromName(Assembly->AssemblyName);
+			}
+			else if (ColumnName == Handles)
+			{
+				Text = FText::AsNumber(Assembly->NumHandles);
+			}
+			else if (ColumnName == Strong)
+			{
+				Text = FText::AsNumber(Assembly->NumStrongHandles);
+			}
+			else if (ColumnName == Weak)
+			{
+				Text = FText::AsNumber(Assembly->NumWeakHandles);
+			}
+			else if (ColumnName == Pinned)
+			{
+				Text = FText::AsNumber(Assembly->NumPinnedHandles);
+			}
+			else if (ColumnName == HandleKB)
+			{
+				Text = AsKB(Assembly->HandleBytes);
+			}
+			else if (ColumnName == Types)
+			{
+				Text = FText::AsNumber(Assembly->NumTypes);
+			}
+			else if (ColumnName == TypeTableKB)
+			{
+				Text = AsKB(Assembly->TypeTableBytes);
+			}
+
+			return SNew(STextBlock).Text(Text);
+		}
+
+	private:
+		TSharedPtr<FCSAssemblyMemoryStats> Assembly;
+	};
+
+	class SCSClassHandleRow : public SMultiColumnTableRow<TSharedPtr<FCSClassHandleCount>>
+	{
+	public:
+		SLATE_BEGIN_ARGS(SCSClassHandleRow) {}
+		SLATE_END_ARGS()
+
+		void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& OwnerTable, TSharedPtr<FCSClassHandleCount> InClassCount)
+		{
+			ClassCount = InClassCount;
+			SMultiColumnTableRow::Construct(FSuperRowType::FArguments(), OwnerTable);
+		}
+
+		virtual TSharedRef<SWidget> GenerateWidgetForColumn(const FName& ColumnName) override
+		{
+			const FText Text = ColumnName == CSMemoryDashboardColumns::Name ? FText::FromName(ClassCount->ClassName) : FText::AsNumber(ClassCount->NumObjects);
+			return SNew(STextBlock).Text(Text);
+		}
+
+	private:
+		TSharedPtr<FCSClassHandleCount> ClassCount;
+	};
+}
+
+void SCSMemoryDashboard::Construct(const FArguments& InArgs)
+{
+	using namespace CSMemoryDashboardColumns;
+
+	NumTopClasses = InArgs._NumTopClasses;
+
+	ChildSlot
+	[
+		SNew(SScrollBox)
+		+ SScrollBox::Slot()
+		.Padding(8)
+		[
+			SNew(SVerticalBox)
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.Padding(0, 0, 0, 4)
+			[
+				SNew(STextBlock)
+				.Text(this, &SCSMemoryDashboard::GetHandleTablesText)
+			]
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.Padding(0, 0, 0, 4)
+			[
+				SNew(STextBlock)
+				.Text(this, &SCSMemoryDashboard::GetHandlesText)
+			]
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.Padding(0, 0, 0, 12)
+			[
+				SNew(STextBlock)
+				.Text(this, &SCSMemoryDashboard::GetManagedHeapText)
+			]
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.Padding(0, 0, 0, 12)
+			[
+				SAssignNew(AssemblyList, SListView<TSharedPtr<FCSAssemblyMemoryStats>>)
+				.ListItemsSource(&AssemblyItems)
+				.SelectionMode(ESelectionMode::None)
+				.OnGenerateRow(this, &SCSMemoryDashboard::OnGenerateAssemblyRow)
+				.HeaderRow
+				(
+					SNew(SHeaderRow)
+					+ SHeaderRow::Column(Name).DefaultLabel(LOCTEXT("MemoryAssembly", "Assembly")).FillWidth(3.0f)
+					+ SHeaderRow::Column(Handles).DefaultLabel(LOCTEXT("MemoryHandles", "Handles")).FillWidth(1.0f)
+					+ SHeaderRow::Column(Strong).DefaultLabel(LOCTEXT("MemoryStrong", "Strong")).FillWidth(1.0f)
+					+ SHeaderRow::Column(Weak).DefaultLabel(LOCTEXT("MemoryWeak", "Weak")).FillWidth(1.0f)
+					+ SHeaderRow::Column(Pinned).DefaultLabel(LOCTEXT("MemoryPinned", "Pinned")).FillWidth(1.0f)
+					+ SHeaderRow::Column(HandleKB).DefaultLabel(LOCTEXT("MemoryHandleKB", "Handle KB")).FillWidth(1.0f)
+					+ SHeaderRow::Column(Types).DefaultLabel(LOCTEXT("MemoryTypes", "Types")).FillWidth(1.0f)
+					+ SHeaderRow::Column(TypeTableKB).DefaultLabel(LOCTEXT("MemoryTypeTableKB", "Type Table KB")).FillWidth(1.0f)
+				)
+			]
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			[
+				SAssignNew(ClassList, SListView<TSharedPtr<FCSClassHandleCount>>)
+				.ListItemsSource(&ClassItems)
+				.SelectionMode(ESelectionMode::None)
+				.OnGenerateRow(this, &SCSMemoryDashboard::OnGenerateClassRow)
+				.HeaderRow
+				(
+					SNew(SHeaderRow)
+					+ SHeaderRow::Column(Name).DefaultLabel(LOCTEXT("MemoryClass", "Class")).FillWidth(3.0f)
+					+ SHeaderRow::Column(Objects).DefaultLabel(LOCTEXT("MemoryObjects", "Objects")).FillWidth(1.0f)
+				)
+			]
+		]
+	];
+
+	Refresh(0.0, 0.0f);
+	RegisterActiveTimer(InArgs._RefreshInterval, FWidgetActiveTimerDelegate::CreateSP(this, &SCSMemoryDashboard::Refresh));
+}
+
+TSharedRef<SDockTab> SCSMemoryDashboard::SpawnTab(const FSpawnTabArgs& Args)
+{
+	return SNew(SDockTab)
+		.TabRole(ETabRole::NomadTab)
+		[
+			SNew(SCSMemoryDashboard)
+		];
+}
+
+EActiveTimerReturnType SCSMemoryDashboard::Refresh(double InCurrentTime, float InDeltaTime)
+{
+	Report = FCSHandleMemoryReport::Capture(NumTopClasses);
+
+	if (InitialNumObjectHandles == INDEX_NONE)
+	{
+		InitialNumObjectHandles = Report.NumObjectHandles;
+	}
+
+	if (InitialManagedHeapSizeMB == 0.0 && Report.bHasManagedHeapSample)
+	{
+		InitialManagedHeapSizeMB = Report.GCStats.ManagedHeapSizeMB;
+	}
+
+	AssemblyItems.Reset(Report.Assemblies.Num());
+	for (const FCSAssemblyMemoryStats& Assembly : Report.Assemblies)
+	{
+		AssemblyItems.Add(MakeShared<FCSAssemblyMemoryStats>(Assembly));
+	}
+
+	ClassItems.Reset(Report.TopClasses.Num());
+	for (const FCSClassHandleCount& ClassCount : Report.TopClasses)
+	{
+		ClassItems.Add(MakeShared<FCSClassHandleCount>(ClassCount));
+	}
+
+	AssemblyList->RequestListRefresh();
+	ClassList->RequestListRefresh();
+
+	return EActiveTimerReturnType::Continue;
+}
+
+FText SCSMemoryDashboard::GetHandleTablesText() const
+{
+	return FText::Format(LOCTEXT("MemoryHandleTables", "Object handles: {0} ({1} since opened, {2} stale), {3} KB    Interface wrappers: {4}, {5} KB"),
+		FText::AsNumber(Report.NumObjectHandles),
+		FText::AsNumber(Report.NumObjectHandles - InitialNumObjectHandles),
+		FText::AsNumber(Report.NumStaleObjectHandles),
+		AsKB(Report.ObjectHandleTableBytes),
+		FText::AsNumber(Report.NumInterfaceWrappers),
+		AsKB(Report.InterfaceWrapperTableBytes));
+}
+
+FText SCSMemoryDashboard::GetHandlesText() const
+{
+	return FText::Format(LOCTEXT("MemoryHandles", "Handles: {0} strong, {1} weak, {2} pinned, {3} KB    Orphaned: {4}    Pressure: {5}"),
+		FText::AsNumber(Report.NumStrongHandles),
+		FText::AsNumber(Report.NumWeakHandles),
+		FText::AsNumber(Report.NumPinnedHandles),
+		AsKB(Report.HandleBytes),
+		FText::AsNumber(Report.GCStats.OrphanedHandleCount),
+		FText::FromString(FCSGCPressureMonitor::GetPressureLevelDescription(Report.GCStats.PressureLevel)));
+}
+
+FText SCSMemoryDashboard::GetManagedHeapText() const
+{
+	if (!Report.bHasManagedHeapSample)
+	{
+		return LOCTEXT("MemoryHeapNotSampled", "Managed heap: not sampled");
+	}
+
+	const FCSGCPressureMonitor::FGCStats& Stats = Report.GCStats;
+	FNumberFormattingOptions Options;
+	Options.MinimumFractionalDigits = 1;
+	Options.MaximumFractionalDigits = 1;
+
+	return FText::Format(LOCTEXT("MemoryHeap", "Managed heap: {0} MB ({1} MB since opened, {2} MB fragmented)    Gen0 {3} MB, Gen1 {4} MB, Gen2 {5} MB, LOH {6} MB, POH {7} MB    Allocating {8} MB/s"),
+		FText::AsNumber(Stats.ManagedHeapSizeMB, &Options),
+		FText::AsNumber(Stats.ManagedHeapSizeMB - InitialManagedHeapSizeMB, &Options),
+		FText::AsNumber(Stats.ManagedFragmentedMB, &Options),
+		FText::AsNumber(Stats.ManagedGen0SizeMB, &Options),
+		FText::AsNumber(Stats.ManagedGen1SizeMB, &Options),
+		FText::AsNumber(Stats.ManagedGen2SizeMB, &Options),
+		FText::AsNumber(Stats.ManagedLargeObjectHeapSizeMB, &Options),
+		FText::AsNumber(Stats.ManagedPinnedObjectHeapSizeMB, &Options),
+		FText::AsNumber(Stats.ManagedAllocationRateMBPerSecond, &Options));
+}
+
+TSharedRef<ITableRow> SCSMemoryDashboard::OnGenerateAssemblyRow(TSharedPtr<FCSAssemblyMemoryStats> Assembly, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	return SNew(SCSAssemblyMemoryRow, OwnerTable, Assembly);
+}
+
+TSharedRef<ITableRow> SCSMemoryDashboard::OnGenerateClassRow(TSharedPtr<FCSClassHandleCount> ClassCount, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	return SNew(SCSClassHandleRow, OwnerTable, ClassCount);
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "CSHandleMemoryReport.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SListView.h"
+
+/**
+ * Live view of FCSHandleMemoryReport: handle tables, handles and types per assembly, the managed heap and the
+ * classes with the most managed objects. Captures a new report every RefreshInterval seconds.
+ */
+class SCSMemoryDashboard : public SCompoundWidget
+{
+public:
+
+	SLATE_BEGIN_ARGS(SCSMemoryDashboard)
+		: _RefreshInterval(1.0f)
+		, _NumTopClasses(25)
+		{}
+		SLATE_ARGUMENT(float, RefreshInterval)
+		SLATE_ARGUMENT(int32, NumTopClasses)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	static const FName TabName;
+	static TSharedRef<class SDockTab> SpawnTab(const class FSpawnTabArgs& Args);
+
+private:
+
+	EActiveTimerReturnType Refresh(double InCurrentTime, float InDeltaTime);
+
+	FText GetHandleTablesText() const;
+	FText GetHandlesText() const;
+	FText GetManagedHeapText() const;
+
+	TSharedRef<ITableRow> OnGenerateAssemblyRow(TSharedPtr<FCSAssemblyMemoryStats> Assembly, const TSharedRef<STableViewBase>& OwnerTable);
+	TSharedRef<ITableRow> OnGenerateClassRow(TSharedPtr<FCSClassHandleCount> ClassCount, const TSharedRef<STableViewBase>& OwnerTable);
+
+	FCSHandleMemoryReport Report;
+	int32 NumTopClasses = 25;
+
+	// Values at the first capture, so growth over a long session shows up next to the current values.
+	int32 InitialNumObjectHandles = INDEX_NONE;
+	double InitialManagedHeapSizeMB = 0.0;
+
+	TArray<TSharedPtr<FCSAssemblyMemoryStats>> AssemblyItems;
+	TArray<TSharedPtr<FCSClassHandleCount>> ClassItems;
+
+	TSharedPtr<SListView<TSharedPtr<FCSAssemblyMemoryStats>>> AssemblyList;
+	TSharedPtr<SListView<TSharedPtr<FCSClassHandleCount>>> ClassList;
+};
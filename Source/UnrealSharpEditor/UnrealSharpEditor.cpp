@@ -6,6 +6,7 @@
 #include "DirectoryWatcherModule.h"
 #include "CSStyle.h"
 #include "CSUnrealSharpEditorSettings.h"
+#include "CSUnrealSharpSettings.h"
 #include "DesktopPlatformModule.h"
 #include "IDirectoryWatcher.h"
 #include "IPluginBrowser.h"
@@ -26,11 +27,17 @@
 #include "Kismet2/DebuggerCommands.h"
 #include "Logging/StructuredLog.h"
 #include "Misc/ScopedSlowTask.h"
+#include "Misc/PathViews.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
 #include "Plugins/CSPluginTemplateDescription.h"
+#include "ThreadSafety/CSAtomicHotReloadState.h"
+#include "Slate/CSMemoryDashboard.h"
 #include "Slate/CSNewProjectWizard.h"
 #include "TypeGenerator/Register/CSGeneratedClassBuilder.h"
 #include "UnrealSharpProcHelper/CSProcHelper.h"
 #include "Widgets/Notifications/SNotificationList.h"
+#include "Widgets/Text/STextBlock.h"
 #include "TypeGenerator/CSClass.h"
 #include "TypeGenerator/CSEnum.h"
 #include "TypeGenerator/CSScriptStruct.h"
@@ -60,10 +67,38 @@ void FUnrealSharpEditorModule::StartupModule()
 		AddDirectoryToWatch(Path);
 	}
 
+	// The project scan is cached, projects added or removed outside the editor have to reset it.
+	FDirectoryWatcherModule& DirectoryWatcherModule = FModuleManager::LoadModuleChecked<FDirectoryWatcherModule>("DirectoryWatcher");
+	for (const FString& ProjectRoot : { FCSProcHelper::GetScriptFolderDirectory(), FPaths::ProjectPluginsDir() })
+	{
+		if (!FPaths::DirectoryExists(ProjectRoot))
+		{
+			continue;
+		}
+
+		FDelegateHandle Handle;
+		DirectoryWatcherModule.Get()->RegisterDirectoryChangedCallback_Handle(
+			ProjectRoot,
+			IDirectoryWatcher::FDirectoryChanged::CreateRaw(this, &FUnrealSharpEditorModule::OnProjectFilesChanged),
+			Handle);
+	}
+
 	Manager = &UCSManager::GetOrCreate();
 	Manager->OnNewStructEvent().AddRaw(this, &FUnrealSharpEditorModule::OnStructRebuilt);
 	Manager->OnNewClassEvent().AddRaw(this, &FUnrealSharpEditorModule::OnClassRebuilt);
 	Manager->OnNewEnumEvent().AddRaw(this, &FUnrealSharpEditorModule::OnEnumRebuilt);
+	Manager->OnManagedAssemblyLoadedEvent().AddRaw(this, &FUnrealSharpEditorModule::OnManagedAssemblyLoaded);
+
+	// Remember what the assemblies looked like at startup, so the first Hot Reload knows what changed.
+	{
+		TArray<FString> ProjectsByLoadOrder;
+		FCSProcHelper::GetProjectNamesByLoadOrder(ProjectsByLoadOrder, true);
+
+		for (const FString& ProjectName : ProjectsByLoadOrder)
+		{
+			UpdateAssemblyHash(ProjectName);
+		}
+	}
 
 	FEditorDelegates::ShutdownPIE.AddRaw(this, &FUnrealSharpEditorModule::OnPIEShutdown);
 
@@ -95,16 +130,31 @@ void FUnrealSharpEditorModule::StartupModule()
 	RegisterMenu();
     RegisterPluginTemplates();
 
+	FGlobalTabmanager::Get()->RegisterNomadTabSpawner(SCSMemoryDashboard::TabName, FOnSpawnTab::CreateStatic(&SCSMemoryDashboard::SpawnTab))
+		.SetDisplayName(LOCTEXT("MemoryDashboardTab", "UnrealSharp Memory"))
+		.SetMenuType(ETabSpawnerMenuType::Hidden);
+
 	UCSManager& CSharpManager = UCSManager::Get();
 	CSharpManager.LoadPluginAssemblyByName(TEXT("UnrealSharp.Editor"));
 }
 
 void FUnrealSharpEditorModule::ShutdownModule()
 {
+	if (PendingBuild.IsValid())
+	{
+		PendingBuild.Wait();
+	}
+	
+
 	FTSTicker::GetCoreTicker().RemoveTicker(TickDelegateHandle);
 	UToolMenus::UnRegisterStartupCallback(this);
 	UToolMenus::UnregisterOwner(this);
     UnregisterPluginTemplates();
+
+	if (FSlateApplication::IsInitialized())
+	{
+		FGlobalTabmanager::Get()->UnregisterNomadTabSpawner(SCSMemoryDashboard::TabName);
+	}
 }
 
 void FUnrealSharpEditorModule::OnCSharpCodeModified(const TArray<FFileChangeData>& ChangedFiles)
@@ -116,65 +166,122 @@ void FUnrealSharpEditorModule::OnCSharpCodeModified(const TArray<FFileChangeData
 
 	const UCSUnrealSharpEditorSettings* Settings = GetDefault<UCSUnrealSharpEditorSettings>();
 
-	if (FPlayWorldCommandCallbacks::IsInPIE() && Settings->AutomaticHotReloading == OnScriptSave)
+	// Background builds can run during PIE, only the swap waits for PIE to end.
+	if (FPlayWorldCommandCallbacks::IsInPIE() && Settings->AutomaticHotReloading == OnScriptSave && !Settings->bBuildInBackground)
 	{
 		bHasQueuedHotReload = true;
 		return;
 	}
 
+	const bool bWatchModules = Settings->AutomaticHotReloading == OnModuleChange;
+	
 	for (const FFileChangeData& ChangedFile : ChangedFiles)
 	{
-		FString NormalizedFileName = ChangedFile.Filename;
-		FPaths::NormalizeFilename(NormalizedFileName);
+		// Cheapest test first, most changes in the watched folders are build artifacts we don't care about.
+		const FStringView Extension = FPathViews::GetExtension(ChangedFile.Filename);
+		const bool bIsScript = Extension.Equals(TEXT("cs"), ESearchCase::IgnoreCase);
+		const bool bIsModule = bWatchModules && Extension.Equals(TEXT("dll"), ESearchCase::IgnoreCase);
 
-		// Skip ProjectGlue files
-		if (NormalizedFileName.Contains("Glue"))
+		if (!bIsScript && !bIsModule)
 		{
 			continue;
 		}
+		
+		FString NormalizedFileName = ChangedFile.Filename;
+		FPaths::NormalizeFilename(NormalizedFileName);
 
-		// Skip generated files in bin and obj folders
-		if (NormalizedFileName.Contains(TEXT("/obj/")))
+		// Skip ProjectGlue files and generated files in the obj folders
+		if (NormalizedFileName.Contains(TEXT("Glue")) || NormalizedFileName.Contains(TEXT("/obj/")))
 		{
 			continue;
 		}
 
-		if (Settings->AutomaticHotReloading == OnModuleChange && NormalizedFileName.EndsWith(".dll") &&
-			NormalizedFileName.Contains(TEXT("/bin/")))
+		// Modules only count in the bin folders, scripts only outside of them.
+		const bool bInBinFolder = NormalizedFileName.Contains(TEXT("/bin/"));
+		if (bIsModule && bInBinFolder)
 		{
-			// A module changed, initiate the reload and return
-			StartHotReload(false);
-			return;
+			bHasPendingModuleChange = true;
 		}
-
-		// Check if the file is a .cs file and not in the bin directory
-		FString Extension = FPaths::GetExtension(NormalizedFileName);
-		if (Extension != "cs" || NormalizedFileName.Contains(TEXT("/bin/")))
+		else if (bIsScript && !bInBinFolder)
+		{
+			bHasPendingScriptChange = true;
+			ChangedScripts.Add(MoveTemp(NormalizedFileName));
+		}
+		else
 		{
 			continue;
 		}
 
-		// Return on the first .cs file we encounter so we can reload.
-		if (Settings->AutomaticHotReloading != OnScriptSave)
+		// Every relevant change restarts the quiet window, so a save-all ends up as a single reload.
+		LastFileChangeTime = FPlatformTime::Seconds();
+	}
+}
+
+void FUnrealSharpEditorModule::OnProjectFilesChanged(const TArray<FFileChangeData>& ChangedFiles)
+{
+	for (const FFileChangeData& ChangedFile : ChangedFiles)
+	{
+		if (ChangedFile.Action == FFileChangeData::FCA_Modified)
 		{
-			HotReloadStatus = PendingReload;
+			continue;
 		}
-		else
+
+		const FStringView Extension = FPathViews::GetExtension(ChangedFile.Filename);
+		if (Extension.Equals(TEXT("csproj"), ESearchCase::IgnoreCase) || Extension.Equals(TEXT("uplugin"), ESearchCase::IgnoreCase))
 		{
-			StartHotReload(true);
+			FCSProcHelper::InvalidateProjectPathsCache();
+			return;
 		}
+	}
+}
 
+void FUnrealSharpEditorModule::FlushPendingFileChanges()
+{
+	if (!bHasPendingModuleChange && !bHasPendingScriptChange)
+	{
 		return;
 	}
+
+	const UCSUnrealSharpEditorSettings* Settings = GetDefault<UCSUnrealSharpEditorSettings>();
+	if (FPlatformTime::Seconds() - LastFileChangeTime < Settings->FileChangeQuietTime)
+	{
+		return;
+	}
+
+	const bool bModuleChanged = bHasPendingModuleChange;
+	bHasPendingModuleChange = false;
+	bHasPendingScriptChange = false;
+
+	if (bModuleChanged)
+	{
+		// A module was built outside the editor, just reload it.
+		StartHotReload(false);
+	}
+	else if (Settings->AutomaticHotReloading != OnScriptSave)
+	{
+		HotReloadStatus = PendingReload;
+	}
+	else
+	{
+		StartHotReload(true);
+	}
 }
 
 void FUnrealSharpEditorModule::StartHotReload(bool bRebuild, bool bPromptPlayerWithNewProject)
 {
 	if (HotReloadStatus == FailedToUnload)
 	{
-		// If we failed to unload an assembly, we can't hot reload until the editor is restarted.
+		// Can't load new assemblies while the old ones are still alive, PollPendingUnloads resumes once they're gone.
 		bHotReloadFailed = true;
-		UE_LOGFMT(LogUnrealSharpEditor, Error, "Hot reload is disabled until the editor is restarted.");
+		UE_LOGFMT(LogUnrealSharpEditor, Error, "Hot reload is paused until the assemblies that failed to unload are gone.");
+		return;
+	}
+
+	if (HotReloadStatus == Compiling)
+	{
+		// Changes came in while building, build again once the current build is done.
+		bHasQueuedBuild = true;
+		bQueuedBuildRebuild |= bRebuild;
 		return;
 	}
 
@@ -191,33 +298,168 @@ void FUnrealSharpEditorModule::StartHotReload(bool bRebuild, bool bPromptPlayerW
 		return;
 	}
 
+	if (GetDefault<UCSUnrealSharpEditorSettings>()->bBuildInBackground)
+	{
+		StartBackgroundBuild(bRebuild);
+		return;
+	}
+
 	HotReloadStatus = Active;
 	double StartTime = FPlatformTime::Seconds();
 
-	FScopedSlowTask Progress(3, LOCTEXT("HotReload", "Reloading C#..."));
-	Progress.MakeDialog();
+	{
+		FScopedSlowTask Progress(1, LOCTEXT("HotReload", "Reloading C#..."));
+		Progress.MakeDialog();
+
+		const FCSBuildResult Result = MakeBuildTask(bRebuild)();
+		if (!Result.bSucceeded)
+		{
+			OnBuildFailed(Result.ExceptionMessage);
+			return;
+		}
+	}
+
+	LastBuildTimeMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	BuildingChangedScripts.Reset();
+	ReloadAssemblies(StartTime);
+}
 
+TUniqueFunction<FCSBuildResult()> FUnrealSharpEditorModule::MakeBuildTask(bool bRebuild)
+{
 	FString SolutionPath = FCSProcHelper::GetPathToSolution();
 	FString OutputPath = FCSProcHelper::GetUserAssemblyDirectory();
 
+	// Without any known changes, for example a manual reload, the whole solution is built
+	FString ChangedFiles;
+	if (bRebuild)
+	{
+		BuildingChangedScripts.Append(MoveTemp(ChangedScripts));
+		ChangedScripts.Reset();
+		ChangedFiles = FString::Join(BuildingChangedScripts, TEXT(";"));
+	}
+
 	const UCSUnrealSharpEditorSettings* Settings = GetDefault<UCSUnrealSharpEditorSettings>();
 	FString BuildConfiguration = Settings->GetBuildConfigurationString();
 	ECSLoggerVerbosity LogVerbosity = Settings->LogVerbosity;
 
-	FString ExceptionMessage;
-	if (!ManagedUnrealSharpEditorCallbacks.Build(*SolutionPath, *OutputPath, *BuildConfiguration, LogVerbosity, &ExceptionMessage, bRebuild))
+	return [Build = ManagedUnrealSharpEditorCallbacks.Build, SolutionPath = MoveTemp(SolutionPath), OutputPath = MoveTemp(OutputPath),
+		BuildConfiguration = MoveTemp(BuildConfiguration), LogVerbosity, bRebuild, ChangedFiles = MoveTemp(ChangedFiles)]()
 	{
-	 	HotReloadStatus = Inactive;
-		bHotReloadFailed = true;
-	 	FMessageDialog::Open(EAppMsgType::Ok, FText::FromString(ExceptionMessage), FText::FromString(TEXT("Building C# Project Failed")));
+		FCSBuildResult Result;
+		Result.bSucceeded = Build(*SolutionPath, *OutputPath, *BuildConfiguration, LogVerbosity, &Result.ExceptionMessage, bRebuild, *ChangedFiles);
+		return Result;
+	};
+}
+
+void FUnrealSharpEditorModule::OnBuildFailed(const FString& ExceptionMessage)
+{
+	// The failed projects still need to be built next time
+	ChangedScripts.Append(MoveTemp(BuildingChangedScripts));
+	BuildingChangedScripts.Reset();
+
+	HotReloadStatus = Inactive;
+	bHotReloadFailed = true;
+	FMessageDialog::Open(EAppMsgType::Ok, FText::FromString(ExceptionMessage), FText::FromString(TEXT("Building C# Project Failed")));
+}
+
+void FUnrealSharpEditorModule::StartBackgroundBuild(bool bRebuild)
+{
+	HotReloadStatus = Compiling;
+	BuildStartTime = FPlatformTime::Seconds();
+
+	FNotificationInfo Info(LOCTEXT("CompilingCSharp", "Compiling C#..."));
+	Info.bFireAndForget = false;
+	Info.ExpireDuration = 2.0f;
+	BuildNotification = FSlateNotificationManager::Get().AddNotification(Info);
+	
+	if (BuildNotification.IsValid())
+	{
+		BuildNotification->SetCompletionState(SNotificationItem::CS_Pending);
+	}
+
+	// The BuildTool doesn't touch any engine state, so it's safe to run off the game thread.
+	// Only the swap of the assemblies has to happen on the game thread, once the build is done.
+	PendingBuild = Async(EAsyncExecution::Thread, MakeBuildTask(bRebuild));
+}
+
+void FUnrealSharpEditorModule::FinishBackgroundBuild()
+{
+	const FCSBuildResult Result = PendingBuild.Get();
+	PendingBuild = TFuture<FCSBuildResult>();
+
+	if (BuildNotification.IsValid())
+	{
+		BuildNotification->SetText(Result.bSucceeded ? LOCTEXT("CompiledCSharp", "C# compiled") : LOCTEXT("CompileCSharpFailed", "C# compile failed"));
+		BuildNotification->SetCompletionState(Result.bSucceeded ? SNotificationItem::CS_Success : SNotificationItem::CS_Fail);
+		BuildNotification->ExpireAndFadeout();
+		BuildNotification.Reset();
+	}
+
+	if (bHasQueuedBuild)
+	{
+		// The result is already stale, build the latest changes before swapping anything.
+		const bool bRebuild = bQueuedBuildRebuild;
+		bHasQueuedBuild = false;
+		bQueuedBuildRebuild = false;
+		StartBackgroundBuild(bRebuild);
 		return;
 	}
 
+	if (!Result.bSucceeded)
+	{
+		OnBuildFailed(Result.ExceptionMessage);
+		return;
+	}
+
+	BuildingChangedScripts.Reset();
+	LastBuildTimeMs = (FPlatformTime::Seconds() - BuildStartTime) * 1000.0;
+	UE_LOG(LogUnrealSharpEditor, Log, TEXT("C# build took %.2f seconds in the background"), LastBuildTimeMs / 1000.0);
+
+	if (FPlayWorldCommandCallbacks::IsInPIE())
+	{
+		// Assemblies can't be swapped while playing, do it as soon as PIE ends.
+		HotReloadStatus = Inactive;
+		bHasPendingAssemblySwap = true;
+		return;
+	}
+
+	HotReloadStatus = Active;
+	ReloadAssemblies(FPlatformTime::Seconds());
+}
+
+void FUnrealSharpEditorModule::ReloadAssemblies(double StartTime)
+{
+	FScopedSlowTask Progress(2, LOCTEXT("HotReload", "Reloading C#..."));
+	Progress.MakeDialog();
+
+	bHasPendingAssemblySwap = false;
+
 	UCSManager& CSharpManager = UCSManager::Get();
 	bool bUnloadFailed = false;
 
 	TArray<FString> ProjectsByLoadOrder;
 	FCSProcHelper::GetProjectNamesByLoadOrder(ProjectsByLoadOrder, true);
+
+	TSet<FString> ProjectsToReload;
+	GetProjectsToReload(ProjectsByLoadOrder, ProjectsToReload);
+
+	if (ProjectsToReload.IsEmpty())
+	{
+		UE_LOGFMT(LogUnrealSharpEditor, Display, "No C# assemblies changed, skipping reload.");
+		HotReloadStatus = Inactive;
+		bHotReloadFailed = false;
+		return;
+	}
+
+	ProjectsByLoadOrder.RemoveAll([&ProjectsToReload](const FString& ProjectName)
+	{
+		return !ProjectsToReload.Contains(ProjectName);
+	});
+
+	// A background build ran while the editor was usable, so only a foreground build is part of the total.
+	FCSAtomicHotReloadState& HotReloadState = GetGlobalAtomicHotReloadState();
+	HotReloadState.BeginTimingBreakdown();
+	HotReloadState.RecordPhaseTime(FCSAtomicHotReloadState::EHotReloadPhase::Build, LastBuildTimeMs);
 	
 	// Unload all assemblies in reverse order to prevent unloading an assembly that is still being referenced.
 	// For instance, most assemblies depend on ProjectGlue, so it must be unloaded last.
@@ -229,7 +471,13 @@ void FUnrealSharpEditorModule::StartHotReload(bool bRebuild, bool bPromptPlayerW
 		const FString& ProjectName = ProjectsByLoadOrder[i];
 		UCSAssembly* Assembly = CSharpManager.FindAssembly(*ProjectName);
 
-		if (IsValid(Assembly) && !Assembly->UnloadAssembly())
+		if (!IsValid(Assembly))
+		{
+			continue;
+		}
+
+		FCSScopedHotReloadPhase UnloadPhase(FCSAtomicHotReloadState::EHotReloadPhase::Unload, FName(*ProjectName));
+		if (!Assembly->UnloadAssembly())
 		{
 			UE_LOGFMT(LogUnrealSharpEditor, Error, "Failed to unload assembly: {0}", *ProjectName);
 			bUnloadFailed = true;
@@ -241,9 +489,10 @@ void FUnrealSharpEditorModule::StartHotReload(bool bRebuild, bool bPromptPlayerW
 	{
 		HotReloadStatus = FailedToUnload;
 		bHotReloadFailed = true;
+		HotReloadState.EndTimingBreakdown(false, (FPlatformTime::Seconds() - StartTime) * 1000.0);
 
 		FMessageDialog::Open(EAppMsgType::Ok, LOCTEXT("HotReloadFailure",
-		                                              "One or more assemblies failed to unload. Hot reload will be disabled until the editor restarts.\n\n"
+		                                              "One or more assemblies failed to unload. Hot reload resumes once they do, the log lists what keeps them alive.\n\n"
 		                                              "Possible causes: Strong GC handles, running threads, etc."),
 		                     FText::FromString(TEXT("Hot Reload Failed")));
 
@@ -255,24 +504,143 @@ void FUnrealSharpEditorModule::StartHotReload(bool bRebuild, bool bPromptPlayerW
 	{
 		UCSAssembly* Assembly = CSharpManager.FindAssembly(*ProjectName);
 
-		if (IsValid(Assembly))
-		{
-			Assembly->LoadAssembly();
-		}
-		else
 		{
-			// If the assembly is not loaded. It's a new project, and we need to load it.
-			CSharpManager.LoadUserAssemblyByName(*ProjectName);
+			FCSScopedHotReloadPhase LoadPhase(FCSAtomicHotReloadState::EHotReloadPhase::Load, FName(*ProjectName));
+			if (IsValid(Assembly))
+			{
+				Assembly->LoadAssembly();
+			}
+			else
+			{
+				// If the assembly is not loaded. It's a new project, and we need to load it.
+				CSharpManager.LoadUserAssemblyByName(*ProjectName);
+			}
 		}
+
+		UpdateAssemblyHash(ProjectName);
 	}
 
 	Progress.EnterProgressFrame(1, LOCTEXT("HotReload", "Refreshing Affected Blueprints..."));
-	RefreshAffectedBlueprints();
+	{
+		FCSScopedHotReloadPhase RefreshPhase(FCSAtomicHotReloadState::EHotReloadPhase::RefreshBlueprints);
+		RefreshAffectedBlueprints();
+	}
 
 	HotReloadStatus = Inactive;
 	bHotReloadFailed = false;
 
-	UE_LOG(LogUnrealSharpEditor, Log, TEXT("Hot reload took %.2f seconds to execute"), FPlatformTime::Seconds() - StartTime);
+	const double ElapsedSeconds = FPlatformTime::Seconds() - StartTime;
+	HotReloadState.EndTimingBreakdown(true, ElapsedSeconds * 1000.0);
+
+	UE_LOG(LogUnrealSharpEditor, Log, TEXT("Hot reload took %.2f seconds to execute"), ElapsedSeconds);
+
+	SendAssembliesToDevice(ProjectsByLoadOrder);
+}
+
+void FUnrealSharpEditorModule::SendAssembliesToDevice(const TArray<FString>& ProjectNames)
+{
+	const FString& DeviceAddress = GetDefault<UCSUnrealSharpEditorSettings>()->DeviceHotReloadAddress;
+	if (DeviceAddress.IsEmpty())
+	{
+		DeviceTransport.Disconnect();
+		return;
+	}
+
+	const UCSUnrealSharpSettings* Settings = GetDefault<UCSUnrealSharpSettings>();
+	if (!DeviceTransport.IsConnected() || DeviceTransportAddress != DeviceAddress)
+	{
+		DeviceTransportAddress = DeviceAddress;
+		if (!DeviceTransport.Connect(DeviceAddress, Settings->DeviceHotReloadSecret, Settings->DeviceHotReloadPort))
+		{
+			UE_LOGFMT(LogUnrealSharpEditor, Warning, "Couldn't connect to {0} to send the hot reloaded assemblies.", *DeviceAddress);
+			return;
+		}
+	}
+
+	for (const FString& ProjectName : ProjectNames)
+	{
+		const FString AssemblyPath = FPaths::Combine(FCSProcHelper::GetUserAssemblyDirectory(), ProjectName + TEXT(".dll"));
+
+		TArray<uint8> AssemblyData;
+		if (!FFileHelper::LoadFileToArray(AssemblyData, *AssemblyPath) || !DeviceTransport.SendAssembly(ProjectName, AssemblyData))
+		{
+			UE_LOGFMT(LogUnrealSharpEditor, Warning, "Failed to hot reload {0} on {1}.", *ProjectName, *DeviceAddress);
+		}
+	}
+}
+
+void FUnrealSharpEditorModule::UpdateAssemblyHash(const FString& ProjectName)
+{
+	const FString AssemblyPath = FPaths::Combine(FCSProcHelper::GetUserAssemblyDirectory(), ProjectName + TEXT(".dll"));
+	AssemblyHashes.Add(ProjectName, FMD5Hash::HashFile(*AssemblyPath));
+}
+
+bool FUnrealSharpEditorModule::HasAssemblyChanged(const FString& ProjectName) const
+{
+	const FMD5Hash* LoadedHash = AssemblyHashes.Find(ProjectName);
+	if (!LoadedHash || !LoadedHash->IsValid())
+	{
+		return true;
+	}
+
+	const FString AssemblyPath = FPaths::Combine(FCSProcHelper::GetUserAssemblyDirectory(), ProjectName + TEXT(".dll"));
+	return FMD5Hash::HashFile(*AssemblyPath) != *LoadedHash;
+}
+
+void FUnrealSharpEditorModule::OnManagedAssemblyLoaded(const FName& AssemblyName)
+{
+	if (!IsHotReloading())
+	{
+		UpdateAssemblyHash(AssemblyName.ToString());
+	}
+}
+
+void FUnrealSharpEditorModule::GetProjectsToReload(const TArray<FString>& ProjectsByLoadOrder, TSet<FString>& OutProjectsToReload) const
+{
+	TMap<FString, TArray<FString>> ProjectReferences;
+	if (!GetDefault<UCSUnrealSharpEditorSettings>()->bIncrementalHotReload || !FCSProcHelper::GetProjectReferences(ProjectReferences))
+	{
+		// Without the references we can't tell what depends on what, reload everything.
+		OutProjectsToReload.Append(ProjectsByLoadOrder);
+		return;
+	}
+
+	TMap<FString, TArray<FString>> ReferencingProjects;
+	for (const TPair<FString, TArray<FString>>& Project : ProjectReferences)
+	{
+		for (const FString& Reference : Project.Value)
+		{
+			ReferencingProjects.FindOrAdd(Reference).Add(Project.Key);
+		}
+	}
+
+	TArray<FString> PendingProjects;
+	for (const FString& ProjectName : ProjectsByLoadOrder)
+	{
+		if (HasAssemblyChanged(ProjectName) || !IsValid(Manager->FindAssembly(*ProjectName)))
+		{
+			PendingProjects.Add(ProjectName);
+		}
+	}
+
+	// Anything referencing a changed assembly holds on to its old types, so it has to be cycled as well.
+	while (!PendingProjects.IsEmpty())
+	{
+		FString ProjectName = PendingProjects.Pop();
+		
+		bool bAlreadyAdded = false;
+		OutProjectsToReload.Add(ProjectName, &bAlreadyAdded);
+
+		if (bAlreadyAdded)
+		{
+			continue;
+		}
+
+		if (const TArray<FString>* Dependents = ReferencingProjects.Find(ProjectName))
+		{
+			PendingProjects.Append(*Dependents);
+		}
+	}
 }
 
 void FUnrealSharpEditorModule::InitializeUnrealSharpEditorCallbacks(FCSManagedUnrealSharpEditorCallbacks Callbacks)
@@ -549,6 +917,34 @@ void FUnrealSharpEditorModule::OnRepairComponents()
 	RepairComponents();
 }
 
+void FUnrealSharpEditorModule::OnOpenMemoryDashboard()
+{
+	FGlobalTabmanager::Get()->TryInvokeTab(SCSMemoryDashboard::TabName);
+}
+
+FText FUnrealSharpEditorModule::GetHotReloadTimingText()
+{
+	const FCSAtomicHotReloadState::FHotReloadTimingBreakdown Breakdown = GetGlobalAtomicHotReloadState().GetLastTimingBreakdown();
+	if (!Breakdown.IsValid())
+	{
+		return FText::GetEmpty();
+	}
+
+	return FText::Format(LOCTEXT("HotReloadTiming", "C# reload: {0} s"), FText::AsNumber(Breakdown.TotalTimeMs / 1000.0, &FNumberFormattingOptions::DefaultNoGrouping()));
+}
+
+FText FUnrealSharpEditorModule::GetHotReloadTimingToolTip()
+{
+	const FCSAtomicHotReloadState::FHotReloadTimingBreakdown Breakdown = GetGlobalAtomicHotReloadState().GetLastTimingBreakdown();
+	if (!Breakdown.IsValid())
+	{
+		return FText::GetEmpty();
+	}
+
+	// Same breakdown as UnrealSharp.HotReloadTimings, the history is in Saved/UnrealSharp/HotReloadTimings.json
+	return FText::FromString(FCSAtomicHotReloadState::FormatTimingBreakdown(Breakdown));
+}
+
 void FUnrealSharpEditorModule::OnExploreArchiveDirectory(FString ArchiveDirectory)
 {
 	FPlatformProcess::ExploreFolder(*ArchiveDirectory);
@@ -574,13 +970,102 @@ void FUnrealSharpEditorModule::PackageProject()
 		return;
 	}
 
-	FScopedSlowTask Progress(1, LOCTEXT("USharpPackaging", "Packaging Project..."));
-	Progress.MakeDialog();
+	// Packaging runs in the background, the editor stays responsive and the build can be canceled from the notification.
+	static bool bIsPackagingProject = false;
+	if (bIsPackagingProject)
+	{
+		FMessageDialog::Open(EAppMsgType::Ok, LOCTEXT("USharpAlreadyPackaging", "The project is already being packaged."));
+		return;
+	}
 
 	TMap<FString, FString> Arguments;
 	Arguments.Add("ArchiveDirectory", FCSUnrealSharpUtils::MakeQuotedPath(ArchiveDirectory));
 	Arguments.Add("BuildConfig", "Release");
-	FCSProcHelper::InvokeUnrealSharpBuildTool(BUILD_ACTION_PACKAGE_PROJECT, Arguments);
+
+	const UCSUnrealSharpEditorSettings* Settings = GetDefault<UCSUnrealSharpEditorSettings>();
+	if (Settings->bPackageTrimmed)
+	{
+		Arguments.Add("Trim", "true");
+	}
+
+	if (Settings->bPackageReadyToRun)
+	{
+		Arguments.Add("ReadyToRun", "true");
+		Arguments.Add("CompositeImage", Settings->bPackageCompositeImage ? "true" : "false");
+
+		const FString StartupProfileDirectory = FPaths::ConvertRelativePathToFull(FCSProcHelper::GetStartupProfileDirectory());
+		if (Settings->bUseStartupProfiles && FPaths::DirectoryExists(StartupProfileDirectory))
+		{
+			Arguments.Add("StartupProfileDirectory", FCSUnrealSharpUtils::MakeQuotedPath(StartupProfileDirectory));
+		}
+	}
+
+	TSharedPtr<FCSCommandCancellation> Cancellation = MakeShared<FCSCommandCancellation>();
+
+	FNotificationInfo ProgressInfo(LOCTEXT("USharpPackaging", "Packaging Project..."));
+	ProgressInfo.bFireAndForget = false;
+	ProgressInfo.ExpireDuration = 2.0f;
+	ProgressInfo.ButtonDetails.Add(FNotificationButtonInfo(
+		LOCTEXT("USharpCancelPackaging", "Cancel"),
+		LOCTEXT("USharpCancelPackagingTooltip", "Cancel packaging the project."),
+		FSimpleDelegate::CreateLambda([Cancellation]() { Cancellation->Cancel(); }),
+		SNotificationItem::CS_Pending));
+
+	TSharedPtr<SNotificationItem> ProgressNotification = FSlateNotificationManager::Get().AddNotification(ProgressInfo);
+	if (ProgressNotification.IsValid())
+	{
+		ProgressNotification->SetCompletionState(SNotificationItem::CS_Pending);
+	}
+
+	// The current step is shown as the notification text, and the latest line of the build output under it.
+	FCSOnCommandOutput OnOutput = FCSOnCommandOutput::CreateLambda([WeakNotification = TWeakPtr<SNotificationItem>(ProgressNotification)](const FString& Line)
+	{
+		AsyncTask(ENamedThreads::GameThread, [WeakNotification, Line]()
+		{
+			TSharedPtr<SNotificationItem> Notification = WeakNotification.Pin();
+			if (!Notification.IsValid())
+			{
+				return;
+			}
+
+			static const FString ProgressPrefix = TEXT("UnrealSharpPackageProgress=");
+			if (Line.StartsWith(ProgressPrefix))
+			{
+				Notification->SetText(FText::Format(LOCTEXT("USharpPackagingStep", "Packaging Project ({0})..."), FText::FromString(Line.RightChop(ProgressPrefix.Len()))));
+				Notification->SetSubText(FText::GetEmpty());
+				return;
+			}
+
+			Notification->SetSubText(FText::FromString(Line));
+		});
+	});
+
+	bIsPackagingProject = true;
+	FCSProcHelper::InvokeUnrealSharpBuildToolAsync(BUILD_ACTION_PACKAGE_PROJECT, Arguments, MoveTemp(OnOutput), Cancellation)
+		.Then([ProgressNotification, ArchiveDirectory, ExecutablePath](TFuture<FCSCommandResult> Future)
+		{
+			AsyncTask(ENamedThreads::GameThread, [Result = Future.Get(), ProgressNotification, ArchiveDirectory, ExecutablePath]()
+			{
+				bIsPackagingProject = false;
+				OnPackageProjectFinished(Result, ProgressNotification, ArchiveDirectory, ExecutablePath);
+			});
+		});
+}
+
+void FUnrealSharpEditorModule::OnPackageProjectFinished(const FCSCommandResult& Result, TSharedPtr<SNotificationItem> ProgressNotification, FString ArchiveDirectory, FString ExecutablePath)
+{
+	if (ProgressNotification.IsValid())
+	{
+		ProgressNotification->SetText(Result.Succeeded() ? LOCTEXT("USharpPackaged", "Project packaged") : LOCTEXT("USharpPackagingFailed", "Packaging failed"));
+		ProgressNotification->SetSubText(FText::GetEmpty());
+		ProgressNotification->SetCompletionState(Result.Succeeded() ? SNotificationItem::CS_Success : SNotificationItem::CS_Fail);
+		ProgressNotification->ExpireAndFadeout();
+	}
+
+	if (!FCSProcHelper::ReportCommandResult(Result))
+	{
+		return;
+	}
 
 	FNotificationInfo Info(
 		FText::FromString(
@@ -713,6 +1198,9 @@ TSharedRef<SWidget> FUnrealSharpEditorModule::GenerateUnrealSharpMenu()
 	MenuBuilder.AddMenuEntry(CSCommands.RepairComponents, NAME_None, TAttribute<FText>(), TAttribute<FText>(),
 	                         FSlateIcon(FAppStyle::GetAppStyleSetName(), "SourceControl.Actions.Refresh"));
 
+	MenuBuilder.AddMenuEntry(CSCommands.OpenMemoryDashboard, NAME_None, TAttribute<FText>(), TAttribute<FText>(),
+	                         FSlateIcon(FAppStyle::GetAppStyleSetName(), "MemoryProfiler.Icon"));
+
 	return MenuBuilder.MakeWidget();
 }
 
@@ -744,6 +1232,18 @@ void FUnrealSharpEditorModule::SuggestProjectSetup()
 
 bool FUnrealSharpEditorModule::Tick(float DeltaTime)
 {
+	FlushPendingFileChanges();
+	
+	if (IsBuildingInBackground() && PendingBuild.IsReady())
+	{
+		FinishBackgroundBuild();
+	}
+
+	if (HotReloadStatus == FailedToUnload)
+	{
+		PollPendingUnloads();
+	}
+	
 	const UCSUnrealSharpEditorSettings* Settings = GetDefault<UCSUnrealSharpEditorSettings>();
 	if (Settings->AutomaticHotReloading == OnEditorFocus && !IsHotReloading() && HasPendingHotReloadChanges() &&
 		FApp::HasFocus())
@@ -754,6 +1254,30 @@ bool FUnrealSharpEditorModule::Tick(float DeltaTime)
 	return true;
 }
 
+void FUnrealSharpEditorModule::PollPendingUnloads()
+{
+	// Every poll is a full managed collection, don't run one every frame.
+	const double CurrentTime = FPlatformTime::Seconds();
+	if (CurrentTime - LastUnloadPollTime < 1.0)
+	{
+		return;
+	}
+
+	LastUnloadPollTime = CurrentTime;
+
+	const FCSManagedPluginCallbacks& PluginCallbacks = UCSManager::Get().GetManagedPluginsCallbacks();
+	if (!PluginCallbacks.PollPendingUnloads || PluginCallbacks.PollPendingUnloads() > 0)
+	{
+		return;
+	}
+
+	// The assemblies that were unloaded before the failure are still waiting to be loaded again.
+	UE_LOGFMT(LogUnrealSharpEditor, Display, "The assemblies that failed to unload are gone, resuming hot reload.");
+	HotReloadStatus = Inactive;
+	bHotReloadFailed = false;
+	StartHotReload(false);
+}
+
 void FUnrealSharpEditorModule::RegisterCommands()
 {
 	FCSUnrealSharpEditorCommands::Register();
@@ -782,6 +1306,8 @@ void FUnrealSharpEditorModule::RegisterCommands()
 							   FExecuteAction::CreateStatic(&FUnrealSharpEditorModule::OnRefreshRuntimeGlue));
 	UnrealSharpCommands->MapAction(FCSUnrealSharpEditorCommands::Get().RepairComponents,
 	                               FExecuteAction::CreateStatic(&FUnrealSharpEditorModule::OnRepairComponents));
+	UnrealSharpCommands->MapAction(FCSUnrealSharpEditorCommands::Get().OpenMemoryDashboard,
+	                               FExecuteAction::CreateStatic(&FUnrealSharpEditorModule::OnOpenMemoryDashboard));
 
 	const FLevelEditorModule& LevelEditorModule = FModuleManager::GetModuleChecked<FLevelEditorModule>("LevelEditor");
 	const TSharedRef<FUICommandList> Commands = LevelEditorModule.GetGlobalLevelEditorActions();
@@ -805,6 +1331,16 @@ void FUnrealSharpEditorModule::RegisterMenu()
 		}));
 
 	Section.AddEntry(Entry);
+
+	UToolMenu* StatusBarMenu = UToolMenus::Get()->ExtendMenu("LevelEditor.StatusBar.ToolBar");
+	FToolMenuSection& StatusBarSection = StatusBarMenu->FindOrAddSection("UnrealSharp");
+
+	StatusBarSection.AddEntry(FToolMenuEntry::InitWidget(
+		"UnrealSharpHotReloadTimings",
+		SNew(STextBlock)
+		.Text_Static(&FUnrealSharpEditorModule::GetHotReloadTimingText)
+		.ToolTipText_Static(&FUnrealSharpEditorModule::GetHotReloadTimingToolTip),
+		FText::GetEmpty(), true, false));
 }
 
 void FUnrealSharpEditorModule::RegisterPluginTemplates()
@@ -851,6 +1387,11 @@ void FUnrealSharpEditorModule::OnPIEShutdown(bool IsSimulating)
 		bHasQueuedHotReload = false;
 		StartHotReload();
 	}
+	else if (bHasPendingAssemblySwap && !IsBuildingInBackground())
+	{
+		HotReloadStatus = Active;
+		ReloadAssemblies(FPlatformTime::Seconds());
+	}
 }
 
 void FUnrealSharpEditorModule::AddNewProject(const FString& ModuleName, const FString& ProjectParentFolder, const FString& ProjectRoot, const TMap<FString, FString>& ExtraArguments)
@@ -919,67 +1460,28 @@ bool FUnrealSharpEditorModule::FillTemplateFile(const FString& TemplateName, TMa
 
 void FUnrealSharpEditorModule::OnStructRebuilt(UCSScriptStruct* NewStruct)
 {
-	RebuiltStructs.Add(NewStruct);
+	RebuiltTypes.Add(NewStruct);
 }
 
 void FUnrealSharpEditorModule::OnClassRebuilt(UCSClass* NewClass)
 {
-	RebuiltClasses.Add(NewClass);
+	RebuiltTypes.Add(NewClass);
 }
 
 void FUnrealSharpEditorModule::OnEnumRebuilt(UCSEnum* NewEnum)
 {
-	RebuiltEnums.Add(NewEnum);
+	RebuiltTypes.Add(NewEnum);
 }
 
 bool FUnrealSharpEditorModule::IsPinAffectedByReload(const FEdGraphPinType& PinType) const
 {
-	UObject* PinSubCategoryObject = PinType.PinSubCategoryObject.Get();
-	if (!IsValid(PinSubCategoryObject) || !Manager->IsManagedType(PinSubCategoryObject))
-	{
-		return false;
-	}
-
-	auto IsPinTypeRebuilt = [this](UObject* PinSubCategoryObject) -> bool
+	// Only managed types end up in the set, so a single lookup covers both checks.
+	if (RebuiltTypes.Contains(PinType.PinSubCategoryObject.Get()))
 	{
-		if (UCSClass* Class = Cast<UCSClass>(PinSubCategoryObject))
-		{
-			return RebuiltClasses.Contains(Class);
-		}
-
-		if (UCSEnum* Enum = Cast<UCSEnum>(PinSubCategoryObject))
-		{
-			return RebuiltEnums.Contains(Enum);
-		}
-
-		if (UCSScriptStruct* Struct = Cast<UCSScriptStruct>(PinSubCategoryObject))
-		{
-			return RebuiltStructs.Contains(Struct);
-		}
-
-		if (UCSEnum* Enum = Cast<UCSEnum>(PinSubCategoryObject))
-		{
-			return RebuiltEnums.Contains(Enum);
-		}
-
-		return false;
-	};
-
-	if (!IsPinTypeRebuilt(PinSubCategoryObject))
-	{
-		return false;
+		return true;
 	}
 
-	if (PinType.IsMap() && PinType.PinValueType.TerminalSubCategoryObject.IsValid())
-	{
-		UObject* MapValueType = PinType.PinValueType.TerminalSubCategoryObject.Get();
-		if (IsValid(MapValueType) && Manager->IsManagedType(MapValueType))
-		{
-			return IsPinTypeRebuilt(MapValueType);
-		}
-	}
-
-	return false;
+	return PinType.IsMap() && RebuiltTypes.Contains(PinType.PinValueType.TerminalSubCategoryObject.Get());
 }
 
 bool FUnrealSharpEditorModule::IsNodeAffectedByReload(UEdGraphNode* Node) const
@@ -1033,43 +1535,61 @@ void FUnrealSharpEditorModule::AddDirectoryToWatch(const FString& Directory)
 
 void FUnrealSharpEditorModule::RefreshAffectedBlueprints()
 {
-	if (RebuiltStructs.IsEmpty() && RebuiltClasses.IsEmpty() && RebuiltEnums.IsEmpty())
+	if (RebuiltTypes.IsEmpty())
 	{
 		// Early out if nothing has changed its structure.
 		return;
 	}
 
-	TArray<UBlueprint*> AffectedBlueprints;
+	TRACE_CPUPROFILER_EVENT_SCOPE(FUnrealSharpEditorModule::RefreshAffectedBlueprints);
+
+	TArray<UBlueprint*> Blueprints;
 	for (TObjectIterator<UBlueprint> BlueprintIt; BlueprintIt; ++BlueprintIt)
 	{
 		UBlueprint* Blueprint = *BlueprintIt;
 		if (!IsValid(Blueprint->GeneratedClass) || FCSClassUtilities::IsManagedClass(Blueprint->GeneratedClass))
 		{
-			return;
+			continue;
 		}
 
+		Blueprints.Add(Blueprint);
+	}
+
+	// Scanning the graphs only reads them, so spread it out. Each blueprint writes its own slot.
+	TArray<TArray<UK2Node*>> AffectedNodes;
+	AffectedNodes.SetNum(Blueprints.Num());
+	
+	ParallelFor(Blueprints.Num(), [this, &Blueprints, &AffectedNodes](int32 Index)
+	{
 		TArray<UK2Node*> AllNodes;
-		FBlueprintEditorUtils::GetAllNodesOfClass<UK2Node>(Blueprint, AllNodes);
+		FBlueprintEditorUtils::GetAllNodesOfClass<UK2Node>(Blueprints[Index], AllNodes);
 
 		for (UK2Node* Node : AllNodes)
 		{
 			if (IsNodeAffectedByReload(Node))
 			{
-				Node->ReconstructNode();
+				AffectedNodes[Index].Add(Node);
 			}
 		}
+	}, EParallelForFlags::Unbalanced);
 
-		AffectedBlueprints.Add(Blueprint);
-	}
-
-	for (UBlueprint* Blueprint : AffectedBlueprints)
+	// Reconstructing and compiling touch UObjects all over the place, keep those on the game thread.
+	for (int32 i = 0; i < Blueprints.Num(); ++i)
 	{
-		FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::SkipGarbageCollection);
+		if (AffectedNodes[i].IsEmpty())
+		{
+			continue;
+		}
+		
+		for (UK2Node* Node : AffectedNodes[i])
+		{
+			Node->ReconstructNode();
+		}
+
+		FKismetEditorUtilities::CompileBlueprint(Blueprints[i], EBlueprintCompileOptions::SkipGarbageCollection);
 	}
 
-	RebuiltStructs.Reset();
-	RebuiltClasses.Reset();
-	RebuiltEnums.Reset();
+	RebuiltTypes.Reset();
 
 	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
 }
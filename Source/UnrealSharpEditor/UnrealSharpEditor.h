@@ -3,6 +3,9 @@
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
 #include "Containers/Ticker.h"
+#include "Misc/SecureHash.h"
+#include "Async/Future.h"
+#include "HotReload/UnrealSharp_HotReloadTransport.h"
 
 #ifdef __clang__
 #pragma clang diagnostic ignored "-Wignored-attributes"
@@ -18,6 +21,8 @@ class UCSScriptStruct;
 class UCSManager;
 class IAssetTools;
 class FCSScriptBuilder;
+class SNotificationItem;
+struct FCSCommandResult;
 
 enum HotReloadStatus
 {
@@ -27,7 +32,9 @@ enum HotReloadStatus
     PendingReload,
     // Actively Hot Reloading
     Active,
-    // Failed to unload an assembly during Hot Reload
+    // Building the C# projects in the background, the assemblies are swapped once the build is done
+    Compiling,
+    // Failed to unload an assembly during Hot Reload, polled until it's gone
     FailedToUnload
 };
 
@@ -37,7 +44,8 @@ struct FCSManagedUnrealSharpEditorCallbacks
     {
     }
 
-    using FBuildProject = bool(__stdcall*)(const TCHAR*, const TCHAR*, const TCHAR*, ECSLoggerVerbosity, void*, bool);
+    // The last argument lists the changed script files separated by ';', or is empty to build the whole solution
+    using FBuildProject = bool(__stdcall*)(const TCHAR*, const TCHAR*, const TCHAR*, ECSLoggerVerbosity, void*, bool, const TCHAR*);
     using FForceManagedGC = void(__stdcall*)();
     using FOpenSolution = bool(__stdcall*)(const TCHAR*, void*);
     using FAddProjectToCollection = void(__stdcall*)(const TCHAR*);
@@ -49,6 +57,12 @@ struct FCSManagedUnrealSharpEditorCallbacks
 };
 
 
+struct FCSBuildResult
+{
+    bool bSucceeded = false;
+    FString ExceptionMessage;
+};
+
 DECLARE_LOG_CATEGORY_EXTERN(LogUnrealSharpEditor, Log, All);
 
 class FUnrealSharpEditorModule : public IModuleInterface
@@ -61,12 +75,14 @@ public:
     virtual void ShutdownModule() override;
     // End
 
+    // Queues the relevant changes, they are acted on in one go once no new changes came in for a while.
     void OnCSharpCodeModified(const TArray<struct FFileChangeData>& ChangedFiles);
     void StartHotReload(bool bRebuild = true, bool bPromptPlayerWithNewProject = true);
 
     void InitializeUnrealSharpEditorCallbacks(FCSManagedUnrealSharpEditorCallbacks Callbacks);
 
     bool IsHotReloading() const { return HotReloadStatus == Active; }
+    bool IsBuildingInBackground() const { return HotReloadStatus == Compiling; }
     bool HasPendingHotReloadChanges() const { return HotReloadStatus == PendingReload; }
     bool HasHotReloadFailed() const { return bHotReloadFailed; }
 
@@ -107,8 +123,12 @@ private:
     static void OnRefreshRuntimeGlue();
 
     static void OnRepairComponents();
+    static void OnOpenMemoryDashboard();
+    static FText GetHotReloadTimingText();
+    static FText GetHotReloadTimingToolTip();
     static void OnExploreArchiveDirectory(FString ArchiveDirectory);
     static void PackageProject();
+    static void OnPackageProjectFinished(const FCSCommandResult& Result, TSharedPtr<SNotificationItem> ProgressNotification, FString ArchiveDirectory, FString ExecutablePath);
 
     TSharedRef<SWidget> GenerateUnrealSharpMenu();
 
@@ -117,6 +137,11 @@ private:
 
     bool Tick(float DeltaTime);
 
+    // Checks on the assemblies that failed to unload, and reloads once they're gone.
+    void PollPendingUnloads();
+    void FlushPendingFileChanges();
+    void OnProjectFilesChanged(const TArray<struct FFileChangeData>& ChangedFiles);
+
     void RegisterCommands();
     void RegisterMenu();
     void RegisterPluginTemplates();
@@ -128,29 +153,84 @@ private:
     void OnClassRebuilt(UCSClass* NewClass);
     void OnEnumRebuilt(UCSEnum* NewEnum);
 
+    // Only read the rebuilt types, so these are safe to call from worker threads while the game thread waits.
     bool IsPinAffectedByReload(const FEdGraphPinType& PinType) const;
     bool IsNodeAffectedByReload(UEdGraphNode* Node) const;
     
     void RefreshAffectedBlueprints();
 
+    // Creates a task that builds and weaves the C# projects. The settings are read up front,
+    // so the task doesn't touch any engine state and can run on any thread.
+    TUniqueFunction<FCSBuildResult()> MakeBuildTask(bool bRebuild);
+    void OnBuildFailed(const FString& ExceptionMessage);
+
+    void StartBackgroundBuild(bool bRebuild);
+    void FinishBackgroundBuild();
+
+    // Swaps the loaded assemblies for the freshly built ones. Game thread only.
+    void ReloadAssemblies(double StartTime);
+
+    // Sends the reloaded assemblies to the device set in the editor settings, if any.
+    void SendAssembliesToDevice(const TArray<FString>& ProjectNames);
+
+    // Content hashes of the assemblies as they were last loaded, to tell which ones a build changed.
+    void UpdateAssemblyHash(const FString& ProjectName);
+    bool HasAssemblyChanged(const FString& ProjectName) const;
+    void OnManagedAssemblyLoaded(const FName& AssemblyName);
+    
+    // Collects the projects whose assembly changed, plus all the projects that depend on them.
+    void GetProjectsToReload(const TArray<FString>& ProjectsByLoadOrder, TSet<FString>& OutProjectsToReload) const;
+
     FSlateIcon GetMenuIcon() const;
 
     FCSManagedUnrealSharpEditorCallbacks ManagedUnrealSharpEditorCallbacks;
 
     HotReloadStatus HotReloadStatus = Inactive;
     bool bHotReloadFailed = false;
+    double LastUnloadPollTime = 0.0;
     bool bHasQueuedHotReload = false;
 
+    TFuture<FCSBuildResult> PendingBuild;
+    TSharedPtr<SNotificationItem> BuildNotification;
+    double BuildStartTime = 0.0;
+
+    // Duration of the build the next reload swaps in, for its timing breakdown.
+    double LastBuildTimeMs = 0.0;
+    
+    // More changes came in during a background build.
+    bool bHasQueuedBuild = false;
+
+    // Whether any of the requests behind the queued build asked for a rebuild, requests that come in during the same build are merged.
+    bool bQueuedBuildRebuild = false;
+
+    // A background build finished during PIE, the assemblies are swapped when PIE ends.
+    bool bHasPendingAssemblySwap = false;
+
+    // File changes waiting for the quiet time to pass, see FlushPendingFileChanges.
+    bool bHasPendingScriptChange = false;
+    bool bHasPendingModuleChange = false;
+    double LastFileChangeTime = 0.0;
+
+    // Scripts changed since the last successful build, so only the projects they affect are built.
+    // The ones of a running build are kept aside and added back if it fails.
+    TSet<FString> ChangedScripts;
+    TSet<FString> BuildingChangedScripts;
+
+    // Connection to the device that receives hot reloaded assemblies, opened on the first reload that sends one.
+    UnrealSharp::HotReload::Transport::FHotReloadTransportClient DeviceTransport;
+    FString DeviceTransportAddress;
+
     UCSAssembly* EditorAssembly;
     FTickerDelegate TickDelegate;
     FTSTicker::FDelegateHandle TickDelegateHandle;
     TSharedPtr<FUICommandList> UnrealSharpCommands;
     TArray<TSharedRef<FPluginTemplateDescription>> PluginTemplates;
 
-    TSet<UCSScriptStruct*> RebuiltStructs;
-    TSet<UCSClass*> RebuiltClasses;
-    TSet<UCSEnum*> RebuiltEnums;
+    // Classes, structs and enums rebuilt by the last reload.
+    TSet<const UObject*> RebuiltTypes;
 
     UCSManager* Manager = nullptr;
     TArray<FString> WatchingDirectories;
+
+    TMap<FString, FMD5Hash> AssemblyHashes;
 };
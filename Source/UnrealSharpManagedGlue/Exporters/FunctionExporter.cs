@@ -707,6 +707,11 @@ public class FunctionExporter
         {
             builder.AppendLine($"IntPtr {InstanceFunctionPtr};");
         }
+
+        if (_function.UsesCachedNativeInvocation())
+        {
+            builder.AppendLine($"static IntPtr {_function.GetNativeInvocationName()};");
+        }
         
         if (_function.HasParametersOrReturnValue())
         {
@@ -902,7 +907,18 @@ public class FunctionExporter
                     ? $"paramsBuffer + {TryAddPrecedingCustomStructParams(_function.ReturnProperty, _function.ReturnProperty.GetOffsetVariableName())}"
                     : ScriptGeneratorUtilities.IntPtrZero;
                 
-                builder.AppendLine($"{_invokeFunction}({_invokeFirstArgument}, {invokedFunctionIntPtr}, paramsBuffer, {returnValueAddressStr});");
+                if (string.IsNullOrEmpty(functionPtr) && _function.TryGetDirectNativeCall(out string directCall))
+                {
+                    builder.AppendLine($"{directCall}({_invokeFirstArgument}, paramsBuffer);");
+                }
+                else if (string.IsNullOrEmpty(functionPtr) && _function.UsesCachedNativeInvocation())
+                {
+                    builder.AppendLine($"{ExporterCallbacks.UObjectCallbacks}.CallInvokeNativeFunctionWithInvocation({_invokeFirstArgument}, {_function.GetNativeInvocationName()}, paramsBuffer, {returnValueAddressStr});");
+                }
+                else
+                {
+                    builder.AppendLine($"{_invokeFunction}({_invokeFirstArgument}, {invokedFunctionIntPtr}, paramsBuffer, {returnValueAddressStr});");
+                }
             }
             else
             {
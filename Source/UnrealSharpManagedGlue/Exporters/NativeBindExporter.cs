@@ -18,10 +18,14 @@ public static class NativeBindExporter
     private struct NativeBindMethod
     {
         public readonly string MethodName;
+        public readonly bool IsAnyThread;
+        public readonly bool IsEditorOnly;
     
-        public NativeBindMethod(string methodName)
+        public NativeBindMethod(string methodName, bool isAnyThread, bool isEditorOnly)
         {
             MethodName = methodName;
+            IsAnyThread = isAnyThread;
+            IsEditorOnly = isEditorOnly;
         }
     }
 
@@ -65,9 +69,26 @@ public static class NativeBindExporter
     {
         UhtHeaderFile headerFile = topScope.ScopeType.HeaderFile;
 
+        topScope.TokenReader.Require('(');
+
+        // EditorOnly exports are only registered in editor builds, so games don't carry or resolve them.
+        bool isAnyThread = false;
+        bool isEditorOnly = false;
+        do
+        {
+            if (topScope.TokenReader.TryOptional("AnyThread"))
+            {
+                isAnyThread = true;
+            }
+            else if (topScope.TokenReader.TryOptional("EditorOnly"))
+            {
+                isEditorOnly = true;
+            }
+        }
+        while (topScope.TokenReader.TryOptional(','));
+        
         topScope.TokenReader.EnableRecording();
         topScope.TokenReader
-            .Require('(')
             .Require(')')
             .Require("static")
             .ConsumeUntil('(');
@@ -76,7 +97,7 @@ public static class NativeBindExporter
         string methodName = topScope.TokenReader.RecordedTokens[recordedTokensCount - 2].Value.ToString();
         topScope.TokenReader.DisableRecording();
         
-        NativeBindMethod methodInfo = new(methodName);
+        NativeBindMethod methodInfo = new(methodName, isAnyThread, isEditorOnly);
         
         if (!NativeBindTypes.TryGetValue(headerFile, out List<NativeBindTypeInfo>? value))
         {
@@ -133,7 +154,9 @@ public static class NativeBindExporter
             
                 foreach (NativeBindMethod method in methods)
                 {
+                    AppendEditorOnlyBegin(builder, method);
                     builder.AppendLine($"static const FCSExportedFunction UnrealSharpBind_{method.MethodName};");
+                    AppendEditorOnlyEnd(builder, method);
                 }
             
                 builder.CloseBrace();
@@ -142,8 +165,21 @@ public static class NativeBindExporter
                 foreach (NativeBindMethod method in methods)
                 {
                     string functionReference = $"{topType.SourceName}::{method.MethodName}";
+                    AppendEditorOnlyBegin(builder, method);
                     builder.AppendLine($"const FCSExportedFunction {typeName}::UnrealSharpBind_{method.MethodName}");
-                    builder.Append($" = FCSExportedFunction(\"{topType.EngineName}\", \"{method.MethodName}\", (void*)&{functionReference}, GetFunctionSize({functionReference}));");
+                    builder.Append($" = FCSExportedFunction(\"{topType.EngineName}\", \"{method.MethodName}\", ");
+                    
+                    if (method.IsAnyThread)
+                    {
+                        builder.Append($"(void*)&{functionReference}, GetFunctionSize({functionReference}), ECSExportThreadSafety::AnyThread);");
+                    }
+                    else
+                    {
+                        builder.Append($"UNREALSHARP_GAME_THREAD_EXPORT({functionReference}), GetFunctionSize({functionReference}), ");
+                        builder.Append($"ECSExportThreadSafety::GameThread, (void*)&{functionReference});");
+                    }
+
+                    AppendEditorOnlyEnd(builder, method);
                 }
                 
                 builder.AppendLine();
@@ -164,4 +200,20 @@ public static class NativeBindExporter
             factory.CommitOutput(filePath, builder.ToString());
         }
     }
+
+    private static void AppendEditorOnlyBegin(GeneratorStringBuilder builder, NativeBindMethod method)
+    {
+        if (method.IsEditorOnly)
+        {
+            builder.AppendLine("#if WITH_EDITOR");
+        }
+    }
+
+    private static void AppendEditorOnlyEnd(GeneratorStringBuilder builder, NativeBindMethod method)
+    {
+        if (method.IsEditorOnly)
+        {
+            builder.AppendLine("#endif");
+        }
+    }
 }
\ No newline at end of file
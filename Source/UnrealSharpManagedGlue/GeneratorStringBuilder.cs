@@ -10,14 +10,46 @@ namespace UnrealSharpScriptGenerator;
 
 public class GeneratorStringBuilder : IDisposable
 {
+    private const string NameLiteralsClass = "GeneratedNameLiterals";
+    
     private int _indent;
     private readonly List<string> _directives = new();
+    private readonly List<string> _nameLiterals = new();
     private BorrowStringBuilder _borrower = new(StringBuilderCache.Big);
     private StringBuilder StringBuilder => _borrower.StringBuilder;
 
     public override string ToString()
     {
-        return StringBuilder.ToString();
+        if (_nameLiterals.Count == 0)
+        {
+            return StringBuilder.ToString();
+        }
+        
+        // All FName literals of the file are made with one native call the first time one of them is used,
+        // instead of one call each time a function with a name default runs.
+        string nameTable = string.Join("\\0", _nameLiterals);
+        return StringBuilder
+            + Environment.NewLine
+            + Environment.NewLine + $"file static class {NameLiteralsClass}"
+            + Environment.NewLine + "{"
+            + Environment.NewLine + $"    public static readonly global::UnrealSharp.FName[] Names = global::UnrealSharp.FName.FromStringTable(\"{nameTable}\", {_nameLiterals.Count});"
+            + Environment.NewLine + "}";
+    }
+    
+    /// <summary>
+    /// Adds the name to the name table of the file.
+    /// </summary>
+    /// <returns>The expression that reads the name from the table.</returns>
+    public string GetNameLiteral(string name)
+    {
+        int index = _nameLiterals.IndexOf(name);
+        if (index < 0)
+        {
+            index = _nameLiterals.Count;
+            _nameLiterals.Add(name);
+        }
+        
+        return $"{NameLiteralsClass}.Names[{index}]";
     }
 
     public void Dispose()
@@ -25,7 +25,7 @@ public class NamePropertyTranslator : BlittableTypePropertyTranslator
         }
         else
         {
-            builder.AppendLine($"FName {variableName} = new FName(\"{defaultValue}\");");
+            builder.AppendLine($"FName {variableName} = {builder.GetNameLiteral(defaultValue)};");
         }
     }
 }
\ No newline at end of file
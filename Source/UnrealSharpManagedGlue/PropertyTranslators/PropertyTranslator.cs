@@ -76,8 +76,8 @@ public abstract class PropertyTranslator
         if (hasNativeGetterSetter || !hasBlueprintGetterSetter)
         {
             string variableDeclaration = CacheProperty || hasNativeGetterSetter ? "" : "IntPtr ";
-            builder.AppendLine($"{variableDeclaration}{propertyPointerName} = {ExporterCallbacks.FPropertyCallbacks}.CallGetNativePropertyFromName(NativeClassPtr, \"{adjustedNativePropertyName}\");");
-            builder.AppendLine($"{nativePropertyName}_Offset = {ExporterCallbacks.FPropertyCallbacks}.CallGetPropertyOffset({propertyPointerName});");
+            builder.AppendLine($"{variableDeclaration}{propertyPointerName} = NativeClassLayout.GetProperty(\"{adjustedNativePropertyName}\");");
+            builder.AppendLine($"{nativePropertyName}_Offset = NativeClassLayout.GetOffset(\"{adjustedNativePropertyName}\");");
         }
         
         if (hasNativeGetterSetter)
@@ -0,0 +1,38 @@
+﻿using System.Collections.Generic;
+using EpicGames.UHT.Types;
+
+namespace UnrealSharpScriptGenerator.Utilities;
+
+/// <summary>
+/// Hot engine functions that have a hand-written trampoline exported from UnrealSharpCore.
+/// The glue still marshals the params buffer as usual, but calls the trampoline instead of going through the FFrame.
+/// </summary>
+public static class DirectNativeCallUtilities
+{
+    private static readonly Dictionary<(string ClassName, string FunctionName), string> DirectNativeCalls = new()
+    {
+        { ("Actor", "K2_SetActorLocation"), "AActorExporter" },
+        { ("Actor", "K2_GetActorLocation"), "AActorExporter" },
+        { ("Actor", "GetTransform"), "AActorExporter" },
+        { ("SceneComponent", "K2_GetComponentLocation"), "USceneComponentExporter" },
+        { ("SceneComponent", "K2_GetComponentToWorld"), "USceneComponentExporter" },
+    };
+
+    public static bool TryGetDirectNativeCall(this UhtFunction function, out string directCall)
+    {
+        directCall = string.Empty;
+
+        if (function.Outer is not UhtClass owner || function.HasCustomStructParamSupport())
+        {
+            return false;
+        }
+
+        if (!DirectNativeCalls.TryGetValue((owner.EngineName, function.EngineName), out string? exporter))
+        {
+            return false;
+        }
+
+        directCall = $"{exporter}.Call{function.EngineName}";
+        return true;
+    }
+}
@@ -83,6 +83,27 @@ public static class FunctionUtilities
         return $"{function.SourceName}_NativeFunction";
     }
 
+    public static string GetNativeInvocationName(this UhtFunction function)
+    {
+        return $"{function.SourceName}_Invocation";
+    }
+
+    public static bool UsesCachedNativeInvocation(this UhtFunction function)
+    {
+        // Only the out param path benefits, the invocation carries the precomputed out param chain.
+        if (function.HasAnyFlags(EFunctionFlags.Static | EFunctionFlags.Net | EFunctionFlags.Delegate | EFunctionFlags.BlueprintEvent))
+        {
+            return false;
+        }
+
+        if (function.HasCustomStructParamSupport())
+        {
+            return false;
+        }
+
+        return function.HasAllFlags(EFunctionFlags.HasOutParms) || function.ReturnProperty != null;
+    }
+
     public static bool HasSameSignature(this UhtFunction function, UhtFunction otherFunction)
     {
         if (function.Children.Count != otherFunction.Children.Count)
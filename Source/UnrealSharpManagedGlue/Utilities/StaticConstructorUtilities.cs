@@ -97,6 +97,20 @@ public static class StaticConstructorUtilities
         string engineName = structObj.EngineName;
         generatorStringBuilder.AppendLine($"{nativeClassPtrDeclaration}NativeClassPtr = {ExporterCallbacks.CoreUObjectCallbacks}.CallGetNative{type}FromName({structObj.ExportGetAssemblyName()}, \"{structObj.GetNamespace()}\", \"{engineName}\");");
         
+        List<string> functionNames = GatherFunctionNames(exportedProperties, exportedFunctions, exportedGetterSetters, getSetBackedProperties, overrides);
+        if (functionNames.Count > 0)
+        {
+            // One native call for all functions instead of a name lookup per function.
+            string packedNames = string.Join(", ", functionNames.ConvertAll(name => $"\"{name}\""));
+            generatorStringBuilder.AppendLine($"NativeFunctionTable NativeFunctions = NativeFunctionTable.Resolve(NativeClassPtr, {packedNames});");
+        }
+        
+        if (exportedProperties.Count > 0 || getSetBackedProperties.Count > 0)
+        {
+            // One native call for the whole layout instead of a name lookup per property.
+            generatorStringBuilder.AppendLine("NativeStructLayout NativeClassLayout = NativeStructLayout.Describe(NativeClassPtr);");
+        }
+        
         ExportPropertiesStaticConstructor(generatorStringBuilder, exportedProperties);
         ExportGetSetBackedPropertyStaticConstructor(generatorStringBuilder, getSetBackedProperties);
 
@@ -123,6 +137,55 @@ public static class StaticConstructorUtilities
         generatorStringBuilder.CloseBrace();
     }
     
+    // Every function the static constructor looks up, in the order it does.
+    private static List<string> GatherFunctionNames(List<UhtProperty> exportedProperties,
+        List<UhtFunction> exportedFunctions,
+        Dictionary<string, GetterSetterPair> exportedGetterSetters,
+        Dictionary<UhtProperty, GetterSetterPair> getSetBackedProperties,
+        List<UhtFunction> overrides)
+    {
+        List<string> functionNames = new List<string>();
+        void AddPropertyAccessors(UhtProperty property)
+        {
+            UhtFunction? getter = property.HasNativeGetter() ? null : property.GetBlueprintGetter();
+            UhtFunction? setter = property.HasNativeSetter() ? null : property.GetBlueprintSetter();
+            
+            if (getter != null)
+            {
+                functionNames.Add(getter.EngineName);
+            }
+            
+            if (setter != null)
+            {
+                functionNames.Add(setter.EngineName);
+            }
+        }
+        
+        exportedProperties.ForEach(AddPropertyAccessors);
+        
+        foreach (UhtProperty property in getSetBackedProperties.Keys)
+        {
+            AddPropertyAccessors(property);
+        }
+        
+        foreach (GetterSetterPair pair in exportedGetterSetters.Values)
+        {
+            if (pair.Getter != null)
+            {
+                functionNames.Add(pair.Getter.EngineName);
+            }
+            
+            if (pair.Setter != null)
+            {
+                functionNames.Add(pair.Setter.EngineName);
+            }
+        }
+        
+        exportedFunctions.ForEach(function => functionNames.Add(function.EngineName));
+        overrides.ForEach(function => functionNames.Add(function.EngineName));
+        return functionNames;
+    }
+    
     public static void ExportClassFunctionsStaticConstructor(GeneratorStringBuilder generatorStringBuilder, List<UhtFunction> exportedFunctions)
     {
         foreach (UhtFunction function in exportedFunctions)
@@ -138,7 +201,7 @@ public static class StaticConstructorUtilities
         string nativeFunctionName = function.GetNativeFunctionName();
             
         generatorStringBuilder.TryAddWithEditor(function);
-        generatorStringBuilder.AppendLine($"{nativeFunctionName} = {ExporterCallbacks.UClassCallbacks}.CallGetNativeFunctionFromClassAndName(NativeClassPtr, \"{function.EngineName}\");");
+        generatorStringBuilder.AppendLine($"{nativeFunctionName} = NativeFunctions.Get(\"{function.EngineName}\");");
             
         if (function.HasParametersOrReturnValue())
         {
@@ -157,6 +220,11 @@ public static class StaticConstructorUtilities
                 translator.ExportParameterStaticConstructor(generatorStringBuilder, property, function, property.SourceName, functionName);
             }
             
+            if (function.UsesCachedNativeInvocation())
+            {
+                generatorStringBuilder.AppendLine($"{function.GetNativeInvocationName()} = {ExporterCallbacks.UFunctionCallbacks}.CallGetNativeFunctionInvocation({nativeFunctionName});");
+            }
+            
             if (hasCustomStructParams)
             {
                 List<string> customStructParams = function.GetCustomStructParams();
@@ -176,7 +244,7 @@ public static class StaticConstructorUtilities
             string functionName = function.SourceName;
             
             string intPtrDeclaration = function.IsBlueprintImplementableEvent() ? "IntPtr " : "";
-            generatorStringBuilder.AppendLine($"{intPtrDeclaration}{functionName}_NativeFunction = {ExporterCallbacks.UClassCallbacks}.CallGetNativeFunctionFromClassAndName(NativeClassPtr, \"{function.EngineName}\");");
+            generatorStringBuilder.AppendLine($"{intPtrDeclaration}{functionName}_NativeFunction = NativeFunctions.Get(\"{function.EngineName}\");");
             
             if (function.HasParametersOrReturnValue())
             {
@@ -0,0 +1,124 @@
+#include "CSMassProcessor.h"
+#include "MassExecutionContext.h"
+#include "UnrealSharpMass.h"
+
+UCSMassProcessor::UCSMassProcessor()
+	: EntityQuery(*this)
+{
+	// Managed code only runs on the game thread.
+	bRequiresGameThreadExecution = true;
+}
+
+int32 UCSMassProcessor::AddFragmentRequirement(const UScriptStruct* FragmentType, EMassFragmentAccess Access, EMassFragmentPresence Presence)
+{
+	if (!bConfiguringQueries)
+	{
+		UE_LOG(LogUnrealSharpMass, Error, TEXT("%s: fragment requirements can only be added in ConfigureQueries."), *GetName());
+		return INDEX_NONE;
+	}
+
+	if (!FragmentType || !FragmentType->IsChildOf(FMassFragment::StaticStruct()))
+	{
+		UE_LOG(LogUnrealSharpMass, Error, TEXT("%s: %s is not a Mass fragment."), *GetName(), *GetNameSafe(FragmentType));
+		return INDEX_NONE;
+	}
+
+	EntityQuery.AddRequirement(FragmentType, Access, Presence);
+
+	FragmentTypes.Add(FragmentType);
+	FragmentAccess.Add(Access);
+	FragmentSizes.Add(FragmentType->GetStructureSize());
+	return FragmentTypes.Num() - 1;
+}
+
+bool UCSMassProcessor::AddTagRequirement(const UScriptStruct* TagType, EMassFragmentPresence Presence)
+{
+	if (!bConfiguringQueries)
+	{
+		UE_LOG(LogUnrealSharpMass, Error, TEXT("%s: tag requirements can only be added in ConfigureQueries."), *GetName());
+		return false;
+	}
+
+	if (!TagType || !TagType->IsChildOf(FMassTag::StaticStruct()))
+	{
+		UE_LOG(LogUnrealSharpMass, Error, TEXT("%s: %s is not a Mass tag."), *GetName(), *GetNameSafe(TagType));
+		return false;
+	}
+
+	EntityQuery.AddTagRequirement(*TagType, Presence);
+	return true;
+}
+
+#if ENGINE_MINOR_VERSION >= 6
+void UCSMassProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
+#else
+void UCSMassProcessor::ConfigureQueries()
+#endif
+{
+	FragmentTypes.Reset();
+	FragmentAccess.Reset();
+	FragmentSizes.Reset();
+
+	bConfiguringQueries = true;
+	K2_ConfigureQueries();
+	bConfiguringQueries = false;
+
+	// The chunk points into these, they don't change until the query is configured again.
+	FragmentData.SetNumZeroed(FragmentTypes.Num());
+	CurrentChunk.Fragments = FragmentData.GetData();
+	CurrentChunk.FragmentSizes = FragmentSizes.GetData();
+	CurrentChunk.NumFragments = FragmentTypes.Num();
+}
+
+void UCSMassProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCSMassProcessor::Execute);
+
+#if ENGINE_MINOR_VERSION >= 6
+	EntityQuery.ForEachEntityChunk(Context, [this](FMassExecutionContext& ChunkContext)
+#else
+	EntityQuery.ForEachEntityChunk(EntityManager, Context, [this](FMassExecutionContext& ChunkContext)
+#endif
+	{
+		ExecuteChunk(ChunkContext);
+	});
+
+	CurrentChunk.Entities = nullptr;
+	CurrentChunk.NumEntities = 0;
+	FMemory::Memzero(FragmentData.GetData(), FragmentData.Num() * sizeof(void*));
+}
+
+void UCSMassProcessor::ExecuteChunk(FMassExecutionContext& Context)
+{
+	for (int32 i = 0; i < FragmentTypes.Num(); ++i)
+	{
+		void* Data = nullptr;
+		switch (FragmentAccess[i])
+		{
+		case EMassFragmentAccess::ReadOnly:
+			{
+				TConstArrayView<FMassFragment> View = Context.GetFragmentView(FragmentTypes[i]);
+				Data = View.Num() > 0 ? const_cast<FMassFragment*>(View.GetData()) : nullptr;
+				break;
+			}
+		case EMassFragmentAccess::ReadWrite:
+			{
+				TArrayView<FMassFragment> View = Context.GetMutableFragmentView(FragmentTypes[i]);
+				Data = View.Num() > 0 ? View.GetData() : nullptr;
+				break;
+			}
+		default:
+			break;
+		}
+
+		FragmentData[i] = Data;
+	}
+
+	const TConstArrayView<FMassEntityHandle> Entities = Context.GetEntities();
+	CurrentChunk.Entities = Entities.GetData();
+	CurrentChunk.NumEntities = Entities.Num();
+	CurrentChunk.DeltaTime = Context.GetDeltaTimeSeconds();
+
+	// One transition into C# for the whole chunk.
+	K2_ExecuteChunk();
+}
@@ -0,0 +1,22 @@
+#include "CSMassProcessorExporter.h"
+#include "CSMassProcessor.h"
+
+UScriptStruct* UCSMassProcessorExporter::FindStruct(const TCHAR* Name)
+{
+	return UClass::TryFindTypeSlow<UScriptStruct>(Name);
+}
+
+int32 UCSMassProcessorExporter::AddFragmentRequirement(UCSMassProcessor* Processor, const UScriptStruct* FragmentType, uint8 Access, uint8 Presence)
+{
+	return Processor->AddFragmentRequirement(FragmentType, static_cast<EMassFragmentAccess>(Access), static_cast<EMassFragmentPresence>(Presence));
+}
+
+bool UCSMassProcessorExporter::AddTagRequirement(UCSMassProcessor* Processor, const UScriptStruct* TagType, uint8 Presence)
+{
+	return Processor->AddTagRequirement(TagType, static_cast<EMassFragmentPresence>(Presence));
+}
+
+FCSMassChunk* UCSMassProcessorExporter::GetCurrentChunk(UCSMassProcessor* Processor)
+{
+	return Processor->GetCurrentChunk();
+}
@@ -0,0 +1,19 @@
+#include "UnrealSharpMass.h"
+
+#define LOCTEXT_NAMESPACE "FUnrealSharpMassModule"
+
+DEFINE_LOG_CATEGORY(LogUnrealSharpMass);
+
+void FUnrealSharpMassModule::StartupModule()
+{
+    
+}
+
+void FUnrealSharpMassModule::ShutdownModule()
+{
+    
+}
+
+#undef LOCTEXT_NAMESPACE
+    
+IMPLEMENT_MODULE(FUnrealSharpMassModule, UnrealSharpMass)
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassEntityQuery.h"
+#include "MassProcessor.h"
+#include "CSMassProcessor.generated.h"
+
+// The chunk a UCSMassProcessor is executing, read by C# in place. Layout must match NativeMassChunk in MassChunk.cs.
+struct FCSMassChunk
+{
+	// Start of the fragment arrays of the chunk, in the order the fragments were required in.
+	// Null for fragments the chunk doesn't have, and for the ones required without access.
+	void** Fragments = nullptr;
+
+	// Size of one element of each fragment array, so C# can check its structs against the native ones.
+	const int32* FragmentSizes = nullptr;
+
+	const FMassEntityHandle* Entities = nullptr;
+	int32 NumEntities = 0;
+	int32 NumFragments = 0;
+	float DeltaTime = 0.0f;
+};
+
+/**
+ * Mass processor implemented in C#. ConfigureQueries adds the fragment requirements of its query, and ExecuteChunk
+ * runs once per matching chunk with the fragment arrays of the chunk exposed as spans over the native memory.
+ * Runs on the game thread, like the rest of the managed code.
+ */
+UCLASS(Blueprintable, BlueprintType, Abstract)
+class UNREALSHARPMASS_API UCSMassProcessor : public UMassProcessor
+{
+	GENERATED_BODY()
+public:
+	UCSMassProcessor();
+
+	// Returns the index of the fragment in the chunk, or INDEX_NONE if FragmentType isn't a fragment.
+	int32 AddFragmentRequirement(const UScriptStruct* FragmentType, EMassFragmentAccess Access, EMassFragmentPresence Presence);
+	bool AddTagRequirement(const UScriptStruct* TagType, EMassFragmentPresence Presence);
+
+	FCSMassChunk* GetCurrentChunk() { return &CurrentChunk; }
+
+protected:
+	// UMassProcessor interface
+#if ENGINE_MINOR_VERSION >= 6
+	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
+#else
+	virtual void ConfigureQueries() override;
+#endif
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+	// End of UMassProcessor interface
+
+	UFUNCTION(BlueprintImplementableEvent, meta = (ScriptName = "ConfigureQueries"), Category = "Managed Mass Processor")
+	void K2_ConfigureQueries();
+
+	UFUNCTION(BlueprintImplementableEvent, meta = (ScriptName = "ExecuteChunk"), Category = "Managed Mass Processor")
+	void K2_ExecuteChunk();
+
+private:
+	void ExecuteChunk(FMassExecutionContext& Context);
+
+	FMassEntityQuery EntityQuery;
+
+	TArray<const UScriptStruct*> FragmentTypes;
+	TArray<EMassFragmentAccess> FragmentAccess;
+	TArray<int32> FragmentSizes;
+	TArray<void*> FragmentData;
+
+	FCSMassChunk CurrentChunk;
+
+	// Requirements can only be added while the query is being configured.
+	bool bConfiguringQueries = false;
+};
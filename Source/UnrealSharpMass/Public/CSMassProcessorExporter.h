@@ -0,0 +1,29 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UnrealSharpBinds/Public/CSBindsManager.h"
+#include "CSMassProcessorExporter.generated.h"
+
+class UCSMassProcessor;
+struct FCSMassChunk;
+
+UCLASS(meta = (InternalType))
+class UCSMassProcessorExporter : public UObject
+{
+	GENERATED_BODY()
+public:
+	// Takes a path like /Script/MassCommon.TransformFragment, or the name of the struct without its prefix.
+	UNREALSHARP_FUNCTION()
+	static UScriptStruct* FindStruct(const TCHAR* Name);
+
+	// Access and Presence are EMassFragmentAccess and EMassFragmentPresence.
+	UNREALSHARP_FUNCTION()
+	static int32 AddFragmentRequirement(UCSMassProcessor* Processor, const UScriptStruct* FragmentType, uint8 Access, uint8 Presence);
+
+	UNREALSHARP_FUNCTION()
+	static bool AddTagRequirement(UCSMassProcessor* Processor, const UScriptStruct* TagType, uint8 Presence);
+
+	// Lives as long as the processor, C# reads the chunk being executed through it.
+	UNREALSHARP_FUNCTION()
+	static FCSMassChunk* GetCurrentChunk(UCSMassProcessor* Processor);
+};
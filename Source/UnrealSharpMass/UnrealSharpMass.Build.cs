@@ -0,0 +1,29 @@
+﻿using UnrealBuildTool;
+
+public class UnrealSharpMass : ModuleRules
+{
+    public UnrealSharpMass(ReadOnlyTargetRules Target) : base(Target)
+    {
+        PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+        PublicDependencyModuleNames.AddRange(
+            new string[]
+            {
+                "Core",
+                "MassEntity",
+            }
+        );
+
+        PrivateDependencyModuleNames.AddRange(
+            new string[]
+            {
+                "CoreUObject",
+                "Engine",
+                "UnrealSharpBinds",
+                "UnrealSharpCore"
+            }
+        );
+        
+        PublicDefinitions.Add("ForceAsEngineGlue=1");
+    }
+}
@@ -3,60 +3,519 @@
 #include "XmlFile.h"
 #include "XmlNode.h"
 #include "Misc/App.h"
+#include "Async/Async.h"
 #include "Misc/Paths.h"
 #include "Interfaces/IPluginManager.h"
+#include "Misc/CommandLine.h"
 #include "Misc/MessageDialog.h"
+#include "Misc/Parse.h"
+#include "Common/TcpSocketBuilder.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+
+namespace
+{
+	// Must match BuildServer.PortAnnouncement in the build tool
+	const TCHAR* BuildServerPortAnnouncement = TEXT("UnrealSharpBuildServerPort=");
+
+	constexpr double BuildServerStartTimeout = 30.0;
+	constexpr double BuildServerStopTimeout = 5.0;
+
+	// Sanity limit for a single message, same as the build tool
+	constexpr int32 MaxBuildServerFrameSize = 64 * 1024 * 1024;
+
+	struct FBuildServer
+	{
+		FCriticalSection Lock;
+		FProcHandle Process;
+		void* ReadPipe = nullptr;
+		void* WritePipe = nullptr;
+		FSocket* Socket = nullptr;
+
+		// Don't wait for a server that failed to start on every invocation
+		bool bFailedToStart = false;
+	};
+
+	FBuildServer BuildServer;
+
+	void GetBuildToolArguments(const FString& BuildAction, const TMap<FString, FString>& AdditionalArguments, TArray<FString>& OutArguments)
+	{
+		FString PluginFolder = FPaths::ConvertRelativePathToFull(IPluginManager::Get().FindPlugin(UE_PLUGIN_NAME)->GetBaseDir());
+
+		OutArguments.Add(TEXT("--Action"));
+		OutArguments.Add(BuildAction);
+		OutArguments.Add(TEXT("--EngineDirectory"));
+		OutArguments.Add(FPaths::ConvertRelativePathToFull(FPaths::EngineDir()));
+		OutArguments.Add(TEXT("--ProjectDirectory"));
+		OutArguments.Add(FPaths::ConvertRelativePathToFull(FPaths::ProjectDir()));
+		OutArguments.Add(TEXT("--ProjectName"));
+		OutArguments.Add(FApp::GetProjectName());
+		OutArguments.Add(TEXT("--PluginDirectory"));
+		OutArguments.Add(PluginFolder);
+		OutArguments.Add(TEXT("--DotNetPath"));
+		OutArguments.Add(FCSProcHelper::GetDotNetExecutablePath());
+
+		if (AdditionalArguments.Num())
+		{
+			OutArguments.Add(TEXT("--AdditionalArgs"));
+			for (const TPair<FString, FString>& Argument : AdditionalArguments)
+			{
+				// Values may come quoted for the command line, the quotes are added back by MakeCommandLine when needed
+				OutArguments.Add(FString::Printf(TEXT("%s=%s"), *Argument.Key, *Argument.Value.TrimQuotes()));
+			}
+		}
+	}
+
+	FString MakeCommandLine(const TArray<FString>& Arguments)
+	{
+		FString CommandLine;
+		for (const FString& Argument : Arguments)
+		{
+			CommandLine += Argument.Contains(TEXT(" ")) ? FString::Printf(TEXT(" \"%s\""), *Argument) : TEXT(" ") + Argument;
+		}
+		return CommandLine;
+	}
+
+	bool SendAll(FSocket* Socket, const uint8* Data, int32 Size)
+	{
+		while (Size > 0)
+		{
+			int32 BytesSent = 0;
+			if (!Socket->Send(Data, Size, BytesSent) || BytesSent <= 0)
+			{
+				return false;
+			}
+
+			Data += BytesSent;
+			Size -= BytesSent;
+		}
+		return true;
+	}
+
+	bool ReceiveAll(FSocket* Socket, uint8* Data, int32 Size)
+	{
+		while (Size > 0)
+		{
+			int32 BytesRead = 0;
+			if (!Socket->Recv(Data, Size, BytesRead) || BytesRead <= 0)
+			{
+				return false;
+			}
+
+			Data += BytesRead;
+			Size -= BytesRead;
+		}
+		return true;
+	}
+
+	void DestroyBuildServer()
+	{
+		if (BuildServer.Socket)
+		{
+			// The build server exits once its connection is closed
+			BuildServer.Socket->Close();
+			ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(BuildServer.Socket);
+			BuildServer.Socket = nullptr;
+		}
+
+		if (BuildServer.Process.IsValid())
+		{
+			double Deadline = FPlatformTime::Seconds() + BuildServerStopTimeout;
+			while (FPlatformProcess::IsProcRunning(BuildServer.Process) && FPlatformTime::Seconds() < Deadline)
+			{
+				FPlatformProcess::Sleep(0.01f);
+			}
+
+			if (FPlatformProcess::IsProcRunning(BuildServer.Process))
+			{
+				FPlatformProcess::TerminateProc(BuildServer.Process, true);
+			}
+
+			FPlatformProcess::CloseProc(BuildServer.Process);
+		}
+
+		if (BuildServer.ReadPipe || BuildServer.WritePipe)
+		{
+			FPlatformProcess::ClosePipe(BuildServer.ReadPipe, BuildServer.WritePipe);
+			BuildServer.ReadPipe = nullptr;
+			BuildServer.WritePipe = nullptr;
+		}
+	}
+
+	bool SendFrame(FSocket* Socket, const FString& Message)
+	{
+		FTCHARToUTF8 MessageData(*Message);
+		int32 MessageSize = MessageData.Length();
+		return SendAll(Socket, reinterpret_cast<const uint8*>(&MessageSize), sizeof(MessageSize))
+			&& SendAll(Socket, reinterpret_cast<const uint8*>(MessageData.Get()), MessageSize);
+	}
+
+	bool ReceiveFrame(FSocket* Socket, TSharedPtr<FJsonObject>& OutMessage)
+	{
+		int32 MessageSize = 0;
+		if (!ReceiveAll(Socket, reinterpret_cast<uint8*>(&MessageSize), sizeof(MessageSize)) || MessageSize < 0 || MessageSize > MaxBuildServerFrameSize)
+		{
+			return false;
+		}
+
+		TArray<uint8> MessageData;
+		MessageData.SetNumUninitialized(MessageSize);
+		if (!ReceiveAll(Socket, MessageData.GetData(), MessageSize))
+		{
+			return false;
+		}
+
+		FUTF8ToTCHAR Message(reinterpret_cast<const ANSICHAR*>(MessageData.GetData()), MessageData.Num());
+		TSharedRef<TJsonReader<TCHAR>> Reader = TJsonReaderFactory<TCHAR>::Create(FString(Message.Length(), Message.Get()));
+		return FJsonSerializer::Deserialize(Reader, OutMessage) && OutMessage.IsValid();
+	}
+
+	// Sends one invocation to the build server and waits for it to finish. Caller holds the build server lock.
+	bool SendBuildServerRequest(const TArray<FString>& Arguments, const FCSOnCommandOutput& OnOutput, const TSharedPtr<FCSCommandCancellation>& Cancellation, FCSCommandResult& OutResult)
+	{
+		FString Request;
+		TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Request);
+		Writer->WriteArrayStart();
+		for (const FString& Argument : Arguments)
+		{
+			Writer->WriteValue(Argument);
+		}
+		Writer->WriteArrayEnd();
+		Writer->Close();
+
+		if (!SendFrame(BuildServer.Socket, Request))
+		{
+			return false;
+		}
+
+		// The output is streamed as it's written, until the exit code arrives
+		while (true)
+		{
+			if (Cancellation.IsValid() && Cancellation->IsCanceled() && !OutResult.bCanceled)
+			{
+				OutResult.bCanceled = true;
+				if (!SendFrame(BuildServer.Socket, TEXT("\"Cancel\"")))
+				{
+					return false;
+				}
+			}
+
+			if (!BuildServer.Socket->Wait(ESocketWaitConditions::WaitForRead, FTimespan::FromMilliseconds(100)))
+			{
+				if (BuildServer.Socket->GetConnectionState() != SCS_Connected)
+				{
+					return false;
+				}
+
+				continue;
+			}
+
+			TSharedPtr<FJsonObject> Message;
+			if (!ReceiveFrame(BuildServer.Socket, Message))
+			{
+				return false;
+			}
+
+			FString Line;
+			if (Message->TryGetStringField(TEXT("Line"), Line))
+			{
+				OnOutput.ExecuteIfBound(Line);
+				continue;
+			}
+
+			OutResult.ReturnCode = Message->GetIntegerField(TEXT("ExitCode"));
+			OutResult.Output = Message->GetStringField(TEXT("Output"));
+			return true;
+		}
+	}
+
+	// Hands every completed line of the pending output to the callback, and keeps the incomplete one.
+	void ConsumeOutputLines(FString& PendingOutput, FCSCommandResult& Result, const FCSOnCommandOutput& OnOutput, bool bFinal)
+	{
+		while (true)
+		{
+			int32 LineEnd = INDEX_NONE;
+			if (!PendingOutput.FindChar(TEXT('\n'), LineEnd))
+			{
+				if (!bFinal || PendingOutput.IsEmpty())
+				{
+					break;
+				}
+
+				LineEnd = PendingOutput.Len();
+			}
+
+			FString Line = PendingOutput.Left(LineEnd);
+			Line.RemoveFromEnd(TEXT("\r"));
+			PendingOutput.RightChopInline(FMath::Min(LineEnd + 1, PendingOutput.Len()));
+
+			Result.Output += Line + LINE_TERMINATOR;
+			OnOutput.ExecuteIfBound(Line);
+		}
+	}
+
+	FCSCommandResult RunCommand(const FString& ProgramPath, const FString& Arguments, const FString& WorkingDirectory,
+		const FCSOnCommandOutput& OnOutput, const TSharedPtr<FCSCommandCancellation>& Cancellation)
+	{
+		double StartTime = FPlatformTime::Seconds();
+
+		FCSCommandResult Result;
+		Result.ProgramName = FPaths::GetBaseFilename(ProgramPath);
+		Result.Arguments = Arguments;
+
+		void* ReadPipe = nullptr;
+		void* WritePipe = nullptr;
+		FPlatformProcess::CreatePipe(ReadPipe, WritePipe);
+
+		FProcHandle Process = FPlatformProcess::CreateProc(*ProgramPath, *Arguments, false, true, true, nullptr, 0, *WorkingDirectory, WritePipe);
+		if (!Process.IsValid())
+		{
+			FPlatformProcess::ClosePipe(ReadPipe, WritePipe);
+			Result.Output = FString::Printf(TEXT("Failed to start %s"), *ProgramPath);
+			return Result;
+		}
+
+		FString PendingOutput;
+		while (FPlatformProcess::IsProcRunning(Process))
+		{
+			if (Cancellation.IsValid() && Cancellation->IsCanceled())
+			{
+				FPlatformProcess::TerminateProc(Process, true);
+				Result.bCanceled = true;
+				break;
+			}
+
+			PendingOutput += FPlatformProcess::ReadPipe(ReadPipe);
+			ConsumeOutputLines(PendingOutput, Result, OnOutput, false);
+			FPlatformProcess::Sleep(0.01f);
+		}
+
+		FPlatformProcess::WaitForProc(Process);
+		FPlatformProcess::GetProcReturnCode(Process, &Result.ReturnCode);
+
+		PendingOutput += FPlatformProcess::ReadPipe(ReadPipe);
+		ConsumeOutputLines(PendingOutput, Result, OnOutput, true);
+
+		FPlatformProcess::CloseProc(Process);
+		FPlatformProcess::ClosePipe(ReadPipe, WritePipe);
+
+		Result.ElapsedSeconds = FPlatformTime::Seconds() - StartTime;
+		return Result;
+	}
+
+	FCSCommandResult RunBuildTool(const FString& BuildAction, const TMap<FString, FString>& AdditionalArguments,
+		const FCSOnCommandOutput& OnOutput, const TSharedPtr<FCSCommandCancellation>& Cancellation)
+	{
+		TArray<FString> Arguments;
+		GetBuildToolArguments(BuildAction, AdditionalArguments, Arguments);
+
+		FString ProgramPath = FCSProcHelper::GetUnrealSharpBuildToolPath();
+		FString CommandLine = MakeCommandLine(Arguments);
+
+#if WITH_EDITOR
+		if (FCSProcHelper::StartBuildServer())
+		{
+			FScopeLock Lock(&BuildServer.Lock);
+
+			double StartTime = FPlatformTime::Seconds();
+
+			FCSCommandResult Result;
+			Result.ProgramName = FPaths::GetBaseFilename(ProgramPath);
+			Result.Arguments = CommandLine;
+
+			if (BuildServer.Socket && SendBuildServerRequest(Arguments, OnOutput, Cancellation, Result))
+			{
+				Result.ElapsedSeconds = FPlatformTime::Seconds() - StartTime;
+				return Result;
+			}
+
+			// Restarted on the next invocation, this one runs in a process of its own
+			UE_LOG(LogUnrealSharpProcHelper, Warning, TEXT("Lost the connection to the UnrealSharp build server, running %s in a new process."), *BuildAction);
+			DestroyBuildServer();
+		}
+#endif
+
+		return RunCommand(ProgramPath, CommandLine, FCSProcHelper::GetPluginAssembliesPath(), OnOutput, Cancellation);
+	}
+
+	FCSCommandResult RunBuildToolAndInvalidateCaches(const FString& BuildAction, const TMap<FString, FString>& AdditionalArguments,
+		const FCSOnCommandOutput& OnOutput, const TSharedPtr<FCSCommandCancellation>& Cancellation)
+	{
+		FCSCommandResult Result = RunBuildTool(BuildAction, AdditionalArguments, OnOutput, Cancellation);
+
+		// Generating adds projects the cached scan doesn't know about yet.
+		if (BuildAction == BUILD_ACTION_GENERATE_PROJECT || BuildAction == BUILD_ACTION_GENERATE_SOLUTION)
+		{
+			FCSProcHelper::InvalidateProjectPathsCache();
+		}
+
+		return Result;
+	}
+}
 
 bool FCSProcHelper::InvokeCommand(const FString& ProgramPath, const FString& Arguments, int32& OutReturnCode, FString& Output, const FString* InWorkingDirectory)
 {
 	double StartTime = FPlatformTime::Seconds();
-	FString ProgramName = FPaths::GetBaseFilename(ProgramPath);
 	FString WorkingDirectory = InWorkingDirectory ? *InWorkingDirectory : FPaths::GetPath(ProgramPath);
 
 	FString ErrorMessage;
 	FPlatformProcess::ExecProcess(*ProgramPath, *Arguments, &OutReturnCode, &Output, &ErrorMessage, *WorkingDirectory);
 
-	if (OutReturnCode != 0)
+	FCSCommandResult Result;
+	Result.ProgramName = FPaths::GetBaseFilename(ProgramPath);
+	Result.Arguments = Arguments;
+	Result.Output = Output;
+	Result.ReturnCode = OutReturnCode;
+	Result.ElapsedSeconds = FPlatformTime::Seconds() - StartTime;
+	return ReportCommandResult(Result);
+}
+
+bool FCSProcHelper::InvokeUnrealSharpBuildTool(const FString& BuildAction, const TMap<FString, FString>& AdditionalArguments)
+{
+	FCSOnCommandOutput LogOutput = FCSOnCommandOutput::CreateLambda([](const FString& Line)
+	{
+		UE_LOG(LogUnrealSharpProcHelper, Log, TEXT("%s"), *Line);
+	});
+
+	return ReportCommandResult(RunBuildToolAndInvalidateCaches(BuildAction, AdditionalArguments, LogOutput, nullptr));
+}
+
+TFuture<FCSCommandResult> FCSProcHelper::InvokeCommandAsync(const FString& ProgramPath, const FString& Arguments, const FString* InWorkingDirectory,
+	FCSOnCommandOutput OnOutput, TSharedPtr<FCSCommandCancellation> Cancellation)
+{
+	FString WorkingDirectory = InWorkingDirectory ? *InWorkingDirectory : FPaths::GetPath(ProgramPath);
+
+	return Async(EAsyncExecution::Thread, [ProgramPath, Arguments, WorkingDirectory, OnOutput = MoveTemp(OnOutput), Cancellation = MoveTemp(Cancellation)]()
+	{
+		return RunCommand(ProgramPath, Arguments, WorkingDirectory, OnOutput, Cancellation);
+	});
+}
+
+TFuture<FCSCommandResult> FCSProcHelper::InvokeUnrealSharpBuildToolAsync(const FString& BuildAction, const TMap<FString, FString>& AdditionalArguments,
+	FCSOnCommandOutput OnOutput, TSharedPtr<FCSCommandCancellation> Cancellation)
+{
+	return Async(EAsyncExecution::Thread, [BuildAction, AdditionalArguments, OnOutput = MoveTemp(OnOutput), Cancellation = MoveTemp(Cancellation)]()
+	{
+		return RunBuildToolAndInvalidateCaches(BuildAction, AdditionalArguments, OnOutput, Cancellation);
+	});
+}
+
+bool FCSProcHelper::ReportCommandResult(const FCSCommandResult& Result)
+{
+	if (Result.bCanceled)
+	{
+		UE_LOG(LogUnrealSharpProcHelper, Warning, TEXT("%s task (Args: %s) was canceled after %f seconds."), *Result.ProgramName, *Result.Arguments, Result.ElapsedSeconds);
+		return false;
+	}
+
+	if (Result.ReturnCode != 0)
 	{
-		UE_LOG(LogUnrealSharpProcHelper, Error, TEXT("%s task failed (Args: %s) with return code %d. Error: %s"), *ProgramName, *Arguments, OutReturnCode, *Output)
+		UE_LOG(LogUnrealSharpProcHelper, Error, TEXT("%s task failed (Args: %s) with return code %d. Error: %s"), *Result.ProgramName, *Result.Arguments, Result.ReturnCode, *Result.Output)
 
-		FText DialogText = FText::FromString(FString::Printf(TEXT("%s task failed: \n %s"), *ProgramName, *Output));
+		FText DialogText = FText::FromString(FString::Printf(TEXT("%s task failed: \n %s"), *Result.ProgramName, *Result.Output));
 		FMessageDialog::Open(EAppMsgType::Ok, DialogText);
 		return false;
 	}
 
-	double EndTime = FPlatformTime::Seconds();
-	double ElapsedTime = EndTime - StartTime;
-	UE_LOG(LogUnrealSharpProcHelper, Log, TEXT("%s with args (%s) took %f seconds to execute."), *ProgramName, *Arguments, ElapsedTime);
+	UE_LOG(LogUnrealSharpProcHelper, Log, TEXT("%s with args (%s) took %f seconds to execute."), *Result.ProgramName, *Result.Arguments, Result.ElapsedSeconds);
 	return true;
 }
 
-bool FCSProcHelper::InvokeUnrealSharpBuildTool(const FString& BuildAction, const TMap<FString, FString>& AdditionalArguments)
+bool FCSProcHelper::StartBuildServer()
 {
-	FString PluginFolder = FPaths::ConvertRelativePathToFull(IPluginManager::Get().FindPlugin(UE_PLUGIN_NAME)->GetBaseDir());
-	FString DotNetPath = GetDotNetExecutablePath();
+#if WITH_EDITOR
+	FScopeLock Lock(&BuildServer.Lock);
+
+	if (BuildServer.Socket)
+	{
+		return true;
+	}
+
+	if (BuildServer.bFailedToStart || FParse::Param(FCommandLine::Get(), TEXT("NoUnrealSharpBuildServer")))
+	{
+		return false;
+	}
+
+	double StartTime = FPlatformTime::Seconds();
+
+	TArray<FString> Arguments;
+	GetBuildToolArguments(TEXT("Serve"), TMap<FString, FString>(), Arguments);
+
+	FPlatformProcess::CreatePipe(BuildServer.ReadPipe, BuildServer.WritePipe);
 
-	FString Args;
-	Args += FString::Printf(TEXT(" --Action %s"), *BuildAction);
-	Args += FString::Printf(TEXT(" --EngineDirectory \"%s\""), *FPaths::ConvertRelativePathToFull(FPaths::EngineDir()));
-	Args += FString::Printf(TEXT(" --ProjectDirectory \"%s\""), *FPaths::ConvertRelativePathToFull(FPaths::ProjectDir()));
-	Args += FString::Printf(TEXT(" --ProjectName %s"), FApp::GetProjectName());
-	Args += FString::Printf(TEXT(" --PluginDirectory \"%s\""), *PluginFolder);
-	Args += FString::Printf(TEXT(" --DotNetPath \"%s\""), *DotNetPath);
+	FString WorkingDirectory = GetPluginAssembliesPath();
+	BuildServer.Process = FPlatformProcess::CreateProc(*GetUnrealSharpBuildToolPath(), *MakeCommandLine(Arguments), false, true, true,
+		nullptr, 0, *WorkingDirectory, BuildServer.WritePipe);
 
-	if (AdditionalArguments.Num())
+	// The build server picks a free port and writes it to its standard output
+	int32 Port = 0;
+	FString PendingOutput;
+	while (BuildServer.Process.IsValid() && Port == 0 && FPlatformTime::Seconds() - StartTime < BuildServerStartTimeout)
 	{
-		Args += TEXT(" --AdditionalArgs");
-		for (const TPair<FString, FString>& Argument : AdditionalArguments)
+		PendingOutput += FPlatformProcess::ReadPipe(BuildServer.ReadPipe);
+
+		int32 AnnouncementIndex = PendingOutput.Find(BuildServerPortAnnouncement);
+		int32 LineEnd = AnnouncementIndex != INDEX_NONE ? PendingOutput.Find(TEXT("\n"), ESearchCase::CaseSensitive, ESearchDir::FromStart, AnnouncementIndex) : INDEX_NONE;
+		if (LineEnd != INDEX_NONE)
 		{
-			Args += FString::Printf(TEXT(" %s=%s"), *Argument.Key, *Argument.Value);
+			int32 PortIndex = AnnouncementIndex + FCString::Strlen(BuildServerPortAnnouncement);
+			Port = FCString::Atoi(*PendingOutput.Mid(PortIndex, LineEnd - PortIndex).TrimEnd());
+			break;
+		}
+
+		if (!FPlatformProcess::IsProcRunning(BuildServer.Process))
+		{
+			break;
 		}
+
+		FPlatformProcess::Sleep(0.01f);
 	}
 
-	int32 ReturnCode = 0;
-	FString Output;
-	FString WorkingDirectory = GetPluginAssembliesPath();
-	return InvokeCommand(GetUnrealSharpBuildToolPath(), Args, ReturnCode, Output, &WorkingDirectory);
+	if (Port > 0)
+	{
+		ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+		TSharedRef<FInternetAddr> Endpoint = SocketSubsystem->CreateInternetAddr();
+		Endpoint->SetLoopbackAddress();
+		Endpoint->SetPort(Port);
+
+		BuildServer.Socket = FTcpSocketBuilder(TEXT("UnrealSharp Build Server Client")).AsBlocking();
+		if (BuildServer.Socket && !BuildServer.Socket->Connect(*Endpoint))
+		{
+			SocketSubsystem->DestroySocket(BuildServer.Socket);
+			BuildServer.Socket = nullptr;
+		}
+	}
+
+	if (!BuildServer.Socket)
+	{
+		UE_LOG(LogUnrealSharpProcHelper, Warning, TEXT("Failed to start the UnrealSharp build server, the build tool runs in a new process for every action. Output: %s"), *PendingOutput);
+		DestroyBuildServer();
+		BuildServer.bFailedToStart = true;
+		return false;
+	}
+
+	UE_LOG(LogUnrealSharpProcHelper, Log, TEXT("UnrealSharp build server listening on port %d, started in %f seconds."), Port, FPlatformTime::Seconds() - StartTime);
+	return true;
+#else
+	return false;
+#endif
+}
+
+void FCSProcHelper::StopBuildServer()
+{
+	FScopeLock Lock(&BuildServer.Lock);
+	DestroyBuildServer();
+}
+
+bool FCSProcHelper::IsBuildServerRunning()
+{
+	FScopeLock Lock(&BuildServer.Lock);
+	return BuildServer.Socket != nullptr;
 }
 
 FString FCSProcHelper::GetLatestHostFxrPath()
@@ -132,6 +591,11 @@ FString FCSProcHelper::GetUnrealSharpPluginsPath()
 	return GetPluginAssembliesPath() / "UnrealSharp.Plugins.dll";
 }
 
+FString FCSProcHelper::GetNativeAotLibraryPath()
+{
+	return GetPluginAssembliesPath() / TEXT("NativeAOT") / FString(TEXT("UnrealSharp.Plugins.")) + FPlatformProcess::GetModuleExtension();
+}
+
 FString FCSProcHelper::GetRuntimeConfigPath()
 {
 	return GetPluginAssembliesPath() / "UnrealSharp.runtimeconfig.json";
@@ -147,27 +611,75 @@ FString FCSProcHelper::GetUnrealSharpMetadataPath()
 	return FPaths::Combine(GetUserAssemblyDirectory(), "UnrealSharp.assemblyloadorder.json");
 }
 
-void FCSProcHelper::GetProjectNamesByLoadOrder(TArray<FString>& UserProjectNames, const bool bIncludeGlue)
+FString FCSProcHelper::GetStartupProfileDirectory()
+{
+	return FPaths::ProjectSavedDir() / "UnrealSharp" / "StartupProfiles";
+}
+
+namespace
+{
+	struct FProjectCache
+	{
+		FCriticalSection Lock;
+
+		// Parsed load order metadata, reparsed when the weaver writes a new file.
+		TSharedPtr<FJsonObject> Metadata;
+		FDateTime MetadataTimeStamp;
+		int64 MetadataSize = 0;
+
+		// All project paths, including the glue projects.
+		TArray<FString> ProjectPaths;
+		bool bHasProjectPaths = false;
+	};
+
+	FProjectCache ProjectCache;
+}
+
+static TSharedPtr<FJsonObject> LoadUnrealSharpMetadata()
 {
-	const FString ProjectMetadataPath = GetUnrealSharpMetadataPath();
+	const FString ProjectMetadataPath = FCSProcHelper::GetUnrealSharpMetadataPath();
 
-	if (!FPaths::FileExists(ProjectMetadataPath))
+	const FFileStatData StatData = IFileManager::Get().GetStatData(*ProjectMetadataPath);
+	
+	FScopeLock Lock(&ProjectCache.Lock);
+	
+	if (!StatData.bIsValid)
 	{
 		// Can be null at the start of the project.
-		return;
+		ProjectCache.Metadata.Reset();
+		return nullptr;
+	}
+
+	if (ProjectCache.Metadata.IsValid() && ProjectCache.MetadataTimeStamp == StatData.ModificationTime && ProjectCache.MetadataSize == StatData.FileSize)
+	{
+		return ProjectCache.Metadata;
 	}
 
 	FString JsonString;
 	if (!FFileHelper::LoadFileToString(JsonString, *ProjectMetadataPath))
 	{
 		UE_LOG(LogUnrealSharpProcHelper, Fatal, TEXT("Failed to load UnrealSharp metadata file at: %s"), *ProjectMetadataPath);
-		return;
+		return nullptr;
 	}
 
 	TSharedPtr<FJsonObject> JsonObject;
 	if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(JsonString), JsonObject) || !JsonObject.IsValid())
 	{
 		UE_LOG(LogUnrealSharpProcHelper, Fatal, TEXT("Failed to parse UnrealSharp metadata at: %s"), *ProjectMetadataPath);
+		return nullptr;
+	}
+
+	ProjectCache.Metadata = JsonObject;
+	ProjectCache.MetadataTimeStamp = StatData.ModificationTime;
+	ProjectCache.MetadataSize = StatData.FileSize;
+	return JsonObject;
+}
+
+void FCSProcHelper::GetProjectNamesByLoadOrder(TArray<FString>& UserProjectNames, const bool bIncludeGlue)
+{
+	TSharedPtr<FJsonObject> JsonObject = LoadUnrealSharpMetadata();
+	if (!JsonObject.IsValid())
+	{
 		return;
 	}
 
@@ -185,6 +697,33 @@ void FCSProcHelper::GetProjectNamesByLoadOrder(TArray<FString>& UserProjectNames
 }
 
 
+bool FCSProcHelper::GetProjectReferences(TMap<FString, TArray<FString>>& OutProjectReferences)
+{
+	TSharedPtr<FJsonObject> JsonObject = LoadUnrealSharpMetadata();
+	if (!JsonObject.IsValid())
+	{
+		return false;
+	}
+
+	// Written by newer weavers only.
+	const TSharedPtr<FJsonObject>* ReferencesObject;
+	if (!JsonObject->TryGetObjectField(TEXT("AssemblyReferences"), ReferencesObject))
+	{
+		return false;
+	}
+
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Entry : (*ReferencesObject)->Values)
+	{
+		TArray<FString>& References = OutProjectReferences.FindOrAdd(Entry.Key);
+		for (const TSharedPtr<FJsonValue>& Reference : Entry.Value->AsArray())
+		{
+			References.Add(Reference->AsString());
+		}
+	}
+
+	return true;
+}
+
 void FCSProcHelper::GetAssemblyPathsByLoadOrder(TArray<FString>& AssemblyPaths, const bool bIncludeGlue)
 {
 	FString AbsoluteFolderPath = GetUserAssemblyDirectory();
@@ -201,39 +740,55 @@ void FCSProcHelper::GetAssemblyPathsByLoadOrder(TArray<FString>& AssemblyPaths,
 
 void FCSProcHelper::GetAllProjectPaths(TArray<FString>& ProjectPaths, bool bIncludeProjectGlue)
 {
-	// Use the FileManager to find files matching the pattern
-	IFileManager::Get().FindFilesRecursive(ProjectPaths,
-		*GetScriptFolderDirectory(),
-		TEXT("*.csproj"),
-		true,
-		false,
-		false);
+	FScopeLock Lock(&ProjectCache.Lock);
 
-    TArray<FString> PluginFilePaths;
-    IPluginManager::Get().FindPluginsUnderDirectory(FPaths::ProjectPluginsDir(), PluginFilePaths);
-	
-    for (const FString& PluginFilePath : PluginFilePaths)
-    {
-        FString ScriptDirectory = FPaths::GetPath(PluginFilePath) / "Script";
-        IFileManager::Get().FindFilesRecursive(ProjectPaths,
-            *ScriptDirectory,
-            TEXT("*.csproj"),
-            true,
-            false,
-            false);
-    }
+	if (!ProjectCache.bHasProjectPaths)
+	{
+		TArray<FString>& AllProjectPaths = ProjectCache.ProjectPaths;
+		AllProjectPaths.Reset();
+		
+		// Use the FileManager to find files matching the pattern
+		IFileManager::Get().FindFilesRecursive(AllProjectPaths,
+			*GetScriptFolderDirectory(),
+			TEXT("*.csproj"),
+			true,
+			false,
+			false);
+
+	    TArray<FString> PluginFilePaths;
+	    IPluginManager::Get().FindPluginsUnderDirectory(FPaths::ProjectPluginsDir(), PluginFilePaths);
+		
+	    for (const FString& PluginFilePath : PluginFilePaths)
+	    {
+	        FString ScriptDirectory = FPaths::GetPath(PluginFilePath) / "Script";
+	        IFileManager::Get().FindFilesRecursive(AllProjectPaths,
+	            *ScriptDirectory,
+	            TEXT("*.csproj"),
+	            true,
+	            false,
+	            false);
+	    }
+
+		ProjectCache.bHasProjectPaths = true;
+	}
 
-	for (int32 i = ProjectPaths.Num() - 1; i >= 0; i--)
+	ProjectPaths.Reserve(ProjectPaths.Num() + ProjectCache.ProjectPaths.Num());
+	for (const FString& ProjectPath : ProjectCache.ProjectPaths)
 	{
-		if (bIncludeProjectGlue || !ProjectPaths[i].EndsWith("Glue.csproj"))
+		if (bIncludeProjectGlue || !ProjectPath.EndsWith("Glue.csproj"))
 		{
-			continue;
+			ProjectPaths.Add(ProjectPath);
 		}
-
-		ProjectPaths.RemoveAt(i);
 	}
 }
 
+void FCSProcHelper::InvalidateProjectPathsCache()
+{
+	FScopeLock Lock(&ProjectCache.Lock);
+	ProjectCache.bHasProjectPaths = false;
+	ProjectCache.ProjectPaths.Empty();
+}
+
 bool FCSProcHelper::IsProjectReloadable(FStringView ProjectPath)
 {
     FXmlFile ProjectFile(ProjectPath.GetData());
@@ -1,5 +1,8 @@
 ﻿#pragma once
 
+#include "Async/Future.h"
+#include <atomic>
+
 const FString BUILD_ACTION_BUILD = TEXT("Build");
 const FString BUILD_ACTION_CLEAN = TEXT("Clean");
 const FString BUILD_ACTION_GENERATE_PROJECT = TEXT("GenerateProject");
@@ -22,6 +25,32 @@ enum class EDotNetBuildConfiguration : uint64
 #define HOSTFXR_LINUX "libhostfxr.so"
 #define DOTNET_MAJOR_VERSION "9.0.0"
 
+// Called for every line a command writes, on the thread running the command.
+DECLARE_DELEGATE_OneParam(FCSOnCommandOutput, const FString& /*Line*/);
+
+struct FCSCommandResult
+{
+	FString ProgramName;
+	FString Arguments;
+	FString Output;
+	int32 ReturnCode = -1;
+	double ElapsedSeconds = 0.0;
+	bool bCanceled = false;
+
+	bool Succeeded() const { return !bCanceled && ReturnCode == 0; }
+};
+
+// Shared between the caller and a command running in the background. Cancel kills the command and its child processes.
+class UNREALSHARPPROCHELPER_API FCSCommandCancellation
+{
+public:
+	void Cancel() { bCanceled = true; }
+	bool IsCanceled() const { return bCanceled; }
+
+private:
+	std::atomic<bool> bCanceled = false;
+};
+
 class UNREALSHARPPROCHELPER_API FCSProcHelper final
 {
 public:
@@ -29,12 +58,31 @@ public:
 	static bool InvokeCommand(const FString& ProgramPath, const FString& Arguments, int32& OutReturnCode, FString& Output, const FString* InWorkingDirectory = nullptr);
 	static bool InvokeUnrealSharpBuildTool(const FString& BuildAction, const TMap<FString, FString>& AdditionalArguments = TMap<FString, FString>());
 
+	// Runs a command on a thread of its own, and streams its output line by line while it runs.
+	static TFuture<FCSCommandResult> InvokeCommandAsync(const FString& ProgramPath, const FString& Arguments, const FString* InWorkingDirectory = nullptr,
+		FCSOnCommandOutput OnOutput = FCSOnCommandOutput(), TSharedPtr<FCSCommandCancellation> Cancellation = nullptr);
+
+	static TFuture<FCSCommandResult> InvokeUnrealSharpBuildToolAsync(const FString& BuildAction, const TMap<FString, FString>& AdditionalArguments = TMap<FString, FString>(),
+		FCSOnCommandOutput OnOutput = FCSOnCommandOutput(), TSharedPtr<FCSCommandCancellation> Cancellation = nullptr);
+
+	// Logs the result of a command, and shows its output in a dialog when it failed. Game thread only.
+	static bool ReportCommandResult(const FCSCommandResult& Result);
+
+	// Starts the build tool as a persistent server that later invocations are sent to, keeping .NET, MSBuild and the compiler warm.
+	// Invocations fall back to a new build tool process when the server can't be started. Disabled with -NoUnrealSharpBuildServer.
+	static bool StartBuildServer();
+	static void StopBuildServer();
+	static bool IsBuildServerRunning();
+
 	static FString GetRuntimeConfigPath();
 
 	static FString GetPluginAssembliesPath();
 
 	static FString GetUnrealSharpPluginsPath();
 
+	// UnrealSharp.Plugins compiled ahead of time into a native library, together with the glue and game assemblies.
+	static FString GetNativeAotLibraryPath();
+
 	static FString GetUnrealSharpBuildToolPath();
 
 	// Path to the directory where we store the user's assembly after it has been processed by the weaver.
@@ -43,14 +91,22 @@ public:
 	// Path to file with UnrealSharp metadata
 	static FString GetUnrealSharpMetadataPath();
 
+	// Directory for the managed profiles recorded with -RecordManagedProfile, used by packaging.
+	static FString GetStartupProfileDirectory();
+
 	// Gets the project names in the order they should be loaded.
 	static void GetProjectNamesByLoadOrder(TArray<FString>& UserProjectNames, bool bIncludeGlue = false);
 
+	// Gets the user projects each user project references. Returns false if the metadata doesn't have them.
+	static bool GetProjectReferences(TMap<FString, TArray<FString>>& OutProjectReferences);
+
 	// Same as GetProjectNamesByLoadOrder, but returns the paths to the assemblies instead.
 	static void GetAssemblyPathsByLoadOrder(TArray<FString>& AssemblyPaths, bool bIncludeGlue = false);
 
 	// Gets all the project paths in the /Scripts directory.
+	// The scan is cached until InvalidateProjectPathsCache is called, the editor does so when project files are added or removed.
 	static void GetAllProjectPaths(TArray<FString>& ProjectPaths, bool bIncludeProjectGlue = false);
+	static void InvalidateProjectPathsCache();
 
     // Checks if the project at this path can actually be reloaded. This is mainly used to skip of Roslyn analyzers since we don't want to reload them.
     static bool IsProjectReloadable(FStringView ProjectPath);
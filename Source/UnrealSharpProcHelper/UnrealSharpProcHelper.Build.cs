@@ -23,6 +23,8 @@ public class UnrealSharpProcHelper : ModuleRules
                 "Projects",
                 "Json",
                 "XmlParser",
+                "Sockets",
+                "Networking",
             }
         );
 
@@ -13,7 +13,7 @@ void FUnrealSharpProcHelperModule::StartupModule()
 
 void FUnrealSharpProcHelperModule::ShutdownModule()
 {
-    
+    FCSProcHelper::StopBuildServer();
 }
 
 #undef LOCTEXT_NAMESPACE
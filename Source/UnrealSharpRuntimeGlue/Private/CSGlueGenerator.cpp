@@ -1,27 +1,87 @@
 ﻿#include "CSGlueGenerator.h"
 #include "UnrealSharpRuntimeGlue.h"
+#include "Editor.h"
+#include "Async/Async.h"
+#include "Hash/CityHash.h"
 #include "Logging/StructuredLog.h"
 #include "UnrealSharpProcHelper/CSProcHelper.h"
 
 void UCSGlueGenerator::SaveRuntimeGlue(const FCSScriptBuilder& ScriptBuilder, const FString& FileName, const FString& Suffix)
 {
 	const FString Path = FPaths::Combine(FCSProcHelper::GetProjectGlueFolderPath(), FileName + Suffix);
+	const FStringView RuntimeGlue = ScriptBuilder.ToView();
+	const uint64 RuntimeGlueHash = CityHash64(reinterpret_cast<const char*>(RuntimeGlue.GetData()), RuntimeGlue.Len() * sizeof(TCHAR));
 
-	FString CurrentRuntimeGlue;
-	FFileHelper::LoadFileToString(CurrentRuntimeGlue, *Path);
-
-	if (CurrentRuntimeGlue == ScriptBuilder.ToString())
+	const uint64* SavedHash = SavedGlueHashes.Find(Path);
+	if (SavedHash && *SavedHash == RuntimeGlueHash && IFileManager::Get().FileExists(*Path))
 	{
 		// No changes, return
 		return;
 	}
 
-	if (!FFileHelper::SaveStringToFile(ScriptBuilder.ToString(), *Path))
+	// First save of this file in the session, compare against what's on disk so the timestamp doesn't change
+	const bool bCompareWithDisk = SavedHash == nullptr;
+	SavedGlueHashes.Add(Path, RuntimeGlueHash);
+
+	TWeakObjectPtr<UCSGlueGenerator> WeakThis(this);
+	SavePipe.Launch(UE_SOURCE_LOCATION, [WeakThis, Path, FileName, RuntimeGlue = FString(RuntimeGlue), bCompareWithDisk]
+	{
+		if (bCompareWithDisk)
+		{
+			FString CurrentRuntimeGlue;
+			if (FFileHelper::LoadFileToString(CurrentRuntimeGlue, *Path) && RuntimeGlue.Equals(CurrentRuntimeGlue))
+			{
+				return;
+			}
+		}
+
+		const bool bSaved = FFileHelper::SaveStringToFile(RuntimeGlue, *Path);
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, Path, FileName, bSaved]
+		{
+			UCSGlueGenerator* This = WeakThis.Get();
+			if (!This)
+			{
+				return;
+			}
+
+			if (!bSaved)
+			{
+				UE_LOGFMT(LogUnrealSharpRuntimeGlue, Error, "Failed to save runtime glue to {0}", *Path);
+				This->SavedGlueHashes.Remove(Path);
+				return;
+			}
+
+			UE_LOGFMT(LogUnrealSharpRuntimeGlue, Display, "Saved {0}", *FileName);
+			FUnrealSharpRuntimeGlueModule::Get().GetOnRuntimeGlueChanged().Broadcast(This, Path);
+		});
+	});
+}
+
+void UCSGlueGenerator::BeginDestroy()
+{
+	SavePipe.WaitUntilEmpty();
+	Super::BeginDestroy();
+}
+
+void UCSGlueGenerator::MarkDirty()
+{
+	if (bIsDirty)
+	{
+		return;
+	}
+
+	bIsDirty = true;
+	GEditor->GetTimerManager()->SetTimerForNextTick(FTimerDelegate::CreateUObject(this, &UCSGlueGenerator::RefreshIfDirty));
+}
+
+void UCSGlueGenerator::RefreshIfDirty()
+{
+	if (!bIsDirty)
 	{
-		UE_LOGFMT(LogUnrealSharpRuntimeGlue, Error, "Failed to save runtime glue to {0}", *Path);
 		return;
 	}
 
-	UE_LOGFMT(LogUnrealSharpRuntimeGlue, Display, "Saved {0}", *FileName);
-	FUnrealSharpRuntimeGlueModule::Get().GetOnRuntimeGlueChanged().Broadcast(this, Path);
+	bIsDirty = false;
+	RefreshDirty();
 }
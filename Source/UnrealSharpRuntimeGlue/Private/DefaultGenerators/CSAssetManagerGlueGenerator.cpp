@@ -5,6 +5,7 @@
 
 #include "Engine/AssetManager.h"
 #include "Engine/AssetManagerSettings.h"
+#include "Export/UAssetManagerExporter.h"
 
 void UCSAssetManagerGlueGenerator::Initialize()
 {
@@ -142,27 +143,48 @@ void UCSAssetManagerGlueGenerator::ProcessAssetIds()
 	UAssetManager& AssetManager = UAssetManager::Get();
 	const UAssetManagerSettings& Settings = AssetManager.GetSettings();
 
+	TArray<FPrimaryAssetId> PrimaryAssetIds;
+	for (const FPrimaryAssetTypeInfo& PrimaryAssetType : Settings.PrimaryAssetTypesToScan)
+	{
+		AssetManager.GetPrimaryAssetIdList(PrimaryAssetType.PrimaryAssetType, PrimaryAssetIds);
+	}
+
+	TArray<FString> AssetNames;
+	AssetNames.Reserve(PrimaryAssetIds.Num());
+
+	for (const FPrimaryAssetId& AssetId : PrimaryAssetIds)
+	{
+		AssetNames.Add(ReplaceSpecialCharacters(AssetId.PrimaryAssetType.GetName().ToString() + TEXT(".") + AssetId.PrimaryAssetName.ToString()));
+	}
+
 	FCSScriptBuilder ScriptBuilder(FCSScriptBuilder::IndentType::Tabs);
+	ScriptBuilder.Reserve(PrimaryAssetIds.Num() * 256);
 	ScriptBuilder.AppendLine();
 	ScriptBuilder.AppendLine(TEXT("using UnrealSharp.CoreUObject;"));
 	ScriptBuilder.AppendLine();
-	ScriptBuilder.AppendLine(TEXT("public static class AssetIds"));
+
+	// Hashes resolve through a native lookup table, so the ids don't go through string to name conversion when used
+	ScriptBuilder.AppendLine(TEXT("public static class AssetIdHashes"));
 	ScriptBuilder.OpenBrace();
 
-	for (const FPrimaryAssetTypeInfo& PrimaryAssetType : Settings.PrimaryAssetTypesToScan)
+	for (int32 Index = 0; Index < PrimaryAssetIds.Num(); Index++)
 	{
-		TArray<FPrimaryAssetId> PrimaryAssetIdList;
-		AssetManager.GetPrimaryAssetIdList(PrimaryAssetType.PrimaryAssetType, PrimaryAssetIdList);
-		for (const FPrimaryAssetId& AssetType : PrimaryAssetIdList)
-		{
-			FString AssetName = PrimaryAssetType.PrimaryAssetType.ToString() + TEXT(".") + AssetType.PrimaryAssetName.
-				ToString();
-			AssetName = ReplaceSpecialCharacters(AssetName);
+		ScriptBuilder.AppendLinef(TEXT("public const ulong %s = 0x%016llXUL;"),
+			*AssetNames[Index], UUAssetManagerExporter::HashPrimaryAssetId(PrimaryAssetIds[Index]));
+	}
 
-			ScriptBuilder.AppendLine(FString::Printf(
-				TEXT("public static readonly FPrimaryAssetId %s = new(\"%s\", \"%s\");"),
-				*AssetName, *AssetType.PrimaryAssetType.GetName().ToString(), *AssetType.PrimaryAssetName.ToString()));
-		}
+	ScriptBuilder.CloseBrace();
+	ScriptBuilder.AppendLine();
+
+	ScriptBuilder.AppendLine(TEXT("public static class AssetIds"));
+	ScriptBuilder.OpenBrace();
+
+	for (int32 Index = 0; Index < PrimaryAssetIds.Num(); Index++)
+	{
+		const FPrimaryAssetId& AssetId = PrimaryAssetIds[Index];
+		ScriptBuilder.AppendLinef(
+			TEXT("public static FPrimaryAssetId %s => FPrimaryAssetId.FromHash(AssetIdHashes.%s, \"%s\", \"%s\");"),
+			*AssetNames[Index], *AssetNames[Index], *AssetId.PrimaryAssetType.GetName().ToString(), *AssetId.PrimaryAssetName.ToString());
 	}
 
 	ScriptBuilder.CloseBrace();
@@ -185,8 +207,8 @@ void UCSAssetManagerGlueGenerator::ProcessAssetTypes()
 	{
 		FString AssetTypeName = ReplaceSpecialCharacters(PrimaryAssetType.PrimaryAssetType.ToString());
 
-		ScriptBuilder.AppendLine(FString::Printf(TEXT("public static readonly FPrimaryAssetType %s = new(\"%s\");"),
-		                                         *AssetTypeName, *PrimaryAssetType.PrimaryAssetType.ToString()));
+		ScriptBuilder.AppendLinef(TEXT("public static readonly FPrimaryAssetType %s = new(\"%s\");"),
+		                          *AssetTypeName, *PrimaryAssetType.PrimaryAssetType.ToString());
 	}
 
 	ScriptBuilder.CloseBrace();
@@ -9,12 +9,13 @@
 
 void UCSGameplayTagsGlueGenerator::Initialize()
 {
-	IGameplayTagsModule::OnTagSettingsChanged.AddUObject(this, &UCSGameplayTagsGlueGenerator::ProcessGameplayTags);
-	IGameplayTagsModule::OnGameplayTagTreeChanged.AddUObject(this, &UCSGameplayTagsGlueGenerator::ProcessGameplayTags);
-	ProcessGameplayTags();
+	// A single edit can change the tag tree several times, regenerate once on the next tick
+	IGameplayTagsModule::OnTagSettingsChanged.AddUObject(this, &UCSGameplayTagsGlueGenerator::OnGameplayTagsChanged);
+	IGameplayTagsModule::OnGameplayTagTreeChanged.AddUObject(this, &UCSGameplayTagsGlueGenerator::OnGameplayTagsChanged);
+	ProcessGameplayTags(true);
 }
 
-void UCSGameplayTagsGlueGenerator::ProcessGameplayTags()
+void UCSGameplayTagsGlueGenerator::ProcessGameplayTags(bool bForce)
 {
 	TArray<const FGameplayTagSource*> Sources;
 	UGameplayTagsManager& GameplayTagsManager = UGameplayTagsManager::Get();
@@ -26,25 +27,17 @@ void UCSGameplayTagsGlueGenerator::ProcessGameplayTags()
 		GameplayTagsManager.FindTagSourcesWithType(SourceType, Sources);
 	}
 
-	FCSScriptBuilder ScriptBuilder(FCSScriptBuilder::IndentType::Tabs);
-	ScriptBuilder.AppendLine(TEXT("using UnrealSharp.GameplayTags;"));
-	ScriptBuilder.AppendLine();
-	ScriptBuilder.AppendLine(TEXT("public static class GameplayTags"));
-	ScriptBuilder.OpenBrace();
-
 	TArray<FName> TagNames;
-	auto GenerateGameplayTag = [&ScriptBuilder, &TagNames](const FGameplayTagTableRow& RowTag)
+	TSet<FName> UniqueTagNames;
+	auto AddGameplayTag = [&TagNames, &UniqueTagNames](const FGameplayTagTableRow& RowTag)
 	{
-		if (TagNames.Contains(RowTag.Tag))
+		bool bIsAlreadyInSet = false;
+		UniqueTagNames.Add(RowTag.Tag, &bIsAlreadyInSet);
+
+		if (!bIsAlreadyInSet)
 		{
-			return;
+			TagNames.Add(RowTag.Tag);
 		}
-
-		const FString TagName = RowTag.Tag.ToString();
-		const FString TagNameVariable = TagName.Replace(TEXT("."), TEXT("_"));
-		ScriptBuilder.AppendLine(
-			FString::Printf(TEXT("public static readonly FGameplayTag %s = new(\"%s\");"), *TagNameVariable, *TagName));
-		TagNames.Add(RowTag.Tag);
 	};
 
 	for (const FGameplayTagSource* Source : Sources)
@@ -53,7 +46,7 @@ void UCSGameplayTagsGlueGenerator::ProcessGameplayTags()
 		{
 			for (const FGameplayTagTableRow& RowTag : Source->SourceTagList->GameplayTagList)
 			{
-				GenerateGameplayTag(RowTag);
+				AddGameplayTag(RowTag);
 			}
 		}
 
@@ -61,11 +54,72 @@ void UCSGameplayTagsGlueGenerator::ProcessGameplayTags()
 		{
 			for (const FGameplayTagTableRow& RowTag : Source->SourceRestrictedTagList->RestrictedGameplayTagList)
 			{
-				GenerateGameplayTag(RowTag);
+				AddGameplayTag(RowTag);
 			}
 		}
 	}
 
+	uint32 TagsHash = 0;
+	for (const FName& TagName : TagNames)
+	{
+		TagsHash = HashCombineFast(TagsHash, GetTypeHash(TagName));
+	}
+
+	if (!bForce && TagsHash == GeneratedTagsHash && TagNames.Num() == NumGeneratedTags)
+	{
+		return;
+	}
+
+	FCSScriptBuilder ScriptBuilder(FCSScriptBuilder::IndentType::Tabs);
+	ScriptBuilder.Reserve(TagNames.Num() * 128);
+	ScriptBuilder.AppendLine(TEXT("using UnrealSharp.GameplayTags;"));
+	ScriptBuilder.AppendLine();
+	ScriptBuilder.AppendLine(TEXT("public static class GameplayTags"));
+	ScriptBuilder.OpenBrace();
+
+	// All tags are resolved with one native call when the class is first used, instead of one call per tag.
+	// The table is split over several lines, the compiler folds it back into a single constant.
+	constexpr int32 TagsPerLine = 64;
+	ScriptBuilder.AppendLine(TEXT("private const string TagTable ="));
+	ScriptBuilder.Indent();
+
+	if (TagNames.IsEmpty())
+	{
+		ScriptBuilder.AppendLine(TEXT("\"\";"));
+	}
+
+	FString TableLine;
+	for (int32 TagIndex = 0; TagIndex < TagNames.Num(); ++TagIndex)
+	{
+		TableLine += TagNames[TagIndex].ToString();
+
+		const bool bIsLastTag = TagIndex == TagNames.Num() - 1;
+		if (!bIsLastTag)
+		{
+			TableLine += TEXT(",");
+		}
+
+		if (bIsLastTag || (TagIndex + 1) % TagsPerLine == 0)
+		{
+			ScriptBuilder.AppendLinef(TEXT("\"%s\"%s"), *TableLine, bIsLastTag ? TEXT(";") : TEXT(" +"));
+			TableLine.Reset();
+		}
+	}
+
+	ScriptBuilder.Unindent();
+	ScriptBuilder.AppendLine();
+	ScriptBuilder.AppendLinef(TEXT("private static readonly FGameplayTag[] Tags = FGameplayTag.RequestGameplayTags(TagTable, %d);"), TagNames.Num());
+	ScriptBuilder.AppendLine();
+
+	for (int32 TagIndex = 0; TagIndex < TagNames.Num(); ++TagIndex)
+	{
+		const FString TagNameVariable = TagNames[TagIndex].ToString().Replace(TEXT("."), TEXT("_"));
+		ScriptBuilder.AppendLinef(TEXT("public static readonly FGameplayTag %s = Tags[%d];"), *TagNameVariable, TagIndex);
+	}
+
 	ScriptBuilder.CloseBrace();
 	SaveRuntimeGlue(ScriptBuilder, TEXT("GameplayTags"));
+
+	GeneratedTagsHash = TagsHash;
+	NumGeneratedTags = TagNames.Num();
 }
@@ -13,11 +13,6 @@ void UCSTraceTypeQueryGlueGenerator::Initialize()
 	ProcessTraceTypeQuery();
 }
 
-void UCSTraceTypeQueryGlueGenerator::OnCollisionProfileChanged(UCollisionProfile* CollisionProfile)
-{
-	GEditor->GetTimerManager()->SetTimerForNextTick(FTimerDelegate::CreateUObject(this, &ThisClass::ProcessTraceTypeQuery));
-}
-
 void UCSTraceTypeQueryGlueGenerator::ProcessTraceTypeQuery()
 {
 	// Initialize CollisionProfile in-case it's not loaded yet
@@ -49,7 +44,7 @@ void UCSTraceTypeQueryGlueGenerator::ProcessTraceTypeQuery()
 
 		FString ChannelName = TraceTypeQueryEnum->GetMetaData(TEXT("ScriptName"), i);
 		ChannelName.RemoveFromStart(TEXT("ECC_"));
-		ScriptBuilder.AppendLine(FString::Printf(TEXT("%s = %d,"), *ChannelName, i));
+		ScriptBuilder.AppendLinef(TEXT("%s = %d,"), *ChannelName, i);
 	}
 
 	ScriptBuilder.CloseBrace();
@@ -81,7 +76,7 @@ void UCSTraceTypeQueryGlueGenerator::ProcessTraceTypeQuery()
 		}
 		
 		ObjectTypeName.RemoveFromStart(TEXT("ECC_"));
-		ScriptBuilder.AppendLine(FString::Printf(TEXT("%s = %d,"), *ObjectTypeName, i));
+		ScriptBuilder.AppendLinef(TEXT("%s = %d,"), *ObjectTypeName, i);
 	}
 
 	ScriptBuilder.CloseBrace();
@@ -9,13 +9,12 @@ DEFINE_LOG_CATEGORY(LogUnrealSharpRuntimeGlue);
 
 void FUnrealSharpRuntimeGlueModule::StartupModule()
 {
-	FModuleManager::Get().OnModulesChanged().AddRaw(this, &FUnrealSharpRuntimeGlueModule::OnModulesChanged);
 	InitializeRuntimeGlueGenerators();
 }
 
 void FUnrealSharpRuntimeGlueModule::ShutdownModule()
 {
-
+	FModuleManager::Get().OnModulesChanged().Remove(OnModulesChangedHandle);
 }
 
 void FUnrealSharpRuntimeGlueModule::ForceRefreshRuntimeGlue()
@@ -36,6 +35,7 @@ void FUnrealSharpRuntimeGlueModule::ForceRefreshRuntimeGlue()
 void FUnrealSharpRuntimeGlueModule::InitializeRuntimeGlueGenerators()
 {
 	const UCSRuntimeGlueSettings* Settings = GetDefault<UCSRuntimeGlueSettings>();
+	AwaitedModules.Reset();
 
 	for (const TSoftClassPtr<UCSGlueGenerator>& Generator : Settings->Generators)
 	{
@@ -46,7 +46,36 @@ void FUnrealSharpRuntimeGlueModule::InitializeRuntimeGlueGenerators()
 		}
 
 		UClass* GeneratorClass = Generator.Get();
-		if (!GeneratorClass || RuntimeGlueGenerators.Contains(GeneratorClass))
+		if (!GeneratorClass)
+		{
+			// Native generator classes become available when their module loads.
+			FString ModuleName = Generator.ToSoftObjectPath().GetLongPackageName();
+			if (ModuleName.RemoveFromStart(TEXT("/Script/")))
+			{
+				AwaitedModules.Add(FName(ModuleName));
+			}
+			continue;
+		}
+
+		if (RuntimeGlueGenerators.Contains(GeneratorClass))
+		{
+			continue;
+		}
+
+		TArray<FName> ModuleDependencies;
+		GeneratorClass->GetDefaultObject<UCSGlueGenerator>()->GetModuleDependencies(ModuleDependencies);
+
+		bool bHasLoadedDependencies = true;
+		for (const FName& ModuleDependency : ModuleDependencies)
+		{
+			if (!FModuleManager::Get().IsModuleLoaded(ModuleDependency))
+			{
+				AwaitedModules.Add(ModuleDependency);
+				bHasLoadedDependencies = false;
+			}
+		}
+
+		if (!bHasLoadedDependencies)
 		{
 			continue;
 		}
@@ -56,11 +85,23 @@ void FUnrealSharpRuntimeGlueModule::InitializeRuntimeGlueGenerators()
 
 		GeneratorInstance->Initialize();
 	}
+
+	// Only listen to module loads while a generator is waiting for one.
+	FModuleManager& ModuleManager = FModuleManager::Get();
+	if (AwaitedModules.IsEmpty())
+	{
+		ModuleManager.OnModulesChanged().Remove(OnModulesChangedHandle);
+		OnModulesChangedHandle.Reset();
+	}
+	else if (!OnModulesChangedHandle.IsValid())
+	{
+		OnModulesChangedHandle = ModuleManager.OnModulesChanged().AddRaw(this, &FUnrealSharpRuntimeGlueModule::OnModulesChanged);
+	}
 }
 
 void FUnrealSharpRuntimeGlueModule::OnModulesChanged(FName ModuleName, EModuleChangeReason Reason)
 {
-	if (Reason != EModuleChangeReason::ModuleLoaded)
+	if (Reason != EModuleChangeReason::ModuleLoaded || !AwaitedModules.Contains(ModuleName))
 	{
 		return;
 	}
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "CSScriptBuilder.h"
+#include "Tasks/Pipe.h"
 #include "UObject/Object.h"
 #include "CSGlueGenerator.generated.h"
 
@@ -14,6 +15,32 @@ class UNREALSHARPRUNTIMEGLUE_API UCSGlueGenerator : public UObject
 public:
 	virtual void Initialize() {}
 	virtual void ForceRefresh() {}
+
+	// Modules the generator reads from. It's created once all of them are loaded, and module loads are only
+	// watched while a generator is waiting for one.
+	virtual void GetModuleDependencies(TArray<FName>& OutModuleNames) const {}
+
+	// UObject interface
+	virtual void BeginDestroy() override;
+	// End of UObject interface
 protected:
+	// Compares and writes the file off the game thread, OnRuntimeGlueChanged is broadcast on the game thread once it's written.
 	void SaveRuntimeGlue(const FCSScriptBuilder& ScriptBuilder, const FString& FileName, const FString& Suffix = FString(TEXT(".cs")));
+
+	// Regenerate on the next tick. Changes marked in the same frame are coalesced into one RefreshDirty.
+	void MarkDirty();
+	bool IsDirty() const { return bIsDirty; }
+
+	// Called for MarkDirty. Unlike ForceRefresh, generators may skip work when their inputs haven't changed.
+	virtual void RefreshDirty() { ForceRefresh(); }
+private:
+	void RefreshIfDirty();
+
+	bool bIsDirty = false;
+
+	// Hash of the content last written to or read from each glue file, so unchanged glue is skipped without reading the file
+	TMap<FString, uint64> SavedGlueHashes;
+
+	// Saves of the generator run in order, so an older version of a file can't overwrite a newer one.
+	UE::Tasks::FPipe SavePipe{ UE_SOURCE_LOCATION };
 };
@@ -19,6 +19,13 @@ public:
 	void Indent()
 	{
 		++IndentCount;
+
+		// The prefix only grows, lines take as much of it as the current indentation needs
+		const FStringView IndentUnit = GetIndentUnit();
+		while (IndentPrefix.Len() < IndentCount * IndentUnit.Len())
+		{
+			IndentPrefix.Append(IndentUnit);
+		}
 	}
 
 	void Unindent()
@@ -26,6 +33,12 @@ public:
 		--IndentCount;
 	}
 
+	// Reserve room for at least NumChars more characters, to avoid growing the buffer line by line in large generators
+	void Reserve(int32 NumChars)
+	{
+		Report.Reserve(Report.Len() + NumChars);
+	}
+
 	void AppendLine()
 	{
 		if (Report.Len() != 0)
@@ -33,20 +46,15 @@ public:
 			Report.Append(LINE_TERMINATOR);
 		}
 
-		if (IndentMode == IndentType::Spaces)
-		{
-			for (int32 Index = 0; Index < IndentCount; Index++)
-			{
-				Report.Append(TEXT("    "));
-			}
-		}
-		else
-		{
-			for (int32 Index = 0; Index < IndentCount; Index++)
-			{
-				Report.Append(TEXT("\t"));
-			}
-		}
+		Report.Append(FStringView(IndentPrefix).Left(IndentCount * GetIndentUnit().Len()));
+	}
+
+	// Start a new line and format directly into the buffer, without a temporary FString::Printf
+	template <typename FmtType, typename... Types>
+	void AppendLinef(const FmtType& Fmt, Types... Args)
+	{
+		AppendLine();
+		Report.Appendf(Fmt, Args...);
 	}
 
 	void Append(FStringView String)
@@ -66,7 +74,7 @@ public:
 
 	void Append(const FName& Name)
 	{
-		Report.Append(Name.ToString());
+		Name.AppendString(Report);
 	}
 
 	void AppendLine(const FText& Text)
@@ -104,7 +112,7 @@ public:
 	void AppendLine(const FName& Name)
 	{
 		AppendLine();
-		Report.Append(Name.ToString());
+		Name.AppendString(Report);
 	}
 
 	void AppendLine(const TCHAR* Line)
@@ -149,6 +157,16 @@ public:
 		return Report.ToString();
 	}
 
+	FStringView ToView() const
+	{
+		return Report.ToView();
+	}
+
+	int32 Len() const
+	{
+		return Report.Len();
+	}
+
 	bool IsEmpty() const
 	{
 		return Report.Len() == 0;
@@ -156,7 +174,13 @@ public:
 
 private:
 
+	FStringView GetIndentUnit() const
+	{
+		return IndentMode == IndentType::Spaces ? FStringView(TEXT("    ")) : FStringView(TEXT("\t"));
+	}
+
 	TStringBuilder<2048> Report;
+	FString IndentPrefix;
 	TArray<FString> Directives;
 	int32 UnsafeBlockCount;
 	int32 IndentCount;
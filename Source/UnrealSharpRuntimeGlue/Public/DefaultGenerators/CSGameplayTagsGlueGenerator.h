@@ -13,8 +13,15 @@ class UCSGameplayTagsGlueGenerator : public UCSGlueGenerator
 private:
 	// UCSGlueGenerator interface
 	virtual void Initialize() override;
-	virtual void ForceRefresh() override { ProcessGameplayTags(); }
+	virtual void ForceRefresh() override { ProcessGameplayTags(true); }
+	virtual void RefreshDirty() override { ProcessGameplayTags(false); }
+	virtual void GetModuleDependencies(TArray<FName>& OutModuleNames) const override { OutModuleNames.Add(TEXT("GameplayTags")); }
 	// End of UCSGlueGenerator interface
 
-	void ProcessGameplayTags();
+	void OnGameplayTagsChanged() { MarkDirty(); }
+	void ProcessGameplayTags(bool bForce);
+
+	// Hash of the tag names the glue was last generated from, the class isn't rebuilt when the tags are the same
+	uint32 GeneratedTagsHash = 0;
+	int32 NumGeneratedTags = INDEX_NONE;
 };
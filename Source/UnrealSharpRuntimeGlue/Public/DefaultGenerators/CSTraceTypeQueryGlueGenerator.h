@@ -16,7 +16,7 @@ private:
 	virtual void ForceRefresh() override { ProcessTraceTypeQuery(); }
 	// End of UCSGlueGenerator interface
 
-	void OnCollisionProfileChanged(UCollisionProfile* CollisionProfile);
+	void OnCollisionProfileChanged(UCollisionProfile* CollisionProfile) { MarkDirty(); }
 	
 	void ProcessTraceTypeQuery();
 };
@@ -28,5 +28,10 @@ private:
     void OnModulesChanged(FName ModuleName, EModuleChangeReason Reason);
     
     TMap<TObjectKey<UClass>, UCSGlueGenerator*> RuntimeGlueGenerators;
+
+    // Modules a generator from the settings is waiting for, either the module of its class or one of its dependencies.
+    // Other module loads don't initialize generators again.
+    TSet<FName> AwaitedModules;
+    FDelegateHandle OnModulesChangedHandle;
     FOnRuntimeGlueChanged OnRuntimeGlueChanged;
 };
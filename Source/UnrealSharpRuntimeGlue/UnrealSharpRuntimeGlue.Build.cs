@@ -20,6 +20,7 @@ public class UnrealSharpRuntimeGlue : ModuleRules
                 "Engine",
                 "Slate",
                 "UnrealSharpProcHelper",
+                "UnrealSharpCore",
                 "SlateCore",
                 "DeveloperSettings",
                 "UnrealEd",